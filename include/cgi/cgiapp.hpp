@@ -34,6 +34,7 @@
 */
 
 #include <corelib/ncbireg.hpp>
+#include <corelib/ncbithr.hpp>
 #include <cgi/ncbires.hpp>
 #include <cgi/caf.hpp>
 
@@ -84,7 +85,11 @@ public:
     ///
     /// 1-based for FastCGI (but 0 before the first iteration starts);
     /// always 0 for regular (i.e. not "fast") CGIs.
-    unsigned int GetFCgiIteration(void) const { return m_Iteration; }
+    /// In the multi-threaded FastCGI mode ([FastCGI].Threads) it is the
+    /// number of the request being processed by the current thread among
+    /// all requests accepted by the process.
+    unsigned int GetFCgiIteration(void) const
+        { return x_GetState().m_Iteration; }
 
     /// Return TRUE if it is running as a "fast" CGI
     bool IsFastCGI(void) const;
@@ -116,6 +121,11 @@ public:
     ///  Contains the parameters of the HTTP request
     /// @return
     ///  Exit code;  it must be zero on success
+    /// @note
+    ///  In the multi-threaded FastCGI mode ([FastCGI].Threads > 1) it is
+    ///  called concurrently from several threads, each having its own
+    ///  context and request context. Per-request changes of the diagnostics
+    ///  settings (see ConfigureDiagnostics()) are not made in this mode.
     virtual int ProcessRequest(CCgiContext& context) = 0;
 
     virtual CNcbiResource*     LoadResource(void);
@@ -210,6 +220,8 @@ protected:
 
     /// Schedule Fast-CGI loop to end as soon as possible, after
     /// safely finishing the currently processed request, if any.
+    /// In the multi-threaded FastCGI mode, no more requests are accepted,
+    /// and the loop ends when all threads have finished their requests.
     /// @note
     ///  Calling it from inside OnEvent(eWaiting) will end the Fast-CGI
     ///  loop immediately.
@@ -284,6 +296,40 @@ protected:
     int m_RequestFlags;
 
 private:
+    // Data related to the HTTP request being processed. In the
+    // multi-threaded FastCGI mode each worker thread has its own copy.
+    struct SRequestState
+    {
+        SRequestState(void);
+        ~SRequestState(void);
+
+        unique_ptr<CCgiContext>   m_Context;
+        unique_ptr<ICache>        m_Cache;
+
+        unsigned int              m_Iteration;   // (always 0 for plain CGI)
+
+        /// Flag, indicates arguments are in sync with CGI context
+        /// (becomes TRUE on first call of GetArgs())
+        bool                      m_ArgContextSync;
+
+        /// Parsed cmd.-line args (cmdline + CGI)
+        unique_ptr<CArgs>         m_CgiArgs;
+
+        bool                      m_OutputBroken;
+
+        string                    m_RID;
+        bool                      m_IsResultReady;
+
+        /// Remember if request-start was printed, don't print request-stop
+        /// without request-start.
+        bool                      m_RequestStartPrinted;
+
+        bool                      m_ErrorStatus; // True if HTTP status was
+                                                 // set to a value >=400
+    };
+
+    // Get the request data of the current thread
+    SRequestState& x_GetState(void) const;
 
     // If FastCGI-capable, and run as a Fast-CGI, then iterate through
     // the FastCGI loop (doing initialization and running ProcessRequest()
@@ -293,6 +339,23 @@ private:
     // (exception was thrown or ProcessRequest() returned non-zero value)
     bool x_RunFastCGI(int* result, unsigned int def_iter = 10);
 
+    // Fast-CGI implementation details, see "fcgi_run.cpp"
+    struct SFastCGIRequest;
+    struct SFastCGIShared;
+    class  CFastCGIThread;
+
+    // Process a Fast-CGI request accepted by the caller.
+    // Return FALSE if the Fast-CGI loop should be finished.
+    bool x_ProcessFastCGIRequest(SFastCGIRequest& request,
+                                 unsigned int     max_iterations,
+                                 CCgiStatistics*  stat,
+                                 int*             result);
+
+    // Run the Fast-CGI loop in the worker threads
+    void x_RunFastCGIThreads(SFastCGIShared& shared,
+                             unsigned int    n_threads,
+                             int*            result);
+
     // Write message to the application log, call OnEvent()
     void x_OnEvent(EEvent event, int status);
 
@@ -306,8 +369,11 @@ private:
     bool x_DoneHeadRequest(void) const;
 
     unique_ptr<CNcbiResource>   m_Resource;
-    unique_ptr<CCgiContext>     m_Context;
-    unique_ptr<ICache>          m_Cache;
+
+    // Request data of the main thread
+    mutable SRequestState       m_State;
+    // Request data of the Fast-CGI worker threads
+    CRef< CTls<SRequestState> > m_ThreadState;
 
     typedef map<string, CDiagFactory*> TDiagFactoryMap;
     TDiagFactoryMap           m_DiagFactories;
@@ -315,34 +381,15 @@ private:
     unique_ptr<CCookieAffinity> m_Caf;         // Cookie affinity service pointer
     char*                     m_HostIP;      // Cookie affinity host IP buffer
 
-    unsigned int              m_Iteration;   // (always 0 for plain CGI)
-
     // Environment var. value to put to the diag.prefix;  [CGI].DiagPrefixEnv
     string                    m_DiagPrefixEnv;
 
-    /// Flag, indicates arguments are in sync with CGI context
-    /// (becomes TRUE on first call of GetArgs())
-    mutable bool              m_ArgContextSync;
-
-    /// Parsed cmd.-line args (cmdline + CGI)
-    mutable unique_ptr<CArgs>   m_CgiArgs;
-
     /// Wrappers for cin and cout
     unique_ptr<CNcbiIstream>    m_InputStream;
     unique_ptr<CNcbiOstream>    m_OutputStream;
-    bool                      m_OutputBroken;
-
-    string m_RID;
-    bool m_IsResultReady;
 
     /// @sa FASTCGI_ScheduleExit()
-    bool m_ShouldExit;
-
-    /// Remember if request-start was printed, don't print request-stop
-    /// without request-start.
-    bool m_RequestStartPrinted;
-
-    bool m_ErrorStatus; // True if HTTP status was set to a value >=400
+    volatile bool m_ShouldExit;
 
     // forbidden
     CCgiApplication(const CCgiApplication&);
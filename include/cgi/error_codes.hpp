@@ -45,7 +45,7 @@ NCBI_DEFINE_ERRCODE_X(Cgi_API,         501, 10);
 NCBI_DEFINE_ERRCODE_X(Cgi_Application, 502, 16);
 NCBI_DEFINE_ERRCODE_X(Cgi_Response,    503,  7);
 NCBI_DEFINE_ERRCODE_X(Cgi_Resourse,    504,  1);
-NCBI_DEFINE_ERRCODE_X(Cgi_Fast,        505,  9);
+NCBI_DEFINE_ERRCODE_X(Cgi_Fast,        505, 13);
 
 
 END_NCBI_SCOPE
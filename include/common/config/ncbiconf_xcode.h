@@ -314,6 +314,9 @@
    the standard libraries. */
 /* #undef HAVE_LIBKSTAT */
 
+/* Define to 1 if liblz4 is available. */
+/* #undef HAVE_LIBLZ4 */
+
 /* Define to 1 if liblzo2 is available. */
 /* #undef HAVE_LIBLZO */
 
@@ -358,6 +361,9 @@
 /* Define to 1 if libz is available. */
 #define HAVE_LIBZ 1
 
+/* Define to 1 if libzstd is available. */
+/* #undef HAVE_LIBZSTD */
+
 /* Define to 1 if you have the <limits> header file. */
 #define HAVE_LIMITS 1
 
@@ -424,6 +430,9 @@
 /* Define to 1 if you have the <poll.h> header file. */
 #define HAVE_POLL_H 1
 
+/* Define to 1 if you have the `posix_fallocate' function. */
+/* #undef HAVE_POSIX_FALLOCATE */
+
 /* Define to 1 if you have the `pthread_atfork' function. */
 /* #undef HAVE_PTHREAD_ATFORK */
 
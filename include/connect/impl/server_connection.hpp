@@ -63,6 +63,7 @@ class CServer_ConnectionPool;
 class IServer_ConnectionBase
 {
 public:
+    IServer_ConnectionBase() : timer_tick(0) { }
     virtual ~IServer_ConnectionBase() { }
     virtual EIO_Event GetEventsToPollFor(const CTime** /*alarm_time*/) const
         { return eIO_Read; }
@@ -84,6 +85,8 @@ private:
     CTime expiration;
     CFastMutex type_lock;
     volatile EServerConnType type;
+    // Connection pool timer wheel tick the connection expires at (or 0)
+    Uint8 timer_tick;
 };
 
 class NCBI_XCONNECT_EXPORT CServer_Connection : public IServer_ConnectionBase,
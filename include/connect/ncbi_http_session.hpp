@@ -51,6 +51,10 @@ BEGIN_NCBI_SCOPE
 class CHttpResponse;
 class CHttpHeaders;
 
+// Pooled connections support, see CHttpSession::SetConnReuse().
+class CHttpConnectionPool;
+class CHttpExchange;
+
 
 // Default retries value.
 struct SGetHttpDefaultRetries
@@ -409,25 +413,45 @@ public:
     /// (e.g. after HEAD request), it's based on status code only.
     bool CanGetContentStream(void) const;
 
+    /// Get time spent on establishing the connection (including TLS
+    /// handshake), in seconds. Zero if an idle pooled connection has been
+    /// reused. Only measured for pooled connections, zero otherwise.
+    /// @sa CHttpSession::SetConnReuse()
+    double GetConnectTime(void) const { return m_ConnectTime; }
+
+    /// Get time from sending the request till receiving the first byte
+    /// of the response, in seconds. For the requests not using pooled
+    /// connections the time includes connecting to the server.
+    double GetTimeToFirstByte(void) const { return m_TimeToFirstByte; }
+
+    /// Get number of requests sent over the same connection before this
+    /// one, zero for a new connection.
+    unsigned int GetReuseCount(void) const { return m_ReuseCount; }
+
     virtual ~CHttpResponse(void) {}
 
 private:
     friend class CHttpRequest;
+    friend class CHttpExchange;
 
-    // CObject wrapper for CConn_HttpStream.
-    // Should not be used directly.
+    // CObject wrapper for CConn_HttpStream or a stream over a pooled
+    // connection. Should not be used directly.
     class CHttpStreamRef : public CObject
     {
     public:
-        CHttpStreamRef(void) {}
-        virtual ~CHttpStreamRef(void) {}
+        CHttpStreamRef(void);
+        virtual ~CHttpStreamRef(void);
         bool IsInitialized(void) const { return m_ConnStream.get() ? true : false; }
-        CConn_IOStream& GetConnStream(void) const { return *m_ConnStream; }
-        void SetConnStream(CConn_IOStream* stream) { m_ConnStream.reset(stream); }
+        CNcbiIostream& GetConnStream(void) const { return *m_ConnStream; }
+        void SetConnStream(CNcbiIostream* stream) { m_ConnStream.reset(stream); }
+        // Request/response exchange if the stream uses a pooled connection.
+        CHttpExchange* GetExchange(void) const;
+        void SetExchange(CHttpExchange* exchange);
     private:
         CHttpStreamRef(const CHttpStreamRef&);
         CHttpStreamRef& operator=(const CHttpStreamRef&);
-        auto_ptr<CConn_IOStream> m_ConnStream;
+        CRef<CHttpExchange>     m_Exchange;
+        auto_ptr<CNcbiIostream> m_ConnStream;
     };
 
     CHttpResponse(CHttpSession& session, const CUrl& url, CHttpStreamRef& stream);
@@ -443,6 +467,9 @@ private:
     CRef<CHttpHeaders>      m_Headers;
     int                     m_StatusCode;
     string                  m_StatusText;
+    double                  m_ConnectTime;
+    double                  m_TimeToFirstByte;
+    unsigned int            m_ReuseCount;
 };
 
 
@@ -497,6 +524,18 @@ private:
     // Open connection, initialize response.
     void x_InitConnection(bool use_form_data);
 
+    // Check if the request can use a pooled connection.
+    bool x_CanUsePool(const SConnNetInfo& net_info) const;
+
+    // Send GET/HEAD request without waiting for the response if the
+    // session allows pipelining. Used by CHttpSession::ExecuteBatch().
+    void x_SendPipelined(void);
+
+    // Follow redirect received over a pooled connection (the C connector
+    // handles redirects by itself). Return false if the response is not
+    // a redirect which can be followed.
+    bool x_FollowRedirect(void);
+
     bool x_CanSendData(void) const;
 
     // Find cookies matching the url, add or replace 'Cookie' header with the
@@ -523,6 +562,7 @@ private:
     CRef<CHttpResponse> m_Response; // current response or null
     CTimeout            m_Timeout;
     THttpRetries        m_Retries;
+    CStopWatch          m_SendTime; // for non-pooled time to first byte
 };
 
 
@@ -609,8 +649,61 @@ public:
     /// @sa GetHttpFlags
     void SetHttpFlags(THTTP_Flags flags) { m_HttpFlags = flags; }
 
+    /// Connection reuse policy. Only applies to requests to generic
+    /// http/https URLs without a proxy, user credentials or
+    /// authentication; other requests always use a new CConn_HttpStream.
+    enum EConnReuse {
+        eConnReuse_None,      ///< New connection for each request (default)
+        eConnReuse_KeepAlive, ///< HTTP/1.1 persistent connections, pooled
+                              ///< per host
+        eConnReuse_Pipeline   ///< Same as eConnReuse_KeepAlive, GET and HEAD
+                              ///< requests may be sent over a connection
+                              ///< before the previous responses are read
+    };
+
+    /// Get connection reuse policy.
+    EConnReuse GetConnReuse(void) const { return m_ConnReuse; }
+    /// Set connection reuse policy. Pooled connections always use HTTP/1.1
+    /// regardless of the protocol set by SetProtocol(). Redirects are
+    /// followed for GET and HEAD requests only, other requests get the
+    /// redirect response.
+    /// @note When a pipelined request is read before the responses sent
+    /// over the same connection earlier, the unread bodies of these
+    /// responses are stored in memory.
+    void SetConnReuse(EConnReuse reuse) { m_ConnReuse = reuse; }
+
+    /// Get max number of idle connections kept per host.
+    unsigned int GetMaxIdleConnections(void) const { return m_MaxIdle; }
+    /// Set max number of idle connections kept per host (4 by default).
+    void SetMaxIdleConnections(unsigned int max_idle) { m_MaxIdle = max_idle; }
+
+    /// Get time an idle connection is kept in the pool.
+    const CTimeout& GetIdleTimeout(void) const { return m_IdleTimeout; }
+    /// Set time an idle connection is kept in the pool (30 seconds by
+    /// default). Infinite timeout keeps connections till the server
+    /// closes them.
+    void SetIdleTimeout(const CTimeout& timeout) { m_IdleTimeout = timeout; }
+
+    /// Get max number of requests sent over a connection before their
+    /// responses are read.
+    unsigned int GetMaxPipelineDepth(void) const { return m_MaxPipelineDepth; }
+    /// Set max number of requests sent over a connection before their
+    /// responses are read (8 by default). Used with eConnReuse_Pipeline only.
+    void SetMaxPipelineDepth(unsigned int depth) { m_MaxPipelineDepth = depth; }
+
+    /// Close all idle pooled connections.
+    void CloseIdleConnections(void);
+
+    /// Execute all requests and store their responses in the same order.
+    /// With eConnReuse_Pipeline all GET and HEAD requests which can use
+    /// pooled connections are sent before reading any response, so the
+    /// requests to the same host share a connection. Other requests are
+    /// executed one by one as with CHttpRequest::Execute().
+    void ExecuteBatch(vector<CHttpRequest>&  requests,
+                      vector<CHttpResponse>& responses);
+
     CHttpSession(void);
-    virtual ~CHttpSession(void) {}
+    virtual ~CHttpSession(void);
 
 private:
     friend class CHttpRequest;
@@ -625,6 +718,11 @@ private:
     EProtocol    m_Protocol;
     THTTP_Flags  m_HttpFlags;
     CHttpCookies m_Cookies;
+    EConnReuse   m_ConnReuse;
+    unsigned int m_MaxIdle;
+    CTimeout     m_IdleTimeout;
+    unsigned int m_MaxPipelineDepth;
+    CRef<CHttpConnectionPool> m_ConnPool;
 };
 
 
@@ -622,6 +622,29 @@ class NCBI_XCONNECT_EXPORT CNetScheduleExecutor
                 unsigned         wait_time,
                 const string&    affinity_list = kEmptyStr);
 
+    /// Get up to max_count pending jobs at once.
+    ///
+    /// The jobs are taken from the first server that has any.
+    /// Servers which do not support job batches (NetSchedule protocol
+    /// versions before 1.5.0) give one job per call.
+    /// Does not wait for jobs to appear.
+    ///
+    /// @param jobs
+    ///     The received jobs are appended to this vector.
+    ///
+    /// @param max_count
+    ///     The max number of jobs to get.
+    ///
+    /// @param affinity_list
+    ///     Comma-separated list of affinity tokens.
+    ///
+    /// @return
+    ///     TRUE if at least one job has been received.
+    ///
+    bool GetJobs(vector<CNetScheduleJob>& jobs,
+                 unsigned                 max_count,
+                 const string&            affinity_list = kEmptyStr);
+
     /// @deprecated
     ///     Use GetJob() instead.
     ///
@@ -697,6 +720,44 @@ class NCBI_XCONNECT_EXPORT CNetScheduleExecutor
     ///
     void PutFailure(const CNetScheduleJob& job, bool no_retries = false);
 
+    /// How CommitJobs() must commit a job.
+    enum ECommitType {
+        eCommitResult,              ///< As PutResult() does
+        eCommitFailure,             ///< As PutFailure() does
+        eCommitFailureNoRetries     ///< As PutFailure(job, true) does
+    };
+
+    /// A job to be committed by CommitJobs().
+    struct SJobCommit
+    {
+        SJobCommit(const CNetScheduleJob& job_to_commit,
+                   ECommitType commit_type) :
+            job(&job_to_commit),
+            type(commit_type)
+        {
+        }
+
+        const CNetScheduleJob* job;
+        ECommitType type;
+        /// Empty if the job has been committed; otherwise the error
+        /// reported by the server for this particular job.
+        string error;
+    };
+    typedef vector<SJobCommit> TJobCommits;
+
+    /// Commit the results and failures of several jobs.
+    ///
+    /// The jobs of each server are sent in one command if the server
+    /// supports job batches (NetSchedule protocol version 1.5.0 and up),
+    /// so that the server can make all of them durable at once.
+    /// Other servers get the jobs one by one.
+    ///
+    /// Errors related to particular jobs are stored in the 'error' fields.
+    /// Communication errors are thrown; in this case any number of the
+    /// jobs may have been committed and the commit may be repeated.
+    ///
+    void CommitJobs(TJobCommits& commits);
+
     /// Reschedule a job with new affinity and/or group information.
     ///
     /// This method requires that the following fields of the specified
@@ -47,9 +47,9 @@ NCBI_DEFINE_ERRCODE_X(Corelib_Blob,       103,  1);
 NCBI_DEFINE_ERRCODE_X(Corelib_Static,     104,  1);
 NCBI_DEFINE_ERRCODE_X(Corelib_System,     105, 13);
 NCBI_DEFINE_ERRCODE_X(Corelib_App,        106, 21);
-NCBI_DEFINE_ERRCODE_X(Corelib_Diag,       107, 29);
+NCBI_DEFINE_ERRCODE_X(Corelib_Diag,       107, 31);
 NCBI_DEFINE_ERRCODE_X(Corelib_File,       108,  4);
-NCBI_DEFINE_ERRCODE_X(Corelib_Object,     109, 15);
+NCBI_DEFINE_ERRCODE_X(Corelib_Object,     109, 16);
 NCBI_DEFINE_ERRCODE_X(Corelib_Reg,        110,  8);
 NCBI_DEFINE_ERRCODE_X(Corelib_Util,       111,  6);
 NCBI_DEFINE_ERRCODE_X(Corelib_StreamBuf,  112, 14);
@@ -474,13 +474,41 @@ CParam<TDescription>::GetState(void)
 }
 
 
+template<class TDescription>
+inline
+SParamThreadValue<typename CParam<TDescription>::TValueType>&
+CParam<TDescription>::sx_GetThreadValue(void)
+{
+    TTls& tls = sx_GetTls();
+    SParamThreadValue<TValueType>* v = tls.GetValue();
+    if ( !v ) {
+        v = new SParamThreadValue<TValueType>;
+        tls.SetValue(v, g_ParamTlsValueCleanup< SParamThreadValue<TValueType> >);
+    }
+    return *v;
+}
+
+
 template<class TDescription>
 inline
 typename CParam<TDescription>::TValueType
 CParam<TDescription>::GetDefault(void)
 {
-    CMutexGuard guard(s_GetLock());
-    return sx_GetDefault();
+    // Once all sources have been checked the value can change only through
+    // SetDefault()/ResetDefault() which invalidate cached copies, so each
+    // thread can use its own copy without locking.
+    if (sx_GetState() < eState_Config) {
+        CMutexGuard guard(s_GetLock());
+        return sx_GetDefault();
+    }
+    SParamThreadValue<TValueType>& thr_value = sx_GetThreadValue();
+    TNCBIAtomicValue epoch = sx_GetCacheEpoch();
+    if (thr_value.m_CacheEpoch != epoch) {
+        CMutexGuard guard(s_GetLock());
+        thr_value.m_CachedDefault = sx_GetDefault();
+        thr_value.m_CacheEpoch = epoch;
+    }
+    return thr_value.m_CachedDefault;
 }
 
 
@@ -494,6 +522,7 @@ void CParam<TDescription>::SetDefault(const TValueType& val)
     if (state < eState_User) {
         state = eState_User;
     }
+    sx_InvalidateCache();
 }
 
 
@@ -503,6 +532,7 @@ void CParam<TDescription>::ResetDefault(void)
 {
     CMutexGuard guard(s_GetLock());
     sx_GetDefault(true);
+    sx_InvalidateCache();
 }
 
 
@@ -512,9 +542,9 @@ typename CParam<TDescription>::TValueType
 CParam<TDescription>::GetThreadDefault(void)
 {
     if ( !sx_IsSetFlag(eParam_NoThread) ) {
-        TValueType* v = sx_GetTls().GetValue();
-        if ( v ) {
-            return *v;
+        SParamThreadValue<TValueType>* v = sx_GetTls().GetValue();
+        if ( v  &&  v->m_HaveThreadDefault ) {
+            return v->m_ThreadDefault;
         }
     }
     return GetDefault();
@@ -529,8 +559,9 @@ void CParam<TDescription>::SetThreadDefault(const TValueType& val)
         NCBI_THROW(CParamException, eNoThreadValue,
             "The parameter does not allow thread-local values");
     }
-    TTls& tls = sx_GetTls();
-    tls.SetValue(new TValueType(val), g_ParamTlsValueCleanup<TValueType>);
+    SParamThreadValue<TValueType>& thr_value = sx_GetThreadValue();
+    thr_value.m_ThreadDefault = val;
+    thr_value.m_HaveThreadDefault = true;
 }
 
 
@@ -541,7 +572,11 @@ void CParam<TDescription>::ResetThreadDefault(void)
     if ( sx_IsSetFlag(eParam_NoThread) ) {
         return; // already using global default value
     }
-    sx_GetTls().SetValue(NULL);
+    SParamThreadValue<TValueType>* v = sx_GetTls().GetValue();
+    if ( v ) {
+        v->m_HaveThreadDefault = false;
+        v->m_ThreadDefault = TValueType();
+    }
 }
 
 
@@ -185,6 +185,28 @@ double NCBI_XNCBI_EXPORT g_GetConfigDouble(const char* section,
                                            const char* env_var_name,
                                            double  default_value);
 
+/////////////////////////////////////////////////////////////////////////////
+///
+/// SParamThreadValue
+///
+/// Per-thread data of a parameter: thread default value (if set) and
+/// the cached copy of the global default value. The cached value is valid
+/// only while its epoch matches CParamBase cache epoch.
+///
+
+template<class TValue>
+struct SParamThreadValue
+{
+    SParamThreadValue(void)
+        : m_HaveThreadDefault(false), m_CacheEpoch(0) {}
+
+    TValue           m_ThreadDefault;
+    bool             m_HaveThreadDefault;
+    TValue           m_CachedDefault;
+    TNCBIAtomicValue m_CacheEpoch;  ///< Zero if nothing is cached
+};
+
+
 /////////////////////////////////////////////////////////////////////////////
 ///
 /// Parameter declaration and definition macros
@@ -211,7 +233,7 @@ double NCBI_XNCBI_EXPORT g_GetConfigDouble(const char* section,
         typedef type TValueType;                                            \
         typedef desctype<TValueType> TDescription;                          \
         typedef TDescription::TStaticValue TStaticValue;                    \
-        typedef CStaticTls< type > TTls;                                    \
+        typedef CStaticTls< SParamThreadValue< type > > TTls;               \
         static TDescription sm_ParamDescription;                            \
         static TStaticValue sm_Default;                                     \
         static bool sm_DefaultInitialized;                                  \
@@ -450,6 +472,18 @@ public:
         eState_EnvVar = 4, ///< The environment variable has been checked
         eState_Config = 5  ///< The app. config file has been checked
     };
+
+protected:
+    /// Get current epoch of the cached default values. Cached values
+    /// are valid only while the epoch does not change.
+    static TNCBIAtomicValue sx_GetCacheEpoch(void)
+        { return sm_CacheEpoch.Get() + 1; }
+    /// Invalidate default values cached by all threads for all params.
+    static void sx_InvalidateCache(void)
+        { sm_CacheEpoch.Add(1); }
+
+private:
+    static CAtomicCounter sm_CacheEpoch;
 };
 
 
@@ -554,6 +588,8 @@ private:
 
     static TValueType& sx_GetDefault(bool force_reset = false);
     static TTls&       sx_GetTls    (void);
+    /// Get per-thread data, create it if necessary.
+    static SParamThreadValue<TValueType>& sx_GetThreadValue(void);
     static EParamState& sx_GetState(void);
 
     static bool sx_IsSetFlag(ENcbiParamFlags flag);
@@ -0,0 +1,101 @@
+#ifndef CORELIB___NCBI_SLAB_ALLOC__HPP
+#define CORELIB___NCBI_SLAB_ALLOC__HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ */
+
+/// @file ncbi_slab_alloc.hpp
+/// Allocator of small memory blocks with size classes, per-thread caches
+/// of free blocks and central slabs shared by all threads.
+
+
+#include <corelib/ncbistd.hpp>
+
+
+/** @addtogroup Object
+ *
+ * @{
+ */
+
+
+BEGIN_NCBI_SCOPE
+
+
+/// Process-wide allocator for many small short-living memory blocks.
+///
+/// Requested sizes are rounded up to one of the size classes. Each thread
+/// keeps its own lists of free blocks for every size class, so that most
+/// allocations and deallocations don't need any locks. When thread's list
+/// is exhausted or grows too long, blocks are moved between it and the
+/// central list of the size class in batches. Central lists are refilled
+/// by cutting new slabs (big chunks of memory taken from the system heap).
+/// Memory of slabs is never returned to the system, it's only reused for
+/// blocks of the same size class.
+///
+/// Blocks larger than GetMaxBlockSize() are passed to the system heap.
+/// Every block has a small header, so Deallocate() doesn't need to know
+/// the block size and can free blocks of any size and origin.
+///
+/// The allocator is used by CObject::operator new() when it's enabled
+/// either at build time (NCBI_OBJECT_SLAB_ALLOC defined) or at run time
+/// via environment variable NCBI_OBJECT_SLAB_ALLOC set to "1" or "0".
+/// The variable is checked only once at the first CObject allocation.
+/// The registry can't be used for that because registry itself consists
+/// of CObjects.
+class NCBI_XNCBI_EXPORT CSlabAllocator
+{
+public:
+    /// Allocate block of memory with at least given size.
+    /// Throws bad_alloc if there is no memory.
+    static void* Allocate(size_t size);
+
+    /// Free memory block allocated by Allocate().
+    static void Deallocate(void* ptr);
+
+    /// Get maximum size of block served from slabs
+    static size_t GetMaxBlockSize(void);
+
+    /// Return all free blocks cached by the current thread to the central
+    /// lists. It's done automatically when thread finishes.
+    static void ReleaseThreadCache(void);
+
+    /// Get total number of slabs allocated so far
+    static size_t GetSlabsCount(void);
+
+    /// Check if CObject::operator new() uses this allocator
+    static bool IsUsedForObjects(void);
+};
+
+
+END_NCBI_SCOPE
+
+
+/* @} */
+
+#endif  /* CORELIB___NCBI_SLAB_ALLOC__HPP */
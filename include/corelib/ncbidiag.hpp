@@ -2726,6 +2726,15 @@ private:
 /// using standard SetDiagHandler() function, you have to use
 /// InstallToDiag() method of this handler. And don't forget to call
 /// RemoveFromDiag() before your application is finished.
+///
+/// Each posting thread appends pre-formatted messages to its own bounded
+/// ring buffer, so posting does not contend on a common lock. The
+/// dedicated thread drains all rings, restores the posting order and
+/// writes messages in batches. When a thread's ring is full, the
+/// overflow policy decides whether the posting thread waits, drops the
+/// message or keeps only a sample of the overflowing messages
+/// (see [Diag]/Async_Overflow_Policy). Messages of severity Critical and
+/// above are never dropped.
 
 class CAsyncDiagThread;
 
@@ -2735,13 +2744,20 @@ public:
     CAsyncDiagHandler(void);
     virtual ~CAsyncDiagHandler(void);
 
+    /// What to do with a message when the posting thread's ring is full.
+    enum EOverflowPolicy {
+        eOverflow_Default, ///< Use [Diag]/Async_Overflow_Policy value
+        eOverflow_Block,   ///< Wait until the ring has free space
+        eOverflow_Drop,    ///< Drop the message
+        eOverflow_Sample   ///< Drop all but each N-th overflowing message
+                           ///< (see [Diag]/Async_Overflow_Sample_Rate)
+    };
+
     /// Install this DiagHandler into diagnostics.
     /// Method should be called only when diagnostics is completely
     /// initialized, i.e. no earlier than CNcbiApplication::Run() is called.
     /// Method can throw CThreadException if dedicated thread failed
     /// to start.
-    /// @deprecated Use regular diganostics instead.
-    NCBI_DEPRECATED
     void InstallToDiag(void);
     /// Remove this DiagHandler from diagnostics.
     /// This method must be called if InstallToDiag was called. Object cannot
@@ -2753,6 +2769,15 @@ public:
     /// Value can be set only before call to InstallToDiag(), any change
     /// of the value after call to InstallToDiag() will be ignored.
     void SetCustomThreadSuffix(const string& suffix);
+    /// Set policy applied when a thread's ring buffer overflows.
+    /// Similar to the thread suffix, the value must be set before call
+    /// to InstallToDiag().
+    void SetOverflowPolicy(EOverflowPolicy policy);
+
+    /// Number of messages posted through this handler so far.
+    Uint8 GetPostedCount(void) const;
+    /// Number of messages lost because of ring buffer overflow.
+    Uint8 GetLostCount(void) const;
 
     /// Implementation of CDiagHandler
     virtual void Post(const SDiagMessage& mess);
@@ -2763,6 +2788,9 @@ private:
     /// Thread handling all physical printing of log messages
     CAsyncDiagThread* m_AsyncThread;
     string m_ThreadSuffix;
+    EOverflowPolicy m_OverflowPolicy;
+    Uint8 m_PostedCount;
+    Uint8 m_LostCount;
 };
 
 
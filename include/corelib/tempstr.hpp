@@ -39,6 +39,7 @@
 #include <corelib/ncbimisc.hpp>
 #include <corelib/ncbidbg.hpp>
 #include <algorithm>
+#include <string.h>
 
 
 BEGIN_NCBI_SCOPE
@@ -261,6 +262,17 @@ bool operator>(const string& str1, const CTempString str2)
     return str2.compare(str1) < 0;
 }
 
+/// @internal
+/// Find the first char in [str, str+len) which is one of the chars in
+/// [set, set+set_len) (or is not, if 'find_not' is TRUE).
+/// Uses vector instructions where available.
+/// @return
+///   Pointer to the found char, or NULL if not found.
+NCBI_XNCBI_EXPORT
+const char* g_CTempString_FindFirstOf(const char* str, size_t len,
+                                      const char* set, size_t set_len,
+                                      bool find_not);
+
 // Operator +
 
 /// @internal
@@ -571,10 +583,12 @@ CTempString::size_type CTempString::find_first_of(const CTempString match,
                                                   size_type pos) const
 {
     if (match.length()  &&  pos < length()) {
-        const_iterator it = std::find_first_of(begin() + pos, end(),
-                                               match.begin(), match.end());
-        if (it != end()) {
-            return it - begin();
+        const char* ptr = match.length() == 1
+            ? (const char*)memchr(begin() + pos, match[0], length() - pos)
+            : g_CTempString_FindFirstOf(begin() + pos, length() - pos,
+                                        match.data(), match.length(), false);
+        if (ptr) {
+            return ptr - begin();
         }
     }
     return npos;
@@ -586,22 +600,11 @@ CTempString::size_type CTempString::find_first_not_of(const CTempString match,
                                                       size_type pos) const
 {
     if (match.length()  &&  pos < length()) {
-        const_iterator it = begin() + pos;
-        const_iterator end_it = end();
-        const_iterator match_begin = match.begin();
-        const_iterator match_end   = match.end();
-        for ( ;  it != end_it;  ++it) {
-            bool found = false;
-            for (const_iterator match_it = match_begin;
-                 match_it != match_end;  ++match_it) {
-                if (*it == *match_it) {
-                    found = true;
-                    break;
-                }
-            }
-            if ( !found ) {
-                return it - begin();
-            }
+        const char* ptr =
+            g_CTempString_FindFirstOf(begin() + pos, length() - pos,
+                                      match.data(), match.length(), true);
+        if (ptr) {
+            return ptr - begin();
         }
     }
     return npos;
@@ -674,12 +677,9 @@ CTempString::size_type CTempString::find(char match, size_type pos) const
     if (pos + 1 > length()) {
         return npos;
     }
-    for (size_type i = pos;  i < length();  ++i) {
-        if (m_String[i] == match) {
-            return i;
-        }
-    }
-    return npos;
+    const char* ptr = (const char*)memchr(m_String + pos, match,
+                                          length() - pos);
+    return ptr ? ptr - m_String : npos;
 }
 
 
@@ -1020,6 +1020,8 @@ protected:
                                      bool* is_null = 0);
     virtual I_BlobDescriptor* GetBlobDescriptor(void);
     virtual bool            SkipItem(void);
+    virtual size_t          FetchBatch(CDB_ResultBatch& batch,
+                                       size_t max_rows);
 
     I_BlobDescriptor*       GetBlobDescriptor(int item_num);
 
@@ -1036,6 +1038,7 @@ protected:
 		CS_DATAFMT& fmt,
 		CDB_Object* item_buf
 		);
+    void GetBatchItemInternal(CDB_ResultBatch& batch, unsigned int col);
     CS_COMMAND* x_GetSybaseCmd(void) const { return m_Cmd; }
     CS_RETCODE Check(CS_RETCODE rc)
     {
@@ -1230,6 +1233,8 @@ protected:
     }
     I_BlobDescriptor*       GetBlobDescriptor(int item_num);
     virtual bool            SkipItem(void);
+    virtual size_t          FetchBatch(CDB_ResultBatch& batch,
+                                       size_t max_rows);
 
 private:
     CDB_Result* GetResultSet(void) const;
@@ -0,0 +1,193 @@
+#ifndef DBAPI_DRIVER___DBAPI_BULK_LOADER__HPP
+#define DBAPI_DRIVER___DBAPI_BULK_LOADER__HPP
+
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:  Parallel bulk (BCP) loading pipeline
+ *
+ */
+
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbitime.hpp>
+#include <dbapi/driver/public.hpp>
+
+/** @addtogroup DbPubInterfaces
+ *
+ * @{
+ */
+
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+///  CDB_BulkLoader::
+///
+///  Bulk-insert rows given as text fields into one table.  Rows are
+///  collected into batches of a fixed size; converter threads turn each
+///  batch into values of the destination column types, and loader threads,
+///  each with a connection and a CDB_BCPInCmd of its own, send the batches
+///  to the server concurrently.  A loader commits (CompleteBatch()) once it
+///  has sent at least SetCommitRows() rows since its last commit.
+///
+///  Batches are numbered in the order they are filled.  With a progress
+///  file, the numbers of committed batches are appended to it at every
+///  commit, and batches recorded there by an earlier, interrupted run are
+///  skipped, so that rerunning the same input resumes the load.  (A batch
+///  whose commit succeeded on the server but was not recorded because the
+///  client failed right then would be loaded again.)
+///
+///  Without thread support everything is done by the calling thread, over
+///  a single connection.
+///
+
+class NCBI_DBAPIDRIVER_EXPORT CDB_BulkLoader
+{
+public:
+    /// Open the n_connections connections (one without thread support)
+    /// right away; conn_params is not used after the constructor returns.
+    CDB_BulkLoader(I_DriverContext&     context,
+                   const CDBConnParams& conn_params,
+                   const string&        table_name,
+                   unsigned int         n_connections = 1,
+                   unsigned int         n_converters  = 1);
+    /// Abandon the load unless Finish() has been called: rows not yet
+    /// committed are discarded.
+    ~CDB_BulkLoader(void);
+
+    /// @name Setup; must precede the first row.
+    /// @{
+    /// Declare the next column of the table.  The prototype's type (and
+    /// size, precision, and scale, where applicable) is used for the values
+    /// of the column.
+    void AddColumn(const CDB_Object& prototype);
+    /// Rows per batch (1000 by default).
+    void SetBatchRows(size_t n);
+    /// Rows sent by a loader between commits; 0 (the default) to commit
+    /// every batch.
+    void SetCommitRows(size_t n);
+    /// Format of date/time fields ("Y-M-D h:m:s" by default).
+    void SetTimeFormat(const CTimeFormat& fmt);
+    /// Hints for CDB_BCPInCmd::SetHints().
+    void SetHints(const string& hints);
+    /// Record committed batches in "path", and skip the ones recorded there
+    /// already.  The file must have been written with the same batch size.
+    void SetProgressFile(const string& path);
+    /// @}
+
+    /// @name Row building.
+    /// @{
+    void AddField(const CTempString& value);
+    void AddNULL (void);
+    /// Complete the current row; every column must have got a field.
+    /// Errors from the background threads are rethrown here.
+    void FinishRow(void);
+    /// @}
+
+    /// Load the last (partial) batch, wait for all batches to be committed,
+    /// and close the BCP commands.  Rethrows background errors.
+    void Finish(void);
+
+    /// Rows committed by this run.
+    Uint8 GetCommittedRows(void) const;
+    /// Rows skipped as committed by an earlier run.
+    Uint8 GetSkippedRows(void) const { return m_SkippedRows; }
+
+private:
+    CDB_BulkLoader(const CDB_BulkLoader&);
+    CDB_BulkLoader& operator= (const CDB_BulkLoader&);
+
+    struct SBatch;
+    struct SLoader;
+    class  CWorkerThread;
+    friend class CWorkerThread;
+
+    typedef vector<CDB_Object*> TPrototypes;
+    typedef list<SBatch*>       TBatches;
+    typedef vector<SLoader*>    TLoaders;
+    typedef set<Uint8>          TBatchNumbers;
+
+    void x_Start     (void);
+    void x_ReadProgress(void);
+    void x_Submit    (void);
+    void x_Convert   (SBatch& batch);
+    void x_Load      (SLoader& loader, SBatch& batch);
+    void x_Commit    (SLoader& loader, bool last);
+    void x_Abort     (SLoader& loader);
+    void x_Converter (void);
+    void x_Loader    (SLoader& loader);
+    void x_SetError  (const CDB_Exception& error);
+    void x_CheckError(void);
+    void x_Stop      (void);
+
+    I_DriverContext&       m_Context;
+    string                 m_TableName;
+    unsigned int           m_NConnections;
+    unsigned int           m_NConverters;
+    TPrototypes            m_Prototypes;
+    size_t                 m_BatchRows;
+    size_t                 m_CommitRows;
+    CTimeFormat            m_TimeFormat;
+    string                 m_Hints;
+    string                 m_ProgressPath;
+    bool                   m_Started;
+    bool                   m_Finished;
+
+    // Owned by the calling thread
+    SBatch*                m_Current;
+    Uint8                  m_NextNumber;
+    Uint8                  m_SkippedRows;
+    TBatchNumbers          m_Committed;   // by earlier runs
+
+    // Shared with the worker threads, guarded by m_Mutex
+    mutable CFastMutex     m_Mutex;
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    CConditionVariable     m_Cond;
+#endif
+    vector< CRef<CThread> > m_Threads;
+    TLoaders               m_Loaders;
+    TBatches               m_AllBatches;  // Owned
+    TBatches               m_Free;
+    TBatches               m_ToConvert;
+    TBatches               m_ToLoad;
+    unsigned int           m_ConvertersLeft;
+    bool                   m_InputDone;
+    bool                   m_Stop;
+    Uint8                  m_CommittedRows;
+    AutoPtr<CNcbiOfstream> m_Progress;
+    AutoPtr<CDB_Exception> m_Error;
+};
+
+
+END_NCBI_SCOPE
+
+
+/* @} */
+
+
+#endif  /* DBAPI_DRIVER___DBAPI_BULK_LOADER__HPP */
@@ -0,0 +1,232 @@
+#ifndef DBAPI_DRIVER___DBAPI_RESULT_BATCH__HPP
+#define DBAPI_DRIVER___DBAPI_RESULT_BATCH__HPP
+
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:  Columnar (batch) retrieval of result sets
+ *
+ */
+
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbitime.hpp>
+#include <dbapi/driver/public.hpp>
+
+/** @addtogroup DbPubInterfaces
+ *
+ * @{
+ */
+
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+///  CDB_ResultBatch::
+///
+///  Up to N rows of a result set, stored column by column in typed
+///  vectors.  Filled by CDB_Result::FetchBatch().  All buffers are kept
+///  (and reused) from one batch to the next, so that fetching a large
+///  result set in batches does not allocate per row or per cell.
+///
+
+class NCBI_DBAPIDRIVER_EXPORT CDB_ResultBatch
+{
+public:
+    /// How the values of a column are stored.
+    enum EStorage {
+        eStorage_Int,       ///< Bit, TinyInt, SmallInt, Int, BigInt
+        eStorage_Double,    ///< Float, Double
+        eStorage_DateTime,  ///< SmallDateTime, DateTime
+        eStorage_Bytes      ///< Everything else; Numeric as text
+    };
+
+    static EStorage GetStorage(EDB_Type type);
+
+    class NCBI_DBAPIDRIVER_EXPORT CColumn : public CObject
+    {
+    public:
+        CColumn(const string& name, EDB_Type type, size_t max_size);
+        ~CColumn(void);
+
+        const string& GetName    (void) const { return m_Name;     }
+        EDB_Type      GetDataType(void) const { return m_Type;     }
+        EStorage      GetStorage (void) const { return m_Storage;  }
+        size_t        GetMaxSize (void) const { return m_MaxSize;  }
+        size_t        size       (void) const { return m_Nulls.size(); }
+
+        bool IsNULL(size_t row) const
+            { _ASSERT(row < size());  return m_Nulls[row] != 0; }
+        /// eStorage_Int only; 0 for NULL values.
+        Int8 GetInt8(size_t row) const
+            { _ASSERT(row < m_Ints.size());  return m_Ints[row]; }
+        /// eStorage_Double only; 0 for NULL values.
+        double GetDouble(size_t row) const
+            { _ASSERT(row < m_Doubles.size());  return m_Doubles[row]; }
+        /// eStorage_DateTime only; empty for NULL values.
+        const CTime& GetTime(size_t row) const
+            { _ASSERT(row < m_Times.size());  return m_Times[row]; }
+        /// eStorage_Bytes only; empty for NULL values.  The data stays
+        /// valid until the batch is refilled.
+        CTempString GetBytes(size_t row) const
+        {
+            _ASSERT(row + 1 < m_Offsets.size());
+            return CTempString(m_Data.data() + m_Offsets[row],
+                               m_Offsets[row + 1] - m_Offsets[row]);
+        }
+
+        /// @name For drivers filling the batch.
+        /// @{
+        void Clear(void);
+        void AppendNULL(void);
+        void AppendInt8(Int8 value);
+        void AppendDouble(double value);
+        void AppendTime(const CTime& value);
+        void AppendBytes(const void* data, size_t size);
+        /// Reserve room for a value of at most "max_size" bytes and
+        /// return a pointer to it; CommitBytes() then records its actual
+        /// size.  Lets drivers read straight into the column buffer.
+        char* ReserveBytes(size_t max_size);
+        void  CommitBytes(size_t size);
+        /// Append a numeric value in CDB_Numeric's raw layout (sign byte,
+        /// then big-endian magnitude) as text.
+        void  AppendNumeric(unsigned int precision, unsigned int scale,
+                            const unsigned char* raw);
+        /// Append a value already converted to a CDB_Object.
+        void  AppendValue(const CDB_Object& value);
+        /// Scratch object of the column's type for drivers that go
+        /// through GetItem(); created once and reused across batches.
+        CDB_Object& GetScratch(void);
+        /// @}
+
+    private:
+        CColumn(const CColumn&);
+        CColumn& operator= (const CColumn&);
+
+        string               m_Name;
+        EDB_Type             m_Type;
+        EStorage             m_Storage;
+        size_t               m_MaxSize;
+        vector<char>         m_Nulls;
+        vector<Int8>         m_Ints;
+        vector<double>       m_Doubles;
+        vector<CTime>        m_Times;
+        vector<size_t>       m_Offsets;
+        vector<char>         m_Data;
+        size_t               m_DataSize;
+        AutoPtr<CDB_Object>  m_Scratch;
+    };
+
+    CDB_ResultBatch(void);
+    ~CDB_ResultBatch(void);
+
+    size_t GetNumRows   (void) const { return m_NumRows;        }
+    size_t GetNumColumns(void) const { return m_Columns.size(); }
+
+    const CColumn& GetColumn(size_t col) const
+        { _ASSERT(col < m_Columns.size());  return *m_Columns[col]; }
+    CColumn& SetColumn(size_t col)
+        { _ASSERT(col < m_Columns.size());  return *m_Columns[col]; }
+
+    /// Drop all rows and lay the columns out after "params".  Buffers are
+    /// kept if the layout has not changed since the previous batch.
+    void Reset(const CDBParams& params);
+    /// Count the row whose values have just been appended to every column.
+    void FinishRow(void);
+
+private:
+    CDB_ResultBatch(const CDB_ResultBatch&);
+    CDB_ResultBatch& operator= (const CDB_ResultBatch&);
+
+    typedef vector< CRef<CColumn> > TColumns;
+
+    TColumns m_Columns;
+    size_t   m_NumRows;
+};
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+///  CDB_BatchFetcher::
+///
+///  Read a row result in batches of a fixed size, optionally fetching the
+///  next batch on a background thread while the caller processes the
+///  current one.  With prefetching, the result (and its connection) must
+///  not be touched by the caller until the fetcher is destroyed.
+///  Prefetching needs thread support; without it, batches are fetched
+///  synchronously by Next().
+///
+
+class NCBI_DBAPIDRIVER_EXPORT CDB_BatchFetcher
+{
+public:
+    enum EPrefetch {
+        eNoPrefetch,
+        ePrefetch
+    };
+
+    CDB_BatchFetcher(CDB_Result& result, size_t batch_rows,
+                     EPrefetch prefetch = eNoPrefetch);
+    ~CDB_BatchFetcher(void);
+
+    /// Return the next non-empty batch, or NULL at the end of the result
+    /// set.  The batch stays valid until the next call.  Errors from a
+    /// background fetch are rethrown here.
+    const CDB_ResultBatch* Next(void);
+
+private:
+    class CPrefetchThread;
+    friend class CPrefetchThread;
+
+    void x_Prefetch(void);
+
+    CDB_Result&            m_Result;
+    size_t                 m_BatchRows;
+    CDB_ResultBatch        m_Batches[2];
+    // Prefetching state, guarded by m_Mutex
+    CRef<CThread>          m_Thread;
+    CFastMutex             m_Mutex;
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    CConditionVariable     m_Cond;
+#endif
+    size_t                 m_Filled;     // Batches ready for the caller
+    size_t                 m_Next;       // Next batch handed to the caller
+    bool                   m_Held;       // The caller holds a batch
+    bool                   m_Done;       // End of data (or error) reached
+    bool                   m_Stop;
+    AutoPtr<CDB_Exception> m_Error;
+};
+
+
+END_NCBI_SCOPE
+
+
+/* @} */
+
+
+#endif  /* DBAPI_DRIVER___DBAPI_RESULT_BATCH__HPP */
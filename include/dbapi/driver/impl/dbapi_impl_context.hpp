@@ -128,6 +128,31 @@ struct NCBI_DBAPIDRIVER_EXPORT SDBConfParams
 };
 
 
+/////////////////////////////////////////////////////////////////////////////
+///
+///  SConnPoolStats::
+///
+///  Counters of a named connection pool, for monitoring.  The first three
+///  are current values, the rest are totals since the pool was first used.
+///
+
+struct NCBI_DBAPIDRIVER_EXPORT SConnPoolStats
+{
+    SConnPoolStats(void);
+
+    unsigned int in_use;    //< Connections handed out (including overflow)
+    unsigned int idle;      //< Connections waiting to be reused
+    unsigned int waiting;   //< Threads waiting for a connection
+    Uint8        reused;    //< Requests served by idle connections
+    Uint8        opened;    //< Connections opened for the pool
+    Uint8        waits;     //< Requests that had to wait for a connection
+    Uint8        timeouts;  //< Requests that found the pool full after waiting
+    Uint8        overflows; //< Temporary (not pooled) connections opened then
+    Uint8        discarded; //< Idle connections failing the check on reuse
+    Uint8        evicted;   //< Idle connections closed after the idle time
+};
+
+
 /////////////////////////////////////////////////////////////////////////////
 ///
 ///  CDriverContext::
@@ -230,6 +255,10 @@ public:
     void CloseOldIdleConns (unsigned int max_closings,
                             const string& pool_name = kEmptyStr);
 
+    typedef map<string, SConnPoolStats> TPoolStats;
+    /// Get statistics of all named connection pools of this context.
+    void GetPoolStats(TPoolStats* stats) const;
+
 protected:
     typedef list<CConnection*> TConnPool;
 
@@ -266,12 +295,11 @@ protected:
 
 
 private:
+    struct SConnPool;
+    struct SPoolShard;
+    class  CIdleConnCloser;
+
     mutable CMutex  m_DefaultCtxMtx;
-#ifdef NCBI_THREADS
-    CSemaphore      m_PoolSem;
-    string          m_PoolSemSubject;
-    CConnection*    m_PoolSemConn;
-#endif
 
     unsigned int    m_LoginTimeout; //< Login timeout.
     unsigned int    m_Timeout;      //< Connection timeout.
@@ -285,6 +313,16 @@ private:
     /// Used connections
     TConnPool       m_InUse;
 
+    /// Connections of named pools.  Each pool is kept in one of the shards
+    /// (by the hash of its name) and guarded by the shard's own mutex rather
+    /// than by the context mutex.
+    enum { kPoolShards = 16 };
+    SPoolShard*     m_PoolShards;
+#ifdef NCBI_THREADS
+    CRef<CIdleConnCloser> m_IdleConnCloser;
+    bool            m_IdleConnCloserStopped;
+#endif
+
     /// Stack of `per-context' err.message handlers
     CDBHandlerStack m_CntxHandlers;
     /// Stacks of `per-connection' err.message handlers
@@ -299,6 +337,28 @@ private:
     /// Return unused connection "conn" to the driver context for future
     /// reuse (if "conn_reusable" is TRUE) or utilization
     void x_Recycle(CConnection* conn, bool conn_reusable);
+
+    SPoolShard& x_GetPoolShard(const string& pool_name) const;
+    /// Must be called with the shard's mutex locked.
+    SConnPool&  x_GetPool(SPoolShard& shard, const string& pool_name) const;
+    /// Append connections of all named pools to the lists (if not NULL).
+    void x_GetPooledConns(TConnPool* idle, TConnPool* in_use) const;
+    /// Same, but also remove them from the pools.
+    void x_TakePooledConns(TConnPool* idle, TConnPool* in_use);
+    enum EPoolSlot {
+        ePoolSlot_Reserved, //< Open a new connection in the pool
+        ePoolSlot_Overflow, //< Open a temporary connection beyond the limit
+        ePoolSlot_None      //< No connection may be opened
+    };
+    /// Take a connection from a named pool, waiting for one if the pool is
+    /// full.  Return NULL if none is available, with "slot" telling what
+    /// to do instead.
+    CDB_Connection* x_CheckOutPooled(const CDBConnParams& params,
+                                     EPoolSlot* slot);
+    void x_ReleasePoolSlot(const string& pool_name);
+    void x_DeleteConn(CConnection* conn);
+    void x_StartIdleConnCloser(void);
+    void x_StopIdleConnCloser(void);
 };
 
 
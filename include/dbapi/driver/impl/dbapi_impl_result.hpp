@@ -95,6 +95,12 @@ public:
     /// Skip result item
     virtual bool SkipItem(void) = 0;
 
+    /// Fetch up to "max_rows" rows into "batch"; return the number of rows
+    /// fetched.  The default implementation goes through Fetch() and
+    /// GetItem(), reusing one CDB_Object per column; drivers may override
+    /// it to read straight into the column buffers.
+    virtual size_t FetchBatch(CDB_ResultBatch& batch, size_t max_rows);
+
     void AttachTo(CDB_Result* interface)
     {
         m_Interface = interface;
@@ -55,6 +55,7 @@ namespace impl
 
 
 class CAutoTrans;
+class CDB_ResultBatch;
 template <class I> class CInterfaceHook;
 
 
@@ -520,6 +521,22 @@ public:
     ///   GetItem, ReadItem
     virtual bool SkipItem();
 
+    /// @brief 
+    ///   Fetch up to "max_rows" rows at once, column by column.
+    /// 
+    /// @param batch 
+    ///   Batch to fill.  Its previous rows are dropped, but its buffers are
+    ///   reused, so the same batch should be passed in over and over.
+    /// @param max_rows 
+    ///   Maximum number of rows to fetch.
+    /// 
+    /// @return 
+    ///   Number of rows fetched; 0 if no more rows can be fetched.
+    ///
+    /// @sa
+    ///   Fetch, CDB_BatchFetcher
+    virtual size_t FetchBatch(CDB_ResultBatch& batch, size_t max_rows);
+
     /// Destructor
     virtual ~CDB_Result();
 
@@ -67,16 +67,17 @@ NCBI_DEFINE_ERRCODE_X(Dbapi_Odbc_Cmds,     1126,  5);
 NCBI_DEFINE_ERRCODE_X(Dbapi_Odbc_Results,  1127,  5);
 NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrWinHook,   1128,  9);
 NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrMemStore,  1129,  1);
-NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrResult,    1130,  1);
+NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrResult,    1130,  2);
 NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrUtil,      1131,  2);
 NCBI_DEFINE_ERRCODE_X(Dbapi_Python,        1132,  5);
 NCBI_DEFINE_ERRCODE_X(Dbapi_Variant,       1133,  1);
 NCBI_DEFINE_ERRCODE_X(Dbapi_BlobStream,    1134,  3);
 NCBI_DEFINE_ERRCODE_X(Dbapi_ObjImpls,      1135, 10);
 NCBI_DEFINE_ERRCODE_X(Dbapi_BulkInsert,    1136,  1);
-NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrContext,   1137,  1);
+NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrContext,   1137,  2);
 NCBI_DEFINE_ERRCODE_X(Dbapi_Sdbapi,        1138, 19);
 NCBI_DEFINE_ERRCODE_X(Dbapi_ConnMgr,       1139,  1);
+NCBI_DEFINE_ERRCODE_X(Dbapi_DrvrBulkLoad,  1140,  2);
 
 
 END_NCBI_SCOPE
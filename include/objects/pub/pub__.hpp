@@ -0,0 +1,4 @@
+#include <objects/pub/Pub.hpp>
+#include <objects/pub/Pub_equiv.hpp>
+#include <objects/pub/Pub_set.hpp>
+#include <objects/pub/NCBI_Pub_module.hpp>
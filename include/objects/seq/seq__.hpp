@@ -0,0 +1,44 @@
+#include <objects/seq/Align_def.hpp>
+#include <objects/seq/Annot_descr.hpp>
+#include <objects/seq/Annot_id.hpp>
+#include <objects/seq/Annotdesc.hpp>
+#include <objects/seq/Bioseq.hpp>
+#include <objects/seq/Delta_ext.hpp>
+#include <objects/seq/Delta_seq.hpp>
+#include <objects/seq/GIBB_method.hpp>
+#include <objects/seq/GIBB_mod.hpp>
+#include <objects/seq/GIBB_mol.hpp>
+#include <objects/seq/Heterogen.hpp>
+#include <objects/seq/IUPACaa.hpp>
+#include <objects/seq/IUPACna.hpp>
+#include <objects/seq/Linkage_evidence.hpp>
+#include <objects/seq/Map_ext.hpp>
+#include <objects/seq/MolInfo.hpp>
+#include <objects/seq/NCBI2na.hpp>
+#include <objects/seq/NCBI4na.hpp>
+#include <objects/seq/NCBI8aa.hpp>
+#include <objects/seq/NCBI8na.hpp>
+#include <objects/seq/NCBIeaa.hpp>
+#include <objects/seq/NCBIpaa.hpp>
+#include <objects/seq/NCBIpna.hpp>
+#include <objects/seq/NCBIstdaa.hpp>
+#include <objects/seq/Num_cont.hpp>
+#include <objects/seq/Num_enum.hpp>
+#include <objects/seq/Num_real.hpp>
+#include <objects/seq/Num_ref.hpp>
+#include <objects/seq/Numbering.hpp>
+#include <objects/seq/Pubdesc.hpp>
+#include <objects/seq/Ref_ext.hpp>
+#include <objects/seq/Seg_ext.hpp>
+#include <objects/seq/Seq_annot.hpp>
+#include <objects/seq/Seq_data.hpp>
+#include <objects/seq/Seq_descr.hpp>
+#include <objects/seq/Seq_ext.hpp>
+#include <objects/seq/Seq_gap.hpp>
+#include <objects/seq/Seq_hist.hpp>
+#include <objects/seq/Seq_hist_rec.hpp>
+#include <objects/seq/Seq_inst.hpp>
+#include <objects/seq/Seq_literal.hpp>
+#include <objects/seq/Seqdesc.hpp>
+#include <objects/seq/Textannot_id.hpp>
+#include <objects/seq/NCBI_Sequence_module.hpp>
@@ -0,0 +1,63 @@
+#include <objects/seqfeat/BinomialOrgName.hpp>
+#include <objects/seqfeat/BioSource.hpp>
+#include <objects/seqfeat/Cdregion.hpp>
+#include <objects/seqfeat/Clone_ref.hpp>
+#include <objects/seqfeat/Clone_seq.hpp>
+#include <objects/seqfeat/Clone_seq_set.hpp>
+#include <objects/seqfeat/Code_break.hpp>
+#include <objects/seqfeat/Delta_item.hpp>
+#include <objects/seqfeat/EvidenceBasis.hpp>
+#include <objects/seqfeat/EvidenceCategory.hpp>
+#include <objects/seqfeat/ExperimentSupport.hpp>
+#include <objects/seqfeat/Ext_loc.hpp>
+#include <objects/seqfeat/Feat_id.hpp>
+#include <objects/seqfeat/Gb_qual.hpp>
+#include <objects/seqfeat/Gene_nomenclature.hpp>
+#include <objects/seqfeat/Gene_ref.hpp>
+#include <objects/seqfeat/Genetic_code.hpp>
+#include <objects/seqfeat/Genetic_code_table.hpp>
+#include <objects/seqfeat/Imp_feat.hpp>
+#include <objects/seqfeat/InferenceSupport.hpp>
+#include <objects/seqfeat/ModelEvidenceItem.hpp>
+#include <objects/seqfeat/ModelEvidenceSupport.hpp>
+#include <objects/seqfeat/MultiOrgName.hpp>
+#include <objects/seqfeat/OrgMod.hpp>
+#include <objects/seqfeat/OrgName.hpp>
+#include <objects/seqfeat/Org_ref.hpp>
+#include <objects/seqfeat/PCRPrimer.hpp>
+#include <objects/seqfeat/PCRPrimerName.hpp>
+#include <objects/seqfeat/PCRPrimerSeq.hpp>
+#include <objects/seqfeat/PCRPrimerSet.hpp>
+#include <objects/seqfeat/PCRReaction.hpp>
+#include <objects/seqfeat/PCRReactionSet.hpp>
+#include <objects/seqfeat/PartialOrgName.hpp>
+#include <objects/seqfeat/Phenotype.hpp>
+#include <objects/seqfeat/Population_data.hpp>
+#include <objects/seqfeat/Program_id.hpp>
+#include <objects/seqfeat/Prot_ref.hpp>
+#include <objects/seqfeat/RNA_gen.hpp>
+#include <objects/seqfeat/RNA_qual.hpp>
+#include <objects/seqfeat/RNA_qual_set.hpp>
+#include <objects/seqfeat/RNA_ref.hpp>
+#include <objects/seqfeat/Rsite_ref.hpp>
+#include <objects/seqfeat/SeqFeatData.hpp>
+#include <objects/seqfeat/SeqFeatSupport.hpp>
+#include <objects/seqfeat/SeqFeatXref.hpp>
+#include <objects/seqfeat/Seq_feat.hpp>
+#include <objects/seqfeat/SubSource.hpp>
+#include <objects/seqfeat/TaxElement.hpp>
+#include <objects/seqfeat/Trna_ext.hpp>
+#include <objects/seqfeat/Tx_evidence.hpp>
+#include <objects/seqfeat/Txinit.hpp>
+#include <objects/seqfeat/VariantProperties.hpp>
+#include <objects/seqfeat/Variation_inst.hpp>
+#include <objects/seqfeat/Variation_ref.hpp>
+#include <objects/seqfeat/NCBI_Organism_module.hpp>
+#include <objects/seqfeat/NCBI_BioSource_module.hpp>
+#include <objects/seqfeat/NCBI_Seqfeat_module.hpp>
+#include <objects/seqfeat/NCBI_Variation_module.hpp>
+#include <objects/seqfeat/NCBI_Gene_module.hpp>
+#include <objects/seqfeat/NCBI_Protein_module.hpp>
+#include <objects/seqfeat/NCBI_RNA_module.hpp>
+#include <objects/seqfeat/NCBI_Rsite_module.hpp>
+#include <objects/seqfeat/NCBI_TxInit_module.hpp>
@@ -0,0 +1,3 @@
+#include <objects/seqset/Bioseq_set.hpp>
+#include <objects/seqset/Seq_entry.hpp>
+#include <objects/seqset/NCBI_Seqset_module.hpp>
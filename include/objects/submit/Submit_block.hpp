@@ -0,0 +1,87 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ */
+
+/// @file Submit_block.hpp
+/// User-defined methods of the data storage class.
+///
+/// This file was originally generated by application DATATOOL
+/// using the following specifications:
+/// 'submit.asn'.
+///
+/// New methods or data members can be added to it if needed.
+/// See also: Submit_block_.hpp
+
+
+#ifndef OBJECTS_SUBMIT_SUBMIT_BLOCK_HPP
+#define OBJECTS_SUBMIT_SUBMIT_BLOCK_HPP
+
+
+// generated includes
+#include <objects/submit/Submit_block_.hpp>
+
+// generated classes
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+/////////////////////////////////////////////////////////////////////////////
+class NCBI_SUBMIT_EXPORT CSubmit_block : public CSubmit_block_Base
+{
+    typedef CSubmit_block_Base Tparent;
+public:
+    // constructor
+    CSubmit_block(void);
+    // destructor
+    ~CSubmit_block(void);
+
+private:
+    // Prohibit copy constructor and assignment operator
+    CSubmit_block(const CSubmit_block& value);
+    CSubmit_block& operator=(const CSubmit_block& value);
+
+};
+
+/////////////////// CSubmit_block inline methods
+
+// constructor
+inline
+CSubmit_block::CSubmit_block(void)
+{
+}
+
+
+/////////////////// end of CSubmit_block inline methods
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
+
+#endif // OBJECTS_SUBMIT_SUBMIT_BLOCK_HPP
+/* Original file checksum: lines: 86, chars: 2467, CRC32: 4155dda5 */
@@ -0,0 +1,5 @@
+#include <objects/variation/VariantPlacement.hpp>
+#include <objects/variation/Variation.hpp>
+#include <objects/variation/VariationException.hpp>
+#include <objects/variation/VariationMethod.hpp>
+#include <objects/variation/NCBI_VariationPackage_module.hpp>
@@ -0,0 +1,184 @@
+#ifndef OBJTOOLS_READERS___FASTA_PARALLEL__HPP
+#define OBJTOOLS_READERS___FASTA_PARALLEL__HPP
+
+/*  $Id$
+* ===========================================================================
+*
+*                            PUBLIC DOMAIN NOTICE
+*               National Center for Biotechnology Information
+*
+*  This software/database is a "United States Government Work" under the
+*  terms of the United States Copyright Act.  It was written as part of
+*  the author's official duties as a United States Government employee and
+*  thus cannot be copyrighted.  This software/database is freely available
+*  to the public for use. The National Library of Medicine and the U.S.
+*  Government have not placed any restriction on its use or reproduction.
+*
+*  Although all reasonable efforts have been taken to ensure the accuracy
+*  and reliability of the software and data, the NLM and the U.S.
+*  Government do not and cannot warrant the performance or results that
+*  may be obtained by using this software or data. The NLM and the U.S.
+*  Government disclaim all warranties, express or implied, including
+*  warranties of performance, merchantability or fitness for any particular
+*  purpose.
+*
+*  Please cite the author in any work or product based on this material.
+*
+* ===========================================================================
+*
+* Author:  agent
+*
+*/
+
+/// @file fasta_parallel.hpp
+/// Reading big FASTA files by several threads.
+
+#include <objtools/readers/fasta.hpp>
+
+#include <deque>
+
+/** @addtogroup Miscellaneous
+ *
+ * @{
+ */
+
+BEGIN_NCBI_SCOPE
+
+class CMemoryFile;
+class CThreadPool;
+
+BEGIN_SCOPE(objects)
+
+class CParallelFastaChunk;
+class CParallelFastaItem;
+
+
+/// Reader of big FASTA files, which parses sequences by several threads.
+///
+/// The input is cut into chunks of about SetChunkSize() bytes at defline
+/// boundaries, and each chunk is parsed by its own CFastaReader in a pool
+/// of threads.  Sequences are returned in the input order, with the same
+/// flags semantics as CFastaReader: messages are passed to the listener
+/// (or thrown) in the input order too, IDs are generated by the single
+/// ID generator in the input order, and fUniqueIDs checks all sequences
+/// of the input.  Line numbers and stream positions are counted from the
+/// beginning of the whole input.
+///
+/// Differences from CFastaReader:
+///   - segmented sets ("[...]" syntax), masks and alignments are not
+///     supported, eBadSegSet is thrown for segmented sets;
+///   - progress messages are not reported;
+///   - after an exception the reading is resumed from the next defline.
+///
+/// @sa CFastaReader
+class NCBI_XOBJREAD_EXPORT CParallelFastaReader : public CObject
+{
+public:
+    typedef CFastaReader::TFlags TFlags;
+
+    /// Read a file, which is memory mapped if possible.
+    /// @param threads
+    ///   Number of parsing threads, 0 means number of CPUs.
+    CParallelFastaReader(const string& path, TFlags flags = 0,
+                         unsigned int threads = 0);
+    /// Read a stream, the data is copied into chunks.
+    CParallelFastaReader(CNcbiIstream& in, TFlags flags = 0,
+                         unsigned int threads = 0);
+    virtual ~CParallelFastaReader(void);
+
+    /// Indicates (negatively) whether there is any more input.
+    /// May need to wait for parsing of the next chunk.
+    bool AtEOF(void);
+
+    /// Read next sequence.
+    CRef<CSeq_entry> ReadOneSeq(ILineErrorListener* pMessageListener = 0);
+
+    /// Read multiple sequences (by default, as many as are available.)
+    CRef<CSeq_entry> ReadSet(int max_seqs = kMax_Int,
+                             ILineErrorListener* pMessageListener = 0);
+
+    TFlags GetFlags(void) const { return m_Flags; }
+
+    /// Approximate size of chunk of input data parsed by one thread.
+    /// Must be set before reading.
+    void   SetChunkSize(size_t size);
+    size_t GetChunkSize(void) const { return m_ChunkSize; }
+
+    /// Flags of CReaderBase (fAllIdsAsLocal etc.)
+    void SetReaderFlags(CReaderBase::TReaderFlags flags)
+        { m_ReaderFlags = flags; }
+
+    const CSeqIdGenerator& GetIDGenerator(void) const { return *m_IDGenerator; }
+    CSeqIdGenerator&       SetIDGenerator(void)       { return *m_IDGenerator; }
+    void                   SetIDGenerator(CSeqIdGenerator& gen);
+
+    /// Same as in CFastaReader, must be set before reading.
+    void SetMaxIDLength(Uint4 max_len) { m_MaxIDLength = max_len; }
+    void SetMinGaps(TSeqPos gapNmin, TSeqPos gap_Unknown_length);
+    void SetGapLinkageEvidences(CSeq_gap::EType type,
+                                const set<int>& evidences);
+    void IgnoreProblem(ILineError::EProblem problem);
+
+protected:
+    /// Configure reader of a chunk, called by parsing threads.
+    /// Override it to set other options of CFastaReader.
+    virtual void x_InitChunkReader(CFastaReader& reader) const;
+
+private:
+    friend class CParallelFastaChunk;
+
+    typedef deque< CRef<CParallelFastaChunk> > TChunks;
+    typedef set<CSeq_id_Handle>                TIDTracker;
+
+    void x_Init(unsigned int threads);
+    CRef<CParallelFastaChunk> x_NextChunk(void);
+    bool x_NextMemoryChunk(CParallelFastaChunk& chunk);
+    bool x_NextStreamChunk(CParallelFastaChunk& chunk);
+    void x_FillPipeline(void);
+    CParallelFastaItem* x_NextItem(void);
+    CRef<CSeq_entry> x_EmitItem(CParallelFastaItem& item,
+                                ILineErrorListener* pMessageListener);
+    void x_PostError(const ILineError& error,
+                     ILineErrorListener* pMessageListener);
+
+    TFlags                    m_Flags;
+    CReaderBase::TReaderFlags m_ReaderFlags;
+    size_t                    m_ChunkSize;
+    size_t                    m_MaxChunks;
+    CRef<CSeqIdGenerator>     m_IDGenerator;
+    TIDTracker                m_IDTracker;
+
+    // Options of chunk readers
+    Uint4                     m_MaxIDLength;
+    TSeqPos                   m_GapNmin;
+    TSeqPos                   m_GapUnknownLength;
+    bool                      m_GapTypeSet;
+    CSeq_gap::EType           m_GapType;
+    set<int>                  m_GapLinkageEvidences;
+    vector<ILineError::EProblem> m_IgnoredProblems;
+
+    // Input
+    AutoPtr<CMemoryFile>      m_MemFile;
+    CNcbiIstream*             m_Stream;
+    AutoPtr<CNcbiIstream>     m_OwnStream;
+    const char*               m_DataPos;
+    const char*               m_DataEnd;
+    string                    m_StreamTail;
+    Int8                      m_InputOffset;
+    bool                      m_InputDone;
+
+    // Chunks in the input order, being parsed or ready
+    AutoPtr<CThreadPool>      m_ThreadPool;
+    TChunks                   m_Chunks;
+    CRef<CParallelFastaChunk> m_LastChunk;
+    size_t                    m_NextItem;
+    CAtomicCounter_WithAutoInit m_Canceled;
+};
+
+
+END_SCOPE(objects)
+END_NCBI_SCOPE
+
+/* @} */
+
+#endif  /* OBJTOOLS_READERS___FASTA_PARALLEL__HPP */
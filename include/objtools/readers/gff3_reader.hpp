@@ -89,6 +89,36 @@ public:
 
     bool IsInGenbankMode() const;
 
+    /// Streaming interface: read the features of the next seqid region
+    /// into a Seq-annot (two, if the region also has alignments.)
+    /// A region ends when the input moves to another seqid, at a "###"
+    /// directive, or at a track line. Parent lookups are resolved within
+    /// the region only, and the region's ID tables are dropped before the
+    /// next region is read, so memory is bounded by the largest region
+    /// rather than by the whole file. Successive calls continue where the
+    /// previous call stopped, so they must be given the same stream (or
+    /// line reader) until the end of input; call ResetStream() to switch
+    /// to another one earlier.
+    /// @return
+    ///   empty reference at the end of input.
+    ///
+    virtual CRef<CSeq_annot>
+    ReadSeqAnnot(
+        CNcbiIstream&,
+        ILineErrorListener* =0);
+
+    virtual CRef<CSeq_annot>
+    ReadSeqAnnot(
+        ILineReader&,
+        ILineErrorListener* =0);
+
+    /// Drop the state of the input read by ReadSeqAnnot(), including
+    /// pending Seq-annots and the line pushed back at the end of the last
+    /// region; the next call starts a new input.
+    ///
+    void
+    ResetStream();
+
 protected:
     virtual CGff2Record* x_CreateRecord() { return new CGff3ReadRecord(); };    
 
@@ -148,6 +178,12 @@ protected:
 
     virtual bool xReadInit();
 
+    bool xReadRegion(
+        ILineReader&,
+        ILineErrorListener*);
+
+    virtual void xResetRegion();
+
     string xNextGenericId();
 
     bool xVerifyExonLocation(
@@ -161,6 +197,9 @@ protected:
     // Data:
     map<string, string> mCdsParentMap;
     map<string, CRef<CSeq_interval> > mMrnaLocs;
+    TAnnots mPendingAnnots;
+    bool mStreamStarted;
+    CRef<ILineReader> mpIstrLineReader;
     static unsigned int msGenericIdCounter;
 };
 
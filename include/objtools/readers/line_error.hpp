@@ -552,6 +552,9 @@ protected:
 
     /// Protected, so use Clone or Throw instead.
     CObjReaderLineException(const CObjReaderLineException & rhs );
+
+    /// Keep the exact type when stored as a CException predecessor.
+    virtual const CException* x_Clone(void) const;
 };
 
     
@@ -39,12 +39,17 @@
 #include <objtools/readers/message_listener.hpp>
 #include <objects/seq/Seq_annot.hpp>
 
+#include <deque>
+
 
 BEGIN_NCBI_SCOPE
 
+class CThreadPool;
+
 BEGIN_SCOPE(objects) // namespace ncbi::objects::
 
 class CVcfData;
+class CVcfDataBatch;
 
 //  ----------------------------------------------------------------------------
 enum ESpecType
@@ -147,11 +152,25 @@ public:
     enum {
         fNormal = 0,
         fUseSetFormat = 1<<8,
+        /// Keep the FORMAT keys but do not convert the per-sample
+        /// genotype columns (they are not even split then.)
+        fSkipGenotypeData = 1<<9,
     };
 
     CVcfReader( 
         int =0 );
     virtual ~CVcfReader();
+
+    /// Convert data lines by several threads: the lines are passed in
+    /// batches to a pool of threads, and the features and messages are
+    /// merged back in the input order. Only a few batches are in flight at
+    /// any time, so memory stays bounded. If ReadSeqAnnot() throws because
+    /// of a data line, the lines read ahead of it are kept, so the next
+    /// call continues right after that line, as in the sequential mode.
+    /// @param threads
+    ///   1 (default) converts in the calling thread, 0 means number of CPUs.
+    void SetThreadCount(
+        unsigned int threads);
     
     //
     //  object interface:
@@ -214,7 +233,8 @@ protected:
     xProcessDataLine(
         const string&,
         CRef<CSeq_annot>,
-        ILineErrorListener*);
+        ILineErrorListener*,
+        CVcfDataBatch* =0);
         
     virtual bool
     xAssignVcfMeta(
@@ -303,6 +323,51 @@ protected:
         CVcfData&,
         ILineErrorListener* =0);
 
+    bool
+    xQueueDataLine(
+        const string&,
+        CRef<CSeq_annot>,
+        ILineErrorListener*);
+
+    void
+    xMergeBatch(
+        CRef<CSeq_annot>,
+        ILineErrorListener*);
+
+    void
+    xFlushBatches(
+        CRef<CSeq_annot>,
+        ILineErrorListener*);
+
+    void
+    xCancelBatches();
+
+    void
+    xKeepUnmergedLines(
+        CVcfDataBatch&,
+        size_t);
+
+    void
+    xProcessDataError(
+        CObjReaderLineException&,
+        const CVcfData&,
+        ILineErrorListener*);
+
+    void
+    xProcessDataWarning(
+        CObjReaderLineException&,
+        const CVcfData&,
+        ILineErrorListener*);
+
+    virtual bool
+    xGetLine(
+        ILineReader&,
+        string&);
+
+    virtual bool
+    xUngetLine(
+        ILineReader&);
+
     //
     //  data:
     //
@@ -313,7 +378,25 @@ protected:
     map<string,CVcfFilterSpec> m_FilterSpecs;
     vector<string> m_MetaDirectives;
     vector<string> m_GenotypeHeaders;
+    vector<size_t> m_GenotypeOrder;
     CMessageListenerLenient m_ErrorsPrivate;
+
+private:
+    friend class CVcfDataBatch;
+    typedef deque< CRef<CVcfDataBatch> > TBatches;
+
+    unsigned int m_ThreadCount;
+    AutoPtr<CThreadPool> m_ThreadPool;
+    TBatches m_Batches;
+    CRef<CVcfDataBatch> m_CurrentBatch;
+
+    // Lines read ahead of a data line which threw, with their numbers;
+    // they are read again before the rest of the input
+    typedef pair<string, unsigned int> TPendingLine;
+    deque<TPendingLine> m_PendingLines;
+    TPendingLine m_LastPendingLine;
+    bool m_LastLinePending;
+    unsigned int m_uInputLineNumber;
 };
 
 END_SCOPE(objects)
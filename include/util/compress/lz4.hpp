@@ -0,0 +1,512 @@
+#ifndef UTIL_COMPRESS__LZ4__HPP
+#define UTIL_COMPRESS__LZ4__HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ */
+
+/// @file lz4.hpp
+/// LZ4 Compression API.
+///
+/// LZ4 is a very fast lossless compression algorithm, it trades
+/// compression ratio for speed, so it fits well when CPU cost matters
+/// more than the size of data. All data is stored in the standard LZ4
+/// frame format, so it can be processed by the "lz4" command line utility.
+///
+/// CLZ4Compression         - base methods for compression/decompression
+///                           memory buffers and files.
+/// CLZ4CompressionFile     - allow read/write operations on files.
+/// CLZ4Compressor          - LZ4 based compressor
+///                           (used in CLZ4StreamCompressor).
+/// CLZ4Decompressor        - LZ4 based decompressor
+///                           (used in CLZ4StreamDecompressor).
+/// CLZ4StreamCompressor    - LZ4 based compression stream processor
+///                           (see util/compress/stream.hpp).
+/// CLZ4StreamDecompressor  - LZ4 based decompression stream processor
+///                           (see util/compress/stream.hpp).
+///
+/// For more details see LZ4 documentation:
+///    http://lz4.github.io/lz4/
+
+#include <util/compress/stream.hpp>
+
+#if defined(HAVE_LIBLZ4)
+
+
+/** @addtogroup Compression
+ *
+ * @{
+ */
+
+BEGIN_NCBI_SCOPE
+
+
+//////////////////////////////////////////////////////////////////////////////
+///
+/// CLZ4Compression --
+///
+/// Define a base methods for compression/decompression memory buffers
+/// and files.
+
+class NCBI_XUTIL_EXPORT CLZ4Compression : public CCompression
+{
+public:
+    /// Compression/decompression flags.
+    enum EFlags {
+        ///< Allow transparent reading data from buffer/file/stream
+        ///< regardless is it compressed or not. But be aware,
+        ///< if data source contains broken data and API cannot detect that
+        ///< it is compressed data, that you can get binary instead of
+        ///< decompressed data. By default this flag is OFF.
+        fAllowTransparentRead = (1<<0),
+        ///< Allow to "compress/decompress" empty data.
+        ///< The output compressed data will have header and footer only.
+        fAllowEmptyData       = (1<<1),
+        ///< Add checksum of the uncompressed data to each frame.
+        ///< It is always verified on decompression if present.
+        fChecksum             = (1<<2),
+        ///< Compress blocks independently. It makes compression ratio
+        ///< slightly worse, but needs less memory for decompression.
+        fIndependentBlocks    = (1<<3)
+    };
+    typedef CLZ4Compression::TFlags TLZ4Flags; ///< Bitwise OR of EFlags
+
+    /// Constructor.
+    CLZ4Compression(ELevel level = eLevel_Default);
+
+    /// Destructor.
+    virtual ~CLZ4Compression(void);
+
+    /// Return name and version of the compression library.
+    virtual CVersionInfo GetVersion(void) const;
+
+    /// Get compression level.
+    ///
+    /// NOTE: LZ4 doesn't support zero level compression.
+    ///       So the "eLevel_NoCompression" will be translated to
+    ///       "eLevel_Lowest".
+    virtual ELevel GetLevel(void) const;
+
+    /// Return default compression level for a compression algorithm.
+    /// Levels up to eLevel_Low use the fast LZ4 compressor, higher
+    /// levels use the slower LZ4 HC compressor.
+    virtual ELevel GetDefaultLevel(void) const
+        { return eLevel_Lowest; };
+
+    //
+    // Utility functions
+    //
+
+    /// Compress data in the buffer.
+    ///
+    /// Use EstimateCompressionBufferSize() to determine the size of
+    /// the destination buffer.
+    /// @param src_buf
+    ///   [in] Source buffer.
+    /// @param src_len
+    ///   [in] Size of data in source  buffer.
+    /// @param dst_buf
+    ///   [in] Destination buffer.
+    /// @param dst_size
+    ///   [in] Size of destination buffer.
+    /// @param dst_len
+    ///   [out] Size of compressed data in destination buffer.
+    /// @return
+    ///   Return TRUE if operation was succesfully or FALSE otherwise.
+    ///   On success, 'dst_buf' contains compressed data of dst_len size.
+    /// @sa
+    ///   EstimateCompressionBufferSize, DecompressBuffer
+    virtual bool CompressBuffer(
+        const void* src_buf, size_t  src_len,
+        void*       dst_buf, size_t  dst_size,
+        /* out */            size_t* dst_len
+    );
+
+    /// Decompress data in the buffer.
+    ///
+    /// The source buffer can contain several concatenated LZ4 frames.
+    /// @param src_buf
+    ///   Source buffer.
+    /// @param src_len
+    ///   Size of data in source buffer.
+    /// @param dst_buf
+    ///   Destination buffer.
+    /// @param dst_size
+    ///   Size of destination buffer.
+    /// @param dst_len
+    ///   Size of decompressed data in destination buffer.
+    /// @return
+    ///   Return TRUE if operation was succesfully or FALSE otherwise.
+    ///   On success, 'dst_buf' contains decompressed data of dst_len size.
+    /// @sa
+    ///   CompressBuffer
+    virtual bool DecompressBuffer(
+        const void* src_buf, size_t  src_len,
+        void*       dst_buf, size_t  dst_size,
+        /* out */            size_t* dst_len
+    );
+
+    /// Estimate buffer size for data compression.
+    ///
+    /// Return the maximum size of compressed data for the source buffer
+    /// of 'src_len' size, so CompressBuffer() never fails because of
+    /// the destination buffer overflow.
+    size_t EstimateCompressionBufferSize(size_t src_len);
+
+    /// Compress file.
+    ///
+    /// @param src_file
+    ///   File name of source file.
+    /// @param dst_file
+    ///   File name of result file.
+    /// @param buf_size
+    ///   Buffer size used to read/write files.
+    /// @return
+    ///   Return TRUE on success, FALSE on error.
+    /// @sa
+    ///   DecompressFile
+    virtual bool CompressFile(
+        const string& src_file,
+        const string& dst_file,
+        size_t        buf_size = kCompressionDefaultBufSize
+    );
+
+    /// Decompress file.
+    ///
+    /// @param src_file
+    ///   File name of source file.
+    /// @param dst_file
+    ///   File name of result file.
+    /// @param buf_size
+    ///   Buffer size used to read/write files.
+    /// @return
+    ///   Return TRUE on success, FALSE on error.
+    /// @sa
+    ///   CompressFile
+    virtual bool DecompressFile(
+        const string& src_file,
+        const string& dst_file,
+        size_t        buf_size = kCompressionDefaultBufSize
+    );
+
+protected:
+    /// Get frame preferences for the current level and flags.
+    /// @param prefs
+    ///   Pointer to LZ4F_preferences_t structure.
+    void GetPreferences(void* prefs) const;
+
+    /// Set last error code/description from LZ4 status code.
+    void SetLZ4Error(size_t errcode);
+
+    /// Format string with last error description.
+    string FormatErrorMessage(string where) const;
+
+protected:
+    void*  m_DCtx;   ///< Decompression context (LZ4F_dctx*)
+
+private:
+    /// Private copy constructor to prohibit copy.
+    CLZ4Compression(const CLZ4Compression&);
+    /// Private assignment operator to prohibit assignment.
+    CLZ4Compression& operator= (const CLZ4Compression&);
+};
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+///
+/// CLZ4CompressionFile class --
+///
+/// Throw exceptions on critical errors.
+
+class NCBI_XUTIL_EXPORT CLZ4CompressionFile : public CLZ4Compression,
+                                              public CCompressionFile
+{
+public:
+    /// Constructor.
+    CLZ4CompressionFile(
+        const string& file_name,
+        EMode         mode,
+        ELevel        level = eLevel_Default
+    );
+
+    /// Conventional constructor.
+    CLZ4CompressionFile(
+        ELevel        level = eLevel_Default
+    );
+
+    /// Destructor
+    ~CLZ4CompressionFile(void);
+
+    /// Opens a compressed file for reading or writing.
+    ///
+    /// @param file_name
+    ///   File name of the file to open.
+    /// @param mode
+    ///   File open mode.
+    /// @return
+    ///   TRUE if file was opened succesfully or FALSE otherwise.
+    /// @sa
+    ///   CLZ4Compression, Read, Write, Close
+    virtual bool Open(const string& file_name, EMode mode);
+
+    /// Read data from compressed file.
+    ///
+    /// Read up to "len" uncompressed bytes from the compressed file "file"
+    /// into the buffer "buf".
+    /// @param buf
+    ///    Buffer for requested data.
+    /// @param len
+    ///    Number of bytes to read.
+    /// @return
+    ///   Number of bytes actually read (0 for end of file, -1 for error).
+    ///   The number of really readed bytes can be less than requested.
+    /// @sa
+    ///   Open, Write, Close
+    virtual long Read(void* buf, size_t len);
+
+    /// Write data to compressed file.
+    ///
+    /// Writes the given number of uncompressed bytes from the buffer
+    /// into the compressed file.
+    /// @param buf
+    ///    Buffer with written data.
+    /// @param len
+    ///    Number of bytes to write.
+    /// @return
+    ///   Number of bytes actually written or -1 for error.
+    /// @sa
+    ///   Open, Read, Close
+    virtual long Write(const void* buf, size_t len);
+
+    /// Close compressed file.
+    ///
+    /// Flushes all pending output if necessary, closes the compressed file.
+    /// @return
+    ///   TRUE on success, FALSE on error.
+    /// @sa
+    ///   Open, Read, Write
+    virtual bool Close(void);
+
+protected:
+    /// Get error code/description of last stream operation (m_Stream).
+    /// It can be received using GetErrorCode()/GetErrorDescription() methods.
+    void GetStreamError(void);
+
+protected:
+    EMode                  m_Mode;     ///< I/O mode (read/write).
+    CNcbiFstream*          m_File;     ///< File stream.
+    CCompressionIOStream*  m_Stream;   ///< [De]comression stream.
+
+private:
+    /// Private copy constructor to prohibit copy.
+    CLZ4CompressionFile(const CLZ4CompressionFile&);
+    /// Private assignment operator to prohibit assignment.
+    CLZ4CompressionFile& operator= (const CLZ4CompressionFile&);
+};
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CLZ4Compressor -- LZ4 based compressor
+///
+/// Used in CLZ4StreamCompressor.
+/// LZ4 frame API needs an output buffer for the worst case of each
+/// compressed block, so the data is compressed into the internal buffer
+/// and copied to the output from there.
+/// @sa CLZ4StreamCompressor, CLZ4Compression, CCompressionProcessor
+
+class NCBI_XUTIL_EXPORT CLZ4Compressor : public CLZ4Compression,
+                                         public CCompressionProcessor
+{
+public:
+    /// Constructor.
+    CLZ4Compressor(
+        ELevel    level = eLevel_Default,
+        TLZ4Flags flags = 0
+    );
+
+    /// Destructor.
+    virtual ~CLZ4Compressor(void);
+
+protected:
+    virtual EStatus Init   (void);
+    virtual EStatus Process(const char* in_buf,  size_t  in_len,
+                            char*       out_buf, size_t  out_size,
+                            /* out */            size_t* in_avail,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Flush  (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Finish (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus End    (int abandon = 0);
+
+protected:
+    /// Copy compressed data from the internal buffer to 'out_buf',
+    /// after '*out_avail' bytes already placed there.
+    /// Return TRUE if the internal buffer is empty after that.
+    bool FlushBuffer(char* out_buf, size_t out_size, size_t* out_avail);
+
+private:
+    void*           m_CCtx;      ///< Compression context (LZ4F_cctx*)
+    AutoArray<char> m_Buf;       ///< Buffer for compressed data
+    size_t          m_BufSize;   ///< Size of the buffer
+    size_t          m_BufPos;    ///< Start of data in the buffer
+    size_t          m_BufLen;    ///< End of data in the buffer
+    bool            m_Started;   ///< Frame header is written
+    bool            m_Finished;  ///< Frame footer is written
+};
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CLZ4Decompressor -- LZ4 based decompressor
+///
+/// Used in CLZ4StreamDecompressor.
+/// Concatenated LZ4 frames are decompressed as one data stream.
+/// @sa CLZ4StreamDecompressor, CLZ4Compression, CCompressionProcessor
+
+class NCBI_XUTIL_EXPORT CLZ4Decompressor : public CLZ4Compression,
+                                           public CCompressionProcessor
+{
+public:
+    /// Constructor.
+    CLZ4Decompressor(TLZ4Flags flags = 0);
+
+    /// Destructor.
+    virtual ~CLZ4Decompressor(void);
+
+protected:
+    virtual EStatus Init   (void);
+    virtual EStatus Process(const char* in_buf,  size_t  in_len,
+                            char*       out_buf, size_t  out_size,
+                            /* out */            size_t* in_avail,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Flush  (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Finish (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus End    (int abandon = 0);
+
+protected:
+    /// Decompress data, used for the cached and the input data.
+    EStatus DecompressData(const char* in_buf,  size_t  in_len,
+                           char*       out_buf, size_t  out_size,
+                           /* out */            size_t* in_avail,
+                           /* out */            size_t* out_avail);
+
+private:
+    string  m_Cache;     ///< Beginning of data to check magic number
+    bool    m_FrameEnd;  ///< TRUE if the last frame is complete
+};
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+///
+/// CLZ4StreamCompressor -- LZ4 based compression stream processor
+///
+/// See util/compress/stream.hpp for details of stream processing.
+/// @sa CCompressionStreamProcessor
+
+class NCBI_XUTIL_EXPORT CLZ4StreamCompressor
+    : public CCompressionStreamProcessor
+{
+public:
+    /// Full constructor
+    CLZ4StreamCompressor(
+        CLZ4Compression::ELevel    level,
+        streamsize                 in_bufsize,
+        streamsize                 out_bufsize,
+        CLZ4Compression::TLZ4Flags flags = 0
+        )
+        : CCompressionStreamProcessor(
+              new CLZ4Compressor(level, flags),
+              eDelete, in_bufsize, out_bufsize)
+    {}
+
+    /// Conventional constructor
+    CLZ4StreamCompressor(
+        CLZ4Compression::ELevel    level,
+        CLZ4Compression::TLZ4Flags flags = 0
+        )
+        : CCompressionStreamProcessor(
+              new CLZ4Compressor(level, flags),
+              eDelete, kCompressionDefaultBufSize, kCompressionDefaultBufSize)
+    {}
+
+    /// Conventional constructor
+    CLZ4StreamCompressor(CLZ4Compression::TLZ4Flags flags = 0)
+        : CCompressionStreamProcessor(
+              new CLZ4Compressor(CLZ4Compression::eLevel_Default, flags),
+              eDelete, kCompressionDefaultBufSize, kCompressionDefaultBufSize)
+    {}
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CLZ4StreamDecompressor  -- LZ4 based decompression stream processor
+///
+/// See util/compress/stream.hpp for details of stream processing.
+/// @sa CCompressionStreamProcessor
+
+class NCBI_XUTIL_EXPORT CLZ4StreamDecompressor
+    : public CCompressionStreamProcessor
+{
+public:
+    /// Full constructor
+    CLZ4StreamDecompressor(
+        streamsize                 in_bufsize,
+        streamsize                 out_bufsize,
+        CLZ4Compression::TLZ4Flags flags = 0
+        )
+        : CCompressionStreamProcessor(
+             new CLZ4Decompressor(flags),
+             eDelete, in_bufsize, out_bufsize)
+    {}
+
+    /// Conventional constructor
+    CLZ4StreamDecompressor(CLZ4Compression::TLZ4Flags flags = 0)
+        : CCompressionStreamProcessor(
+              new CLZ4Decompressor(flags),
+              eDelete, kCompressionDefaultBufSize, kCompressionDefaultBufSize)
+    {}
+};
+
+
+END_NCBI_SCOPE
+
+
+/* @} */
+
+#endif  /* HAVE_LIBLZ4 */
+
+#endif  /* UTIL_COMPRESS__LZ4__HPP */
@@ -44,12 +44,16 @@
 ///     MCompress_Zip,      MDecompress_Zip
 ///     MCompress_GZipFile, MDecompress_GZipFile,
 ///                         MDecompress_ConcatenatedGZipFile
+///     MCompress_Zstd,     MDecompress_Zstd
+///     MCompress_LZ4,      MDecompress_LZ4
 
 
 #include <util/compress/stream.hpp>
 #include <util/compress/bzip2.hpp>
 #include <util/compress/zlib.hpp>
 #include <util/compress/lzo.hpp>
+#include <util/compress/zstd.hpp>
+#include <util/compress/lz4.hpp>
 
 
 /** @addtogroup CompressionStreams
@@ -88,7 +92,9 @@ public:
         eLZO,                 ///< LZO (LZO1X)
         eZip,                 ///< ZLIB (raw zip data / DEFLATE method)
         eGZipFile,            ///< .gz file (including concatenated files)
-        eConcatenatedGZipFile ///< Synonym for eGZipFile (for backward compatibility)
+        eConcatenatedGZipFile,///< Synonym for eGZipFile (for backward compatibility)
+        eZstd,                ///< Zstandard (zstd frame format)
+        eLZ4                  ///< LZ4 (LZ4 frame format)
     };
 
     /// Default algorithm-specific compression/decompression flags.
@@ -444,6 +450,10 @@ class MDecompress_Proxy_LZO      {};
 class MDecompress_Proxy_Zip      {};
 class MDecompress_Proxy_GZipFile {};
 class MDecompress_Proxy_ConcatenatedGZipFile {};
+class MCompress_Proxy_Zstd       {};
+class MCompress_Proxy_LZ4        {};
+class MDecompress_Proxy_Zstd     {};
+class MDecompress_Proxy_LZ4      {};
 
 
 /// Manipulator definitions.
@@ -457,6 +467,10 @@ class MDecompress_Proxy_ConcatenatedGZipFile {};
 #define  MDecompress_Zip                   MDecompress_Proxy_Zip()
 #define  MDecompress_GZipFile              MDecompress_Proxy_GZipFile()
 #define  MDecompress_ConcatenatedGZipFile  MDecompress_Proxy_ConcatenatedGZipFile()
+#define  MCompress_Zstd                    MCompress_Proxy_Zstd()
+#define  MCompress_LZ4                     MCompress_Proxy_LZ4()
+#define  MDecompress_Zstd                  MDecompress_Proxy_Zstd()
+#define  MDecompress_LZ4                   MDecompress_Proxy_LZ4()
 
 
 // When you pass an object of type M[Dec|C]ompress_Proxy_* to an
@@ -573,6 +587,54 @@ TDecompressIProxy operator>>(istream& is, MDecompress_Proxy_ConcatenatedGZipFile
     return TDecompressIProxy(is, CCompressStream::eConcatenatedGZipFile);
 }
 
+inline
+TCompressOProxy operator<<(ostream& os, MCompress_Proxy_Zstd const& /*obj*/)
+{
+    return TCompressOProxy(os, CCompressStream::eZstd);
+}
+
+inline
+TCompressIProxy operator>>(istream& is, MCompress_Proxy_Zstd const& /*obj*/)
+{
+    return TCompressIProxy(is, CCompressStream::eZstd);
+}
+
+inline
+TCompressOProxy operator<<(ostream& os, MCompress_Proxy_LZ4 const& /*obj*/)
+{
+    return TCompressOProxy(os, CCompressStream::eLZ4);
+}
+
+inline
+TCompressIProxy operator>>(istream& is, MCompress_Proxy_LZ4 const& /*obj*/)
+{
+    return TCompressIProxy(is, CCompressStream::eLZ4);
+}
+
+inline
+TDecompressOProxy operator<<(ostream& os, MDecompress_Proxy_Zstd const& /*obj*/)
+{
+    return TDecompressOProxy(os, CCompressStream::eZstd);
+}
+
+inline
+TDecompressIProxy operator>>(istream& is, MDecompress_Proxy_Zstd const& /*obj*/)
+{
+    return TDecompressIProxy(is, CCompressStream::eZstd);
+}
+
+inline
+TDecompressOProxy operator<<(ostream& os, MDecompress_Proxy_LZ4 const& /*obj*/)
+{
+    return TDecompressOProxy(os, CCompressStream::eLZ4);
+}
+
+inline
+TDecompressIProxy operator>>(istream& is, MDecompress_Proxy_LZ4 const& /*obj*/)
+{
+    return TDecompressIProxy(is, CCompressStream::eLZ4);
+}
+
 
 /* @} */
 
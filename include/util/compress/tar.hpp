@@ -250,6 +250,9 @@ NCBI_XUTIL_EXPORT ostream& operator << (ostream&, const CTarEntryInfo&);
 /// Forward declaration of a tar header used internally.
 struct STarHeader;
 
+/// Forward declaration of the parallel processing state used internally.
+class CTarParallel;
+
 
 //////////////////////////////////////////////////////////////////////////////
 ///
@@ -396,7 +399,7 @@ public:
     /// @return
     ///   A list of entries appended.
     /// @sa
-    ///   Create, Update, SetBaseDir
+    ///   Create, Update, SetBaseDir, SetThreadCount
     auto_ptr<TEntries> Append(const string& name);
 
     /// Append an entry from a stream (exactly entry.GetSize() bytes).
@@ -437,7 +440,7 @@ public:
     /// @return
     ///   A list of entries that have been actually extracted.
     /// @sa
-    ///   SetMask, SetBaseDir
+    ///   SetMask, SetBaseDir, SetThreadCount
     auto_ptr<TEntries> Extract(void);
 
     /// Get information about all matching archive entries.
@@ -472,6 +475,25 @@ public:
     /// Get current stream position.
     Uint8  GetCurrentPosition(void) const;
 
+    /// Get number of threads used to extract and append files.
+    unsigned int GetThreadCount(void) const;
+
+    /// Set number of threads used to extract and append files
+    /// (1 by default, that is, no parallel processing;  0 means the number
+    /// of CPUs).
+    ///
+    /// With more than one thread, Extract() from a file archive keeps reading
+    /// the headers while the data of files larger than a record are copied
+    /// into their (preallocated) destination files in the background, using
+    /// large page-aligned writes.  Append() reads the files of directories
+    /// ahead in the background, so their data are ready by the time they
+    /// have to be written into the archive.  Stream archives (and archives
+    /// with fStreamPipeThrough set) are always extracted sequentially.
+    /// @note The archive contents do not depend on the number of threads.
+    /// @sa
+    ///   Extract, Append
+    void SetThreadCount(unsigned int threads);
+
     /// Set name mask.
     ///
     /// The set of masks is used to process existing entries in the archive,
@@ -691,6 +713,20 @@ private:
     // Append a regular file to the archive.
     void x_AppendFile(const string& file);
 
+    // Start parallel processing (if enabled by SetThreadCount()).
+    void x_BeginParallel(void);
+
+    // Stop parallel processing, waiting for all background operations.
+    void x_EndParallel(void);
+
+    // Pass the data of current file entry (the actual size passed in) to be
+    // extracted in the background into the already created "dst" file.
+    void x_ExtractParallel(Uint8 size, const CDirEntry* dst);
+
+    // Restore attributes of files extracted in the background and throw if
+    // any of the extractions failed;  if "wait", then wait for all of them.
+    void x_FlushParallel(bool wait);
+
 private:
     string        m_FileName;       ///< Tar archive file name (only if file)
     CNcbiFstream* m_FileStream;     ///< File stream of the archive (if file)
@@ -708,6 +744,8 @@ private:
     TFlags        m_Flags;          ///< Bitwise OR of flags
     string        m_BaseDir;        ///< Base directory for relative paths
     CTarEntryInfo m_Current;        ///< Current entry being processed
+    unsigned int  m_ThreadCount;    ///< Threads for parallel processing
+    CTarParallel* m_Parallel;       ///< Parallel processing state (if any)
 
 private:
     // Prohibit assignment and copy
@@ -735,13 +773,6 @@ void CTar::Close(void)
     x_Close(x_Flush());
 }
 
-inline
-auto_ptr<CTar::TEntries> CTar::Append(const string& name)
-{
-    x_Open(eAppend);
-    return x_Append(name);
-}
-
 inline
 auto_ptr<CTar::TEntries> CTar::Append(const CTarUserEntryInfo& entry,
                                       CNcbiIstream& is)
@@ -788,6 +819,18 @@ inline Uint8 CTar::GetCurrentPosition(void) const
     return m_StreamPos;
 }
 
+inline
+unsigned int CTar::GetThreadCount(void) const
+{
+    return m_ThreadCount;
+}
+
+inline
+void CTar::SetThreadCount(unsigned int threads)
+{
+    m_ThreadCount = threads;
+}
+
 inline
 const string& CTar::GetBaseDir(void) const
 {
@@ -45,6 +45,11 @@
 ///                          (see util/compress/stream.hpp for details).
 /// CZipStreamDecompressor - zlib based decompression stream processor
 ///                          (see util/compress/stream.hpp for details).
+/// CZipParallelCompressor - zlib based multithreaded compressor, writes
+///                          gzip or BGZF format
+///                          (used in CZipParallelStreamCompressor).
+/// CZipParallelStreamCompressor - multithreaded compression stream processor
+///                          (see util/compress/stream.hpp for details).
 ///
 /// The zlib documentation can be found here: 
 ///     http://zlib.org,   or
@@ -52,6 +57,7 @@
  
 
 #include <util/compress/stream.hpp>
+#include <deque>
 
 /** @addtogroup Compression
  *
@@ -60,6 +66,10 @@
 
 BEGIN_NCBI_SCOPE
 
+// Forward declarations
+class CThreadPool;
+class CZipParallelBlock;
+
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -652,6 +662,154 @@ public:
 };
 
 
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZipParallelCompressor -- zlib based multithreaded compressor
+///
+/// Splits input data into blocks and compresses them by a pool of threads,
+/// the compressed blocks are written in the input order.
+/// Two output formats are supported:
+///   - eFormat_GZip: a single standard gzip member (like "pigz" utility).
+///     Each block is compressed with the last 32KB of the previous block
+///     as a dictionary, so the compression ratio is close to the ratio
+///     of the single-threaded CZipCompressor with fWriteGZipFormat flag.
+///   - eFormat_BGZF: blocked gzip format used by SAMtools/HTSlib.
+///     Each block of up to 64KB of input is a separate gzip member
+///     with the size of the member stored in the "BC" extra field,
+///     and the output ends with an empty EOF member. Such files can be
+///     decompressed by any gzip decompressor (see fAllowConcatenatedGZip),
+///     but also in parallel or starting from any block.
+/// Flush() ends the current block early, so frequent flushing degrades
+/// compression ratio and parallelism.
+/// @note
+///   Compression flags other than fAllowEmptyData are ignored,
+///   the output always has gzip format.
+/// @sa CZipParallelStreamCompressor, CZipCompressor, CCompressionProcessor
+
+class NCBI_XUTIL_EXPORT CZipParallelCompressor : public CZipCompression,
+                                                 public CCompressionProcessor
+{
+public:
+    /// Output format.
+    enum EFormat {
+        eFormat_GZip,   ///< Single gzip member
+        eFormat_BGZF    ///< Blocked gzip format (BGZF)
+    };
+
+    /// Constructor.
+    /// @param threads
+    ///   Number of compressing threads, 0 means number of CPUs.
+    ///   One thread means compression in the calling thread.
+    /// @param block_size
+    ///   Size of input data block compressed by one thread, 0 means default
+    ///   (128KB). For eFormat_BGZF it is limited by the maximum size of
+    ///   BGZF block.
+    CZipParallelCompressor(
+        ELevel       level       = eLevel_Default,
+        EFormat      format      = eFormat_GZip,
+        unsigned int threads     = 0,
+        size_t       block_size  = 0,
+        int          mem_level   = kZlibDefaultMemLevel,
+        int          strategy    = kZlibDefaultStrategy,
+        TZipFlags    flags       = 0
+    );
+    /// Destructor.
+    virtual ~CZipParallelCompressor(void);
+
+    /// Set information about compressed file.
+    /// Used in the gzip header for eFormat_GZip only.
+    void SetFileInfo(const SFileInfo& info);
+
+    EFormat      GetFormat(void) const      { return m_Format;      }
+    unsigned int GetThreadCount(void) const { return m_ThreadCount; }
+    size_t       GetBlockSize(void) const   { return m_BlockSize;   }
+
+protected:
+    virtual EStatus Init   (void);
+    virtual EStatus Process(const char* in_buf,  size_t  in_len,
+                            char*       out_buf, size_t  out_size,
+                            /* out */            size_t* in_avail,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Flush  (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Finish (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus End    (int abandon = 0);
+
+private:
+    typedef deque< CRef<CZipParallelBlock> > TBlocks;
+
+    /// Pass the current block to the compressing threads.
+    bool x_SubmitBlock(bool last);
+    /// Move compressed blocks from the queue into the output cache,
+    /// wait for them if 'wait' is TRUE, otherwise take ready blocks only.
+    bool x_CollectBlocks(bool wait);
+    /// Copy output cache into the output buffer.
+    void x_WriteOutput(char* out_buf, size_t out_size, size_t* out_avail);
+    /// Wait for all blocks and forget them.
+    void x_CancelBlocks(void);
+
+    EFormat                 m_Format;
+    unsigned int            m_ThreadCount;
+    size_t                  m_BlockSize;
+    size_t                  m_MaxBlocks;   ///< Max number of queued blocks
+    AutoPtr<CThreadPool>    m_ThreadPool;
+    TBlocks                 m_Blocks;      ///< Blocks being compressed
+    CRef<CZipParallelBlock> m_Block;       ///< Block being filled
+    string                  m_Window;      ///< Dictionary for the next block
+    string                  m_Output;      ///< Compressed data cache
+    size_t                  m_OutputPos;   ///< Written part of m_Output
+    unsigned long           m_CRC32;       ///< CRC32 for compressed data
+    bool                    m_NeedWriteHeader;
+    bool                    m_Finished;    ///< Last block is submitted
+    SFileInfo               m_FileInfo;    ///< Compressed file info
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZipParallelStreamCompressor --
+///   zlib based multithreaded compression stream processor
+///
+/// See util/compress/stream.hpp for details of stream processing.
+/// @sa CCompressionStreamProcessor, CZipParallelCompressor
+
+class NCBI_XUTIL_EXPORT CZipParallelStreamCompressor
+    : public CCompressionStreamProcessor
+{
+public:
+    /// Full constructor
+    CZipParallelStreamCompressor(
+        CZipCompression::ELevel          level,
+        CZipParallelCompressor::EFormat  format,
+        unsigned int                     threads,
+        size_t                           block_size,
+        streamsize                       in_bufsize,
+        streamsize                       out_bufsize,
+        CZipCompression::TZipFlags       flags = 0
+        )
+        : CCompressionStreamProcessor(
+              new CZipParallelCompressor(level, format, threads, block_size,
+                                         kZlibDefaultMemLevel,
+                                         kZlibDefaultStrategy, flags),
+              eDelete, in_bufsize, out_bufsize)
+    {}
+
+    /// Conventional constructor
+    CZipParallelStreamCompressor(
+        CZipParallelCompressor::EFormat format =
+            CZipParallelCompressor::eFormat_GZip,
+        unsigned int                    threads = 0,
+        CZipCompression::ELevel         level =
+            CZipCompression::eLevel_Default
+        )
+        : CCompressionStreamProcessor(
+              new CZipParallelCompressor(level, format, threads),
+              eDelete, kCompressionDefaultBufSize, kCompressionDefaultBufSize)
+    {}
+};
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Global functions
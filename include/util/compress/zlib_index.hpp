@@ -0,0 +1,251 @@
+#ifndef UTIL_COMPRESS__ZLIB_INDEX__HPP
+#define UTIL_COMPRESS__ZLIB_INDEX__HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ */
+
+/// @file zlib_index.hpp
+/// Random access to gzip (.gz) and BGZF files.
+///
+/// CZipIndex             - index of access points in gzip data.
+/// CZipIndexedReader     - IReader, which decompresses gzip data starting
+///                         from any position of the uncompressed data.
+/// CZipIndexedIStream    - seekable input stream on top of CZipIndexedReader.
+///
+/// Access points are the starts of gzip members (cheap, nothing to store)
+/// and the boundaries of deflate blocks inside members, which need the last
+/// 32KB of uncompressed data as a dictionary.  For BGZF files, which consist
+/// of small gzip members, all member starts are stored, so BGZF "virtual
+/// offsets" can be used for seeking too.
+
+#include <util/compress/compress.hpp>
+#include <corelib/reader_writer.hpp>
+
+
+/** @addtogroup Compression
+ *
+ * @{
+ */
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZipIndex --
+///
+/// Index of access points in gzip data (single or concatenated gzip files,
+/// including BGZF).  Can be built by scanning the data once, and saved
+/// to be loaded later.
+/// Throw CCompressionException on errors.
+
+class NCBI_XUTIL_EXPORT CZipIndex : public CObject
+{
+public:
+    typedef Uint8 TPosition;
+
+    /// Default distance between access points in the uncompressed data.
+    static const TPosition kDefaultSpan = 1024*1024;
+
+    /// Access point.
+    struct SPoint {
+        TPosition raw_pos;  ///< Position in the compressed data
+        TPosition data_pos; ///< Position in the uncompressed data
+        int       bits;     ///< Number of bits of the byte before raw_pos,
+                            ///< which belong to the next deflate block
+        bool      member;   ///< Start of gzip member (no window needed)
+        string    window;   ///< Uncompressed data before the point
+    };
+    typedef vector<SPoint> TPoints;
+
+    /// Build the index by decompressing the whole stream.
+    /// @param is
+    ///   Stream with gzip data, opened in binary mode.
+    /// @param span
+    ///   Approximate distance between access points, the memory needed
+    ///   for the index is about 32KB per access point.
+    static CRef<CZipIndex> Build(CNcbiIstream& is,
+                                 TPosition span = kDefaultSpan);
+
+    /// Load index, previously written by Save().
+    static CRef<CZipIndex> Load(CNcbiIstream& is);
+
+    /// Write index into a stream opened in binary mode.
+    /// Windows of the access points are stored compressed.
+    void Save(CNcbiOstream& os) const;
+
+    /// Return TRUE if the data has BGZF format.
+    bool IsBGZF(void) const { return m_IsBGZF; }
+
+    /// Size of the uncompressed data.
+    TPosition GetDataSize(void) const { return m_DataSize; }
+
+    /// All access points sorted by position.
+    const TPoints& GetPoints(void) const { return m_Points; }
+
+    /// Find the last access point at or before position 'data_pos'
+    /// in the uncompressed data.
+    const SPoint& FindPoint(TPosition data_pos) const;
+
+    /// Find the start of gzip member at position 'raw_pos' in the
+    /// compressed data, return NULL if it is not in the index.
+    const SPoint* FindMember(TPosition raw_pos) const;
+
+private:
+    CZipIndex(void) : m_IsBGZF(false), m_DataSize(0) {}
+
+    bool      m_IsBGZF;
+    TPosition m_DataSize;
+    TPoints   m_Points;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZipIndexedReader --
+///
+/// Reader of gzip data with random access.  The underlying stream
+/// must be seekable (usually a file stream opened in binary mode).
+/// Read() doesn't cross the end of gzip member.
+///
+/// Without an index the data can be read sequentially, and BGZF data
+/// can be positioned by virtual offsets.
+/// Seek() throws CCompressionException on errors, Read() returns
+/// eRW_Error on corrupted data.
+
+class NCBI_XUTIL_EXPORT CZipIndexedReader : public IReader
+{
+public:
+    typedef CZipIndex::TPosition TPosition;
+
+    /// Position in the uncompressed data is unknown
+    /// (after SeekVirtualOffset() without index).
+    static const TPosition kUnknownPos = (TPosition)(-1);
+
+    CZipIndexedReader(CNcbiIstream& is, const CZipIndex* index = 0);
+    virtual ~CZipIndexedReader(void);
+
+    virtual ERW_Result Read(void* buf, size_t count, size_t* bytes_read = 0);
+    virtual ERW_Result PendingCount(size_t* count);
+
+    /// Index used for seeking, can be NULL.
+    const CZipIndex* GetIndex(void) const { return m_Index.GetPointerOrNull(); }
+
+    /// Position to read in the uncompressed data.
+    TPosition GetPosition(void) const { return m_DataPos; }
+
+    /// Set position in the uncompressed data.  Without the index it is
+    /// possible to rewind or to skip forward only.
+    void Seek(TPosition data_pos);
+
+    /// Return TRUE if the data has BGZF format.
+    bool IsBGZF(void) const { return m_IsBGZF; }
+
+    /// BGZF virtual offset of the current position: offset of the block
+    /// in the compressed data shifted left by 16 bits, and offset in
+    /// the uncompressed data of the block.
+    Uint8 GetVirtualOffset(void) const;
+
+    /// Set position by BGZF virtual offset, the index is not required.
+    void SeekVirtualOffset(Uint8 offset);
+
+private:
+    /// Start decompression from raw position, 'bits' and 'window' as in
+    /// CZipIndex::SPoint; skip 'skip' bytes of uncompressed data.
+    void x_Start(TPosition raw_pos, int bits, const string* window,
+                 TPosition skip);
+    /// Skip 'count' bytes of uncompressed data.
+    void x_Skip(TPosition count);
+    /// Read more compressed data, return FALSE on EOF.
+    bool x_FillInput(void);
+    /// Start decompression of the next gzip member, if any.
+    ERW_Result x_NextMember(void);
+    /// Decompress into the buffer.
+    ERW_Result x_Inflate(void* buf, size_t count, size_t* bytes_read);
+    /// Free decompression state.
+    void x_End(void);
+
+    CNcbiIstream&            m_Stream;
+    CConstRef<CZipIndex>     m_Index;
+    bool                     m_IsBGZF;
+    void*                    m_ZStream;      ///< zlib stream (z_stream*)
+    bool                     m_Initialized;  ///< m_ZStream is initialized
+    bool                     m_Raw;          ///< Inflating inside a member
+    bool                     m_MemberEnd;    ///< End of member is reached
+    bool                     m_EOF;
+    AutoArray<unsigned char> m_InBuf;
+    TPosition                m_InBufPos;     ///< Raw position of m_InBuf
+    size_t                   m_InBufLen;     ///< Size of data in m_InBuf
+    TPosition                m_DataPos;
+    TPosition                m_MemberRawPos; ///< Start of current member
+    TPosition                m_MemberOffset; ///< Data read from the member
+
+private:
+    CZipIndexedReader(const CZipIndexedReader&);
+    CZipIndexedReader& operator= (const CZipIndexedReader&);
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZipIndexedIStream --
+///
+/// Input stream of uncompressed data with seekg()/tellg() support.
+/// Positions are offsets in the uncompressed data.  Random seeking needs
+/// the index, without it the stream can be rewound or skipped forward only.
+/// @sa CZipIndexedReader
+
+class CZipIndexedStreambuf;
+
+class NCBI_XUTIL_EXPORT CZipIndexedIStream : public CNcbiIstream
+{
+public:
+    CZipIndexedIStream(CNcbiIstream& is, const CZipIndex* index = 0);
+    virtual ~CZipIndexedIStream(void);
+
+    /// BGZF virtual offset of the current position.
+    /// @sa CZipIndexedReader::GetVirtualOffset
+    Uint8 GetVirtualOffset(void);
+
+    /// Set position by BGZF virtual offset, and clear the stream state.
+    /// @sa CZipIndexedReader::SeekVirtualOffset
+    void SeekVirtualOffset(Uint8 offset);
+
+private:
+    CZipIndexedReader            m_Reader;
+    AutoPtr<CZipIndexedStreambuf> m_Sb;
+};
+
+
+END_NCBI_SCOPE
+
+
+/* @} */
+
+#endif  /* UTIL_COMPRESS__ZLIB_INDEX__HPP */
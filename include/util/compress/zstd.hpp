@@ -0,0 +1,493 @@
+#ifndef UTIL_COMPRESS__ZSTD__HPP
+#define UTIL_COMPRESS__ZSTD__HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ */
+
+/// @file zstd.hpp
+/// Zstandard Compression API.
+///
+/// Zstandard is a fast lossless compression algorithm, targeting
+/// zlib-level and better compression ratios with much faster
+/// decompression. All data is stored in the standard zstd frame format,
+/// so it can be processed by the "zstd" command line utility.
+///
+/// CZstdCompression        - base methods for compression/decompression
+///                           memory buffers and files.
+/// CZstdCompressionFile    - allow read/write operations on files.
+/// CZstdCompressor         - zstd based compressor
+///                           (used in CZstdStreamCompressor).
+/// CZstdDecompressor       - zstd based decompressor
+///                           (used in CZstdStreamDecompressor).
+/// CZstdStreamCompressor   - zstd based compression stream processor
+///                           (see util/compress/stream.hpp).
+/// CZstdStreamDecompressor - zstd based decompression stream processor
+///                           (see util/compress/stream.hpp).
+///
+/// For more details see zstd documentation:
+///    http://facebook.github.io/zstd/
+
+#include <util/compress/stream.hpp>
+
+#if defined(HAVE_LIBZSTD)
+
+
+/** @addtogroup Compression
+ *
+ * @{
+ */
+
+BEGIN_NCBI_SCOPE
+
+
+//////////////////////////////////////////////////////////////////////////////
+///
+/// CZstdCompression --
+///
+/// Define a base methods for compression/decompression memory buffers
+/// and files.
+
+class NCBI_XUTIL_EXPORT CZstdCompression : public CCompression
+{
+public:
+    /// Compression/decompression flags.
+    enum EFlags {
+        ///< Allow transparent reading data from buffer/file/stream
+        ///< regardless is it compressed or not. But be aware,
+        ///< if data source contains broken data and API cannot detect that
+        ///< it is compressed data, that you can get binary instead of
+        ///< decompressed data. By default this flag is OFF.
+        fAllowTransparentRead = (1<<0),
+        ///< Allow to "compress/decompress" empty data.
+        ///< The output compressed data will have header and footer only.
+        fAllowEmptyData       = (1<<1),
+        ///< Add checksum of the uncompressed data to each frame.
+        ///< It is always verified on decompression if present.
+        fChecksum             = (1<<2)
+    };
+    typedef CZstdCompression::TFlags TZstdFlags; ///< Bitwise OR of EFlags
+
+    /// Constructor.
+    CZstdCompression(ELevel level = eLevel_Default);
+
+    /// Destructor.
+    virtual ~CZstdCompression(void);
+
+    /// Return name and version of the compression library.
+    virtual CVersionInfo GetVersion(void) const;
+
+    /// Get compression level.
+    ///
+    /// NOTE: zstd doesn't support zero level compression.
+    ///       So the "eLevel_NoCompression" will be translated to
+    ///       "eLevel_Lowest".
+    virtual ELevel GetLevel(void) const;
+
+    /// Return default compression level for a compression algorithm.
+    /// It corresponds to zstd level 3, the zstd library default.
+    virtual ELevel GetDefaultLevel(void) const
+        { return eLevel_Low; };
+
+    //
+    // Utility functions
+    //
+
+    /// Compress data in the buffer.
+    ///
+    /// Use EstimateCompressionBufferSize() to determine the size of
+    /// the destination buffer.
+    /// @param src_buf
+    ///   [in] Source buffer.
+    /// @param src_len
+    ///   [in] Size of data in source  buffer.
+    /// @param dst_buf
+    ///   [in] Destination buffer.
+    /// @param dst_size
+    ///   [in] Size of destination buffer.
+    /// @param dst_len
+    ///   [out] Size of compressed data in destination buffer.
+    /// @return
+    ///   Return TRUE if operation was succesfully or FALSE otherwise.
+    ///   On success, 'dst_buf' contains compressed data of dst_len size.
+    /// @sa
+    ///   EstimateCompressionBufferSize, DecompressBuffer
+    virtual bool CompressBuffer(
+        const void* src_buf, size_t  src_len,
+        void*       dst_buf, size_t  dst_size,
+        /* out */            size_t* dst_len
+    );
+
+    /// Decompress data in the buffer.
+    ///
+    /// The source buffer can contain several concatenated zstd frames.
+    /// @param src_buf
+    ///   Source buffer.
+    /// @param src_len
+    ///   Size of data in source buffer.
+    /// @param dst_buf
+    ///   Destination buffer.
+    /// @param dst_size
+    ///   Size of destination buffer.
+    /// @param dst_len
+    ///   Size of decompressed data in destination buffer.
+    /// @return
+    ///   Return TRUE if operation was succesfully or FALSE otherwise.
+    ///   On success, 'dst_buf' contains decompressed data of dst_len size.
+    /// @sa
+    ///   CompressBuffer
+    virtual bool DecompressBuffer(
+        const void* src_buf, size_t  src_len,
+        void*       dst_buf, size_t  dst_size,
+        /* out */            size_t* dst_len
+    );
+
+    /// Estimate buffer size for data compression.
+    ///
+    /// Return the maximum size of compressed data for the source buffer
+    /// of 'src_len' size, so CompressBuffer() never fails because of
+    /// the destination buffer overflow.
+    size_t EstimateCompressionBufferSize(size_t src_len);
+
+    /// Compress file.
+    ///
+    /// @param src_file
+    ///   File name of source file.
+    /// @param dst_file
+    ///   File name of result file.
+    /// @param buf_size
+    ///   Buffer size used to read/write files.
+    /// @return
+    ///   Return TRUE on success, FALSE on error.
+    /// @sa
+    ///   DecompressFile
+    virtual bool CompressFile(
+        const string& src_file,
+        const string& dst_file,
+        size_t        buf_size = kCompressionDefaultBufSize
+    );
+
+    /// Decompress file.
+    ///
+    /// @param src_file
+    ///   File name of source file.
+    /// @param dst_file
+    ///   File name of result file.
+    /// @param buf_size
+    ///   Buffer size used to read/write files.
+    /// @return
+    ///   Return TRUE on success, FALSE on error.
+    /// @sa
+    ///   CompressFile
+    virtual bool DecompressFile(
+        const string& src_file,
+        const string& dst_file,
+        size_t        buf_size = kCompressionDefaultBufSize
+    );
+
+protected:
+    /// Get zstd compression level for the current level.
+    int GetZstdLevel(void) const;
+
+    /// Set compression parameters (level, checksum) for the new frame.
+    /// Return zstd status code.
+    size_t SetCompressionParameters(void);
+
+    /// Set last error code/description from zstd status code.
+    void SetZstdError(size_t errcode);
+
+    /// Format string with last error description.
+    string FormatErrorMessage(string where) const;
+
+protected:
+    void*  m_CCtx;   ///< Compression context (ZSTD_CCtx*)
+    void*  m_DCtx;   ///< Decompression context (ZSTD_DCtx*)
+
+private:
+    /// Private copy constructor to prohibit copy.
+    CZstdCompression(const CZstdCompression&);
+    /// Private assignment operator to prohibit assignment.
+    CZstdCompression& operator= (const CZstdCompression&);
+};
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+///
+/// CZstdCompressionFile class --
+///
+/// Throw exceptions on critical errors.
+
+class NCBI_XUTIL_EXPORT CZstdCompressionFile : public CZstdCompression,
+                                               public CCompressionFile
+{
+public:
+    /// Constructor.
+    CZstdCompressionFile(
+        const string& file_name,
+        EMode         mode,
+        ELevel        level = eLevel_Default
+    );
+
+    /// Conventional constructor.
+    CZstdCompressionFile(
+        ELevel        level = eLevel_Default
+    );
+
+    /// Destructor
+    ~CZstdCompressionFile(void);
+
+    /// Opens a compressed file for reading or writing.
+    ///
+    /// @param file_name
+    ///   File name of the file to open.
+    /// @param mode
+    ///   File open mode.
+    /// @return
+    ///   TRUE if file was opened succesfully or FALSE otherwise.
+    /// @sa
+    ///   CZstdCompression, Read, Write, Close
+    virtual bool Open(const string& file_name, EMode mode);
+
+    /// Read data from compressed file.
+    ///
+    /// Read up to "len" uncompressed bytes from the compressed file "file"
+    /// into the buffer "buf".
+    /// @param buf
+    ///    Buffer for requested data.
+    /// @param len
+    ///    Number of bytes to read.
+    /// @return
+    ///   Number of bytes actually read (0 for end of file, -1 for error).
+    ///   The number of really readed bytes can be less than requested.
+    /// @sa
+    ///   Open, Write, Close
+    virtual long Read(void* buf, size_t len);
+
+    /// Write data to compressed file.
+    ///
+    /// Writes the given number of uncompressed bytes from the buffer
+    /// into the compressed file.
+    /// @param buf
+    ///    Buffer with written data.
+    /// @param len
+    ///    Number of bytes to write.
+    /// @return
+    ///   Number of bytes actually written or -1 for error.
+    /// @sa
+    ///   Open, Read, Close
+    virtual long Write(const void* buf, size_t len);
+
+    /// Close compressed file.
+    ///
+    /// Flushes all pending output if necessary, closes the compressed file.
+    /// @return
+    ///   TRUE on success, FALSE on error.
+    /// @sa
+    ///   Open, Read, Write
+    virtual bool Close(void);
+
+protected:
+    /// Get error code/description of last stream operation (m_Stream).
+    /// It can be received using GetErrorCode()/GetErrorDescription() methods.
+    void GetStreamError(void);
+
+protected:
+    EMode                  m_Mode;     ///< I/O mode (read/write).
+    CNcbiFstream*          m_File;     ///< File stream.
+    CCompressionIOStream*  m_Stream;   ///< [De]comression stream.
+
+private:
+    /// Private copy constructor to prohibit copy.
+    CZstdCompressionFile(const CZstdCompressionFile&);
+    /// Private assignment operator to prohibit assignment.
+    CZstdCompressionFile& operator= (const CZstdCompressionFile&);
+};
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZstdCompressor -- zstd based compressor
+///
+/// Used in CZstdStreamCompressor.
+/// @sa CZstdStreamCompressor, CZstdCompression, CCompressionProcessor
+
+class NCBI_XUTIL_EXPORT CZstdCompressor : public CZstdCompression,
+                                          public CCompressionProcessor
+{
+public:
+    /// Constructor.
+    CZstdCompressor(
+        ELevel     level = eLevel_Default,
+        TZstdFlags flags = 0
+    );
+
+    /// Destructor.
+    virtual ~CZstdCompressor(void);
+
+protected:
+    virtual EStatus Init   (void);
+    virtual EStatus Process(const char* in_buf,  size_t  in_len,
+                            char*       out_buf, size_t  out_size,
+                            /* out */            size_t* in_avail,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Flush  (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Finish (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus End    (int abandon = 0);
+};
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZstdDecompressor -- zstd based decompressor
+///
+/// Used in CZstdStreamDecompressor.
+/// Concatenated zstd frames are decompressed as one data stream.
+/// @sa CZstdStreamDecompressor, CZstdCompression, CCompressionProcessor
+
+class NCBI_XUTIL_EXPORT CZstdDecompressor : public CZstdCompression,
+                                            public CCompressionProcessor
+{
+public:
+    /// Constructor.
+    CZstdDecompressor(TZstdFlags flags = 0);
+
+    /// Destructor.
+    virtual ~CZstdDecompressor(void);
+
+protected:
+    virtual EStatus Init   (void);
+    virtual EStatus Process(const char* in_buf,  size_t  in_len,
+                            char*       out_buf, size_t  out_size,
+                            /* out */            size_t* in_avail,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Flush  (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus Finish (char*       out_buf, size_t  out_size,
+                            /* out */            size_t* out_avail);
+    virtual EStatus End    (int abandon = 0);
+
+protected:
+    /// Decompress data, used for the cached and the input data.
+    EStatus DecompressData(const char* in_buf,  size_t  in_len,
+                           char*       out_buf, size_t  out_size,
+                           /* out */            size_t* in_avail,
+                           /* out */            size_t* out_avail);
+
+private:
+    string  m_Cache;     ///< Beginning of data to check magic number
+    bool    m_FrameEnd;  ///< TRUE if the last frame is complete
+};
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+///
+/// CZstdStreamCompressor -- zstd based compression stream processor
+///
+/// See util/compress/stream.hpp for details of stream processing.
+/// @sa CCompressionStreamProcessor
+
+class NCBI_XUTIL_EXPORT CZstdStreamCompressor
+    : public CCompressionStreamProcessor
+{
+public:
+    /// Full constructor
+    CZstdStreamCompressor(
+        CZstdCompression::ELevel     level,
+        streamsize                   in_bufsize,
+        streamsize                   out_bufsize,
+        CZstdCompression::TZstdFlags flags = 0
+        )
+        : CCompressionStreamProcessor(
+              new CZstdCompressor(level, flags),
+              eDelete, in_bufsize, out_bufsize)
+    {}
+
+    /// Conventional constructor
+    CZstdStreamCompressor(
+        CZstdCompression::ELevel     level,
+        CZstdCompression::TZstdFlags flags = 0
+        )
+        : CCompressionStreamProcessor(
+              new CZstdCompressor(level, flags),
+              eDelete, kCompressionDefaultBufSize, kCompressionDefaultBufSize)
+    {}
+
+    /// Conventional constructor
+    CZstdStreamCompressor(CZstdCompression::TZstdFlags flags = 0)
+        : CCompressionStreamProcessor(
+              new CZstdCompressor(CZstdCompression::eLevel_Default, flags),
+              eDelete, kCompressionDefaultBufSize, kCompressionDefaultBufSize)
+    {}
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+///
+/// CZstdStreamDecompressor -- zstd based decompression stream processor
+///
+/// See util/compress/stream.hpp for details of stream processing.
+/// @sa CCompressionStreamProcessor
+
+class NCBI_XUTIL_EXPORT CZstdStreamDecompressor
+    : public CCompressionStreamProcessor
+{
+public:
+    /// Full constructor
+    CZstdStreamDecompressor(
+        streamsize                   in_bufsize,
+        streamsize                   out_bufsize,
+        CZstdCompression::TZstdFlags flags = 0
+        )
+        : CCompressionStreamProcessor(
+             new CZstdDecompressor(flags),
+             eDelete, in_bufsize, out_bufsize)
+    {}
+
+    /// Conventional constructor
+    CZstdStreamDecompressor(CZstdCompression::TZstdFlags flags = 0)
+        : CCompressionStreamProcessor(
+              new CZstdDecompressor(flags),
+              eDelete, kCompressionDefaultBufSize, kCompressionDefaultBufSize)
+    {}
+};
+
+
+END_NCBI_SCOPE
+
+
+/* @} */
+
+#endif  /* HAVE_LIBZSTD */
+
+#endif  /* UTIL_COMPRESS__ZSTD__HPP */
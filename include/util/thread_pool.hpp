@@ -207,6 +207,21 @@ private:
 class NCBI_XUTIL_EXPORT CThreadPool
 {
 public:
+    /// How tasks are stored while waiting for execution
+    enum EQueueType {
+        /// Single queue ordered by task priority. Best for long tasks
+        /// and when strict priority order is required.
+        eQueue_Shared,
+        /// Several queues, each preferred by its own subset of threads,
+        /// with idle threads stealing tasks from other queues. Adding and
+        /// taking tasks does not serialize on one lock, which is better
+        /// for large numbers of short tasks. Priorities are respected
+        /// through a few priority bands: tasks with priority 0, 1, 2 get
+        /// their own bands, all others share the last band; tasks within
+        /// a band are executed in FIFO order of each queue.
+        eQueue_WorkStealing
+    };
+
     /// Constructor
     /// @param queue_size
     ///   Maximum number of tasks waiting in the queue. If 0 then tasks
@@ -224,12 +239,15 @@ public:
     /// @param threads_mode
     ///   Running mode of all threads in thread pool. Values fRunDetached and
     ///   fRunAllowST are ignored.
+    /// @param queue_type
+    ///   How to store tasks waiting for execution.
     ///
-    /// @sa AddTask()
+    /// @sa AddTask(), EQueueType
     CThreadPool(unsigned int      queue_size,
                 unsigned int      max_threads,
                 unsigned int      min_threads = 2,
-                CThread::TRunMode threads_mode = CThread::fRunDefault);
+                CThread::TRunMode threads_mode = CThread::fRunDefault,
+                EQueueType        queue_type = eQueue_Shared);
 
     /// Add task to the pool for execution.
     /// @note
@@ -303,9 +321,12 @@ public:
     /// @param threads_mode
     ///   Running mode of all threads in thread pool. Values fRunDetached and
     ///   fRunAllowST are ignored.
+    /// @param queue_type
+    ///   How to store tasks waiting for execution.
     CThreadPool(unsigned int            queue_size,
                 CThreadPool_Controller* controller,
-                CThread::TRunMode       threads_mode = CThread::fRunDefault);
+                CThread::TRunMode       threads_mode = CThread::fRunDefault,
+                EQueueType              queue_type = eQueue_Shared);
 
     /// Set timeout to wait for all threads to finish before the pool
     /// should be able to destroy.
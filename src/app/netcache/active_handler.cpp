@@ -826,12 +826,15 @@ CNCActiveHandler::SyncStart(CNCActiveSyncControl* ctrl,
     m_CmdToSend += NStr::UInt8ToString(local_rec_no);
     m_CmdToSend.append(1, ' ');
     m_CmdToSend += NStr::UInt8ToString(remote_rec_no);
+    if (m_Peer->AcceptsSyncHashes())
+        m_CmdToSend += " 1";
 
     x_SetStateAndStartProcessing(&CNCActiveHandler::x_SendCmdToExecute);
 }
 
 void
-CNCActiveHandler::SyncBlobsList(CNCActiveSyncControl* ctrl)
+CNCActiveHandler::SyncBlobsList(CNCActiveSyncControl* ctrl,
+                                const TNCSyncHashLeaves* leaves)
 {
     m_SyncAction = eSynActionNone;
     m_SyncCtrl = ctrl;
@@ -843,6 +846,40 @@ CNCActiveHandler::SyncBlobsList(CNCActiveSyncControl* ctrl)
     m_CmdToSend += NStr::UInt8ToString(CNCDistributionConf::GetSelfID());
     m_CmdToSend.append(1, ' ');
     m_CmdToSend += NStr::UIntToString(ctrl->GetSyncSlot());
+    if (leaves) {
+        m_CmdToSend += " \"";
+        ITERATE(TNCSyncHashLeaves, it, *leaves) {
+            if (it != leaves->begin())
+                m_CmdToSend.append(1, ',');
+            m_CmdToSend += NStr::UIntToString(*it);
+        }
+        m_CmdToSend.append(1, '"');
+    }
+
+    x_SetStateAndStartProcessing(&CNCActiveHandler::x_SendCmdToExecute);
+}
+
+void
+CNCActiveHandler::SyncHashes(CNCActiveSyncControl* ctrl,
+                             const vector<Uint2>& nodes)
+{
+    m_SyncAction = eSynActionNone;
+    m_SyncCtrl = ctrl;
+    SetDiagCtx(ctrl->GetDiagCtx());
+    m_CurCmd = eSyncHashes;
+
+    m_CmdToSend.resize(0);
+    m_CmdToSend += "SYNC_HASHES ";
+    m_CmdToSend += NStr::UInt8ToString(CNCDistributionConf::GetSelfID());
+    m_CmdToSend.append(1, ' ');
+    m_CmdToSend += NStr::UIntToString(ctrl->GetSyncSlot());
+    m_CmdToSend += " \"";
+    ITERATE(vector<Uint2>, it, nodes) {
+        if (it != nodes.begin())
+            m_CmdToSend.append(1, ',');
+        m_CmdToSend += NStr::UIntToString(*it);
+    }
+    m_CmdToSend.append(1, '"');
 
     x_SetStateAndStartProcessing(&CNCActiveHandler::x_SendCmdToExecute);
 }
@@ -1525,6 +1562,8 @@ CNCActiveHandler::x_ReadSizeToRead(void)
     case eSyncStart:
     case eSyncBList:
         return &CNCActiveHandler::x_ReadSyncStartAnswer;
+    case eSyncHashes:
+        return &CNCActiveHandler::x_ReadSyncHashes;
     case eSyncGet:
         return &CNCActiveHandler::x_ReadSyncGetAnswer;
     default:
@@ -1678,8 +1717,10 @@ CNCActiveHandler::x_ReadSyncStartAnswer(void)
 
     bool by_blobs = m_CurCmd  == eSyncBList
                     ||  NStr::FindCase(m_Response, "ALL_BLOBS") != NPOS;
+    bool by_hashes = m_CurCmd == eSyncStart
+                     &&  NStr::FindCase(m_Response, "HASHES") != NPOS;
 
-    m_SyncCtrl->StartResponse(local_rec_no, remote_rec_no, by_blobs);
+    m_SyncCtrl->StartResponse(local_rec_no, remote_rec_no, by_blobs, by_hashes);
     if (by_blobs)
         return &CNCActiveHandler::x_ReadBlobsListKeySize;
     else
@@ -1841,6 +1882,30 @@ CNCActiveHandler::x_ReadBlobsListBody(void)
     return &CNCActiveHandler::x_ReadBlobsListKeySize;
 }
 
+CNCActiveHandler::State
+CNCActiveHandler::x_ReadSyncHashes(void)
+{
+    if (m_SizeToRead == 0) {
+        x_FinishSyncCmd(eSynOK, NC_SYNC_HINT);
+        return &CNCActiveHandler::x_FinishCommand;
+    }
+    if (m_SizeToRead < sizeof(Uint8))
+        return &CNCActiveHandler::x_ProcessProtocolError;
+    if (m_Proxy->NeedEarlyClose())
+        return &CNCActiveHandler::x_CloseCmdAndConn;
+
+    Uint8 hash = 0;
+    if (!m_Proxy->ReadNumber(&hash))
+        return NULL;
+
+    m_SizeToRead -= sizeof(hash);
+    if (!m_SyncCtrl->AddRemoteHash(hash)) {
+        x_FinishSyncCmd(eSynAborted, NC_SYNC_HINT);
+        return &CNCActiveHandler::x_FinishCommand;
+    }
+    return &CNCActiveHandler::x_ReadSyncHashes;
+}
+
 CNCActiveHandler::State
 CNCActiveHandler::x_SendSyncGetCmd(void)
 {
@@ -2175,6 +2240,8 @@ CNCActiveHandler::x_WaitOneLineAnswer(void)
     case eSyncStart:
     case eSyncBList:
         return &CNCActiveHandler::x_ReadSyncStartHeader;
+    case eSyncHashes:
+        return &CNCActiveHandler::x_ReadSizeToRead;
     case eSyncGet:
         return &CNCActiveHandler::x_ReadSyncGetHeader;
     case eSyncProInfo:
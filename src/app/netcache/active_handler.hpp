@@ -222,7 +222,9 @@ public:
     bool GotClientResponse(void);
 
     void SyncStart(CNCActiveSyncControl* ctrl, Uint8 local_rec_no, Uint8 remote_rec_no);
-    void SyncBlobsList(CNCActiveSyncControl* ctrl);
+    void SyncBlobsList(CNCActiveSyncControl* ctrl,
+                       const TNCSyncHashLeaves* leaves = NULL);
+    void SyncHashes(CNCActiveSyncControl* ctrl, const vector<Uint2>& nodes);
     void SyncSend(CNCActiveSyncControl* ctrl, SNCSyncEvent* event);
     void SyncSend(CNCActiveSyncControl* ctrl, const CNCBlobKeyLight& key);
     void SyncRead(CNCActiveSyncControl* ctrl, SNCSyncEvent* event);
@@ -276,6 +278,7 @@ private:
         eWriteData,
         eSyncStart,
         eSyncBList,
+        eSyncHashes,
         eSyncGet,
         eSyncProlongPeer,
         eSyncProInfo,
@@ -330,6 +333,7 @@ private:
     State x_ReadEventsListBody(void);
     State x_ReadBlobsListKeySize(void);
     State x_ReadBlobsListBody(void);
+    State x_ReadSyncHashes(void);
     State x_SendSyncGetCmd(void);
     State x_ReadSyncGetHeader(void);
     State x_ReadSyncGetAnswer(void);
@@ -958,7 +958,10 @@ static CNCMessageHandler::SCommandDef s_CommandMap[] = {
     // sync logs of this server which need to be synchronized. Or if this
     // server understands that synchronization using blob lists is needed then
     // first line of response will contain ALL_BLOBS word and then full list
-    // of blobs in this slot will be sent.
+    // of blobs in this slot will be sent. If the other server asked to compare
+    // hash trees of the slot then the list is not sent, first line contains
+    // ALL_BLOBS and HASHES words, and the other server will ask for hashes
+    // with SYNC_HASHES and for lists of differing blobs with SYNC_BLIST.
     { "SYNC_START",
         {&CNCMessageHandler::x_DoCmd_SyncStart,
             "SYNC_START",
@@ -975,7 +978,10 @@ static CNCMessageHandler::SCommandDef s_CommandMap[] = {
           { "rec_my",  eNSPT_Int,  eNSPA_Required },
           // Last synchronized record number (in sync log) of _this_ server
           // as _that_ server thinks.
-          { "rec_your",eNSPT_Int,  eNSPA_Required } } },
+          { "rec_your",eNSPT_Int,  eNSPA_Required },
+          // 1 if _that_ server wants to compare hash trees of the slot
+          // instead of receiving full list of blobs.
+          { "hashes",  eNSPT_Int,  eNSPA_Optional, "0" } } },
     // Get full list of blobs for the slot. Command is sent only by other NC
     // servers when that server decides that synchronization using blob lists
     // is needed. Command can be sent only after successful execution of
@@ -987,7 +993,24 @@ static CNCMessageHandler::SCommandDef s_CommandMap[] = {
           // Server id of the server managing the synchronization.
         { { "srv_id",  eNSPT_Int,  eNSPA_Required },
           // Slot that synchronization is started on.
-          { "slot",    eNSPT_Int,  eNSPA_Required } } },
+          { "slot",    eNSPT_Int,  eNSPA_Required },
+          // Comma-separated list of leaves of slot's hash tree. If given
+          // then only blobs belonging to these leaves are listed.
+          { "leaves",  eNSPT_Str,  eNSPA_Optional } } },
+    // Get hashes of children of the given nodes in the hash tree of the slot.
+    // Command is sent only by other NC servers which compare hash trees
+    // to find out which blobs should be synchronized. Command can be sent
+    // only after successful execution of SYNC_START command.
+    { "SYNC_HASHES",
+        {&CNCMessageHandler::x_DoCmd_SyncHashes,
+            "SYNC_HASHES",
+            eRunsInStartedSync, eNCNone, eProxyNone},
+          // Server id of the server managing the synchronization.
+        { { "srv_id",  eNSPT_Int,  eNSPA_Required },
+          // Slot that synchronization is started on.
+          { "slot",    eNSPT_Int,  eNSPA_Required },
+          // Comma-separated list of nodes of slot's hash tree.
+          { "nodes",   eNSPT_Str,  eNSPA_Required } } },
     // Write blob contents. This command is sent only by other NC servers
     // during synchronization session if some blob was written on that server
     // and the same data didn't make it to this server yet.
@@ -1750,6 +1773,8 @@ CNCMessageHandler::x_AssignCmdParams(void)
     m_Quorum = 1;
     m_CmdVersion = 0;
     m_ForceLocal = false;
+    m_SyncByHashes = false;
+    m_SyncHashNodes.clear();
     m_AgeMax = m_AgeCur = 0;
     bool quorum_was_set = false;
     bool search_was_set = false;
@@ -1820,6 +1845,9 @@ CNCMessageHandler::x_AssignCmdParams(void)
                 if (key == "http") {
                     m_HttpMode = (EHttpMode)NStr::StringToInt(val);
                 }
+                else if (key == "hashes") {
+                    m_SyncByHashes = val == "1";
+                }
                 break;
             case 'i':
                 if (key == "ip") {
@@ -1848,6 +1876,9 @@ CNCMessageHandler::x_AssignCmdParams(void)
                 else if (key == "local") {
                     m_ForceLocal = val == "1";
                 }
+                else if (key == "leaves") {
+                    m_SyncHashNodes = val;
+                }
                 break;
             case 'm':
                 if (key == "md5_pass") {
@@ -1860,6 +1891,9 @@ CNCMessageHandler::x_AssignCmdParams(void)
                         GetDiagCtx()->SetHitID(val);
                     }
                 }
+                else if (key == "nodes") {
+                    m_SyncHashNodes = val;
+                }
                 break;
             case 'p':
                 if (key == "pass") {
@@ -3096,7 +3130,17 @@ CNCMessageHandler::x_WriteBlobData(void)
         if (m_Size != Uint8(-1)  &&  m_Size < want_read)
             want_read = Uint4(m_Size);
 
-        Uint4 n_written = Uint4(Write(m_BlobAccess->GetReadMemPtr(), want_read));
+        TFileHandle fd;
+        Uint8 offset;
+        Uint4 n_written;
+        if (m_BlobAccess->GetReadFileCoord(fd, offset)) {
+            n_written = Uint4(WriteFromFile(fd, offset,
+                                            m_BlobAccess->GetReadMemPtr(),
+                                            want_read));
+        }
+        else {
+            n_written = Uint4(Write(m_BlobAccess->GetReadMemPtr(), want_read));
+        }
         if (n_written != 0) {
             if (m_Flags & fComesFromClient)
                 CNCStat::ClientDataRead(n_written);
@@ -4064,12 +4108,34 @@ CNCMessageHandler::x_DoCmd_IC_Store(void)
     return &CNCMessageHandler::x_StartReadingBlob;
 }
 
+bool
+CNCMessageHandler::x_ParseSyncHashNodes(Uint2 max_node, vector<Uint2>& nodes)
+{
+    list<CTempString> tokens;
+    ncbi_NStr_Split(m_SyncHashNodes, ",", tokens);
+    if (tokens.empty()  ||  tokens.size() > kNCSyncHashLeaves)
+        return false;
+    try {
+        ITERATE(list<CTempString>, it, tokens) {
+            Uint4 node = NStr::StringToUInt(*it);
+            if (node >= max_node)
+                return false;
+            nodes.push_back(Uint2(node));
+        }
+    }
+    catch (CStringException&) {
+        return false;
+    }
+    return true;
+}
+
 void
-CNCMessageHandler::x_WriteFullBlobsList(void)
+CNCMessageHandler::x_WriteFullBlobsList(const TNCSyncHashLeaves* leaves)
 {
     LOG_CURRENT_FUNCTION
     TNCBlobSumList blobs_list;
-    CNCBlobStorage::GetFullBlobsList(m_Slot, blobs_list, CNCPeerControl::Peer(m_SrvId));
+    CNCBlobStorage::GetFullBlobsList(m_Slot, blobs_list,
+                                     CNCPeerControl::Peer(m_SrvId), leaves);
     m_SendBuff.reset(new TNCBufferType());
     m_SendBuff->reserve_mem(blobs_list.size() * 200);
     NON_CONST_ITERATE(TNCBlobSumList, it_blob, blobs_list) {
@@ -4172,10 +4238,18 @@ CNCMessageHandler::x_DoCmd_SyncStart(void)
     else {
         _ASSERT(sync_res == eProceedWithBlobs);
         m_LocalRecNo = CNCSyncLog::GetCurrentRecNo(m_Slot);
-        x_WriteFullBlobsList();
+        if (m_SyncByHashes) {
+            // Other server will find differing parts of the slot by itself
+            // and will ask for lists of blobs only in them.
+            m_SendBuff.reset(new TNCBufferType());
+            result += "ALL_BLOBS,HASHES,";
+        }
+        else {
+            x_WriteFullBlobsList();
+            result += "ALL_BLOBS,";
+        }
         GetDiagCtx()->SetRequestStatus(eStatus_SyncBList);
         x_SetFlag(fSyncCmdSuccessful);
-        result += "ALL_BLOBS,";
     }
 
     if (NeedEarlyClose())
@@ -4194,9 +4268,19 @@ CNCMessageHandler::State
 CNCMessageHandler::x_DoCmd_SyncBlobsList(void)
 {
     LOG_CURRENT_FUNCTION
+    TNCSyncHashLeaves leaves;
+    if (!m_SyncHashNodes.empty()) {
+        vector<Uint2> nodes;
+        if (!x_ParseSyncHashNodes(kNCSyncHashLeaves, nodes)) {
+            x_ReportError("ERR:Invalid list of leaves");
+            GetDiagCtx()->SetRequestStatus(eStatus_BadCmd);
+            return &CNCMessageHandler::x_FinishCommand;
+        }
+        leaves.insert(nodes.begin(), nodes.end());
+    }
     CNCPeriodicSync::MarkCurSyncByBlobs(m_SrvId, m_Slot, m_SyncId);
     Uint8 rec_no = CNCSyncLog::GetCurrentRecNo(m_Slot);
-    x_WriteFullBlobsList();
+    x_WriteFullBlobsList(m_SyncHashNodes.empty()? NULL: &leaves);
 
     if (NeedEarlyClose())
         return &CNCMessageHandler::x_CloseCmdAndConn;
@@ -4208,6 +4292,32 @@ CNCMessageHandler::x_DoCmd_SyncBlobsList(void)
     return &CNCMessageHandler::x_WriteSendBuff;
 }
 
+CNCMessageHandler::State
+CNCMessageHandler::x_DoCmd_SyncHashes(void)
+{
+    LOG_CURRENT_FUNCTION
+    vector<Uint2> nodes;
+    if (!x_ParseSyncHashNodes(kNCSyncHashFirstLeaf, nodes)) {
+        x_ReportError("ERR:Invalid list of nodes");
+        GetDiagCtx()->SetRequestStatus(eStatus_BadCmd);
+        return &CNCMessageHandler::x_FinishCommand;
+    }
+    vector<Uint8> hashes;
+    hashes.reserve(nodes.size() * kNCSyncHashFanout);
+    CNCBlobStorage::GetSyncHashes(m_Slot, nodes, hashes);
+
+    m_SendBuff.reset(new TNCBufferType());
+    m_SendBuff->reserve_mem(hashes.size() * sizeof(Uint8));
+    ITERATE(vector<Uint8>, it, hashes) {
+        m_SendBuff->append(&*it, sizeof(*it));
+    }
+
+    x_ReportOK("OK:SIZE=").WriteNumber(m_SendBuff->size());
+    WriteText("\n");
+    m_SendPos = 0;
+    return &CNCMessageHandler::x_WriteSendBuff;
+}
+
 CNCMessageHandler::State
 CNCMessageHandler::x_DoCmd_CopyPut(void)
 {
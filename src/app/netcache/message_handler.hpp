@@ -188,6 +188,7 @@ public:
     State x_DoCmd_IC_Store(void);
     State x_DoCmd_SyncStart(void);
     State x_DoCmd_SyncBlobsList(void);
+    State x_DoCmd_SyncHashes(void);
     State x_DoCmd_CopyPut(void);
     State x_DoCmd_CopyProlong(void);
     State x_DoCmd_SyncGet(void);
@@ -278,7 +279,9 @@ private:
 
     void x_ProlongBlobDeadTime(unsigned int add_time);
     void x_ProlongVersionLife(void);
-    void x_WriteFullBlobsList(void);
+    void x_WriteFullBlobsList(const TNCSyncHashLeaves* leaves = NULL);
+    /// Parse list of nodes of slot's hash tree given in the command.
+    bool x_ParseSyncHashNodes(Uint2 max_node, vector<Uint2>& nodes);
     void x_GetCurSlotServers(void);
 
     void x_JournalBlobPutResult(int status, const string& blob_key, Uint2 blob_slot);
@@ -341,6 +344,10 @@ private:
     size_t                    m_SendPos;
     string                    m_RawBlobPass;
     Uint8                     m_SyncId;
+    /// Peer asked to compare hash trees instead of full blob lists
+    bool                      m_SyncByHashes;
+    /// List of hash tree nodes or leaves given in the command
+    string                    m_SyncHashNodes;
     Uint2                     m_BlobSlot;
     Uint2                     m_TimeBucket;
     Uint1                     m_Quorum;
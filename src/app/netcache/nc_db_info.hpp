@@ -48,6 +48,17 @@ static const Uint4  kNCMaxDBFileId = 0xFFFFFFFF;
 /// memory_man.cpp in task_server library).
 static const size_t kNCMaxBlobChunkSize = 32740;
 static const Uint2  kNCMaxChunksInMap = 128;
+/// Shape of the tree of blob hashes kept for each slot to find out quickly
+/// which parts of the slot differ between servers during synchronization.
+/// Each node has kNCSyncHashFanout children and leaves are kNCSyncHashLevels
+/// levels below the root. Nodes are numbered level by level starting with 0
+/// for the root, so children of node n have numbers n * kNCSyncHashFanout + 1
+/// to (n + 1) * kNCSyncHashFanout and leaf i has number
+/// kNCSyncHashFirstLeaf + i.
+static const Uint2  kNCSyncHashFanout = 16;
+static const Uint2  kNCSyncHashLevels = 3;
+static const Uint2  kNCSyncHashLeaves = 16 * 16 * 16;
+static const Uint2  kNCSyncHashFirstLeaf = 1 + 16 + 16 * 16;
 
 
 
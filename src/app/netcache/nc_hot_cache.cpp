@@ -0,0 +1,460 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ */
+
+#include "nc_pch.hpp"
+
+#include "netcached.hpp"
+#include "nc_hot_cache.hpp"
+#include "nc_db_info.hpp"
+#include "nc_stat.hpp"
+
+
+BEGIN_NCBI_SCOPE
+
+
+/// Number of independent shards in the cache
+static const Uint4 kHotCacheShards = 16;
+/// Number of rows in frequency sketch
+static const Uint4 kSketchDepth = 4;
+/// Number of counters in each row of frequency sketch (power of 2)
+static const Uint4 kSketchWidth = 8192;
+/// Maximum value of frequency counter
+static const Uint1 kSketchMaxFreq = 15;
+/// Number of reads registered in sketch after which all counters are halved
+/// so that old popularity is forgotten
+static const Uint4 kSketchResetPeriod = 10 * kSketchWidth;
+/// Percentage of shard's memory given to protected segment of LRU
+static const Uint8 kProtectedPct = 80;
+
+
+struct SHotKeyCompare
+{
+    bool operator() (const SNCHotBlob& x, const SNCHotBlob& y) const
+    {
+        return x.key < y.key;
+    }
+    bool operator() (const string& key, const SNCHotBlob& y) const
+    {
+        return key < y.key;
+    }
+    bool operator() (const SNCHotBlob& x, const string& key) const
+    {
+        return x.key < key;
+    }
+};
+
+typedef intr::rbtree<SNCHotBlob,
+                     intr::base_hook<THotKeyMapHook>,
+                     intr::constant_time_size<true>,
+                     intr::compare<SHotKeyCompare> >        THotKeyMap;
+typedef intr::list<SNCHotBlob,
+                   intr::base_hook<THotLRUHook>,
+                   intr::constant_time_size<false> >        THotLRUList;
+
+/// One shard of the cache. In both LRU lists least recently used blobs are
+/// at the front.
+struct SHotCacheShard
+{
+    CMiniMutex   lock;
+    THotKeyMap   key_map;
+    THotLRUList  probation;
+    THotLRUList  protect;
+    Uint8        cur_size;
+    Uint8        protect_size;
+    Uint1*       sketch;
+    Uint4        sketch_adds;
+
+    SHotCacheShard(void)
+        : cur_size(0),
+          protect_size(0),
+          sketch(NULL),
+          sketch_adds(0)
+    {}
+};
+
+
+static SHotCacheShard* s_Shards = NULL;
+static Uint8 s_MaxSize = 0;
+static Uint4 s_MaxBlobSize = 0;
+
+
+SNCHotBlobVer::SNCHotBlobVer(const SNCBlobVerData* ver_data)
+    : create_time(ver_data->create_time),
+      create_server(ver_data->create_server),
+      create_id(ver_data->create_id),
+      size(ver_data->size),
+      cnt_chunks(ver_data->cnt_chunks)
+{}
+
+SNCHotBlobVer::SNCHotBlobVer(Uint8 time, Uint8 server, Uint4 id,
+                             Uint8 blob_size, Uint8 chunks)
+    : create_time(time),
+      create_server(server),
+      create_id(id),
+      size(blob_size),
+      cnt_chunks(chunks)
+{}
+
+
+SNCHotBlob::SNCHotBlob(const string& blob_key,
+                       const SNCHotBlobVer& ver,
+                       const char* blob_data)
+    : key(blob_key),
+      create_time(ver.create_time),
+      create_server(ver.create_server),
+      create_id(ver.create_id),
+      size(Uint4(ver.size)),
+      is_protected(false)
+{
+    data = (char*)malloc(size);
+    memcpy(data, blob_data, size);
+}
+
+SNCHotBlob::~SNCHotBlob(void)
+{
+    free(data);
+}
+
+bool
+SNCHotBlob::IsVersionOf(const SNCHotBlobVer& ver) const
+{
+    return create_time == ver.create_time
+           &&  create_server == ver.create_server
+           &&  create_id == ver.create_id
+           &&  size == ver.size;
+}
+
+
+static inline Uint8
+s_HashKey(const string& key)
+{
+    Uint8 hash = NCBI_CONST_UINT8(14695981039346656037);
+    for (size_t i = 0; i < key.size(); ++i) {
+        hash ^= Uint1(key[i]);
+        hash *= NCBI_CONST_UINT8(1099511628211);
+    }
+    hash ^= hash >> 33;
+    hash *= NCBI_CONST_UINT8(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static inline SHotCacheShard*
+s_GetShard(Uint8 hash)
+{
+    return &s_Shards[(hash >> 60) % kHotCacheShards];
+}
+
+static inline Uint4
+s_SketchIndex(Uint8 hash, Uint4 row)
+{
+    Uint4 h1 = Uint4(hash);
+    Uint4 h2 = Uint4(hash >> 32) | 1;
+    return row * kSketchWidth + ((h1 + row * h2) & (kSketchWidth - 1));
+}
+
+static Uint1
+s_GetFrequency(SHotCacheShard* shard, Uint8 hash)
+{
+    if (!shard->sketch)
+        return 0;
+
+    Uint1 freq = kSketchMaxFreq;
+    for (Uint4 row = 0; row < kSketchDepth; ++row) {
+        freq = min(freq, shard->sketch[s_SketchIndex(hash, row)]);
+    }
+    return freq;
+}
+
+/// Register one read of the blob with given hash. Should be called under
+/// shard's lock.
+static void
+s_AddFrequency(SHotCacheShard* shard, Uint8 hash)
+{
+    if (!shard->sketch)
+        return;
+
+    for (Uint4 row = 0; row < kSketchDepth; ++row) {
+        Uint1& cnt = shard->sketch[s_SketchIndex(hash, row)];
+        if (cnt < kSketchMaxFreq)
+            ++cnt;
+    }
+    if (++shard->sketch_adds >= kSketchResetPeriod) {
+        for (Uint4 i = 0; i < kSketchDepth * kSketchWidth; ++i) {
+            shard->sketch[i] >>= 1;
+        }
+        shard->sketch_adds = 0;
+    }
+}
+
+static inline Uint8
+s_ShardMaxSize(void)
+{
+    return s_MaxSize / kHotCacheShards;
+}
+
+static void
+s_DeleteBlob(SHotCacheShard* shard, SNCHotBlob* blob)
+{
+    shard->key_map.erase(shard->key_map.iterator_to(*blob));
+    if (blob->is_protected) {
+        shard->protect.erase(shard->protect.iterator_to(*blob));
+        shard->protect_size -= blob->size;
+    }
+    else {
+        shard->probation.erase(shard->probation.iterator_to(*blob));
+    }
+    shard->cur_size -= blob->size;
+    blob->RemoveReference();
+}
+
+/// Move blobs from the protected segment to probation one until protected
+/// segment fits into its limit.
+static void
+s_DemoteProtected(SHotCacheShard* shard)
+{
+    Uint8 max_protect = s_ShardMaxSize() * kProtectedPct / 100;
+    while (shard->protect_size > max_protect) {
+        SNCHotBlob* blob = &shard->protect.front();
+        shard->protect.pop_front();
+        shard->protect_size -= blob->size;
+        blob->is_protected = false;
+        shard->probation.push_back(*blob);
+    }
+}
+
+static SNCHotBlob*
+s_GetVictim(SHotCacheShard* shard)
+{
+    if (!shard->probation.empty())
+        return &shard->probation.front();
+    if (!shard->protect.empty())
+        return &shard->protect.front();
+    return NULL;
+}
+
+/// Check if the blob with given frequency is more popular than all blobs
+/// that have to be evicted to make room for it. Victims are taken in the
+/// same order as by s_GetVictim(); their number is returned in cnt_victims.
+/// Nothing is changed in the shard.
+static bool
+s_CanAdmit(SHotCacheShard* shard, Uint1 freq, Uint8 need_size,
+           Uint4* cnt_victims)
+{
+    THotLRUList* lists[2] = {&shard->probation, &shard->protect};
+    Uint8 freed = 0;
+
+    *cnt_victims = 0;
+    for (Uint4 i = 0; i < 2; ++i) {
+        ITERATE(THotLRUList, it, *lists[i]) {
+            if (freed >= need_size)
+                return true;
+            if (freq <= s_GetFrequency(shard, s_HashKey(it->key)))
+                return false;
+            freed += it->size;
+            ++*cnt_victims;
+        }
+    }
+    return freed >= need_size;
+}
+
+static void
+s_ShrinkShard(SHotCacheShard* shard, Uint8 max_size)
+{
+    while (shard->cur_size > max_size) {
+        s_DeleteBlob(shard, s_GetVictim(shard));
+    }
+    s_DemoteProtected(shard);
+}
+
+
+void
+CNCHotCache::Initialize(void)
+{
+    s_Shards = new SHotCacheShard[kHotCacheShards];
+}
+
+void
+CNCHotCache::SetLimits(Uint8 max_size, Uint4 max_blob_size)
+{
+    for (Uint4 i = 0; max_size != 0  &&  i < kHotCacheShards; ++i) {
+        SHotCacheShard* shard = &s_Shards[i];
+        CMiniMutexGuard guard(shard->lock);
+        if (!shard->sketch) {
+            shard->sketch = new Uint1[kSketchDepth * kSketchWidth];
+            memset(shard->sketch, 0, kSketchDepth * kSketchWidth);
+        }
+    }
+    s_MaxSize = max_size;
+    s_MaxBlobSize = max_blob_size;
+    for (Uint4 i = 0; i < kHotCacheShards; ++i) {
+        SHotCacheShard* shard = &s_Shards[i];
+        CMiniMutexGuard guard(shard->lock);
+        s_ShrinkShard(shard, s_ShardMaxSize());
+    }
+}
+
+Uint8
+CNCHotCache::GetMaxSize(void)
+{
+    return s_MaxSize;
+}
+
+Uint4
+CNCHotCache::GetMaxBlobSize(void)
+{
+    return s_MaxBlobSize;
+}
+
+bool
+CNCHotCache::CanCache(const SNCHotBlobVer& ver)
+{
+    return s_MaxSize != 0  &&  ver.cnt_chunks == 1
+           &&  ver.size <= s_MaxBlobSize
+           &&  ver.size <= s_ShardMaxSize();
+}
+
+void
+CNCHotCache::Touch(const string& key)
+{
+    Uint8 hash = s_HashKey(key);
+    SHotCacheShard* shard = s_GetShard(hash);
+    CMiniMutexGuard guard(shard->lock);
+    s_AddFrequency(shard, hash);
+}
+
+CSrvRef<SNCHotBlob>
+CNCHotCache::Get(const string& key, const SNCHotBlobVer& ver)
+{
+    CSrvRef<SNCHotBlob> result;
+    Uint8 hash = s_HashKey(key);
+    SHotCacheShard* shard = s_GetShard(hash);
+
+    shard->lock.Lock();
+    s_AddFrequency(shard, hash);
+    THotKeyMap::iterator it = shard->key_map.find(key, SHotKeyCompare());
+    if (it != shard->key_map.end()  &&  it->IsVersionOf(ver)) {
+        SNCHotBlob* blob = &*it;
+        if (blob->is_protected) {
+            shard->protect.erase(shard->protect.iterator_to(*blob));
+        }
+        else {
+            shard->probation.erase(shard->probation.iterator_to(*blob));
+            blob->is_protected = true;
+            shard->protect_size += blob->size;
+        }
+        shard->protect.push_back(*blob);
+        s_DemoteProtected(shard);
+        result = blob;
+    }
+    shard->lock.Unlock();
+
+    if (result)
+        CNCStat::HotCacheHit(result->size);
+    else
+        CNCStat::HotCacheMiss();
+    return result;
+}
+
+void
+CNCHotCache::Put(const string& key,
+                 const SNCHotBlobVer& ver,
+                 const char* data)
+{
+    Uint8 hash = s_HashKey(key);
+    SHotCacheShard* shard = s_GetShard(hash);
+    Uint8 max_size = s_ShardMaxSize();
+    bool admitted = true;
+
+    shard->lock.Lock();
+    THotKeyMap::iterator it = shard->key_map.find(key, SHotKeyCompare());
+    if (it != shard->key_map.end()) {
+        if (it->IsVersionOf(ver)) {
+            // Somebody else has already put it
+            shard->lock.Unlock();
+            return;
+        }
+        s_DeleteBlob(shard, &*it);
+    }
+    if (ver.size > max_size) {
+        shard->lock.Unlock();
+        return;
+    }
+    // Blob is admitted only if it's more popular than all blobs that have
+    // to be evicted to make room for it. Nothing is evicted if it's not.
+    Uint4 cnt_victims = 0;
+    if (shard->cur_size + ver.size > max_size) {
+        admitted = s_CanAdmit(shard, s_GetFrequency(shard, hash),
+                              shard->cur_size + ver.size - max_size,
+                              &cnt_victims);
+    }
+    if (admitted) {
+        for (Uint4 i = 0; i < cnt_victims; ++i) {
+            s_DeleteBlob(shard, s_GetVictim(shard));
+        }
+        SNCHotBlob* blob = new SNCHotBlob(key, ver, data);
+        blob->AddReference();
+        shard->key_map.insert_unique(*blob);
+        shard->probation.push_back(*blob);
+        shard->cur_size += blob->size;
+    }
+    shard->lock.Unlock();
+
+    CNCStat::HotCacheAdmission(admitted);
+}
+
+void
+CNCHotCache::Remove(const string& key)
+{
+    if (s_MaxSize == 0)
+        return;
+
+    SHotCacheShard* shard = s_GetShard(s_HashKey(key));
+    CMiniMutexGuard guard(shard->lock);
+    THotKeyMap::iterator it = shard->key_map.find(key, SHotKeyCompare());
+    if (it != shard->key_map.end())
+        s_DeleteBlob(shard, &*it);
+}
+
+void
+CNCHotCache::ReadState(SNCStateStat& state)
+{
+    state.hot_size = 0;
+    state.hot_blobs = 0;
+    if (!s_Shards)
+        return;
+
+    for (Uint4 i = 0; i < kHotCacheShards; ++i) {
+        SHotCacheShard* shard = &s_Shards[i];
+        CMiniMutexGuard guard(shard->lock);
+        state.hot_size += shard->cur_size;
+        state.hot_blobs += shard->key_map.size();
+    }
+}
+
+END_NCBI_SCOPE
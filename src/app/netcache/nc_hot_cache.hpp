@@ -0,0 +1,140 @@
+#ifndef NETCACHE__NC_HOT_CACHE__HPP
+#define NETCACHE__NC_HOT_CACHE__HPP
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description: In-memory cache of data of small frequently read blobs
+ */
+
+
+namespace intr = boost::intrusive;
+
+
+BEGIN_NCBI_SCOPE
+
+
+struct SNCBlobVerData;
+struct SNCStateStat;
+
+
+struct SHotKeyMap_tag;
+struct SHotLRU_tag;
+
+typedef intr::set_base_hook< intr::tag<SHotKeyMap_tag>,
+                             intr::optimize_size<true> >    THotKeyMapHook;
+typedef intr::list_base_hook< intr::tag<SHotLRU_tag> >      THotLRUHook;
+
+
+/// Version of the blob as the cache sees it.
+/// Version is identified by blob's creation time, server and id -- data
+/// is never changed for the same values of them.
+struct SNCHotBlobVer
+{
+    Uint8   create_time;
+    Uint8   create_server;
+    Uint4   create_id;
+    Uint8   size;
+    Uint8   cnt_chunks;
+
+    explicit SNCHotBlobVer(const SNCBlobVerData* ver_data);
+    SNCHotBlobVer(Uint8 time, Uint8 server, Uint4 id,
+                  Uint8 blob_size, Uint8 chunks);
+};
+
+
+/// Copy of data of one version of the blob.
+struct SNCHotBlob : public CObject,
+                    public THotKeyMapHook,
+                    public THotLRUHook
+{
+public:
+    string  key;
+    Uint8   create_time;
+    Uint8   create_server;
+    Uint4   create_id;
+    Uint4   size;
+    /// Blob is in protected segment of LRU (was read at least twice while
+    /// in cache)
+    bool    is_protected;
+    char*   data;
+
+    SNCHotBlob(const string& blob_key, const SNCHotBlobVer& ver,
+               const char* blob_data);
+    virtual ~SNCHotBlob(void);
+
+    bool IsVersionOf(const SNCHotBlobVer& ver) const;
+
+private:
+    SNCHotBlob(const SNCHotBlob&);
+    SNCHotBlob& operator= (const SNCHotBlob&);
+};
+
+
+/// Size-bounded cache of small hot blobs.
+/// Only blobs consisting of one chunk are cached. New blobs are admitted
+/// only if they are estimated to be read more often than blobs that should
+/// be evicted for them (TinyLFU policy with frequencies kept in count-min
+/// sketch); eviction is made by segmented LRU.
+/// Cache is split into several shards by hash of the key, each shard has
+/// its own lock, LRU lists and frequency sketch.
+class CNCHotCache
+{
+public:
+    static void Initialize(void);
+    /// Set maximum memory used by the cache and maximum size of the blob
+    /// that can be cached. Zero max_size turns cache off.
+    static void SetLimits(Uint8 max_size, Uint4 max_blob_size);
+    static Uint8 GetMaxSize(void);
+    static Uint4 GetMaxBlobSize(void);
+    /// Check if blob of this size and number of chunks can be cached
+    static bool CanCache(const SNCHotBlobVer& ver);
+
+    /// Register one more read of the blob that wasn't looked up in cache
+    /// (its data was found in memory elsewhere).
+    static void Touch(const string& key);
+    /// Find data of the given blob version in cache and register one more
+    /// read of the blob.
+    static CSrvRef<SNCHotBlob> Get(const string& key,
+                                   const SNCHotBlobVer& ver);
+    /// Offer data of the blob to the cache. Data is copied only if blob is
+    /// admitted to the cache.
+    static void Put(const string& key,
+                    const SNCHotBlobVer& ver,
+                    const char* data);
+    /// Delete any version of the blob from cache
+    static void Remove(const string& key);
+
+    static void ReadState(SNCStateStat& state);
+
+private:
+    CNCHotCache(void);
+};
+
+
+END_NCBI_SCOPE
+
+#endif /* NETCACHE__NC_HOT_CACHE__HPP */
@@ -246,6 +246,11 @@ CNCStat::x_ClearStats(void)
     m_DiskWrBlobSize = 0;
     m_DiskWrBySize.resize(0);
     m_DiskWrBySize.resize(40, 0);
+    m_HotHits = 0;
+    m_HotHitSize = 0;
+    m_HotMisses = 0;
+    m_HotAdmits = 0;
+    m_HotRejects = 0;
     m_PeerSyncs = 0;
     m_PeerSynOps = 0;
     m_CntCleanedFiles = 0;
@@ -273,6 +278,7 @@ CNCStat::x_ClearStats(void)
     m_WBMemSize.Initialize();
     m_WBReleasable.Initialize();
     m_WBReleasing.Initialize();
+    m_HotSize.Initialize();
 }
 
 void
@@ -355,6 +361,11 @@ CNCStat::x_AddStats(CNCStat* src_stat)
     m_ClRdBlobSize += src_stat->m_ClRdBlobSize;
     m_DiskWrBlobs += src_stat->m_DiskWrBlobs;
     m_DiskWrBlobSize += src_stat->m_DiskWrBlobSize;
+    m_HotHits += src_stat->m_HotHits;
+    m_HotHitSize += src_stat->m_HotHitSize;
+    m_HotMisses += src_stat->m_HotMisses;
+    m_HotAdmits += src_stat->m_HotAdmits;
+    m_HotRejects += src_stat->m_HotRejects;
     m_PeerSyncs += src_stat->m_PeerSyncs;
     m_PeerSynOps += src_stat->m_PeerSynOps;
     m_CntCleanedFiles += src_stat->m_CntCleanedFiles;
@@ -374,6 +385,7 @@ CNCStat::x_AddStats(CNCStat* src_stat)
     m_WBMemSize.AddValues(src_stat->m_WBMemSize);
     m_WBReleasable.AddValues(src_stat->m_WBReleasable);
     m_WBReleasing.AddValues(src_stat->m_WBReleasing);
+    m_HotSize.AddValues(src_stat->m_HotSize);
 }
 
 void
@@ -589,6 +601,29 @@ CNCStat::DiskBlobWrite(Uint8 blob_size)
     stat->m_StatLock.Unlock();
 }
 
+void
+CNCStat::HotCacheHit(size_t data_size)
+{
+    CNCStat* stat = s_Stat();
+    AtomicAdd(stat->m_HotHits, 1);
+    AtomicAdd(stat->m_HotHitSize, data_size);
+}
+
+void
+CNCStat::HotCacheMiss(void)
+{
+    AtomicAdd(s_Stat()->m_HotMisses, 1);
+}
+
+void
+CNCStat::HotCacheAdmission(bool admitted)
+{
+    if (admitted)
+        AtomicAdd(s_Stat()->m_HotAdmits, 1);
+    else
+        AtomicAdd(s_Stat()->m_HotRejects, 1);
+}
+
 void
 CNCStat::DBFileCleaned(bool success, Uint4 seen_recs,
                        Uint4 moved_recs, Uint4 moved_size)
@@ -622,6 +657,7 @@ CNCStat::SaveCurStateStat(const SNCStateStat& state)
     stat->m_WBMemSize.AddValue(state.wb_size);
     stat->m_WBReleasable.AddValue(state.wb_releasable);
     stat->m_WBReleasing.AddValue(state.wb_releasing);
+    stat->m_HotSize.AddValue(state.hot_size);
     stat->m_StatLock.Unlock();
 
     CSrvRef<CNCStat> stat_5s = GetStat(kStatPeriodName[0], false);
@@ -773,6 +809,16 @@ CNCStat::PrintToLogs(CTempString stat_name)
         .PrintParam("end_wb_releasing", m_EndState.wb_releasing)
         .PrintParam("avg_wb_releasing", m_WBReleasing.GetAverage())
         .PrintParam("max_wb_releasing", m_WBReleasing.GetMaximum());
+    diag.PrintParam("start_hot_size", m_StartState.hot_size)
+        .PrintParam("end_hot_size", m_EndState.hot_size)
+        .PrintParam("avg_hot_size", m_HotSize.GetAverage())
+        .PrintParam("max_hot_size", m_HotSize.GetMaximum())
+        .PrintParam("end_hot_blobs", m_EndState.hot_blobs)
+        .PrintParam("hot_hits", m_HotHits)
+        .PrintParam("hot_hit_size", m_HotHitSize)
+        .PrintParam("hot_misses", m_HotMisses)
+        .PrintParam("hot_admits", m_HotAdmits)
+        .PrintParam("hot_rejects", m_HotRejects);
     if (m_StartState.min_dead_time != 0) {
         t.Sec() = m_StartState.min_dead_time;
         t.Print(buf, CSrvTime::eFmtLogging);
@@ -852,6 +898,10 @@ void CNCStat::PrintState(CSrvSocketTask& task)
     task.WriteText(eol).WriteText("wb_releasing" ).WriteText(str).WriteText(iss)
                                       .WriteText(NStr::UInt8ToString_DataSize( m_EndState.wb_releasing)).WriteText("\"");
     task.WriteText(eol).WriteText("wb_releasing" ).WriteText(is ).WriteNumber( m_EndState.wb_releasing);
+    task.WriteText(eol).WriteText("hot_size"     ).WriteText(str).WriteText(iss)
+                                      .WriteText(NStr::UInt8ToString_DataSize( m_EndState.hot_size)).WriteText("\"");
+    task.WriteText(eol).WriteText("hot_size"     ).WriteText(is ).WriteNumber( m_EndState.hot_size);
+    task.WriteText(eol).WriteText("hot_blobs"    ).WriteText(is ).WriteNumber( m_EndState.hot_blobs);
     
     task.WriteText(eol).WriteText("cnt_another_server_main" ).WriteText(is ).WriteNumber( m_EndState.cnt_another_server_main);
     task.WriteText(eol).WriteText("avg_tdiff_blobcopy" ).WriteText(is ).WriteNumber( m_EndState.avg_tdiff_blobcopy);
@@ -1001,6 +1051,18 @@ CNCStat::PrintToSocket(CSrvSocketTask* sock)
                     << g_ToSizeStr(m_WBMemSize.GetMaximum()) << ", releasable "
                     << g_ToSizeStr(m_WBReleasable.GetMaximum()) << ", releasing "
                     << g_ToSizeStr(m_WBReleasing.GetMaximum()) << endl;
+    proxy << "Hot cache - "
+                    << g_ToSizeStr(m_EndState.hot_size) << " in "
+                    << g_ToSmartStr(m_EndState.hot_blobs) << " blobs (avg "
+                    << g_ToSizeStr(m_HotSize.GetAverage()) << ", max "
+                    << g_ToSizeStr(m_HotSize.GetMaximum()) << ")" << endl;
+    proxy << "Hot cache reads - "
+                    << g_ToSmartStr(m_HotHits) << " hits ("
+                    << g_CalcStatPct(m_HotHits, m_HotHits + m_HotMisses) << "%, "
+                    << g_ToSizeStr(m_HotHitSize) << "), "
+                    << g_ToSmartStr(m_HotMisses) << " misses, "
+                    << g_ToSmartStr(m_HotAdmits) << " admitted, "
+                    << g_ToSmartStr(m_HotRejects) << " rejected" << endl;
     proxy << "Blob storage start - "
                     << m_StartState.cnt_another_server_main << " requests for alien blobs, "
                     << "blob update delay: "
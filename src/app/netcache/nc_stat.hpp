@@ -62,6 +62,8 @@ struct SNCStateStat
     size_t wb_size;
     size_t wb_releasable;
     size_t wb_releasing;
+    Uint8 hot_size;
+    Uint8 hot_blobs;
     Uint8  cnt_another_server_main;
     Uint8  avg_tdiff_blobcopy; // average time diff between blob creation time and the time it is sent to mirror
     Uint8  max_tdiff_blobcopy; // maximum time diff between blob creation time and the time it is sent to mirror
@@ -101,6 +103,9 @@ public:
     static void DiskDataWrite(size_t data_size);
     static void DiskDataRead(size_t data_size);
     static void DiskBlobWrite(Uint8 blob_size);
+    static void HotCacheHit(size_t data_size);
+    static void HotCacheMiss(void);
+    static void HotCacheAdmission(bool admitted);
     static void DBFileCleaned(bool success, Uint4 seen_recs,
                               Uint4 moved_recs, Uint4 moved_size);
     static void SaveCurStateStat(const SNCStateStat& state);
@@ -153,6 +158,11 @@ private:
     Uint8 m_DiskWrBlobs;
     Uint8 m_DiskWrBlobSize;
     vector<Uint8> m_DiskWrBySize;
+    Uint8 m_HotHits;
+    Uint8 m_HotHitSize;
+    Uint8 m_HotMisses;
+    Uint8 m_HotAdmits;
+    Uint8 m_HotRejects;
     Uint8 m_PeerSyncs;
     Uint8 m_PeerSynOps;
     Uint8 m_CntCleanedFiles;
@@ -176,6 +186,7 @@ private:
     CSrvStatTerm<size_t> m_WBMemSize;
     CSrvStatTerm<size_t> m_WBReleasable;
     CSrvStatTerm<size_t> m_WBReleasing;
+    CSrvStatTerm<Uint8> m_HotSize;
     auto_ptr<CSrvStat> m_SrvStat;
 };
 
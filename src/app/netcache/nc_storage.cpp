@@ -39,6 +39,8 @@
 #include "nc_db_files.hpp"
 #include "distribution_conf.hpp"
 #include "nc_storage_blob.hpp"
+#include "nc_hot_cache.hpp"
+#include "nc_sync_hashes.hpp"
 #include "sync_log.hpp"
 #include "nc_stat.hpp"
 #include "logging.hpp"
@@ -172,6 +174,8 @@ struct SBucketCache
 };
 typedef map<Uint2, SBucketCache*> TBucketCacheMap;
 
+typedef vector<CNCSyncHashTree*> TSlotSyncHashes;
+
 struct STimeTable
 {
     CMiniMutex lock;
@@ -258,6 +262,8 @@ static int s_LastFlushTime = 0;
 /// Internal cache of blobs identification information sorted to be able
 /// to search by key, subkey and version.
 static TBucketCacheMap s_BucketsCache;
+/// Hash trees of blobs for each slot, indexed by slot number.
+static TSlotSyncHashes s_SyncHashes;
 
 #if __NC_CACHEDATA_ALL_MONITOR
 static TAllCacheBuckets s_AllCache;
@@ -439,6 +445,12 @@ s_ReadVariableParams(const CNcbiRegistry& reg)
     SetWBWriteTimeout( CNCServer::IsInitiallySynced() ? to2 : to1, to2);
     SetWBFailedWriteDelay(reg.GetInt(kNCStorage_RegSection, "write_back_failed_delay", 2));
 
+    Uint8 hot_blob_size = NStr::StringToUInt8_DataSize(reg.GetString(
+                       kNCStorage_RegSection, "hot_cache_max_blob_size", "32 KB"));
+    CNCHotCache::SetLimits(NStr::StringToUInt8_DataSize(reg.GetString(
+                       kNCStorage_RegSection, "hot_cache_size", "256 MB")),
+                       Uint4(min(hot_blob_size, Uint8(kNCMaxBlobChunkSize))));
+
     int failed_write = reg.GetInt(kNCStorage_RegSection, kNCStorage_FailedWriteSize, 0);
     CNCBlobAccessor::SetFailedWriteCount((Uint4)failed_write);
     return true;
@@ -1133,6 +1145,7 @@ CNCBlobStorage::Initialize(bool do_reinit)
         s_AllWritings[i].cur_file = s_AllWritings[i].next_file = NULL;
     }
     s_DBFiles = new TNCDBFilesMap();
+    CNCHotCache::Initialize();
 
     if (!s_ReadStorageParams())
         return false;
@@ -1157,6 +1170,12 @@ CNCBlobStorage::Initialize(bool do_reinit)
         s_AllCache[i] = new  SAllCacheTable();
 #endif
     }
+    Uint2 cnt_slots = CNCDistributionConf::GetCntTimeBuckets()
+                      / CNCDistributionConf::GetCntSlotBuckets();
+    s_SyncHashes.resize(cnt_slots + 1, NULL);
+    for (Uint2 i = 1; i <= cnt_slots; ++i) {
+        s_SyncHashes[i] = new CNCSyncHashTree();
+    }
 
     s_BlobCounter.Set(0);
     if (!s_DBFiles->empty()) {
@@ -1235,6 +1254,10 @@ void CNCBlobStorage::WriteSetup(CSrvSocketTask& task)
     task.WriteText(eol).WriteText("write_back_hard_size_limit").WriteText(is ).WriteNumber( GetWBHardSizeLimit());
     task.WriteText(eol).WriteText("write_back_timeout"        ).WriteText(is ).WriteNumber( GetWBWriteTimeout());
     task.WriteText(eol).WriteText("write_back_failed_delay"   ).WriteText(is ).WriteNumber( GetWBFailedWriteDelay());
+    task.WriteText(eol).WriteText("hot_cache_size"            ).WriteText(str).WriteText(iss)
+                                                   .WriteText(NStr::UInt8ToString_DataSize( CNCHotCache::GetMaxSize())).WriteText(eos);
+    task.WriteText(eol).WriteText("hot_cache_size"            ).WriteText(is ).WriteNumber( CNCHotCache::GetMaxSize());
+    task.WriteText(eol).WriteText("hot_cache_max_blob_size"   ).WriteText(is ).WriteNumber( CNCHotCache::GetMaxBlobSize());
     task.WriteText(eol).WriteText(kNCStorage_FailedWriteSize  ).WriteText(is ).WriteNumber( CNCBlobAccessor::GetFailedWriteCount());
 }
 
@@ -1601,6 +1624,64 @@ CNCBlobStorage::PrintablePassword(const string& pass)
     return result;
 }
 
+/// FNV-1a hashing of arbitrary data
+static inline Uint8
+s_HashData(Uint8 hash, const void* data, size_t size)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= p[i];
+        hash *= NCBI_CONST_UINT8(0x100000001b3);
+    }
+    return hash;
+}
+
+static inline Uint8
+s_HashKey(const string& key)
+{
+    Uint8 hash = s_HashData(NCBI_CONST_UINT8(0xcbf29ce484222325),
+                            key.data(), key.size());
+    // Mix the bits so that leaf index taken from the upper bits is
+    // distributed well even for short keys.
+    hash ^= hash >> 33;
+    hash *= NCBI_CONST_UINT8(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/// Hash of the blob as it's used in the hash tree of the slot. It covers
+/// the same fields that are compared when blob lists are synchronized.
+/// Deleted and expired blobs don't contribute anything.
+static Uint8
+s_CalcSyncHash(const SNCCacheData* data)
+{
+    if (data->dead_time == 0)
+        return 0;
+
+    Uint8 hash = s_HashKey(data->key);
+    hash = s_HashData(hash, &data->create_time, sizeof(data->create_time));
+    hash = s_HashData(hash, &data->create_server, sizeof(data->create_server));
+    hash = s_HashData(hash, &data->create_id, sizeof(data->create_id));
+    hash = s_HashData(hash, &data->dead_time, sizeof(data->dead_time));
+    hash = s_HashData(hash, &data->expire, sizeof(data->expire));
+    hash = s_HashData(hash, &data->ver_expire, sizeof(data->ver_expire));
+    // Zero means "no contribution", avoid it for existing blobs.
+    return hash == 0? 1: hash;
+}
+
+static void
+s_SetSyncHash(SNCCacheData* data, Uint8 hash)
+{
+    if (data->sync_hash == hash)
+        return;
+
+    Uint2 slot = Uint2((data->time_bucket - 1)
+                       / CNCDistributionConf::GetCntSlotBuckets() + 1);
+    s_SyncHashes[slot]->Update(CNCBlobStorage::GetSyncHashLeaf(data->key),
+                               data->sync_hash, hash);
+    data->sync_hash = hash;
+}
+
 static SBucketCache*
 s_GetBucketCache(Uint2 bucket)
 {
@@ -1722,6 +1803,7 @@ CNCAlerts::Register(CNCAlerts::eDebugReleaseCacheData1, "ref_cnt is 0");
         cache->lock.Unlock();
         return;
     }
+    s_SetSyncHash(data, 0);
 #if __NC_CACHEDATA_INTR_SET
     size_t n = cache->key_map.erase(*data);
 #else
@@ -2251,7 +2333,8 @@ CNCBlobStorage::ReadChunkData(SNCBlobVerData* ver_data,
                               SNCChunkMaps* maps,
                               Uint8 chunk_num,
                               char*& buffer,
-                              Uint4& buf_size)
+                              Uint4& buf_size,
+                              CSrvRef<SNCDBFileInfo>* data_file_ref)
 {
     Uint2 map_idx[kNCMaxBlobMapsDepth] = {0};
     Uint1 cur_index = 0;
@@ -2368,6 +2451,8 @@ CNCAlerts::Register(CNCAlerts::eDebugReadChunkData4, "ReadChunkData: data_inf");
 
     buf_size = s_CalcChunkDataSize(data_ind->rec_size);
     buffer = (char*)data_rec->chunk_data;
+    if (data_file_ref)
+        *data_file_ref = data_file;
 
     return true;
 }
@@ -2431,6 +2516,18 @@ CNCAlerts::Register(CNCAlerts::eDebugWriteChunkData2,"s_GetNextWriteCoord");
     return (char*)data_rec->chunk_data;
 }
 
+Uint2
+CNCBlobStorage::GetSyncHashLeaf(const string& key)
+{
+    return CNCSyncHashTree::GetLeaf(s_HashKey(key));
+}
+
+void
+CNCBlobStorage::UpdateSyncHash(SNCCacheData* cache_data)
+{
+    s_SetSyncHash(cache_data, s_CalcSyncHash(cache_data));
+}
+
 void
 CNCBlobStorage::ChangeCacheDeadTime(SNCCacheData* cache_data)
 {
@@ -2617,7 +2714,9 @@ CNCBlobStorage::GetLatestBlobExpire(void)
 }
 
 void
-CNCBlobStorage::GetFullBlobsList(Uint2 slot, TNCBlobSumList& blobs_lst, const CNCPeerControl* peer)
+CNCBlobStorage::GetFullBlobsList(Uint2 slot, TNCBlobSumList& blobs_lst,
+                                 const CNCPeerControl* peer,
+                                 const TNCSyncHashLeaves* leaves)
 {
     blobs_lst.clear();
     Uint2 slot_buckets = CNCDistributionConf::GetCntSlotBuckets();
@@ -2636,13 +2735,20 @@ CNCBlobStorage::GetFullBlobsList(Uint2 slot, TNCBlobSumList& blobs_lst, const CN
 
         ITERATE(TKeyMap, it, cache->key_map) {
 #if __NC_CACHEDATA_INTR_SET
-            new (info_ptr) SNCTempBlobInfo(*it);
+            const SNCCacheData& cache_data = *it;
 #else
-            new (info_ptr) SNCTempBlobInfo(**it);
+            const SNCCacheData& cache_data = **it;
 #endif
+            if (leaves  &&  leaves->find(GetSyncHashLeaf(cache_data.key))
+                                                        == leaves->end())
+            {
+                continue;
+            }
+            new (info_ptr) SNCTempBlobInfo(cache_data);
             ++info_ptr;
         }
         cache->lock.Unlock();
+        cnt_blobs = info_ptr - (SNCTempBlobInfo*)big_block;
 
         info_ptr = (SNCTempBlobInfo*)big_block;
         for (Uint8 i = 0; i < cnt_blobs; ++i) {
@@ -2680,6 +2786,16 @@ CNCBlobStorage::GetFullBlobsList(Uint2 slot, TNCBlobSumList& blobs_lst, const CN
     }
 }
 
+void
+CNCBlobStorage::GetSyncHashes(Uint2 slot, const vector<Uint2>& nodes,
+                              vector<Uint8>& hashes)
+{
+    if (slot == 0  ||  slot >= s_SyncHashes.size())
+        return;
+
+    s_SyncHashes[slot]->GetHashes(nodes, hashes);
+}
+
 void
 CNCBlobStorage::MeasureDB(SNCStateStat& state)
 {
@@ -3005,6 +3121,7 @@ CBlobCacher::x_CacheMetaRec(SNCDBFileInfo* file_info,
         bucket_cache->key_map.erase(old_data);
         bucket_cache->key_map.insert(cache_data);
 #endif
+        s_SetSyncHash(old_data, 0);
 #if __NC_CACHEDATA_ALL_MONITOR
         s_AllCache[time_bucket]->all_cache_set.erase(old_data);
 #endif
@@ -3043,6 +3160,7 @@ CBlobCacher::x_CacheMetaRec(SNCDBFileInfo* file_info,
     s_AllCache[time_bucket]->all_cache_set.insert(cache_data);
 #endif
     ++s_CurBlobsCnt;
+    CNCBlobStorage::UpdateSyncHash(cache_data);
 
     return true;
 }
@@ -3507,6 +3625,8 @@ CExpiredCleaner::x_DeleteNextData(void)
     Uint2 map_size = cache_data->map_size;
     cache_data->coord.clear();
     cache_data->dead_time = 0;
+    CNCBlobStorage::UpdateSyncHash(cache_data);
+    CNCHotCache::Remove(cache_data->key);
     CNCBlobVerManager* mgr = cache_data->Get_ver_mgr();
     if (mgr) {
         mgr->ObtainReference();
@@ -63,6 +63,8 @@ public:
     SNCDataCoord coord;
     string key;
     int saved_dead_time;
+    /// Value this blob currently contributes to the hash tree of its slot
+    Uint8 sync_hash;
     Uint2 time_bucket;
     Uint2 map_size;
     Uint4 chunk_size;
@@ -133,7 +135,18 @@ public:
     static void MeasureDB(SNCStateStat& state);
 
     static int GetLatestBlobExpire(void);
-    static void GetFullBlobsList(Uint2 slot, TNCBlobSumList& blobs_lst, const CNCPeerControl* peer);
+    /// Get list of all blobs in the slot. If leaves is not NULL then only
+    /// blobs belonging to the given leaves of slot's hash tree are listed.
+    static void GetFullBlobsList(Uint2 slot, TNCBlobSumList& blobs_lst,
+                                 const CNCPeerControl* peer,
+                                 const TNCSyncHashLeaves* leaves = NULL);
+    /// Get hashes of all children of the given nodes in the hash tree of
+    /// the slot (see kNCSyncHashFanout for nodes numbering). Hashes are
+    /// appended to the vector in order of nodes.
+    static void GetSyncHashes(Uint2 slot, const vector<Uint2>& nodes,
+                              vector<Uint8>& hashes);
+    /// Get index of the leaf in slot's hash tree the key belongs to.
+    static Uint2 GetSyncHashLeaf(const string& key);
     static Uint8 GetMaxSyncLogRecNo(void);
     static void SaveMaxSyncLogRecNo(void);
 
@@ -160,11 +173,16 @@ public:
     static void DeleteBlobInfo(const SNCBlobVerData* ver_data,
                                SNCChunkMaps* maps);
 
+    /// Find chunk data in database. Buffer is set to point to the chunk
+    /// inside memory-mapped database file. If data_file is not NULL it is
+    /// set to the file containing the chunk, so that caller can keep it
+    /// referenced and send data directly from file descriptor.
     static bool ReadChunkData(SNCBlobVerData* ver_data,
                               SNCChunkMaps* maps,
                               Uint8 chunk_num,
                               char*& buffer,
-                              Uint4& buf_size);
+                              Uint4& buf_size,
+                              CSrvRef<SNCDBFileInfo>* data_file = NULL);
     static char* WriteChunkData(SNCBlobVerData* ver_data,
                                 SNCChunkMaps* maps,
                                 SNCCacheData* cache_data,
@@ -175,6 +193,9 @@ public:
     static void ReferenceCacheData(SNCCacheData* cache_data);
     static void ReleaseCacheData(SNCCacheData* cache_data);
     static void ChangeCacheDeadTime(SNCCacheData* cache_data);
+    /// Update contribution of the blob into the hash tree of its slot after
+    /// blob summary has changed. Should be called with cache_data->lock held.
+    static void UpdateSyncHash(SNCCacheData* cache_data);
 
 private:
     CNCBlobStorage(void);
@@ -188,6 +209,7 @@ private:
 inline
 SNCCacheData::SNCCacheData(void)
     : saved_dead_time(0),
+      sync_hash(0),
       time_bucket(0),
       map_size(0),
       chunk_size(0),
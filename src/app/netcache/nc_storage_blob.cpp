@@ -54,6 +54,9 @@ static size_t s_WBHardSizeLimit = NCBI_CONST_UINT8(3000000000);
 static int s_WBWriteTimeout = 1000;
 static int s_WBWriteTimeout2 = 1000;
 static Uint2 s_WBFailedWriteDelay = 2;
+/// Minimum amount of data left in the chunk for which it's worth looking
+/// for chunk's location in database file to send data directly from it.
+static const Uint4 kNCMinFileReadSize = 16 * 1024;
 
 static ssize_t s_WBCurSize = 0;
 static ssize_t s_WBReleasableSize = 0;
@@ -598,6 +601,8 @@ CNCBlobVerManager::x_DeleteCurVersion(void)
     m_CacheData->dead_time = 0;
     CNCBlobStorage::ChangeCacheDeadTime(m_CacheData);
     m_CacheData->expire = 0;
+    CNCBlobStorage::UpdateSyncHash(m_CacheData);
+    CNCHotCache::Remove(m_Key);
     if (m_CurVersion) {
         m_CurVersion->SetNotCurrent();
         m_CurVersion.Reset();
@@ -916,6 +921,8 @@ CNCBlobVerManager::FinalizeWriting(SNCBlobVerData* ver_data)
         &&  s_IsCurVerOlder(m_CurVersion, ver_data))
     {
         old_ver.Swap(m_CurVersion);
+        if (old_ver  ||  !m_CacheData->coord.empty())
+            CNCHotCache::Remove(m_Key);
         m_CacheData->coord = m_CurVersion->coord;
         m_CacheData->dead_time = m_CurVersion->dead_time;
         if (m_CacheData->saved_dead_time != m_CacheData->dead_time) {
@@ -929,6 +936,7 @@ CNCBlobVerManager::FinalizeWriting(SNCBlobVerData* ver_data)
         m_CacheData->size = m_CurVersion->size;
         m_CacheData->chunk_size = m_CurVersion->chunk_size;
         m_CacheData->map_size = m_CurVersion->map_size;
+        CNCBlobStorage::UpdateSyncHash(m_CacheData);
 
         m_CurVersion->meta_has_changed = true;
         m_CurVersion->last_access_time = CSrvTime::CurSecs();
@@ -951,6 +959,7 @@ CNCBlobVerManager::DeadTimeChanged(SNCBlobVerData* ver_data)
     m_CacheData->lock.Lock();
     if (m_CurVersion == ver_data) {
         m_CacheData->dead_time = ver_data->dead_time;
+        CNCBlobStorage::UpdateSyncHash(m_CacheData);
 
         m_CurVersion->last_access_time = CSrvTime::CurSecs();
         m_CurVersion->need_write_time = m_CurVersion->last_access_time
@@ -1462,7 +1471,8 @@ CNCBlobAccessor::CNCBlobAccessor(void)
     : m_ChunkMaps(NULL),
       m_MetaInfoReady(false),
       m_WriteMemRequested(false),
-      m_Buffer(NULL)
+      m_Buffer(NULL),
+      m_ChunkFileBuf(NULL)
 {
 #if __NC_TASKS_MONITOR
     m_TaskName = "CNCBlobAccessor";
@@ -1519,6 +1529,9 @@ CNCBlobAccessor::Deinitialize(void)
             delete m_ChunkMaps;
             m_ChunkMaps = NULL;
         }
+        m_ChunkFile.Reset();
+        m_ChunkFileBuf = NULL;
+        m_HotBlob.Reset();
         break;
     case eNCCreate:
     case eNCCopyCreate:
@@ -1604,7 +1617,8 @@ CNCBlobAccessor::GetReadMemSize(void)
     }
     if (m_Buffer) {
         if (m_ChunkPos < m_ChunkSize) {
-            m_Buffer = m_CurData->chunks[m_CurChunk];
+            if (!m_HotBlob)
+                m_Buffer = m_CurData->chunks[m_CurChunk];
             return m_ChunkSize - m_ChunkPos;
         }
         ++m_CurChunk;
@@ -1615,18 +1629,33 @@ CNCBlobAccessor::GetReadMemSize(void)
     if (need_size > m_CurData->chunk_size)
         need_size = m_CurData->chunk_size;
 
+    m_ChunkFile.Reset();
+    m_ChunkFileBuf = NULL;
+    SNCHotBlobVer hot_ver(m_CurData);
+    bool can_cache = CNCHotCache::CanCache(hot_ver);
     m_Buffer = ACCESS_ONCE(m_CurData->chunks[m_CurChunk]);
     if (m_Buffer) {
+        if (can_cache)
+            CNCHotCache::Touch(m_BlobKey);
         m_ChunkSize = Uint4(need_size);
         return m_ChunkSize - m_ChunkPos;
     }
+    if (can_cache) {
+        m_HotBlob = CNCHotCache::Get(m_BlobKey, hot_ver);
+        if (m_HotBlob) {
+            // Data is not in database file, so it will be sent from memory
+            m_Buffer = m_ChunkFileBuf = m_HotBlob->data;
+            m_ChunkSize = Uint4(need_size);
+            return m_ChunkSize - m_ChunkPos;
+        }
+    }
 
     if (!m_ChunkMaps) {
         m_ChunkMaps = new SNCChunkMaps(m_CurData->map_size);
         s_AddCurrentMem(s_CalcChunkMapsSize(m_CurData->map_size));
     }
     if (!CNCBlobStorage::ReadChunkData(m_CurData, m_ChunkMaps, m_CurChunk,
-                                       m_Buffer, m_ChunkSize))
+                                       m_Buffer, m_ChunkSize, &m_ChunkFile))
     {
         x_DelCorruptedVersion();
         return 0;
@@ -1637,9 +1666,56 @@ CNCBlobAccessor::GetReadMemSize(void)
     }
 
     ACCESS_ONCE(m_CurData->chunks[m_CurChunk]) = m_Buffer;
+    m_ChunkFileBuf = m_Buffer;
+    if (can_cache)
+        CNCHotCache::Put(m_BlobKey, hot_ver, m_Buffer);
     return m_ChunkSize - m_ChunkPos;
 }
 
+bool
+CNCBlobAccessor::GetReadFileCoord(TFileHandle& fd, Uint8& offset)
+{
+    if (m_Buffer != m_ChunkFileBuf) {
+        // Chunk was taken from memory or it could be moved to another place
+        // since it was read. Chunk can be found in database files only when
+        // the whole blob is written there (until then blob's maps are not
+        // complete).
+        m_ChunkFile.Reset();
+        m_ChunkFileBuf = m_Buffer;
+        if (m_CurData->coord.empty()
+            ||  m_CurData->cur_chunk_num <= m_CurChunk
+            ||  m_ChunkSize - m_ChunkPos < kNCMinFileReadSize)
+        {
+            return false;
+        }
+        if (!m_ChunkMaps) {
+            m_ChunkMaps = new SNCChunkMaps(m_CurData->map_size);
+            s_AddCurrentMem(s_CalcChunkMapsSize(m_CurData->map_size));
+        }
+        char* buffer = NULL;
+        Uint4 buf_size = 0;
+        if (!CNCBlobStorage::ReadChunkData(m_CurData, m_ChunkMaps, m_CurChunk,
+                                           buffer, buf_size, &m_ChunkFile)
+            ||  buffer != m_Buffer)
+        {
+            m_ChunkFile.Reset();
+            return false;
+        }
+    }
+    if (!m_ChunkFile)
+        return false;
+
+    char* file_map = m_ChunkFile->file_map;
+    if (!file_map  ||  m_Buffer < file_map
+        ||  m_Buffer + m_ChunkSize > file_map + m_ChunkFile->file_size)
+    {
+        return false;
+    }
+    fd = m_ChunkFile->fd;
+    offset = Uint8(m_Buffer - file_map) + m_ChunkPos;
+    return true;
+}
+
 void
 CNCBlobAccessor::MoveReadPos(Uint4 move_size)
 {
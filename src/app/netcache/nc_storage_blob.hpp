@@ -30,6 +30,7 @@
 
 
 #include "nc_db_info.hpp"
+#include "nc_hot_cache.hpp"
 
 
 BEGIN_NCBI_SCOPE
@@ -134,6 +135,10 @@ public:
     Uint8 GetPosition(void);
     Uint4 GetReadMemSize(void);
     const void* GetReadMemPtr(void);
+    /// Get file descriptor and offset in it corresponding to the current
+    /// read position. Returns FALSE if current chunk is not known to be
+    /// located in database file (e.g. it is still in write-back memory).
+    bool GetReadFileCoord(TFileHandle& fd, Uint8& offset);
     void MoveReadPos(Uint4 move_size);
     unsigned int GetCurBlobTTL(void) const;
     unsigned int GetNewBlobTTL(void) const;
@@ -247,6 +252,11 @@ private:
     Uint4       m_ChunkSize;
     Uint8       m_SizeRead;
     char*       m_Buffer;
+    /// Database file containing current chunk if it was read from disk
+    CSrvRef<SNCDBFileInfo> m_ChunkFile;
+    char*       m_ChunkFileBuf;
+    /// Copy of blob's data from hot blobs cache if it was found there
+    CSrvRef<SNCHotBlob> m_HotBlob;
     CSrvTask*   m_Owner;
 };
 
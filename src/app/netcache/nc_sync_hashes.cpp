@@ -0,0 +1,101 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ */
+
+#include "nc_pch.hpp"
+
+#include "nc_db_info.hpp"
+#include "nc_utils.hpp"
+#include "nc_sync_hashes.hpp"
+
+
+BEGIN_NCBI_SCOPE
+
+
+CNCSyncHashTree::CNCSyncHashTree(void)
+{
+    memset(m_Leaves, 0, sizeof(m_Leaves));
+}
+
+void
+CNCSyncHashTree::Update(Uint2 leaf, Uint8 old_hash, Uint8 new_hash)
+{
+    m_Lock.Lock();
+    m_Leaves[leaf] ^= old_hash ^ new_hash;
+    m_Lock.Unlock();
+}
+
+void
+CNCSyncHashTree::GetHashes(const vector<Uint2>& nodes, vector<Uint8>& hashes)
+{
+    m_Lock.Lock();
+    ITERATE(vector<Uint2>, it, nodes) {
+        // Find the level of the node and the range of leaves below it.
+        Uint2 level_start = 0, level_size = 1;
+        Uint2 node_leaves = kNCSyncHashLeaves;
+        while (*it >= level_start + level_size  &&  node_leaves > 1) {
+            level_start += level_size;
+            level_size *= kNCSyncHashFanout;
+            node_leaves /= kNCSyncHashFanout;
+        }
+        if (node_leaves == 1)
+            continue;
+
+        Uint2 child_leaves = node_leaves / kNCSyncHashFanout;
+        const Uint8* leaf = m_Leaves + (*it - level_start) * node_leaves;
+        for (Uint2 i = 0; i < kNCSyncHashFanout; ++i) {
+            Uint8 hash = 0;
+            for (Uint2 j = 0; j < child_leaves; ++j, ++leaf) {
+                hash ^= *leaf;
+            }
+            hashes.push_back(hash);
+        }
+    }
+    m_Lock.Unlock();
+}
+
+void
+CNCSyncHashTree::Compare(const vector<Uint2>& nodes,
+                         const vector<Uint8>& local_hashes,
+                         const vector<Uint8>& remote_hashes,
+                         vector<Uint2>& next_nodes,
+                         TNCSyncHashLeaves& diff_leaves)
+{
+    for (size_t i = 0; i < remote_hashes.size(); ++i) {
+        if (local_hashes[i] == remote_hashes[i])
+            continue;
+
+        Uint2 child = Uint2(nodes[i / kNCSyncHashFanout] * kNCSyncHashFanout
+                            + i % kNCSyncHashFanout + 1);
+        if (child >= kNCSyncHashFirstLeaf)
+            diff_leaves.insert(child - kNCSyncHashFirstLeaf);
+        else
+            next_nodes.push_back(child);
+    }
+}
+
+END_NCBI_SCOPE
@@ -0,0 +1,82 @@
+#ifndef NETCACHE__NC_SYNC_HASHES__HPP
+#define NETCACHE__NC_SYNC_HASHES__HPP
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description: Hash tree of blobs in one slot used by periodic sync
+ */
+
+
+BEGIN_NCBI_SCOPE
+
+
+/// Hash tree of blobs in one slot (see kNCSyncHashFanout for its shape).
+/// Only leaves are stored, each leaf is XOR of hashes of all blobs belonging
+/// to it, so the tree doesn't depend on the order of blob changes. Hashes
+/// of other nodes are calculated when requested.
+class CNCSyncHashTree
+{
+public:
+    CNCSyncHashTree(void);
+
+    /// Leaf the blob with the given hash of its key belongs to
+    static Uint2 GetLeaf(Uint8 key_hash);
+    /// Replace contribution of a blob to the leaf. Zero hash means no
+    /// contribution, i.e. writing a blob changes it from zero and deleting
+    /// changes it to zero.
+    void Update(Uint2 leaf, Uint8 old_hash, Uint8 new_hash);
+    /// Append to hashes the hashes of all children of each of the nodes.
+    /// Leaves among the nodes are skipped.
+    void GetHashes(const vector<Uint2>& nodes, vector<Uint8>& hashes);
+
+    /// Compare hashes of children of the nodes obtained from two trees by
+    /// GetHashes(). Children that differ are added to next_nodes to be
+    /// compared at the next level, or to diff_leaves if they are leaves.
+    static void Compare(const vector<Uint2>& nodes,
+                        const vector<Uint8>& local_hashes,
+                        const vector<Uint8>& remote_hashes,
+                        vector<Uint2>& next_nodes,
+                        TNCSyncHashLeaves& diff_leaves);
+
+private:
+    CNCSyncHashTree(const CNCSyncHashTree&);
+    CNCSyncHashTree& operator= (const CNCSyncHashTree&);
+
+    CMiniMutex m_Lock;
+    Uint8      m_Leaves[kNCSyncHashLeaves];
+};
+
+
+inline Uint2
+CNCSyncHashTree::GetLeaf(Uint8 key_hash)
+{
+    return Uint2(key_hash >> 52) % kNCSyncHashLeaves;
+}
+
+END_NCBI_SCOPE
+
+#endif /* NETCACHE__NC_SYNC_HASHES__HPP */
@@ -56,6 +56,7 @@ typedef map<string, string> TStringMap;
 typedef map<Uint8, string>  TNCPeerList;
 typedef vector<Uint8>       TServersList;
 typedef CSimpleBufferT<char> TNCBufferType;
+typedef set<Uint2>           TNCSyncHashLeaves;
 
 
 /// Type of access to NetCache blob
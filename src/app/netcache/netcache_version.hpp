@@ -40,7 +40,7 @@
 #define NETCACHED_STORAGE_VERSION_MINOR 3
 #define NETCACHED_STORAGE_VERSION_PATCH 0
 #define NETCACHED_PROTOCOL_VERSION_MAJOR 6
-#define NETCACHED_PROTOCOL_VERSION_MINOR 9
+#define NETCACHED_PROTOCOL_VERSION_MINOR 10
 #define NETCACHED_PROTOCOL_VERSION_PATCH 0
 #define NETCACHED_STORAGE_VERSION                           \
     BOOST_STRINGIZE(NETCACHED_STORAGE_VERSION_MAJOR) "."    \
@@ -47,6 +47,7 @@
 #include "sync_log.hpp"
 #include "peer_control.hpp"
 #include "nc_storage.hpp"
+#include "nc_hot_cache.hpp"
 #include "active_handler.hpp"
 #include "periodic_sync.hpp"
 #include "nc_storage_blob.hpp"
@@ -967,6 +968,7 @@ CNCServer::ReadCurState(SNCStateStat& state)
     CNCPeerControl::ReadCurState(state);
     state.sync_log_size = CNCSyncLog::GetLogSize();
     CWriteBackControl::ReadState(state);
+    CNCHotCache::ReadState(state);
 }
 
 bool s_ReportPid(const string& pid_file)
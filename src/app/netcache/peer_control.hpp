@@ -171,6 +171,7 @@ public:
     bool AcceptsSyncRemove(void) const;
     bool AcceptsBlobKey(const CNCBlobKeyLight& key) const;
     bool AcceptsBList(void) const;
+    bool AcceptsSyncHashes(void) const;
 
 private:
     CNCPeerControl(Uint8 srv_id);
@@ -298,6 +299,12 @@ CNCPeerControl::AcceptsBList(void) const
     return m_HostProtocol >= 60900;
 }
 
+inline bool
+CNCPeerControl::AcceptsSyncHashes(void) const
+{
+    return m_HostProtocol >= 61000;
+}
+
 inline void
 CNCPeerControl::ConnOk(void)
 {
@@ -41,6 +41,7 @@
 #include "peer_control.hpp"
 #include "active_handler.hpp"
 #include "nc_storage.hpp"
+#include "nc_sync_hashes.hpp"
 #include "nc_stat.hpp"
 
 
@@ -58,6 +59,11 @@ static CNCLogCleaner* s_LogCleaner;
 
 static FILE* s_LogFile = NULL;
 
+/// Maximum number of hash tree nodes or leaves sent to peer in one command.
+/// Command line should fit into peer's socket read buffer. When more nodes
+/// differ full blob lists are compared.
+static const size_t kNCMaxSyncHashNodes = 128;
+
 
 template <typename Type> void
 s_ShuffleList( vector<Type>& lst)
@@ -774,6 +780,8 @@ CNCActiveSyncControl::x_DoPeriodicSync(void)
     m_Hint = NC_SYNC_HINT;
     m_Progress = 0;
     m_SlotSrv->is_by_blobs = false;
+    m_ByHashes = false;
+    m_FilterByLeaves = false;
     m_StartedCmds = 0;
     m_FinishSyncCalled = false;
     m_NextTask = eSynNoTask;
@@ -828,8 +836,11 @@ CNCActiveSyncControl::x_WaitSyncStarted(void)
     m_RemoteSyncedRecNo = 0;
     m_SlotSrv->last_active_time = CSrvTime::CurSecs();
     // depending on the reply
-    if (m_SlotSrv->is_by_blobs)
+    if (m_SlotSrv->is_by_blobs) {
+        if (m_ByHashes)
+            return &CNCActiveSyncControl::x_PrepareSyncByHashes;
         return &CNCActiveSyncControl::x_PrepareSyncByBlobs;
+    }
     else
         return &CNCActiveSyncControl::x_PrepareSyncByEvents;
 }
@@ -939,7 +950,8 @@ CNCActiveSyncControl::x_FinishSync(void)
     }
 
     CSrvDiagMsg().PrintExtra()
-                 .PrintParam("sync", (m_SlotSrv->is_by_blobs? "blobs": "events"))
+                 .PrintParam("sync", (m_SlotSrv->is_by_blobs?
+                                      (m_FilterByLeaves? "hashes": "blobs"): "events"))
                  .PrintParam("r_ok", m_ReadOK)
                  .PrintParam("r_err", m_ReadERR)
                  .PrintParam("w_ok", m_WriteOK)
@@ -1010,6 +1022,91 @@ CNCActiveSyncControl::x_PrepareSyncByEvents(void)
 
     // sync by blob list
     m_SlotSrv->is_by_blobs = true;
+    if (m_SlotSrv->peer->AcceptsSyncHashes())
+        return &CNCActiveSyncControl::x_PrepareSyncByHashes;
+    return &CNCActiveSyncControl::x_RequestBlobList;
+}
+
+CNCActiveSyncControl::State
+CNCActiveSyncControl::x_PrepareSyncByHashes(void)
+{
+    // Only events logged before hash trees are compared can be considered
+    // synchronized after that.
+    m_HashLocalRecNo = CNCSyncLog::GetCurrentRecNo(m_Slot);
+    m_HashRemoteRecNo = m_RemoteStartRecNo;
+    m_DiffLeaves.clear();
+    m_HashNodes.assign(1, 0);
+    return &CNCActiveSyncControl::x_RequestHashes;
+}
+
+CNCActiveSyncControl::State
+CNCActiveSyncControl::x_RequestHashes(void)
+{
+    CNCActiveHandler* conn = m_SlotSrv->peer->GetBGConn();
+    if (!conn) {
+        m_Result = eSynNetworkError;
+        m_Hint = NC_SYNC_HINT;
+        return &CNCActiveSyncControl::x_FinishSync;
+    }
+
+    m_RemoteHashes.clear();
+    m_StartedCmds = 1;
+    conn->SyncHashes(this, m_HashNodes);
+    m_SlotSrv->last_active_time = CSrvTime::CurSecs();
+    return &CNCActiveSyncControl::x_WaitForHashes;
+}
+
+CNCActiveSyncControl::State
+CNCActiveSyncControl::x_WaitForHashes(void)
+{
+    if (m_StartedCmds != 0) {
+        return NULL;
+    }
+    if (CTaskServer::IsInShutdown()) {
+        m_Result = eSynAborted;
+        m_Hint = NC_SYNC_HINT;
+    }
+    if (m_Result != eSynOK)
+        return &CNCActiveSyncControl::x_FinishSync;
+
+    m_SlotSrv->last_active_time = CSrvTime::CurSecs();
+    if (m_RemoteHashes.size() != m_HashNodes.size() * kNCSyncHashFanout) {
+        SRV_LOG(Warning, "Peer " << CNCDistributionConf::GetFullPeerName(m_SrvId)
+                         << " returned " << m_RemoteHashes.size()
+                         << " hashes instead of "
+                         << m_HashNodes.size() * kNCSyncHashFanout);
+        return &CNCActiveSyncControl::x_RequestBlobList;
+    }
+
+    vector<Uint8> local_hashes;
+    local_hashes.reserve(m_RemoteHashes.size());
+    CNCBlobStorage::GetSyncHashes(m_Slot, m_HashNodes, local_hashes);
+
+    vector<Uint2> next_nodes;
+    CNCSyncHashTree::Compare(m_HashNodes, local_hashes, m_RemoteHashes,
+                             next_nodes, m_DiffLeaves);
+    if (next_nodes.size() > kNCMaxSyncHashNodes
+        ||  m_DiffLeaves.size() > kNCMaxSyncHashNodes)
+    {
+        // Too much is different, it's easier to compare full lists.
+        return &CNCActiveSyncControl::x_RequestBlobList;
+    }
+    if (!next_nodes.empty()) {
+        m_HashNodes.swap(next_nodes);
+        return &CNCActiveSyncControl::x_RequestHashes;
+    }
+
+    m_FilterByLeaves = true;
+    if (m_DiffLeaves.empty()) {
+        // Slots are the same on both servers, nothing to compare.
+        return &CNCActiveSyncControl::x_PrepareSyncByBlobs;
+    }
+    return &CNCActiveSyncControl::x_RequestBlobList;
+}
+
+CNCActiveSyncControl::State
+CNCActiveSyncControl::x_RequestBlobList(void)
+{
     CNCActiveHandler* conn = m_SlotSrv->peer->GetBGConn();
     if (!conn) {
         m_Result = eSynNetworkError;
@@ -1019,7 +1116,7 @@ CNCActiveSyncControl::x_PrepareSyncByEvents(void)
 
     // request blob list
     m_StartedCmds = 1;
-    conn->SyncBlobsList(this);
+    conn->SyncBlobsList(this, m_FilterByLeaves? &m_DiffLeaves: NULL);
     m_SlotSrv->last_active_time = CSrvTime::CurSecs();
     return &CNCActiveSyncControl::x_WaitForBlobList;
 }
@@ -1043,15 +1140,22 @@ CNCActiveSyncControl::x_WaitForBlobList(void)
 CNCActiveSyncControl::State
 CNCActiveSyncControl::x_PrepareSyncByBlobs(void)
 {
-    m_LocalSyncedRecNo = CNCSyncLog::GetCurrentRecNo(m_Slot);
-    m_RemoteSyncedRecNo = m_RemoteStartRecNo;
+    if (m_FilterByLeaves) {
+        m_LocalSyncedRecNo = m_HashLocalRecNo;
+        m_RemoteSyncedRecNo = m_HashRemoteRecNo;
+    }
+    else {
+        m_LocalSyncedRecNo = CNCSyncLog::GetCurrentRecNo(m_Slot);
+        m_RemoteSyncedRecNo = m_RemoteStartRecNo;
+    }
     m_SlotSrv->last_active_time = CSrvTime::CurSecs();
 
     ITERATE(TNCBlobSumList, it, m_LocalBlobs) {
         delete it->second;
     }
     m_LocalBlobs.clear();
-    CNCBlobStorage::GetFullBlobsList(m_Slot, m_LocalBlobs, NULL);
+    CNCBlobStorage::GetFullBlobsList(m_Slot, m_LocalBlobs, NULL,
+                                     m_FilterByLeaves? &m_DiffLeaves: NULL);
 
     m_CurLocalBlob = m_LocalBlobs.begin();
     m_CurRemoteBlob = m_RemoteBlobs.begin();
@@ -262,9 +262,11 @@ public:
     virtual ~CNCActiveSyncControl(void);
 
     Uint2 GetSyncSlot(void);
-    void StartResponse(Uint8 local_rec_no, Uint8 remote_rec_no, bool by_blobs);
+    void StartResponse(Uint8 local_rec_no, Uint8 remote_rec_no,
+                       bool by_blobs, bool by_hashes);
     bool AddStartEvent(SNCSyncEvent* evt);
     bool AddStartBlob(const string& key, SNCBlobSummary* blob_sum);
+    bool AddRemoteHash(Uint8 hash);
     bool GetNextTask(SSyncTaskInfo& task_info, bool* is_valid = nullptr);
     void ExecuteSyncTask(const SSyncTaskInfo& task_info, CNCActiveHandler* conn);
     void CmdFinished(ESyncResult res, ESynActionType action, CNCActiveHandler* conn, int hint);
@@ -284,6 +286,10 @@ private:
     State x_DoPeriodicSync(void);
     State x_WaitSyncStarted(void);
     State x_PrepareSyncByEvents(void);
+    State x_PrepareSyncByHashes(void);
+    State x_RequestHashes(void);
+    State x_WaitForHashes(void);
+    State x_RequestBlobList(void);
     State x_WaitForBlobList(void);
     State x_PrepareSyncByBlobs(void);
     State x_ExecuteSyncCommands(void);
@@ -326,6 +332,20 @@ private:
     TNCBlobSumList m_RemoteBlobs;
     TBlobsListIt   m_CurLocalBlob;
     TBlobsListIt   m_CurRemoteBlob;
+    /// Nodes of slot's hash tree which children are compared now
+    vector<Uint2>  m_HashNodes;
+    /// Hashes of children of m_HashNodes received from peer
+    vector<Uint8>  m_RemoteHashes;
+    /// Leaves of slot's hash tree which differ between servers
+    TNCSyncHashLeaves m_DiffLeaves;
+    /// Record numbers current when comparison of hash trees started
+    Uint8 m_HashLocalRecNo;
+    Uint8 m_HashRemoteRecNo;
+    /// Peer won't send blob list without request, hash trees should be
+    /// compared first
+    bool m_ByHashes;
+    /// Blob lists are restricted to m_DiffLeaves
+    bool m_FilterByLeaves;
     Uint8   m_ReadOK;
     Uint8   m_ReadERR;
     Uint8   m_WriteOK;
@@ -379,11 +399,13 @@ CNCActiveSyncControl::GetSyncSlot(void)
 inline void
 CNCActiveSyncControl::StartResponse(Uint8 local_rec_no,
                                     Uint8 remote_rec_no,
-                                    bool by_blobs)
+                                    bool by_blobs,
+                                    bool by_hashes)
 {
     m_LocalStartRecNo = local_rec_no;
     m_RemoteStartRecNo = remote_rec_no;
     m_SlotSrv->is_by_blobs = by_blobs;
+    m_ByHashes = by_hashes;
 }
 
 inline bool
@@ -409,6 +431,16 @@ CNCActiveSyncControl::AddStartBlob(const string& key, SNCBlobSummary* blob_sum)
     return true;
 }
 
+inline bool
+CNCActiveSyncControl::AddRemoteHash(Uint8 hash)
+{
+    if (m_Result != eSynOK) {
+        return false;
+    }
+    m_RemoteHashes.push_back(hash);
+    return true;
+}
+
 END_NCBI_SCOPE
 
 
@@ -45,6 +45,7 @@
 # include <arpa/inet.h>
 # include <netdb.h>
 # include <sys/epoll.h>
+# include <sys/sendfile.h>
 # include <unistd.h>
 # include <fcntl.h>
 # include <errno.h>
@@ -162,6 +163,7 @@ int s_HardSocketLimit = 0;
 static int s_SocketTimeout = 0;
 static Uint1 s_OldSocksDelBatch = 0;
 static Uint8 s_ConnTimeout = 10;
+static bool s_UseSendfile = true;
 static string s_HostName;
 
 
@@ -183,6 +185,7 @@ ConfigureSockets(CNcbiRegistry* reg, CTempString section)
     s_OldSocksDelBatch = Uint1(reg->GetInt(section, "sockets_cleaning_batch", 10));
     if (s_OldSocksDelBatch < 10)
         s_OldSocksDelBatch = 10;
+    s_UseSendfile = reg->GetBool(section, "use_sendfile", true);
 }
 
 void
@@ -888,6 +891,59 @@ retry:
     return size_t(n_written);
 }
 
+static size_t
+s_SendFileToSocket(CSrvSocketTask* task, int fd, Uint8 offset,
+                   const void* buf, size_t size)
+{
+    if (!task->m_SockCanWrite  &&  task->m_SeenWriteEvts == task->m_RegWriteEvts)
+        return 0;
+    if (size == 0)
+        return 0;
+
+    Uint1 prev_seen = task->m_SeenWriteEvts;
+    task->m_SeenWriteEvts = task->m_RegWriteEvts;
+    ssize_t n_written = 0;
+#ifdef NCBI_OS_LINUX
+    off_t file_pos = off_t(offset);
+retry:
+    n_written = sendfile(task->m_Fd, fd, &file_pos, size);
+    if (n_written == -1) {
+        int x_errno = errno;
+        if (x_errno == EINTR)
+            goto retry;
+        if (x_errno == EAGAIN  ||  x_errno == EWOULDBLOCK)
+            return 0;
+        if (x_errno == EINVAL  ||  x_errno == ENOSYS) {
+            // File system or kernel doesn't support sendfile() for this
+            // file. Data is available in memory too, so we can always
+            // fall back to usual send().
+            LOG_WITH_ERRNO(Warning, "sendfile() is not supported, disabling it",
+                           x_errno);
+            s_UseSendfile = false;
+            task->m_SeenWriteEvts = prev_seen;
+            return s_WriteToSocket(task, buf, size);
+        }
+        LOG_WITH_ERRNO(Warning, "Error writing to socket", x_errno);
+        task->m_RegError = true;
+        n_written = 0;
+    }
+    else if (n_written == 0) {
+        // Nothing could be read from file at given offset -- it shouldn't
+        // happen, but we can still send data from memory.
+        task->m_SeenWriteEvts = prev_seen;
+        return s_WriteToSocket(task, buf, size);
+    }
+#else
+    // There's no sendfile() here, data is sent from memory.
+    task->m_SeenWriteEvts = prev_seen;
+    return s_WriteToSocket(task, buf, size);
+#endif
+    task->m_WrittenBytes += n_written;
+    task->m_SockCanWrite = size_t(n_written) == size;
+
+    return size_t(n_written);
+}
+
 static inline void
 s_CompactBuffer(char* buf, Uint2& size, Uint2& pos)
 {
@@ -1292,6 +1348,23 @@ CSrvSocketTask::Write(const void* buf, size_t size)
     }
 }
 
+size_t
+CSrvSocketTask::WriteFromFile(int fd, Uint8 offset,
+                              const void* buf, size_t size)
+{
+    if (!s_UseSendfile  ||  size < kSockWriteBufSize)
+        return Write(buf, size);
+
+    if (m_WrSize != m_WrPos) {
+        // Everything that was written before must go to socket first.
+        s_FlushData(this);
+        if (IsWriteDataPending())
+            return 0;
+    }
+    s_CompactWrBuffer(this);
+    return s_SendFileToSocket(this, fd, offset, buf, size);
+}
+
 void
 CSrvSocketTask::WriteData(const void* buf, size_t size)
 {
@@ -49,6 +49,8 @@ public:
 #undef CHECK_RANGE
 #include "../../corelib/ncbiobj.cpp"
 #undef NCBI_USE_ERRCODE_X
+#include "../../corelib/ncbi_slab_alloc.cpp"
+#undef NCBI_USE_ERRCODE_X
 #undef STACK_THRESHOLD
 #include "../../corelib/ddumpable.cpp"
 #undef NCBI_USE_ERRCODE_X
@@ -184,6 +184,11 @@ public:
     /// amount of data written which can be 0 if socket is not writable at the
     /// moment.
     size_t Write(const void* buf, size_t size);
+    /// Same as Write() but data is known to be also stored in file fd at
+    /// the given offset. Large pieces of data are sent to socket directly
+    /// from file using sendfile() avoiding copying through user space.
+    /// buf is used when sendfile() cannot be used.
+    size_t WriteFromFile(int fd, Uint8 offset, const void* buf, size_t size);
     /// Flush all data saved in internal write buffers to socket.
     /// Method must be called from inside of ExecuteSlice() of this task and
     /// no other writing methods should be called until FlushIsDone() returns
@@ -0,0 +1,212 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  TinyLFU admission and eviction of NetCache hot cache
+ *
+ * The cache is compiled in directly so that blobs can be put into one shard
+ * and its contents can be checked without registering reads.
+ *
+ */
+
+#include "../nc_hot_cache.cpp"
+
+
+BEGIN_NCBI_SCOPE
+
+// Statistics of the server are not needed, only admissions are counted
+static Uint8 s_Admits = 0;
+static Uint8 s_Rejects = 0;
+
+void CNCStat::HotCacheHit(size_t /* data_size */)
+{}
+
+void CNCStat::HotCacheMiss(void)
+{}
+
+void CNCStat::HotCacheAdmission(bool admitted)
+{
+    if (admitted)
+        ++s_Admits;
+    else
+        ++s_Rejects;
+}
+
+END_NCBI_SCOPE
+
+
+USING_NCBI_SCOPE;
+
+
+/// Size of each shard of the cache in the test
+static const Uint8 kShardSize = 1000;
+/// Size of most blobs in the test, shard fits 10 of them
+static const Uint8 kBlobSize = 100;
+
+static int s_KeyCounter = 0;
+static char s_Data[kShardSize];
+
+
+/// _VERIFY of the server needs its logging initialized, so failures are
+/// reported here directly.
+#define NC_CHECK(x)  if (x) {} else s_Fail(#x, __LINE__)
+
+static void
+s_Fail(const char* what, int line)
+{
+    cerr << "Check failed at line " << line << ": " << what << endl;
+    abort();
+}
+
+
+/// Version of the blob doesn't matter for the test, it's the same for all
+static SNCHotBlobVer
+s_Ver(Uint8 size)
+{
+    return SNCHotBlobVer(1, 1, 1, size, 1);
+}
+
+/// Next key falling into the first shard
+static string
+s_NewKey(void)
+{
+    for (;;) {
+        string key = "hot_blob_" + NStr::IntToString(++s_KeyCounter);
+        if (s_GetShard(s_HashKey(key)) == &s_Shards[0])
+            return key;
+    }
+}
+
+static void
+s_Touch(const string& key, int cnt)
+{
+    for (int i = 0; i < cnt; ++i) {
+        CNCHotCache::Touch(key);
+    }
+}
+
+static void
+s_Put(const string& key, Uint8 size)
+{
+    NC_CHECK(CNCHotCache::CanCache(s_Ver(size)));
+    CNCHotCache::Put(key, s_Ver(size), s_Data);
+}
+
+/// Check presence of the blob without registering a read
+static bool
+s_IsCached(const string& key)
+{
+    SHotCacheShard* shard = s_GetShard(s_HashKey(key));
+    CMiniMutexGuard guard(shard->lock);
+    return shard->key_map.find(key, SHotKeyCompare())
+           != shard->key_map.end();
+}
+
+static void
+s_CheckState(Uint8 blobs, Uint8 size)
+{
+    SNCStateStat state;
+    CNCHotCache::ReadState(state);
+    NC_CHECK(state.hot_blobs == blobs);
+    NC_CHECK(state.hot_size == size);
+}
+
+
+int main(int /* argc */, const char* /* argv */[])
+{
+    CNCHotCache::Initialize();
+    CNCHotCache::SetLimits(kShardSize * kHotCacheShards, Uint4(kShardSize));
+
+    // Fill the shard; blobs read once are admitted while there's room
+    vector<string> keys;
+    for (int i = 0; i < 10; ++i) {
+        keys.push_back(s_NewKey());
+        s_Touch(keys.back(), 1);
+        s_Put(keys.back(), kBlobSize);
+    }
+    NC_CHECK(s_Admits == 10  &&  s_Rejects == 0);
+    s_CheckState(10, kShardSize);
+
+    // Blobs read from the cache go to the protected segment
+    for (int i = 0; i < 2; ++i) {
+        NC_CHECK(CNCHotCache::Get(keys[i], s_Ver(kBlobSize)));
+    }
+
+    // More popular blob evicts the least recently used blob of probation
+    string popular = s_NewKey();
+    s_Touch(popular, 3);
+    s_Put(popular, kBlobSize);
+    NC_CHECK(s_Admits == 11);
+    NC_CHECK(s_IsCached(popular));
+    NC_CHECK(!s_IsCached(keys[2]));
+    NC_CHECK(s_IsCached(keys[0])  &&  s_IsCached(keys[1]));
+    s_CheckState(10, kShardSize);
+
+    // Blob never read before is not admitted, nothing is evicted
+    string cold = s_NewKey();
+    s_Put(cold, kBlobSize);
+    NC_CHECK(s_Rejects == 1);
+    NC_CHECK(!s_IsCached(cold));
+    s_CheckState(10, kShardSize);
+
+    // Blob needing two victims is not admitted if the second one is more
+    // popular; the first one must not be evicted either
+    s_Touch(keys[4], 5);
+    string big = s_NewKey();
+    s_Touch(big, 3);
+    s_Put(big, 2 * kBlobSize);
+    NC_CHECK(s_Rejects == 2);
+    NC_CHECK(!s_IsCached(big));
+    NC_CHECK(s_IsCached(keys[3])  &&  s_IsCached(keys[4]));
+    s_CheckState(10, kShardSize);
+
+    // When it's more popular than both, both are evicted
+    s_Touch(big, 4);
+    s_Put(big, 2 * kBlobSize);
+    NC_CHECK(s_Admits == 12);
+    NC_CHECK(s_IsCached(big));
+    NC_CHECK(!s_IsCached(keys[3])  &&  !s_IsCached(keys[4]));
+    for (int i = 5; i < 10; ++i) {
+        NC_CHECK(s_IsCached(keys[i]));
+    }
+    s_CheckState(9, kShardSize);
+
+    // Shrinking the cache evicts probation blobs first
+    CNCHotCache::SetLimits(kShardSize / 2 * kHotCacheShards,
+                           Uint4(kShardSize));
+    NC_CHECK(s_IsCached(keys[0])  &&  s_IsCached(keys[1]));
+    NC_CHECK(s_IsCached(popular)  &&  s_IsCached(big));
+    for (int i = 5; i < 10; ++i) {
+        NC_CHECK(!s_IsCached(keys[i]));
+    }
+    s_CheckState(4, 5 * kBlobSize);
+
+    CNCHotCache::SetLimits(0, 0);
+    s_CheckState(0, 0);
+
+    cout << "Test completed successfully!" << endl;
+    return 0;
+}
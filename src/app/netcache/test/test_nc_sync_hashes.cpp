@@ -0,0 +1,207 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ * File Description:  Hash tree used by NetCache periodic sync
+ *
+ * Two trees are filled with the same blobs in different order, one of them
+ * is changed incrementally and the differing leaves are found by the same
+ * top-down descent the periodic sync does with SYNC_HASHES.
+ *
+ */
+
+#include "../nc_sync_hashes.cpp"
+
+
+USING_NCBI_SCOPE;
+
+
+/// Number of blobs in the slot in the test
+static const size_t kCntBlobs = 20000;
+
+
+/// _VERIFY of the server needs its logging initialized, so failures are
+/// reported here directly.
+#define NC_CHECK(x)  if (x) {} else s_Fail(#x, __LINE__)
+
+static void
+s_Fail(const char* what, int line)
+{
+    cerr << "Check failed at line " << line << ": " << what << endl;
+    abort();
+}
+
+
+/// Blob as the tree sees it: hash of its key selects the leaf
+struct STestBlob
+{
+    Uint8 key_hash;
+    Uint8 hash;
+};
+
+static Uint8 s_RandState = 1;
+
+/// Deterministic pseudo-random 64-bit values (xorshift64*)
+static Uint8
+s_Rand(void)
+{
+    s_RandState ^= s_RandState >> 12;
+    s_RandState ^= s_RandState << 25;
+    s_RandState ^= s_RandState >> 27;
+    return s_RandState * NCBI_CONST_UINT8(0x2545f4914f6cdd1d);
+}
+
+static STestBlob
+s_NewBlob(void)
+{
+    STestBlob blob;
+    blob.key_hash = s_Rand();
+    blob.hash = s_Rand() | 1;
+    return blob;
+}
+
+static void
+s_Write(CNCSyncHashTree& tree, const STestBlob& blob)
+{
+    tree.Update(CNCSyncHashTree::GetLeaf(blob.key_hash), 0, blob.hash);
+}
+
+static void
+s_Delete(CNCSyncHashTree& tree, const STestBlob& blob)
+{
+    tree.Update(CNCSyncHashTree::GetLeaf(blob.key_hash), blob.hash, 0);
+}
+
+/// Blob is rewritten, e.g. its dead time is prolonged
+static void
+s_Rewrite(CNCSyncHashTree& tree, STestBlob& blob)
+{
+    Uint8 new_hash = s_Rand() | 1;
+    tree.Update(CNCSyncHashTree::GetLeaf(blob.key_hash), blob.hash, new_hash);
+    blob.hash = new_hash;
+}
+
+/// Descend from the root comparing the trees level by level
+static TNCSyncHashLeaves
+s_Diff(CNCSyncHashTree& local, CNCSyncHashTree& remote)
+{
+    TNCSyncHashLeaves diff_leaves;
+    vector<Uint2> nodes(1, 0);
+    Uint2 levels = 0;
+    while (!nodes.empty()) {
+        vector<Uint8> local_hashes, remote_hashes;
+        local.GetHashes(nodes, local_hashes);
+        remote.GetHashes(nodes, remote_hashes);
+        NC_CHECK(local_hashes.size() == nodes.size() * kNCSyncHashFanout);
+        NC_CHECK(remote_hashes.size() == local_hashes.size());
+
+        vector<Uint2> next_nodes;
+        CNCSyncHashTree::Compare(nodes, local_hashes, remote_hashes,
+                                 next_nodes, diff_leaves);
+        ITERATE(vector<Uint2>, it, next_nodes) {
+            NC_CHECK(*it > 0  &&  *it < kNCSyncHashFirstLeaf);
+        }
+        nodes.swap(next_nodes);
+        ++levels;
+        NC_CHECK(levels <= kNCSyncHashLevels);
+    }
+    return diff_leaves;
+}
+
+/// XOR of all blobs is the hash of the root
+static Uint8
+s_RootHash(CNCSyncHashTree& tree)
+{
+    vector<Uint8> hashes;
+    tree.GetHashes(vector<Uint2>(1, 0), hashes);
+    NC_CHECK(hashes.size() == kNCSyncHashFanout);
+    Uint8 root = 0;
+    ITERATE(vector<Uint8>, it, hashes) {
+        root ^= *it;
+    }
+    return root;
+}
+
+
+int main(int /* argc */, const char* /* argv */[])
+{
+    vector<STestBlob> blobs;
+    Uint8 all_blobs = 0;
+    for (size_t i = 0; i < kCntBlobs; ++i) {
+        blobs.push_back(s_NewBlob());
+        all_blobs ^= blobs.back().hash;
+    }
+
+    // The tree doesn't depend on the order blobs were written in
+    CNCSyncHashTree local, remote;
+    for (size_t i = 0; i < blobs.size(); ++i) {
+        s_Write(local, blobs[i]);
+        s_Write(remote, blobs[blobs.size() - 1 - i]);
+    }
+    NC_CHECK(s_RootHash(local) == all_blobs);
+    NC_CHECK(s_RootHash(remote) == all_blobs);
+    NC_CHECK(s_Diff(local, remote).empty());
+
+    // Leaves are not expanded any further
+    vector<Uint2> leaf_nodes(1, kNCSyncHashFirstLeaf);
+    vector<Uint8> hashes;
+    local.GetHashes(leaf_nodes, hashes);
+    NC_CHECK(hashes.empty());
+
+    // Only the leaves of blobs changed on one side differ
+    STestBlob added = s_NewBlob();
+    STestBlob rewritten = blobs[20];
+    s_Write(local, added);
+    s_Delete(local, blobs[10]);
+    s_Rewrite(local, blobs[20]);
+    TNCSyncHashLeaves expected;
+    expected.insert(CNCSyncHashTree::GetLeaf(added.key_hash));
+    expected.insert(CNCSyncHashTree::GetLeaf(blobs[10].key_hash));
+    expected.insert(CNCSyncHashTree::GetLeaf(blobs[20].key_hash));
+    NC_CHECK(s_Diff(local, remote) == expected);
+    NC_CHECK(s_Diff(remote, local) == expected);
+
+    // The same changes made on the other side make the trees equal again
+    s_Write(remote, added);
+    s_Delete(remote, blobs[10]);
+    remote.Update(CNCSyncHashTree::GetLeaf(rewritten.key_hash),
+                  rewritten.hash, blobs[20].hash);
+    NC_CHECK(s_Diff(local, remote).empty());
+    NC_CHECK(s_RootHash(local) == s_RootHash(remote));
+
+    // Deleting everything leaves an empty tree
+    s_Delete(local, added);
+    for (size_t i = 0; i < blobs.size(); ++i) {
+        if (i != 10)
+            s_Delete(local, blobs[i]);
+    }
+    NC_CHECK(s_RootHash(local) == 0);
+    CNCSyncHashTree empty;
+    NC_CHECK(s_Diff(local, empty).empty());
+    NC_CHECK(s_Diff(remote, empty).size() > kNCSyncHashLeaves / 2);
+
+    cout << "Test completed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,214 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  NetCache read throughput test
+ *
+ * Blobs of sizes from min_size to max_size (doubling each time) are written
+ * to NetCache and then read back several times. Contents of every read blob
+ * is verified and read speed is printed. Run it against a server once with
+ * use_sendfile = true and once with use_sendfile = false in [task_server]
+ * section of its configuration to compare the two ways of sending data.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbitime.hpp>
+
+#include <connect/services/netcache_api.hpp>
+
+
+USING_NCBI_SCOPE;
+
+
+/// Size of buffer used for writing and reading blobs
+static const size_t kBufSize = 1024 * 1024;
+
+
+/// Fill buffer with data specific for the given position in the blob
+static void
+s_FillData(Uint4* buf, size_t cnt, Uint8 pos, Uint4 seed)
+{
+    for (size_t i = 0; i < cnt; ++i, ++pos) {
+        buf[i] = Uint4(pos * 2654435761U) ^ seed;
+    }
+}
+
+
+class CTestNetCacheThroughputApp : public CNcbiApplication
+{
+public:
+    void Init(void);
+    int Run(void);
+
+private:
+    string x_PutBlob(Uint8 size, Uint4 seed);
+    double x_ReadBlob(const string& key, Uint8 size, Uint4 seed);
+
+    CNetCacheAPI m_API;
+    AutoArray<Uint4> m_Buf;
+    AutoArray<Uint4> m_Expected;
+};
+
+
+void CTestNetCacheThroughputApp::Init(void)
+{
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "NetCache read throughput test");
+
+    arg_desc->AddPositional("service",
+        "NetCache service name or host:port",
+        CArgDescriptions::eString);
+
+    arg_desc->AddDefaultKey("min_size", "size",
+                            "Size of the smallest blob to test",
+                            CArgDescriptions::eDataSize, "1MB");
+    arg_desc->AddDefaultKey("max_size", "size",
+                            "Size of the largest blob to test",
+                            CArgDescriptions::eDataSize, "1GB");
+    arg_desc->AddDefaultKey("repeat", "count",
+                            "Number of times each blob is read",
+                            CArgDescriptions::eInteger, "3");
+    arg_desc->SetConstraint("repeat", new CArgAllow_Integers(1, kMax_Int));
+    arg_desc->AddDefaultKey("timeout", "timeout",
+                            "Communication timeout in msec",
+                            CArgDescriptions::eInteger, "60000");
+
+    SetupArgDescriptions(arg_desc.release());
+}
+
+string CTestNetCacheThroughputApp::x_PutBlob(Uint8 size, Uint4 seed)
+{
+    string key;
+    auto_ptr<IEmbeddedStreamWriter> writer(m_API.PutData(&key));
+    Uint8 pos = 0;
+    while (pos < size) {
+        size_t cnt = size_t(min(size - pos, Uint8(kBufSize))) / sizeof(Uint4);
+        s_FillData(m_Buf.get(), cnt, pos / sizeof(Uint4), seed);
+        const char* data = (const char*)m_Buf.get();
+        size_t to_write = cnt * sizeof(Uint4);
+        while (to_write != 0) {
+            size_t n_written = 0;
+            if (writer->Write(data, to_write, &n_written) != eRW_Success) {
+                NCBI_THROW(CException, eUnknown,
+                           "Error while writing blob");
+            }
+            data += n_written;
+            to_write -= n_written;
+        }
+        pos += cnt * sizeof(Uint4);
+    }
+    writer->Close();
+    return key;
+}
+
+double CTestNetCacheThroughputApp::x_ReadBlob(const string& key,
+                                              Uint8 size, Uint4 seed)
+{
+    CStopWatch sw(CStopWatch::eStart);
+    size_t blob_size = 0;
+    auto_ptr<IReader> reader(m_API.GetReader(key, &blob_size));
+    if (blob_size != size) {
+        NCBI_THROW_FMT(CException, eUnknown,
+                       "Blob " << key << " has size " << blob_size
+                       << " instead of " << size);
+    }
+
+    char* buf = (char*)m_Buf.get();
+    Uint8 pos = 0;
+    while (pos < size) {
+        size_t to_read = size_t(min(size - pos, Uint8(kBufSize)));
+        size_t have_read = 0;
+        while (have_read < to_read) {
+            size_t n_read = 0;
+            ERW_Result res = reader->Read(buf + have_read,
+                                          to_read - have_read, &n_read);
+            if (res != eRW_Success  ||  n_read == 0) {
+                NCBI_THROW(CException, eUnknown,
+                           "Error while reading blob " + key);
+            }
+            have_read += n_read;
+        }
+        size_t cnt = to_read / sizeof(Uint4);
+        s_FillData(m_Expected.get(), cnt, pos / sizeof(Uint4), seed);
+        if (memcmp(buf, m_Expected.get(), to_read) != 0) {
+            NCBI_THROW_FMT(CException, eUnknown,
+                           "Blob " << key << " has wrong data after position "
+                           << pos);
+        }
+        pos += to_read;
+    }
+    return sw.Elapsed();
+}
+
+int CTestNetCacheThroughputApp::Run(void)
+{
+    const CArgs& args = GetArgs();
+    Uint8 min_size = args["min_size"].AsInt8();
+    Uint8 max_size = args["max_size"].AsInt8();
+    int repeat = args["repeat"].AsInteger();
+    unsigned timeout = (unsigned)args["timeout"].AsInteger();
+
+    m_API = CNetCacheAPI(args["service"].AsString(), "throughput_test");
+    STimeout to = {timeout / 1000, (timeout % 1000) * 1000};
+    m_API.SetCommunicationTimeout(to);
+
+    m_Buf.reset(new Uint4[kBufSize / sizeof(Uint4)]);
+    m_Expected.reset(new Uint4[kBufSize / sizeof(Uint4)]);
+
+    // Sizes are rounded to whole number of Uint4s to make data generation
+    // simpler.
+    min_size = max(min_size / sizeof(Uint4) * sizeof(Uint4), Uint8(sizeof(Uint4)));
+    NcbiCout << "      size    write MB/s     read MB/s" << NcbiEndl;
+    Uint4 seed = Uint4(time(NULL));
+    for (Uint8 size = min_size; size <= max_size; size *= 2, ++seed) {
+        CStopWatch sw(CStopWatch::eStart);
+        string key = x_PutBlob(size, seed);
+        double write_time = sw.Elapsed();
+
+        double read_time = 0;
+        for (int i = 0; i < repeat; ++i) {
+            read_time += x_ReadBlob(key, size, seed);
+        }
+        m_API.Remove(key);
+
+        double mb = double(size) / (1024 * 1024);
+        NcbiCout << setw(10) << size
+                 << setw(14) << setprecision(5) << mb / write_time
+                 << setw(14) << setprecision(5) << mb * repeat / read_time
+                 << NcbiEndl;
+    }
+    return 0;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTestNetCacheThroughputApp().AppMain(argc, argv);
+}
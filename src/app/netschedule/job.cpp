@@ -230,6 +230,7 @@ void CJob::SetInput(const string &  input)
         if (was_overflow)
             m_Dirty |= fJobInfoPart;
     }
+    m_Dirty |= fIOPart;
     m_Input = input;
 }
 
@@ -251,6 +252,7 @@ void CJob::SetOutput(const string &  output)
         if (was_overflow)
             m_Dirty |= fJobInfoPart;
     }
+    m_Dirty |= fIOPart;
     m_Output = output;
 }
 
@@ -408,6 +410,9 @@ CJob::EJobFetchResult CJob::x_Fetch(CQueue* queue)
 
 CJob::EJobFetchResult  CJob::Fetch(CQueue *  queue, unsigned  id)
 {
+    if (queue->m_Journal.get() != NULL)
+        return queue->m_Journal->FetchJob(id, *this) ? eJF_Ok : eJF_NotFound;
+
     SJobDB &        job_db = queue->m_QueueDbBlock->job_db;
 
     job_db.id = id;
@@ -435,6 +440,9 @@ bool CJob::Flush(CQueue* queue)
     if (m_Dirty == 0 && m_New == false)
         return true;
 
+    if (queue->m_Journal.get() != NULL)
+        return x_FlushToJournal(queue);
+
     SJobDB &        job_db      = queue->m_QueueDbBlock->job_db;
     SJobInfoDB &    job_info_db = queue->m_QueueDbBlock->job_info_db;
     SEventsDB &     events_db   = queue->m_QueueDbBlock->events_db;
@@ -539,6 +547,42 @@ bool CJob::Flush(CQueue* queue)
 }
 
 
+bool CJob::x_FlushToJournal(CQueue* queue)
+{
+    // The input and output are the largest part of a job and they are
+    // rarely changed after the job is submitted so they are written to the
+    // journal only when changed.
+    bool        with_io = m_New || (m_Dirty & fIOPart);
+    string      aff_token;
+    string      group_token;
+
+    // The affinity and group dictionaries are not journaled separately.
+    // Instead the tokens are stored in the very first record of a job.
+    if (m_New) {
+        if (m_AffinityId != 0)
+            aff_token = queue->m_AffinityRegistry.GetTokenByID(m_AffinityId);
+        if (m_GroupId != 0)
+            group_token = queue->m_GroupRegistry.ResolveGroup(m_GroupId);
+    }
+
+    // The job stays dirty if the record could not be written so the
+    // next flush retries it.
+    queue->m_Journal->StoreJob(*this, with_io, aff_token, group_token);
+    x_SetClean();
+    return true;
+}
+
+
+void CJob::x_SetClean(void)
+{
+    NON_CONST_ITERATE(vector<CJobEvent>, it, m_Events) {
+        it->m_Dirty = false;
+    }
+    m_New = false;
+    m_Dirty = 0;
+}
+
+
 bool CJob::ShouldNotifySubmitter(const CNSPreciseTime &  current_time) const
 {
     // The very first event is always a submit
@@ -758,7 +802,7 @@ TJobStatus  CJob::GetStatusBeforeReading(void) const
 }
 
 
-void CJob::Dump(FILE *  jobs_file) const
+void CJob::Dump(FILE *  jobs_file, bool  with_io) const
 {
     // Fill in the job dump structure
     SJobDump        job_dump;
@@ -825,8 +869,8 @@ void CJob::Dump(FILE *  jobs_file) const
     // Fill in the job input/output structure
     SJobIODump      job_io_dump;
 
-    job_io_dump.input_size = m_Input.size();
-    job_io_dump.output_size = m_Output.size();
+    job_io_dump.input_size = with_io ? m_Input.size() : 0;
+    job_io_dump.output_size = with_io ? m_Output.size() : 0;
 
     try {
         job_io_dump.Write(jobs_file, m_Input.data(), m_Output.data());
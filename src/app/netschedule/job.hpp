@@ -47,6 +47,7 @@ BEGIN_NCBI_SCOPE
 
 // Forward for CJob/CJobEvent friendship
 class CQueue;
+class CNSJobJournal;
 class CNSAffinityRegistry;
 class CNSGroupsRegistry;
 
@@ -203,7 +204,8 @@ public:
     enum EPart {
         fJobPart     = 1 << 0, ///< SQueueDB part
         fJobInfoPart = 1 << 1, ///< SJobInfoDB part
-        fEventsPart  = 1 << 2  ///< SEventsDB part
+        fEventsPart  = 1 << 2, ///< SEventsDB part
+        fIOPart      = 1 << 3  ///< Input or output (job journal only)
     };
     enum EJobFetchResult {
         eJF_Ok       = 0,
@@ -422,12 +424,18 @@ public:
                  const CNSGroupsRegistry &    group_registry) const;
 
     TJobStatus GetStatusBeforeReading(void) const;
-    void Dump(FILE *  jobs_file) const;
+    // with_io == false => the input and output are dumped as empty strings
+    void Dump(FILE *  jobs_file, bool  with_io = true) const;
     bool LoadFromDump(FILE *  jobs_file,
                       char *  input_buf, char * output_buf);
 
 private:
+    friend class CNSJobJournal;
+
     EJobFetchResult x_Fetch(CQueue* queue);
+    bool x_FlushToJournal(CQueue* queue);
+    // Resets the service flags as if the job has just been fetched
+    void x_SetClean(void);
 
 private:
     // Service flags
@@ -41,6 +41,43 @@
 BEGIN_NCBI_SCOPE
 
 
+// Provides the first job which is not unwanted and (if restricted) is in the
+// restrict jobs. Usually one of the first few jobs fits; otherwise the
+// bit vector operations are much cheaper than checking the jobs one by one.
+static unsigned int
+s_GetFirstJob(const TNSBitVector &  jobs,
+              const TNSBitVector &  unwanted_jobs,
+              const TNSBitVector &  restrict_jobs,
+              bool                  restricted)
+{
+    static const unsigned int   kMaxJobsToCheck = 128;
+    TNSBitVector::enumerator    en(jobs.first());
+
+    for (unsigned int  k = 0; en.valid() && k < kMaxJobsToCheck; ++en, ++k) {
+        unsigned int    job_id = *en;
+        if (unwanted_jobs.get_bit(job_id))
+            continue;
+        if (!restricted || restrict_jobs.get_bit(job_id))
+            return job_id;
+    }
+    if (!en.valid())
+        return 0;
+
+    TNSBitVector    candidates;
+    if (restricted) {
+        candidates = restrict_jobs;
+        candidates &= jobs;
+    } else
+        candidates = jobs;
+    candidates -= unwanted_jobs;
+
+    en = candidates.first();
+    if (en.valid())
+        return *en;
+    return 0;
+}
+
+
 CJobStatusTracker::CJobStatusTracker()
  : m_DoneCnt(0)
 {
@@ -278,22 +315,10 @@ CJobStatusTracker::GetJobByStatus(TJobStatus            status,
                                   const TNSBitVector &  restrict_jobs,
                                   bool                  restricted) const
 {
-    TNSBitVector &              bv = *m_StatusStor[(int)status];
-    TNSBitVector::enumerator    en;
-    CReadLockGuard              guard(m_Lock);
+    CReadLockGuard      guard(m_Lock);
 
-    for (en = bv.first(); en.valid(); ++en) {
-        unsigned int    job_id = *en;
-        if (unwanted_jobs.get_bit(job_id))
-            continue;
-        if (restricted) {
-            if (restrict_jobs.get_bit(job_id))
-                return job_id;
-        } else {
-            return job_id;
-        }
-    }
-    return 0;
+    return s_GetFirstJob(*m_StatusStor[(int)status], unwanted_jobs,
+                         restrict_jobs, restricted);
 }
 
 
@@ -303,26 +328,14 @@ CJobStatusTracker::GetJobByStatus(const vector<TJobStatus> &   statuses,
                                   const TNSBitVector &         restrict_jobs,
                                   bool                         restricted) const
 {
-    TNSBitVector                jobs;
-    TNSBitVector::enumerator    en;
-    CReadLockGuard              guard(m_Lock);
+    TNSBitVector        jobs;
+    CReadLockGuard      guard(m_Lock);
 
     for (vector<TJobStatus>::const_iterator  k = statuses.begin();
          k != statuses.end(); ++k)
         jobs |= *m_StatusStor[(int)(*k)];
 
-    for (en = jobs.first(); en.valid(); ++en) {
-        unsigned int    job_id = *en;
-        if (unwanted_jobs.get_bit(job_id))
-            continue;
-        if (restricted) {
-            if (restrict_jobs.get_bit(job_id))
-                return job_id;
-        } else {
-            return job_id;
-        }
-    }
-    return 0;
+    return s_GetFirstJob(jobs, unwanted_jobs, restrict_jobs, restricted);
 }
 
 
@@ -347,6 +360,29 @@ CJobStatusTracker::GetJobs(CNetScheduleAPI::EJobStatus  status,
 }
 
 
+void
+CJobStatusTracker::RestrictByStatus(TJobStatus  status,
+                                    TNSBitVector &  jobs) const
+{
+    CReadLockGuard      guard(m_Lock);
+    jobs &= *m_StatusStor[(int)status];
+}
+
+
+void
+CJobStatusTracker::RestrictByStatus(const vector<TJobStatus> &  statuses,
+                                    TNSBitVector &  jobs) const
+{
+    TNSBitVector        status_jobs;
+    CReadLockGuard      guard(m_Lock);
+
+    for (vector<TJobStatus>::const_iterator  k = statuses.begin();
+         k != statuses.end(); ++k)
+        status_jobs |= *m_StatusStor[(int)(*k)];
+    jobs &= status_jobs;
+}
+
+
 TNSBitVector
 CJobStatusTracker::GetOutdatedPendingJobs(CNSPreciseTime          timeout,
                                           const CJobGCRegistry &  gc_registry) const
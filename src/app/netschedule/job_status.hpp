@@ -96,6 +96,10 @@ public:
     void  GetJobs(const vector<TJobStatus> &  statuses,
                   TNSBitVector & jobs) const;
     void  GetJobs(TJobStatus  status, TNSBitVector &  jobs) const;
+    // Leaves in jobs only those which are in the given state(s)
+    void  RestrictByStatus(TJobStatus  status, TNSBitVector &  jobs) const;
+    void  RestrictByStatus(const vector<TJobStatus> &  statuses,
+                           TNSBitVector &  jobs) const;
     TNSBitVector  GetOutdatedPendingJobs(
                             CNSPreciseTime          timeout,
                             const CJobGCRegistry &  gc_registry) const;
@@ -55,8 +55,8 @@
 
 // Protocol
 #define NETSCHEDULED_PROTOCOL_VERSION_MAJOR 1
-#define NETSCHEDULED_PROTOCOL_VERSION_MINOR 4
-#define NETSCHEDULED_PROTOCOL_VERSION_PATCH 6
+#define NETSCHEDULED_PROTOCOL_VERSION_MINOR 5
+#define NETSCHEDULED_PROTOCOL_VERSION_PATCH 0
 #define NETSCHEDULED_PROTOCOL_VERSION       \
             NETSCHEDULE_VERSION_COMPOSE_STR( \
                 NETSCHEDULED_PROTOCOL_VERSION_MAJOR, \
@@ -71,7 +71,7 @@
     " build " NETSCHEDULED_BUILD_DATE
 
 #define NETSCHEDULED_FEATURES \
-    "fast_status=1;dyn_queues=1;read_confirm=1;version=" NETSCHEDULED_VERSION
+    "fast_status=1;dyn_queues=1;read_confirm=1;batch_jobs=1;version=" NETSCHEDULED_VERSION
 
 
 #endif /* NETSCHEDULE_VERSION__HPP */
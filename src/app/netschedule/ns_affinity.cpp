@@ -1068,5 +1068,23 @@ void CNSAffinityRegistry::LoadFromDump(const string &  dump_dir_name,
 }
 
 
+void CNSAffinityRegistry::LoadFromJournal(
+                                const map<unsigned int, string> &  tokens)
+{
+    for (map<unsigned int, string>::const_iterator  k = tokens.begin();
+            k != tokens.end(); ++k) {
+        string *            new_token = new string(k->second);
+        SNSJobsAffinity     new_record;
+
+        new_record.m_AffToken = new_token;
+
+        m_JobsAffinity[k->first] = new_record;
+        m_AffinityIDs[new_token] = k->first;
+
+        m_RegisteredAffinities.set_bit(k->first);
+    }
+}
+
+
 END_NCBI_SCOPE
 
@@ -224,13 +224,14 @@ class CNSAffinityRegistry
 
         // Used to load the affinities and register loaded jobs.
         // The loading procedure has 3 steps:
-        // 1. Load the dictionary from the flat file
+        // 1. Load the dictionary from the flat file or from the job journal
         // 2. For each loaded job -> call AddJobToAffinity()
         // 3. Call FinalizeAffinityDictionaryLoading()
         // These functions should not be used for anything but loading
         // affinities from files
         void LoadFromDump(const string &  dump_dir_name,
                           const string &  queue_name);
+        void LoadFromJournal(const map<unsigned int, string> &  tokens);
         void  AddJobToAffinity(unsigned int  job_id,  unsigned int  aff_id);
         void  FinalizeAffinityDictionaryLoading(void);
 
@@ -79,6 +79,7 @@ void SNSCommandArguments::x_Reset()
     client_data.erase();
     ncbi_phid.erase();
     scope.erase();
+    jobs.erase();
 
     any_affinity = false;
     wnode_affinity = false;
@@ -166,7 +167,7 @@ void SNSCommandArguments::AssignValues(TNSProtoParams &           params,
             if (key == "exclusive_new_aff")
                 exclusive_new_aff = x_GetBooleanValue(val, key);
             else if (key == "err_msg")
-                err_msg = x_NormalizeErrorMessage(NStr::ParseEscapes(val));
+                err_msg = NormalizeErrorMessage(NStr::ParseEscapes(val));
             else if (key == "effective")
                 effective = x_GetBooleanValue(val, key);
             break;
@@ -213,6 +214,8 @@ void SNSCommandArguments::AssignValues(TNSProtoParams &           params,
             else if (key == "job_return_code")
                 job_return_code = NStr::StringToInt(val,
                                                     NStr::fConvErr_NoThrow);
+            else if (key == "jobs")
+                jobs = NStr::ParseEscapes(val);
             break;
         case 'm':
             if (key == "msk")
@@ -433,7 +436,7 @@ bool SNSCommandArguments::x_GetBooleanValue(const string &  val,
 }
 
 
-string SNSCommandArguments::x_NormalizeErrorMessage(const string &  val)
+string SNSCommandArguments::NormalizeErrorMessage(const string &  val)
 {
     if (val.size() > kNetScheduleMaxDBErrSize - 1) {
         // Truncate the message, see CXX-2617
@@ -80,6 +80,7 @@ struct SNSCommandArguments
     string          client_data;
     string          ncbi_phid;
     string          scope;
+    string          jobs;       // PUTB only
 
     bool            any_affinity;
     bool            wnode_affinity;
@@ -105,13 +106,15 @@ struct SNSCommandArguments
                       CSocket &                  peer_socket,
                       CCompoundIDPool::TInstance id_pool);
 
+    // Truncates a too long error message
+    static string NormalizeErrorMessage(const string &  val);
+
     private:
         void x_Reset();
         void x_CheckAffinityList(const string &  val);
         void x_CheckGroupList(const string &  val);
         void x_CheckQueueName(const string &  val, const string &  key);
         bool x_GetBooleanValue(const string &  val, const string &  key);
-        string x_NormalizeErrorMessage(const string &  val);
 };
 
 END_NCBI_SCOPE
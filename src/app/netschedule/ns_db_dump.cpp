@@ -473,5 +473,72 @@ int SLinkedSectionDump::Read(FILE *  f)
 }
 
 
+SJobJournalDump::SJobJournalDump()
+{
+    memset(this, 0, sizeof(SJobJournalDump));
+    magic = kJournalMagic;
+}
+
+
+void SJobJournalDump::Write(FILE *  f, const char *  aff_token,
+                                       const char *  group_token)
+{
+    errno = 0;
+    if (fwrite(this, sizeof(SJobJournalDump), 1, f) != 1)
+        throw runtime_error(strerror(errno));
+
+    if (aff_token_size > 0) {
+        errno = 0;
+        if (fwrite(aff_token, aff_token_size, 1, f) != 1)
+            throw runtime_error(strerror(errno));
+    }
+    if (group_token_size > 0) {
+        errno = 0;
+        if (fwrite(group_token, group_token_size, 1, f) != 1)
+            throw runtime_error(strerror(errno));
+    }
+}
+
+int SJobJournalDump::Read(FILE *  f, char *  aff_token, char *  group_token)
+{
+    errno = 0;
+    size_t      bytes = fread(this, 1, sizeof(SJobJournalDump), f);
+    if (bytes != sizeof(SJobJournalDump)) {
+        if (bytes > 0)
+            throw runtime_error("Incomplete job journal record reading");
+        if (feof(f))
+            return 1;
+        if (errno != 0)
+            throw runtime_error(strerror(errno));
+        throw runtime_error("Unknown job journal record reading error");
+    }
+
+    if (magic != kJournalMagic)
+        throw runtime_error("Job journal record magic does not match");
+    if (record_type < eJobUpdate || record_type > eJobDelete)
+        throw runtime_error("Unknown job journal record type");
+    if (aff_token_size > kNetScheduleMaxDBDataSize)
+        throw runtime_error("Job journal affinity token size is more "
+                            "than max allowed");
+    if (group_token_size > kNetScheduleMaxDBDataSize)
+        throw runtime_error("Job journal group token size is more "
+                            "than max allowed");
+
+    if (aff_token_size > 0) {
+        errno = 0;
+        if (fread(aff_token, 1, aff_token_size, f) != aff_token_size)
+            throw runtime_error("Incomplete job journal affinity "
+                                "token reading");
+    }
+    if (group_token_size > 0) {
+        errno = 0;
+        if (fread(group_token, 1, group_token_size, f) != group_token_size)
+            throw runtime_error("Incomplete job journal group "
+                                "token reading");
+    }
+    return 0;
+}
+
+
 END_NCBI_SCOPE
 
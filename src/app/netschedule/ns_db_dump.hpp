@@ -253,6 +253,34 @@ struct SLinkedSectionDump
 #pragma pack(pop)
 
 
+// Header of a job journal record. The job update record header is followed
+// by the affinity and group tokens (only for the first record of a job) and
+// then by the job itself in the same format as in the jobs dump file.
+// The job delete record has nothing but the header.
+#pragma pack(push, 1)
+struct SJobJournalDump
+{
+    enum ERecordType {
+        eJobUpdate       = 1,   // Job with input/output
+        eJobUpdateNoIO   = 2,   // Job without input/output; the previous
+                                // input/output are kept
+        eJobDelete       = 3
+    };
+
+    Int4                magic;
+    Uint4               record_type;
+    Uint4               job_id;
+    Uint4               aff_token_size;
+    Uint4               group_token_size;
+
+    SJobJournalDump();
+
+    void Write(FILE *  f, const char *  aff_token, const char *  group_token);
+    int Read(FILE *  f, char *  aff_token, char *  group_token);
+};
+#pragma pack(pop)
+
+
 END_NCBI_SCOPE
 
 #endif /* NETSCHEDULE_DB_DUMP__HPP */
@@ -704,5 +704,24 @@ void  CNSGroupsRegistry::LoadFromDump(const string &  dump_dir_name,
     fclose(grp_dict_file);
 }
 
+
+void  CNSGroupsRegistry::LoadFromJournal(
+                                const map<unsigned int, string> &  tokens)
+{
+    for (map<unsigned int, string>::const_iterator  k = tokens.begin();
+            k != tokens.end(); ++k) {
+        string *            new_token = new string(k->second);
+        SNSGroupJobs *      new_record = new SNSGroupJobs;
+
+        new_record->m_GroupToken = new_token;
+        new_record->m_GroupId = k->first;
+
+        m_IDToAttr[k->first] = new_record;
+        m_TokenToAttr[new_token] = new_record;
+
+        m_RegisteredGroups.set_bit(k->first);
+    }
+}
+
 END_NCBI_SCOPE
 
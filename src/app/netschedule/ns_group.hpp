@@ -131,12 +131,13 @@ class CNSGroupsRegistry
 
         // Used to load the groups and register loaded jobs.
         // The loading procedure has 3 steps:
-        // 1. Load the dictionary from the flat file
+        // 1. Load the dictionary from the flat file or from the job journal
         // 2. For each loaded job -> call AddJobToGroup()
         // 3. Call FinalizeGroupDictionaryLoading()
         // These functions should not be used for anything but loading DB.
         void  LoadFromDump(const string &  dump_dir_name,
                            const string &  queue_name);
+        void  LoadFromJournal(const map<unsigned int, string> &  tokens);
         void  AddJobToGroup(unsigned int  group_id, unsigned int  job_id);
         void  FinalizeGroupDictionaryLoading(void);
 
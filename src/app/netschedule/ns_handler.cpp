@@ -32,6 +32,7 @@
 #include <ncbi_pch.hpp>
 
 #include <corelib/ncbi_system.hpp>
+#include <corelib/ncbi_url.hpp>
 #include <corelib/resource_info.hpp>
 
 #include "ns_handler.hpp"
@@ -56,6 +57,9 @@ const string    kOKCompleteResponse = "OK:" + kEndOfResponse;
 const string    kErrNoJobFoundResponse = "ERR:eJobNotFound:" + kEndOfResponse;
 const string    kOKResponsePrefix = "OK:";
 
+// The max number of jobs in the GETB and PUTB commands
+const unsigned int  kMaxJobsPerBatchCmd = 100;
+
 
 
 // NetSchedule command parser
@@ -425,6 +429,20 @@ CNetScheduleHandler::SCommandMap CNetScheduleHandler::sm_CommandMap[] = {
           { "sid",               eNSPT_Str, eNSPA_Optional, ""  },
           { "ncbi_phid",         eNSPT_Str, eNSPA_Optional, ""  },
           { "prioritized_aff",   eNSPT_Int, eNSPA_Optional, "0" } } },
+    { "GETB",          { &CNetScheduleHandler::x_ProcessGetJobBatch,
+                         eNS_Queue | eNS_Worker | eNS_Program },
+        { { "count",             eNSPT_Int, eNSPA_Required      },
+          { "wnode_aff",         eNSPT_Int, eNSPA_Required, "0" },
+          { "any_aff",           eNSPT_Int, eNSPA_Required, "0" },
+          { "exclusive_new_aff", eNSPT_Int, eNSPA_Optional, "0" },
+          { "aff",               eNSPT_Str, eNSPA_Optional, ""  },
+          { "port",              eNSPT_Int, eNSPA_Optional      },
+          { "timeout",           eNSPT_Int, eNSPA_Optional      },
+          { "group",             eNSPT_Str, eNSPA_Optional, ""  },
+          { "ip",                eNSPT_Str, eNSPA_Optional, ""  },
+          { "sid",               eNSPT_Str, eNSPA_Optional, ""  },
+          { "ncbi_phid",         eNSPT_Str, eNSPA_Optional, ""  },
+          { "prioritized_aff",   eNSPT_Int, eNSPA_Optional, "0" } } },
     { "PUT",           { &CNetScheduleHandler::x_ProcessPut,
                          eNS_Queue | eNS_Worker | eNS_Program },
         { { "job_key",           eNSPT_Id,  eNSPA_Required      },
@@ -503,6 +521,12 @@ CNetScheduleHandler::SCommandMap CNetScheduleHandler::sm_CommandMap[] = {
           { "sid",               eNSPT_Str, eNSPA_Optional, ""  },
           { "ncbi_phid",         eNSPT_Str, eNSPA_Optional, ""  },
           { "no_retries",        eNSPT_Int, eNSPA_Optional, "0" } } },
+    { "PUTB",          { &CNetScheduleHandler::x_ProcessPutBatch,
+                         eNS_Queue | eNS_Worker | eNS_Program },
+        { { "jobs",              eNSPT_Str, eNSPA_Required      },
+          { "ip",                eNSPT_Str, eNSPA_Optional, ""  },
+          { "sid",               eNSPT_Str, eNSPA_Optional, ""  },
+          { "ncbi_phid",         eNSPT_Str, eNSPA_Optional, ""  } } },
     { "JXCG",          { &CNetScheduleHandler::x_ProcessJobExchange,
                          eNS_Queue | eNS_Worker | eNS_Program },
         { { "job_key",           eNSPT_Id,  eNSPA_Optchain      },
@@ -2150,6 +2174,152 @@ void CNetScheduleHandler::x_ProcessGetJob(CQueue* q)
 }
 
 
+// GETB gives up to 'count' jobs at once. The reply is
+// OK:job=<job1>&job=<job2>... where each job is URL encoded in the same
+// format as the GET2 reply. If there are no jobs at all then the client is
+// registered for notifications like in the case of GET2.
+void CNetScheduleHandler::x_ProcessGetJobBatch(CQueue* q)
+{
+    x_CheckNonAnonymousClient("use GETB command");
+    x_CheckPortAndTimeout();
+    x_CheckGetParameters();
+
+    if (m_CommandArguments.count == 0 ||
+        m_CommandArguments.count > kMaxJobsPerBatchCmd)
+        NCBI_THROW(CNetScheduleException, eInvalidParameter,
+                   "Invalid number of jobs. It must be between 1 and " +
+                   NStr::NumericToString(kMaxJobsPerBatchCmd));
+
+    // Check if the queue is paused
+    CQueue::TPauseStatus    pause_status = q->GetPauseStatus();
+    if (pause_status != CQueue::eNoPause) {
+
+        if (m_CommandArguments.timeout != 0)
+            q->RegisterQueueResumeNotification(m_ClientId.GetAddress(),
+                                               m_CommandArguments.port,
+                                               true);
+
+        string      pause_status_str;
+
+        if (pause_status == CQueue::ePauseWithPullback)
+            pause_status_str = "pullback";
+        else
+            pause_status_str = "nopullback";
+
+        x_WriteMessage("OK:pause=" + pause_status_str + kEndOfResponse);
+
+        if (x_NeedCmdLogging())
+            GetDiagContext().Extra().Print("job_key", "None")
+                                    .Print("reason",
+                                           "pause: " + pause_status_str);
+
+        x_PrintCmdRequestStop();
+        return;
+    }
+
+
+    list<string>    aff_list;
+    NStr::Split(m_CommandArguments.affinity_token,
+                "\t,", aff_list, NStr::fSplit_NoMergeDelims);
+    list<string>    group_list;
+    NStr::Split(m_CommandArguments.group,
+                "\t,", group_list, NStr::fSplit_NoMergeDelims);
+
+    CNSPreciseTime          curr = CNSPreciseTime::Current();
+    vector<unsigned int>    job_ids;
+    string                  response = kOKResponsePrefix;
+    string                  job_keys;
+    string                  added_pref_affs;
+
+    try {
+        for (unsigned int  k = 0; k < m_CommandArguments.count; ++k) {
+            CJob        job;
+            string      added_pref_aff;
+
+            // The job changes are made durable all together below.
+            // Only the first attempt may register the client as a waiting
+            // one: it is the case when there are no jobs at all.
+            x_ClearRollbackAction();
+            if (q->GetJobOrWait(m_ClientId,
+                                k == 0 ? m_CommandArguments.port : 0,
+                                k == 0 ? m_CommandArguments.timeout : 0,
+                                curr, &aff_list,
+                                m_CommandArguments.wnode_affinity,
+                                m_CommandArguments.any_affinity,
+                                m_CommandArguments.exclusive_new_aff,
+                                m_CommandArguments.prioritized_aff,
+                                true,
+                                &group_list,
+                                &job,
+                                m_RollbackAction,
+                                added_pref_aff,
+                                false) == false) {
+                if (k != 0)
+                    break;
+
+                // Preferred affinities were reset for the client, so no job
+                // and bad request
+                x_SetCmdRequestStatus(eStatus_BadRequest);
+                x_WriteMessage("ERR:ePrefAffExpired:" + kEndOfResponse);
+                x_PrintCmdRequestStop();
+                return;
+            }
+            x_ClearRollbackAction();
+
+            if (!added_pref_aff.empty()) {
+                if (!added_pref_affs.empty())
+                    added_pref_affs += ",";
+                added_pref_affs += added_pref_aff;
+            }
+
+            if (!job.GetId())
+                break;
+
+            job_ids.push_back(job.GetId());
+            if (response.size() > kOKResponsePrefix.size())
+                response += "&";
+            response += "job=" + NStr::URLEncode(x_GetJobResponseV2(q, job));
+            if (!job_keys.empty())
+                job_keys += ",";
+            job_keys += q->MakeJobKey(job.GetId());
+        }
+    } catch (...) {
+        // The jobs which have been given already must not stay running
+        if (!job_ids.empty()) {
+            CNSBatchGetJobRollback(m_ClientId, job_ids).Rollback(q);
+        }
+        q->SyncJournal();
+        throw;
+    }
+
+    q->SyncJournal();
+
+    if (x_NeedCmdLogging()) {
+        if (job_keys.empty())
+            GetDiagContext().Extra().Print("job_key", "None");
+        else
+            GetDiagContext().Extra().Print("job_keys", job_keys);
+
+        if (!added_pref_affs.empty()) {
+            if (m_ClientIdentificationPrinted)
+                GetDiagContext().Extra()
+                    .Print("added_preferred_affinity", added_pref_affs);
+            else
+                GetDiagContext().Extra()
+                    .Print("client_node", m_ClientId.GetNode())
+                    .Print("client_session", m_ClientId.GetSession())
+                    .Print("added_preferred_affinity", added_pref_affs);
+        }
+    }
+
+    if (!job_ids.empty())
+        m_RollbackAction = new CNSBatchGetJobRollback(m_ClientId, job_ids);
+    x_WriteMessage(response + kEndOfResponse);
+    x_ClearRollbackAction();
+    x_PrintCmdRequestStop();
+}
+
+
 void CNetScheduleHandler::x_ProcessCancelWaitGet(CQueue* q)
 {
     x_CheckNonAnonymousClient("cancel waiting after WGET");
@@ -2454,6 +2624,167 @@ void CNetScheduleHandler::x_ProcessPutFailure(CQueue* q)
 }
 
 
+// PUTB commits a few jobs at once. The jobs parameter has one line per
+// job; each line is URL encoded arguments of the PUT2 command: job_key,
+// auth_token, job_return_code and output. If err_msg (and optionally
+// no_retries) is there then the job is failed like by the FPUT2 command.
+// The reply is OK:<job key>=<result>&... where the result is the URL encoded
+// reply of PUT2/FPUT2 for the job without the OK: prefix for the successful
+// cases.
+void CNetScheduleHandler::x_ProcessPutBatch(CQueue* q)
+{
+    x_CheckNonAnonymousClient("use PUTB command");
+
+    list<string>        entries;
+    NStr::Split(m_CommandArguments.jobs, "\n", entries,
+                NStr::fSplit_Tokenize);
+    if (entries.empty() || entries.size() > kMaxJobsPerBatchCmd)
+        NCBI_THROW(CNetScheduleException, eInvalidParameter,
+                   "Invalid number of jobs. It must be between 1 and " +
+                   NStr::NumericToString(kMaxJobsPerBatchCmd));
+
+    CNSPreciseTime      curr = CNSPreciseTime::Current();
+    string              response = kOKResponsePrefix;
+    string              job_keys;
+
+    try {
+        for (list<string>::const_iterator  k = entries.begin();
+             k != entries.end(); ++k) {
+            string      job_key;
+            string      result;
+
+            try {
+                result = x_PutBatchJob(q, curr, *k, job_key);
+            } catch (const CNetScheduleException &  ex) {
+                result = string("ERR:") + ex.GetErrCodeString() +
+                         ":" + ex.GetMsg();
+            } catch (const CUrlParserException &  ex) {
+                result = "ERR:eInvalidParameter:" + ex.GetMsg();
+            } catch (const CBDB_ErrnoException &  ex) {
+                // The emergency shutdown is initiated for the whole command
+                if (ex.IsRecovery())
+                    throw;
+                ERR_POST(ex);
+                result = "ERR:eInternalError:Internal database error - " +
+                         string(ex.what());
+            } catch (const CException &  ex) {
+                // Other jobs of the batch are still committed
+                ERR_POST(ex);
+                result = "ERR:eInternalError:" + ex.GetMsg();
+            }
+
+            if (response.size() > kOKResponsePrefix.size())
+                response += "&";
+            response += NStr::URLEncode(job_key) + "=" +
+                        NStr::URLEncode(result);
+            if (!job_keys.empty())
+                job_keys += ",";
+            job_keys += job_key;
+        }
+    } catch (...) {
+        q->SyncJournal();
+        throw;
+    }
+
+    // One sync for all the jobs in the batch
+    q->SyncJournal();
+
+    x_WriteMessage(response + kEndOfResponse);
+    if (x_NeedCmdLogging())
+        GetDiagContext().Extra().Print("job_keys", job_keys);
+    x_PrintCmdRequestStop();
+}
+
+
+// Commits one job of the PUTB command and provides its result
+string CNetScheduleHandler::x_PutBatchJob(CQueue *                q,
+                                          const CNSPreciseTime &  curr,
+                                          const string &          entry,
+                                          string &                job_key)
+{
+    CUrlArgs            args(entry);
+
+    job_key = args.GetValue("job_key");
+
+    CNetScheduleKey     key(job_key, m_Server->GetCompoundIDPool());
+    if (key.id == 0)
+        NCBI_THROW(CNetScheduleException, eInvalidParameter,
+                   "Invalid job key");
+    if (!key.queue.empty() &&
+        NStr::CompareNocase(key.queue, q->GetQueueName()) != 0)
+        NCBI_THROW(CNetScheduleException, eInvalidParameter,
+                   "The job belongs to another queue");
+
+    const string &      auth_token = args.GetValue("auth_token");
+    if (auth_token.empty())
+        NCBI_THROW(CNetScheduleException, eInvalidAuthToken,
+                   "Invalid authorization token. It cannot be empty.");
+
+    int                 ret_code = NStr::StringToInt(
+                                        args.GetValue("job_return_code"),
+                                        NStr::fConvErr_NoThrow);
+    const string &      output = args.GetValue("output");
+
+    CJob                job;
+    TJobStatus          old_status;
+
+    if (!args.IsSetValue("err_msg")) {
+        old_status = q->PutResult(m_ClientId, curr, key.id, job_key, job,
+                                  auth_token, ret_code, output, false);
+        if (old_status == CNetScheduleAPI::ePending ||
+            old_status == CNetScheduleAPI::eRunning)
+            return "OK";
+        if (old_status == CNetScheduleAPI::eFailed) {
+            // Still accept the job results, but print a warning: CXX-3632
+            ERR_POST(Warning << "Accepting results for a job in "
+                                "the FAILED state.");
+            return "OK";
+        }
+        if (old_status == CNetScheduleAPI::eDone) {
+            ERR_POST(Warning << "Cannot accept job " << job_key
+                             << " results. The job has already been done.");
+            return "WARNING:eJobAlreadyDone:Already done";
+        }
+        if (old_status == CNetScheduleAPI::eJobNotFound) {
+            ERR_POST(Warning << "Cannot accept job " << job_key
+                             << " results. The job is unknown");
+            return "ERR:eJobNotFound:";
+        }
+
+        ERR_POST(Warning << "Cannot accept job " << job_key
+                         << " results; job is in "
+                         << CNetScheduleAPI::StatusToString(old_status)
+                         << " state");
+        return "ERR:eInvalidJobStatus:Cannot accept job results; job is in " +
+               CNetScheduleAPI::StatusToString(old_status) + " state";
+    }
+
+    string              warning;
+    old_status = q->FailJob(m_ClientId, key.id, job_key, job, auth_token,
+                            SNSCommandArguments::NormalizeErrorMessage(
+                                                    args.GetValue("err_msg")),
+                            output, ret_code,
+                            args.GetValue("no_retries") == "1",
+                            warning, false);
+    if (old_status == CNetScheduleAPI::eRunning)
+        return "OK";
+    if (old_status == CNetScheduleAPI::eJobNotFound) {
+        ERR_POST(Warning << "FPUT for unknown job " << job_key);
+        return "ERR:eJobNotFound:";
+    }
+    if (old_status == CNetScheduleAPI::eFailed) {
+        ERR_POST(Warning << "FPUT for already failed job " << job_key);
+        return "WARNING:eJobAlreadyFailed:Already failed";
+    }
+
+    ERR_POST(Warning << "Cannot fail job " << job_key << "; job is in "
+                     << CNetScheduleAPI::StatusToString(old_status)
+                     << " state");
+    return "ERR:eInvalidJobStatus:Cannot fail job; job is in " +
+           CNetScheduleAPI::StatusToString(old_status) + " state";
+}
+
+
 void CNetScheduleHandler::x_ProcessDropQueue(CQueue* q)
 {
     // The DROPQ implementation has been changed in NS 4.23.2
@@ -4144,18 +4475,7 @@ CNetScheduleHandler::x_PrintGetJobResponse(const CQueue *  q,
     }
 
     if (cmdv2)
-        x_WriteMessage(
-                       "OK:job_key=" + job_key +
-                       "&input=" + NStr::URLEncode(job.GetInput()) +
-                       "&affinity=" +
-                       NStr::URLEncode(q->GetAffinityTokenByID(
-                                                        job.GetAffinityId())) +
-                       "&client_ip=" + NStr::URLEncode(job.GetClientIP()) +
-                       "&client_sid=" + NStr::URLEncode(job.GetClientSID()) +
-                       "&ncbi_phid=" + NStr::URLEncode(job.GetNCBIPHID()) +
-                       "&mask=" + NStr::NumericToString(job.GetMask()) +
-                       "&auth_token=" + job.GetAuthToken() +
-                       kEndOfResponse);
+        x_WriteMessage("OK:" + x_GetJobResponseV2(q, job) + kEndOfResponse);
     else
         x_WriteMessage(
                        "OK:" + job_key +
@@ -4170,6 +4490,23 @@ CNetScheduleHandler::x_PrintGetJobResponse(const CQueue *  q,
 }
 
 
+// The job part of the GET2 response. GETB uses it for each job too.
+string
+CNetScheduleHandler::x_GetJobResponseV2(const CQueue *  q,
+                                        const CJob &    job) const
+{
+    return "job_key=" + q->MakeJobKey(job.GetId()) +
+           "&input=" + NStr::URLEncode(job.GetInput()) +
+           "&affinity=" +
+           NStr::URLEncode(q->GetAffinityTokenByID(job.GetAffinityId())) +
+           "&client_ip=" + NStr::URLEncode(job.GetClientIP()) +
+           "&client_sid=" + NStr::URLEncode(job.GetClientSID()) +
+           "&ncbi_phid=" + NStr::URLEncode(job.GetNCBIPHID()) +
+           "&mask=" + NStr::NumericToString(job.GetMask()) +
+           "&auth_token=" + job.GetAuthToken();
+}
+
+
 bool CNetScheduleHandler::x_CanBeWithoutQueue(FProcessor  processor) const
 {
     return // STATUS/STATUS2
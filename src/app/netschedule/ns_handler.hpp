@@ -165,6 +165,7 @@ private:
     void x_ProcessCancel(CQueue*);
     void x_ProcessStatus(CQueue*);
     void x_ProcessGetJob(CQueue*);
+    void x_ProcessGetJobBatch(CQueue*);
     void x_ProcessCancelWaitGet(CQueue*);
     void x_ProcessCancelWaitRead(CQueue*);
     void x_ProcessPut(CQueue*);
@@ -172,6 +173,7 @@ private:
     void x_ProcessPutMessage(CQueue*);
     void x_ProcessGetMessage(CQueue*);
     void x_ProcessPutFailure(CQueue*);
+    void x_ProcessPutBatch(CQueue*);
     void x_ProcessDropQueue(CQueue*);
     void x_ProcessReturn(CQueue*);
     void x_ProcessReschedule(CQueue*);
@@ -245,6 +247,11 @@ private:
     void x_PrintGetJobResponse(const CQueue * q,
                                const CJob &   job,
                                bool           add_security_token);
+    string x_GetJobResponseV2(const CQueue * q, const CJob & job) const;
+    string x_PutBatchJob(CQueue *                q,
+                         const CNSPreciseTime &  curr,
+                         const string &          entry,
+                         string &                job_key);
     bool x_CanBeWithoutQueue(FProcessor  processor) const;
     bool x_NeedToGeneratePHIDAndSID(FProcessor  processor) const;
     bool x_WorkerNodeCommand(void) const;
@@ -0,0 +1,680 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Net schedule job storage which keeps the jobs in memory and makes them
+ *   durable via an append-only journal of the job changes.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <set>
+
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbitime.hpp>
+#include <connect/services/netschedule_api_expt.hpp>
+
+#include "ns_job_journal.hpp"
+#include "ns_db.hpp"
+#include "ns_db_dump.hpp"
+#include "ns_types.hpp"
+
+
+BEGIN_NCBI_SCOPE
+
+
+// Size of the stdio buffer of the journal file
+static const size_t         kJournalBufferSize = 256 * 1024;
+// Number of jobs copied from the job table under the lock at a time
+// while a snapshot is made
+static const size_t         kSnapshotChunkSize = 1000;
+
+
+CNSJobJournal::CNSJobJournal(const string &  dir_name,
+                             bool            sync,
+                             Uint8           max_size) :
+    m_DirName(CDirEntry::AddTrailingPathSeparator(dir_name)),
+    m_Sync(sync),
+    m_MaxSize(max_size),
+    m_File(NULL),
+    m_Generation(0),
+    m_FileSize(0),
+    m_SnapshotSize(0),
+    m_LastRecord(0),
+    m_SyncedRecord(0),
+    m_SyncInProgress(false)
+{}
+
+
+CNSJobJournal::~CNSJobJournal()
+{
+    try {
+        CFastMutexGuard     guard(m_Lock);
+        x_Close();
+    } catch (...) {}
+}
+
+
+unsigned int  CNSJobJournal::Recover(void)
+{
+    CFastMutexGuard     guard(m_Lock);
+
+    x_WaitSync();
+    x_Close();
+    m_Jobs.clear();
+    m_AffTokens.clear();
+    m_GroupTokens.clear();
+
+    CDir    dir(m_DirName);
+    if (!dir.Exists())
+        dir.CreatePath();
+
+    vector<unsigned int>    snapshots;
+    vector<unsigned int>    journals;
+    vector<string>          garbage;
+    x_ListFiles(snapshots, journals, garbage);
+
+    AutoArray<char>     input_buf(new char[kNetScheduleMaxOverflowSize]);
+    AutoArray<char>     output_buf(new char[kNetScheduleMaxOverflowSize]);
+    unsigned int        snapshot_generation = 0;
+    unsigned int        last_generation = 0;
+
+    if (!snapshots.empty()) {
+        snapshot_generation = snapshots.back();
+        last_generation = snapshot_generation;
+        x_Replay(x_GetSnapshotFileName(snapshot_generation),
+                 input_buf.get(), output_buf.get());
+    }
+    ITERATE(vector<unsigned int>, k, journals) {
+        if (*k < snapshot_generation)
+            continue;
+        x_Replay(x_GetJournalFileName(*k), input_buf.get(), output_buf.get());
+        last_generation = *k;
+    }
+
+    ITERATE(vector<string>, k, garbage) {
+        CFile(*k).Remove();
+    }
+    x_RemoveFiles(snapshot_generation);
+
+    // The last journal file may end with a partially written record so
+    // nothing is appended to it
+    x_StartGeneration(last_generation + 1);
+    return m_Jobs.size();
+}
+
+
+void CNSJobJournal::Reset(void)
+{
+    CFastMutexGuard     guard(m_Lock);
+
+    x_WaitSync();
+    x_Close();
+    m_Jobs.clear();
+    m_AffTokens.clear();
+    m_GroupTokens.clear();
+
+    CDir    dir(m_DirName);
+    if (dir.Exists()) {
+        vector<unsigned int>    snapshots;
+        vector<unsigned int>    journals;
+        vector<string>          garbage;
+        x_ListFiles(snapshots, journals, garbage);
+        ITERATE(vector<string>, k, garbage) {
+            CFile(*k).Remove();
+        }
+        x_RemoveFiles(kMax_UInt);
+    } else
+        dir.CreatePath();
+
+    x_StartGeneration(1);
+}
+
+
+void CNSJobJournal::Remove(void)
+{
+    CFastMutexGuard     guard(m_Lock);
+
+    x_WaitSync();
+    x_Close();
+    m_Jobs.clear();
+    m_AffTokens.clear();
+    m_GroupTokens.clear();
+    CDir(m_DirName).Remove();
+}
+
+
+string  CNSJobJournal::SetAside(void)
+{
+    CFastMutexGuard     guard(m_Lock);
+
+    x_WaitSync();
+    x_Close();
+    m_Jobs.clear();
+    m_AffTokens.clear();
+    m_GroupTokens.clear();
+
+    CDirEntry   dir(CDirEntry::DeleteTrailingPathSeparator(m_DirName));
+    string      aside_dir = CDirEntry::DeleteTrailingPathSeparator(
+                                                dir.GetDir()) +
+                            kJournalSetAsideSuffix;
+    string      aside = CDirEntry::AddTrailingPathSeparator(aside_dir) +
+                        dir.GetName() + "." +
+                        CTime(CTime::eCurrent).AsString("YMDhms");
+
+    if (!CDir(aside_dir).CreatePath() || !dir.Rename(aside))
+        NCBI_THROW(CNetScheduleException, eInternalError,
+                   "Cannot move job journal " + m_DirName + " to " + aside);
+    return aside;
+}
+
+
+bool  CNSJobJournal::FetchJob(unsigned int  job_id, CJob &  job) const
+{
+    CFastMutexGuard                             guard(m_Lock);
+    map<unsigned int, CJob>::const_iterator     found = m_Jobs.find(job_id);
+
+    if (found == m_Jobs.end())
+        return false;
+    job = found->second;
+    return true;
+}
+
+
+unsigned int  CNSJobJournal::GetNextJobID(unsigned int  job_id) const
+{
+    CFastMutexGuard                             guard(m_Lock);
+    map<unsigned int, CJob>::const_iterator     next =
+                                                    m_Jobs.upper_bound(job_id);
+
+    if (next == m_Jobs.end())
+        return 0;
+    return next->first;
+}
+
+
+void  CNSJobJournal::StoreJob(const CJob &    job,
+                              bool            with_io,
+                              const string &  aff_token,
+                              const string &  group_token)
+{
+    CFastMutexGuard     guard(m_Lock);
+
+    if (m_File == NULL)
+        NCBI_THROW(CNetScheduleException, eInternalError,
+                   "Job journal " + m_DirName + " is not open");
+
+    try {
+        x_WriteJob(m_File, job, with_io, aff_token, group_token);
+    } catch (const exception &  ex) {
+        // The file may end with a partial record now. Its replay stops
+        // there so the next records go to a new file.
+        ERR_POST("Error writing job journal " << m_DirName << ": " <<
+                 ex.what());
+        x_WaitSync();
+        x_StartGeneration(m_Generation + 1);
+        NCBI_THROW(CNetScheduleException, eInternalError,
+                   "Error writing job journal: " + string(ex.what()));
+    }
+    m_FileSize = ftell(m_File);
+    ++m_LastRecord;
+
+    if (!aff_token.empty())
+        m_AffTokens[job.GetAffinityId()] = aff_token;
+    if (!group_token.empty())
+        m_GroupTokens[job.GetGroupId()] = group_token;
+
+    // The caller marks its job clean only after the record is written
+    CJob &  stored = m_Jobs[job.GetId()];
+    stored = job;
+    stored.x_SetClean();
+}
+
+
+void  CNSJobJournal::EraseJob(unsigned int  job_id)
+{
+    CFastMutexGuard     guard(m_Lock);
+
+    if (m_Jobs.erase(job_id) == 0)
+        return;
+    if (m_File == NULL)
+        NCBI_THROW(CNetScheduleException, eInternalError,
+                   "Job journal " + m_DirName + " is not open");
+
+    SJobJournalDump     record;
+    record.record_type = SJobJournalDump::eJobDelete;
+    record.job_id = job_id;
+
+    try {
+        record.Write(m_File, NULL, NULL);
+    } catch (const exception &  ex) {
+        ERR_POST("Error writing job journal " << m_DirName << ": " <<
+                 ex.what());
+        x_WaitSync();
+        x_StartGeneration(m_Generation + 1);
+        NCBI_THROW(CNetScheduleException, eInternalError,
+                   "Error writing job journal: " + string(ex.what()));
+    }
+    m_FileSize = ftell(m_File);
+    ++m_LastRecord;
+}
+
+
+size_t  CNSJobJournal::GetJobCount(void) const
+{
+    CFastMutexGuard     guard(m_Lock);
+    return m_Jobs.size();
+}
+
+
+void  CNSJobJournal::Commit(void)
+{
+    if (!m_Sync)
+        return;
+
+    CFastMutexGuard     guard(m_Lock);
+    Uint8               record = m_LastRecord;
+
+    while (m_SyncedRecord < record) {
+        if (m_SyncInProgress)
+            // Somebody else syncs; the records appended before that sync
+            // started are covered by it
+            m_SyncDone.WaitForSignal(m_Lock);
+        else
+            x_Sync();
+    }
+}
+
+
+void  CNSJobJournal::Checkpoint(void)
+{
+    unsigned int    snapshot_generation = 0;
+
+    {{
+        CFastMutexGuard     guard(m_Lock);
+
+        if (m_File == NULL)
+            return;
+
+        if (m_SyncedRecord < m_LastRecord && !m_SyncInProgress)
+            x_Sync();
+
+        // The snapshot is not made until the journal outgrows it as well.
+        // Otherwise a large number of jobs leads to a constant snapshot
+        // writing.
+        if (m_FileSize < max(m_MaxSize, m_SnapshotSize))
+            return;
+
+        x_WaitSync();
+        snapshot_generation = m_Generation + 1;
+        x_StartGeneration(snapshot_generation);
+    }}
+
+    CStopWatch      sw(CStopWatch::eStart);
+    try {
+        x_MakeSnapshot(snapshot_generation);
+    } catch (const exception &  ex) {
+        ERR_POST("Error making job journal snapshot in " << m_DirName <<
+                 ": " << ex.what());
+        CFile(x_GetSnapshotFileName(snapshot_generation) + ".tmp").Remove();
+        return;
+    }
+
+    CFastMutexGuard     guard(m_Lock);
+    x_RemoveFiles(snapshot_generation);
+
+    // Forget the tokens which are not used by any job
+    set<unsigned int>   used_affinities;
+    set<unsigned int>   used_groups;
+    for (map<unsigned int, CJob>::const_iterator  k = m_Jobs.begin();
+            k != m_Jobs.end(); ++k) {
+        used_affinities.insert(k->second.GetAffinityId());
+        used_groups.insert(k->second.GetGroupId());
+    }
+    for (map<unsigned int, string>::iterator  k = m_AffTokens.begin();
+            k != m_AffTokens.end(); ) {
+        if (used_affinities.find(k->first) == used_affinities.end())
+            m_AffTokens.erase(k++);
+        else
+            ++k;
+    }
+    for (map<unsigned int, string>::iterator  k = m_GroupTokens.begin();
+            k != m_GroupTokens.end(); ) {
+        if (used_groups.find(k->first) == used_groups.end())
+            m_GroupTokens.erase(k++);
+        else
+            ++k;
+    }
+
+    LOG_POST(Note << "Job journal snapshot " << snapshot_generation <<
+                     " in " << m_DirName << " is made: " << m_Jobs.size() <<
+                     " jobs, " << m_SnapshotSize << " bytes, " <<
+                     sw.Elapsed() << " sec");
+}
+
+
+// Must be called under the lock. The lock is released while fdatasync()
+// is in progress so that the other threads could append more records.
+void  CNSJobJournal::x_Sync(void)
+{
+    Uint8   record = m_LastRecord;
+    int     fd = fileno(m_File);
+    bool    ok = fflush(m_File) == 0;
+    int     error = errno;
+
+    m_SyncInProgress = true;
+    if (ok) {
+        m_Lock.Unlock();
+        ok = fdatasync(fd) == 0;
+        error = errno;
+        m_Lock.Lock();
+    }
+    m_SyncInProgress = false;
+    if (ok)
+        m_SyncedRecord = record;
+    m_SyncDone.SignalAll();
+
+    if (!ok)
+        NCBI_THROW(CNetScheduleException, eInternalError,
+                   "Error syncing job journal " + m_DirName + ": " +
+                   strerror(error));
+}
+
+
+// Must be called under the lock. The file must not be closed while another
+// thread syncs it.
+void  CNSJobJournal::x_WaitSync(void)
+{
+    while (m_SyncInProgress)
+        m_SyncDone.WaitForSignal(m_Lock);
+}
+
+
+void  CNSJobJournal::x_Close(void)
+{
+    if (m_File == NULL)
+        return;
+
+    fflush(m_File);
+    fdatasync(fileno(m_File));
+    fclose(m_File);
+    m_File = NULL;
+    m_SyncedRecord = m_LastRecord;
+}
+
+
+void  CNSJobJournal::x_StartGeneration(unsigned int  generation)
+{
+    x_Close();
+
+    string      file_name = x_GetJournalFileName(generation);
+    m_File = fopen(file_name.c_str(), "wb");
+    if (m_File == NULL)
+        NCBI_THROW(CNetScheduleException, eInternalError,
+                   "Cannot open job journal file " + file_name);
+    setvbuf(m_File, NULL, _IOFBF, kJournalBufferSize);
+
+    m_Generation = generation;
+    m_FileSize = 0;
+}
+
+
+void  CNSJobJournal::x_WriteJob(FILE *          f,
+                                const CJob &    job,
+                                bool            with_io,
+                                const string &  aff_token,
+                                const string &  group_token)
+{
+    SJobJournalDump     record;
+
+    record.record_type = with_io ? SJobJournalDump::eJobUpdate :
+                                   SJobJournalDump::eJobUpdateNoIO;
+    record.job_id = job.GetId();
+    record.aff_token_size = aff_token.size();
+    record.group_token_size = group_token.size();
+    record.Write(f, aff_token.data(), group_token.data());
+    job.Dump(f, with_io);
+}
+
+
+void  CNSJobJournal::x_Replay(const string &  file_name,
+                              char *          input_buf,
+                              char *          output_buf)
+{
+    FILE *      f = fopen(file_name.c_str(), "rb");
+    if (f == NULL)
+        throw runtime_error("Cannot open file " + file_name +
+                            " to load the job journal");
+
+    char            aff_token_buf[kNetScheduleMaxDBDataSize];
+    char            group_token_buf[kNetScheduleMaxDBDataSize];
+    size_t          records = 0;
+
+    for (;;) {
+        try {
+            SJobJournalDump     record;
+            if (record.Read(f, aff_token_buf, group_token_buf) == 1)
+                break;
+
+            if (record.record_type == SJobJournalDump::eJobDelete) {
+                m_Jobs.erase(record.job_id);
+                ++records;
+                continue;
+            }
+
+            CJob    job;
+            if (!job.LoadFromDump(f, input_buf, output_buf))
+                throw runtime_error("Unexpected end of the journal file. "
+                                    "Cannot read expected job.");
+            if (job.GetId() != record.job_id)
+                throw runtime_error("Job id does not match the "
+                                    "journal record");
+
+            if (record.record_type == SJobJournalDump::eJobUpdateNoIO) {
+                map<unsigned int, CJob>::const_iterator     prev =
+                                                    m_Jobs.find(job.GetId());
+                if (prev != m_Jobs.end()) {
+                    job.m_Input = prev->second.m_Input;
+                    job.m_Output = prev->second.m_Output;
+                }
+            }
+            job.x_SetClean();
+
+            if (record.aff_token_size > 0)
+                m_AffTokens[job.GetAffinityId()] =
+                            string(aff_token_buf, record.aff_token_size);
+            if (record.group_token_size > 0)
+                m_GroupTokens[job.GetGroupId()] =
+                            string(group_token_buf, record.group_token_size);
+            m_Jobs[job.GetId()] = job;
+            ++records;
+        } catch (const exception &  ex) {
+            // Normally it is the last record which was being written when
+            // the server stopped
+            ERR_POST(Warning << "Job journal file " << file_name <<
+                     " is read till a broken record after " << records <<
+                     " records: " << ex.what());
+            break;
+        }
+    }
+
+    fclose(f);
+}
+
+
+void  CNSJobJournal::x_ListFiles(vector<unsigned int> &  snapshots,
+                                 vector<unsigned int> &  journals,
+                                 vector<string> &  garbage) const
+{
+    CDir::TEntries      entries = CDir(m_DirName).GetEntries(
+                                    kEmptyStr, CDir::fIgnoreRecursive);
+
+    for (CDir::TEntries::const_iterator  k = entries.begin();
+            k != entries.end(); ++k) {
+        if ((*k)->IsDir())
+            continue;
+
+        string          name = (*k)->GetName();
+        unsigned int    generation = 0;
+
+        if (NStr::StartsWith(name, kJournalFilePrefix)) {
+            generation = NStr::StringToUInt(
+                            name.substr(kJournalFilePrefix.size()),
+                            NStr::fConvErr_NoThrow);
+            if (generation != 0) {
+                journals.push_back(generation);
+                continue;
+            }
+        } else if (NStr::StartsWith(name, kJournalSnapshotPrefix)) {
+            generation = NStr::StringToUInt(
+                            name.substr(kJournalSnapshotPrefix.size()),
+                            NStr::fConvErr_NoThrow);
+            if (generation != 0) {
+                snapshots.push_back(generation);
+                continue;
+            }
+        }
+
+        // Unfinished snapshots and whatever else
+        garbage.push_back(m_DirName + name);
+    }
+
+    sort(snapshots.begin(), snapshots.end());
+    sort(journals.begin(), journals.end());
+}
+
+
+// Removes the files which are not needed when the given generation
+// snapshot exists
+void  CNSJobJournal::x_RemoveFiles(unsigned int  before_generation)
+{
+    vector<unsigned int>    snapshots;
+    vector<unsigned int>    journals;
+    vector<string>          garbage;
+
+    x_ListFiles(snapshots, journals, garbage);
+    ITERATE(vector<unsigned int>, k, snapshots) {
+        if (*k < before_generation)
+            CFile(x_GetSnapshotFileName(*k)).Remove();
+    }
+    ITERATE(vector<unsigned int>, k, journals) {
+        if (*k < before_generation)
+            CFile(x_GetJournalFileName(*k)).Remove();
+    }
+}
+
+
+void  CNSJobJournal::x_MakeSnapshot(unsigned int  generation)
+{
+    string      file_name = x_GetSnapshotFileName(generation);
+    string      tmp_file_name = file_name + ".tmp";
+    FILE *      f = fopen(tmp_file_name.c_str(), "wb");
+
+    if (f == NULL)
+        throw runtime_error("Cannot open file " + tmp_file_name);
+    setvbuf(f, NULL, _IOFBF, kJournalBufferSize);
+
+    try {
+        unsigned int        last_id = 0;
+        vector<CJob>        jobs;
+        vector<string>      aff_tokens;
+        vector<string>      group_tokens;
+
+        for (;;) {
+            jobs.clear();
+            aff_tokens.clear();
+            group_tokens.clear();
+
+            // Copy a chunk of jobs to write it without the lock
+            {{
+                CFastMutexGuard     guard(m_Lock);
+
+                for (map<unsigned int, CJob>::const_iterator
+                        k = m_Jobs.upper_bound(last_id);
+                        k != m_Jobs.end() && jobs.size() < kSnapshotChunkSize;
+                        ++k) {
+                    jobs.push_back(k->second);
+
+                    map<unsigned int, string>::const_iterator   token =
+                            m_AffTokens.find(k->second.GetAffinityId());
+                    aff_tokens.push_back(token == m_AffTokens.end() ?
+                                         kEmptyStr : token->second);
+                    token = m_GroupTokens.find(k->second.GetGroupId());
+                    group_tokens.push_back(token == m_GroupTokens.end() ?
+                                           kEmptyStr : token->second);
+                }
+            }}
+
+            if (jobs.empty())
+                break;
+
+            for (size_t  k = 0; k < jobs.size(); ++k)
+                x_WriteJob(f, jobs[k], true, aff_tokens[k], group_tokens[k]);
+            last_id = jobs.back().GetId();
+        }
+
+        if (fflush(f) != 0 || fdatasync(fileno(f)) != 0)
+            throw runtime_error(strerror(errno));
+        m_SnapshotSize = ftell(f);
+    } catch (...) {
+        fclose(f);
+        throw;
+    }
+    fclose(f);
+
+    if (rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+        throw runtime_error("Cannot rename " + tmp_file_name + ": " +
+                            strerror(errno));
+
+    // Make the rename durable before the older files are removed
+    int     dir_fd = open(m_DirName.c_str(), O_RDONLY);
+    if (dir_fd >= 0) {
+        fsync(dir_fd);
+        close(dir_fd);
+    }
+}
+
+
+string  CNSJobJournal::x_GetJournalFileName(unsigned int  generation) const
+{
+    return m_DirName + kJournalFilePrefix +
+           NStr::NumericToString(generation);
+}
+
+
+string  CNSJobJournal::x_GetSnapshotFileName(unsigned int  generation) const
+{
+    return m_DirName + kJournalSnapshotPrefix +
+           NStr::NumericToString(generation);
+}
+
+
+END_NCBI_SCOPE
+
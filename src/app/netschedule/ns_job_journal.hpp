@@ -0,0 +1,168 @@
+#ifndef NETSCHEDULE_JOB_JOURNAL__HPP
+#define NETSCHEDULE_JOB_JOURNAL__HPP
+
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Net schedule job storage which keeps the jobs in memory and makes them
+ *   durable via an append-only journal of the job changes.
+ *
+ */
+
+
+#include <corelib/ncbistl.hpp>
+#include <corelib/ncbimtx.hpp>
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "job.hpp"
+
+
+BEGIN_NCBI_SCOPE
+
+
+// Alternative to the Berkeley DB tables for a single queue.
+// All the jobs are in memory. Each flushed job change is appended to the
+// current journal file as a complete job record; deletions are appended as
+// short records. Commit() makes the appended records durable; when a few
+// threads commit at the same time only one of them calls fdatasync() and
+// the others wait for it (group commit).
+// When the journal file becomes too large Checkpoint() starts a new journal
+// file and writes all the jobs into a snapshot file. The snapshot is written
+// without blocking the job changes so it is not a point in time image,
+// however replaying the journal files which are not older than the snapshot
+// brings every job to its last state.
+//
+// Files in the journal directory:
+// jobs.journal.<N>  - journal files; the larger N the newer the file
+// jobs.snapshot.<N> - the jobs as they were no later than the
+//                     jobs.journal.<N> file was started
+// When the jobs cannot be loaded the directory is set aside as is for a
+// later investigation (see SetAside()).
+//
+// There is no rollback: a job change is applied when the job is flushed
+// regardless of whether the transaction is committed later.
+// The jobs which were erased in memory but not deleted from the journal yet
+// (see CQueue::DeleteBatch()) are restored after a crash. They expire again
+// in a regular way.
+class CNSJobJournal
+{
+    public:
+        CNSJobJournal(const string &  dir_name, bool  sync, Uint8  max_size);
+        ~CNSJobJournal();
+
+    public:
+        // Loads the jobs from the snapshot and the journal files and starts
+        // a new journal file. Provides the number of loaded jobs.
+        unsigned int  Recover(void);
+        // Discards all the jobs and the files and starts a new journal file
+        void  Reset(void);
+        // Closes the journal and removes its directory
+        void  Remove(void);
+        // Closes the journal and moves its directory with all the files to
+        // <journal root>.failed/<name>.<time> where they are not removed at
+        // the shutdown or at the next start. Provides the new path.
+        // The journal stays closed so the job changes fail.
+        string  SetAside(void);
+
+        bool  FetchJob(unsigned int  job_id, CJob &  job) const;
+        // Provides the smallest job id greater than the given one or 0
+        unsigned int  GetNextJobID(unsigned int  job_id) const;
+        void  StoreJob(const CJob &  job, bool  with_io,
+                       const string &  aff_token,
+                       const string &  group_token);
+        void  EraseJob(unsigned int  job_id);
+        size_t  GetJobCount(void) const;
+
+        // Makes everything stored so far durable if the journal is
+        // synchronous. Otherwise the records reach the disk at the next
+        // checkpoint.
+        void  Commit(void);
+        // Periodic maintenance: syncs an asynchronous journal and makes a
+        // snapshot if the journal file is too large
+        void  Checkpoint(void);
+
+        // The tokens of the loaded jobs affinities and groups.
+        // Valid after Recover() till the first Checkpoint().
+        const map<unsigned int, string> &  GetAffinityTokens(void) const
+        { return m_AffTokens; }
+        const map<unsigned int, string> &  GetGroupTokens(void) const
+        { return m_GroupTokens; }
+
+    private:
+        void  x_StartGeneration(unsigned int  generation);
+        void  x_Close(void);
+        void  x_Sync(void);
+        void  x_WaitSync(void);
+        void  x_WriteJob(FILE *  f, const CJob &  job, bool  with_io,
+                         const string &  aff_token,
+                         const string &  group_token);
+        void  x_Replay(const string &  file_name,
+                       char *  input_buf, char *  output_buf);
+        void  x_ListFiles(vector<unsigned int> &  snapshots,
+                          vector<unsigned int> &  journals,
+                          vector<string> &  garbage) const;
+        void  x_RemoveFiles(unsigned int  before_generation);
+        void  x_MakeSnapshot(unsigned int  generation);
+        string  x_GetJournalFileName(unsigned int  generation) const;
+        string  x_GetSnapshotFileName(unsigned int  generation) const;
+
+    private:
+        CNSJobJournal(const CNSJobJournal &);
+        CNSJobJournal & operator=(const CNSJobJournal &);
+
+    private:
+        string                      m_DirName;
+        bool                        m_Sync;
+        Uint8                       m_MaxSize;
+
+        mutable CFastMutex          m_Lock;
+        map<unsigned int, CJob>     m_Jobs;
+        map<unsigned int, string>   m_AffTokens;
+        map<unsigned int, string>   m_GroupTokens;
+
+        FILE *                      m_File;
+        unsigned int                m_Generation;
+        Uint8                       m_FileSize;
+        Uint8                       m_SnapshotSize;
+
+        // Group commit support
+        Uint8                       m_LastRecord;   // Appended records
+        Uint8                       m_SyncedRecord; // Durable records
+        bool                        m_SyncInProgress;
+        CConditionVariable          m_SyncDone;
+};
+
+
+END_NCBI_SCOPE
+
+#endif /* NETSCHEDULE_JOB_JOURNAL__HPP */
+
@@ -162,10 +162,11 @@ CQueue::~CQueue()
 }
 
 
-void CQueue::Attach(SQueueDbBlock* block)
+void CQueue::Attach(SQueueDbBlock* block, CNSJobJournal* journal)
 {
     x_Detach();
     m_QueueDbBlock = block;
+    m_Journal.reset(journal);
 
     // Here we have a db, so we can read the counter value we should start from
     m_LastId = m_Server->GetJobsStartID(m_QueueName);
@@ -203,6 +204,12 @@ private:
 
 void CQueue::x_Detach(void)
 {
+    if (m_Journal.get() != NULL) {
+        if (m_TruncateAtDetach && !m_Server->ShutdownRequested())
+            m_Journal->Remove();
+        m_Journal.reset();
+    }
+
     if (!m_QueueDbBlock)
         return;
 
@@ -748,7 +755,8 @@ TJobStatus  CQueue::PutResult(const CNSClientId &     client,
                               CJob &                  job,
                               const string &          auth_token,
                               int                     ret_code,
-                              const string &          output)
+                              const string &          output,
+                              bool                    sync_journal)
 {
     // The only one parameter (max output size) is required for the put
     // operation so there is no need to use CQueueParamAccessor
@@ -757,67 +765,75 @@ TJobStatus  CQueue::PutResult(const CNSClientId &     client,
         NCBI_THROW(CNetScheduleException, eDataTooLong,
                    "Output is too long");
 
-    CFastMutexGuard     guard(m_OperationLock);
-    TJobStatus          old_status = GetJobStatus(job_id);
+    TJobStatus          old_status;
 
-    if (old_status == CNetScheduleAPI::eDone) {
-        m_StatisticsCounters.CountTransition(CNetScheduleAPI::eDone,
-                                             CNetScheduleAPI::eDone);
-        return old_status;
-    }
+    {{
+        CFastMutexGuard     guard(m_OperationLock);
+        old_status = GetJobStatus(job_id);
 
-    if (old_status != CNetScheduleAPI::ePending &&
-        old_status != CNetScheduleAPI::eRunning &&
-        old_status != CNetScheduleAPI::eFailed)
-        return old_status;
+        if (old_status == CNetScheduleAPI::eDone) {
+            m_StatisticsCounters.CountTransition(CNetScheduleAPI::eDone,
+                                                 CNetScheduleAPI::eDone);
+            return old_status;
+        }
 
-    {{
-        CNSTransaction      transaction(this);
-        x_UpdateDB_PutResultNoLock(job_id, auth_token, curr,
-                                   ret_code, output, job,
-                                   client);
-        transaction.Commit();
-    }}
+        if (old_status != CNetScheduleAPI::ePending &&
+            old_status != CNetScheduleAPI::eRunning &&
+            old_status != CNetScheduleAPI::eFailed)
+            return old_status;
 
-    m_StatusTracker.SetStatus(job_id, CNetScheduleAPI::eDone);
-    m_StatisticsCounters.CountTransition(old_status,
-                                         CNetScheduleAPI::eDone);
-    g_DoPerfLogging(*this, job, 200);
-    m_ClientsRegistry.UnregisterJob(job_id, eGet);
+        {{
+            CNSTransaction      transaction(this);
+            transaction.DeferJournalSync();
+            x_UpdateDB_PutResultNoLock(job_id, auth_token, curr,
+                                       ret_code, output, job,
+                                       client);
+            transaction.Commit();
+        }}
 
-    m_GCRegistry.UpdateLifetime(job_id,
-                                job.GetExpirationTime(m_Timeout,
-                                                      m_RunTimeout,
-                                                      m_ReadTimeout,
-                                                      m_PendingTimeout,
-                                                      curr));
+        m_StatusTracker.SetStatus(job_id, CNetScheduleAPI::eDone);
+        m_StatisticsCounters.CountTransition(old_status,
+                                             CNetScheduleAPI::eDone);
+        g_DoPerfLogging(*this, job, 200);
+        m_ClientsRegistry.UnregisterJob(job_id, eGet);
 
-    TimeLineRemove(job_id);
+        m_GCRegistry.UpdateLifetime(job_id,
+                                    job.GetExpirationTime(m_Timeout,
+                                                          m_RunTimeout,
+                                                          m_ReadTimeout,
+                                                          m_PendingTimeout,
+                                                          curr));
 
-    if (job.ShouldNotifySubmitter(curr))
-        m_NotificationsList.NotifyJobStatus(job.GetSubmAddr(),
-                                            job.GetSubmNotifPort(),
-                                            job_key,
-                                            job.GetStatus(),
-                                            job.GetLastEventIndex());
-    if (job.ShouldNotifyListener(curr, m_JobsToNotify))
-        m_NotificationsList.NotifyJobStatus(job.GetListenerNotifAddr(),
-                                            job.GetListenerNotifPort(),
-                                            job_key,
-                                            job.GetStatus(),
-                                            job.GetLastEventIndex());
+        TimeLineRemove(job_id);
 
-    // Notify the readers if the job has not been given for reading yet
-    if (!m_ReadJobs.get_bit(job_id)) {
-        m_GCRegistry.UpdateReadVacantTime(job_id, curr);
-        m_NotificationsList.Notify(job_id, job.GetAffinityId(),
-                                   m_ClientsRegistry,
-                                   m_AffinityRegistry,
-                                   m_GroupRegistry,
-                                   m_NotifHifreqPeriod,
-                                   m_HandicapTimeout,
-                                   eRead);
-    }
+        if (job.ShouldNotifySubmitter(curr))
+            m_NotificationsList.NotifyJobStatus(job.GetSubmAddr(),
+                                                job.GetSubmNotifPort(),
+                                                job_key,
+                                                job.GetStatus(),
+                                                job.GetLastEventIndex());
+        if (job.ShouldNotifyListener(curr, m_JobsToNotify))
+            m_NotificationsList.NotifyJobStatus(job.GetListenerNotifAddr(),
+                                                job.GetListenerNotifPort(),
+                                                job_key,
+                                                job.GetStatus(),
+                                                job.GetLastEventIndex());
+
+        // Notify the readers if the job has not been given for reading yet
+        if (!m_ReadJobs.get_bit(job_id)) {
+            m_GCRegistry.UpdateReadVacantTime(job_id, curr);
+            m_NotificationsList.Notify(job_id, job.GetAffinityId(),
+                                       m_ClientsRegistry,
+                                       m_AffinityRegistry,
+                                       m_GroupRegistry,
+                                       m_NotifHifreqPeriod,
+                                       m_HandicapTimeout,
+                                       eRead);
+        }
+    }}
+
+    if (sync_journal)
+        SyncJournal();
     return old_status;
 }
 
@@ -838,7 +854,8 @@ CQueue::GetJobOrWait(const CNSClientId &       client,
                      const list<string> *      group_list,
                      CJob *                    new_job,
                      CNSRollbackInterface * &  rollback_action,
-                     string &                  added_pref_aff)
+                     string &                  added_pref_aff,
+                     bool                      sync_journal)
 {
     // We need exactly 1 parameter - m_RunTimeout, so we can access it without
     // CQueueParamAccessor
@@ -890,6 +907,10 @@ CQueue::GetJobOrWait(const CNSClientId &       client,
                                                prioritized_aff,
                                                group_ids_vector, has_groups,
                                                eGet);
+        x_CJobClaim     claim(*this);
+        if (job_pick.job_id != 0 && !claim.Claim(job_pick.job_id))
+            continue;   // Another GET is committing this job; pick again
+
         {{
             bool                outdated_job = false;
             CFastMutexGuard     guard(m_OperationLock);
@@ -911,6 +932,8 @@ CQueue::GetJobOrWait(const CNSClientId &       client,
                                               new_format, group_ids_vector);
                     return true;
                 }
+                if (!claim.Claim(job_pick.job_id))
+                    continue;
                 outdated_job = true;
             } else {
                 // Check that the job is still Pending; it could be
@@ -926,7 +949,8 @@ CQueue::GetJobOrWait(const CNSClientId &       client,
                                         x_FindOutdatedPendingJob(
                                                     client, job_pick.job_id,
                                                     group_ids_vector);
-                        if (outdated_pick.job_id != 0) {
+                        if (outdated_pick.job_id != 0 &&
+                            claim.Claim(outdated_pick.job_id)) {
                             job_pick = outdated_pick;
                             outdated_job = true;
                         }
@@ -993,9 +1017,14 @@ CQueue::GetJobOrWait(const CNSClientId &       client,
                 m_NotificationsList.ClearExactGetNotifications();
 
             rollback_action = new CNSGetJobRollback(client, job_pick.job_id);
-            return true;
+            break;
         }}
     }
+
+    // The job change is made durable out of the lock so the concurrent
+    // operations share the disk syncs
+    if (sync_journal)
+        SyncJournal();
     return true;
 }
 
@@ -2233,6 +2262,9 @@ CQueue::GetJobForReadingOrWait(const CNSClientId &       client,
                                                prioritized_aff,
                                                group_ids_vector, has_groups,
                                                eRead);
+        x_CJobClaim     claim(*this);
+        if (job_pick.job_id != 0 && !claim.Claim(job_pick.job_id))
+            continue;   // Another READ is committing this job; pick again
 
         {{
             bool                outdated_job = false;
@@ -2259,6 +2291,8 @@ CQueue::GetJobForReadingOrWait(const CNSClientId &       client,
                                            group_ids_vector);
                     return true;
                 }
+                if (!claim.Claim(job_pick.job_id))
+                    continue;
                 outdated_job = true;
             } else {
                 // Check that the job is still Done/Failed/Canceled
@@ -2277,7 +2311,8 @@ CQueue::GetJobForReadingOrWait(const CNSClientId &       client,
                                         x_FindOutdatedJobForReading(
                                                 client, job_pick.job_id,
                                                 group_ids_vector);
-                        if (outdated_pick.job_id != 0) {
+                        if (outdated_pick.job_id != 0 &&
+                            claim.Claim(outdated_pick.job_id)) {
                             job_pick = outdated_pick;
                             outdated_job = true;
                         }
@@ -2342,10 +2377,12 @@ CQueue::GetJobForReadingOrWait(const CNSClientId &       client,
                                                      old_status);
             m_ReadJobs.set_bit(job_pick.job_id);
             ++m_ReadJobsOps;
-            return true;
+            break;
         }}
     }
-    return true;    // unreachable
+
+    SyncJournal();
+    return true;
 }
 
 
@@ -2603,101 +2640,85 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
 {
     bool            explicit_aff = !aff_ids.empty();
     bool            effective_use_pref_affinity = use_pref_affinity;
-    unsigned int    pref_aff_candidate_job_id = 0;
-    unsigned int    exclusive_aff_candidate = 0;
     string          scope = client.GetScope();
+    // Jobs picked by the other GETs/READs which are being committed now
+    TNSBitVector    claimed_jobs = x_GetClaimedJobs();
 
     TNSBitVector    pref_aff = m_ClientsRegistry.GetPreferredAffinities(
                                                     client, cmd_group);
     if (use_pref_affinity)
         effective_use_pref_affinity = use_pref_affinity && pref_aff.any();
 
-    if (explicit_aff || effective_use_pref_affinity || exclusive_new_affinity) {
-        // Check all vacant jobs: pending jobs for eGet,
-        //                        done/failed/cancel jobs for eRead
-        TNSBitVector    vacant_jobs;
-        if (cmd_group == eGet)
-            m_StatusTracker.GetJobs(CNetScheduleAPI::ePending, vacant_jobs);
-        else
-            m_StatusTracker.GetJobs(m_StatesForRead, vacant_jobs);
+    // The affinity registry keeps the jobs of each affinity so the
+    // candidates are collected from the affinities of interest and then
+    // restricted to the vacant jobs. The smallest job id is picked, i.e.
+    // the jobs are given out in the order of submission as before.
+    if (prioritized_aff &&
+        (explicit_aff || effective_use_pref_affinity ||
+         exclusive_new_affinity)) {
+        // The only criteria here is a list of explicit affinities
+        // respecting their order
+        TNSBitVector    vacant_jobs = m_AffinityRegistry.
+                                        GetJobsWithAffinities(explicit_affs);
+        x_RestrictToVacantJobs(client, scope, group_ids, has_groups,
+                               claimed_jobs, cmd_group, vacant_jobs);
+        if (!vacant_jobs.any())
+            return x_SJobPick();
 
-        if (scope.empty() || scope == kNoScopeOnly) {
-            // Both these cases should consider only the non-scope jobs
-            vacant_jobs -= m_ScopeRegistry.GetAllJobsInScopes();
-        } else {
-            // Consider only the jobs in the particular scope
-            vacant_jobs &= m_ScopeRegistry.GetJobs(scope);
+        for (vector<unsigned int>::const_iterator  k = aff_ids.begin();
+                k != aff_ids.end(); ++k) {
+            TNSBitVector    aff_jobs = m_AffinityRegistry.
+                                                GetJobsWithAffinity(*k);
+            TNSBitVector    candidates = vacant_jobs & aff_jobs;
+            if (candidates.any())
+                return x_SJobPick(*(candidates.first()), false, *k);
         }
+        return x_SJobPick();
+    }
 
-        // Exclude blacklisted jobs
-        m_ClientsRegistry.SubtractBlacklistedJobs(client, cmd_group,
-                                                  vacant_jobs);
-        // Keep only the group jobs if the groups are provided
-        if (has_groups)
-            m_GroupRegistry.RestrictByGroup(group_ids, vacant_jobs);
-
-        // Exclude jobs which have been read or in a process of reading
-        if (cmd_group == eRead)
-            vacant_jobs -= m_ReadJobs;
-
-        if (prioritized_aff) {
-            // The only criteria here is a list of explicit affinities
-            // respecting their order
-            for (vector<unsigned int>::const_iterator  k = aff_ids.begin();
-                    k != aff_ids.end(); ++k) {
-                TNSBitVector    aff_jobs = m_AffinityRegistry.
-                                                    GetJobsWithAffinity(*k);
-                TNSBitVector    candidates = vacant_jobs & aff_jobs;
-                if (candidates.any())
-                    return x_SJobPick(*(candidates.first()), false, *k);
-            }
-            return x_SJobPick();
+    if (explicit_aff) {
+        TNSBitVector    candidates = m_AffinityRegistry.
+                                        GetJobsWithAffinities(explicit_affs);
+        x_RestrictToVacantJobs(client, scope, group_ids, has_groups,
+                               claimed_jobs, cmd_group, candidates);
+        if (candidates.any()) {
+            unsigned int    job_id = *(candidates.first());
+            return x_SJobPick(job_id, false,
+                              m_GCRegistry.GetAffinityID(job_id));
         }
+    }
 
-        // HERE: no prioritized affinities
-        TNSBitVector    all_pref_aff;
-        if (exclusive_new_affinity)
-            all_pref_aff = m_ClientsRegistry.GetAllPreferredAffinities(
-                                                                    cmd_group);
-
-        TNSBitVector::enumerator    en(vacant_jobs.first());
-        for (; en.valid(); ++en) {
-            unsigned int    job_id = *en;
-
-            unsigned int    aff_id = m_GCRegistry.GetAffinityID(job_id);
-            if (aff_id != 0 && explicit_aff) {
-                if (explicit_affs.get_bit(aff_id))
-                    return x_SJobPick(job_id, false, aff_id);
-            }
-
-            if (aff_id != 0 && effective_use_pref_affinity) {
-                if (pref_aff.get_bit(aff_id)) {
-                    if (explicit_aff == false)
-                        return x_SJobPick(job_id, false, aff_id);
-                    if (pref_aff_candidate_job_id == 0)
-                        pref_aff_candidate_job_id = job_id;
-                    continue;
-                }
-            }
-
-            if (exclusive_new_affinity) {
-                if (aff_id == 0 || all_pref_aff.get_bit(aff_id) == false) {
-                    if (explicit_aff == false &&
-                        effective_use_pref_affinity == false)
-                        return x_SJobPick(job_id, true, aff_id);
-                    if (exclusive_aff_candidate == 0)
-                        exclusive_aff_candidate = job_id;
-                }
-            }
-        } // end for
-
-        if (pref_aff_candidate_job_id != 0)
-            return x_SJobPick(pref_aff_candidate_job_id, false, 0);
+    if (effective_use_pref_affinity) {
+        TNSBitVector    candidates = m_AffinityRegistry.
+                                        GetJobsWithAffinities(pref_aff);
+        x_RestrictToVacantJobs(client, scope, group_ids, has_groups,
+                               claimed_jobs, cmd_group, candidates);
+        if (candidates.any()) {
+            unsigned int    job_id = *(candidates.first());
+            if (explicit_aff)
+                return x_SJobPick(job_id, false, 0);
+            return x_SJobPick(job_id, false,
+                              m_GCRegistry.GetAffinityID(job_id));
+        }
+    }
 
-        if (exclusive_aff_candidate != 0)
-            return x_SJobPick(exclusive_aff_candidate, true,
-                              m_GCRegistry.GetAffinityID(
-                                                    exclusive_aff_candidate));
+    if (exclusive_new_affinity) {
+        // Jobs without affinity or with an affinity nobody prefers
+        TNSBitVector    candidates;
+        if (cmd_group == eGet)
+            m_StatusTracker.GetJobs(CNetScheduleAPI::ePending, candidates);
+        else
+            m_StatusTracker.GetJobs(m_StatesForRead, candidates);
+        candidates -= m_AffinityRegistry.GetJobsWithAffinities(
+                        m_ClientsRegistry.GetAllPreferredAffinities(
+                                                            cmd_group));
+        x_RestrictToVacantJobs(client, scope, group_ids, has_groups,
+                               claimed_jobs, cmd_group, candidates);
+        if (candidates.any()) {
+            unsigned int    job_id = *(candidates.first());
+            return x_SJobPick(job_id, true,
+                              m_GCRegistry.GetAffinityID(job_id));
+        }
     }
 
     // The second condition looks strange and it covers a very specific
@@ -2732,6 +2753,7 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
                 // NOTE: this only to avoid an expensive temporary bvector
                 m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
                                                      jobs_in_scope);
+                jobs_in_scope |= claimed_jobs;
                 if (has_groups)
                     job_id = m_StatusTracker.GetJobByStatus(
                                                 CNetScheduleAPI::ePending,
@@ -2748,6 +2770,7 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
                 // only the specific scope jobs
                 m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
                                                      jobs_in_scope);
+                jobs_in_scope |= claimed_jobs;
                 job_id = m_StatusTracker.GetJobByStatus(
                                             CNetScheduleAPI::ePending,
                                             jobs_in_scope,
@@ -2761,6 +2784,7 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
                 jobs_in_scope |= m_ReadJobs;
                 m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
                                                      jobs_in_scope);
+                jobs_in_scope |= claimed_jobs;
                 if (has_groups)
                     job_id = m_StatusTracker.GetJobByStatus(
                                     m_StatesForRead,
@@ -2780,6 +2804,7 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
                 jobs_in_scope = m_ReadJobs;
                 m_ClientsRegistry.AddBlacklistedJobs(client, cmd_group,
                                                      jobs_in_scope);
+                jobs_in_scope |= claimed_jobs;
                 job_id = m_StatusTracker.GetJobByStatus(
                                             m_StatesForRead,
                                             jobs_in_scope,
@@ -2793,6 +2818,85 @@ CQueue::x_FindVacantJob(const CNSClientId  &          client,
 }
 
 
+bool CQueue::x_CJobClaim::Claim(unsigned int  job_id)
+{
+    {{
+        CFastMutexGuard     guard(m_Queue.m_ClaimLock);
+
+        if (m_Queue.m_ClaimedJobs.get_bit(job_id))
+            return job_id == m_JobId;
+        m_Queue.m_ClaimedJobs.set_bit(job_id);
+    }}
+
+    Release();
+    m_JobId = job_id;
+    return true;
+}
+
+
+void CQueue::x_CJobClaim::Release(void)
+{
+    if (m_JobId == 0)
+        return;
+
+    CFastMutexGuard     guard(m_Queue.m_ClaimLock);
+    m_Queue.m_ClaimedJobs.set_bit(m_JobId, false);
+    m_JobId = 0;
+}
+
+
+TNSBitVector CQueue::x_GetClaimedJobs(void) const
+{
+    CFastMutexGuard     guard(m_ClaimLock);
+    return m_ClaimedJobs;
+}
+
+
+void CQueue::SyncJournal(void)
+{
+    if (m_Journal.get() != NULL)
+        m_Journal->Commit();
+}
+
+
+// Leaves only the jobs which could be given to the client
+void CQueue::x_RestrictToVacantJobs(const CNSClientId &   client,
+                                    const string &        scope,
+                                    const TNSBitVector &  group_ids,
+                                    bool                  has_groups,
+                                    const TNSBitVector &  claimed_jobs,
+                                    ECommandGroup         cmd_group,
+                                    TNSBitVector &        jobs)
+{
+    // Pending jobs for eGet, done/failed/cancel jobs for eRead
+    if (cmd_group == eGet)
+        m_StatusTracker.RestrictByStatus(CNetScheduleAPI::ePending, jobs);
+    else
+        m_StatusTracker.RestrictByStatus(m_StatesForRead, jobs);
+
+    if (scope.empty() || scope == kNoScopeOnly) {
+        // Both these cases should consider only the non-scope jobs
+        jobs -= m_ScopeRegistry.GetAllJobsInScopes();
+    } else {
+        // Consider only the jobs in the particular scope
+        jobs &= m_ScopeRegistry.GetJobs(scope);
+    }
+
+    // Exclude blacklisted jobs
+    m_ClientsRegistry.SubtractBlacklistedJobs(client, cmd_group, jobs);
+
+    // Keep only the group jobs if the groups are provided
+    if (has_groups)
+        m_GroupRegistry.RestrictByGroup(group_ids, jobs);
+
+    // Exclude jobs which have been read or in a process of reading
+    if (cmd_group == eRead)
+        jobs -= m_ReadJobs;
+
+    jobs -= claimed_jobs;
+}
+
+
 CQueue::x_SJobPick
 CQueue::x_FindOutdatedPendingJob(const CNSClientId &   client,
                                  unsigned int          picked_earlier,
@@ -2904,7 +3008,8 @@ TJobStatus CQueue::FailJob(const CNSClientId &    client,
                            const string &         output,
                            int                    ret_code,
                            bool                   no_retries,
-                           string                 warning)
+                           string                 warning,
+                           bool                   sync_journal)
 {
     unsigned        failed_retries;
     unsigned        max_output_size;
@@ -2941,6 +3046,7 @@ TJobStatus CQueue::FailJob(const CNSClientId &    client,
 
         {{
             CNSTransaction     transaction(this);
+            transaction.DeferJournalSync();
 
             if (job.Fetch(this, job_id) != CJob::eJF_Ok)
                 NCBI_THROW(CNetScheduleException, eInternalError,
@@ -3079,6 +3185,8 @@ TJobStatus CQueue::FailJob(const CNSClientId &    client,
                                                 job.GetLastEventIndex());
     }}
 
+    if (sync_journal)
+        SyncJournal();
     return old_status;
 }
 
@@ -3631,23 +3739,33 @@ unsigned int  CQueue::DeleteBatch(unsigned int  max_deleted)
                  ++en, ++n) {
                 unsigned int    job_id = *en;
 
-                try {
-                    m_QueueDbBlock->job_db.id = job_id;
-                    m_QueueDbBlock->job_db.Delete();
-                    ++del_rec;
-                    deleted_jobs.set_bit(job_id);
-                } catch (CBDB_ErrnoException& ex) {
-                    ERR_POST("BDB error " << ex.what());
-                }
+                if (m_Journal.get() != NULL) {
+                    try {
+                        m_Journal->EraseJob(job_id);
+                        ++del_rec;
+                        deleted_jobs.set_bit(job_id);
+                    } catch (const exception &  ex) {
+                        ERR_POST("Job journal error " << ex.what());
+                    }
+                } else {
+                    try {
+                        m_QueueDbBlock->job_db.id = job_id;
+                        m_QueueDbBlock->job_db.Delete();
+                        ++del_rec;
+                        deleted_jobs.set_bit(job_id);
+                    } catch (CBDB_ErrnoException& ex) {
+                        ERR_POST("BDB error " << ex.what());
+                    }
 
-                try {
-                    m_QueueDbBlock->job_info_db.id = job_id;
-                    m_QueueDbBlock->job_info_db.Delete();
-                } catch (CBDB_ErrnoException& ex) {
-                    ERR_POST("BDB error " << ex.what());
-                }
+                    try {
+                        m_QueueDbBlock->job_info_db.id = job_id;
+                        m_QueueDbBlock->job_info_db.Delete();
+                    } catch (CBDB_ErrnoException& ex) {
+                        ERR_POST("BDB error " << ex.what());
+                    }
 
-                x_DeleteJobEvents(job_id);
+                    x_DeleteJobEvents(job_id);
+                }
 
                 // The job might be the one which was given for reading
                 // so the garbage should be collected
@@ -3802,6 +3920,20 @@ unsigned int  CQueue::PurgeJobInfoCache(void)
 }
 
 
+void CQueue::CheckpointJournal(void)
+{
+    if (m_Journal.get() == NULL)
+        return;
+
+    try {
+        m_Journal->Checkpoint();
+    } catch (const exception &  ex) {
+        ERR_POST("Error checkpointing queue " << m_QueueName <<
+                 " job journal: " << ex.what());
+    }
+}
+
+
 void CQueue::x_DeleteJobEvents(unsigned int  job_id)
 {
     try {
@@ -4608,6 +4740,8 @@ void CQueue::x_UpdateDB_ProvideJobNoLock(const CNSClientId &     client,
 {
     CNSTransaction      transaction(this);
 
+    // The callers sync the journal after releasing the operation lock
+    transaction.DeferJournalSync();
     if (job.Fetch(this, job_id) != CJob::eJF_Ok)
         NCBI_THROW(CNetScheduleException, eInternalError, "Error fetching job");
 
@@ -4739,12 +4873,19 @@ unsigned int  CQueue::LoadFromDump(const string &  dump_dname)
     string          jobs_file_name = x_GetJobsDumpFileName(dump_dname);
     FILE *          jobs_file = NULL;
 
-    if (!CDir(dump_dname).Exists())
-        return 0;
-    if (!CFile(jobs_file_name).Exists())
+    if (!CDir(dump_dname).Exists() || !CFile(jobs_file_name).Exists()) {
+        // There were no jobs at the previous shutdown or the server crashed.
+        // In the latter case the job journal has the jobs.
+        if (m_Journal.get() != NULL)
+            return x_LoadFromJournal();
         return 0;
+    }
 
     try {
+        // The dump is newer than anything in the job journal
+        if (m_Journal.get() != NULL)
+            m_Journal->Reset();
+
         m_AffinityRegistry.LoadFromDump(dump_dname, m_QueueName);
         m_GroupRegistry.LoadFromDump(dump_dname, m_QueueName);
 
@@ -4757,52 +4898,20 @@ unsigned int  CQueue::LoadFromDump(const string &  dump_dname)
         AutoArray<char>     input_buf(new char[kNetScheduleMaxOverflowSize]);
         AutoArray<char>     output_buf(new char[kNetScheduleMaxOverflowSize]);
         while (job.LoadFromDump(jobs_file, input_buf.get(), output_buf.get())) {
-            unsigned int    job_id = job.GetId();
-            unsigned int    group_id = job.GetGroupId();
-            unsigned int    aff_id = job.GetAffinityId();
-            TJobStatus      status = job.GetStatus();
-
-            {
+            if (m_Journal.get() != NULL) {
+                // All the loaded jobs are committed at once below
+                job.Flush(this);
+            } else {
                 CNSTransaction      transaction(this);
                 job.Flush(this);
                 transaction.Commit();
             }
 
-            m_StatusTracker.SetExactStatusNoLock(job_id, status, true);
-
-            if ((status == CNetScheduleAPI::eRunning ||
-                 status == CNetScheduleAPI::eReading) &&
-                m_RunTimeLine) {
-                // Add object to the first available slot;
-                // it is going to be rescheduled or dropped
-                // in the background control thread
-                // We can use time line without lock here because
-                // the queue is still in single-use mode while
-                // being loaded.
-                m_RunTimeLine->AddObject(m_RunTimeLine->GetHead(), job_id);
-            }
-
-            // Register the job for the affinity if so
-            if (aff_id != 0)
-                m_AffinityRegistry.AddJobToAffinity(job_id, aff_id);
-
-            // Register the job in the group registry
-            if (group_id != 0)
-                m_GroupRegistry.AddJobToGroup(group_id, job_id);
-
-            // Register the loaded job with the garbage collector
-            CNSPreciseTime  submit_time = job.GetSubmitTime();
-            CNSPreciseTime  expiration =
-                    GetJobExpirationTime(job.GetLastTouch(), status,
-                                         submit_time, job.GetTimeout(),
-                                         job.GetRunTimeout(),
-                                         job.GetReadTimeout(),
-                                         m_Timeout, m_RunTimeout, m_ReadTimeout,
-                                         m_PendingTimeout, kTimeZero);
-            m_GCRegistry.RegisterJob(job_id, job.GetSubmitTime(),
-                                     aff_id, group_id, expiration);
+            x_RegisterLoadedJob(job);
             ++recs;
         }
+        if (m_Journal.get() != NULL)
+            m_Journal->Commit();
 
         // Make sure that there are no affinity IDs in the registry for which
         // there are no jobs and initialize the next affinity ID counter.
@@ -4832,15 +4941,116 @@ unsigned int  CQueue::LoadFromDump(const string &  dump_dname)
 }
 
 
-// The member does not grab the operational lock.
-// The member is used at the time of loading jobs from dump and at that time
-// there is no concurrent access.
-void CQueue::x_ClearQueue(void)
+// The member is used at the time of loading jobs from the job journal
+unsigned int  CQueue::x_LoadFromJournal(void)
 {
-    // Form a bit vector of all jobs to remove
-    TNSBitVector            jobs_to_erase;
+    unsigned int    recs = 0;
+
+    try {
+        m_Journal->Recover();
+
+        const map<unsigned int, string> &   aff_tokens =
+                                            m_Journal->GetAffinityTokens();
+        const map<unsigned int, string> &   group_tokens =
+                                            m_Journal->GetGroupTokens();
+        m_AffinityRegistry.LoadFromJournal(aff_tokens);
+        m_GroupRegistry.LoadFromJournal(group_tokens);
+
+        CJob            job;
+        for (unsigned int  job_id = m_Journal->GetNextJobID(0); job_id != 0;
+                job_id = m_Journal->GetNextJobID(job_id)) {
+            if (job.Fetch(this, job_id) != CJob::eJF_Ok)
+                continue;
+
+            unsigned int    aff_id = job.GetAffinityId();
+            unsigned int    group_id = job.GetGroupId();
+            if ((aff_id != 0 && aff_tokens.find(aff_id) == aff_tokens.end()) ||
+                (group_id != 0 &&
+                 group_tokens.find(group_id) == group_tokens.end())) {
+                ERR_POST("Job " << DecorateJob(job_id) << " in the journal "
+                         "refers to an unknown affinity or group. "
+                         "The job is dropped.");
+                m_Journal->EraseJob(job_id);
+                continue;
+            }
+
+            x_RegisterLoadedJob(job);
+            ++recs;
+        }
+
+        m_AffinityRegistry.FinalizeAffinityDictionaryLoading();
+        m_GroupRegistry.FinalizeGroupDictionaryLoading();
+    } catch (const exception &  ex) {
+        // The journal is the only copy of the jobs so it is not discarded.
+        // It is moved aside and stays closed, i.e. the queue cannot change
+        // jobs till the server is restarted.
+        string      message = "Error loading queue " + m_QueueName +
+                              " from its job journal: " + ex.what();
+        TNSBitVector    loaded_jobs;
+        x_ClearRegistries(&loaded_jobs);
+        try {
+            message += ". The journal is moved to " + m_Journal->SetAside();
+        } catch (const exception &  aside_ex) {
+            message += ". The journal is left in place: " +
+                       string(aside_ex.what());
+        }
+        throw runtime_error(message);
+    }
+    return recs;
+}
+
+
+// Registers a job loaded from the dump or from the job journal in all the
+// in-memory structures. There is no concurrent access at that time.
+void CQueue::x_RegisterLoadedJob(const CJob &  job)
+{
+    unsigned int    job_id = job.GetId();
+    unsigned int    group_id = job.GetGroupId();
+    unsigned int    aff_id = job.GetAffinityId();
+    TJobStatus      status = job.GetStatus();
+
+    m_StatusTracker.SetExactStatusNoLock(job_id, status, true);
+
+    if ((status == CNetScheduleAPI::eRunning ||
+         status == CNetScheduleAPI::eReading) &&
+        m_RunTimeLine) {
+        // Add object to the first available slot;
+        // it is going to be rescheduled or dropped
+        // in the background control thread
+        // We can use time line without lock here because
+        // the queue is still in single-use mode while
+        // being loaded.
+        m_RunTimeLine->AddObject(m_RunTimeLine->GetHead(), job_id);
+    }
 
-    m_StatusTracker.ClearAll(&jobs_to_erase);
+    // Register the job for the affinity if so
+    if (aff_id != 0)
+        m_AffinityRegistry.AddJobToAffinity(job_id, aff_id);
+
+    // Register the job in the group registry
+    if (group_id != 0)
+        m_GroupRegistry.AddJobToGroup(group_id, job_id);
+
+    // Register the loaded job with the garbage collector
+    CNSPreciseTime  submit_time = job.GetSubmitTime();
+    CNSPreciseTime  expiration =
+            GetJobExpirationTime(job.GetLastTouch(), status,
+                                 submit_time, job.GetTimeout(),
+                                 job.GetRunTimeout(),
+                                 job.GetReadTimeout(),
+                                 m_Timeout, m_RunTimeout, m_ReadTimeout,
+                                 m_PendingTimeout, kTimeZero);
+    m_GCRegistry.RegisterJob(job_id, job.GetSubmitTime(),
+                             aff_id, group_id, expiration);
+}
+
+
+// Clears the in-memory structures only and provides the jobs which were
+// in the queue. Used at the time of loading jobs; there is no concurrent
+// access at that time.
+void CQueue::x_ClearRegistries(TNSBitVector *  jobs)
+{
+    m_StatusTracker.ClearAll(jobs);
     m_RunTimeLine->ReInit();
     m_JobsToDelete.clear(true);
     m_ReadJobs.clear(true);
@@ -4850,6 +5060,28 @@ void CQueue::x_ClearQueue(void)
     m_GroupRegistry.Clear();
     m_GCRegistry.Clear();
     m_ScopeRegistry.Clear();
+}
+
+
+// The member does not grab the operational lock.
+// The member is used at the time of loading jobs from dump and at that time
+// there is no concurrent access.
+void CQueue::x_ClearQueue(void)
+{
+    // Form a bit vector of all jobs to remove
+    TNSBitVector            jobs_to_erase;
+
+    x_ClearRegistries(&jobs_to_erase);
+
+    if (m_Journal.get() != NULL) {
+        try {
+            m_Journal->Reset();
+        } catch (const exception &  ex) {
+            ERR_POST("Error while clearing the queue " << m_QueueName <<
+                     " job journal: " << ex.what());
+        }
+        return;
+    }
 
     TNSBitVector::enumerator    en = jobs_to_erase.first();
     for ( ; en.valid(); ++en) {
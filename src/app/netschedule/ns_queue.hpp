@@ -62,6 +62,7 @@
 #include "ns_job_info_cache.hpp"
 #include "ns_scope.hpp"
 #include "ns_server_params.hpp"
+#include "ns_job_journal.hpp"
 
 #include <deque>
 #include <map>
@@ -123,7 +124,9 @@ public:
            CQueueDataBase &      qdb);
     ~CQueue();
 
-    void Attach(SQueueDbBlock* block);
+    // The queue takes ownership of the journal. If the journal is given
+    // the jobs are stored in it instead of the block tables.
+    void Attach(SQueueDbBlock* block, CNSJobJournal* journal = NULL);
     int  GetPos() const { return m_QueueDbBlock->pos; }
     TQueueKind GetQueueKind(void) const { return m_Kind; }
 
@@ -192,7 +195,8 @@ public:
                           CJob &                  job,
                           const string &          auth_token,
                           int                     ret_code,
-                          const string &          output);
+                          const string &          output,
+                          bool                    sync_journal = true);
 
     bool GetJobOrWait(const CNSClientId &       client,
                       unsigned short            port, // Port the client
@@ -208,7 +212,8 @@ public:
                       const list<string> *      group_list,
                       CJob *                    new_job,
                       CNSRollbackInterface * &  rollback_action,
-                      string &                  added_pref_aff);
+                      string &                  added_pref_aff,
+                      bool                      sync_journal = true);
 
     void CancelWaitGet(const CNSClientId &  client);
     void CancelWaitRead(const CNSClientId &  client);
@@ -361,10 +366,17 @@ public:
                        const string &         output,
                        int                    ret_code,
                        bool                   no_retries,
-                       string                 warning);
+                       string                 warning,
+                       bool                   sync_journal = true);
 
     string  GetAffinityTokenByID(unsigned int  aff_id) const;
 
+    // The GET/PUT/FPUT operations make their job changes durable before
+    // returning unless they are called with sync_journal == false. The batch
+    // commands use it to make the changes of all the jobs in the batch
+    // durable with one sync.
+    void SyncJournal(void);
+
     void ClearWorkerNode(const CNSClientId &  client,
                          bool &               client_was_found,
                          string &             old_session,
@@ -411,6 +423,7 @@ public:
     void          PurgeBlacklistedJobs(void);
     void          PurgeClientRegistry(const CNSPreciseTime &  current_time);
     unsigned int  PurgeJobInfoCache(void);
+    void          CheckpointJournal(void);
 
     CBDB_FileCursor& GetEventsCursor();
 
@@ -523,6 +536,13 @@ private:
                     const TNSBitVector &          group_ids,
                     bool                          has_groups,
                     ECommandGroup                 cmd_group);
+    void x_RestrictToVacantJobs(const CNSClientId &   client,
+                                const string &        scope,
+                                const TNSBitVector &  group_ids,
+                                bool                  has_groups,
+                                const TNSBitVector &  claimed_jobs,
+                                ECommandGroup         cmd_group,
+                                TNSBitVector &        jobs);
     x_SJobPick
     x_FindOutdatedPendingJob(const CNSClientId &  client,
                              unsigned int         picked_earlier,
@@ -532,6 +552,33 @@ private:
                                 unsigned int         picked_earlier,
                                 const TNSBitVector & group_ids);
 
+    // Exclusive right of a GET or READ to commit the job it has picked.
+    // The claim is made before m_OperationLock is taken so the concurrent
+    // pickers do not queue for the lock with the same job: a picker which
+    // fails to claim a job looks for another one right away.
+    class x_CJobClaim
+    {
+        public:
+            x_CJobClaim(CQueue &  queue) :
+                m_Queue(queue), m_JobId(0)
+            {}
+            ~x_CJobClaim()
+            { Release(); }
+
+            // Claims the job and releases the previously claimed one.
+            // Provides false (keeping the previous claim) if the job has
+            // been claimed by somebody else.
+            bool Claim(unsigned int  job_id);
+            void Release(void);
+
+        private:
+            CQueue &        m_Queue;
+            unsigned int    m_JobId;
+    };
+    friend class x_CJobClaim;
+
+    TNSBitVector x_GetClaimedJobs(void) const;
+
     void x_UpdateDB_PutResultNoLock(unsigned                job_id,
                                     const string &          auth_token,
                                     const CNSPreciseTime &  curr,
@@ -611,6 +658,9 @@ private:
 
     string x_GetJobsDumpFileName(const string &  dump_dname) const;
     void x_ClearQueue(void);
+    void x_ClearRegistries(TNSBitVector *  jobs);
+    void x_RegisterLoadedJob(const CJob &  job);
+    unsigned int x_LoadFromJournal(void);
 
 private:
     friend class CJob;
@@ -633,12 +683,21 @@ private:
 
     SQueueDbBlock *             m_QueueDbBlock;
     bool                        m_TruncateAtDetach;
+    // Replaces the m_QueueDbBlock tables if the journal storage is used
+    auto_ptr<CNSJobJournal>     m_Journal;
 
     auto_ptr<CBDB_FileCursor>   m_EventsCursor;    // DB cursor for EventsDB
 
-    // Lock for a queue operations
+    // Lock for a queue operations.
+    // The locks are taken in the following order: m_OperationLock, then
+    // the registries own locks, then m_StatusTracker. m_ClaimLock and the
+    // job journal lock are never held while taking another lock.
     mutable CFastMutex          m_OperationLock;
 
+    // Jobs picked by GET/READ and not committed yet; see x_CJobClaim
+    mutable CFastMutex          m_ClaimLock;
+    TNSBitVector                m_ClaimedJobs;
+
     // Registry of all the clients for the queue
     CNSClientsRegistry          m_ClientsRegistry;
 
@@ -825,8 +884,12 @@ public:
                    int                   what_tables = eAllTables,
                    ETransSync            tsync = eEnvDefault,
                    EKeepFileAssociation  assoc = eNoAssociation)
-        : CBDB_Transaction(queue->GetEnv(), tsync, assoc)
+        : CBDB_Transaction(queue->GetEnv(), tsync, assoc),
+          m_Journal(queue->m_Journal.get()),
+          m_JournalSync(true)
     {
+        // With the journal storage no BDB transaction is really started:
+        // it is created lazily at the first table access.
         if (what_tables & eJobTable)
             queue->m_QueueDbBlock->job_db.SetTransaction(this);
 
@@ -836,6 +899,25 @@ public:
         if (what_tables & eJobEventsTable)
             queue->m_QueueDbBlock->events_db.SetTransaction(this);
     }
+
+    // The journal records are made durable later by the caller, see
+    // CQueue::SyncJournal(). It lets the concurrent operations share one
+    // disk sync instead of syncing while the queue lock is held.
+    void DeferJournalSync(void)
+    {
+        m_JournalSync = false;
+    }
+
+    void Commit(void)
+    {
+        CBDB_Transaction::Commit();
+        if (m_Journal != NULL && m_JournalSync)
+            m_Journal->Commit();
+    }
+
+private:
+    CNSJobJournal *     m_Journal;
+    bool                m_JournalSync;
 };
 
 
@@ -109,6 +109,30 @@ void CNSGetJobRollback::Rollback(CQueue *  queue)
 }
 
 
+void CNSBatchGetJobRollback::Rollback(CQueue *  queue)
+{
+    ERR_POST(Warning << "Rolling back job batch request due to "
+                        "a network error while reporting the job keys.");
+
+    try {
+        for (size_t  k = 0; k < m_JobIds.size(); ++k) {
+            string  warning;    // used for auth tokens only, so
+                                // not analyzed here
+            CJob    job;        // Not used here
+
+            queue->ReturnJob(m_Client, m_JobIds[k],
+                             queue->MakeJobKey(m_JobIds[k]),
+                             job, "", warning, CQueue::eRollback);
+        }
+    } catch (const exception &  ex) {
+        ERR_POST("Error while rolling back requested job batch: "
+                 << ex.what());
+    } catch (...) {
+        ERR_POST("Unknown error while rolling back requested job batch");
+    }
+}
+
+
 void CNSReadJobRollback::Rollback(CQueue *  queue)
 {
     ERR_POST(Warning << "Rolling back reading job request due to "
@@ -77,6 +77,10 @@ const string    kStartJobIDsFileName("STARTJOBIDS");
 const string    kNodeIDFileName("NODE_ID");
 const string    kCrashFlagFileName("CRASH_FLAG");
 const string    kDumpErrorFlagFileName("DUMP_ERROR_FLAG");
+const string    kJournalSubdirName("journal");
+const string    kJournalSnapshotPrefix("jobs.snapshot.");
+const string    kJournalFilePrefix("jobs.journal.");
+const string    kJournalSetAsideSuffix(".failed");
 const size_t    kDumpReservedSpaceFileBuffer = 1024 * 1024;
 
 // Various hex viewers show this magic in a different way.
@@ -84,6 +88,7 @@ const size_t    kDumpReservedSpaceFileBuffer = 1024 * 1024;
 // Some reverse the signature byte by byte. So the magic is selected to be
 // visible the same way everywhere.
 const Int4      kDumpMagic(0xD0D0D0D0);
+const Int4      kJournalMagic(0xB1B1B1B1);
 
 
 // An empty bit vector is returned in quite a few places
@@ -102,6 +102,15 @@ bool SNSDBEnvironmentParams::Read(const IRegistry& reg, const string& sname)
     direct_db         = GetBoolNoErr("direct_db", false);
     direct_log        = GetBoolNoErr("direct_log", false);
     private_env       = GetBoolNoErr("private_env", false);
+
+    string  storage_engine = bdb_conf.GetString("netschedule",
+                                                "storage_engine",
+                                                CConfig::eErr_NoThrow, "bdb");
+    use_journal = NStr::CompareNocase(storage_engine, "journal") == 0;
+    if (!use_journal && NStr::CompareNocase(storage_engine, "bdb") != 0)
+        ERR_POST(Warning << "Unknown storage_engine value '" <<
+                 storage_engine << "'. Berkeley DB is used.");
+    journal_max_size  = GetSizeNoErr("journal_max_size", 256 * 1024 * 1024);
     return true;
 }
 
@@ -127,6 +136,12 @@ CQueueDataBase::CQueueDataBase(CNetScheduleServer *            server,
     m_DataPath = CDirEntry::AddTrailingPathSeparator(params.db_path);
     m_DumpPath = CDirEntry::AddTrailingPathSeparator(m_DataPath +
                                                      kDumpSubdirName);
+    m_JournalPath = CDirEntry::AddTrailingPathSeparator(m_DataPath +
+                                                        kJournalSubdirName);
+    m_UseJournal = params.use_journal;
+    m_SyncJournal = params.sync_transactions;
+    m_JournalMaxSize = params.journal_max_size;
+    m_JournalsLoaded = false;
 
     // First, load the previous session start job IDs if file existed
     m_Server->LoadJobsStartIDs();
@@ -295,6 +310,10 @@ void  CQueueDataBase::x_Open(const SNSDBEnvironmentParams &  params,
         ++queue_load_error_count;
     }
 
+    if (m_UseJournal)
+        x_RemoveUnusedJournals();
+    m_JournalsLoaded = true;
+
     x_CreateCrashFlagFile();
     x_CreateDumpErrorFlagFile();
     x_CreateStorageVersionFile();
@@ -1033,10 +1052,19 @@ CQueueDataBase::x_CreateAndMountQueue(const string &            qname,
 {
     auto_ptr<CQueue>    q(new CQueue(m_Executor, qname,
                                      params.kind, m_Server, *this));
+    CNSJobJournal *     journal = NULL;
 
-    q->Attach(queue_db_block);
+    if (m_UseJournal)
+        journal = new CNSJobJournal(m_JournalPath + qname,
+                                    m_SyncJournal, m_JournalMaxSize);
+    q->Attach(queue_db_block, journal);
     q->SetParameters(params);
 
+    // At startup the journal is opened when the jobs are loaded.
+    // A queue created later starts with an empty journal.
+    if (journal != NULL && m_JournalsLoaded)
+        journal->Reset();
+
     m_Queues[qname] = make_pair(params, q.release());
 
     GetDiagContext().Extra()
@@ -1279,6 +1307,12 @@ void CQueueDataBase::Close(void)
         // m_QueueDbBlockArray.Close();
     }
 
+    // The jobs are in the dump now (or there are no jobs at all) so the job
+    // journal is not needed. Should dumping fail, the journal is used
+    // at the next start.
+    if (m_UseJournal && !x_DoesDumpErrorFlagFileExist())
+        CDir(m_JournalPath).Remove();
+
     delete m_Env;
     m_Env = 0;
 
@@ -1293,6 +1327,14 @@ void CQueueDataBase::TransactionCheckPoint(bool clean_log)
     m_Env->TransactionCheckpoint();
     if (clean_log)
         m_Env->CleanLog();
+
+    if (m_UseJournal) {
+        CRef<CQueue>    queue = x_GetFirst();
+        while (queue.IsNull() == false) {
+            queue->CheckpointJournal();
+            queue = x_GetNext(queue->GetQueueName());
+        }
+    }
 }
 
 
@@ -2446,6 +2488,34 @@ void CQueueDataBase::x_RemoveDump(void)
 }
 
 
+// Removes the job journals of the queues which have not been mounted,
+// e.g. dynamic queues after a crash
+void CQueueDataBase::x_RemoveUnusedJournals(void)
+{
+    CDir        journal_dir(m_JournalPath);
+    if (!journal_dir.Exists())
+        return;
+
+    CDir::TEntries      entries = journal_dir.GetEntries(
+                                    kEmptyStr, CDir::fIgnoreRecursive);
+    for (CDir::TEntries::const_iterator  k = entries.begin();
+            k != entries.end(); ++k) {
+        if (!(*k)->IsDir())
+            continue;
+
+        string      entryName = (*k)->GetName();
+        if (m_Queues.find(entryName) != m_Queues.end())
+            continue;
+
+        LOG_POST(Note << "Removing the job journal of unknown queue "
+                      << entryName);
+        try {
+            CDir(m_JournalPath + entryName).Remove();
+        } catch (...) {}
+    }
+}
+
+
 void CQueueDataBase::x_RemoveBDBFiles(void)
 {
     CDir        data_dir(m_DataPath);
@@ -2480,6 +2550,18 @@ void CQueueDataBase::x_RemoveBDBFiles(void)
 // status.
 bool CQueueDataBase::x_CheckOpenPreconditions(bool  reinit)
 {
+    if (x_DoesCrashFlagFileExist() && m_UseJournal && !reinit &&
+        CDir(m_JournalPath).Exists()) {
+        ERR_POST("The server did not stop gracefully last time. "
+                 "The jobs are restored from the job journal in "
+                 << m_JournalPath);
+        m_Server->RegisterAlert(eStartAfterCrash, "The server did not stop "
+                                "gracefully last time. The jobs have been "
+                                "restored from the job journal. Dynamic "
+                                "queues and their jobs are lost.");
+        return false;
+    }
+
     if (x_DoesCrashFlagFileExist()) {
         ERR_POST("Reinitialization due to the server "
                  "did not stop gracefully last time. "
@@ -86,6 +86,10 @@ struct SNSDBEnvironmentParams
     bool      direct_log;
     bool      private_env;
 
+    // Jobs storage: Berkeley DB tables or the job journal
+    bool      use_journal;
+    unsigned  journal_max_size;    // Journal size which triggers a snapshot
+
     bool Read(const IRegistry& reg, const string& sname);
 };
 
@@ -203,6 +207,7 @@ private:
     void x_CreateAndMountQueue(const string &            qname,
                                const SQueueParameters &  params,
                                SQueueDbBlock *           queue_db_block);
+    void x_RemoveUnusedJournals(void);
 
     unsigned x_PurgeUnconditional(void);
     void     x_OptimizeStatusMatrix(const CNSPreciseTime &  current_time);
@@ -214,6 +219,11 @@ private:
     CBDB_Env *           m_Env;
     string               m_DataPath;
     string               m_DumpPath;
+    string               m_JournalPath;
+    bool                 m_UseJournal;
+    bool                 m_SyncJournal;
+    unsigned int         m_JournalMaxSize;
+    bool                 m_JournalsLoaded;    // Startup loading is over
 
     mutable CFastMutex   m_ConfigureLock;
 
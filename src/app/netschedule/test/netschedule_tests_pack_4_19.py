@@ -12,6 +12,7 @@ from netschedule_tests_pack import TestBase
 from netschedule_tests_pack_4_10 import execAny
 
 from cgi import parse_qs
+from urllib import quote
 import socket
 import time
 
@@ -755,3 +756,129 @@ class Scenario1813( TestBase ):
             raise Exception( "Expected a job, got nothing: " + str(output) )
         return True
 
+
+
+def putBatchEntry( jobID, passport, output, errMsg = None ):
+    " Provides one line of the PUTB jobs argument "
+    entry = 'job_key=' + quote( jobID ) + \
+            '&auth_token=' + quote( passport ) + \
+            '&job_return_code=0&output=' + quote( output )
+    if errMsg is not None:
+        entry += '&err_msg=' + quote( errMsg )
+    return entry
+
+def putBatchCmd( entries ):
+    " Provides the PUTB command for the given job lines "
+    jobs = "\n".join( entries )
+    jobs = jobs.replace( '\\', '\\\\' ).replace( '"', '\\"' )
+    return 'PUTB jobs="' + jobs.replace( '\n', '\\n' ) + '"'
+
+
+class Scenario1900( TestBase ):
+    " Scenario 1900 "
+
+    def __init__( self, netschedule ):
+        TestBase.__init__( self, netschedule )
+
+    @staticmethod
+    def getScenario():
+        " Provides the scenario "
+        return "SUBMIT 3 jobs, GETB count=2 -> 2 jobs, " \
+               "GETB count=2 -> 1 job, GETB count=2 -> no jobs"
+
+    def execute( self ):
+        " Should return True if the execution completed successfully "
+        self.fromScratch()
+        jobIDs = [ self.ns.submitJob( 'TEST', 'bla' + str( k ) )
+                   for k in range( 3 ) ]
+
+        ns_client = self.getNetScheduleService( 'TEST', 'scenario1900' )
+        ns_client.set_client_identification( 'node', 'session' )
+
+        received = []
+        for expected in [ 2, 1 ]:
+            output = execAny( ns_client,
+                              'GETB count=2 wnode_aff=0 any_aff=1' )
+            values = parse_qs( output, True, True )
+            if len( values.get( 'job', [] ) ) != expected:
+                raise Exception( "Expected " + str( expected ) +
+                                 " jobs, received: " + output )
+            for job in values[ 'job' ]:
+                jobValues = parse_qs( job, True, True )
+                if 'auth_token' not in jobValues:
+                    raise Exception( "No auth_token in GETB job: " + job )
+                received.append( jobValues[ 'job_key' ][ 0 ] )
+
+        if sorted( received ) != sorted( jobIDs ):
+            raise Exception( "Expected jobs " + str( jobIDs ) +
+                             ", received " + str( received ) )
+
+        output = execAny( ns_client, 'GETB count=2 wnode_aff=0 any_aff=1' )
+        if output != "":
+            raise Exception( "Expected no jobs, received some: " + output )
+
+        for jobID in jobIDs:
+            status = self.ns.getFastJobStatus( 'TEST', jobID )
+            if status != "Running":
+                raise Exception( "Unexpected job status: " + status )
+        return True
+
+
+class Scenario1901( TestBase ):
+    " Scenario 1901 "
+
+    def __init__( self, netschedule ):
+        TestBase.__init__( self, netschedule )
+
+    @staticmethod
+    def getScenario():
+        " Provides the scenario "
+        return "SUBMIT 3 jobs, GETB count=3, PUTB with a result, " \
+               "a failure and a wrong auth_token -> per job results"
+
+    def execute( self ):
+        " Should return True if the execution completed successfully "
+        self.fromScratch()
+        jobID1 = self.ns.submitJob( 'TEST', 'bla1' )
+        jobID2 = self.ns.submitJob( 'TEST', 'bla2' )
+        jobID3 = self.ns.submitJob( 'TEST', 'bla3' )
+
+        ns_client = self.getNetScheduleService( 'TEST', 'scenario1901' )
+        ns_client.set_client_identification( 'node', 'session' )
+
+        output = execAny( ns_client, 'GETB count=3 wnode_aff=0 any_aff=1' )
+        passports = {}
+        for job in parse_qs( output, True, True )[ 'job' ]:
+            jobValues = parse_qs( job, True, True )
+            passports[ jobValues[ 'job_key' ][ 0 ] ] = \
+                                        jobValues[ 'auth_token' ][ 0 ]
+        if len( passports ) != 3:
+            raise Exception( "Expected 3 jobs, received: " + output )
+
+        output = execAny( ns_client, putBatchCmd( [
+                    putBatchEntry( jobID1, passports[ jobID1 ], 'done' ),
+                    putBatchEntry( jobID2, passports[ jobID2 ], '',
+                                   'failed' ),
+                    putBatchEntry( jobID3, 'wrong' + passports[ jobID3 ],
+                                   'done' ) ] ) )
+        results = parse_qs( output, True, True )
+        if results.get( jobID1 ) != [ 'OK' ]:
+            raise Exception( "Unexpected result for the done job: " + output )
+        if results.get( jobID2 ) != [ 'OK' ]:
+            raise Exception( "Unexpected result for the failed job: " +
+                             output )
+        if not results.get( jobID3, [ '' ] )[ 0 ].startswith( 'ERR:' ):
+            raise Exception( "Expected an error for the job with a wrong " \
+                             "auth_token: " + output )
+
+        # The error of one job does not prevent committing the others
+        status = self.ns.getFastJobStatus( 'TEST', jobID1 )
+        if status != "Done":
+            raise Exception( "Unexpected done job status: " + status )
+        status = self.ns.getFastJobStatus( 'TEST', jobID2 )
+        if status not in [ "Failed", "Pending" ]:
+            raise Exception( "Unexpected failed job status: " + status )
+        status = self.ns.getFastJobStatus( 'TEST', jobID3 )
+        if status != "Running":
+            raise Exception( "Unexpected wrong auth job status: " + status )
+        return True
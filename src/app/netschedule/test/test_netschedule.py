@@ -745,6 +745,9 @@ def main():
               pack_4_19.Scenario1811( netschedule ),
               pack_4_19.Scenario1812( netschedule ),
               pack_4_19.Scenario1813( netschedule ),
+
+              pack_4_19.Scenario1900( netschedule ),
+              pack_4_19.Scenario1901( netschedule ),
             ]
 
     # Calculate the start test index
@@ -0,0 +1,328 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  NetSchedule load generator. Measures the GET/PUT
+ *                    throughput of a queue depending on the number of
+ *                    worker nodes which poll it simultaneously.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbitime.hpp>
+
+#include <connect/services/netschedule_api.hpp>
+#include <connect/ncbi_core_cxx.hpp>
+
+#include <sys/types.h>
+#include <unistd.h>
+
+
+USING_NCBI_SCOPE;
+
+
+///////////////////////////////////////////////////////////////////////
+
+/// One simulated worker node: takes jobs and puts results until the queue
+/// has no more jobs for it
+///
+/// @internal
+///
+class CLoadWorker : public CThread
+{
+public:
+    CLoadWorker(const string &  service,
+                const string &  queue,
+                const string &  node,
+                const string &  affinity,
+                unsigned int    batch) :
+        m_API(service, "load_test", queue),
+        m_Affinity(affinity),
+        m_Batch(batch),
+        m_Processed(0),
+        m_Errors(0)
+    {
+        m_API.SetProgramVersion("load_test wn 1.0.0");
+        m_API.SetClientNode(node);
+        m_API.SetClientSession("load_test_session");
+    }
+
+    unsigned int  GetProcessed(void) const { return m_Processed; }
+    unsigned int  GetErrors(void) const    { return m_Errors; }
+
+protected:
+    virtual void *  Main(void)
+    {
+        CNetScheduleExecutor    executor = m_API.GetExecutor();
+
+        if (!m_Affinity.empty())
+            executor.SetAffinityPreference(
+                            CNetScheduleExecutor::eExplicitAffinitiesOnly);
+
+        for (;;) {
+            try {
+                if (m_Batch > 1) {
+                    if (!x_ProcessBatch(executor))
+                        break;
+                    continue;
+                }
+
+                CNetScheduleJob     job;
+                if (!executor.GetJob(job, m_Affinity))
+                    break;
+                job.output = "JOB DONE";
+                executor.PutResult(job);
+                ++m_Processed;
+            } catch (const CException &  ex) {
+                ERR_POST(ex.what());
+                if (++m_Errors > 100)
+                    break;
+            }
+        }
+        return NULL;
+    }
+
+private:
+    // Gets and commits up to m_Batch jobs at once
+    bool x_ProcessBatch(CNetScheduleExecutor &  executor)
+    {
+        vector<CNetScheduleJob>     jobs;
+        if (!executor.GetJobs(jobs, m_Batch, m_Affinity))
+            return false;
+
+        CNetScheduleExecutor::TJobCommits   commits;
+        for (size_t  k = 0; k < jobs.size(); ++k) {
+            jobs[k].output = "JOB DONE";
+            commits.push_back(CNetScheduleExecutor::SJobCommit(
+                                jobs[k], CNetScheduleExecutor::eCommitResult));
+        }
+        executor.CommitJobs(commits);
+
+        for (size_t  k = 0; k < commits.size(); ++k) {
+            if (commits[k].error.empty())
+                ++m_Processed;
+            else {
+                ERR_POST(commits[k].job->job_id << ": " << commits[k].error);
+                ++m_Errors;
+            }
+        }
+        return true;
+    }
+
+private:
+    CNetScheduleAPI     m_API;
+    string              m_Affinity;
+    unsigned int        m_Batch;
+    unsigned int        m_Processed;
+    unsigned int        m_Errors;
+};
+
+
+/// Test application
+///
+/// @internal
+///
+class CTestNetScheduleLoad : public CNcbiApplication
+{
+public:
+    void Init(void);
+    int Run(void);
+
+private:
+    void  x_Submit(CNetScheduleSubmitter &  submitter,
+                   unsigned int             jcount,
+                   unsigned int             naff);
+    void  x_RunWorkers(const string &  service,
+                       const string &  queue,
+                       unsigned int    nworkers,
+                       unsigned int    naff,
+                       unsigned int    batch);
+};
+
+
+void CTestNetScheduleLoad::Init(void)
+{
+    // Avoid sockets to stay in TIME_WAIT state
+    GetConfig().Set("netservice_api", "use_linger2", "true",
+                    IRegistry::fNoOverride);
+
+    CONNECT_Init();
+    SetDiagPostLevel(eDiag_Warning);
+
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "NetSchedule GET/PUT load generator");
+
+    arg_desc->AddKey("service",
+                     "service_name",
+                     "NetSchedule service name (format: host:port or service_name).",
+                     CArgDescriptions::eString);
+
+    arg_desc->AddKey("queue",
+                     "queue_name",
+                     "NetSchedule queue name (like: noname).",
+                     CArgDescriptions::eString);
+
+    arg_desc->AddDefaultKey("jobs",
+                            "jobs",
+                            "Number of jobs to process for each number of "
+                            "workers",
+                            CArgDescriptions::eInteger, "10000");
+
+    arg_desc->AddDefaultKey("workers",
+                            "workers",
+                            "Comma separated numbers of simultaneous worker "
+                            "nodes to measure",
+                            CArgDescriptions::eString, "1,2,4,8,16,32,64");
+
+    arg_desc->AddDefaultKey("naff",
+                            "naff",
+                            "Number of affinities. If not 0 then each worker "
+                            "node asks for jobs with one affinity only",
+                            CArgDescriptions::eInteger, "0");
+
+    arg_desc->AddDefaultKey("batch",
+                            "batch",
+                            "Number of jobs each worker node gets and "
+                            "commits at once (NetSchedule protocol 1.5.0 "
+                            "and up)",
+                            CArgDescriptions::eInteger, "1");
+
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+void CTestNetScheduleLoad::x_Submit(CNetScheduleSubmitter &  submitter,
+                                    unsigned int             jcount,
+                                    unsigned int             naff)
+{
+    vector<CNetScheduleJob>     jobs;
+
+    jobs.reserve(jcount);
+    for (unsigned int  k = 0; k < jcount; ++k) {
+        CNetScheduleJob     job("Load test input");
+        if (naff > 0)
+            job.affinity = "aff" + NStr::NumericToString(k % naff);
+        jobs.push_back(job);
+    }
+    submitter.SubmitJobBatch(jobs);
+}
+
+
+void CTestNetScheduleLoad::x_RunWorkers(const string &  service,
+                                        const string &  queue,
+                                        unsigned int    nworkers,
+                                        unsigned int    naff,
+                                        unsigned int    batch)
+{
+    vector< CRef<CLoadWorker> >     workers;
+    pid_t                           pid = getpid();
+
+    for (unsigned int  k = 0; k < nworkers; ++k) {
+        string      affinity;
+        if (naff > 0)
+            affinity = "aff" + NStr::NumericToString(k % naff);
+        workers.push_back(
+            CRef<CLoadWorker>(new CLoadWorker(
+                service, queue,
+                "load_" + NStr::NumericToString(pid) + "_" +
+                NStr::NumericToString(k), affinity, batch)));
+    }
+
+    CStopWatch      sw(CStopWatch::eStart);
+    for (unsigned int  k = 0; k < nworkers; ++k)
+        workers[k]->Run();
+    for (unsigned int  k = 0; k < nworkers; ++k)
+        workers[k]->Join();
+    double          elapsed = sw.Elapsed();
+
+    unsigned int    processed = 0;
+    unsigned int    errors = 0;
+    for (unsigned int  k = 0; k < nworkers; ++k) {
+        processed += workers[k]->GetProcessed();
+        errors += workers[k]->GetErrors();
+    }
+
+    NcbiCout.setf(IOS_BASE::fixed, IOS_BASE::floatfield);
+    NcbiCout << setw(8) << nworkers
+             << setw(10) << processed
+             << setw(8) << errors
+             << setw(12) << setprecision(3) << elapsed
+             << setw(12) << setprecision(1)
+             << (elapsed > 0 ? processed / elapsed : 0.0)
+             << NcbiEndl;
+}
+
+
+int CTestNetScheduleLoad::Run(void)
+{
+    const CArgs &       args = GetArgs();
+    const string &      service = args["service"].AsString();
+    const string &      queue = args["queue"].AsString();
+    unsigned int        jcount = args["jobs"].AsInteger();
+    unsigned int        naff = args["naff"].AsInteger();
+    unsigned int        batch = args["batch"].AsInteger();
+
+    list<string>        worker_counts;
+    NStr::Split(args["workers"].AsString(), ",", worker_counts,
+                NStr::fSplit_Tokenize);
+
+    CNetScheduleAPI     api(service, "load_test", queue);
+    api.SetProgramVersion("load_test submitter 1.0.0");
+    api.SetClientNode("load_" + NStr::NumericToString(getpid()));
+    api.SetClientSession("load_test_session");
+    api.GetAdmin().PrintServerVersion(NcbiCout);
+
+    CNetScheduleSubmitter   submitter = api.GetSubmitter();
+
+    NcbiCout << "Jobs per run: " << jcount
+             << ", affinities: " << naff
+             << ", batch: " << batch << NcbiEndl
+             << " workers      jobs  errors    time,sec    jobs/sec"
+             << NcbiEndl;
+
+    ITERATE(list<string>, it, worker_counts) {
+        unsigned int    nworkers = NStr::StringToUInt(*it);
+        if (nworkers == 0)
+            continue;
+
+        // The submission is not measured: the queue has all the jobs
+        // before the workers start
+        x_Submit(submitter, jcount, naff);
+        x_RunWorkers(service, queue, nworkers, naff, batch);
+    }
+    return 0;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTestNetScheduleLoad().AppMain(argc, argv, 0, eDS_Default);
+}
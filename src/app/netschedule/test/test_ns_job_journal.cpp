@@ -0,0 +1,289 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  Recovery of the NetSchedule job journal
+ *
+ * The journal and the job serialization are compiled in directly; the queue
+ * members the job code refers to are not used by the journal and are
+ * stubbed out.
+ *
+ */
+
+#include "../ns_job_journal.cpp"
+#include "../ns_db_dump.cpp"
+#include "../job.cpp"
+
+#include <unistd.h>
+
+
+BEGIN_NCBI_SCOPE
+
+void CQueue::EraseJob(unsigned int  /* job_id */, TJobStatus  /* status */)
+{ abort(); }
+
+CBDB_FileCursor &  CQueue::GetEventsCursor(void)
+{ abort(); }
+
+string  CQueue::MakeJobKey(unsigned int  job_id) const
+{ return NStr::NumericToString(job_id); }
+
+string  CNSAffinityRegistry::GetTokenByID(unsigned int  /* aff_id */) const
+{ abort(); }
+
+string  CNSGroupsRegistry::ResolveGroup(unsigned int  /* group */) const
+{ abort(); }
+
+END_NCBI_SCOPE
+
+
+USING_NCBI_SCOPE;
+
+
+// The journal is synchronous so every committed record is in the file
+static const Uint8      kNoSnapshots = 1024 * 1024 * 1024;
+
+
+#define NS_CHECK(x)  if (x) {} else s_Fail(#x, __LINE__)
+
+static void  s_Fail(const char *  what, int  line)
+{
+    cerr << "Check failed at line " << line << ": " << what << endl;
+    abort();
+}
+
+
+static CJob  s_MakeJob(unsigned int  job_id, const string &  input)
+{
+    CJob    job;
+
+    job.SetId(job_id);
+    job.SetPassport(job_id * 7);
+    job.SetStatus(CNetScheduleAPI::ePending);
+    job.SetAffinityId(job_id % 2 == 0 ? 1 : 0);
+    job.SetInput(input);
+    job.AppendEvent().SetStatus(CNetScheduleAPI::ePending);
+    return job;
+}
+
+
+static void  s_Store(CNSJobJournal &  journal, const CJob &  job,
+                     bool  with_io = true)
+{
+    journal.StoreJob(job, with_io,
+                     job.GetAffinityId() != 0 ? "even" : "", "");
+}
+
+
+// Checks the job as it is loaded from the journal
+static void  s_CheckJob(const CNSJobJournal &  journal, unsigned int  job_id,
+                        TJobStatus  status, const string &  input)
+{
+    CJob    job;
+
+    NS_CHECK(journal.FetchJob(job_id, job));
+    NS_CHECK(job.GetId() == job_id);
+    NS_CHECK(job.GetPassport() == job_id * 7);
+    NS_CHECK(job.GetStatus() == status);
+    NS_CHECK(job.GetInput() == input);
+}
+
+
+static string  s_FileName(const string &  dir, const string &  prefix,
+                          unsigned int  generation)
+{
+    return CDirEntry::AddTrailingPathSeparator(dir) + prefix +
+           NStr::NumericToString(generation);
+}
+
+
+// The server stopped while the last record was being written: the records
+// before it are loaded, the changes made after the recovery are loaded
+// together with them at the next start.
+static void  s_TestTruncatedRecord(const string &  dir)
+{
+    {{
+        CNSJobJournal   journal(dir, true, kNoSnapshots);
+        NS_CHECK(journal.Recover() == 0);
+        s_Store(journal, s_MakeJob(1, "input 1"));
+        s_Store(journal, s_MakeJob(2, "input 2"));
+        s_Store(journal, s_MakeJob(3, "input 3"));
+        journal.Commit();
+    }}
+
+    string      first = s_FileName(dir, kJournalFilePrefix, 1);
+    Int8        size = CFile(first).GetLength();
+    NS_CHECK(size > 0);
+    NS_CHECK(truncate(first.c_str(), size - 5) == 0);
+
+    {{
+        CNSJobJournal   journal(dir, true, kNoSnapshots);
+        NS_CHECK(journal.Recover() == 2);
+        s_CheckJob(journal, 1, CNetScheduleAPI::ePending, "input 1");
+        s_CheckJob(journal, 2, CNetScheduleAPI::ePending, "input 2");
+        NS_CHECK(journal.GetNextJobID(2) == 0);
+        NS_CHECK(journal.GetAffinityTokens().size() == 1);
+
+        // The broken file is not appended to
+        NS_CHECK(CFile(first).GetLength() == size - 5);
+
+        // Replay after the broken record
+        CJob    job;
+        NS_CHECK(journal.FetchJob(1, job));
+        job.SetStatus(CNetScheduleAPI::eDone);
+        s_Store(journal, job, false);
+        journal.EraseJob(2);
+        s_Store(journal, s_MakeJob(3, "input 3 again"));
+        journal.Commit();
+    }}
+
+    {{
+        CNSJobJournal   journal(dir, true, kNoSnapshots);
+        NS_CHECK(journal.Recover() == 2);
+        s_CheckJob(journal, 1, CNetScheduleAPI::eDone, "input 1");
+        s_CheckJob(journal, 3, CNetScheduleAPI::ePending, "input 3 again");
+        NS_CHECK(journal.GetNextJobID(1) == 3);
+    }}
+}
+
+
+// The jobs are loaded from the latest snapshot and the journal files which
+// are not older than it.
+static void  s_TestSnapshotReplay(const string &  dir)
+{
+    unsigned int    snapshot = 0;
+
+    {{
+        // Any journal file is large enough for a snapshot
+        CNSJobJournal   journal(dir, true, 1);
+        NS_CHECK(journal.Recover() == 0);
+        for (unsigned int  job_id = 1; job_id <= 10; ++job_id)
+            s_Store(journal, s_MakeJob(job_id,
+                                       "input " +
+                                       NStr::NumericToString(job_id)));
+        journal.Commit();
+        journal.Checkpoint();
+
+        for (snapshot = 1; snapshot < 10; ++snapshot)
+            if (CFile(s_FileName(dir, kJournalSnapshotPrefix,
+                                 snapshot)).Exists())
+                break;
+        NS_CHECK(snapshot < 10);
+        NS_CHECK(!CFile(s_FileName(dir, kJournalFilePrefix,
+                                   snapshot - 1)).Exists());
+
+        // Changes after the snapshot
+        CJob    job;
+        NS_CHECK(journal.FetchJob(4, job));
+        job.SetStatus(CNetScheduleAPI::eRunning);
+        s_Store(journal, job, false);
+        journal.EraseJob(5);
+        s_Store(journal, s_MakeJob(11, "input 11"));
+        journal.Commit();
+    }}
+
+    CNSJobJournal   journal(dir, true, 1);
+    CJob            job;
+    NS_CHECK(journal.Recover() == 10);
+    s_CheckJob(journal, 4, CNetScheduleAPI::eRunning, "input 4");
+    s_CheckJob(journal, 11, CNetScheduleAPI::ePending, "input 11");
+    NS_CHECK(!journal.FetchJob(5, job));
+    s_CheckJob(journal, 10, CNetScheduleAPI::ePending, "input 10");
+    NS_CHECK(journal.GetAffinityTokens().size() == 1);
+}
+
+
+// When the jobs cannot be loaded the journal files are kept: the directory
+// is set aside and the jobs are recovered from there.
+static void  s_TestRecoveryFailure(const string &  root)
+{
+    string      dir = CDirEntry::ConcatPath(root, "queue");
+
+    {{
+        CNSJobJournal   journal(dir, true, kNoSnapshots);
+        NS_CHECK(journal.Recover() == 0);
+        s_Store(journal, s_MakeJob(1, "input 1"));
+        s_Store(journal, s_MakeJob(2, "input 2"));
+        journal.Commit();
+    }}
+
+    // The next journal file cannot be created
+    string      blocker = s_FileName(dir, kJournalFilePrefix, 2);
+    NS_CHECK(CDir(blocker).Create());
+
+    string      aside;
+    {{
+        CNSJobJournal   journal(dir, true, kNoSnapshots);
+        bool            failed = false;
+        try {
+            journal.Recover();
+        } catch (const CNetScheduleException &) {
+            failed = true;
+        }
+        NS_CHECK(failed);
+
+        aside = journal.SetAside();
+        NS_CHECK(!CDir(dir).Exists());
+        NS_CHECK(CDirEntry(CDirEntry::DeleteTrailingPathSeparator(
+                                    CDirEntry(aside).GetDir())).GetName() ==
+                 CDirEntry(root).GetName() + kJournalSetAsideSuffix);
+
+        // The journal stays closed
+        failed = false;
+        try {
+            s_Store(journal, s_MakeJob(3, "input 3"));
+        } catch (const CNetScheduleException &) {
+            failed = true;
+        }
+        NS_CHECK(failed);
+    }}
+
+    NS_CHECK(CFile(s_FileName(aside, kJournalFilePrefix, 1)).Exists());
+    NS_CHECK(CDir(s_FileName(aside, kJournalFilePrefix, 2)).Remove());
+
+    CNSJobJournal   journal(aside, true, kNoSnapshots);
+    NS_CHECK(journal.Recover() == 2);
+    s_CheckJob(journal, 1, CNetScheduleAPI::ePending, "input 1");
+    s_CheckJob(journal, 2, CNetScheduleAPI::ePending, "input 2");
+    CDir(CDirEntry(aside).GetDir()).Remove();
+}
+
+
+int main(int, const char **)
+{
+    string      tmp = CDirEntry::GetTmpName();
+    string      root = CDirEntry::ConcatPath(tmp, kJournalSubdirName);
+
+    NS_CHECK(CDir(root).CreatePath());
+
+    s_TestTruncatedRecord(CDirEntry::ConcatPath(root, "truncated"));
+    s_TestSnapshotReplay(CDirEntry::ConcatPath(root, "snapshot"));
+    s_TestRecoveryFailure(root);
+
+    CDir(tmp).Remove();
+    cout << "Test completed successfully!" << endl;
+    return 0;
+}
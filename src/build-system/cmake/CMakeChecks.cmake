@@ -68,6 +68,7 @@ check_function_exists(getloadavg HAVE_GETLOADAVG)
 check_function_exists(getlogin_r HAVE_GETLOGIN_R)
 check_function_exists(getnameinfo HAVE_GETNAMEINFO)
 check_function_exists(getpagesize HAVE_GETPAGESIZE)
+check_function_exists(posix_fallocate HAVE_POSIX_FALLOCATE)
 check_function_exists(readpassphrase HAVE_READPASSPHRASE)
 check_function_exists(getpassphrase HAVE_GETPASSPHRASE)
 check_function_exists(getpass HAVE_GETPASS)
@@ -240,6 +241,28 @@ FIND_LIBRARY(LZO_LIBRARIES NAMES lzo2
              /usr/lib
              /usr/local/lib
             )
+FIND_PATH(ZSTD_INCLUDE_DIR zstd.h
+          ${ZSTD_ROOT}/include/
+          /usr/include/
+          /usr/local/include/
+         )
+FIND_LIBRARY(ZSTD_LIBRARIES NAMES zstd
+             PATHS
+             ${ZSTD_ROOT}/lib
+             /usr/lib
+             /usr/local/lib
+            )
+FIND_PATH(LZ4_INCLUDE_DIR lz4frame.h
+          ${LZ4_ROOT}/include/
+          /usr/include/
+          /usr/local/include/
+         )
+FIND_LIBRARY(LZ4_LIBRARIES NAMES lz4
+             PATHS
+             ${LZ4_ROOT}/lib
+             /usr/lib
+             /usr/local/lib
+            )
 
 set(Z_INCLUDE ${ZLIB_INCLUDE_DIRS})
 set(Z_LIBS ${ZLIB_LIBRARIES})
@@ -249,10 +272,14 @@ set(BZ2_LIBS ${BZIP2_LIBRARIES})
 set(BZ2_LIB)
 set(LZO_INCLUDE ${LZO_INCLUDE_DIR})
 set(LZO_LIBS ${LZO_LIBRARIES})
+set(ZSTD_INCLUDE ${ZSTD_INCLUDE_DIR})
+set(ZSTD_LIBS ${ZSTD_LIBRARIES})
+set(LZ4_INCLUDE ${LZ4_INCLUDE_DIR})
+set(LZ4_LIBS ${LZ4_LIBRARIES})
 
 
-set(CMPRS_INCLUDE ${Z_INCLUDE} ${BZ2_INCLUDE} ${LZO_INCLUDE})
-set(CMPRS_LIBS ${Z_LIBS} ${BZ2_LIBS} ${LZO_LIBS})
+set(CMPRS_INCLUDE ${Z_INCLUDE} ${BZ2_INCLUDE} ${LZO_INCLUDE} ${ZSTD_INCLUDE} ${LZ4_INCLUDE})
+set(CMPRS_LIBS ${Z_LIBS} ${BZ2_LIBS} ${LZO_LIBS} ${ZSTD_LIBS} ${LZ4_LIBS})
 set(COMPRESS_LIBS xcompress ${CMPRS_LIBS})
 
 
@@ -508,73 +508,73 @@ int CCgiApplication::Run(void)
         _TRACE("(CGI) CCgiApplication::Run: calling ProcessRequest");
         GetDiagContext().SetAppState(eDiagAppState_RequestBegin);
 
-        m_Context.reset( CreateContext() );
-        _ASSERT(m_Context.get());
+        m_State.m_Context.reset( CreateContext() );
+        _ASSERT(m_State.m_Context.get());
 
-        ConfigureDiagnostics(*m_Context);
+        ConfigureDiagnostics(*m_State.m_Context);
         x_AddLBCookie();
         try {
             // Print request start message
             x_OnEvent(eStartRequest, 0);
 
-            VerifyCgiContext(*m_Context);
+            VerifyCgiContext(*m_State.m_Context);
             ProcessHttpReferer();
             LogRequest();
 
-            m_Context->CheckStatus();
+            m_State.m_Context->CheckStatus();
             
             try {
-                m_Cache.reset( GetCacheStorage() );
+                m_State.m_Cache.reset( GetCacheStorage() );
             } catch( exception& ex ) {
                 ERR_POST_X(1, "Couldn't create cache : " << ex.what());
             }
             bool skip_process_request = false;
-            bool caching_needed = IsCachingNeeded(m_Context->GetRequest());
-            if (m_Cache.get() && caching_needed) {
-                skip_process_request = GetResultFromCache(m_Context->GetRequest(),
-                                                           m_Context->GetResponse().out());
+            bool caching_needed = IsCachingNeeded(m_State.m_Context->GetRequest());
+            if (m_State.m_Cache.get() && caching_needed) {
+                skip_process_request = GetResultFromCache(m_State.m_Context->GetRequest(),
+                                                           m_State.m_Context->GetResponse().out());
             }
             if (!skip_process_request) {
-                if( m_Cache.get() ) {
+                if( m_State.m_Cache.get() ) {
                     CCgiStreamWrapper* wrapper = dynamic_cast<CCgiStreamWrapper*>(
-                        m_Context->GetResponse().GetOutput());
+                        m_State.m_Context->GetResponse().GetOutput());
                     if ( wrapper ) {
                         wrapper->SetCacheStream(result_copy);
                     }
                     else {
                         list<CNcbiOstream*> slist;
-                        orig_stream = m_Context->GetResponse().GetOutput();
+                        orig_stream = m_State.m_Context->GetResponse().GetOutput();
                         slist.push_back(orig_stream);
                         slist.push_back(&result_copy);
                         new_stream.reset(new CWStream(new CMultiWriter(slist), 1, 0,
                                                       CRWStreambuf::fOwnWriter));
-                        m_Context->GetResponse().SetOutput(new_stream.get());
+                        m_State.m_Context->GetResponse().SetOutput(new_stream.get());
                     }
                 }
                 GetDiagContext().SetAppState(eDiagAppState_Request);
                 result = CCgiContext::ProcessCORSRequest(
-                    m_Context->GetRequest(), m_Context->GetResponse()) ?
-                    0 : ProcessRequest(*m_Context);
+                    m_State.m_Context->GetRequest(), m_State.m_Context->GetResponse()) ?
+                    0 : ProcessRequest(*m_State.m_Context);
                 GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
-                m_Context->GetResponse().Finalize();
+                m_State.m_Context->GetResponse().Finalize();
                 if (result != 0) {
                     SetHTTPStatus(500);
-                    m_ErrorStatus = true;
-                    m_Context->GetResponse().AbortChunkedTransfer();
+                    m_State.m_ErrorStatus = true;
+                    m_State.m_Context->GetResponse().AbortChunkedTransfer();
                 } else {
-                    m_Context->GetResponse().FinishChunkedTransfer();
-                    if (m_Cache.get()) {
-                        m_Context->GetResponse().Flush();
-                        if (m_IsResultReady) {
+                    m_State.m_Context->GetResponse().FinishChunkedTransfer();
+                    if (m_State.m_Cache.get()) {
+                        m_State.m_Context->GetResponse().Flush();
+                        if (m_State.m_IsResultReady) {
                             if(caching_needed)
-                                SaveResultToCache(m_Context->GetRequest(), result_copy);
+                                SaveResultToCache(m_State.m_Context->GetRequest(), result_copy);
                             else {
-                                auto_ptr<CCgiRequest> request(GetSavedRequest(m_RID));
+                                auto_ptr<CCgiRequest> request(GetSavedRequest(m_State.m_RID));
                                 if (request.get()) 
                                     SaveResultToCache(*request, result_copy);
                             }
                         } else if (caching_needed) {
-                            SaveRequest(m_RID, m_Context->GetRequest());
+                            SaveRequest(m_State.m_RID, m_State.m_Context->GetRequest());
                         }
                     }
                 }
@@ -590,11 +590,11 @@ int CCgiApplication::Run(void)
                      e.GetStatusCode() >= CCgiException::e400_BadRequest ) {
                     throw;
                 }
-                m_Context->GetResponse().FinishChunkedTransfer();
+                m_State.m_Context->GetResponse().FinishChunkedTransfer();
                 GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
                 // If for some reason exception with status 2xx was thrown,
                 // set the result to 0, update HTTP status and continue.
-                m_Context->GetResponse().SetStatus(e.GetStatusCode(),
+                m_State.m_Context->GetResponse().SetStatus(e.GetStatusCode(),
                                                    e.GetStatusMessage());
             }
             result = 0;
@@ -610,14 +610,14 @@ int CCgiApplication::Run(void)
 #endif
 
         _TRACE("CCgiApplication::Run: flushing");
-        m_Context->GetResponse().Flush();
+        m_State.m_Context->GetResponse().Flush();
         _TRACE("CCgiApplication::Run: return " << result);
         x_OnEvent(result == 0 ? eSuccess : eError, result);
         x_OnEvent(eExit, result);
     }
     catch (exception& e) {
-        if ( m_Context.get() ) {
-            m_Context->GetResponse().AbortChunkedTransfer();
+        if ( m_State.m_Context.get() ) {
+            m_State.m_Context->GetResponse().AbortChunkedTransfer();
         }
         GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
         if ( x_DoneHeadRequest() ) {
@@ -645,8 +645,8 @@ int CCgiApplication::Run(void)
 
             // Exception reporting. Use different severity for broken connection.
             ios_base::failure* fex = dynamic_cast<ios_base::failure*>(&e);
-            CNcbiOstream* os = m_Context.get() ? m_Context->GetResponse().GetOutput() : NULL;
-            if ((fex  &&  os  &&  !os->good())  ||  m_OutputBroken) {
+            CNcbiOstream* os = m_State.m_Context.get() ? m_State.m_Context->GetResponse().GetOutput() : NULL;
+            if ((fex  &&  os  &&  !os->good())  ||  m_State.m_OutputBroken) {
                 if ( !TClientConnIntOk::GetDefault() ) {
                     ERR_POST_X(13, Severity(TClientConnIntSeverity::GetDefault()) <<
                         "Connection interrupted");
@@ -669,8 +669,8 @@ int CCgiApplication::Run(void)
     x_OnEvent(eEndRequest, 120);
     x_OnEvent(eExit, result);
 
-    if (m_Context.get()) {
-        m_Context->GetResponse().SetOutput(NULL);
+    if (m_State.m_Context.get()) {
+        m_State.m_Context->GetResponse().SetOutput(NULL);
     }
     return result;
 }
@@ -753,11 +753,36 @@ void CCgiApplication::SetupArgDescriptions(CArgDescriptions* arg_desc)
 
 CCgiContext& CCgiApplication::x_GetContext( void ) const
 {
-    if ( !m_Context.get() ) {
+    SRequestState& state = x_GetState();
+    if ( !state.m_Context.get() ) {
         ERR_POST_X(2, "CCgiApplication::GetContext: no context set");
         throw runtime_error("no context set");
     }
-    return *m_Context;
+    return *state.m_Context;
+}
+
+
+CCgiApplication::SRequestState& CCgiApplication::x_GetState(void) const
+{
+    SRequestState* state =
+        m_ThreadState.NotEmpty() ? m_ThreadState->GetValue() : 0;
+    return state ? *state : m_State;
+}
+
+
+CCgiApplication::SRequestState::SRequestState(void)
+    : m_Iteration(0),
+      m_ArgContextSync(false),
+      m_OutputBroken(false),
+      m_IsResultReady(true),
+      m_RequestStartPrinted(false),
+      m_ErrorStatus(false)
+{
+}
+
+
+CCgiApplication::SRequestState::~SRequestState(void)
+{
 }
 
 
@@ -832,7 +857,7 @@ CCgiContext* CCgiApplication::CreateContextWithFlags
  int               ofd,
  int               flags)
 {
-    m_OutputBroken = false; // reset failure flag
+    x_GetState().m_OutputBroken = false; // reset failure flag
 
     int errbuf_size =
         GetConfig().GetInt("CGI", "RequestErrBufSize", 256, 0,
@@ -922,13 +947,7 @@ private:
 CCgiApplication::CCgiApplication(void) 
  : m_RequestFlags(0),
    m_HostIP(0), 
-   m_Iteration(0),
-   m_ArgContextSync(false),
-   m_OutputBroken(false),
-   m_IsResultReady(true),
-   m_ShouldExit(false),
-   m_RequestStartPrinted(false),
-   m_ErrorStatus(false)
+   m_ShouldExit(false)
 {
     // Disable system popup messages
     SuppressSystemMessageBox();
@@ -961,9 +980,11 @@ int CCgiApplication::OnException(exception& e, CNcbiOstream& os)
     string status_str = "500 Server Error";
     string message = "";
 
+    SRequestState& state = x_GetState();
+
     // Save current HTTP status. Later it may be changed to 299 or 499
     // depending on this value.
-    m_ErrorStatus = CDiagContext::GetRequestContext().GetRequestStatus() >= 400;
+    state.m_ErrorStatus = CDiagContext::GetRequestContext().GetRequestStatus() >= 400;
     SetHTTPStatus(500);
 
     CException* ce = dynamic_cast<CException*> (&e);
@@ -992,7 +1013,7 @@ int CCgiApplication::OnException(exception& e, CNcbiOstream& os)
     }
 
     // Don't try to write to a broken output
-    if (!os.good()  ||  m_OutputBroken) {
+    if (!os.good()  ||  state.m_OutputBroken) {
         return -1;
     }
 
@@ -1029,28 +1050,30 @@ int CCgiApplication::OnException(exception& e, CNcbiOstream& os)
 
 const CArgs& CCgiApplication::GetArgs(void) const
 {
+    SRequestState& state = x_GetState();
+
     // Are there no argument descriptions or no CGI context (yet?)
-    if (!GetArgDescriptions()  ||  !m_Context.get())
+    if (!GetArgDescriptions()  ||  !state.m_Context.get())
         return CParent::GetArgs();
 
     // Is everything already in-sync
-    if ( m_ArgContextSync )
-        return *m_CgiArgs;
+    if ( state.m_ArgContextSync )
+        return *state.m_CgiArgs;
 
     // Create CGI version of args, if necessary
-    if ( !m_CgiArgs.get() )
-        m_CgiArgs.reset(new CArgs());
+    if ( !state.m_CgiArgs.get() )
+        state.m_CgiArgs.reset(new CArgs());
 
     // Copy cmd-line arg values to CGI args
-    m_CgiArgs->Assign(CParent::GetArgs());
+    state.m_CgiArgs->Assign(CParent::GetArgs());
 
     // Add CGI parameters to the CGI version of args
-    GetArgDescriptions()->ConvertKeys(m_CgiArgs.get(),
+    GetArgDescriptions()->ConvertKeys(state.m_CgiArgs.get(),
                                       GetContext().GetRequest().GetEntries(),
                                       true /*update=yes*/);
 
-    m_ArgContextSync = true;
-    return *m_CgiArgs;
+    state.m_ArgContextSync = true;
+    return *state.m_CgiArgs;
 }
 
 
@@ -1078,11 +1101,13 @@ private:
 
 void CCgiApplication::x_OnEvent(EEvent event, int status)
 {
+    SRequestState& state = x_GetState();
+
     switch ( event ) {
     case eStartRequest:
         {
             // Set context properties
-            const CCgiRequest& req = m_Context->GetRequest();
+            const CCgiRequest& req = state.m_Context->GetRequest();
 
             // Print request start message
             if ( !CDiagContext::IsSetOldPostFormat() ) {
@@ -1091,12 +1116,12 @@ void CCgiApplication::x_OnEvent(EEvent event, int status)
                 GetDiagContext().PrintRequestStart()
                     .AllowBadSymbolsInArgNames()
                     .Print(collector.GetArgs());
-                m_RequestStartPrinted = true;
+                state.m_RequestStartPrinted = true;
             }
 
             // Set default HTTP status code (reset above by PrintRequestStart())
             SetHTTPStatus(200);
-            m_ErrorStatus = false;
+            state.m_ErrorStatus = false;
 
             // This will log ncbi_phid as a separate 'extra' message
             // if not yet logged.
@@ -1135,7 +1160,7 @@ void CCgiApplication::x_OnEvent(EEvent event, int status)
             try {
                 if ( m_OutputStream.get() ) {
                     if ( !m_OutputStream->good() ) {
-                        m_OutputBroken = true; // set flag to indicate broken output
+                        state.m_OutputBroken = true; // set flag to indicate broken output
                         m_OutputStream->clear();
                     }
                     rctx.SetBytesWr(NcbiStreamposToInt8(m_OutputStream->tellp()));
@@ -1151,18 +1176,18 @@ void CCgiApplication::x_OnEvent(EEvent event, int status)
             CRequestContext& rctx = ctx.GetRequestContext();
             // If an error status has been set by ProcessRequest, don't try
             // to check the output stream and change the status to 299/499.
-            if ( !m_ErrorStatus ) {
+            if ( !state.m_ErrorStatus ) {
                 // Log broken connection as 299/499 status
-                CNcbiOstream* os = m_Context.get() ?
-                    m_Context->GetResponse().GetOutput() : NULL;
-                if ((os  &&  !os->good())  ||  m_OutputBroken) {
+                CNcbiOstream* os = state.m_Context.get() ?
+                    state.m_Context->GetResponse().GetOutput() : NULL;
+                if ((os  &&  !os->good())  ||  state.m_OutputBroken) {
                     // 'Accept-Ranges: bytes' indicates a request for
                     // content length, broken connection is OK.
                     // If Content-Range is also set, the client was downloading
                     // partial data. Broken connection is not OK in this case.
                     if (TClientConnIntOk::GetDefault()  ||
-                        (m_Context->GetResponse().AcceptRangesBytes()  &&
-                        !m_Context->GetResponse().HaveContentRange())) {
+                        (state.m_Context->GetResponse().AcceptRangesBytes()  &&
+                        !state.m_Context->GetResponse().HaveContentRange())) {
                         rctx.SetRequestStatus(
                             CRequestStatus::e299_PartialContentBrokenConnection);
                     }
@@ -1173,10 +1198,10 @@ void CCgiApplication::x_OnEvent(EEvent event, int status)
                 }
             }
             if (!CDiagContext::IsSetOldPostFormat()) {
-                if (m_RequestStartPrinted) {
+                if (state.m_RequestStartPrinted) {
                     // This will also reset request context
                     ctx.PrintRequestStop();
-                    m_RequestStartPrinted = false;
+                    state.m_RequestStartPrinted = false;
                 }
                 rctx.Reset();
             }
@@ -1409,8 +1434,9 @@ CCgiApplication::PreparseArgs(int                argc,
 
 void CCgiApplication::SetRequestId(const string& rid, bool is_done)
 {
-    m_RID = rid;
-    m_IsResultReady = is_done;
+    SRequestState& state = x_GetState();
+    state.m_RID = rid;
+    state.m_IsResultReady = is_done;
 }
 
 
@@ -1421,7 +1447,7 @@ bool CCgiApplication::GetResultFromCache(const CCgiRequest& request, CNcbiOstrea
         return false;
 
     try {
-        CCacheHashedContent helper(*m_Cache);
+        CCacheHashedContent helper(*x_GetState().m_Cache);
         auto_ptr<IReader> reader( helper.GetHashedContent(checksum, content));
         if (reader.get()) {
             //cout << "(Read) " << checksum << " --- " << content << endl;
@@ -1441,7 +1467,7 @@ void CCgiApplication::SaveResultToCache(const CCgiRequest& request, CNcbiIstream
     if ( !request.CalcChecksum(checksum, content) )
         return;
     try {
-        CCacheHashedContent helper(*m_Cache);
+        CCacheHashedContent helper(*x_GetState().m_Cache);
         auto_ptr<IWriter> writer( helper.StoreHashedContent(checksum, content) );
         if (writer.get()) {
             //        cout << "(Write) : " << checksum << " --- " << content << endl;
@@ -1459,7 +1485,7 @@ void CCgiApplication::SaveRequest(const string& rid, const CCgiRequest& request)
     if (rid.empty())
         return;
     try {
-        auto_ptr<IWriter> writer( m_Cache->GetWriteStream(rid, 0, "NS_JID") );
+        auto_ptr<IWriter> writer( x_GetState().m_Cache->GetWriteStream(rid, 0, "NS_JID") );
         if (writer.get()) {
             CWStream cache_stream(writer.get());            
             request.Serialize(cache_stream);
@@ -1475,7 +1501,7 @@ CCgiRequest* CCgiApplication::GetSavedRequest(const string& rid)
     if (rid.empty())
         return NULL;
     try {
-        auto_ptr<IReader> reader(m_Cache->GetReadStream(rid, 0, "NS_JID"));
+        auto_ptr<IReader> reader(x_GetState().m_Cache->GetReadStream(rid, 0, "NS_JID"));
         if (reader.get()) {
             CRStream cache_stream(reader.get());
             auto_ptr<CCgiRequest> request(new CCgiRequest);
@@ -1489,6 +1515,8 @@ CCgiRequest* CCgiApplication::GetSavedRequest(const string& rid)
 }
 
 
+DEFINE_STATIC_FAST_MUTEX(s_HostIPMutex);
+
 void CCgiApplication::x_AddLBCookie()
 {
     const CNcbiRegistry& reg = GetConfig();
@@ -1520,24 +1548,28 @@ void CCgiApplication::x_AddLBCookie()
     // Getting host configuration can take some time
     // for fast CGIs we try to avoid overhead and call it only once
     // m_HostIP variable keeps the cached value
+    // (guarded for the multi-threaded FastCGI)
 
-    if ( m_HostIP ) {     // repeated call
-        host = m_HostIP;
-    }
-    else {               // first time call
-        host = reg.Get("CGI-LB", "Host");
-        if ( host.empty() ) {
-            if ( m_Caf.get() ) {
-                char  host_ip[64] = {0,};
-                m_Caf->GetHostIP(host_ip, sizeof(host_ip));
-                m_HostIP = m_Caf->Encode(host_ip, 0);
-                host = m_HostIP;
-            }
-            else {
-                ERR_POST_X(10, "CGI-LB: 'Host' not specified.");
+    {{
+        CFastMutexGuard guard(s_HostIPMutex);
+        if ( m_HostIP ) {     // repeated call
+            host = m_HostIP;
+        }
+        else {               // first time call
+            host = reg.Get("CGI-LB", "Host");
+            if ( host.empty() ) {
+                if ( m_Caf.get() ) {
+                    char  host_ip[64] = {0,};
+                    m_Caf->GetHostIP(host_ip, sizeof(host_ip));
+                    m_HostIP = m_Caf->Encode(host_ip, 0);
+                    host = m_HostIP;
+                }
+                else {
+                    ERR_POST_X(10, "CGI-LB: 'Host' not specified.");
+                }
             }
         }
-    }
+    }}
 
 
     CCgiCookie cookie(cookie_name, host, domain, path);
@@ -1627,8 +1659,9 @@ string CCgiApplication::GetDefaultLogPath(void) const
 
 void CCgiApplication::SetHTTPStatus(unsigned int status, const string& reason)
 {
-    if ( m_Context.get() ) {
-        m_Context->GetResponse().SetStatus(status, reason);
+    SRequestState& state = x_GetState();
+    if ( state.m_Context.get() ) {
+        state.m_Context->GetResponse().SetStatus(status, reason);
     }
     else {
         CDiagContext::GetRequestContext().SetRequestStatus(status);
@@ -1638,7 +1671,7 @@ void CCgiApplication::SetHTTPStatus(unsigned int status, const string& reason)
 
 bool CCgiApplication::x_DoneHeadRequest(void) const
 {
-    if (!m_Context.get()) return false; // There was an error initializing context
+    if (!x_GetState().m_Context.get()) return false; // There was an error initializing context
     const CCgiContext& ctx = GetContext();
     const CCgiRequest& req = ctx.GetRequest();
     const CCgiResponse& res = ctx.GetResponse();
@@ -1752,7 +1785,7 @@ string CCgiStatistics::Compose_Timing(const CTime& end_time)
 
 string CCgiStatistics::Compose_Entries(void)
 {
-    const CCgiContext* ctx = m_CgiApp.m_Context.get();
+    const CCgiContext* ctx = m_CgiApp.x_GetState().m_Context.get();
     if ( !ctx )
         return kEmptyStr;
 
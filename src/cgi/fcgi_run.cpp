@@ -71,6 +71,8 @@ bool CCgiApplication::x_RunFastCGI(int* /*result*/, unsigned int /*def_iter*/)
 # include <fcgiapp.h>
 # if defined(NCBI_OS_UNIX)
 #   include <unistd.h>
+#   include <errno.h>
+#   include <poll.h>
 #else
 #   include <io.h>
 # endif
@@ -300,6 +302,384 @@ bool s_CheckMemoryLimit(Uint8 total_memory_limit)
 }
 
 
+
+// Return true if current memory usage has grown by more than the limit
+// since the first call (made after the first request, when the caches
+// have been warmed up).
+static bool s_CheckMemoryGrowth(Uint8 memory_growth_limit, size_t* base)
+{
+    if ( memory_growth_limit ) {
+        size_t memory_usage;
+        if ( !GetMemoryUsage(&memory_usage, 0, 0) ) {
+            ERR_POST("Could not check self memory usage" );
+        }
+        else if ( !*base ) {
+            *base = memory_usage;
+        }
+        else if (memory_usage > *base + memory_growth_limit) {
+            ERR_POST_X(11, Warning << "Memory usage (" << memory_usage <<
+                ") has grown by more than the configured limit (" <<
+                memory_growth_limit << ") since the first request (" <<
+                *base << ")");
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Aux. class to remove the diag. prefix pushed for the request
+class CAutoDiagPostPrefix
+{
+public:
+    CAutoDiagPostPrefix(void) : m_Pushed(false) {}
+    ~CAutoDiagPostPrefix(void) { if (m_Pushed) PopDiagPostPrefix(); }
+    void Push(const string& prefix)
+    {
+        _ASSERT(!m_Pushed);
+        if ( !prefix.empty() ) {
+            PushDiagPostPrefix(prefix.c_str());
+            m_Pushed = true;
+        }
+    }
+private:
+    bool m_Pushed;
+};
+
+
+// Data of the accepted Fast-CGI request
+struct CCgiApplication::SFastCGIRequest
+{
+    SFastCGIRequest(void) : in(NULL), out(NULL), err(NULL), env(NULL) {}
+
+    FCGX_Stream*    in;
+    FCGX_Stream*    out;
+    FCGX_Stream*    err;
+    FCGX_ParamArray env;
+};
+
+
+// Multi-threaded Fast-CGI:  the threads take turns to accept requests
+// from the shared listening socket. The thread holding the accept lock
+// also does all the checks between the requests (idler, restart).
+// Once the loop has to end, no more requests are accepted, and the
+// threads quit after finishing the requests being processed (drain).
+# if defined(HAVE_FCGX_ACCEPT_R)  &&  defined(NCBI_THREADS)  &&  \
+     defined(NCBI_OS_UNIX)
+#   define USE_FCGI_THREADS
+# endif
+
+struct CCgiApplication::SFastCGIShared
+{
+    SFastCGIShared(void)
+        : listen_fd(0), max_iterations(0), watch_timeout(0), watcher(NULL),
+          restart_delay(0), total_memory_limit(0), memory_growth_limit(0),
+          is_stat_log(false), accepted(0), memory_base(0), draining(false),
+          exit_code(-1)
+#ifdef USE_FCGI_THREADS
+          , drained(0, 1), waiting(false)
+#endif
+    {}
+
+    // Stop accepting new requests. Non-negative exit code, if any,
+    // overrides the failed requests count as the loop result.
+    void Drain(int code = -1)
+    {
+        CFastMutexGuard guard(mutex);
+        if ( !draining ) {
+            draining = true;
+            exit_code = code;
+#ifdef USE_FCGI_THREADS
+            drained.Post();
+#endif
+        }
+    }
+    bool IsDraining(void)
+    {
+        CFastMutexGuard guard(mutex);
+        return draining;
+    }
+
+#ifdef USE_FCGI_THREADS
+    // Register the calling thread as the one waiting for a request,
+    // unless already draining.
+    bool StartWaiting(void)
+    {
+        CFastMutexGuard guard(mutex);
+        if ( draining ) {
+            return false;
+        }
+        waiter  = pthread_self();
+        waiting = true;
+        return true;
+    }
+    void StopWaiting(void)
+    {
+        CFastMutexGuard guard(mutex);
+        waiting = false;
+    }
+    // Interrupt the wait for a request (poll() or accept()) with a signal.
+    // Return FALSE if no thread is waiting.
+    bool WakeUpWaiter(void)
+    {
+        CFastMutexGuard guard(mutex);
+        if ( waiting ) {
+            pthread_kill(waiter, SIGALRM);
+        }
+        return waiting;
+    }
+#endif
+
+    // Settings
+    int             listen_fd;
+    unsigned int    max_iterations;
+    unsigned int    watch_timeout;
+    CCgiWatchFile*  watcher;
+    CTime           mtime;
+    int             restart_delay;
+    Uint8           total_memory_limit;
+    Uint8           memory_growth_limit;
+    bool            is_stat_log;
+    string          prefix_pid;
+
+    // Accepting requests (and the checks between them) one thread at a time
+    CFastMutex      accept_mutex;
+    unsigned int    accepted;       // # of requests accepted so far
+
+    CFastMutex      mutex;          // Guards the members below
+    size_t          memory_base;    // Memory usage after the first request
+    bool            draining;
+    int             exit_code;
+#ifdef USE_FCGI_THREADS
+    CSemaphore      drained;        // Posted once draining starts
+    pthread_t       waiter;         // Thread waiting for a request, if
+    bool            waiting;        //   any (it holds accept_mutex)
+#endif
+};
+
+
+#ifdef USE_FCGI_THREADS
+
+extern "C" {
+    static void s_WakeUpHandler(int)
+    {
+    }
+}
+
+
+class CCgiApplication::CFastCGIThread : public CThread
+{
+public:
+    CFastCGIThread(CCgiApplication& app, SFastCGIShared& shared)
+        : m_App(app), m_Shared(shared), m_Result(0)
+    {}
+
+    // # of requests whose processing has failed
+    int GetResult(void) const { return m_Result; }
+
+protected:
+    virtual void* Main(void);
+
+private:
+    // Wait for the next request and accept it.
+    // Return FALSE if no more requests should be accepted.
+    bool x_Accept(CAutoFCGX_Request& auto_request, unsigned int* iteration);
+
+    CCgiApplication& m_App;
+    SFastCGIShared&  m_Shared;
+    int              m_Result;
+};
+
+
+bool CCgiApplication::CFastCGIThread::x_Accept
+(CAutoFCGX_Request& auto_request,
+ unsigned int*      iteration)
+{
+    FCGX_Request& request = auto_request.GetRequest();
+    FCGX_InitRequest(&request, m_Shared.listen_fd, FCGI_FAIL_ACCEPT_ON_INTR);
+
+    CFastMutexGuard guard(m_Shared.accept_mutex);
+    for (;;) {
+        if ( m_Shared.IsDraining() ) {
+            return false;
+        }
+
+        // Run idler. By default this reopens log file(s).
+        RunIdler();
+
+        // If to restart the application
+        int restart_code = s_ShouldRestart(m_Shared.mtime, m_Shared.watcher,
+                                           m_Shared.restart_delay);
+        if (restart_code != 0) {
+            m_App.x_OnEvent(restart_code == kSR_Executable ?
+                            eExecutable : eWatchFile, restart_code);
+            m_Shared.Drain(restart_code == kSR_WatchFile ? 0 : restart_code);
+            return false;
+        }
+
+        // Wait for the next request, waking up periodically to run the
+        // checks above. Once draining, the wait is interrupted by SIGALRM,
+        // also if another process sharing the listening socket has taken
+        // the connection first and left this thread blocked in accept().
+        if ( !m_Shared.StartWaiting() ) {
+            return false;
+        }
+        struct pollfd pfd;
+        pfd.fd      = m_Shared.listen_fd;
+        pfd.events  = POLLIN;
+        pfd.revents = 0;
+        int  timeout = m_Shared.watch_timeout ? m_Shared.watch_timeout : 1;
+        int  n       = poll(&pfd, 1, timeout * 1000);
+        bool ready   = n > 0  ||  (n < 0  &&  errno != EINTR);
+        int  err     = 0;
+        if ( ready ) {
+            // Ready, or let FCGX_Accept_r() report the error
+            err = FCGX_Accept_r(&request);
+        }
+        m_Shared.StopWaiting();
+        if ( ready ) {
+            if (err == 0) {
+                break;
+            }
+            if (err == -EINTR) {
+                continue;
+            }
+            _TRACE("CCgiApplication::x_RunFastCGI: no more requests");
+            m_Shared.Drain();
+            return false;
+        }
+        if (n == 0  &&  m_Shared.watch_timeout) {
+            m_App.x_OnEvent(eWaiting, 115);
+        }
+    }
+
+    // Hide it from any children we spawn, which have no use
+    // for it and shouldn't be able to tie it open.
+    fcntl(request.ipcFd, F_SETFD,
+          fcntl(request.ipcFd, F_GETFD) | FD_CLOEXEC);
+
+    *iteration = ++m_Shared.accepted;
+    if (*iteration >= m_Shared.max_iterations) {
+        m_Shared.Drain();
+    }
+    return true;
+}
+
+
+void* CCgiApplication::CFastCGIThread::Main(void)
+{
+    unique_ptr<SRequestState> state(new SRequestState);
+    m_App.m_ThreadState->SetValue(state.get());
+
+    unique_ptr<CCgiStatistics> stat(m_Shared.is_stat_log ?
+                                    m_App.CreateStat() : 0);
+    for (;;) {
+        // Formally finish the Fast-CGI request when all done
+        CAutoFCGX_Request auto_request;
+        if ( !x_Accept(auto_request, &state->m_Iteration) ) {
+            break;
+        }
+
+        CAutoDiagPostPrefix iteration_prefix;
+        if ( CDiagContext::IsSetOldPostFormat() ) {
+            // Old format uses prefix for iteration
+            iteration_prefix.Push(m_Shared.prefix_pid +
+                                  NStr::UIntToString(state->m_Iteration));
+        }
+        // Show PID and iteration # in all of the the diagnostics
+        SetDiagRequestId(state->m_Iteration);
+        GetDiagContext().SetAppState(eDiagAppState_RequestBegin);
+
+        FCGX_Request& request = auto_request.GetRequest();
+        SFastCGIRequest fcgi_request;
+        fcgi_request.in  = request.in;
+        fcgi_request.out = request.out;
+        fcgi_request.err = request.err;
+        fcgi_request.env = request.envp;
+        if ( !m_App.x_ProcessFastCGIRequest(fcgi_request,
+                                            m_Shared.max_iterations,
+                                            stat.get(), &m_Result) ) {
+            m_Shared.Drain();
+        }
+
+        // User code requested Fast-CGI loop to end ASAP
+        if ( m_App.m_ShouldExit ) {
+            m_Shared.Drain();
+        }
+
+        bool memory_exceeded = s_CheckMemoryLimit(m_Shared.total_memory_limit);
+        if ( !memory_exceeded ) {
+            CFastMutexGuard guard(m_Shared.mutex);
+            memory_exceeded = s_CheckMemoryGrowth(m_Shared.memory_growth_limit,
+                                                  &m_Shared.memory_base);
+        }
+        if ( memory_exceeded ) {
+            m_Shared.Drain();
+        }
+    }
+
+    m_App.m_ThreadState->Reset();
+    return 0;
+}
+
+
+void CCgiApplication::x_RunFastCGIThreads(SFastCGIShared& shared,
+                                          unsigned int    n_threads,
+                                          int*            result)
+{
+    m_ThreadState.Reset(new CTls<SRequestState>);
+
+    // SIGALRM interrupts the thread waiting for a request (see
+    // SFastCGIShared::WakeUpWaiter); no SA_RESTART, so that accept()
+    // fails with EINTR.
+    struct sigaction sa, old_sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = s_WakeUpHandler;
+    sigaction(SIGALRM, &sa, &old_sa);
+
+    vector< CRef<CFastCGIThread> > threads;
+    for (unsigned int i = 0;  i < n_threads;  ++i) {
+        CRef<CFastCGIThread> thread(new CFastCGIThread(*this, shared));
+        if ( !thread->Run() ) {
+            ERR_POST_X(12, "CCgiApplication::x_RunFastCGI:  cannot start "
+                           "thread #" << i + 1);
+            break;
+        }
+        threads.push_back(thread);
+    }
+    if ( threads.empty() ) {
+        shared.Drain();
+    }
+    // Once draining, wake up the thread waiting for a request. Repeat,
+    // as the signal may come before it actually blocks in accept().
+    shared.drained.Wait();
+    while ( shared.WakeUpWaiter() ) {
+        SleepMilliSec(10);
+    }
+    NON_CONST_ITERATE(vector< CRef<CFastCGIThread> >, it, threads) {
+        (*it)->Join();
+        *result += (*it)->GetResult();
+    }
+    sigaction(SIGALRM, &old_sa, NULL);
+    if (shared.exit_code >= 0) {
+        *result = shared.exit_code;
+    }
+
+    m_ThreadState.Reset();
+}
+
+#else  /* USE_FCGI_THREADS */
+
+void CCgiApplication::x_RunFastCGIThreads(SFastCGIShared& /*shared*/,
+                                          unsigned int    /*n_threads*/,
+                                          int*            /*result*/)
+{
+    _TROUBLE;
+}
+
+#endif /* USE_FCGI_THREADS */
+
+
 bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
 {
     // Reset the result (which is in fact an error counter here)
@@ -315,6 +695,7 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
 # endif
 
     // If to run as a standalone server on local port or named socket
+    int listen_fd = 0;
     {{
         string path;
         {{
@@ -334,9 +715,11 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
 # ifdef HAVE_FCGX_ACCEPT_R
             // FCGX_OpenSocket() started to appear in the Fast-CGI API
             // simultaneously with FCGX_Accept_r()
-            if (FCGX_OpenSocket(path.c_str(), 10/*max backlog*/) == -1) {
+            listen_fd = FCGX_OpenSocket(path.c_str(), 10/*max backlog*/);
+            if (listen_fd == -1) {
                 ERR_POST_X(4, "CCgiApplication::x_RunFastCGI:  cannot run as a "
                               "standalone server at: '" << path << "'");
+                listen_fd = 0;
             }
 # else
             ERR_POST_X(5, "CCgiApplication::x_RunFastCGI:  cannot run as a "
@@ -360,6 +743,12 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
         NStr::StringToUInt8_DataSize(
         reg.GetString("FastCGI", "TotalMemoryLimit", "0", CNcbiRegistry::eReturn),
         NStr::fConvErr_NoThrow);
+    // Allowed memory usage growth since the first request
+    Uint8 memory_growth_limit =
+        NStr::StringToUInt8_DataSize(
+        reg.GetString("FastCGI", "MemoryGrowthLimit", "0", CNcbiRegistry::eReturn),
+        NStr::fConvErr_NoThrow);
+    size_t memory_base = 0;
 
     // Max. number of the Fast-CGI loop iterations
     unsigned int max_iterations;
@@ -382,6 +771,23 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
                << max_iterations << " iterations");
     }}
 
+    // Number of the worker threads accepting requests
+    unsigned int n_threads = 1;
+    {{
+        int x_threads = reg.GetInt("FastCGI", "Threads", 1, 0,
+                                   CNcbiRegistry::eErrPost);
+        if (x_threads > 1) {
+# ifdef USE_FCGI_THREADS
+            n_threads = (unsigned int) x_threads;
+# else
+            ERR_POST_X(10, Warning <<
+                       "CCgiApplication::x_RunFastCGI:  [FastCGI].Threads "
+                       "conf.parameter value specified, but multi-threaded "
+                       "Fast-CGI is not supported in this build");
+# endif
+        }
+    }}
+
     // Watcher file -- to allow for stopping the Fast-CGI loop "prematurely"
     unique_ptr<CCgiWatchFile> watcher;
     {{
@@ -448,7 +854,33 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
     // Main Fast-CGI loop
     CTime mtime = s_GetModTime(GetArguments().GetProgramName());
 
-    for (m_Iteration = 1;  m_Iteration <= max_iterations;  ++m_Iteration) {
+    if (n_threads > 1) {
+        if ( channel_errors ) {
+            ERR_POST_X(13, Warning <<
+                       "CCgiApplication::x_RunFastCGI:  [FastCGI].ChannelErrors "
+                       "is not supported in the multi-threaded mode");
+        }
+        SFastCGIShared shared;
+        shared.listen_fd           = listen_fd;
+        shared.max_iterations      = max_iterations;
+        shared.watch_timeout       = watch_timeout;
+        shared.watcher             = watcher.get();
+        shared.mtime               = mtime;
+        shared.restart_delay       = restart_delay;
+        shared.total_memory_limit  = total_memory_limit;
+        shared.memory_growth_limit = memory_growth_limit;
+        shared.is_stat_log         = is_stat_log;
+        shared.prefix_pid          = prefix_pid;
+        x_RunFastCGIThreads(shared, n_threads, result);
+
+        GetDiagContext().SetAppState(eDiagAppState_AppEnd);
+        x_OnEvent(eExit, *result);
+        _TRACE("CCgiApplication::x_RunFastCGI:  return (FastCGI threads finished)");
+        return true;
+    }
+
+    for (m_State.m_Iteration = 1;  m_State.m_Iteration <= max_iterations;
+         ++m_State.m_Iteration) {
         // Run idler. By default this reopens log file(s).
         RunIdler();
 
@@ -457,25 +889,25 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
 
         if ( CDiagContext::IsSetOldPostFormat() ) {
             // Old format uses prefix for iteration
-            const string prefix(prefix_pid + NStr::IntToString(m_Iteration));
+            const string prefix(prefix_pid +
+                                NStr::IntToString(m_State.m_Iteration));
             PushDiagPostPrefix(prefix.c_str());
         }
         // Show PID and iteration # in all of the the diagnostics
-        SetDiagRequestId(m_Iteration);
+        SetDiagRequestId(m_State.m_Iteration);
         GetDiagContext().SetAppState(eDiagAppState_RequestBegin);
 
-        _TRACE("CCgiApplication::FastCGI: " << m_Iteration
+        _TRACE("CCgiApplication::FastCGI: " << m_State.m_Iteration
                << " iteration of " << max_iterations);
 
         // Accept the next request and obtain its data
-        FCGX_Stream *pfin = NULL, *pfout = NULL, *pferr = NULL;
-        FCGX_ParamArray penv = NULL;
+        SFastCGIRequest fcgi_request;
         int accept_errcode;
         // Formally finish the Fast-CGI request when all done
         CAutoFCGX_Request auto_request;
 # ifdef HAVE_FCGX_ACCEPT_R
         FCGX_Request& request = auto_request.GetRequest();
-        FCGX_InitRequest(&request, 0, FCGI_FAIL_ACCEPT_ON_INTR);
+        FCGX_InitRequest(&request, listen_fd, FCGI_FAIL_ACCEPT_ON_INTR);
 #   ifdef USE_ALARM
         struct sigaction old_sa;
         if ( watch_timeout ) {
@@ -515,7 +947,7 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
                         break;
                     }
                 }}
-                m_Iteration--;
+                m_State.m_Iteration--;
                 x_OnEvent(eWaiting, 115);
 
                 // User code requested Fast-CGI loop to end ASAP
@@ -528,16 +960,17 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
         }
 #   endif
         if (accept_errcode == 0) {
-            pfin  = request.in;
-            pfout = request.out;
-            pferr = request.err;
-            penv  = request.envp;
+            fcgi_request.in  = request.in;
+            fcgi_request.out = request.out;
+            fcgi_request.err = request.err;
+            fcgi_request.env = request.envp;
         }
 # else
-        accept_errcode = FCGX_Accept(&pfin, &pfout, &pferr, &penv);
+        accept_errcode = FCGX_Accept(&fcgi_request.in, &fcgi_request.out,
+                                     &fcgi_request.err, &fcgi_request.env);
 # endif
         if (channel_errors) {
-            auto_request.SetErrorStream(pferr);
+            auto_request.SetErrorStream(fcgi_request.err);
         }
         if (accept_errcode != 0) {
             _TRACE("CCgiApplication::x_RunFastCGI: no more requests");
@@ -545,254 +978,278 @@ bool CCgiApplication::x_RunFastCGI(int* result, unsigned int def_iter)
         }
 
         // Process the request
-        CTime start_time(CTime::eCurrent);
-        bool skip_stat_log = false;
+        if ( !x_ProcessFastCGIRequest(fcgi_request, max_iterations,
+                                      stat.get(), result) ) {
+            break;
+        }
 
-        // Safely clear contex data and reset "m_Context" to null
-        CAutoCgiContext auto_context;
-        try {
-            // Initialize CGI context with the new request data
-            CNcbiEnvironment env(penv);
-            PushDiagPostPrefix(env.Get(m_DiagPrefixEnv).c_str());
-
-            CCgiObuffer       obuf(pfout);
-            CNcbiOstream      ostr(&obuf);
-            CCgiIbuffer       ibuf(pfin);
-            CNcbiIstream      istr(&ibuf);
-            CNcbiArguments    args(0, 0);  // no cmd.-line ars
-
-            m_Context.reset(CreateContext(&args, &env, &istr, &ostr));
-            _ASSERT(m_Context.get());
-            m_Context->CheckStatus();
-
-            CNcbiOstream* orig_stream = NULL;
-            //int orig_fd = -1;
-            CNcbiStrstream result_copy;
-            unique_ptr<CNcbiOstream> new_stream;
-
-            auto_context.Reset(m_Context);
-
-            // Checking for exit request (if explicitly allowed)
-            if (reg.GetBool("FastCGI", "HonorExitRequest", false, 0,
-                            CNcbiRegistry::eErrPost)
-                && m_Context->GetRequest().GetEntries().find("exitfastcgi")
-                != m_Context->GetRequest().GetEntries().end()) {
-                x_OnEvent(eExitRequest, 114);
-                ostr <<
-                    "Content-Type: text/html" HTTP_EOL
-                    HTTP_EOL
-                    "Done";
-                _TRACE("CCgiApplication::x_RunFastCGI: aborting by request");
-                x_OnEvent(eEndRequest, 122);
+        // User code requested Fast-CGI loop to end ASAP
+        if ( m_ShouldExit ) {
+            break;
+        }
+
+        if ( s_CheckMemoryLimit(total_memory_limit)  ||
+             s_CheckMemoryGrowth(memory_growth_limit, &memory_base) ) {
+            break;
+        }
+
+        // If to restart the application
+        {{
+            int restart_code = s_ShouldRestart(mtime, watcher.get(),
+                                               restart_delay);
+            if (restart_code != 0) {
+                x_OnEvent(restart_code == kSR_Executable ?
+                        eExecutable : eWatchFile, restart_code);
+                *result = (restart_code == kSR_WatchFile) ? 0 : restart_code;
                 break;
             }
+        }}
+    } // Main Fast-CGI loop
+    GetDiagContext().SetAppState(eDiagAppState_AppEnd);
 
-            // Debug message (if requested)
-            bool is_debug = reg.GetBool("FastCGI", "Debug", false, 0,
-                                        CNcbiRegistry::eErrPost);
-            if ( is_debug ) {
-                m_Context->PutMsg
-                    ("FastCGI: "      + NStr::NumericToString(m_Iteration) +
-                     " iteration of " + NStr::NumericToString(max_iterations) +
-                     ", pid "         + NStr::NumericToString(CProcess::GetCurrentPid()));
-            }
+    //
+    x_OnEvent(eExit, *result);
+
+    // done
+    _TRACE("CCgiApplication::x_RunFastCGI:  return (FastCGI loop finished)");
+    return true;
+}
+
+
+bool CCgiApplication::x_ProcessFastCGIRequest(SFastCGIRequest& request,
+                                              unsigned int     max_iterations,
+                                              CCgiStatistics*  stat,
+                                              int*             result)
+{
+    const CNcbiRegistry& reg = GetConfig();
+    SRequestState& state = x_GetState();
+
+    CTime start_time(CTime::eCurrent);
+    bool skip_stat_log = false;
+
+    // Removes the request's diag. prefix when done (after the logging)
+    CAutoDiagPostPrefix auto_prefix;
+
+    // Safely clear contex data and reset "m_Context" to null
+    CAutoCgiContext auto_context;
+    try {
+        // Initialize CGI context with the new request data
+        CNcbiEnvironment env(request.env);
+        auto_prefix.Push(env.Get(m_DiagPrefixEnv));
+
+        CCgiObuffer       obuf(request.out);
+        CNcbiOstream      ostr(&obuf);
+        CCgiIbuffer       ibuf(request.in);
+        CNcbiIstream      istr(&ibuf);
+        CNcbiArguments    args(0, 0);  // no cmd.-line ars
+
+        state.m_Context.reset(CreateContext(&args, &env, &istr, &ostr));
+        _ASSERT(state.m_Context.get());
+        state.m_Context->CheckStatus();
+
+        CNcbiOstream* orig_stream = NULL;
+        //int orig_fd = -1;
+        CNcbiStrstream result_copy;
+        unique_ptr<CNcbiOstream> new_stream;
+
+        auto_context.Reset(state.m_Context);
+
+        // Checking for exit request (if explicitly allowed)
+        if (reg.GetBool("FastCGI", "HonorExitRequest", false, 0,
+                        CNcbiRegistry::eErrPost)
+            && state.m_Context->GetRequest().GetEntries().find("exitfastcgi")
+            != state.m_Context->GetRequest().GetEntries().end()) {
+            x_OnEvent(eExitRequest, 114);
+            ostr <<
+                "Content-Type: text/html" HTTP_EOL
+                HTTP_EOL
+                "Done";
+            _TRACE("CCgiApplication::x_RunFastCGI: aborting by request");
+            x_OnEvent(eEndRequest, 122);
+            return false;
+        }
 
-            ConfigureDiagnostics(*m_Context);
+        // Debug message (if requested)
+        bool is_debug = reg.GetBool("FastCGI", "Debug", false, 0,
+                                    CNcbiRegistry::eErrPost);
+        if ( is_debug ) {
+            state.m_Context->PutMsg
+                ("FastCGI: "      + NStr::NumericToString(state.m_Iteration) +
+                 " iteration of " + NStr::NumericToString(max_iterations) +
+                 ", pid "         + NStr::NumericToString(CProcess::GetCurrentPid()));
+        }
+
+        // Diagnostics settings are global; changing them per request
+        // would affect the requests processed by other threads
+        if ( m_ThreadState.Empty() ) {
+            ConfigureDiagnostics(*state.m_Context);
+        }
 
-            x_AddLBCookie();
+        x_AddLBCookie();
 
-            m_ArgContextSync = false;
+        state.m_ArgContextSync = false;
 
-            // Call ProcessRequest()
-            x_OnEvent(eStartRequest, 0);
-            _TRACE("CCgiApplication::Run: calling ProcessRequest()");
-            VerifyCgiContext(*m_Context);
-            ProcessHttpReferer();
-            LogRequest();
+        // Call ProcessRequest()
+        x_OnEvent(eStartRequest, 0);
+        _TRACE("CCgiApplication::Run: calling ProcessRequest()");
+        VerifyCgiContext(*state.m_Context);
+        ProcessHttpReferer();
+        LogRequest();
 
-            int x_result = 0;
+        int x_result = 0;
+        try {
             try {
-                try {
-                    m_Cache.reset( GetCacheStorage() );
-                } NCBI_CATCH_ALL_X(1, "Couldn't create cache")
-
-                bool skip_process_request = false;
-                bool caching_needed = IsCachingNeeded(m_Context->GetRequest());
-                if (m_Cache.get() && caching_needed) {
-                    skip_process_request = GetResultFromCache(m_Context->GetRequest(),
-                        m_Context->GetResponse().out());
-                }
-                if (!skip_process_request) {
-                    if( m_Cache.get() ) {
-                        CCgiStreamWrapper* wrapper =
-                            dynamic_cast<CCgiStreamWrapper*>(m_Context->GetResponse().GetOutput());
-                        if ( wrapper ) {
-                            wrapper->SetCacheStream(result_copy);
-                        }
-                        else {
-                            list<CNcbiOstream*> slist;
-                            orig_stream = m_Context->GetResponse().GetOutput();
-                            slist.push_back(orig_stream);
-                            slist.push_back(&result_copy);
-                            new_stream.reset(new CWStream(new CMultiWriter(slist), 1, 0,
-                                                          CRWStreambuf::fOwnWriter));
-                            m_Context->GetResponse().SetOutput(new_stream.get());
-                        }
+                state.m_Cache.reset( GetCacheStorage() );
+            } NCBI_CATCH_ALL_X(1, "Couldn't create cache")
+
+            bool skip_process_request = false;
+            bool caching_needed = IsCachingNeeded(state.m_Context->GetRequest());
+            if (state.m_Cache.get() && caching_needed) {
+                skip_process_request = GetResultFromCache(state.m_Context->GetRequest(),
+                    state.m_Context->GetResponse().out());
+            }
+            if (!skip_process_request) {
+                if( state.m_Cache.get() ) {
+                    CCgiStreamWrapper* wrapper =
+                        dynamic_cast<CCgiStreamWrapper*>(state.m_Context->GetResponse().GetOutput());
+                    if ( wrapper ) {
+                        wrapper->SetCacheStream(result_copy);
                     }
-                    GetDiagContext().SetAppState(eDiagAppState_Request);
-                    x_result = CCgiContext::ProcessCORSRequest(
-                        m_Context->GetRequest(), m_Context->GetResponse()) ?
-                        0 : ProcessRequest(*m_Context);
-                    GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
-                    m_Context->GetResponse().Finalize();
-                    if (x_result == 0) {
-                        if (m_Cache.get()) {
-                            m_Context->GetResponse().Flush();
-                            if (m_IsResultReady) {
-                                if(caching_needed)
-                                    SaveResultToCache(m_Context->GetRequest(), result_copy);
-                                else {
-                                    unique_ptr<CCgiRequest> saved_request(GetSavedRequest(m_RID));
-                                    if (saved_request.get())
-                                        SaveResultToCache(*saved_request, result_copy);
-                                }
-                            } else if (caching_needed) {
-                                SaveRequest(m_RID, m_Context->GetRequest());
-                            }
-                        }
+                    else {
+                        list<CNcbiOstream*> slist;
+                        orig_stream = state.m_Context->GetResponse().GetOutput();
+                        slist.push_back(orig_stream);
+                        slist.push_back(&result_copy);
+                        new_stream.reset(new CWStream(new CMultiWriter(slist), 1, 0,
+                                                      CRWStreambuf::fOwnWriter));
+                        state.m_Context->GetResponse().SetOutput(new_stream.get());
                     }
                 }
-            } catch (CCgiException& e) {
+                GetDiagContext().SetAppState(eDiagAppState_Request);
+                x_result = CCgiContext::ProcessCORSRequest(
+                    state.m_Context->GetRequest(), state.m_Context->GetResponse()) ?
+                    0 : ProcessRequest(*state.m_Context);
                 GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
-                if ( e.GetStatusCode() < CCgiException::e200_Ok  ||
-                     e.GetStatusCode() >= CCgiException::e400_BadRequest ) {
-                    throw;
+                state.m_Context->GetResponse().Finalize();
+                if (x_result == 0) {
+                    if (state.m_Cache.get()) {
+                        state.m_Context->GetResponse().Flush();
+                        if (state.m_IsResultReady) {
+                            if(caching_needed)
+                                SaveResultToCache(state.m_Context->GetRequest(), result_copy);
+                            else {
+                                unique_ptr<CCgiRequest> saved_request(GetSavedRequest(state.m_RID));
+                                if (saved_request.get())
+                                    SaveResultToCache(*saved_request, result_copy);
+                            }
+                        } else if (caching_needed) {
+                            SaveRequest(state.m_RID, state.m_Context->GetRequest());
+                        }
+                    }
                 }
-                // If for some reason exception with status 2xx was thrown,
-                // set the result to 0, update HTTP status and continue.
-                m_Context->GetResponse().SetStatus(e.GetStatusCode(),
-                                                   e.GetStatusMessage());
-                x_result = 0;
             }
-            catch (exception&) {
-                // Remember byte counts before the streams are destroyed.
-                CDiagContext::GetRequestContext().SetBytesRd(ibuf.GetCount());
-                CDiagContext::GetRequestContext().SetBytesWr(obuf.GetCount());
+        } catch (CCgiException& e) {
+            GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
+            if ( e.GetStatusCode() < CCgiException::e200_Ok  ||
+                 e.GetStatusCode() >= CCgiException::e400_BadRequest ) {
                 throw;
             }
-            GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
-            _TRACE("CCgiApplication::Run: flushing");
-            m_Context->GetResponse().Flush();
-            _TRACE("CCgiApplication::Run: done, status: " << x_result);
-            if (x_result != 0)
-                (*result)++;
-            FCGX_SetExitStatus(x_result, pfout);
+            // If for some reason exception with status 2xx was thrown,
+            // set the result to 0, update HTTP status and continue.
+            state.m_Context->GetResponse().SetStatus(e.GetStatusCode(),
+                                                     e.GetStatusMessage());
+            x_result = 0;
+        }
+        catch (exception&) {
+            // Remember byte counts before the streams are destroyed.
             CDiagContext::GetRequestContext().SetBytesRd(ibuf.GetCount());
             CDiagContext::GetRequestContext().SetBytesWr(obuf.GetCount());
-            x_OnEvent(x_result == 0 ? eSuccess : eError, x_result);
-            m_Context->GetResponse().SetOutput(0);
-            m_Context->GetRequest().SetInputStream(0);
+            throw;
         }
-        catch (exception& e) {
-            // Reset stream pointers since the streams have been destroyed.
-            try {
-                CNcbiOstream* os = m_Context->GetResponse().GetOutput();
-                if (os && !os->good()) {
-                    m_OutputBroken = true;
-                }
-            }
-            catch (exception&) {
-            }
-            m_Context->GetResponse().SetOutput(0);
-            m_Context->GetRequest().SetInputStream(0);
-
-            GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
-            // Increment error counter
+        GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
+        _TRACE("CCgiApplication::Run: flushing");
+        state.m_Context->GetResponse().Flush();
+        _TRACE("CCgiApplication::Run: done, status: " << x_result);
+        if (x_result != 0)
             (*result)++;
-
-            // Call the exception handler and set the CGI exit code
-            {{
-                CCgiObuffer  obuf(pfout);
-                CNcbiOstream ostr(&obuf);
-                int exit_code = OnException(e, ostr);
-                x_OnEvent(eException, exit_code);
-                FCGX_SetExitStatus(exit_code, pfout);
-            }}
-
-            // Logging
-            {{
-                string msg =
-                    "(FCGI) CCgiApplication::ProcessRequest() failed: ";
-                msg += e.what();
-                if ( is_stat_log ) {
-                    stat->Reset(start_time, *result, &e);
-                    msg = stat->Compose();
-                    stat->Submit(msg);
-                    skip_stat_log = true; // Don't print the same message again
-                }
-            }}
-
-            // Exception reporting
-            NCBI_REPORT_EXCEPTION_X
-                (9, "(FastCGI) CCgiApplication::x_RunFastCGI", e);
-
-            // (If to) abrupt the FCGI loop on error
-            {{
-                bool is_stop_onfail = reg.GetBool
-                    ("FastCGI","StopIfFailed", false, 0,
-                     CNcbiRegistry::eErrPost);
-                if ( is_stop_onfail ) {     // configured to stop on error
-                    // close current request
-                    x_OnEvent(eExitOnFail, 113);
-                    _TRACE("CCgiApplication::x_RunFastCGI: FINISHING(forced)");
-                    x_OnEvent(eEndRequest, 123);
-                    break;
-                }
-            }}
+        FCGX_SetExitStatus(x_result, request.out);
+        CDiagContext::GetRequestContext().SetBytesRd(ibuf.GetCount());
+        CDiagContext::GetRequestContext().SetBytesWr(obuf.GetCount());
+        x_OnEvent(x_result == 0 ? eSuccess : eError, x_result);
+        state.m_Context->GetResponse().SetOutput(0);
+        state.m_Context->GetRequest().SetInputStream(0);
+    }
+    catch (exception& e) {
+        // Reset stream pointers since the streams have been destroyed.
+        try {
+            CNcbiOstream* os = state.m_Context->GetResponse().GetOutput();
+            if (os && !os->good()) {
+                state.m_OutputBroken = true;
+            }
         }
+        catch (exception&) {
+        }
+        state.m_Context->GetResponse().SetOutput(0);
+        state.m_Context->GetRequest().SetInputStream(0);
+
         GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
+        // Increment error counter
+        (*result)++;
 
-        // Close current request
-        _TRACE("CCgiApplication::x_RunFastCGI: FINISHING");
+        // Call the exception handler and set the CGI exit code
+        {{
+            CCgiObuffer  obuf(request.out);
+            CNcbiOstream ostr(&obuf);
+            int exit_code = OnException(e, ostr);
+            x_OnEvent(eException, exit_code);
+            FCGX_SetExitStatus(exit_code, request.out);
+        }}
 
         // Logging
-        if ( is_stat_log  &&  !skip_stat_log ) {
-            stat->Reset(start_time, *result);
-            string msg = stat->Compose();
-            stat->Submit(msg);
-        }
-
-        //
-        x_OnEvent(eEndRequest, 121);
-
-        // User code requested Fast-CGI loop to end ASAP
-        if ( m_ShouldExit ) {
-            break;
-        }
+        {{
+            string msg =
+                "(FCGI) CCgiApplication::ProcessRequest() failed: ";
+            msg += e.what();
+            if ( stat ) {
+                stat->Reset(start_time, *result, &e);
+                msg = stat->Compose();
+                stat->Submit(msg);
+                skip_stat_log = true; // Don't print the same message again
+            }
+        }}
 
-        if ( s_CheckMemoryLimit(total_memory_limit) ) {
-            break;
-        }
+        // Exception reporting
+        NCBI_REPORT_EXCEPTION_X
+            (9, "(FastCGI) CCgiApplication::x_RunFastCGI", e);
 
-        // If to restart the application
+        // (If to) abrupt the FCGI loop on error
         {{
-            int restart_code = s_ShouldRestart(mtime, watcher.get(),
-                                               restart_delay);
-            if (restart_code != 0) {
-                x_OnEvent(restart_code == kSR_Executable ?
-                        eExecutable : eWatchFile, restart_code);
-                *result = (restart_code == kSR_WatchFile) ? 0 : restart_code;
-                break;
+            bool is_stop_onfail = reg.GetBool
+                ("FastCGI","StopIfFailed", false, 0,
+                 CNcbiRegistry::eErrPost);
+            if ( is_stop_onfail ) {     // configured to stop on error
+                // close current request
+                x_OnEvent(eExitOnFail, 113);
+                _TRACE("CCgiApplication::x_RunFastCGI: FINISHING(forced)");
+                x_OnEvent(eEndRequest, 123);
+                return false;
             }
         }}
-    } // Main Fast-CGI loop
-    GetDiagContext().SetAppState(eDiagAppState_AppEnd);
+    }
+    GetDiagContext().SetAppState(eDiagAppState_RequestEnd);
 
-    //
-    x_OnEvent(eExit, *result);
+    // Close current request
+    _TRACE("CCgiApplication::x_RunFastCGI: FINISHING");
 
-    // done
-    _TRACE("CCgiApplication::x_RunFastCGI:  return (FastCGI loop finished)");
+    // Logging
+    if ( stat  &&  !skip_stat_log ) {
+        stat->Reset(start_time, *result);
+        string msg = stat->Compose();
+        stat->Submit(msg);
+    }
+
+    //
+    x_OnEvent(eEndRequest, 121);
     return true;
 }
 
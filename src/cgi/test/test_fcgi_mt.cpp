@@ -0,0 +1,271 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   TEST for:  multi-threaded Fast-CGI ([FastCGI].Threads).
+ *   The application runs as a standalone Fast-CGI server in a child
+ *   process; the parent sends it concurrent requests, then checks that
+ *   the server drains and exits once [FastCGI].Iterations requests have
+ *   been accepted, although its threads wait for requests much longer
+ *   ([FastCGI].WatchFile.Timeout).
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbi_system.hpp>
+#include <corelib/ncbithr.hpp>
+#include <cgi/cgiapp.hpp>
+#include <cgi/cgictx.hpp>
+#include <connect/ncbi_socket.hpp>
+
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+
+USING_NCBI_SCOPE;
+
+
+static const int          kThreads  = 4;
+static const int          kRequests = 12;
+static const unsigned int kDelayMs  = 300;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTestFastCGIApp::
+//
+
+class CTestFastCGIApp : public CCgiApplication
+{
+public:
+    virtual int ProcessRequest(CCgiContext& ctx);
+};
+
+
+static CAtomicCounter_WithAutoInit s_Running;
+
+
+// Report the number of requests being processed simultaneously.
+int CTestFastCGIApp::ProcessRequest(CCgiContext& ctx)
+{
+    int running = (int) s_Running.Add(1);
+    SleepMilliSec(kDelayMs);
+    s_Running.Add(-1);
+
+    CCgiResponse& response = ctx.GetResponse();
+    response.SetContentType("text/plain");
+    response.WriteHeader();
+    response.out() << "running=" << running << NcbiEndl;
+    return 0;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CClientThread::
+//
+
+// Sends one Fast-CGI request, keeps the response body.
+class CClientThread : public CThread
+{
+public:
+    CClientThread(unsigned short port) : m_Port(port) { }
+
+    const string& GetBody(void) const { return m_Body; }
+
+protected:
+    virtual void* Main(void);
+
+private:
+    enum ERecord {
+        eBeginRequest = 1,
+        eEndRequest   = 3,
+        eParams       = 4,
+        eStdin        = 5,
+        eStdout       = 6
+    };
+
+    static void x_AddRecord(string& out, int type, const string& content);
+    static void x_AddParam (string& out, const string& name,
+                            const string& value);
+
+    unsigned short m_Port;
+    string         m_Body;
+};
+
+
+void CClientThread::x_AddRecord(string& out, int type, const string& content)
+{
+    out += char(1);               // version
+    out += char(type);
+    out += char(0);
+    out += char(1);               // request ID
+    out += char(content.size() >> 8);
+    out += char(content.size() & 0xFF);
+    out += char(0);               // padding
+    out += char(0);
+    out += content;
+}
+
+
+void CClientThread::x_AddParam(string& out, const string& name,
+                               const string& value)
+{
+    _ASSERT(name.size() < 128  &&  value.size() < 128);
+    out += char(name.size());
+    out += char(value.size());
+    out += name;
+    out += value;
+}
+
+
+void* CClientThread::Main(void)
+{
+    string params;
+    x_AddParam(params, "REQUEST_METHOD",  "GET");
+    x_AddParam(params, "QUERY_STRING",    "");
+    x_AddParam(params, "SERVER_SOFTWARE", "test_fcgi_mt");
+    x_AddParam(params, "SCRIPT_NAME",     "/test_fcgi_mt");
+
+    string request;
+    x_AddRecord(request, eBeginRequest, string("\0\1\0\0\0\0\0\0", 8));
+    x_AddRecord(request, eParams, params);
+    x_AddRecord(request, eParams, kEmptyStr);
+    x_AddRecord(request, eStdin,  kEmptyStr);
+
+    // The server may still be starting up
+    CSocket sock;
+    for (int attempt = 0;  ; ++attempt) {
+        if (sock.Connect("127.0.0.1", m_Port) == eIO_Success) {
+            break;
+        }
+        assert(attempt < 100);
+        SleepMilliSec(100);
+    }
+    sock.SetTimeout(eIO_ReadWrite, kInfiniteTimeout);
+    assert(sock.Write(request.data(), request.size()) == eIO_Success);
+
+    string output;
+    for (;;) {
+        unsigned char hdr[8];
+        assert(sock.Read(hdr, sizeof(hdr), 0, eIO_ReadPersist)
+               == eIO_Success);
+        size_t len = ((size_t) hdr[4] << 8) | hdr[5];
+        string content(len + hdr[6], '\0');
+        if ( !content.empty() ) {
+            assert(sock.Read(&content[0], content.size(), 0,
+                             eIO_ReadPersist) == eIO_Success);
+        }
+        if (hdr[1] == eEndRequest) {
+            break;
+        }
+        if (hdr[1] == eStdout) {
+            output.append(content, 0, len);
+        }
+    }
+
+    SIZE_TYPE body = output.find("\r\n\r\n");
+    assert(body != NPOS);
+    m_Body = NStr::TruncateSpaces(output.substr(body + 4));
+    return NULL;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  MAIN
+//
+
+int main(int argc, const char* argv[])
+{
+    // Pick a free local port for the server
+    unsigned short port;
+    {{
+        CListeningSocket listener;
+        assert(listener.Listen(0) == eIO_Success);
+        port = listener.GetPort(eNH_HostByteOrder);
+    }}
+
+    pid_t pid = fork();
+    assert(pid != -1);
+    if (pid == 0) {
+        // Server: a thread waits up to a minute for a request, so only
+        // the wake-up on drain lets it exit soon after the last one.
+        setenv("FCGI_STANDALONE_SERVER",
+               (":" + NStr::NumericToString(port)).c_str(), 1);
+        setenv("NCBI_CONFIG__FASTCGI__THREADS",
+               NStr::NumericToString(kThreads).c_str(), 1);
+        setenv("NCBI_CONFIG__FASTCGI__ITERATIONS",
+               NStr::NumericToString(kRequests).c_str(), 1);
+        setenv("NCBI_CONFIG__FASTCGI__WATCHFILE_DOT_TIMEOUT", "60", 1);
+        return CTestFastCGIApp().AppMain(argc, argv);
+    }
+
+    // Client
+    CStopWatch sw(CStopWatch::eStart);
+    vector< CRef<CClientThread> > clients;
+    for (int i = 0;  i < kRequests;  ++i) {
+        clients.push_back(CRef<CClientThread>(new CClientThread(port)));
+        clients.back()->Run();
+    }
+    int max_running = 0;
+    NON_CONST_ITERATE(vector< CRef<CClientThread> >, it, clients) {
+        (*it)->Join();
+        const string& body = (*it)->GetBody();
+        assert(NStr::StartsWith(body, "running="));
+        max_running = max(max_running,
+                          NStr::StringToInt(body.substr(8)));
+    }
+    double elapsed = sw.Elapsed();
+    cout << kRequests << " requests in " << elapsed << " s, up to "
+         << max_running << " at once" << endl;
+    assert(max_running > 1  &&  max_running <= kThreads);
+
+    // The server must exit by itself, well before the threads' waits for
+    // requests could time out
+    int status = 0;
+    for (int i = 0;  ;  ++i) {
+        pid_t res = waitpid(pid, &status, WNOHANG);
+        assert(res != -1);
+        if (res == pid) {
+            break;
+        }
+        if (i == 200) {
+            kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            cout << "The server did not drain" << endl;
+            return 1;
+        }
+        SleepMilliSec(100);
+    }
+    assert(WIFEXITED(status)  &&  WEXITSTATUS(status) == 0);
+
+    cout << "Test completed successfully!" << endl;
+    return 0;
+}
@@ -35,12 +35,109 @@
 #include <connect/error_codes.hpp>
 #include "connection_pool.hpp"
 
+#include <algorithm>
+
+#ifdef NCBI_OS_LINUX
+#  include <sys/epoll.h>
+#  include <unistd.h>
+#  include <errno.h>
+#endif
+
 
 #define NCBI_USE_ERRCODE_X   Connect_ThrServer
 
 
 BEGIN_NCBI_SCOPE
 
+
+#ifdef NCBI_OS_LINUX
+// 1024 ticks of 100 ms: the longer timeouts take a few wheel turns
+static const size_t kTimerWheelSize = 1024;
+static const Uint8  kTimerTickMs    = 100;
+static const int    kMaxEpollEvents = 1024;
+
+static Uint8 s_GetCurrentTick(void)
+{
+    time_t  sec;
+    long    nanosec;
+    CTime::GetCurrentTimeT(&sec, &nanosec);
+    return ((Uint8) sec * 1000 + nanosec / 1000000) / kTimerTickMs;
+}
+
+static int s_GetFD(IServer_ConnectionBase* conn)
+{
+    CPollable* pollable = dynamic_cast<CPollable*>(conn);
+    int        fd = -1;
+    if (pollable == NULL
+        ||  pollable->GetOSHandle(&fd, sizeof(fd)) != eIO_Success)
+        return -1;
+    return fd;
+}
+
+// Same as SOCK_Poll() reports the poll() results
+static EIO_Event s_GetReadyEvents(EIO_Event events, uint32_t epoll_events)
+{
+    int revents = eIO_Open;
+    if ((events & eIO_Read)
+        &&  (epoll_events & (EPOLLIN | EPOLLHUP | EPOLLPRI)))
+        revents |= eIO_Read;
+    if ((events & eIO_Write)  &&  (epoll_events & (EPOLLOUT | EPOLLHUP)))
+        revents |= eIO_Write;
+    if (revents == eIO_Open  &&  (epoll_events & EPOLLERR))
+        revents = eIO_Close;
+    return (EIO_Event) revents;
+}
+#endif
+
+
+// Accumulates the connections with the earliest alarm time
+static void s_AddAlarm(IServer_ConnectionBase* conn_base,
+                       const CTime* alarm_time,
+                       bool& alarm_time_defined,
+                       CTime& current_time,
+                       const CTime*& min_alarm_time,
+                       vector<IServer_ConnectionBase*>& timer_requests)
+{
+    if (!alarm_time_defined) {
+        alarm_time_defined = true;
+        current_time = GetFastLocalTime();
+        min_alarm_time = *alarm_time > current_time? alarm_time: NULL;
+        timer_requests.clear();
+        timer_requests.push_back(conn_base);
+    } else if (min_alarm_time == NULL) {
+        if (*alarm_time <= current_time)
+            timer_requests.push_back(conn_base);
+    } else if (*alarm_time <= *min_alarm_time) {
+        if (*alarm_time != *min_alarm_time) {
+            min_alarm_time = *alarm_time > current_time? alarm_time
+                                                       : NULL;
+            timer_requests.clear();
+        }
+        timer_requests.push_back(conn_base);
+    }
+}
+
+static void s_SetTimerTimeout(const CTime* min_alarm_time,
+                              const CTime& current_time,
+                              STimeout* timer_timeout)
+{
+    if (min_alarm_time == NULL)
+        timer_timeout->usec = timer_timeout->sec = 0;
+    else {
+        CTimeSpan span(min_alarm_time->DiffTimeSpan(current_time));
+        if (span.GetCompleteSeconds() < 0 ||
+            span.GetNanoSecondsAfterSecond() < 0)
+        {
+            timer_timeout->usec = timer_timeout->sec = 0;
+        }
+        else {
+            timer_timeout->sec = (unsigned) span.GetCompleteSeconds();
+            timer_timeout->usec = span.GetNanoSecondsAfterSecond() / 1000;
+        }
+    }
+}
+
+
 std::string g_ServerConnTypeToString(enum EServerConnType  conn_type)
 {
     switch (conn_type) {
@@ -92,11 +189,36 @@ CServer_ConnectionPool::CServer_ConnectionPool(unsigned max_connections) :
     CheckIOStatus(m_ControlSocket.SetTimeout(eIO_Write,
         &kTimeout), "SetTimeout");
     CheckIOStatus(listener.Accept(m_ControlSocketForPoll), "Accept");
+
+#ifdef NCBI_OS_LINUX
+    m_TimerWheel.resize(kTimerWheelSize);
+    m_TimerTick = s_GetCurrentTick();
+    m_EpollFD = epoll_create(1);
+    if (m_EpollFD == -1) {
+        NCBI_THROW_FMT(CConnException, eConn,
+                       "Cannot create epoll descriptor, errno " << errno);
+    }
+    // The control connection is always level-triggered
+    struct epoll_event evt;
+    evt.events = EPOLLIN;
+    evt.data.ptr = static_cast<TConnBase*>(&m_ControlSocketForPoll);
+    if (epoll_ctl(m_EpollFD, EPOLL_CTL_ADD,
+                  s_GetFD(&m_ControlSocketForPoll), &evt) != 0) {
+        int x_errno = errno;
+        close(m_EpollFD);
+        NCBI_THROW_FMT(CConnException, eConn,
+                       "Cannot add signaling socket to epoll, errno "
+                       << x_errno);
+    }
+#endif
 }
 
 CServer_ConnectionPool::~CServer_ConnectionPool()
 {
     Erase();
+#ifdef NCBI_OS_LINUX
+    close(m_EpollFD);
+#endif
 }
 
 void CServer_ConnectionPool::Erase(void)
@@ -112,9 +234,19 @@ void CServer_ConnectionPool::Erase(void)
         delete *it;
     }
     m_Data.clear();
+
+#ifdef NCBI_OS_LINUX
+    NON_CONST_ITERATE(vector<TData>, it, m_TimerWheel) {
+        it->clear();
+    }
+    m_AlarmConns.clear();
+    m_Deferred.clear();
+    m_Closed.clear();
+    m_Ready.clear();
+#endif
 }
 
-void CServer_ConnectionPool::x_UpdateExpiration(TConnBase* conn)
+const STimeout* CServer_ConnectionPool::x_UpdateExpiration(TConnBase* conn)
 {
     const STimeout* timeout = kDefaultTimeout;
     const CSocket*  socket  = dynamic_cast<const CSocket*>(conn);
@@ -126,18 +258,20 @@ void CServer_ConnectionPool::x_UpdateExpiration(TConnBase* conn)
         conn->expiration = GetFastLocalTime();
         conn->expiration.AddSecond(timeout->sec, CTime::eIgnoreDaylight);
         conn->expiration.AddNanoSecond(timeout->usec * 1000);
-    } else {
-        conn->expiration.Clear();
+        return timeout;
     }
+    conn->expiration.Clear();
+    return NULL;
 }
 
 bool CServer_ConnectionPool::Add(TConnBase* conn, EServerConnType type)
 {
     conn->type_lock.Lock();
-    x_UpdateExpiration(conn);
+    const STimeout* timeout = x_UpdateExpiration(conn);
     conn->type = type;
     conn->type_lock.Unlock();
 
+    bool wake_up = true;
     {{
         CMutexGuard guard(m_Mutex);
         if (m_Data.size() >= m_MaxConnections)
@@ -146,9 +280,23 @@ bool CServer_ConnectionPool::Add(TConnBase* conn, EServerConnType type)
         if (m_Data.find(conn) != m_Data.end())
             abort();
         m_Data.insert(conn);
+
+#ifdef NCBI_OS_LINUX
+        wake_up = false;
+        if (type == eInactiveSocket) {
+            conn->type_lock.Lock();
+            wake_up = x_Schedule(conn, timeout);
+            conn->type_lock.Unlock();
+        }
+        else if (type == eListener)
+            x_RegisterListeners();
+#else
+        (void) timeout;
+#endif
     }}
 
-    PingControlConnection();
+    if (wake_up)
+        PingControlConnection();
     return true;
 }
 
@@ -156,30 +304,56 @@ void CServer_ConnectionPool::Remove(TConnBase* conn)
 {
     CMutexGuard guard(m_Mutex);
     m_Data.erase(conn);
+#ifdef NCBI_OS_LINUX
+    x_Forget(conn);
+#endif
 }
 
 
 void CServer_ConnectionPool::SetConnType(TConnBase* conn, EServerConnType type)
 {
+#ifdef NCBI_OS_LINUX
+    // The poll cycle looks at the inactive connections under m_Mutex so
+    // the connection is fully scheduled before it can see it
+    bool wake_up = false;
+    CMutexGuard guard(m_Mutex);
+#endif
+
     conn->type_lock.Lock();
     if (conn->type != eClosedSocket) {
         EServerConnType new_type = type;
+        const STimeout* timeout = NULL;
         if (type == eInactiveSocket) {
             if (conn->type == ePreDeferredSocket)
                 new_type = eDeferredSocket;
             else if (conn->type == ePreClosedSocket)
                 new_type = eClosedSocket;
             else
-                x_UpdateExpiration(conn);
+                timeout = x_UpdateExpiration(conn);
         }
         conn->type = new_type;
+#ifdef NCBI_OS_LINUX
+        if (type == eInactiveSocket  &&  m_Data.find(conn) != m_Data.end())
+            wake_up = x_Schedule(conn, timeout);
+#else
+        (void) timeout;
+#endif
     }
     conn->type_lock.Unlock();
 
+#ifdef NCBI_OS_LINUX
+    guard.Release();
+    // The socket is re-armed already; the poll cycle needs to be woken up
+    // only if it has to reconsider the deferred, closed or alarmed
+    // connections
+    if (wake_up)
+        PingControlConnection();
+#else
     // Signal poll cycle to re-read poll vector by sending
     // byte to control socket
     if (type == eInactiveSocket)
         PingControlConnection();
+#endif
 }
 
 void CServer_ConnectionPool::PingControlConnection(void)
@@ -214,6 +388,7 @@ void CServer_ConnectionPool::CloseConnection(TConnBase* conn)
     srv_conn->OnSocketEvent(eServIO_OurClose);
 }
 
+#ifndef NCBI_OS_LINUX
 bool CServer_ConnectionPool::GetPollAndTimerVec(
                              vector<CSocketAPI::SPoll>& polls,
                              vector<IServer_ConnectionBase*>& timer_requests,
@@ -270,23 +445,8 @@ bool CServer_ConnectionPool::GetPollAndTimerVec(
             polls.push_back(CSocketAPI::SPoll(pollable,
                             conn_base->GetEventsToPollFor(&alarm_time)));
             if (alarm_time != NULL) {
-                if (!alarm_time_defined) {
-                    alarm_time_defined = true;
-                    current_time = GetFastLocalTime();
-                    min_alarm_time = *alarm_time > current_time? alarm_time: NULL;
-                    timer_requests.clear();
-                    timer_requests.push_back(conn_base);
-                } else if (min_alarm_time == NULL) {
-                    if (*alarm_time <= current_time)
-                        timer_requests.push_back(conn_base);
-                } else if (*alarm_time <= *min_alarm_time) {
-                    if (*alarm_time != *min_alarm_time) {
-                        min_alarm_time = *alarm_time > current_time? alarm_time
-                                                                   : NULL;
-                        timer_requests.clear();
-                    }
-                    timer_requests.push_back(conn_base);
-                }
+                s_AddAlarm(conn_base, alarm_time, alarm_time_defined,
+                           current_time, min_alarm_time, timer_requests);
                 alarm_time = NULL;
             }
         }
@@ -300,24 +460,362 @@ bool CServer_ConnectionPool::GetPollAndTimerVec(
     guard.Release();
 
     if (alarm_time_defined) {
-        if (min_alarm_time == NULL)
-            timer_timeout->usec = timer_timeout->sec = 0;
-        else {
-            CTimeSpan span(min_alarm_time->DiffTimeSpan(current_time));
-            if (span.GetCompleteSeconds() < 0 ||
-                span.GetNanoSecondsAfterSecond() < 0)
+        s_SetTimerTimeout(min_alarm_time, current_time, timer_timeout);
+        return true;
+    }
+    return false;
+}
+
+EIO_Status CServer_ConnectionPool::Poll(vector<CSocketAPI::SPoll>& polls,
+                                        const STimeout* timeout,
+                                        size_t* count)
+{
+    return CSocketAPI::Poll(polls, timeout, count);
+}
+#else /* NCBI_OS_LINUX */
+
+bool CServer_ConnectionPool::GetPollAndTimerVec(
+                             vector<CSocketAPI::SPoll>& polls,
+                             vector<IServer_ConnectionBase*>& timer_requests,
+                             STimeout* timer_timeout,
+                             vector<IServer_ConnectionBase*>& revived_conns,
+                             vector<IServer_ConnectionBase*>& to_close_conns,
+                             vector<IServer_ConnectionBase*>& to_delete_conns)
+{
+    // The inactive connections are in the epoll set already so only the
+    // connections which changed their state are looked at here. The poll
+    // vector is filled by Poll().
+    polls.clear();
+    revived_conns.clear();
+    to_close_conns.clear();
+    to_delete_conns.clear();
+
+    CMutexGuard guard(m_Mutex);
+
+    // The connections which were closed earlier (see the comment in the
+    // other version of this method)
+    vector<TConnBase*> closed;
+    closed.swap(m_Closed);
+    ITERATE(vector<TConnBase*>, it, closed) {
+        x_Forget(*it);
+        m_Data.erase(*it);
+        to_delete_conns.push_back(*it);
+    }
+
+    ERASE_ITERATE(TData, it, m_Deferred) {
+        TConnBase* conn_base = *it;
+        conn_base->type_lock.Lock();
+        if (conn_base->type == eDeferredSocket
+            &&  conn_base->IsReadyToProcess())
+        {
+            conn_base->type = eActiveSocket;
+            revived_conns.push_back(conn_base);
+            m_Deferred.erase(it);
+        }
+        conn_base->type_lock.Unlock();
+    }
+
+    x_ExpireConnections(to_close_conns);
+
+    CTime current_time(CTime::eEmpty);
+    const CTime* alarm_time = NULL;
+    const CTime* min_alarm_time = NULL;
+    bool alarm_time_defined = false;
+    ITERATE(TData, it, m_AlarmConns) {
+        TConnBase* conn_base = *it;
+        conn_base->type_lock.Lock();
+        if (conn_base->type == eInactiveSocket) {
+            conn_base->GetEventsToPollFor(&alarm_time);
+            if (alarm_time != NULL) {
+                s_AddAlarm(conn_base, alarm_time, alarm_time_defined,
+                           current_time, min_alarm_time, timer_requests);
+                alarm_time = NULL;
+            }
+        }
+        conn_base->type_lock.Unlock();
+    }
+    guard.Release();
+
+    if (alarm_time_defined) {
+        s_SetTimerTimeout(min_alarm_time, current_time, timer_timeout);
+        return true;
+    }
+    return false;
+}
+
+EIO_Status CServer_ConnectionPool::Poll(vector<CSocketAPI::SPoll>& polls,
+                                        const STimeout* timeout,
+                                        size_t* count)
+{
+    polls.clear();
+
+    // The connections which are ready without waiting go first
+    TData ready_conns;
+    {{
+        CMutexGuard guard(m_Mutex);
+        ITERATE(vector<TReadyConn>, it, m_Ready) {
+            TConnBase* conn_base = it->first;
+            conn_base->type_lock.Lock();
+            if (conn_base->type == eInactiveSocket
+                &&  ready_conns.insert(conn_base).second)
             {
-                timer_timeout->usec = timer_timeout->sec = 0;
+                CSocketAPI::SPoll poll(dynamic_cast<CPollable*>(conn_base),
+                                       it->second);
+                poll.m_REvent = it->second;
+                polls.push_back(poll);
+            }
+            conn_base->type_lock.Unlock();
+        }
+        m_Ready.clear();
+    }}
+
+    int wait_ms = -1;
+    if (!polls.empty())
+        wait_ms = 0;
+    else if (timeout != kDefaultTimeout  &&  timeout != kInfiniteTimeout)
+        wait_ms = (int) (timeout->sec * 1000 + (timeout->usec + 999) / 1000);
+
+    CStopWatch          sw(CStopWatch::eStart);
+    struct epoll_event  events[kMaxEpollEvents];
+    for (;;) {
+        int n = epoll_wait(m_EpollFD, events, kMaxEpollEvents, wait_ms);
+        if (n < 0) {
+            if (errno != EINTR) {
+                if (polls.empty())
+                    return eIO_Unknown;
+                break;
             }
+            n = 0;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            TConnBase* conn_base = static_cast<TConnBase*>(events[i].data.ptr);
+            CPollable* pollable = dynamic_cast<CPollable*>(conn_base);
+            EIO_Event  poll_events = eIO_Read;
+            EIO_Event  revents = eIO_Open;
+
+            if (conn_base == &m_ControlSocketForPoll)
+                revents = s_GetReadyEvents(eIO_Read, events[i].events);
             else {
-                timer_timeout->sec = (unsigned) span.GetCompleteSeconds();
-                timer_timeout->usec = span.GetNanoSecondsAfterSecond() / 1000;
+                conn_base->type_lock.Lock();
+                if (conn_base->type == eListener)
+                    revents = s_GetReadyEvents(eIO_Read, events[i].events);
+                else if (conn_base->type == eInactiveSocket
+                         &&  ready_conns.find(conn_base) == ready_conns.end())
+                {
+                    const CTime* alarm_time = NULL;
+                    poll_events = conn_base->GetEventsToPollFor(&alarm_time);
+                    revents = s_GetReadyEvents(poll_events, events[i].events);
+                }
+                // Otherwise it is a one-shot event which was armed before
+                // the connection was activated by its timer. The socket is
+                // armed again when the connection becomes inactive.
+                conn_base->type_lock.Unlock();
+            }
+
+            if (revents != eIO_Open) {
+                CSocketAPI::SPoll poll(pollable, poll_events);
+                poll.m_REvent = revents;
+                polls.push_back(poll);
             }
         }
+
+        if (!polls.empty()  ||  wait_ms == 0)
+            break;
+        if (wait_ms > 0) {
+            // Only the stale events came; wait for the rest of the timeout
+            int elapsed = (int) (sw.Restart() * 1000);
+            if (elapsed >= wait_ms)
+                break;
+            wait_ms -= elapsed;
+        }
+    }
+
+    *count = polls.size();
+    return polls.empty() ? eIO_Timeout : eIO_Success;
+}
+
+// m_Mutex and the connection type_lock must be held
+bool CServer_ConnectionPool::x_Schedule(TConnBase* conn,
+                                        const STimeout* timeout)
+{
+    if (conn->type == eDeferredSocket) {
+        x_CancelExpiration(conn);
+        m_AlarmConns.erase(conn);
+        m_Deferred.insert(conn);
         return true;
     }
-    return false;
+    if (conn->type == eClosedSocket  ||  !conn->IsOpen()) {
+        x_CancelExpiration(conn);
+        m_AlarmConns.erase(conn);
+        m_Closed.push_back(conn);
+        return true;
+    }
+
+    const CTime* alarm_time = NULL;
+    EIO_Event    events = conn->GetEventsToPollFor(&alarm_time);
+    bool         wake_up = false;
+
+    if (alarm_time != NULL) {
+        // The poll cycle timeout depends on it
+        m_AlarmConns.insert(conn);
+        wake_up = true;
+    }
+    else
+        m_AlarmConns.erase(conn);
+    x_ScheduleExpiration(conn, timeout);
+
+    int fd = s_GetFD(conn);
+    if (fd == -1) {
+        // Closed by the handler; poll() reports such sockets as closed
+        m_Ready.push_back(TReadyConn(conn, eIO_Close));
+        return true;
+    }
+
+    // The buffered input would never make the socket readable again
+    CSocket* socket = dynamic_cast<CSocket*>(conn);
+    if ((events & eIO_Read)  &&  socket != NULL
+        &&  socket->GetPosition(eIO_Read) != socket->GetCount(eIO_Read))
+    {
+        m_Ready.push_back(TReadyConn(conn, eIO_Read));
+        return true;
+    }
+
+    struct epoll_event evt;
+    evt.events = EPOLLET | EPOLLONESHOT;
+    if (events & eIO_Read)
+        evt.events |= EPOLLIN;
+    if (events & eIO_Write)
+        evt.events |= EPOLLOUT;
+    evt.data.ptr = conn;
+    if (epoll_ctl(m_EpollFD, EPOLL_CTL_MOD, fd, &evt) != 0
+        &&  (errno != ENOENT
+             ||  epoll_ctl(m_EpollFD, EPOLL_CTL_ADD, fd, &evt) != 0))
+    {
+        int x_errno = errno;
+        ERR_POST_X(11, Critical << "Cannot add socket to epoll, errno "
+                   << x_errno << ". Closing the connection.");
+        m_Ready.push_back(TReadyConn(conn, eIO_Close));
+        return true;
+    }
+    return wake_up;
+}
+
+// m_Mutex must be held
+void CServer_ConnectionPool::x_Forget(TConnBase* conn)
+{
+    x_CancelExpiration(conn);
+    m_AlarmConns.erase(conn);
+    m_Deferred.erase(conn);
+    m_Closed.erase(remove(m_Closed.begin(), m_Closed.end(), conn),
+                   m_Closed.end());
+    for (vector<TReadyConn>::iterator it = m_Ready.begin();
+         it != m_Ready.end(); ) {
+        if (it->first == conn)
+            it = m_Ready.erase(it);
+        else
+            ++it;
+    }
+
+    // A closed socket has left the epoll set already
+    int fd = s_GetFD(conn);
+    if (fd != -1) {
+        struct epoll_event evt;
+        epoll_ctl(m_EpollFD, EPOLL_CTL_DEL, fd, &evt);
+    }
+}
+
+// m_Mutex must be held
+void CServer_ConnectionPool::x_ScheduleExpiration(TConnBase* conn,
+                                                  const STimeout* timeout)
+{
+    x_CancelExpiration(conn);
+    if (timeout == NULL)
+        return;
+
+    // Rounded up so that the connection is never closed early
+    Uint8 timeout_ms = (Uint8) timeout->sec * 1000 +
+                       (timeout->usec + 999) / 1000;
+    conn->timer_tick = s_GetCurrentTick() +
+                       (timeout_ms + kTimerTickMs - 1) / kTimerTickMs;
+    m_TimerWheel[conn->timer_tick % kTimerWheelSize].insert(conn);
+}
+
+// m_Mutex must be held
+void CServer_ConnectionPool::x_CancelExpiration(TConnBase* conn)
+{
+    if (conn->timer_tick != 0) {
+        m_TimerWheel[conn->timer_tick % kTimerWheelSize].erase(conn);
+        conn->timer_tick = 0;
+    }
+}
+
+// m_Mutex must be held
+void CServer_ConnectionPool::x_ExpireConnections(
+                            vector<IServer_ConnectionBase*>& to_close_conns)
+{
+    Uint8 current_tick = s_GetCurrentTick();
+    if (current_tick < m_TimerTick)
+        m_TimerTick = current_tick;   // The clock went back
+
+    // The slots of the passed ticks; a full turn is enough if the poll
+    // cycle has not been here for a long time
+    Uint8 tick = m_TimerTick;
+    if (current_tick - tick > kTimerWheelSize)
+        tick = current_tick - kTimerWheelSize;
+
+    for (; tick < current_tick; ++tick) {
+        TData& slot = m_TimerWheel[tick % kTimerWheelSize];
+        ERASE_ITERATE(TData, it, slot) {
+            TConnBase* conn_base = *it;
+            if (conn_base->timer_tick >= current_tick)
+                continue;   // One of the next wheel turns
+
+            conn_base->type_lock.Lock();
+            bool expired = conn_base->type == eInactiveSocket;
+            conn_base->type_lock.Unlock();
+
+            // The active connections get a new expiration time when they
+            // become inactive
+            slot.erase(it);
+            conn_base->timer_tick = 0;
+            if (expired) {
+                x_Forget(conn_base);
+                m_Data.erase(conn_base);
+                to_close_conns.push_back(conn_base);
+            }
+        }
+    }
+    m_TimerTick = current_tick;
+}
+
+// m_Mutex must be held. The listening sockets are level-triggered.
+void CServer_ConnectionPool::x_RegisterListeners(void)
+{
+    ITERATE(TData, it, m_Data) {
+        TConnBase* conn_base = *it;
+        conn_base->type_lock.Lock();
+        bool listener = conn_base->type == eListener;
+        conn_base->type_lock.Unlock();
+        if (!listener)
+            continue;
+
+        int fd = s_GetFD(conn_base);
+        if (fd == -1)
+            continue;
+
+        struct epoll_event evt;
+        evt.events = EPOLLIN;
+        evt.data.ptr = conn_base;
+        if (epoll_ctl(m_EpollFD, EPOLL_CTL_ADD, fd, &evt) != 0
+            &&  errno != EEXIST) {
+            int x_errno = errno;
+            ERR_POST_X(11, Critical << "Cannot add listening socket to "
+                       "epoll, errno " << x_errno);
+        }
+    }
 }
+#endif /* NCBI_OS_LINUX */
 
 void CServer_ConnectionPool::SetAllActive(const vector<CSocketAPI::SPoll>& polls)
 {
@@ -356,6 +854,9 @@ void CServer_ConnectionPool::StartListening(void)
     ITERATE (TData, it, m_Data) {
         (*it)->Activate();
     }
+#ifdef NCBI_OS_LINUX
+    x_RegisterListeners();
+#endif
 }
 
 
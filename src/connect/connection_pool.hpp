@@ -94,12 +94,31 @@ public:
                             vector<IServer_ConnectionBase*>& to_close_conns,
                             vector<IServer_ConnectionBase*>& to_delete_conns);
 
+    /// Wait for I/O events on the connections prepared by
+    /// GetPollAndTimerVec(). On return polls has the ready connections
+    /// with m_REvent set.
+    EIO_Status Poll(vector<CSocketAPI::SPoll>& polls,
+                    const STimeout* timeout, size_t* count);
+
     void StartListening(void);
     void StopListening(void);
 
 private:
-    void x_UpdateExpiration(TConnBase* conn);
-
+    const STimeout* x_UpdateExpiration(TConnBase* conn);
+
+#ifdef NCBI_OS_LINUX
+    // The sockets stay registered in the epoll set for their whole life.
+    // A connection which becomes inactive is re-armed in
+    // SetConnType() (one-shot, edge-triggered), so the poll cycle only
+    // deals with the ready connections. The expiration times are kept in
+    // a timer wheel which is advanced by GetPollAndTimerVec().
+    bool x_Schedule(TConnBase* conn, const STimeout* timeout);
+    void x_Forget(TConnBase* conn);
+    void x_ScheduleExpiration(TConnBase* conn, const STimeout* timeout);
+    void x_CancelExpiration(TConnBase* conn);
+    void x_ExpireConnections(vector<IServer_ConnectionBase*>& to_close_conns);
+    void x_RegisterListeners(void);
+#endif
 
     typedef set<TConnBase*> TData;
 
@@ -109,6 +128,20 @@ private:
     CSocket         m_ControlSocket;
     mutable CServer_ControlConnection m_ControlSocketForPoll;
     CFastMutex      m_ControlMutex;
+
+#ifdef NCBI_OS_LINUX
+    typedef pair<TConnBase*, EIO_Event> TReadyConn;
+
+    int                 m_EpollFD;
+    vector<TData>       m_TimerWheel;
+    Uint8               m_TimerTick;   // The first not processed tick
+    TData               m_AlarmConns;  // Inactive ones with the alarm time
+    TData               m_Deferred;
+    vector<TConnBase*>  m_Closed;      // To be deleted
+    // Connections which are ready without polling: they have buffered
+    // input or their socket is closed already
+    vector<TReadyConn>  m_Ready;
+#endif
 };
 
 
@@ -35,7 +35,11 @@
 #include <corelib/ncbifile.hpp>
 #include <corelib/request_ctx.hpp>
 #include <corelib/ncbimtx.hpp>
+#include <corelib/rwstream.hpp>
 #include <connect/ncbi_http_session.hpp>
+#include <connect/ncbi_socket.hpp>
+#include <connect/ncbi_util.h>
+#include "ncbi_comm.h"
 #include <stdlib.h>
 
 
@@ -461,7 +465,10 @@ CHttpResponse::CHttpResponse(CHttpSession&   session,
       m_Location(url),
       m_Stream(&stream),
       m_Headers(new CHttpHeaders),
-      m_StatusCode(0)
+      m_StatusCode(0),
+      m_ConnectTime(0),
+      m_TimeToFirstByte(0),
+      m_ReuseCount(0)
 {
 }
 
@@ -520,6 +527,907 @@ void CHttpResponse::x_ParseHeader(const char* header)
 }
 
 
+///////////////////////////////////////////////////////
+//  Pooled connections
+//
+
+
+// Max size of an unread response body which is read out rather than
+// closing the connection when the response stream is destroyed.
+static const Uint8 kMaxDrainOnAbandon = 64 * 1024;
+
+// Idle timeout used when the session has it set to CTimeout::eDefault.
+static const double kDefaultIdleTimeout = 30.0;
+
+static const STimeout kZeroTimeout = {0, 0};
+
+
+// Persistent HTTP/1.1 connection. The requests sent over the connection
+// wait in m_Pending until their responses are read out.
+// The connection's m_Lock protects the socket and the queue, the pool's
+// lock protects m_InFlight, m_Reusable and m_IdleTime.
+class CHttpConnection : public CObject
+{
+public:
+    CHttpConnection(const string& key)
+        : m_Key(key),
+          m_Sent(0),
+          m_Broken(false),
+          m_InFlight(0),
+          m_Reusable(true)
+    {}
+
+    // Close the socket, no more requests or responses can go through.
+    void Drop(bool abort)
+    {
+        m_Broken = true;
+        if ( abort ) {
+            m_Socket.Abort();
+        }
+        m_Socket.Close();
+    }
+
+    typedef deque< CRef<CHttpExchange> > TPending;
+
+    const string m_Key;      // scheme://host:port
+    CFastMutex   m_Lock;
+    CSocket      m_Socket;
+    unsigned int m_Sent;     // Number of requests sent so far
+    bool         m_Broken;   // The connection has been closed
+    TPending     m_Pending;  // Sent requests, in the order of sending
+
+    unsigned int m_InFlight; // Number of requests using the connection
+    bool         m_Reusable; // New requests can be sent
+    CStopWatch   m_IdleTime; // Since the last request has left
+};
+
+
+// Connections of a session grouped by host.
+class CHttpConnectionPool : public CObject
+{
+public:
+    // Session settings in effect when a request has been created.
+    struct SParams {
+        bool         pipeline;
+        unsigned int max_idle;
+        unsigned int max_depth;
+        double       idle_timeout; // negative if infinite
+    };
+
+    // Find a connection for a new request: the most recently used idle
+    // one, a busy one which can take one more pipelined request, or a new
+    // one (not open yet). 'idle' is set if an idle connection is returned.
+    CRef<CHttpConnection> Reserve(const string&  key,
+                                  const SParams& params,
+                                  bool&          idle);
+
+    // A request reserved the connection has left it. The connection is
+    // kept for the next requests if it is still reusable.
+    void Release(CHttpConnection& conn,
+                 bool             reusable,
+                 const SParams&   params);
+
+    void CloseIdle(void);
+
+private:
+    typedef list< CRef<CHttpConnection> > TConnections;
+    typedef map<string, TConnections>     THosts;
+
+    // Close idle connections which have expired.
+    void x_Expire(TConnections& conns, const SParams& params);
+    void x_Close(CHttpConnection& conn);
+
+    CFastMutex m_Lock;
+    THosts     m_Hosts;
+};
+
+
+CRef<CHttpConnection> CHttpConnectionPool::Reserve(const string&  key,
+                                                   const SParams& params,
+                                                   bool&          idle)
+{
+    CFastMutexGuard guard(m_Lock);
+    TConnections& conns = m_Hosts[key];
+    x_Expire(conns, params);
+
+    CRef<CHttpConnection> conn;
+    // The most recently used idle connections go last.
+    for (TConnections::reverse_iterator it = conns.rbegin();
+         it != conns.rend();  ++it) {
+        if ((*it)->m_Reusable  &&  (*it)->m_InFlight == 0) {
+            conn = *it;
+            break;
+        }
+    }
+    idle = conn.NotEmpty();
+    if (!conn  &&  params.pipeline) {
+        ITERATE(TConnections, it, conns) {
+            const CHttpConnection& busy = **it;
+            if (busy.m_Reusable  &&  busy.m_InFlight < params.max_depth
+                &&  (!conn  ||  busy.m_InFlight < conn->m_InFlight)) {
+                conn = *it;
+            }
+        }
+    }
+    if ( !conn ) {
+        conn.Reset(new CHttpConnection(key));
+        conns.push_back(conn);
+    }
+    ++conn->m_InFlight;
+    return conn;
+}
+
+
+void CHttpConnectionPool::Release(CHttpConnection& conn,
+                                  bool             reusable,
+                                  const SParams&   params)
+{
+    CFastMutexGuard guard(m_Lock);
+    _ASSERT(conn.m_InFlight > 0);
+    --conn.m_InFlight;
+    if ( !reusable ) {
+        conn.m_Reusable = false;
+    }
+    if (conn.m_InFlight > 0) {
+        return;
+    }
+
+    THosts::iterator host = m_Hosts.find(conn.m_Key);
+    if (host == m_Hosts.end()) {
+        return;
+    }
+    TConnections& conns = host->second;
+    TConnections::iterator it = conns.begin();
+    while (it != conns.end()  &&  it->GetPointer() != &conn) {
+        ++it;
+    }
+    if (it == conns.end()) {
+        return;
+    }
+    CRef<CHttpConnection> ref(*it);
+    conns.erase(it);
+    if ( !conn.m_Reusable ) {
+        x_Close(conn);
+    }
+    else {
+        conn.m_IdleTime.Restart();
+        conns.push_back(ref);
+        unsigned int idle = 0;
+        ITERATE(TConnections, c, conns) {
+            if ((*c)->m_InFlight == 0) {
+                ++idle;
+            }
+        }
+        // Close the least recently used idle connections over the limit.
+        for (it = conns.begin();  idle > params.max_idle  &&  it != conns.end(); ) {
+            if ((*it)->m_InFlight == 0) {
+                x_Close(**it);
+                it = conns.erase(it);
+                --idle;
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+    if ( conns.empty() ) {
+        m_Hosts.erase(host);
+    }
+}
+
+
+void CHttpConnectionPool::CloseIdle(void)
+{
+    CFastMutexGuard guard(m_Lock);
+    THosts::iterator host = m_Hosts.begin();
+    while (host != m_Hosts.end()) {
+        TConnections& conns = host->second;
+        for (TConnections::iterator it = conns.begin(); it != conns.end(); ) {
+            if ((*it)->m_InFlight == 0) {
+                x_Close(**it);
+                it = conns.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        if ( conns.empty() ) {
+            m_Hosts.erase(host++);
+        }
+        else {
+            ++host;
+        }
+    }
+}
+
+
+void CHttpConnectionPool::x_Expire(TConnections& conns, const SParams& params)
+{
+    if (params.idle_timeout < 0) {
+        return;
+    }
+    for (TConnections::iterator it = conns.begin(); it != conns.end(); ) {
+        if ((*it)->m_InFlight == 0
+            &&  (*it)->m_IdleTime.Elapsed() >= params.idle_timeout) {
+            x_Close(**it);
+            it = conns.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+
+void CHttpConnectionPool::x_Close(CHttpConnection& conn)
+{
+    // Nobody else uses the connection: there are no requests in flight.
+    _ASSERT(conn.m_InFlight == 0);
+    CFastMutexGuard guard(conn.m_Lock);
+    conn.Drop(false);
+}
+
+
+// A request and its response over a pooled connection.
+class CHttpExchange : public CObject
+{
+public:
+    CHttpExchange(CHttpConnectionPool&                pool,
+                  const CHttpConnectionPool::SParams& params,
+                  const SConnNetInfo&                 net_info,
+                  EReqMethod                          method,
+                  const string&                       head,
+                  CHttpResponse&                      response);
+
+    // Send the request over a pooled connection.
+    void Send(void);
+
+    // Response stream interface.
+    ERW_Result Write(const void* buf, size_t count, size_t* bytes_written);
+    ERW_Result Read(void* buf, size_t count, size_t* bytes_read);
+    size_t GetBuffered(void);
+    // The response stream is being destroyed.
+    void Abandon(void);
+
+private:
+    enum EState {
+        eState_New,    // The request is not sent yet
+        eState_Sent,   // Waiting for the response header
+        eState_Body,   // Reading the response body
+        eState_Done,   // The response has been read (the body may be buffered)
+        eState_Failed
+    };
+
+    // Exchanges which have left the connection. The reservations must be
+    // released after the connection's lock is released.
+    typedef vector< CRef<CHttpExchange> > TFinished;
+
+    // All the x_* methods below require the connection's lock.
+
+    // Read out the responses sent over the connection before this one.
+    void x_Advance(TFinished& finished);
+    bool x_ReadHeader(TFinished& finished);
+    // Read the next portion of the body. Zero bytes are returned only
+    // when the body has ended.
+    bool x_ReadBody(void* buf, size_t count, size_t* n_read,
+                    TFinished& finished);
+    // Read the response into the buffer (or discard it if abandoned).
+    void x_Drain(TFinished& finished);
+    bool x_Fail(TFinished& finished, const string& error, EIO_Status status);
+    void x_Finish(TFinished& finished, bool success);
+    bool x_CanRetry(void) const;
+
+    // Fail the abandoned responses if nobody is going to read them.
+    static void x_Cleanup(CHttpConnection& conn, TFinished& finished);
+    static void x_Release(TFinished& finished);
+
+    CRef<CHttpConnectionPool>    m_Pool;
+    CHttpConnectionPool::SParams m_Params;
+    CRef<CHttpConnection>        m_Conn;
+    string         m_Key;
+    string         m_Host;
+    unsigned short m_Port;
+    TSOCK_Flags    m_SockFlags;
+    STimeout       m_TimeoutValue;
+    const STimeout* m_Timeout;
+    unsigned int   m_MaxTry;
+    EReqMethod     m_Method;
+    string         m_Head;       // Request line and headers
+    string         m_Body;       // Request body
+    CHttpResponse* m_Response;   // Till the response header is parsed
+
+    EState         m_State;
+    bool           m_Abandoned;
+    bool           m_Reusable;   // The connection can be reused after us
+    bool           m_GotData;    // Any part of the response has arrived
+    bool           m_KeepAlive;  // The server keeps the connection open
+    bool           m_Chunked;
+    bool           m_ChunkTail;  // CRLF after the chunk data expected
+    bool           m_ToClose;    // The body ends when the connection closes
+    Uint8          m_Remaining;  // Of the body or of the current chunk
+    string         m_Buffer;     // The body read by the next requests
+    size_t         m_BufferPos;
+    unsigned int   m_Attempts;   // Connection attempts
+    string         m_Error;
+
+    CStopWatch     m_SendTime;
+    double         m_ConnectTime;
+    double         m_TimeToFirstByte;
+    unsigned int   m_ReuseCount;
+};
+
+
+CHttpExchange::CHttpExchange(CHttpConnectionPool&                pool,
+                             const CHttpConnectionPool::SParams& params,
+                             const SConnNetInfo&                 net_info,
+                             EReqMethod                          method,
+                             const string&                       head,
+                             CHttpResponse&                      response)
+    : m_Pool(&pool),
+      m_Params(params),
+      m_Host(net_info.host),
+      m_Port(net_info.port),
+      m_SockFlags(fSOCK_KeepAlive),
+      m_MaxTry(net_info.max_try ? net_info.max_try : 1),
+      m_Method(method),
+      m_Head(head),
+      m_Response(&response),
+      m_State(eState_New),
+      m_Abandoned(false),
+      m_Reusable(false),
+      m_GotData(false),
+      m_KeepAlive(false),
+      m_Chunked(false),
+      m_ChunkTail(false),
+      m_ToClose(false),
+      m_Remaining(0),
+      m_BufferPos(0),
+      m_Attempts(0),
+      m_ConnectTime(0),
+      m_TimeToFirstByte(0),
+      m_ReuseCount(0)
+{
+    bool secure = net_info.scheme == eURL_Https;
+    if ( !m_Port ) {
+        m_Port = secure ? CONN_PORT_HTTPS : CONN_PORT_HTTP;
+    }
+    m_Key = string(secure ? "https" : "http") + "://" + m_Host + ":" +
+        NStr::NumericToString(m_Port);
+    if ( secure ) {
+        m_SockFlags |= fSOCK_Secure;
+    }
+    m_SockFlags |= net_info.debug_printout == eDebugPrintout_Data
+        ? fSOCK_LogOn : fSOCK_LogDefault;
+    if ( net_info.timeout ) {
+        m_TimeoutValue = *net_info.timeout;
+        m_Timeout = &m_TimeoutValue;
+    }
+    else {
+        m_Timeout = kInfiniteTimeout;
+    }
+}
+
+
+void CHttpExchange::Send(void)
+{
+    if (m_State != eState_New) {
+        return;
+    }
+    string request = m_Head;
+    if (!m_Body.empty()  ||
+        m_Method == eReqMethod_Post  ||  m_Method == eReqMethod_Put) {
+        request += "Content-Length: " +
+            NStr::NumericToString(m_Body.size()) + HTTP_EOL;
+    }
+    request += HTTP_EOL;
+    request += m_Body;
+
+    while (m_State == eState_New) {
+        bool idle = false;
+        CRef<CHttpConnection> conn = m_Pool->Reserve(m_Key, m_Params, idle);
+        TFinished finished;
+        bool sent = false;
+        {{
+            CFastMutexGuard guard(conn->m_Lock);
+            if ( conn->m_Broken ) {
+                // Failed while this request was waiting for the lock.
+            }
+            else if ( !conn->m_Socket.GetSOCK() ) {
+                ++m_Attempts;
+                CStopWatch sw(CStopWatch::eStart);
+                EIO_Status status = conn->m_Socket.Connect(m_Host, m_Port,
+                                                           m_Timeout,
+                                                           m_SockFlags);
+                m_ConnectTime = sw.Elapsed();
+                if (status != eIO_Success) {
+                    m_Error = string("Cannot connect (") +
+                        IO_StatusStr(status) + ")";
+                    conn->Drop(true);
+                }
+            }
+            else if (idle  &&
+                     conn->m_Socket.Wait(eIO_Read, &kZeroTimeout) != eIO_Timeout) {
+                // The server has closed the idle connection.
+                conn->Drop(true);
+            }
+            else {
+                m_ConnectTime = 0;
+            }
+            if ( !conn->m_Broken ) {
+                conn->m_Socket.SetTimeout(eIO_ReadWrite, m_Timeout);
+                m_SendTime.Restart();
+                EIO_Status status = conn->m_Socket.Write(request.data(),
+                                                         request.size());
+                if (status == eIO_Success) {
+                    m_ReuseCount = conn->m_Sent++;
+                    conn->m_Pending.push_back(Ref(this));
+                    m_Conn = conn;
+                    m_State = eState_Sent;
+                    sent = true;
+                }
+                else {
+                    m_Error = string("Cannot send request (") +
+                        IO_StatusStr(status) + ")";
+                    conn->Drop(true);
+                }
+            }
+            if ( !sent ) {
+                x_Cleanup(*conn, finished);
+            }
+        }}
+        x_Release(finished);
+        if ( !sent ) {
+            m_Pool->Release(*conn, false, m_Params);
+            if (m_Attempts >= m_MaxTry) {
+                ERR_POST(Error << "[HTTP " << m_Key << "] " << m_Error);
+                m_Error.clear();
+                m_State = eState_Failed;
+            }
+        }
+    }
+}
+
+
+ERW_Result CHttpExchange::Write(const void* buf,
+                                size_t      count,
+                                size_t*     bytes_written)
+{
+    if (m_State != eState_New) {
+        // The request has already been sent.
+        if ( bytes_written ) {
+            *bytes_written = 0;
+        }
+        return eRW_Error;
+    }
+    m_Body.append(static_cast<const char*>(buf), count);
+    if ( bytes_written ) {
+        *bytes_written = count;
+    }
+    return eRW_Success;
+}
+
+
+ERW_Result CHttpExchange::Read(void* buf, size_t count, size_t* bytes_read)
+{
+    size_t n_read = 0;
+    ERW_Result result = eRW_Error;
+    for (;;) {
+        Send();
+        if ( !m_Conn ) {
+            break;
+        }
+        TFinished finished;
+        bool retry = false;
+        {{
+            CFastMutexGuard guard(m_Conn->m_Lock);
+            x_Advance(finished);
+            if (m_State == eState_Sent) {
+                x_ReadHeader(finished);
+            }
+            if (m_BufferPos < m_Buffer.size()) {
+                n_read = min(count, m_Buffer.size() - m_BufferPos);
+                memcpy(buf, m_Buffer.data() + m_BufferPos, n_read);
+                m_BufferPos += n_read;
+                if (m_BufferPos == m_Buffer.size()) {
+                    m_Buffer.clear();
+                    m_BufferPos = 0;
+                }
+                result = eRW_Success;
+            }
+            else if (m_State == eState_Body) {
+                if (x_ReadBody(buf, count, &n_read, finished)) {
+                    result = n_read ? eRW_Success : eRW_Eof;
+                }
+            }
+            else if (m_State == eState_Done) {
+                result = eRW_Eof;
+            }
+            else {
+                retry = x_CanRetry();
+            }
+        }}
+        x_Release(finished);
+        if ( !retry ) {
+            break;
+        }
+        m_Conn.Reset();
+        m_State = eState_New;
+    }
+    if (result == eRW_Error  &&  !m_Error.empty()) {
+        ERR_POST(Error << "[HTTP " << m_Key << "] " << m_Error);
+        m_Error.clear();
+    }
+    if ( bytes_read ) {
+        *bytes_read = n_read;
+    }
+    return result;
+}
+
+
+size_t CHttpExchange::GetBuffered(void)
+{
+    if ( !m_Conn ) {
+        return 0;
+    }
+    CFastMutexGuard guard(m_Conn->m_Lock);
+    return m_Buffer.size() - m_BufferPos;
+}
+
+
+void CHttpExchange::Abandon(void)
+{
+    if ( !m_Conn ) {
+        return;
+    }
+    TFinished finished;
+    {{
+        CFastMutexGuard guard(m_Conn->m_Lock);
+        m_Response = 0;
+        m_Abandoned = true;
+        m_Buffer.clear();
+        if (m_State == eState_Body  &&  !m_Conn->m_Broken
+            &&  m_Conn->m_Pending.front().GetPointer() == this
+            &&  !m_Chunked  &&  !m_ToClose
+            &&  m_Remaining <= kMaxDrainOnAbandon) {
+            // Read out the rest of a short body to keep the connection.
+            x_Drain(finished);
+        }
+        x_Cleanup(*m_Conn, finished);
+    }}
+    x_Release(finished);
+}
+
+
+void CHttpExchange::x_Advance(TFinished& finished)
+{
+    while (m_State == eState_Sent  ||  m_State == eState_Body) {
+        if ( m_Conn->m_Broken ) {
+            x_Fail(finished, "Connection closed", eIO_Closed);
+            break;
+        }
+        _ASSERT( !m_Conn->m_Pending.empty() );
+        CRef<CHttpExchange> front = m_Conn->m_Pending.front();
+        if (front.GetPointer() == this) {
+            break;
+        }
+        front->x_Drain(finished);
+    }
+}
+
+
+bool CHttpExchange::x_ReadHeader(TFinished& finished)
+{
+    _ASSERT(m_State == eState_Sent);
+    _ASSERT(m_Conn->m_Pending.front().GetPointer() == this);
+    CSocket& sock = m_Conn->m_Socket;
+    string header, line;
+    int code = 0;
+    do {
+        header.clear();
+        for (;;) {
+            EIO_Status status = sock.ReadLine(line);
+            if (status != eIO_Success) {
+                return x_Fail(finished, "Cannot read response header",
+                              status);
+            }
+            if ( !m_GotData ) {
+                m_GotData = true;
+                m_TimeToFirstByte = m_SendTime.Elapsed();
+            }
+            if ( line.empty() ) {
+                if ( header.empty() ) {
+                    continue;
+                }
+                break;
+            }
+            header += line;
+            header += HTTP_EOL;
+        }
+        if (!NStr::StartsWith(header, "HTTP/")  ||
+            sscanf(header.c_str(), "%*s %d", &code) != 1) {
+            return x_Fail(finished, "Bad response status line", eIO_Unknown);
+        }
+    } while (100 <= code  &&  code < 200);
+
+    CHttpHeaders headers;
+    headers.ParseHttpHeader(header);
+    const string& connection = headers.GetValue("Connection");
+    if ( NStr::StartsWith(header, "HTTP/1.0") ) {
+        m_KeepAlive = NStr::FindNoCase(connection, "keep-alive") != NPOS;
+    }
+    else {
+        m_KeepAlive = NStr::FindNoCase(connection, "close") == NPOS;
+    }
+    m_Chunked = false;
+    m_ChunkTail = false;
+    m_ToClose = false;
+    m_Remaining = 0;
+    if (m_Method == eReqMethod_Head  ||  code == 204  ||  code == 304) {
+        // No body
+    }
+    else if (NStr::FindNoCase(headers.GetValue("Transfer-Encoding"),
+                              "chunked") != NPOS) {
+        m_Chunked = true;
+    }
+    else if ( headers.HasValue(CHttpHeaders::eContentLength) ) {
+        m_Remaining = NStr::StringToUInt8(
+            headers.GetValue(CHttpHeaders::eContentLength),
+            NStr::fConvErr_NoThrow | NStr::fAllowLeadingSpaces |
+            NStr::fAllowTrailingSpaces);
+        if (!m_Remaining  &&  errno) {
+            return x_Fail(finished, "Bad Content-Length", eIO_Unknown);
+        }
+    }
+    else {
+        m_ToClose = true;
+        m_KeepAlive = false;
+    }
+
+    if ( m_Response ) {
+        m_Response->x_ParseHeader(header.c_str());
+        m_Response->m_ConnectTime = m_ConnectTime;
+        m_Response->m_TimeToFirstByte = m_TimeToFirstByte;
+        m_Response->m_ReuseCount = m_ReuseCount;
+        m_Response = 0;
+    }
+    m_State = eState_Body;
+    if (!m_Chunked  &&  !m_ToClose  &&  !m_Remaining) {
+        x_Finish(finished, true);
+    }
+    return true;
+}
+
+
+bool CHttpExchange::x_ReadBody(void*      buf,
+                               size_t     count,
+                               size_t*    n_read,
+                               TFinished& finished)
+{
+    CSocket& sock = m_Conn->m_Socket;
+    *n_read = 0;
+    while (m_State == eState_Body) {
+        if (m_Chunked  &&  !m_Remaining) {
+            string line;
+            if ( m_ChunkTail ) {
+                if (sock.ReadLine(line) != eIO_Success  ||  !line.empty()) {
+                    return x_Fail(finished, "Bad chunk", eIO_Unknown);
+                }
+                m_ChunkTail = false;
+            }
+            EIO_Status status = sock.ReadLine(line);
+            if (status != eIO_Success) {
+                return x_Fail(finished, "Cannot read chunk size", status);
+            }
+            SIZE_TYPE ext = line.find(';');
+            if (ext != NPOS) {
+                line.resize(ext);
+            }
+            Uint8 size = NStr::StringToUInt8(line,
+                NStr::fConvErr_NoThrow | NStr::fAllowLeadingSpaces |
+                NStr::fAllowTrailingSpaces, 16);
+            if (!size  &&  errno) {
+                return x_Fail(finished, "Bad chunk size", eIO_Unknown);
+            }
+            if ( !size ) {
+                // The last chunk, skip the trailer.
+                do {
+                    status = sock.ReadLine(line);
+                    if (status != eIO_Success) {
+                        return x_Fail(finished, "Cannot read chunk trailer",
+                                      status);
+                    }
+                } while ( !line.empty() );
+                x_Finish(finished, true);
+                break;
+            }
+            m_Remaining = size;
+            m_ChunkTail = true;
+            continue;
+        }
+
+        size_t size = count;
+        if (!m_ToClose  &&  m_Remaining < size) {
+            size = (size_t) m_Remaining;
+        }
+        EIO_Status status = sock.Read(buf, size, n_read, eIO_ReadPlain);
+        if (m_ToClose  &&  status == eIO_Closed) {
+            x_Finish(finished, true);
+            break;
+        }
+        if (status != eIO_Success) {
+            return x_Fail(finished, "Cannot read response body", status);
+        }
+        if ( !m_ToClose ) {
+            m_Remaining -= *n_read;
+            if (!m_Remaining  &&  !m_Chunked) {
+                x_Finish(finished, true);
+            }
+        }
+        break;
+    }
+    return true;
+}
+
+
+void CHttpExchange::x_Drain(TFinished& finished)
+{
+    if (m_State == eState_Sent  &&  !x_ReadHeader(finished)) {
+        return;
+    }
+    char buf[16384];
+    while (m_State == eState_Body) {
+        size_t n_read = 0;
+        if ( !x_ReadBody(buf, sizeof(buf), &n_read, finished) ) {
+            return;
+        }
+        if ( !m_Abandoned ) {
+            m_Buffer.append(buf, n_read);
+        }
+    }
+}
+
+
+bool CHttpExchange::x_Fail(TFinished&    finished,
+                           const string& error,
+                           EIO_Status    status)
+{
+    m_Error = error + " (" + IO_StatusStr(status) + ")";
+    x_Finish(finished, false);
+    return false;
+}
+
+
+void CHttpExchange::x_Finish(TFinished& finished, bool success)
+{
+    _ASSERT(m_State == eState_Sent  ||  m_State == eState_Body);
+    CHttpConnection::TPending& pending = m_Conn->m_Pending;
+    CHttpConnection::TPending::iterator it = pending.begin();
+    while (it != pending.end()  &&  it->GetPointer() != this) {
+        ++it;
+    }
+    _ASSERT(it != pending.end());
+    if (it != pending.end()) {
+        pending.erase(it);
+    }
+    m_State = success ? eState_Done : eState_Failed;
+    if ( !m_Conn->m_Broken  &&  (!success  ||  !m_KeepAlive) ) {
+        m_Conn->Drop(!success);
+    }
+    m_Reusable = !m_Conn->m_Broken;
+    finished.push_back(Ref(this));
+    x_Cleanup(*m_Conn, finished);
+}
+
+
+bool CHttpExchange::x_CanRetry(void) const
+{
+    if (m_State != eState_Failed  ||  m_GotData  ||  m_Abandoned) {
+        return false;
+    }
+    // Only idempotent requests can be sent again.
+    if (m_Method != eReqMethod_Get  &&  m_Method != eReqMethod_Head  &&
+        m_Method != eReqMethod_Put) {
+        return false;
+    }
+    // A reused connection could have been closed by the server at any
+    // time, this does not count as an attempt.
+    return m_ReuseCount > 0  ||  m_Attempts < m_MaxTry;
+}
+
+
+void CHttpExchange::x_Cleanup(CHttpConnection& conn, TFinished& finished)
+{
+    CHttpConnection::TPending& pending = conn.m_Pending;
+    if ( !conn.m_Broken ) {
+        ITERATE(CHttpConnection::TPending, it, pending) {
+            if ( !(*it)->m_Abandoned ) {
+                return;
+            }
+        }
+        if ( pending.empty() ) {
+            return;
+        }
+        // Nobody is going to read the responses.
+        conn.Drop(true);
+    }
+    // The requests still waiting for their responses will fail when read,
+    // the abandoned ones are failed here.
+    for (CHttpConnection::TPending::iterator it = pending.begin();
+         it != pending.end(); ) {
+        if ( (*it)->m_Abandoned ) {
+            (*it)->m_State = eState_Failed;
+            (*it)->m_Reusable = false;
+            finished.push_back(*it);
+            it = pending.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+
+void CHttpExchange::x_Release(TFinished& finished)
+{
+    NON_CONST_ITERATE(TFinished, it, finished) {
+        CHttpExchange& exchange = **it;
+        exchange.m_Pool->Release(*exchange.m_Conn, exchange.m_Reusable,
+                                 exchange.m_Params);
+    }
+    finished.clear();
+}
+
+
+// Response stream over a pooled connection.
+class CHttpExchangeRW : public IReaderWriter
+{
+public:
+    CHttpExchangeRW(CHttpExchange& exchange) : m_Exchange(&exchange) {}
+
+    virtual ~CHttpExchangeRW(void) { m_Exchange->Abandon(); }
+
+    virtual ERW_Result Read(void* buf, size_t count, size_t* bytes_read)
+        { return m_Exchange->Read(buf, count, bytes_read); }
+
+    virtual ERW_Result PendingCount(size_t* count)
+        {
+            *count = m_Exchange->GetBuffered();
+            return eRW_Success;
+        }
+
+    virtual ERW_Result Write(const void* buf, size_t count,
+                             size_t* bytes_written)
+        { return m_Exchange->Write(buf, count, bytes_written); }
+
+    virtual ERW_Result Flush(void) { return eRW_Success; }
+
+private:
+    CRef<CHttpExchange> m_Exchange;
+};
+
+
+CHttpResponse::CHttpStreamRef::CHttpStreamRef(void)
+{
+}
+
+
+CHttpResponse::CHttpStreamRef::~CHttpStreamRef(void)
+{
+}
+
+
+CHttpExchange* CHttpResponse::CHttpStreamRef::GetExchange(void) const
+{
+    return m_Exchange.GetNCPointerOrNull();
+}
+
+
+void CHttpResponse::CHttpStreamRef::SetExchange(CHttpExchange* exchange)
+{
+    m_Exchange.Reset(exchange);
+}
+
+
 ///////////////////////////////////////////////////////
 //  CHttpRequest::
 //
@@ -545,6 +1453,68 @@ unsigned short x_RetriesToMaxtry(unsigned short retries)
 }
 
 
+// Max number of redirects followed for a request over a pooled connection.
+static const int kMaxRedirects = 16;
+
+
+static const char* s_ReqMethodName(EReqMethod method)
+{
+    switch ( method ) {
+    case eReqMethod_Head: return "HEAD";
+    case eReqMethod_Post: return "POST";
+    case eReqMethod_Put:  return "PUT";
+    default:              return "GET";
+    }
+}
+
+
+// Request line and headers for a request over a pooled connection:
+// everything but Content-Length and the empty line ending the header.
+static string s_GetRequestHead(const SConnNetInfo& net_info,
+                               EReqMethod          method,
+                               const CHttpHeaders& headers,
+                               THTTP_Flags         flags)
+{
+    string head = s_ReqMethodName(method);
+    head += ' ';
+    head += *net_info.path ? net_info.path : "/";
+    size_t args_len = strcspn(net_info.args, "#");
+    if ( args_len ) {
+        head += '?';
+        head.append(net_info.args, args_len);
+    }
+    head += " HTTP/1.1" HTTP_EOL;
+
+    if ( !headers.HasValue("Host") ) {
+        head += "Host: ";
+        head += net_info.host;
+        if ( net_info.port ) {
+            head += ':' + NStr::NumericToString(net_info.port);
+        }
+        head += HTTP_EOL;
+    }
+    if ( !headers.HasValue(CHttpHeaders::eUserAgent) ) {
+        head += "User-Agent: NCBIHttpSession (CXX Toolkit)" HTTP_EOL;
+    }
+    head += headers.GetHttpHeader();
+
+    // NCBI request IDs, as the HTTP connector adds them.
+    if ( !(flags & fHTTP_NoAutomagicSID) ) {
+        char* id = CORE_GetNcbiRequestID(eNcbiRequestID_SID);
+        if ( id ) {
+            head += string(HTTP_NCBI_SID " ") + id + HTTP_EOL;
+            free(id);
+        }
+        id = CORE_GetNcbiRequestID(eNcbiRequestID_HitID);
+        if ( id ) {
+            head += string(HTTP_NCBI_PHID " ") + id + HTTP_EOL;
+            free(id);
+        }
+    }
+    return head;
+}
+
+
 CHttpRequest::CHttpRequest(CHttpSession& session,
                            const CUrl&   url,
                            EReqMethod    method)
@@ -567,12 +1537,18 @@ CHttpResponse CHttpRequest::Execute(void)
     }
     _ASSERT(m_Response);
     _ASSERT(m_Stream  &&  m_Stream->IsInitialized());
-    CConn_IOStream& out = m_Stream->GetConnStream();
+    CNcbiIostream& out = m_Stream->GetConnStream();
     if ( have_data ) {
         m_FormData->WriteFormData(out);
     }
     // Send data to the server and close output stream.
     out.peek();
+    for (int redirects = 0;  redirects < kMaxRedirects;  ++redirects) {
+        if ( !x_FollowRedirect() ) {
+            break;
+        }
+        m_Stream->GetConnStream().peek();
+    }
     m_Stream.Reset();
     CHttpResponse ret = *m_Response;
     m_Response.Reset();
@@ -648,10 +1624,46 @@ void CHttpRequest::x_InitConnection(bool use_form_data)
 
     m_Stream.Reset(new TStreamRef);
     m_Response.Reset(new CHttpResponse(*m_Session, m_Url, *m_Stream));
-    if ( m_Url.GetIsGeneric() ) {
+    m_SendTime.Restart();
+    string url = m_Url.ComposeUrl(CUrlArgs::eAmp_Char);
+    if (m_Url.GetIsGeneric()
+        &&  m_Session->GetConnReuse() != CHttpSession::eConnReuse_None
+        &&  ConnNetInfo_ParseURL(connnetinfo, url.c_str())
+        &&  x_CanUsePool(*connnetinfo)) {
+        // Send the request over a pooled connection.
+        CHttpSession& session = *m_Session;
+        CHttpConnectionPool::SParams params;
+        params.pipeline =
+            session.GetConnReuse() == CHttpSession::eConnReuse_Pipeline  &&
+            (m_Method == eReqMethod_Get  ||  m_Method == eReqMethod_Head);
+        params.max_idle = session.GetMaxIdleConnections();
+        params.max_depth = max(session.GetMaxPipelineDepth(), 1u);
+        const CTimeout& idle_timeout = session.GetIdleTimeout();
+        if ( idle_timeout.IsInfinite() ) {
+            params.idle_timeout = -1;
+        }
+        else if ( idle_timeout.IsDefault() ) {
+            params.idle_timeout = kDefaultIdleTimeout;
+        }
+        else {
+            params.idle_timeout = idle_timeout.GetAsDouble();
+        }
+        CRef<CHttpExchange> exchange(new CHttpExchange(
+            *session.m_ConnPool,
+            params,
+            *connnetinfo,
+            m_Method,
+            s_GetRequestHead(*connnetinfo, m_Method, *m_Headers,
+                             session.GetHttpFlags()),
+            *m_Response));
+        m_Stream->SetExchange(exchange);
+        m_Stream->SetConnStream(new CRWStream(new CHttpExchangeRW(*exchange),
+                                              0, 0, CRWStreambuf::fOwnAll));
+    }
+    else if ( m_Url.GetIsGeneric() ) {
         // Connect using HTTP.
         m_Stream->SetConnStream(new CConn_HttpStream(
-            m_Url.ComposeUrl(CUrlArgs::eAmp_Char),
+            url,
             connnetinfo,
             headers.c_str(),
             sx_ParseHeader,
@@ -671,7 +1683,7 @@ void CHttpRequest::x_InitConnection(bool use_form_data)
         x_extra.parse_header = sx_ParseHeader;
         x_extra.flags = m_Session->GetHttpFlags() | fHTTP_AdjustOnRedirect;
         m_Stream->SetConnStream(new CConn_ServiceStream(
-            m_Url.ComposeUrl(CUrlArgs::eAmp_Char),
+            url,
             fSERV_Http,
             connnetinfo,
             &x_extra));
@@ -686,6 +1698,101 @@ bool CHttpRequest::x_CanSendData(void) const
 }
 
 
+bool CHttpRequest::x_CanUsePool(const SConnNetInfo& net_info) const
+{
+    // The rest is handled by the HTTP connector only.
+    return (net_info.scheme == eURL_Http  ||  net_info.scheme == eURL_Https)
+        &&  !net_info.http_proxy_host[0]
+        &&  !net_info.user[0]
+        &&  !net_info.credentials
+        &&  !net_info.http_push_auth
+        &&  net_info.host[0];
+}
+
+
+void CHttpRequest::x_SendPipelined(void)
+{
+    if (m_Response  ||
+        m_Session->GetConnReuse() != CHttpSession::eConnReuse_Pipeline  ||
+        (m_Method != eReqMethod_Get  &&  m_Method != eReqMethod_Head)) {
+        return;
+    }
+    x_InitConnection(false);
+    CHttpExchange* exchange = m_Stream->GetExchange();
+    if ( exchange ) {
+        exchange->Send();
+    }
+}
+
+
+bool CHttpRequest::x_FollowRedirect(void)
+{
+    if (!m_Stream->GetExchange()  ||
+        (m_Method != eReqMethod_Get  &&  m_Method != eReqMethod_Head)) {
+        return false;
+    }
+    switch ( m_Response->GetStatusCode() ) {
+    case 301:
+    case 302:
+    case 303:
+    case 307:
+    case 308:
+        break;
+    default:
+        return false;
+    }
+    const string& location =
+        m_Response->Headers().GetValue(CHttpHeaders::eLocation);
+    if ( location.empty() ) {
+        return false;
+    }
+
+    // Resolve the location against the current one.
+    SConnNetInfo* net_info = ConnNetInfo_Create(0);
+    string current = m_Response->m_Location.ComposeUrl(CUrlArgs::eAmp_Char);
+    bool secure = false;
+    char* url = 0;
+    if (ConnNetInfo_ParseURL(net_info, current.c_str())) {
+        secure = net_info->scheme == eURL_Https;
+        if (ConnNetInfo_ParseURL(net_info, location.c_str())) {
+            url = ConnNetInfo_URL(net_info);
+        }
+    }
+    bool downgrade = secure  &&  net_info->scheme != eURL_Https;
+    ConnNetInfo_Destroy(net_info);
+    if ( !url ) {
+        return false;
+    }
+    CUrl new_location(url);
+    free(url);
+    if (downgrade  &&  !(m_Session->GetHttpFlags() & fHTTP_UnsafeRedirects)) {
+        ERR_POST(Warning << "Redirect from secure to insecure location "
+                 "is not allowed: " << location);
+        return false;
+    }
+
+    // Read out the redirect page so that the connection can be reused.
+    CNcbiIstream& in = m_Stream->GetConnStream();
+    in.ignore(numeric_limits<streamsize>::max());
+    m_Stream.Reset();
+    m_Response.Reset();
+
+    CUrl url_orig = m_Url;
+    m_Url = new_location;
+    try {
+        x_InitConnection(false);
+    }
+    catch (...) {
+        m_Url = url_orig;
+        throw;
+    }
+    m_Url = url_orig;
+    m_Response->m_Url = url_orig;
+    m_Response->m_Location = new_location;
+    return true;
+}
+
+
 void CHttpRequest::x_AddCookieHeader(const CUrl& url)
 {
     if ( !m_Session ) return;
@@ -710,6 +1817,9 @@ EHTTP_HeaderParse CHttpRequest::sx_ParseHeader(const char* http_header,
     // initializing the request.
     if ( resp ) {
         resp->x_ParseHeader(http_header);
+        if ( !resp->m_TimeToFirstByte ) {
+            resp->m_TimeToFirstByte = req->m_SendTime.Elapsed();
+        }
     }
     // Always read response body - normal content or error.
     return eHTTP_HeaderContinue;
@@ -778,11 +1888,41 @@ CHttpRequest& CHttpRequest::SetTimeout(unsigned int sec,
 
 CHttpSession::CHttpSession(void)
     : m_Protocol(eHTTP_10),
-      m_HttpFlags(0)
+      m_HttpFlags(0),
+      m_ConnReuse(eConnReuse_None),
+      m_MaxIdle(4),
+      m_IdleTimeout(kDefaultIdleTimeout),
+      m_MaxPipelineDepth(8),
+      m_ConnPool(new CHttpConnectionPool)
+{
+}
+
+
+CHttpSession::~CHttpSession(void)
 {
 }
 
 
+void CHttpSession::CloseIdleConnections(void)
+{
+    m_ConnPool->CloseIdle();
+}
+
+
+void CHttpSession::ExecuteBatch(vector<CHttpRequest>&  requests,
+                                vector<CHttpResponse>& responses)
+{
+    responses.clear();
+    responses.reserve(requests.size());
+    NON_CONST_ITERATE(vector<CHttpRequest>, req, requests) {
+        req->x_SendPipelined();
+    }
+    NON_CONST_ITERATE(vector<CHttpRequest>, req, requests) {
+        responses.push_back(req->Execute());
+    }
+}
+
+
 CHttpRequest CHttpSession::NewRequest(const CUrl& url, ERequestMethod method)
 {
     return CHttpRequest(*this, url, EReqMethod(method));
@@ -734,7 +734,7 @@ void CServer::x_DoRun(void)
             timeout = &timer_timeout;
         }
 
-        EIO_Status status = CSocketAPI::Poll(polls, timeout, &count);
+        EIO_Status status = m_ConnectionPool->Poll(polls, timeout, &count);
 
         if (status != eIO_Success  &&  status != eIO_Timeout) {
             int x_errno = errno;
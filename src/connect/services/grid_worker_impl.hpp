@@ -272,6 +272,12 @@ struct SGridWorkerNodeImpl : public CObject
             return erased;
         }
 
+        size_t GetCount()
+        {
+            TFastMutexGuard lock(m_Mutex);
+            return m_Ids.size();
+        }
+
     private:
         CFastMutex m_Mutex;
         unordered_set<string> m_Ids;
@@ -353,6 +359,9 @@ private:
         CNetScheduleAPI m_API;
         const unsigned m_Timeout;
 
+        // Jobs received in a batch which have not been started yet
+        list<CNetScheduleJob> m_PrefetchedJobs;
+
     private:
         SGridWorkerNodeImpl* m_WorkerNode;
 
@@ -802,6 +802,7 @@ void CNetScheduleServerListener::OnConnected(CNetServerConnection& connection)
         string attr_name, attr_value;
         string ns_node, ns_session;
         CVersionInfo version;
+        CVersionInfo protocol_version;
 
         while (server_info.GetNextAttribute(attr_name, attr_value))
             if (attr_name == "ns_node")
@@ -810,6 +811,8 @@ void CNetScheduleServerListener::OnConnected(CNetServerConnection& connection)
                 ns_session = attr_value;
             else if (attr_name == "server_version")
                 version = CVersionInfo(attr_value);
+            else if (attr_name == "protocol_version")
+                protocol_version = CVersionInfo(attr_value);
 
         // Usually, all attributes come together, so no need to check version
         if (!ns_node.empty() && !ns_session.empty()) {
@@ -823,6 +826,7 @@ void CNetScheduleServerListener::OnConnected(CNetServerConnection& connection)
                 server_props->ns_node = ns_node;
                 server_props->ns_session = ns_session;
                 server_props->version = version;
+                server_props->protocol_version = protocol_version;
                 m_ServerByNode[ns_node] = connection->m_Server->m_ServerInPool;
                 server_props->affs_synced = false;
             }
@@ -312,13 +312,11 @@ string SNetScheduleExecutorImpl::MkSETAFFCmd()
     return cmd;
 }
 
-bool SNetScheduleExecutorImpl::ExecGET(SNetServerImpl* server,
-        const string& get_cmd, CNetScheduleJob& job)
+void SNetScheduleExecutorImpl::x_ExecGETCmd(SNetServerImpl* server,
+        const string& get_cmd, CNetServer::SExecResult& exec_result)
 {
     CNetScheduleGETCmdListener get_cmd_listener(this);
 
-    CNetServer::SExecResult exec_result;
-
     try {
         server->ConnectAndExec(get_cmd, false,
                 exec_result, NULL, &get_cmd_listener);
@@ -340,6 +338,14 @@ bool SNetScheduleExecutorImpl::ExecGET(SNetServerImpl* server,
         server->ConnectAndExec(get_cmd, false,
                 exec_result, NULL, &get_cmd_listener);
     }
+}
+
+bool SNetScheduleExecutorImpl::ExecGET(SNetServerImpl* server,
+        const string& get_cmd, CNetScheduleJob& job)
+{
+    CNetServer::SExecResult exec_result;
+
+    x_ExecGETCmd(server, get_cmd, exec_result);
 
     if (!g_ParseGetJobResponse(job, exec_result.response))
         return false;
@@ -354,6 +360,84 @@ bool SNetScheduleExecutorImpl::ExecGET(SNetServerImpl* server,
     return true;
 }
 
+bool SNetScheduleExecutorImpl::BatchJobsSupported(SNetServerImpl* server)
+{
+    CRef<SNetScheduleServerProperties> server_props =
+        CNetScheduleServerListener::x_GetServerProperties(server);
+
+    return server_props->protocol_version.IsUpCompatible(
+            CVersionInfo(1, 5, 0));
+}
+
+// GETB response format:
+//    job=<GET2 response>&job=<GET2 response>...
+// where each GET2 response is URL-encoded.
+bool SNetScheduleExecutorImpl::ExecGETB(SNetServerImpl* server,
+        const string& get_cmd, vector<CNetScheduleJob>& jobs)
+{
+    CNetServer::SExecResult exec_result;
+
+    x_ExecGETCmd(server, get_cmd, exec_result);
+
+    size_t job_count = jobs.size();
+
+    CUrlArgs url_parser(exec_result.response);
+    ITERATE(CUrlArgs::TArgs, field, url_parser.GetArgs()) {
+        if (field->name != "job")
+            continue;
+
+        CNetScheduleJob job;
+
+        if (!g_ParseGetJobResponse(job, field->value))
+            continue;
+
+        // Remember the server that issued this job.
+        job.server = server;
+
+        // If a new preferred affinity is given by the server,
+        // register it with the rest of servers.
+        ClaimNewPreferredAffinity(server, job.affinity);
+
+        jobs.push_back(job);
+    }
+
+    return jobs.size() > job_count;
+}
+
+bool SNetScheduleExecutorImpl::x_GetJobsWithAffinityLadder(
+        SNetServerImpl* server, const CDeadline& timeout,
+        const string& prio_aff_list, unsigned max_count,
+        vector<CNetScheduleJob>& jobs)
+{
+    if (max_count <= 1 || !BatchJobsSupported(server)) {
+        CNetScheduleJob job;
+
+        if (!x_GetJobWithAffinityLadder(server, timeout, prio_aff_list, job))
+            return false;
+
+        jobs.push_back(job);
+        return true;
+    }
+
+    // GETB takes the same arguments as GET2 plus the number of jobs
+    string cmd(prio_aff_list.empty() ?
+            CNetScheduleNotificationHandler::MkBaseGETCmd(
+                    m_AffinityPreference, kEmptyStr) :
+            "GET2 wnode_aff=0 any_aff=0 aff=" + prio_aff_list);
+
+    cmd.replace(0, 4, "GETB");
+    cmd += " count=";
+    cmd += NStr::NumericToString(max_count);
+
+    m_NotificationHandler.CmdAppendTimeoutGroupAndClientInfo(cmd,
+            &timeout, m_JobGroup);
+
+    if (!prio_aff_list.empty())
+        cmd.append(" prioritized_aff=1");
+
+    return ExecGETB(server, cmd, jobs);
+}
+
 bool SNetScheduleExecutorImpl::x_GetJobWithAffinityList(SNetServerImpl* server,
         const CDeadline* timeout, CNetScheduleJob& job,
         CNetScheduleExecutor::EJobAffinityPreference affinity_preference,
@@ -416,6 +500,71 @@ bool SNetScheduleExecutorImpl::x_GetJobWithAffinityLadder(
     return false;
 }
 
+class CGetJobsCmdExecutor : public INetServerFinder
+{
+public:
+    CGetJobsCmdExecutor(const string& get_cmd, unsigned max_count,
+            vector<CNetScheduleJob>& jobs,
+            SNetScheduleExecutorImpl* executor) :
+        m_GetCmd(get_cmd), m_MaxCount(max_count),
+        m_Jobs(jobs), m_Executor(executor)
+    {
+    }
+
+    virtual bool Consider(CNetServer server);
+
+private:
+    const string& m_GetCmd;
+    unsigned m_MaxCount;
+    vector<CNetScheduleJob>& m_Jobs;
+    SNetScheduleExecutorImpl* m_Executor;
+};
+
+bool CGetJobsCmdExecutor::Consider(CNetServer server)
+{
+    if (m_MaxCount <= 1 ||
+            !SNetScheduleExecutorImpl::BatchJobsSupported(server)) {
+        CNetScheduleJob job;
+
+        if (!m_Executor->ExecGET(server, m_GetCmd, job))
+            return false;
+
+        m_Jobs.push_back(job);
+        return true;
+    }
+
+    string cmd(m_GetCmd);
+
+    cmd.replace(0, 4, "GETB");
+    cmd += " count=";
+    cmd += NStr::NumericToString(m_MaxCount);
+
+    return m_Executor->ExecGETB(server, cmd, m_Jobs);
+}
+
+bool CNetScheduleExecutor::GetJobs(vector<CNetScheduleJob>& jobs,
+        unsigned max_count, const string& affinity_list)
+{
+    if (max_count == 0)
+        return false;
+
+    string cmd(CNetScheduleNotificationHandler::MkBaseGETCmd(
+            m_Impl->m_AffinityPreference, affinity_list));
+
+    m_Impl->m_NotificationHandler.CmdAppendTimeoutGroupAndClientInfo(
+            cmd, NULL, m_Impl->m_JobGroup);
+
+    CGetJobsCmdExecutor get_cmd_executor(cmd, max_count, jobs, m_Impl);
+
+    CNetServiceIterator it(m_Impl->m_API->m_Service.FindServer(
+            &get_cmd_executor, CNetService::eIncludePenalized));
+
+    if (!it)
+        return false;
+
+    return true;
+}
+
 bool CNetScheduleExecutor::GetJob(CNetScheduleJob& job,
         const string& affinity_list,
         CDeadline* deadline)
@@ -685,6 +834,176 @@ void CNetScheduleExecutor::PutFailure(const CNetScheduleJob& job,
     m_Impl->ExecWithOrWithoutRetry(job, cmd);
 }
 
+// The max number of jobs and the max length of a PUTB command
+static const size_t s_MaxJobsPerBatchCmd = 100;
+static const size_t s_MaxBatchCmdLength = 1024 * 1024;
+
+void CNetScheduleExecutor::CommitJobs(TJobCommits& commits)
+{
+    // Group the jobs by the servers they belong to
+    vector<CNetServer> servers;
+    vector< vector<size_t> > server_jobs;
+    map<string, size_t> server_index;
+
+    for (size_t i = 0; i < commits.size(); ++i) {
+        commits[i].error.erase();
+
+        CNetServer server(m_Impl->m_API->GetServer(*commits[i].job));
+        pair<map<string, size_t>::iterator, bool> inserted =
+            server_index.insert(make_pair(server.GetServerAddress(),
+                    servers.size()));
+
+        if (inserted.second) {
+            servers.push_back(server);
+            server_jobs.push_back(vector<size_t>());
+        }
+        server_jobs[inserted.first->second].push_back(i);
+    }
+
+    for (size_t s = 0; s < servers.size(); ++s) {
+        const vector<size_t>& jobs = server_jobs[s];
+
+        if (jobs.size() > 1 &&
+                SNetScheduleExecutorImpl::BatchJobsSupported(servers[s])) {
+            vector<size_t> batch;
+            size_t batch_length = 0;
+
+            ITERATE(vector<size_t>, it, jobs) {
+                const CNetScheduleJob& job = *commits[*it].job;
+                size_t job_length = job.output.length() +
+                        job.error_msg.length() + job.job_id.length() +
+                        job.auth_token.length();
+
+                if (!batch.empty() &&
+                        (batch.size() >= s_MaxJobsPerBatchCmd ||
+                         batch_length + job_length > s_MaxBatchCmdLength)) {
+                    m_Impl->x_CommitJobBatch(servers[s], commits, batch);
+                    batch.clear();
+                    batch_length = 0;
+                }
+                batch.push_back(*it);
+                batch_length += job_length;
+            }
+            m_Impl->x_CommitJobBatch(servers[s], commits, batch);
+            continue;
+        }
+
+        // The server does not support batches
+        ITERATE(vector<size_t>, it, jobs) {
+            SJobCommit& commit = commits[*it];
+
+            try {
+                if (commit.type == eCommitResult)
+                    PutResult(*commit.job);
+                else
+                    PutFailure(*commit.job,
+                            commit.type == eCommitFailureNoRetries);
+            }
+            catch (CNetScheduleException& e) {
+                commit.error = string(e.GetErrCodeString()) + ':' +
+                        e.GetMsg();
+            }
+        }
+    }
+}
+
+// PUTB format:
+//    PUTB jobs="<job>\n<job>..."
+// where each job is URL-encoded PUT2 (or FPUT2 if err_msg is there)
+// arguments. The response is <job_key>=<URL-encoded result>&...
+// where the result is OK, WARNING:<warning> or ERR:<code>:<message>.
+void SNetScheduleExecutorImpl::x_CommitJobBatch(CNetServer server,
+        CNetScheduleExecutor::TJobCommits& commits,
+        const vector<size_t>& batch)
+{
+    size_t max_output_size = m_API->GetServerParams().max_output_size;
+
+    typedef map<string, size_t> TJobIndex;
+
+    string jobs;
+    TJobIndex job_index;
+
+    ITERATE(vector<size_t>, it, batch) {
+        CNetScheduleExecutor::SJobCommit& commit = commits[*it];
+        const CNetScheduleJob& job = *commit.job;
+
+        try {
+            s_CheckOutputSize(job.output, max_output_size);
+            SNetScheduleAPIImpl::VerifyAuthTokenAlphabet(job.auth_token);
+
+            if (commit.type != CNetScheduleExecutor::eCommitResult &&
+                    job.error_msg.length() >= kNetScheduleMaxDBErrSize) {
+                NCBI_THROW(CNetScheduleException, eDataTooLong,
+                           "Error message too long");
+            }
+        }
+        catch (CNetScheduleException& e) {
+            commit.error = string(e.GetErrCodeString()) + ':' + e.GetMsg();
+            continue;
+        }
+
+        if (!jobs.empty())
+            jobs += '\n';
+
+        jobs += "job_key=";
+        jobs += NStr::URLEncode(job.job_id);
+        jobs += "&auth_token=";
+        jobs += NStr::URLEncode(job.auth_token);
+        jobs += "&job_return_code=";
+        jobs += NStr::NumericToString(job.ret_code);
+        jobs += "&output=";
+        jobs += NStr::URLEncode(job.output);
+
+        if (commit.type != CNetScheduleExecutor::eCommitResult) {
+            jobs += "&err_msg=";
+            jobs += NStr::URLEncode(job.error_msg);
+
+            if (commit.type == CNetScheduleExecutor::eCommitFailureNoRetries)
+                jobs += "&no_retries=1";
+        }
+
+        job_index[job.job_id] = *it;
+    }
+
+    if (job_index.empty())
+        return;
+
+    string cmd("PUTB jobs=\"");
+    cmd += NStr::PrintableString(jobs);
+    cmd += '"';
+
+    g_AppendClientIPSessionIDHitID(cmd);
+
+    CNetServer::SExecResult exec_result;
+
+    if (!m_WorkerNodeMode)
+        exec_result = server.ExecWithRetry(cmd, false);
+    else
+        server->ConnectAndExec(cmd, false, exec_result);
+
+    CUrlArgs url_parser(exec_result.response);
+    ITERATE(CUrlArgs::TArgs, field, url_parser.GetArgs()) {
+        TJobIndex::iterator job = job_index.find(field->name);
+
+        if (job == job_index.end())
+            continue;
+
+        const string& result = field->value;
+
+        if (NStr::StartsWith(result, "WARNING:"))
+            m_API->GetListener()->OnWarning(result.substr(8), server);
+        else if (NStr::StartsWith(result, "ERR:"))
+            commits[job->second].error = result.substr(4);
+
+        job_index.erase(job);
+    }
+
+    ITERATE(TJobIndex, job, job_index) {
+        commits[job->second].error =
+                "eProtocolSyntaxError:No result for the job in PUTB output";
+    }
+}
+
 void CNetScheduleExecutor::Reschedule(const CNetScheduleJob& job)
 {
     string cmd("RESCHEDULE job_key=" + job.job_id);
@@ -109,6 +109,7 @@ struct SNetScheduleServerProperties : public INetServerProperties
     // Therefore, if that command is version dependent,
     // old version of the command will be sent to the server at first.
     CVersionInfo version;
+    CVersionInfo protocol_version;
 
     bool affs_synced;
 };
@@ -438,6 +439,8 @@ struct SNetScheduleExecutorImpl : public CObject
     void ClaimNewPreferredAffinity(CNetServer orig_server,
         const string& affinity);
     string MkSETAFFCmd();
+    void x_ExecGETCmd(SNetServerImpl* server, const string& get_cmd,
+            CNetServer::SExecResult& exec_result);
     bool ExecGET(SNetServerImpl* server,
             const string& get_cmd, CNetScheduleJob& job);
     bool x_GetJobWithAffinityList(SNetServerImpl* server,
@@ -450,6 +453,19 @@ struct SNetScheduleExecutorImpl : public CObject
             const string& prio_aff_list,
             CNetScheduleJob& job);
 
+    // Support for GETB and PUTB (NetSchedule protocol 1.5.0+)
+    static bool BatchJobsSupported(SNetServerImpl* server);
+    bool ExecGETB(SNetServerImpl* server,
+            const string& get_cmd, vector<CNetScheduleJob>& jobs);
+    bool x_GetJobsWithAffinityLadder(SNetServerImpl* server,
+            const CDeadline& timeout,
+            const string& prio_aff_list,
+            unsigned max_count,
+            vector<CNetScheduleJob>& jobs);
+    void x_CommitJobBatch(CNetServer server,
+            CNetScheduleExecutor::TJobCommits& commits,
+            const vector<size_t>& batch);
+
     void ExecWithOrWithoutRetry(const CNetScheduleJob& job, const string& cmd);
     void ReturnJob(const CNetScheduleJob& job, bool blacklist = true);
 
@@ -136,6 +136,15 @@ void* CJobCommitterThread::Main()
         }
 
         while (!m_ImmediateActions.empty()) {
+            // Several results and failures in a row
+            // are committed with one command.
+            size_t batch_size = x_GetBatchSize();
+
+            if (batch_size > 1) {
+                x_CommitJobBatch(batch_size);
+                continue;
+            }
+
             TEntry& entry = m_ImmediateActions.front();
 
             // Do not remove the job context from m_ImmediateActions
@@ -200,23 +209,7 @@ bool CJobCommitterThread::x_CommitJob(SWorkerNodeJobContextImpl* job_context)
         recycle_job_context = true;
     }
     catch (exception& e) {
-        unsigned commit_interval = m_WorkerNode->m_CommitJobInterval;
-        job_context->ResetTimeout(commit_interval);
-        if (job_context->m_FirstCommitAttempt) {
-            job_context->m_FirstCommitAttempt = false;
-            job_context->m_CommitExpiration =
-                    CDeadline(m_WorkerNode->m_QueueTimeout, 0);
-        } else if (job_context->m_CommitExpiration <
-                job_context->GetTimeout()) {
-            ERR_POST_X(64, "Could not commit " <<
-                    job_context->m_Job.job_id << ": " << e.what());
-            recycle_job_context = true;
-        }
-        if (!recycle_job_context) {
-            ERR_POST_X(63, "Error while committing " <<
-                    job_context->m_Job.job_id << ": " << e.what() <<
-                    "; will retry in " << commit_interval << " seconds.");
-        }
+        recycle_job_context = x_CommitFailed(job_context, e.what());
     }
 
     m_WorkerNode->m_JobsInProgress.Remove(job_context->m_Job.job_id);
@@ -227,6 +220,127 @@ bool CJobCommitterThread::x_CommitJob(SWorkerNodeJobContextImpl* job_context)
     return recycle_job_context;
 }
 
+// Schedules another commit attempt of a job which could not be
+// committed; returns true if the job must be given up.
+bool CJobCommitterThread::x_CommitFailed(
+        SWorkerNodeJobContextImpl* job_context, const char* error)
+{
+    bool recycle_job_context = false;
+
+    unsigned commit_interval = m_WorkerNode->m_CommitJobInterval;
+    job_context->ResetTimeout(commit_interval);
+    if (job_context->m_FirstCommitAttempt) {
+        job_context->m_FirstCommitAttempt = false;
+        job_context->m_CommitExpiration =
+                CDeadline(m_WorkerNode->m_QueueTimeout, 0);
+    } else if (job_context->m_CommitExpiration <
+            job_context->GetTimeout()) {
+        ERR_POST_X(64, "Could not commit " <<
+                job_context->m_Job.job_id << ": " << error);
+        recycle_job_context = true;
+    }
+    if (!recycle_job_context) {
+        ERR_POST_X(63, "Error while committing " <<
+                job_context->m_Job.job_id << ": " << error <<
+                "; will retry in " << commit_interval << " seconds.");
+    }
+
+    return recycle_job_context;
+}
+
+// The max number of jobs committed with one command
+static const size_t s_MaxCommitBatchSize = 100;
+
+size_t CJobCommitterThread::x_GetBatchSize() const
+{
+    size_t batch_size = 0;
+
+    ITERATE(TCommitJobTimeline, it, m_ImmediateActions) {
+        if (batch_size == s_MaxCommitBatchSize)
+            break;
+
+        CWorkerNodeJobContext::ECommitStatus commit_status =
+                (*it)->m_JobCommitStatus;
+
+        if (commit_status != CWorkerNodeJobContext::eCS_Done &&
+                commit_status != CWorkerNodeJobContext::eCS_Failure)
+            break;
+
+        ++batch_size;
+    }
+
+    return batch_size;
+}
+
+void CJobCommitterThread::x_CommitJobBatch(size_t batch_size)
+{
+    // Like in Main(), the job contexts stay in m_ImmediateActions
+    // while they are being committed.
+    vector<TEntry> batch(m_ImmediateActions.begin(),
+            m_ImmediateActions.begin() + batch_size);
+    vector<bool> recycle_job_context(batch_size, true);
+
+    {{
+        TFastMutexUnlockGuard mutext_unlock(m_TimelineMutex);
+
+        CNetScheduleExecutor::TJobCommits commits;
+
+        ITERATE(vector<TEntry>, it, batch) {
+            const SWorkerNodeJobContextImpl* job_context = *it;
+
+            commits.push_back(CNetScheduleExecutor::SJobCommit(
+                    job_context->m_Job,
+                    job_context->m_JobCommitStatus ==
+                            CWorkerNodeJobContext::eCS_Done ?
+                        CNetScheduleExecutor::eCommitResult :
+                    job_context->m_DisableRetries ?
+                        CNetScheduleExecutor::eCommitFailureNoRetries :
+                        CNetScheduleExecutor::eCommitFailure));
+        }
+
+        string commit_error;
+
+        try {
+            m_WorkerNode->m_NSExecutor.CommitJobs(commits);
+        }
+        catch (exception& e) {
+            commit_error = e.what();
+            if (commit_error.empty())
+                commit_error = "Unknown error";
+        }
+
+        for (size_t i = 0; i < batch_size; ++i) {
+            SWorkerNodeJobContextImpl* job_context = batch[i];
+
+            CRequestContextSwitcher request_state_guard(
+                    job_context->m_RequestContext);
+
+            if (!commit_error.empty())
+                recycle_job_context[i] =
+                        x_CommitFailed(job_context, commit_error.c_str());
+            else if (!commits[i].error.empty()) {
+                ERR_POST_X(65, "Could not commit " <<
+                        job_context->m_Job.job_id << ": " <<
+                        commits[i].error);
+            }
+
+            m_WorkerNode->m_JobsInProgress.Remove(job_context->m_Job.job_id);
+
+            if (recycle_job_context[i])
+                job_context->x_PrintRequestStop();
+        }
+    }}
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        if (recycle_job_context[i])
+            m_JobContextPool.push_back(batch[i]);
+        else
+            m_Timeline.push_back(batch[i]);
+
+        m_ImmediateActions.pop_front();
+    }
+}
+
 /// @internal
 IWorkerNodeJob* SGridWorkerNodeImpl::GetJobProcessor()
 {
@@ -93,6 +93,10 @@ private:
 
     bool WaitForTimeout();
     bool x_CommitJob(SWorkerNodeJobContextImpl* job_context);
+    size_t x_GetBatchSize() const;
+    void x_CommitJobBatch(size_t batch_size);
+    bool x_CommitFailed(SWorkerNodeJobContextImpl* job_context,
+            const char* error);
 
     void WakeUp()
     {
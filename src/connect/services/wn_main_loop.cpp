@@ -624,6 +624,17 @@ void* CMainLoopThread::Main()
         try_count = 0;
     }
 
+    // Give back the jobs which have been received but not started
+    while (!m_Impl.m_PrefetchedJobs.empty()) {
+        try {
+            m_Impl.ReturnJob(m_Impl.m_PrefetchedJobs.front());
+        }
+        catch (exception& ex) {
+            ERR_POST_X(29, ex.what());
+        }
+        m_Impl.m_PrefetchedJobs.pop_front();
+    }
+
     return NULL;
 }
 
@@ -706,8 +717,28 @@ bool CMainLoopThread::CImpl::CheckEntry(
         CNetScheduleAPI::EJobStatus* /*job_status*/)
 {
     CNetServer server(m_API.GetService()->GetServer(entry.server_address));
-    return m_WorkerNode->m_NSExecutor->x_GetJobWithAffinityLadder(server,
-            m_Timeout, prio_aff_list, job);
+
+    // Take as many jobs as there are idle worker threads
+    // if the server can give them at once.
+    size_t jobs_in_progress = m_WorkerNode->m_JobsInProgress.GetCount();
+    unsigned max_count = m_WorkerNode->IsExclusiveMode() ||
+            jobs_in_progress >= m_WorkerNode->m_MaxThreads ? 1 :
+            m_WorkerNode->m_MaxThreads - (unsigned) jobs_in_progress;
+
+    if (max_count <= 1)
+        return m_WorkerNode->m_NSExecutor->x_GetJobWithAffinityLadder(server,
+                m_Timeout, prio_aff_list, job);
+
+    vector<CNetScheduleJob> jobs;
+
+    if (!m_WorkerNode->m_NSExecutor->x_GetJobsWithAffinityLadder(server,
+                m_Timeout, prio_aff_list, max_count, jobs))
+        return false;
+
+    job = jobs.front();
+    m_PrefetchedJobs.insert(m_PrefetchedJobs.end(),
+            jobs.begin() + 1, jobs.end());
+    return true;
 }
 
 void CMainLoopThread::CImpl::ReturnJob(CNetScheduleJob& job)
@@ -725,7 +756,11 @@ bool CMainLoopThread::x_GetNextJob(CNetScheduleJob& job)
     if (!m_WorkerNode->WaitForExclusiveJobToFinish())
         return false;
 
-    if (m_Timeline.GetJob(CTimeout::eInfinite, job, NULL) != CNetScheduleGetJob::eJob) {
+    if (!m_Impl.m_PrefetchedJobs.empty()) {
+        job = m_Impl.m_PrefetchedJobs.front();
+        m_Impl.m_PrefetchedJobs.pop_front();
+    } else if (m_Timeline.GetJob(CTimeout::eInfinite, job, NULL) !=
+            CNetScheduleGetJob::eJob) {
         return false;
     }
 
@@ -0,0 +1,436 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Test CHttpSession connection reuse and pipelining against a local
+ *   HTTP server stand-in.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbi_system.hpp>
+#include <connect/ncbi_core_cxx.hpp>
+#include <connect/ncbi_http_session.hpp>
+#include <connect/ncbi_socket.hpp>
+
+#include "test_assert.h"  // This header must go last
+
+
+USING_NCBI_SCOPE;
+
+
+static const STimeout kServerTimeout = {10, 0};
+
+
+/////////////////////////////////
+// HTTP server stand-in
+//
+// Responds to any request with "conn=<N>;req=<M>;<path>;<body>", where N is
+// the number of the connection (from 1) and M is the number of the request
+// within the connection (from 1). Special paths:
+//   /chunked  - the response is sent in chunks;
+//   /close    - the response has "Connection: close";
+//   /drop     - the connection is closed after the response without notice;
+//   /redirect - redirects to /echo?redirected.
+// HTTP/1.0 requests are served one per connection.
+//
+
+class CHttpStandIn : public CThread
+{
+public:
+    CHttpStandIn(void) : m_Stop(false), m_Connections(0)
+    {
+        _VERIFY(m_Listener.Listen(0) == eIO_Success);
+    }
+
+    unsigned short GetPort(void) const
+    { return m_Listener.GetPort(eNH_HostByteOrder); }
+
+    unsigned int GetConnections(void)
+    {
+        CFastMutexGuard guard(m_Lock);
+        return m_Connections;
+    }
+
+    void Stop(void)
+    {
+        CFastMutexGuard guard(m_Lock);
+        m_Stop = true;
+    }
+
+protected:
+    virtual void* Main(void);
+
+private:
+    class CConnThread : public CThread
+    {
+    public:
+        CConnThread(CSocket* sock, unsigned int id)
+            : m_Socket(sock), m_ID(id) {}
+    protected:
+        virtual void* Main(void);
+    private:
+        auto_ptr<CSocket> m_Socket;
+        unsigned int      m_ID;
+    };
+
+    CListeningSocket m_Listener;
+    CFastMutex       m_Lock;
+    bool             m_Stop;
+    unsigned int     m_Connections;
+};
+
+
+void* CHttpStandIn::Main(void)
+{
+    static const STimeout kAcceptTimeout = {0, 100000};
+    vector< CRef<CThread> > threads;
+    for (;;) {
+        {{
+            CFastMutexGuard guard(m_Lock);
+            if ( m_Stop ) {
+                break;
+            }
+        }}
+        CSocket* sock = 0;
+        if (m_Listener.Accept(sock, &kAcceptTimeout) != eIO_Success) {
+            continue;
+        }
+        unsigned int id;
+        {{
+            CFastMutexGuard guard(m_Lock);
+            id = ++m_Connections;
+        }}
+        sock->SetTimeout(eIO_ReadWrite, &kServerTimeout);
+        CRef<CThread> thread(new CConnThread(sock, id));
+        thread->Run();
+        threads.push_back(thread);
+    }
+    NON_CONST_ITERATE(vector< CRef<CThread> >, it, threads) {
+        (*it)->Join();
+    }
+    return 0;
+}
+
+
+void* CHttpStandIn::CConnThread::Main(void)
+{
+    CSocket& sock = *m_Socket;
+    for (unsigned int req = 1;  ;  ++req) {
+        string line, path, connection;
+        if (sock.ReadLine(line) != eIO_Success  ||  line.empty()) {
+            break;
+        }
+        list<string> parts;
+        NStr::Split(line, " ", parts, NStr::fSplit_Tokenize);
+        if (parts.size() != 3) {
+            break;
+        }
+        path = *++parts.begin();
+        bool keep_alive = parts.back() == "HTTP/1.1";
+        size_t length = 0;
+        while (sock.ReadLine(line) == eIO_Success  &&  !line.empty()) {
+            SIZE_TYPE delim = line.find(':');
+            if (delim == NPOS) {
+                continue;
+            }
+            string name  = line.substr(0, delim);
+            string value = NStr::TruncateSpaces(line.substr(delim + 1));
+            if (NStr::EqualNocase(name, "Content-Length")) {
+                length = NStr::StringToNumeric<size_t>(value);
+            }
+            else if (NStr::EqualNocase(name, "Connection")) {
+                keep_alive = NStr::EqualNocase(value, "keep-alive");
+            }
+        }
+        string body(length, '\0');
+        if (length  &&  sock.Read(&body[0], length, 0, eIO_ReadPersist)
+            != eIO_Success) {
+            break;
+        }
+
+        string content = "conn=" + NStr::NumericToString(m_ID) +
+            ";req=" + NStr::NumericToString(req) + ";" + path + ";" + body;
+        string response;
+        bool drop = false;
+        if (NStr::StartsWith(path, "/redirect")) {
+            response = "HTTP/1.1 302 Found\r\n"
+                "Location: /echo?redirected\r\n"
+                "Content-Length: " + NStr::NumericToString(content.size()) +
+                "\r\n\r\n" + content;
+        }
+        else if (NStr::StartsWith(path, "/chunked")) {
+            size_t half = content.size() / 2;
+            response = "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n\r\n" +
+                NStr::NumericToString(half, 0, 16) + "\r\n" +
+                content.substr(0, half) + "\r\n" +
+                NStr::NumericToString(content.size() - half, 0, 16) +
+                ";ext=1\r\n" + content.substr(half) + "\r\n"
+                "0\r\nX-Trailer: 1\r\n\r\n";
+        }
+        else {
+            if (NStr::StartsWith(path, "/close")) {
+                keep_alive = false;
+            }
+            drop = NStr::StartsWith(path, "/drop");
+            response = string(keep_alive ? "HTTP/1.1" : "HTTP/1.0") +
+                " 200 OK\r\n"
+                "Content-Type: text/plain\r\n"
+                "Content-Length: " + NStr::NumericToString(content.size()) +
+                "\r\n" + (keep_alive ? "" : "Connection: close\r\n") +
+                "\r\n" + content;
+        }
+        if (sock.Write(response.data(), response.size()) != eIO_Success
+            ||  !keep_alive  ||  drop) {
+            break;
+        }
+    }
+    sock.Close();
+    return 0;
+}
+
+
+/////////////////////////////////
+// Test application
+//
+
+class CTestHttpSession : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run (void);
+
+private:
+    string x_Url(const string& path) const;
+    static string x_Read(const CHttpResponse& response);
+    // Parse "conn=<N>;..." from the content.
+    static unsigned int x_Conn(const string& content);
+
+    void x_TestNoReuse(void);
+    void x_TestKeepAlive(void);
+    void x_TestIdleTimeout(void);
+    void x_TestPipeline(void);
+
+    CRef<CHttpStandIn> m_Server;
+};
+
+
+void CTestHttpSession::Init(void)
+{
+    CONNECT_Init(&GetConfig());
+    SetDiagPostLevel(eDiag_Info);
+
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Test CHttpSession connection pool");
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+string CTestHttpSession::x_Url(const string& path) const
+{
+    return "http://127.0.0.1:" +
+        NStr::NumericToString(m_Server->GetPort()) + path;
+}
+
+
+string CTestHttpSession::x_Read(const CHttpResponse& response)
+{
+    assert(response.GetStatusCode() == 200);
+    CNcbiOstrstream out;
+    NcbiStreamCopy(out, response.ContentStream());
+    return CNcbiOstrstreamToString(out);
+}
+
+
+unsigned int CTestHttpSession::x_Conn(const string& content)
+{
+    assert(NStr::StartsWith(content, "conn="));
+    return NStr::StringToUInt(content.substr(5, content.find(';') - 5));
+}
+
+
+void CTestHttpSession::x_TestNoReuse(void)
+{
+    ERR_POST(Info << "No connection reuse");
+    CRef<CHttpSession> session(new CHttpSession);
+    unsigned int conns = m_Server->GetConnections();
+    for (int i = 0;  i < 3;  ++i) {
+        string content = x_Read(session->Get(x_Url("/echo")));
+        assert(NStr::EndsWith(content, ";/echo;"));
+    }
+    assert(m_Server->GetConnections() == conns + 3);
+}
+
+
+void CTestHttpSession::x_TestKeepAlive(void)
+{
+    ERR_POST(Info << "Keep-alive connections");
+    CRef<CHttpSession> session(new CHttpSession);
+    session->SetConnReuse(CHttpSession::eConnReuse_KeepAlive);
+    unsigned int conns = m_Server->GetConnections();
+
+    // Sequential requests share a connection.
+    unsigned int conn = 0;
+    for (unsigned int i = 0;  i < 5;  ++i) {
+        CHttpResponse response = session->Get(x_Url("/echo"));
+        string content = x_Read(response);
+        assert(NStr::EndsWith(content, ";req=" + NStr::NumericToString(i + 1)
+                              + ";/echo;"));
+        assert(response.GetReuseCount() == i);
+        assert(i == 0  ||  response.GetConnectTime() == 0);
+        assert(response.GetTimeToFirstByte() > 0);
+        if (i == 0) {
+            conn = x_Conn(content);
+        }
+        assert(x_Conn(content) == conn);
+    }
+    assert(m_Server->GetConnections() == conns + 1);
+
+    // POST body, chunked response.
+    string content = x_Read(session->Post(x_Url("/echo"), "data"));
+    assert(NStr::EndsWith(content, ";req=6;/echo;data"));
+    content = x_Read(session->Get(x_Url("/chunked?a=1")));
+    assert(NStr::EndsWith(content, ";req=7;/chunked?a=1;"));
+    content = x_Read(session->Get(x_Url("/echo")));
+    assert(x_Conn(content) == conn);
+
+    // A response not read out does not break the connection.
+    session->Get(x_Url("/echo"));
+    content = x_Read(session->Get(x_Url("/echo")));
+    assert(NStr::EndsWith(content, ";req=10;/echo;"));
+
+    // A connection is busy while its response is being read. The response
+    // must be large enough not to be read out at once.
+    string data(1024 * 1024, 'x');
+    CHttpResponse busy = session->Post(x_Url("/echo"), data);
+    content = x_Read(session->Get(x_Url("/echo")));
+    assert(x_Conn(content) != conn);
+    content = x_Read(busy);
+    assert(x_Conn(content) == conn);
+    assert(NStr::EndsWith(content, data));
+    assert(m_Server->GetConnections() == conns + 2);
+
+    // Redirect over a pooled connection.
+    CHttpResponse redirected = session->Get(x_Url("/redirect"));
+    content = x_Read(redirected);
+    assert(NStr::EndsWith(content, ";/echo?redirected;"));
+    assert(redirected.GetLocation().GetPath() == "/echo");
+    assert(m_Server->GetConnections() == conns + 2);
+
+    // Connections closed by the server are not reused.
+    session->CloseIdleConnections();
+    conns = m_Server->GetConnections();
+    x_Read(session->Get(x_Url("/close")));
+    x_Read(session->Get(x_Url("/echo")));
+    assert(m_Server->GetConnections() == conns + 2);
+    x_Read(session->Get(x_Url("/drop")));
+    SleepMilliSec(100);
+    content = x_Read(session->Get(x_Url("/echo")));
+    assert(NStr::EndsWith(content, ";req=1;/echo;"));
+    assert(m_Server->GetConnections() == conns + 3);
+}
+
+
+void CTestHttpSession::x_TestIdleTimeout(void)
+{
+    ERR_POST(Info << "Idle timeout");
+    CRef<CHttpSession> session(new CHttpSession);
+    session->SetConnReuse(CHttpSession::eConnReuse_KeepAlive);
+    session->SetIdleTimeout(CTimeout(0.2));
+    unsigned int conns = m_Server->GetConnections();
+    x_Read(session->Get(x_Url("/echo")));
+    x_Read(session->Get(x_Url("/echo")));
+    assert(m_Server->GetConnections() == conns + 1);
+    SleepMilliSec(300);
+    CHttpResponse response = session->Get(x_Url("/echo"));
+    x_Read(response);
+    assert(response.GetReuseCount() == 0);
+    assert(m_Server->GetConnections() == conns + 2);
+}
+
+
+void CTestHttpSession::x_TestPipeline(void)
+{
+    ERR_POST(Info << "Pipelining");
+    CRef<CHttpSession> session(new CHttpSession);
+    session->SetConnReuse(CHttpSession::eConnReuse_Pipeline);
+    session->SetMaxPipelineDepth(4);
+    unsigned int conns = m_Server->GetConnections();
+
+    vector<CHttpRequest> requests;
+    for (int i = 0;  i < 8;  ++i) {
+        requests.push_back(session->NewRequest(
+            x_Url("/echo?" + NStr::NumericToString(i))));
+    }
+    vector<CHttpResponse> responses;
+    session->ExecuteBatch(requests, responses);
+    assert(responses.size() == requests.size());
+    // Read the responses in reverse order: the first ones are buffered.
+    map<unsigned int, int> per_conn;
+    for (int i = 7;  i >= 0;  --i) {
+        string content = x_Read(responses[i]);
+        assert(NStr::EndsWith(content, ";/echo?" + NStr::NumericToString(i)
+                              + ";"));
+        ++per_conn[x_Conn(content)];
+    }
+    // Two connections, four requests each.
+    assert(per_conn.size() == 2);
+    assert(per_conn.begin()->second == 4);
+    assert(m_Server->GetConnections() == conns + 2);
+
+    // The connections are reused after all the responses are read.
+    string content = x_Read(session->Get(x_Url("/echo")));
+    assert(per_conn.find(x_Conn(content)) != per_conn.end());
+    assert(m_Server->GetConnections() == conns + 2);
+}
+
+
+int CTestHttpSession::Run(void)
+{
+    m_Server.Reset(new CHttpStandIn);
+    m_Server->Run();
+
+    x_TestNoReuse();
+    x_TestKeepAlive();
+    x_TestIdleTimeout();
+    x_TestPipeline();
+
+    m_Server->Stop();
+    m_Server->Join();
+    ERR_POST(Info << "TEST COMPLETED SUCCESSFULLY");
+    return 0;
+}
+
+
+int main(int argc, char* argv[])
+{
+    return CTestHttpSession().AppMain(argc, argv);
+}
@@ -0,0 +1,451 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   CServer benchmark: request latency of a few active clients while the
+ *   server keeps many idle connections open
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbicntr.hpp>
+#include <corelib/ncbi_system.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbitime.hpp>
+#include <connect/ncbi_util.h>
+#include <connect/server.hpp>
+#include <algorithm>
+
+#ifdef NCBI_OS_UNIX
+#  include <sys/resource.h>
+#endif
+
+#include "test_assert.h"  // This header must go last
+
+
+BEGIN_NCBI_SCOPE
+
+
+/// CScaleTestServer --
+///
+/// CServer which counts the open connections and exits on request.
+
+class CScaleTestServer : public CServer
+{
+public:
+    CScaleTestServer(void) : m_ShutdownRequested(false)
+    {
+        m_OpenConnections.Set(0);
+    }
+
+    virtual bool ShutdownRequested(void) { return m_ShutdownRequested; }
+    void RequestShutdown(void) { m_ShutdownRequested = true; }
+
+    void OnConnectionOpen(void)  { m_OpenConnections.Add(1); }
+    void OnConnectionClose(void) { m_OpenConnections.Add(-1); }
+    int  GetOpenConnections(void) const
+        { return (int) m_OpenConnections.Get(); }
+
+private:
+    CAtomicCounter m_OpenConnections;
+    volatile bool  m_ShutdownRequested;
+};
+
+
+/// CEchoConnectionHandler --
+///
+/// Answers "OK" to every line the client sends.
+
+class CEchoConnectionHandler : public IServer_LineMessageHandler
+{
+public:
+    CEchoConnectionHandler(CScaleTestServer* server)
+        : m_Server(server)
+    {
+    }
+
+    virtual void OnOpen(void) { m_Server->OnConnectionOpen(); }
+    virtual void OnWrite(void) { }
+
+    virtual void OnClose(EClosePeer peer)
+    {
+        if (peer == eClientClose)
+            m_Server->CloseConnection(&GetSocket());
+        else
+            m_Server->OnConnectionClose();
+    }
+
+    virtual void OnMessage(BUF buf)
+    {
+        char data[1024];
+        while (BUF_Read(buf, data, sizeof(data)) > 0)
+            ;
+        GetSocket().Write("OK\n", sizeof("OK\n") - 1);
+    }
+
+private:
+    CScaleTestServer* m_Server;
+};
+
+
+class CEchoConnectionFactory : public IServer_ConnectionFactory
+{
+public:
+    CEchoConnectionFactory(CScaleTestServer* server)
+        : m_Server(server)
+    {
+    }
+
+    IServer_ConnectionHandler* Create(void) {
+        return new CEchoConnectionHandler(m_Server);
+    }
+
+private:
+    CScaleTestServer* m_Server;
+};
+
+
+/// CLatencyClient --
+///
+/// Makes the requests one after another over a single connection and
+/// records the round trip time of each.
+
+class CLatencyClient : public CThread
+{
+public:
+    CLatencyClient(unsigned short port, unsigned int requests)
+        : m_Port(port), m_Requests(requests), m_Errors(0)
+    {
+    }
+
+    const vector<double>& GetLatencies(void) const { return m_Latencies; }
+    unsigned int GetErrors(void) const { return m_Errors; }
+
+protected:
+    virtual void* Main(void)
+    {
+        CSocket socket("127.0.0.1", m_Port);
+        string  answer;
+
+        m_Latencies.reserve(m_Requests);
+        for (unsigned int i = 0;  i < m_Requests;  ++i) {
+            CStopWatch sw(CStopWatch::eStart);
+            if (socket.Write("ping\n", sizeof("ping\n") - 1) != eIO_Success
+                ||  socket.ReadLine(answer) != eIO_Success
+                ||  answer != "OK") {
+                ++m_Errors;
+                break;
+            }
+            m_Latencies.push_back(sw.Elapsed() * 1000000.0);
+        }
+        return NULL;
+    }
+
+private:
+    unsigned short m_Port;
+    unsigned int   m_Requests;
+    unsigned int   m_Errors;
+    vector<double> m_Latencies;
+};
+
+
+/// CBenchmarkThread --
+///
+/// Client side of the benchmark. For every number of idle connections
+/// opens them, measures the latency of the active clients and closes them.
+/// Shuts the server down at the end.
+
+class CBenchmarkThread : public CThread
+{
+public:
+    CBenchmarkThread(CScaleTestServer&             server,
+                     const vector<unsigned short>& ports,
+                     const vector<unsigned int>&   idle_counts,
+                     unsigned int                  clients,
+                     unsigned int                  requests)
+        : m_Server(server), m_Ports(ports), m_IdleCounts(idle_counts),
+          m_Clients(clients), m_Requests(requests)
+    {
+    }
+
+protected:
+    virtual void* Main(void);
+
+private:
+    bool x_WaitForConnections(int count);
+    void x_Measure(size_t idle_count);
+
+    CScaleTestServer&      m_Server;
+    vector<unsigned short> m_Ports;
+    vector<unsigned int>   m_IdleCounts;
+    unsigned int           m_Clients;
+    unsigned int           m_Requests;
+};
+
+
+bool CBenchmarkThread::x_WaitForConnections(int count)
+{
+    for (int i = 0;  i < 6000;  ++i) {
+        if (m_Server.GetOpenConnections() >= count)
+            return true;
+        SleepMilliSec(10);
+    }
+    return false;
+}
+
+
+void CBenchmarkThread::x_Measure(size_t idle_count)
+{
+    vector< CRef<CLatencyClient> > clients;
+    for (unsigned int i = 0;  i < m_Clients;  ++i) {
+        clients.push_back(CRef<CLatencyClient>(
+            new CLatencyClient(m_Ports[i % m_Ports.size()], m_Requests)));
+        clients.back()->Run();
+    }
+
+    vector<double> latencies;
+    unsigned int   errors = 0;
+    for (unsigned int i = 0;  i < m_Clients;  ++i) {
+        clients[i]->Join();
+        latencies.insert(latencies.end(),
+                         clients[i]->GetLatencies().begin(),
+                         clients[i]->GetLatencies().end());
+        errors += clients[i]->GetErrors();
+    }
+    if (latencies.empty()) {
+        ERR_POST("No requests were processed with " << idle_count
+                 << " idle connections");
+        return;
+    }
+
+    sort(latencies.begin(), latencies.end());
+    double total = 0.0;
+    ITERATE(vector<double>, it, latencies) {
+        total += *it;
+    }
+
+    NcbiCout.setf(IOS_BASE::fixed, IOS_BASE::floatfield);
+    NcbiCout << setw(8)  << idle_count
+             << setw(10) << latencies.size()
+             << setw(8)  << errors << setprecision(1)
+             << setw(10) << total / latencies.size()
+             << setw(10) << latencies[latencies.size() / 2]
+             << setw(10) << latencies[latencies.size() * 99 / 100]
+             << setw(10) << latencies.back()
+             << NcbiEndl;
+}
+
+
+void* CBenchmarkThread::Main(void)
+{
+    NcbiCout << "    idle  requests  errors  avg, us   p50, us   "
+                "p99, us   max, us" << NcbiEndl;
+
+    ITERATE(vector<unsigned int>, count, m_IdleCounts) {
+        vector<CSocket*> idle;
+        idle.reserve(*count);
+        for (unsigned int i = 0;  i < *count;  ++i) {
+            // Several listening ports let the client side have more than
+            // one ephemeral port range worth of connections
+            CSocket* socket = new CSocket("127.0.0.1",
+                                          m_Ports[i % m_Ports.size()]);
+            if (socket->GetStatus(eIO_Open) != eIO_Success) {
+                ERR_POST("Cannot open idle connection #" << i
+                         << " (check the open files limit)");
+                delete socket;
+                break;
+            }
+            idle.push_back(socket);
+        }
+
+        if (x_WaitForConnections((int) idle.size()))
+            x_Measure(idle.size());
+        else
+            ERR_POST("The server has not accepted all the idle connections");
+
+        ITERATE(vector<CSocket*>, it, idle) {
+            delete *it;
+        }
+        // Let the server close its ends before the next round
+        while (m_Server.GetOpenConnections() > 0)
+            SleepMilliSec(10);
+    }
+
+    m_Server.RequestShutdown();
+    return NULL;
+}
+
+
+/// CServerScaleTestApp --
+///
+/// Main application class pulling everything together.
+
+class CServerScaleTestApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run (void);
+    virtual void Exit(void);
+};
+
+
+void CServerScaleTestApp::Init(void)
+{
+    CORE_SetLOCK(MT_LOCK_cxx2c());
+    CORE_SetLOG(LOG_cxx2c());
+
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "CServer scalability benchmark");
+
+    arg_desc->AddDefaultKey("idle", "list",
+                            "Comma separated numbers of idle connections to "
+                            "measure with",
+                            CArgDescriptions::eString, "10000,100000");
+
+    arg_desc->AddDefaultKey("clients", "N",
+                            "Number of active clients",
+                            CArgDescriptions::eInteger, "4");
+
+    arg_desc->AddDefaultKey("requests", "N",
+                            "Number of requests each active client makes",
+                            CArgDescriptions::eInteger, "10000");
+
+    arg_desc->AddDefaultKey("ports", "N",
+                            "Number of ports the server listens on",
+                            CArgDescriptions::eInteger, "4");
+
+    arg_desc->AddDefaultKey("srvthreads", "N",
+                            "Maximum number of server threads",
+                            CArgDescriptions::eInteger, "8");
+
+    CArgAllow* constraint = new CArgAllow_Integers(1, 999);
+    arg_desc->SetConstraint("clients", constraint);
+    arg_desc->SetConstraint("ports", constraint);
+    arg_desc->SetConstraint("srvthreads", constraint);
+
+    SetupArgDescriptions(arg_desc.release());
+}
+
+void CServerScaleTestApp::Exit(void)
+{
+    CORE_SetLOG(0);
+    CORE_SetLOCK(0);
+}
+
+// Check for shutdown request every second
+static STimeout kAcceptTimeout = { 1, 0 };
+static STimeout kIdleTimeout = { 3600, 0 };
+
+int CServerScaleTestApp::Run(void)
+{
+    SetDiagPostLevel(eDiag_Warning);
+
+    const CArgs& args = GetArgs();
+
+    vector<unsigned int> idle_counts;
+    list<string>         counts;
+    NStr::Split(args["idle"].AsString(), ",", counts, NStr::fSplit_Tokenize);
+    unsigned int max_idle = 0;
+    ITERATE(list<string>, it, counts) {
+        idle_counts.push_back(NStr::StringToUInt(*it));
+        max_idle = max(max_idle, idle_counts.back());
+    }
+    unsigned int clients = args["clients"].AsInteger();
+
+#ifdef NCBI_OS_UNIX
+    // Both ends of every connection are in this process
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0) {
+        rlim_t needed = (rlim_t) (max_idle + clients) * 2 + 100;
+        if (rl.rlim_cur < needed) {
+            rl.rlim_cur = min(needed, rl.rlim_max);
+            setrlimit(RLIMIT_NOFILE, &rl);
+        }
+        if (rl.rlim_cur < needed) {
+            ERR_POST(Warning << "Open files limit " << rl.rlim_cur
+                     << " is too low for " << max_idle
+                     << " idle connections");
+        }
+    }
+#endif
+
+    vector<unsigned short> ports;
+    unsigned short port = 4096;
+    while (ports.size() < (size_t) args["ports"].AsInteger()) {
+        CListeningSocket listener;
+        while (++port & 0xFFFF) {
+            if (listener.Listen(port, 5, fSOCK_BindAny | fSOCK_LogOff)
+                == eIO_Success)
+                break;
+        }
+        if (port == 0) {
+            ERR_POST("CServer benchmark: unable to find free ports "
+                     "to listen on");
+            return 2;
+        }
+        ports.push_back(port);
+    }
+
+    SServer_Parameters params;
+    params.init_threads = args["srvthreads"].AsInteger();
+    params.max_threads = args["srvthreads"].AsInteger();
+    params.max_connections = max_idle + clients + 100;
+    params.accept_timeout = &kAcceptTimeout;
+    params.idle_timeout = &kIdleTimeout;
+
+    CScaleTestServer server;
+    server.SetParameters(params);
+    ITERATE(vector<unsigned short>, it, ports) {
+        server.AddListener(new CEchoConnectionFactory(&server), *it);
+    }
+    server.StartListening();
+
+    CRef<CBenchmarkThread> benchmark(
+        new CBenchmarkThread(server, ports, idle_counts, clients,
+                             args["requests"].AsInteger()));
+    benchmark->Run();
+
+    server.Run();
+
+    benchmark->Join();
+    return 0;
+}
+
+
+END_NCBI_SCOPE
+
+
+USING_NCBI_SCOPE;
+
+
+int main(int argc, const char* argv[])
+{
+    return CServerScaleTestApp().AppMain(argc, argv);
+}
@@ -453,6 +453,10 @@ string NCBI_XNCBI_EXPORT g_GetConfigString(const char* section,
     return dvalue;
 }
 
+
+CAtomicCounter CParamBase::sm_CacheEpoch;
+
+
 const char* CParamException::GetErrCodeString(void) const
 {
     switch (GetErrCode()) {
@@ -0,0 +1,429 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Allocator of small memory blocks with size classes, per-thread caches
+ *   of free blocks and central slabs shared by all threads.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbi_slab_alloc.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbimtx.hpp>
+#include <corelib/ncbicntr.hpp>
+#include <corelib/error_codes.hpp>
+#include <stdlib.h>
+
+#define NCBI_USE_ERRCODE_X   Corelib_Object
+
+
+BEGIN_NCBI_SCOPE
+
+
+#ifdef _DEBUG
+# define SlabFatal Fatal
+#else
+# define SlabFatal Critical
+#endif
+
+
+/// Header of each memory block given out by the allocator.
+/// Its size is 16 bytes to keep user memory aligned as well as memory
+/// returned by malloc().
+union USlabBlockHeader {
+    struct {
+        /// Size class of the block or kHeapSizeClass
+        Uint4              size_class;
+        /// Magic value to check validity of the block
+        Uint4              magic;
+        /// Next block in the list of free blocks
+        USlabBlockHeader*  next;
+    }                      info;
+    Uint8                  align[2];
+};
+
+/// Magic value of allocated block
+static const Uint4 kMagicAllocated = 0x51ab0a11;
+/// Magic value of free block
+static const Uint4 kMagicFree      = 0x51abf3ee;
+
+/// Size class number for blocks allocated in system heap
+static const Uint4 kHeapSizeClass = 0xffffffff;
+
+/// Size of one slab cut into blocks of the same size class
+static const size_t kSlabSize = 64 * 1024;
+
+/// Number of size classes with step 16 (block sizes from 32 to 128)
+static const unsigned int kLinearClassesCount = 7;
+/// Biggest block size (including header) served from slabs
+static const size_t kMaxSlabBlockSize = 2048;
+/// Total number of size classes. Above 128 bytes there are 4 classes
+/// for each power of 2: 160, 192, 224, 256, 320, ..., 2048.
+static const unsigned int kSizeClassesCount = kLinearClassesCount + 4 * 4;
+
+
+/// Get size class for the block of given size (including header)
+static inline unsigned int s_GetSizeClass(size_t size)
+{
+    _ASSERT(size > 0  &&  size <= kMaxSlabBlockSize);
+    if ( size <= 128 ) {
+        return size <= 32? 0: (unsigned int)((size + 15) / 16) - 2;
+    }
+    size_t x = size - 1;
+    unsigned int bit = 7;
+    while ( (x >> (bit + 1)) != 0 ) {
+        ++bit;
+    }
+    return kLinearClassesCount + 4 * (bit - 7)
+           + (unsigned int)((x >> (bit - 2)) & 3);
+}
+
+/// Get size of blocks (including header) in the given size class
+static inline size_t s_GetClassBlockSize(unsigned int size_class)
+{
+    if ( size_class < kLinearClassesCount ) {
+        return 32 + 16 * size_class;
+    }
+    size_class -= kLinearClassesCount;
+    unsigned int bit = 7 + size_class / 4;
+    return (size_t(1) << bit) + (size_t(1) << (bit - 2)) * (size_class%4 + 1);
+}
+
+/// Get number of blocks moved between thread's and central lists at once
+static inline unsigned int s_GetBatchSize(unsigned int size_class)
+{
+    size_t batch = 8192 / s_GetClassBlockSize(size_class);
+    return (unsigned int)max(size_t(4), min(size_t(64), batch));
+}
+
+
+/// Central storage of free blocks of one size class
+struct SSlabCentralList
+{
+    SSlabCentralList(void)
+        : free_list(0), free_count(0), slab_cur(0), slab_end(0)
+    {}
+
+    /// Lock guarding all list data
+    CFastMutex         lock;
+    /// List of free blocks
+    USlabBlockHeader*  free_list;
+    /// Number of blocks in free_list
+    size_t             free_count;
+    /// Free space in the last slab that wasn't cut into blocks yet
+    char*              slab_cur;
+    char*              slab_end;
+};
+
+/// Thread's cache of free blocks
+struct SSlabThreadCache
+{
+    SSlabThreadCache(void)
+    {
+        for (unsigned int i = 0; i < kSizeClassesCount; ++i) {
+            free_list[i] = 0;
+            free_count[i] = 0;
+        }
+    }
+
+    USlabBlockHeader*  free_list [kSizeClassesCount];
+    unsigned int       free_count[kSizeClassesCount];
+};
+
+
+static SSlabCentralList* volatile s_CentralLists = 0;
+// Zero-initialized without constructor, can be used before static
+// constructors are run.
+static CAtomicCounter s_SlabsCount;
+
+
+static SSlabCentralList* s_GetCentralLists(void)
+{
+    SSlabCentralList* lists = s_CentralLists;
+    if ( !lists ) {
+        DEFINE_STATIC_FAST_MUTEX(s_InitMutex);
+        CFastMutexGuard guard(s_InitMutex);
+        lists = s_CentralLists;
+        if ( !lists ) {
+            // Never deleted - blocks can be freed at any moment
+            // including static destruction.
+            lists = new SSlabCentralList[kSizeClassesCount];
+            s_CentralLists = lists;
+        }
+    }
+    return lists;
+}
+
+
+/// Take up to 'count' free blocks of the size class from central list
+/// cutting new slab if necessary. Returns number of blocks taken.
+static unsigned int s_TakeFromCentral(unsigned int        size_class,
+                                      unsigned int        count,
+                                      USlabBlockHeader**  list)
+{
+    SSlabCentralList& central = s_GetCentralLists()[size_class];
+    size_t block_size = s_GetClassBlockSize(size_class);
+    unsigned int taken = 0;
+
+    CFastMutexGuard guard(central.lock);
+    while ( taken < count ) {
+        USlabBlockHeader* block = central.free_list;
+        if ( block ) {
+            central.free_list = block->info.next;
+            --central.free_count;
+        }
+        else {
+            if ( size_t(central.slab_end - central.slab_cur) < block_size ) {
+                char* slab = (char*)malloc(kSlabSize);
+                if ( !slab ) {
+                    break;
+                }
+                s_SlabsCount.Add(1);
+                central.slab_cur = slab;
+                central.slab_end = slab + kSlabSize;
+            }
+            block = reinterpret_cast<USlabBlockHeader*>(central.slab_cur);
+            central.slab_cur += block_size;
+            block->info.size_class = size_class;
+        }
+        block->info.next = *list;
+        *list = block;
+        ++taken;
+    }
+    return taken;
+}
+
+/// Put 'count' blocks from the list into the central list
+static void s_ReturnToCentral(unsigned int       size_class,
+                              unsigned int       count,
+                              USlabBlockHeader*  list)
+{
+    if ( !count ) {
+        return;
+    }
+    USlabBlockHeader* last = list;
+    for (unsigned int i = 1; i < count; ++i) {
+        last = last->info.next;
+    }
+
+    SSlabCentralList& central = s_GetCentralLists()[size_class];
+    CFastMutexGuard guard(central.lock);
+    last->info.next = central.free_list;
+    central.free_list = list;
+    central.free_count += count;
+}
+
+static void s_ReleaseThreadCache(SSlabThreadCache* cache)
+{
+    for (unsigned int i = 0; i < kSizeClassesCount; ++i) {
+        s_ReturnToCentral(i, cache->free_count[i], cache->free_list[i]);
+        cache->free_list[i] = 0;
+        cache->free_count[i] = 0;
+    }
+}
+
+
+// Thread's cache is found via fast TLS variable, cleanup on thread exit
+// is done via TLS key with destructor.
+static DECLARE_TLS_VAR(SSlabThreadCache*, s_ThreadCache);
+// Set when thread's cache is already destroyed, so that blocks allocated
+// or freed after that go directly to central lists.
+static DECLARE_TLS_VAR(bool, s_ThreadCacheDestroyed);
+#ifdef NCBI_NO_THREADS
+static SSlabThreadCache s_SingleThreadCache;
+#else
+static TTlsKey s_ThreadCache_key;
+#endif
+
+#ifdef NCBI_POSIX_THREADS
+static
+void sx_DestroyThreadCache(void* ptr)
+{
+    SSlabThreadCache* cache = static_cast<SSlabThreadCache*>(ptr);
+    s_ReleaseThreadCache(cache);
+    s_ThreadCache = 0;
+    s_ThreadCacheDestroyed = true;
+    delete cache;
+}
+#endif
+
+static
+SSlabThreadCache* sx_CreateThreadCache(void)
+{
+#ifdef NCBI_NO_THREADS
+    s_ThreadCache = &s_SingleThreadCache;
+#else
+    if ( !s_ThreadCache_key ) {
+        DEFINE_STATIC_FAST_MUTEX(s_InitMutex);
+        NCBI_NS_NCBI::CFastMutexGuard guard(s_InitMutex);
+        if ( !s_ThreadCache_key ) {
+            TTlsKey key = 0;
+            do {
+#  ifdef NCBI_WIN32_THREADS
+                _VERIFY((key = TlsAlloc()) != DWORD(-1));
+#  else
+                _VERIFY(pthread_key_create(&key, sx_DestroyThreadCache)==0);
+#  endif
+            } while ( !key );
+            s_ThreadCache_key = key;
+        }
+    }
+    SSlabThreadCache* cache = new SSlabThreadCache();
+#  ifdef NCBI_WIN32_THREADS
+    TlsSetValue(s_ThreadCache_key, cache);
+#  else
+    pthread_setspecific(s_ThreadCache_key, cache);
+#  endif
+    s_ThreadCache = cache;
+#endif
+    return s_ThreadCache;
+}
+
+static inline
+SSlabThreadCache* sx_GetThreadCache(void)
+{
+    SSlabThreadCache* cache = s_ThreadCache;
+    if ( !cache  &&  !s_ThreadCacheDestroyed ) {
+        cache = sx_CreateThreadCache();
+    }
+    return cache;
+}
+
+
+void* CSlabAllocator::Allocate(size_t size)
+{
+    size_t full_size = size + sizeof(USlabBlockHeader);
+    USlabBlockHeader* block;
+    if ( full_size > kMaxSlabBlockSize ) {
+        block = static_cast<USlabBlockHeader*>(::operator new(full_size));
+        block->info.size_class = kHeapSizeClass;
+    }
+    else {
+        unsigned int size_class = s_GetSizeClass(full_size);
+        SSlabThreadCache* cache = sx_GetThreadCache();
+        if ( !cache ) {
+            block = 0;
+            if ( !s_TakeFromCentral(size_class, 1, &block) ) {
+                throw bad_alloc();
+            }
+        }
+        else {
+            block = cache->free_list[size_class];
+            if ( !block ) {
+                cache->free_count[size_class] =
+                    s_TakeFromCentral(size_class, s_GetBatchSize(size_class),
+                                      &cache->free_list[size_class]);
+                block = cache->free_list[size_class];
+                if ( !block ) {
+                    throw bad_alloc();
+                }
+            }
+            cache->free_list[size_class] = block->info.next;
+            --cache->free_count[size_class];
+        }
+        _ASSERT(block->info.size_class == size_class);
+    }
+    block->info.magic = kMagicAllocated;
+    block->info.next = 0;
+    return block + 1;
+}
+
+
+void CSlabAllocator::Deallocate(void* ptr)
+{
+    if ( !ptr ) {
+        return;
+    }
+    USlabBlockHeader* block = static_cast<USlabBlockHeader*>(ptr) - 1;
+    if ( block->info.magic != kMagicAllocated ) {
+        if ( block->info.magic == kMagicFree ) {
+            ERR_POST_X(16, SlabFatal << "CSlabAllocator::Deallocate: "
+                           "memory block is already freed");
+        }
+        else {
+            ERR_POST_X(16, SlabFatal << "CSlabAllocator::Deallocate: "
+                           "bad memory block header");
+        }
+        return;
+    }
+    block->info.magic = kMagicFree;
+
+    unsigned int size_class = block->info.size_class;
+    if ( size_class == kHeapSizeClass ) {
+        ::operator delete(block);
+        return;
+    }
+    _ASSERT(size_class < kSizeClassesCount);
+
+    SSlabThreadCache* cache = sx_GetThreadCache();
+    if ( !cache ) {
+        block->info.next = 0;
+        s_ReturnToCentral(size_class, 1, block);
+        return;
+    }
+    block->info.next = cache->free_list[size_class];
+    cache->free_list[size_class] = block;
+    unsigned int batch = s_GetBatchSize(size_class);
+    if ( ++cache->free_count[size_class] > 2 * batch ) {
+        // Keep the most recently freed blocks which are likely to be still
+        // in CPU cache, return the rest.
+        USlabBlockHeader* last = cache->free_list[size_class];
+        for (unsigned int i = 1; i < batch; ++i) {
+            last = last->info.next;
+        }
+        USlabBlockHeader* list = last->info.next;
+        last->info.next = 0;
+        unsigned int count = cache->free_count[size_class] - batch;
+        cache->free_count[size_class] = batch;
+        s_ReturnToCentral(size_class, count, list);
+    }
+}
+
+
+size_t CSlabAllocator::GetMaxBlockSize(void)
+{
+    return kMaxSlabBlockSize - sizeof(USlabBlockHeader);
+}
+
+
+void CSlabAllocator::ReleaseThreadCache(void)
+{
+    SSlabThreadCache* cache = s_ThreadCache;
+    if ( cache ) {
+        s_ReleaseThreadCache(cache);
+    }
+}
+
+
+size_t CSlabAllocator::GetSlabsCount(void)
+{
+    return s_SlabsCount.Get();
+}
+
+
+END_NCBI_SCOPE
@@ -6398,11 +6398,146 @@ void CFileDiagHandler::WriteMessage(const char*   buf,
 struct SAsyncDiagMessage
 {
     SAsyncDiagMessage(void)
-        : m_Message(0), m_Composed(0), m_FileType(eDiagFile_All) {}
+        : m_Message(0), m_Composed(0), m_FileType(eDiagFile_All),
+          m_Time(0) {}
 
     SDiagMessage* m_Message;
     string*       m_Composed;
     EDiagFileType m_FileType;
+    double        m_Time;      ///< Posting time used to restore the order
+};
+
+
+/// Ordering of messages collected from different threads' rings.
+struct SAsyncDiagMessage_Less
+{
+    bool operator()(const SAsyncDiagMessage& m1,
+                    const SAsyncDiagMessage& m2) const
+    {
+        return m1.m_Time < m2.m_Time;
+    }
+};
+
+
+/// Full memory barrier. CAtomicCounter::Get() is a plain volatile load,
+/// so accesses to the ring slots must be ordered explicitly against the
+/// counters.
+static inline void s_AsyncDiagMemoryBarrier(void)
+{
+#if defined(NCBI_COMPILER_MSVC)
+    MemoryBarrier();
+#elif defined(NCBI_COMPILER_GCC)  ||  defined(NCBI_COMPILER_ICC)  \
+    ||  defined(NCBI_COMPILER_ANY_CLANG)
+    __sync_synchronize();
+#else
+    // Locking a mutex implies a full barrier.
+    DEFINE_STATIC_FAST_MUTEX(s_BarrierMutex);
+    CFastMutexGuard guard(s_BarrierMutex);
+#endif
+}
+
+
+/// Condition the async diag thread and the posting threads wait on.
+/// Where condition variables are not available the waiting falls back
+/// to polling.
+class CAsyncDiagCondition
+{
+public:
+    /// Wait for a signal with 'mutex' locked by the calling thread.
+    void Wait(CFastMutex& mutex, unsigned int timeout_ms)
+    {
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+        m_Cond.WaitForSignal(mutex, CDeadline(timeout_ms / 1000,
+            (timeout_ms % 1000) * (kNanoSecondsPerSecond / 1000)));
+#else
+        mutex.Unlock();
+        SleepMilliSec(timeout_ms);
+        mutex.Lock();
+#endif
+    }
+
+    /// Wake all waiting threads.
+    void SignalAll(void)
+    {
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+        m_Cond.SignalAll();
+#endif
+    }
+
+private:
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    CConditionVariable m_Cond;
+#endif
+};
+
+
+/// Bounded single-producer/single-consumer ring of messages posted by
+/// one thread. Only the owning thread pushes, only the dedicated
+/// async thread pops, so no locks are needed. m_Tail and m_Head count
+/// all messages pushed and popped so far.
+struct SAsyncDiagRing : public CObject
+{
+    SAsyncDiagRing(size_t capacity, Uint4 generation)
+        : m_Slots(capacity ? capacity : 1),
+          m_Generation(generation),
+          m_Overflows(0),
+          m_Abandoned(false)
+    {
+        m_Head.Set(0);
+        m_Tail.Set(0);
+        m_Lost.Set(0);
+    }
+
+    bool Push(const SAsyncDiagMessage& msg)
+    {
+        CAtomicCounter::TValue tail = m_Tail.Get();
+        if (tail - m_Head.Get() >= m_Slots.size()) {
+            return false;
+        }
+        // Do not overwrite the slot before the consumer is done with it.
+        s_AsyncDiagMemoryBarrier();
+        m_Slots[tail % m_Slots.size()] = msg;
+        // Make the slot visible before publishing it to the consumer.
+        s_AsyncDiagMemoryBarrier();
+        m_Tail.Add(1);
+        return true;
+    }
+
+    bool Pop(SAsyncDiagMessage& msg)
+    {
+        CAtomicCounter::TValue head = m_Head.Get();
+        if (head == m_Tail.Get()) {
+            return false;
+        }
+        // Do not read the slot before the producer has published it.
+        s_AsyncDiagMemoryBarrier();
+        msg = m_Slots[head % m_Slots.size()];
+        // Finish reading the slot before releasing it to the producer.
+        s_AsyncDiagMemoryBarrier();
+        m_Head.Add(1);
+        return true;
+    }
+
+    bool IsEmpty(void) const
+    {
+        return m_Head.Get() == m_Tail.Get();
+    }
+
+    Uint8 GetPostedCount(void) const
+    {
+        return Uint8(m_Tail.Get()) + Uint8(m_Lost.Get());
+    }
+
+    vector<SAsyncDiagMessage> m_Slots;
+    CAtomicCounter m_Head;
+    CAtomicCounter m_Tail;
+    CAtomicCounter m_Lost;
+    /// Generation of the async thread this ring is registered with.
+    Uint4 m_Generation;
+    /// Number of overflows seen by the producer (used for sampling).
+    Uint8 m_Overflows;
+    /// Set when the producing thread has terminated.
+    volatile bool m_Abandoned;
 };
 
 
@@ -6415,33 +6550,130 @@ public:
     virtual void* Main(void);
     void Stop(void);
 
-    bool m_NeedStop;
-    Uint2 m_CntWaiters;
-    CAtomicCounter m_MsgsInQueue;
+    /// Get the ring of the current thread, register a new one if necessary.
+    SAsyncDiagRing* GetThreadRing(void);
+    /// Wake up the dedicated thread if it's waiting for new messages.
+    /// Only the first call after the thread went to sleep signals it.
+    void WakeUp(void)
+    {
+        // Order the ring update before reading the sleeping flag.
+        s_AsyncDiagMemoryBarrier();
+        if (m_Sleeping.Get() != 0) {
+            CFastMutexGuard guard(m_WakeLock);
+            if ( !m_WakeRequested ) {
+                m_WakeRequested = true;
+                m_QueueCond.SignalAll();
+            }
+        }
+    }
+    void GetCounts(Uint8* posted, Uint8* lost);
+
+    volatile bool m_NeedStop;
+    CAtomicCounter m_CntWaiters;
+    CAtomicCounter m_Sleeping;
     CDiagHandler* m_SubHandler;
-    CFastMutex m_QueueLock;
-#ifdef NCBI_HAVE_CONDITIONAL_VARIABLE
-    CConditionVariable m_QueueCond;
-    CConditionVariable m_DequeueCond;
-#else
-    CSemaphore m_QueueSem;
-    CSemaphore m_DequeueSem;
-#endif
-    deque<SAsyncDiagMessage> m_MsgQueue;
+    CAsyncDiagHandler::EOverflowPolicy m_OverflowPolicy;
+    Uint4 m_SampleRate;
+    /// Protects m_WakeRequested, used with both conditions.
+    CFastMutex m_WakeLock;
+    /// Set by the first wake-up since the dedicated thread went to sleep.
+    bool m_WakeRequested;
+    /// Signalled when there are new messages to process.
+    CAsyncDiagCondition m_QueueCond;
+    /// Signalled when the rings have been drained.
+    CAsyncDiagCondition m_DequeueCond;
     string m_ThreadSuffix;
+    /// Common clock for time marks of messages from all threads.
+    CStopWatch m_Clock;
+
+private:
+    /// Move all available messages from the rings to the batch, forget
+    /// rings of terminated threads.
+    void x_CollectMessages(vector<SAsyncDiagMessage>& batch);
+    /// Let posting threads blocked on full rings retry.
+    void x_SignalDequeue(void);
+
+    typedef vector< CRef<SAsyncDiagRing> > TRings;
+
+    Uint4 m_Generation;
+    size_t m_RingSize;
+    CFastMutex m_RingsLock;
+    TRings m_Rings;
+    Uint8 m_RetiredPosted;
+    Uint8 m_RetiredLost;
 };
 
 
-/// Maximum number of messages that allowed to be in the queue for
-/// asynchronous processing.
+/// Number of messages each posting thread can have waiting for the
+/// asynchronous processing. Zero means the default (1024).
+NCBI_PARAM_DECL(Uint4, Diag, Async_Ring_Size);
+NCBI_PARAM_DEF_EX(Uint4, Diag, Async_Ring_Size, 0, eParam_NoThread,
+                  DIAG_ASYNC_RING_SIZE);
+typedef NCBI_PARAM_TYPE(Diag, Async_Ring_Size) TAsyncRingSizeParam;
+
+/// Obsolete size of the queue shared by all threads. Used as the size
+/// of each thread's ring if Async_Ring_Size is not set.
 NCBI_PARAM_DECL(Uint4, Diag, Max_Async_Queue_Size);
-NCBI_PARAM_DEF_EX(Uint4, Diag, Max_Async_Queue_Size, 10000, eParam_NoThread,
+NCBI_PARAM_DEF_EX(Uint4, Diag, Max_Async_Queue_Size, 0, eParam_NoThread,
                   DIAG_MAX_ASYNC_QUEUE_SIZE);
 typedef NCBI_PARAM_TYPE(Diag, Max_Async_Queue_Size) TMaxAsyncQueueSizeParam;
 
+static const Uint4 kDefaultAsyncRingSize = 1024;
+
+static size_t s_GetAsyncRingSize(void)
+{
+    Uint4 size = TAsyncRingSizeParam::GetDefault();
+    Uint4 queue_size = TMaxAsyncQueueSizeParam::GetDefault();
+    if ( queue_size ) {
+        ERR_POST_X_ONCE(31, Warning <<
+                        "[Diag] Max_Async_Queue_Size is obsolete, "
+                        "use [Diag] Async_Ring_Size (per thread) instead");
+        if ( !size ) {
+            size = queue_size;
+        }
+    }
+    return size ? size : kDefaultAsyncRingSize;
+}
+
+/// What to do with messages posted while the thread's ring is full.
+NCBI_PARAM_ENUM_DECL(CAsyncDiagHandler::EOverflowPolicy,
+                     Diag, Async_Overflow_Policy);
+NCBI_PARAM_ENUM_ARRAY(CAsyncDiagHandler::EOverflowPolicy,
+                      Diag, Async_Overflow_Policy)
+{
+    {"Block", CAsyncDiagHandler::eOverflow_Block},
+    {"Drop", CAsyncDiagHandler::eOverflow_Drop},
+    {"Sample", CAsyncDiagHandler::eOverflow_Sample}
+};
+NCBI_PARAM_ENUM_DEF_EX(CAsyncDiagHandler::EOverflowPolicy,
+                       Diag, Async_Overflow_Policy,
+                       CAsyncDiagHandler::eOverflow_Block,
+                       eParam_NoThread, DIAG_ASYNC_OVERFLOW_POLICY);
+typedef NCBI_PARAM_TYPE(Diag, Async_Overflow_Policy) TAsyncOverflowPolicyParam;
+
+/// With "Sample" overflow policy keep one of this many overflowing messages.
+NCBI_PARAM_DECL(Uint4, Diag, Async_Overflow_Sample_Rate);
+NCBI_PARAM_DEF_EX(Uint4, Diag, Async_Overflow_Sample_Rate, 100,
+                  eParam_NoThread, DIAG_ASYNC_OVERFLOW_SAMPLE_RATE);
+typedef NCBI_PARAM_TYPE(Diag, Async_Overflow_Sample_Rate)
+    TAsyncOverflowSampleRateParam;
+
+
+static void s_ReleaseAsyncDiagRing(SAsyncDiagRing* ring, void* /*data*/)
+{
+    ring->m_Abandoned = true;
+    ring->RemoveReference();
+}
+
+static CStaticTls<SAsyncDiagRing> s_AsyncDiagRing;
+static CAtomicCounter_WithAutoInit s_AsyncDiagGeneration;
+
 
 CAsyncDiagHandler::CAsyncDiagHandler(void)
-    : m_AsyncThread(NULL)
+    : m_AsyncThread(NULL),
+      m_OverflowPolicy(eOverflow_Default),
+      m_PostedCount(0),
+      m_LostCount(0)
 {}
 
 CAsyncDiagHandler::~CAsyncDiagHandler(void)
@@ -6455,11 +6687,20 @@ CAsyncDiagHandler::SetCustomThreadSuffix(const string& suffix)
     m_ThreadSuffix = suffix;
 }
 
+void
+CAsyncDiagHandler::SetOverflowPolicy(EOverflowPolicy policy)
+{
+    m_OverflowPolicy = policy;
+}
+
 void
 CAsyncDiagHandler::InstallToDiag(void)
 {
     m_AsyncThread = new CAsyncDiagThread(m_ThreadSuffix);
     m_AsyncThread->AddReference();
+    if (m_OverflowPolicy != eOverflow_Default) {
+        m_AsyncThread->m_OverflowPolicy = m_OverflowPolicy;
+    }
     try {
         m_AsyncThread->Run();
     }
@@ -6481,8 +6722,36 @@ CAsyncDiagHandler::RemoveFromDiag(void)
     _ASSERT(GetDiagHandler(false) == this);
     SetDiagHandler(m_AsyncThread->m_SubHandler);
     m_AsyncThread->Stop();
+    m_AsyncThread->GetCounts(&m_PostedCount, &m_LostCount);
     m_AsyncThread->RemoveReference();
     m_AsyncThread = NULL;
+    if (m_LostCount != 0) {
+        ERR_POST_X(30, Warning << "Asynchronous diagnostics lost "
+                   << m_LostCount << " of " << m_PostedCount
+                   << " messages because of queue overflow");
+    }
+}
+
+Uint8
+CAsyncDiagHandler::GetPostedCount(void) const
+{
+    if ( !m_AsyncThread ) {
+        return m_PostedCount;
+    }
+    Uint8 posted = 0, lost = 0;
+    m_AsyncThread->GetCounts(&posted, &lost);
+    return posted;
+}
+
+Uint8
+CAsyncDiagHandler::GetLostCount(void) const
+{
+    if ( !m_AsyncThread ) {
+        return m_LostCount;
+    }
+    Uint8 posted = 0, lost = 0;
+    m_AsyncThread->GetCounts(&posted, &lost);
+    return lost;
 }
 
 string
@@ -6501,7 +6770,35 @@ void
 CAsyncDiagHandler::Post(const SDiagMessage& mess)
 {
     CAsyncDiagThread* thr = m_AsyncThread;
+    if (mess.m_Severity >= GetDiagDieLevel()) {
+        thr->Stop();
+        thr->m_SubHandler->Post(mess);
+        return;
+    }
+
+    SAsyncDiagRing* ring = thr->GetThreadRing();
+    bool must_wait = true;
+    if (ring->m_Slots.size() - (ring->m_Tail.Get() - ring->m_Head.Get()) == 0
+        &&  CompareDiagPostLevel(mess.m_Severity, eDiag_Critical) < 0) {
+        // The ring is full, apply overflow policy.
+        switch ( thr->m_OverflowPolicy ) {
+        case eOverflow_Drop:
+            must_wait = false;
+            break;
+        case eOverflow_Sample:
+            must_wait = ++ring->m_Overflows % thr->m_SampleRate == 0;
+            break;
+        default:
+            break;
+        }
+        if ( !must_wait ) {
+            ring->m_Lost.Add(1);
+            return;
+        }
+    }
+
     SAsyncDiagMessage async;
+    async.m_Time = thr->m_Clock.Elapsed();
     if (thr->m_SubHandler->AllowAsyncWrite(mess)) {
         async.m_Composed = new string(thr->m_SubHandler->
             ComposeMessage(mess, &async.m_FileType));
@@ -6510,54 +6807,143 @@ CAsyncDiagHandler::Post(const SDiagMessage& mess)
         async.m_Message = new SDiagMessage(mess);
     }
 
-    static CSafeStatic<TMaxAsyncQueueSizeParam> s_MaxAsyncQueueSizeParam;
-    if (mess.m_Severity < GetDiagDieLevel()) {
-        CFastMutexGuard guard(thr->m_QueueLock);
-        while (Uint4(thr->m_MsgsInQueue.Get()) >= s_MaxAsyncQueueSizeParam->Get())
-        {
-            ++thr->m_CntWaiters;
-#ifdef NCBI_HAVE_CONDITIONAL_VARIABLE
-            thr->m_DequeueCond.WaitForSignal(thr->m_QueueLock);
-#else
-            guard.Release();
-            thr->m_QueueSem.Wait();
-            guard.Guard(thr->m_QueueLock);
-#endif
-            --thr->m_CntWaiters;
-        }
-        thr->m_MsgQueue.push_back(async);
-        if (thr->m_MsgsInQueue.Add(1) == 1) {
-#ifdef NCBI_HAVE_CONDITIONAL_VARIABLE
-            thr->m_QueueCond.SignalSome();
-#else
-            thr->m_QueueSem.Post();
-#endif
+    if ( !ring->Push(async) ) {
+        // The ring is full, wait until the dedicated thread drains it.
+        thr->m_CntWaiters.Add(1);
+        thr->WakeUp();
+        bool pushed;
+        {{
+            CFastMutexGuard guard(thr->m_WakeLock);
+            while ( !(pushed = ring->Push(async))  &&  !thr->m_NeedStop ) {
+                thr->m_DequeueCond.Wait(thr->m_WakeLock, 10);
+            }
+        }}
+        thr->m_CntWaiters.Add(-1);
+        if ( !pushed ) {
+            // The dedicated thread is gone, nobody will drain the ring.
+            if ( async.m_Composed ) {
+                thr->m_SubHandler->WriteMessage(async.m_Composed->data(),
+                    async.m_Composed->size(), async.m_FileType);
+                delete async.m_Composed;
+            }
+            else {
+                thr->m_SubHandler->Post(*async.m_Message);
+                delete async.m_Message;
+            }
+            return;
         }
     }
-    else {
-        thr->Stop();
-        thr->m_SubHandler->Post(mess);
-    }
+    thr->WakeUp();
 }
 
 
 CAsyncDiagThread::CAsyncDiagThread(const string& thread_suffix)
     : m_NeedStop(false),
-      m_CntWaiters(0),
       m_SubHandler(NULL),
-#ifndef NCBI_HAVE_CONDITIONAL_VARIABLE
-      m_QueueSem(0, 100),
-      m_DequeueSem(0, 10000000),
-#endif
-      m_ThreadSuffix(thread_suffix)
+      m_OverflowPolicy(TAsyncOverflowPolicyParam::GetDefault()),
+      m_SampleRate(TAsyncOverflowSampleRateParam::GetDefault()),
+      m_WakeRequested(false),
+      m_ThreadSuffix(thread_suffix),
+      m_Clock(CStopWatch::eStart),
+      m_Generation(Uint4(s_AsyncDiagGeneration.Add(1))),
+      m_RingSize(s_GetAsyncRingSize()),
+      m_RetiredPosted(0),
+      m_RetiredLost(0)
 {
-    m_MsgsInQueue.Set(0);
+    m_CntWaiters.Set(0);
+    m_Sleeping.Set(0);
+    if ( !m_SampleRate ) {
+        m_SampleRate = 1;
+    }
 }
 
 CAsyncDiagThread::~CAsyncDiagThread(void)
 {}
 
 
+SAsyncDiagRing*
+CAsyncDiagThread::GetThreadRing(void)
+{
+    SAsyncDiagRing* ring = s_AsyncDiagRing.GetValue();
+    if (ring  &&  ring->m_Generation == m_Generation) {
+        return ring;
+    }
+    // First message from this thread since the handler was installed.
+    ring = new SAsyncDiagRing(m_RingSize, m_Generation);
+    ring->AddReference();
+    {{
+        CFastMutexGuard guard(m_RingsLock);
+        m_Rings.push_back(CRef<SAsyncDiagRing>(ring));
+    }}
+    s_AsyncDiagRing.SetValue(ring, s_ReleaseAsyncDiagRing);
+    return ring;
+}
+
+
+void
+CAsyncDiagThread::GetCounts(Uint8* posted, Uint8* lost)
+{
+    CFastMutexGuard guard(m_RingsLock);
+    *posted = m_RetiredPosted;
+    *lost = m_RetiredLost;
+    ITERATE(TRings, it, m_Rings) {
+        *posted += (*it)->GetPostedCount();
+        *lost += (*it)->m_Lost.Get();
+    }
+}
+
+
+void
+CAsyncDiagThread::x_SignalDequeue(void)
+{
+    // Order draining of the rings before reading the waiters counter.
+    s_AsyncDiagMemoryBarrier();
+    if (m_CntWaiters.Get() != 0) {
+        CFastMutexGuard guard(m_WakeLock);
+        m_DequeueCond.SignalAll();
+    }
+}
+
+
+void
+CAsyncDiagThread::x_CollectMessages(vector<SAsyncDiagMessage>& batch)
+{
+    CFastMutexGuard guard(m_RingsLock);
+    size_t rings_count = m_Rings.size();
+    for (size_t i = 0; i < rings_count; ) {
+        SAsyncDiagRing& ring = *m_Rings[i];
+        // Read the flag before draining so that no message of
+        // a terminated thread can be left behind.
+        bool abandoned = ring.m_Abandoned;
+        size_t first = batch.size();
+        SAsyncDiagMessage msg;
+        while ( ring.Pop(msg) ) {
+            batch.push_back(msg);
+        }
+        if (batch.size() - first > 1) {
+            // Messages from the same thread may have equal time marks,
+            // keep them in the order of posting.
+            for (size_t j = first + 1; j < batch.size(); ++j) {
+                if (batch[j].m_Time < batch[j - 1].m_Time) {
+                    batch[j].m_Time = batch[j - 1].m_Time;
+                }
+            }
+        }
+        if (abandoned  &&  ring.IsEmpty()) {
+            m_RetiredPosted += ring.GetPostedCount();
+            m_RetiredLost += ring.m_Lost.Get();
+            m_Rings[i] = m_Rings[--rings_count];
+            m_Rings.pop_back();
+            continue;
+        }
+        ++i;
+    }
+    guard.Release();
+    // Restore the global order of posting.
+    stable_sort(batch.begin(), batch.end(), SAsyncDiagMessage_Less());
+}
+
+
 NCBI_PARAM_DECL(size_t, Diag, Async_Buffer_Size);
 NCBI_PARAM_DEF_EX(size_t, Diag, Async_Buffer_Size, 32768,
     eParam_NoThread, DIAG_ASYNC_BUFFER_SIZE);
@@ -6644,29 +7030,46 @@ CAsyncDiagThread::Main(void)
         buffers[i] = 0;
     }
 
-    deque<SAsyncDiagMessage> save_msgs;
-    while (!m_NeedStop) {
-        {{
-            CFastMutexGuard guard(m_QueueLock);
-            while (m_MsgQueue.size() == 0  &&  !m_NeedStop) {
-                if (m_MsgsInQueue.Get() != 0)
-                    abort();
-#ifdef NCBI_HAVE_CONDITIONAL_VARIABLE
-                m_QueueCond.WaitForSignal(m_QueueLock);
-#else
-                guard.Release();
-                m_QueueSem.Wait();
-                guard.Guard(m_QueueLock);
-#endif
+    vector<SAsyncDiagMessage> save_msgs;
+    bool last_pass = false;
+    for (;;) {
+        save_msgs.clear();
+        x_CollectMessages(save_msgs);
+        if ( !save_msgs.empty() ) {
+            x_SignalDequeue();
+        }
+        else {
+            if ( last_pass ) {
+                break;
             }
-            save_msgs.swap(m_MsgQueue);
-        }}
+            if ( m_NeedStop ) {
+                // Make one more pass to pick up messages posted while
+                // the stop was requested.
+                last_pass = true;
+                continue;
+            }
+            // Announce that we are going to sleep before re-checking
+            // the rings, so that no wake-up can be missed.
+            m_Sleeping.Add(1);
+            s_AsyncDiagMemoryBarrier();
+            x_CollectMessages(save_msgs);
+            if ( save_msgs.empty() ) {
+                CFastMutexGuard guard(m_WakeLock);
+                if ( !m_WakeRequested  &&  !m_NeedStop ) {
+                    m_QueueCond.Wait(m_WakeLock, 100);
+                }
+                m_WakeRequested = false;
+            }
+            m_Sleeping.Add(-1);
+            if ( save_msgs.empty() ) {
+                continue;
+            }
+            x_SignalDequeue();
+        }
 
-drain_messages:
         int queue_counter = 0;
-        while (!save_msgs.empty()) {
-            SAsyncDiagMessage msg = save_msgs.front();
-            save_msgs.pop_front();
+        ITERATE(vector<SAsyncDiagMessage>, it, save_msgs) {
+            const SAsyncDiagMessage& msg = *it;
             if ( msg.m_Composed ) {
                 SMessageBuffer* buf = buffers[msg.m_FileType];
                 if ( !buf ) {
@@ -6698,20 +7101,15 @@ drain_messages:
                 m_SubHandler->Post(*msg.m_Message);
                 delete msg.m_Message;
             }
-            if (++queue_counter >= batch_size  ||  save_msgs.empty()) {
-                m_MsgsInQueue.Add(-queue_counter);
+            if (++queue_counter >= batch_size) {
                 queue_counter = 0;
-                if (m_CntWaiters != 0) {
-#ifdef NCBI_HAVE_CONDITIONAL_VARIABLE
-                    m_DequeueCond.SignalSome();
-#else
-                    m_DequeueSem.Post();
-#endif
-                }
+                // The rings were drained already, let blocked threads
+                // know there's free space.
+                x_SignalDequeue();
             }
         }
         // Flush all buffers when the queue is empty and there are no waiters.
-        if (m_CntWaiters == 0) {
+        if (m_CntWaiters.Get() == 0) {
             for (size_t i = 0; i < buf_count; ++i) {
                 if ( !buffers[i] ) {
                     continue;
@@ -6724,10 +7122,6 @@ drain_messages:
             }
         }
     }
-    if (m_MsgQueue.size() != 0) {
-        save_msgs.swap(m_MsgQueue);
-        goto drain_messages;
-    }
 
     for (size_t i = 0; i < buf_count; ++i) {
         if ( !buffers[i] ) {
@@ -6746,13 +7140,14 @@ drain_messages:
 void
 CAsyncDiagThread::Stop(void)
 {
-    m_NeedStop = true;
-    try {
-#ifdef NCBI_HAVE_CONDITIONAL_VARIABLE
+    {{
+        CFastMutexGuard guard(m_WakeLock);
+        m_NeedStop = true;
+        m_WakeRequested = true;
         m_QueueCond.SignalAll();
-#else
-        m_QueueSem.Post(10);
-#endif
+        m_DequeueCond.SignalAll();
+    }}
+    try {
         Join();
     }
     catch (CException& ex) {
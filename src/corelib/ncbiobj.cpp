@@ -36,6 +36,7 @@
 #include <corelib/ncbimtx.hpp>
 #include <corelib/ncbi_param.hpp>
 #include <corelib/ncbimempool.hpp>
+#include <corelib/ncbi_slab_alloc.hpp>
 
 //#define USE_SINGLE_ALLOC
 //#define USE_DEBUG_NEW
@@ -434,6 +435,71 @@ static inline void sx_FillNewMemory(void* ptr, size_t size)
     }
 }
 
+#ifdef NCBI_OBJECT_SLAB_ALLOC
+# define OBJECT_SLAB_ALLOC_DEFAULT  true
+#else
+# define OBJECT_SLAB_ALLOC_DEFAULT  false
+#endif
+
+// 0 - not initialized yet, 1 - system heap, 2 - CSlabAllocator.
+// Must never change after the first allocation because memory has to be
+// freed by the same allocator.
+static volatile int s_ObjectAllocMode;
+
+static int sx_InitObjectAllocMode(void)
+{
+    bool use_slab = OBJECT_SLAB_ALLOC_DEFAULT;
+    const char* env = ::getenv("NCBI_OBJECT_SLAB_ALLOC");
+    if ( env && *env ) {
+        if ( NStr::CompareNocase(env, "1") == 0  ||
+             NStr::CompareNocase(env, "YES") == 0  ||
+             NStr::CompareNocase(env, "TRUE") == 0  ||
+             NStr::CompareNocase(env, "ON") == 0 )
+            use_slab = true;
+        else if ( NStr::CompareNocase(env, "0") == 0  ||
+                  NStr::CompareNocase(env, "NO") == 0  ||
+                  NStr::CompareNocase(env, "FALSE") == 0  ||
+                  NStr::CompareNocase(env, "OFF") == 0 )
+            use_slab = false;
+    }
+    // Threads racing here get the same value from the environment.
+    s_ObjectAllocMode = use_slab? 2: 1;
+    return s_ObjectAllocMode;
+}
+
+static inline bool sx_UseSlabAllocator(void)
+{
+    int mode = s_ObjectAllocMode;
+    if ( !mode ) {
+        mode = sx_InitObjectAllocMode();
+    }
+    return mode == 2;
+}
+
+static inline void* sx_AllocateObjectMemory(size_t size)
+{
+    return sx_UseSlabAllocator()? CSlabAllocator::Allocate(size):
+        ::operator new(size);
+}
+
+static inline void sx_FreeObjectMemory(void* ptr)
+{
+    _ASSERT(s_ObjectAllocMode);
+    if ( s_ObjectAllocMode == 2 ) {
+        CSlabAllocator::Deallocate(ptr);
+    }
+    else {
+        ::operator delete(ptr);
+    }
+}
+
+
+bool CSlabAllocator::IsUsedForObjects(void)
+{
+    return sx_UseSlabAllocator();
+}
+
+
 // CObject local new operator to mark allocation in heap
 void* CObject::operator new(size_t size)
 {
@@ -446,7 +512,7 @@ void* CObject::operator new(size_t size)
     //static_cast<CObject*>(ptr)->m_Counter.Set(0);
     return ptr;
 #else
-    void* ptr = ::operator new(size);
+    void* ptr = sx_AllocateObjectMemory(size);
 
 #if USE_TLS_PTR
     // just remember pointer in TLS
@@ -494,7 +560,7 @@ void CObject::operator delete(void* ptr)
     // 1. eMagicCounterDeleted when memory is freed after CObject destructor.
     // 2. eMagicCounterNew when memory is freed before CObject constructor.
     _ASSERT(magic == eMagicCounterDeleted  || magic == eMagicCounterNew);
-    ::operator delete(ptr);
+    sx_FreeObjectMemory(ptr);
 }
 
 
@@ -70,6 +70,166 @@ const wchar_t *const kEmptyWCStr = L"";
 #endif
 
 
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Vectorized primitives
+//
+//  SSE2 is a part of the base x86-64 instruction set, so it's used whenever
+//  the compiler targets it; other platforms use plain loops. Single-char
+//  searches go to memchr() whose library implementation usually selects
+//  the best instruction set at run time.
+
+#if defined(__SSE2__)  ||  defined(_M_X64)  || \
+    (defined(_M_IX86_FP)  &&  _M_IX86_FP >= 2)
+#  define NCBI_STR_USE_SSE2 1
+#  include <emmintrin.h>
+#  if defined(NCBI_COMPILER_MSVC)
+#    include <intrin.h>
+#  endif
+#endif
+
+
+#ifdef NCBI_STR_USE_SSE2
+
+// Index of the lowest set bit, mask must be non-zero
+static inline
+unsigned int s_LowestBit(unsigned int mask)
+{
+#  if defined(NCBI_COMPILER_MSVC)
+    unsigned long idx;
+    _BitScanForward(&idx, mask);
+    return (unsigned int) idx;
+#  elif defined(__GNUC__)
+    return (unsigned int) __builtin_ctz(mask);
+#  else
+    unsigned int idx = 0;
+    while ( !(mask & 1) ) {
+        mask >>= 1;
+        ++idx;
+    }
+    return idx;
+#  endif
+}
+
+// Bit mask of equal bytes in two 16-byte blocks
+static inline
+unsigned int s_EqualMask16(const char* s1, const char* s2)
+{
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s1));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s2));
+    return (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+}
+
+#endif // NCBI_STR_USE_SSE2
+
+
+// Max number of chars in the set searched with vector instructions
+static const size_t kFindFirstOfVectorSet = 8;
+
+const char* g_CTempString_FindFirstOf(const char* str, size_t len,
+                                      const char* set, size_t set_len,
+                                      bool find_not)
+{
+    const char* end = str + len;
+
+#ifdef NCBI_STR_USE_SSE2
+    if (len >= 16  &&  set_len <= kFindFirstOfVectorSet) {
+        __m128i chars[kFindFirstOfVectorSet];
+        for (size_t i = 0;  i < set_len;  ++i) {
+            chars[i] = _mm_set1_epi8(set[i]);
+        }
+        for ( ;  str + 16 <= end;  str += 16) {
+            __m128i block =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+            __m128i eq = _mm_cmpeq_epi8(block, chars[0]);
+            for (size_t i = 1;  i < set_len;  ++i) {
+                eq = _mm_or_si128(eq, _mm_cmpeq_epi8(block, chars[i]));
+            }
+            unsigned int mask = (unsigned int) _mm_movemask_epi8(eq);
+            if ( find_not ) {
+                mask ^= 0xFFFF;
+            }
+            if ( mask ) {
+                return str + s_LowestBit(mask);
+            }
+        }
+    }
+#endif
+
+    if (size_t(end - str) * set_len <= 256) {
+        // Short tail or small set
+        for ( ;  str != end;  ++str) {
+            bool found = memchr(set, *str, set_len) != NULL;
+            if (found != find_not) {
+                return str;
+            }
+        }
+        return NULL;
+    }
+
+    bool table[256];
+    memset(table, find_not, sizeof(table));
+    for (size_t i = 0;  i < set_len;  ++i) {
+        table[(unsigned char) set[i]] = !find_not;
+    }
+    for ( ;  str != end;  ++str) {
+        if ( table[(unsigned char) *str] ) {
+            return str;
+        }
+    }
+    return NULL;
+}
+
+
+// Find position of the first different char in two strings of length n
+static inline
+SIZE_TYPE s_FindMismatch(const char* s1, const char* s2, SIZE_TYPE n)
+{
+    SIZE_TYPE i = 0;
+#ifdef NCBI_STR_USE_SSE2
+    for ( ;  i + 16 <= n;  i += 16) {
+        unsigned int mask = s_EqualMask16(s1 + i, s2 + i) ^ 0xFFFF;
+        if ( mask ) {
+            return i + s_LowestBit(mask);
+        }
+    }
+#endif
+    while (i < n  &&  s1[i] == s2[i]) {
+        ++i;
+    }
+    return i;
+}
+
+
+// Convert 8 decimal digits at once (SWAR).
+// Return FALSE if any of the 8 chars is not a decimal digit.
+static inline
+bool s_Parse8Digits(const char* ptr, Uint8* value)
+{
+#if defined(WORDS_BIGENDIAN)
+    return false;
+#else
+    Uint8 x;
+    memcpy(&x, ptr, sizeof(x));
+    // All bytes must be 0x30..0x39: high nibble is 3 and adding 6 keeps it
+    if (((x & NCBI_CONST_UINT8(0xF0F0F0F0F0F0F0F0)) |
+         (((x + NCBI_CONST_UINT8(0x0606060606060606))
+           & NCBI_CONST_UINT8(0xF0F0F0F0F0F0F0F0)) >> 4))
+        != NCBI_CONST_UINT8(0x3333333333333333)) {
+        return false;
+    }
+    x -= NCBI_CONST_UINT8(0x3030303030303030);
+    // First char is in the lowest byte, combine pairs, quads and octets
+    x = (x * 10 + (x >> 8))     & NCBI_CONST_UINT8(0x00FF00FF00FF00FF);
+    x = (x * 100 + (x >> 16))   & NCBI_CONST_UINT8(0x0000FFFF0000FFFF);
+    x = (x * 10000 + (x >> 32)) & NCBI_CONST_UINT8(0x00000000FFFFFFFF);
+    *value = x;
+    return true;
+#endif
+}
+
+
 extern const char* const kNcbiDevelopmentVersionString;
 const char* const kNcbiDevelopmentVersionString
     = "NCBI_DEVELOPMENT_VER_" NCBI_AS_STRING(NCBI_DEVELOPMENT_VER);
@@ -153,17 +313,15 @@ int NStr::CompareCase(const CTempString str, SIZE_TYPE pos, SIZE_TYPE n,
     }
     const char* s = str.data() + pos;
     const char* p = pattern.data();
-    while (n_cmp  &&  *s == *p) {
-        s++;  p++;  n_cmp--;
-    }
+    SIZE_TYPE i = s_FindMismatch(s, p, n_cmp);
 
-    if (n_cmp == 0) {
+    if (i == n_cmp) {
         if (n == pattern.length())
             return 0;
         return n > pattern.length() ? 1 : -1;
     }
 
-    return *s - *p;
+    return s[i] - p[i];
 }
 
 
@@ -216,9 +374,21 @@ int NStr::CompareNocase(const CTempString str, SIZE_TYPE pos, SIZE_TYPE n,
     }
     const char* s = str.data() + pos;
     const char* p = pattern.data();
-    while (n_cmp  &&  
-           tolower((unsigned char)(*s)) == tolower((unsigned char)(*p))) {
-        s++;  p++;  n_cmp--;
+    while (n_cmp) {
+#ifdef NCBI_STR_USE_SSE2
+        // Skip blocks of exactly equal chars, compare the rest char by char
+        while (n_cmp >= 16  &&  s_EqualMask16(s, p) == 0xFFFF) {
+            s += 16;  p += 16;  n_cmp -= 16;
+        }
+#endif
+        SIZE_TYPE n_block = min(n_cmp, SIZE_TYPE(16));
+        while (n_block  &&
+               tolower((unsigned char)(*s)) == tolower((unsigned char)(*p))) {
+            s++;  p++;  n_cmp--;  n_block--;
+        }
+        if ( n_block ) {
+            break;
+        }
     }
 
     if (n_cmp == 0) {
@@ -666,6 +836,59 @@ Int8 NStr::StringToInt8(const CTempString str, TStringToNumFlags flags,
     _ASSERT(flags == 0  ||  flags > 32);
     S2N_CONVERT_GUARD(flags);
 
+    const TStringToNumFlags slow_flags =
+        fMandatorySign|fAllowCommas|fAllowLeadingSymbols|fAllowTrailingSymbols;
+
+    if ( base == 10 && (flags & slow_flags) == 0 ) {
+        // fast conversion, the same as in StringToUInt8(); the narrower
+        // StringToInt() and StringToLong() get here as well
+
+        // Current position in the string
+        CTempString::const_iterator ptr = str.begin(), end = str.end();
+
+        // Determine sign
+        bool sign = false;
+        if ( ptr != end  &&  (*ptr == '-'  ||  *ptr == '+') ) {
+            sign = *ptr == '-';
+            ++ptr;
+        }
+        CTempString::const_iterator start = ptr;
+
+        // Begin conversion
+        Uint8 n = 0;
+
+        const Uint8    limit  = Uint8(kMax_I8) + (sign ? 1 : 0);
+        const Uint8    limdiv = limit / 10;
+        const unsigned limoff = unsigned(limit % 10);
+        const Uint8    limchunk = (Uint8(kMax_I8) - 99999999) / 100000000;
+
+        while ( ptr != end ) {
+            // Convert 8 digits at once while far from overflow
+            Uint8 digits;
+            if ( end - ptr >= 8  &&  n <= limchunk  &&
+                 s_Parse8Digits(ptr, &digits) ) {
+                n = n*100000000+digits;
+                ptr += 8;
+                continue;
+            }
+            unsigned delta = (unsigned char)(*ptr) - '0';
+            if ( delta >= 10 ) {
+                break;
+            }
+            // Overflow check
+            if ( n >= limdiv && (n > limdiv || delta > limoff) ) {
+                S2N_CONVERT_ERROR(Int8, "overflow", ERANGE, ptr-str.begin());
+            }
+            n = n*10+delta;
+            ++ptr;
+        }
+        // Like the general conversion, stop at '\0' as at the end
+        if ( ptr == start  ||  (ptr != end  &&  *ptr) ) {
+            S2N_CONVERT_ERROR(Int8, kEmptyStr, EINVAL, ptr-str.begin());
+        }
+        return sign ? Int8(0 - n) : Int8(n);
+    }
+
     // Current position in the string
     SIZE_TYPE pos = 0;
 
@@ -706,9 +929,21 @@ Int8 NStr::StringToInt8(const CTempString str, TStringToNumFlags flags,
     int       comma  = -1;  
     SIZE_TYPE numpos = pos;
 
+    // Decimal numbers without commas are converted by 8 digits at once
+    // while the result is far from overflow
+    const bool  chunks   = base == 10  &&  !(flags & fAllowCommas);
+    const Int8  limchunk = (kMax_I8 - 99999999) / 100000000;
+
     while (char ch = str[pos]) {
         int  delta;   // corresponding numeric value of 'ch'
 
+        Uint8 digits;
+        if ( chunks  &&  pos + 8 <= str.size()  &&  n <= limchunk  &&
+             s_Parse8Digits(str.data() + pos, &digits) ) {
+            n = n * 100000000 + Int8(digits);
+            pos += 8;
+            continue;
+        }
         // Check on possible commas
         CHECK_COMMAS;
         // Sanity check
@@ -769,8 +1004,17 @@ Uint8 NStr::StringToUInt8(const CTempString str,
 
         const Uint8 limdiv = kMax_UI8/10;
         const int   limoff = int(kMax_UI8 % 10);
-
-        do {
+        const Uint8 limchunk = (kMax_UI8 - 99999999) / 100000000;
+
+        while ( ptr != end ) {
+            // Convert 8 digits at once while far from overflow
+            Uint8 digits;
+            if ( end - ptr >= 8  &&  n <= limchunk  &&
+                 s_Parse8Digits(ptr, &digits) ) {
+                n = n*100000000+digits;
+                ptr += 8;
+                continue;
+            }
             char ch = *ptr;
             int  delta = ch - '0';
             if ( unsigned(delta) >= 10 ) {
@@ -781,7 +1025,8 @@ Uint8 NStr::StringToUInt8(const CTempString str,
                 S2N_CONVERT_ERROR(Uint8, kEmptyStr, ERANGE, ptr-str.begin());
             }
             n = n*10+delta;
-        } while ( ++ptr != end );
+            ++ptr;
+        }
 
         return n;
     }
@@ -820,9 +1065,20 @@ Uint8 NStr::StringToUInt8(const CTempString str,
     int       comma  = -1;  
     SIZE_TYPE numpos = pos;
 
+    // Same as in StringToInt8(): 8 decimal digits at once if no commas
+    const bool  chunks   = base == 10  &&  !(flags & fAllowCommas);
+    const Uint8 limchunk = (kMax_UI8 - 99999999) / 100000000;
+
     while (char ch = str[pos]) {
         int delta;  // corresponding numeric value of 'ch'
 
+        Uint8 digits;
+        if ( chunks  &&  pos + 8 <= size  &&  n <= limchunk  &&
+             s_Parse8Digits(str.data() + pos, &digits) ) {
+            n = n * 100000000 + digits;
+            pos += 8;
+            continue;
+        }
         // Check on possible commas
         CHECK_COMMAS;
         // Sanity check
@@ -0,0 +1,257 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Overflow policies and counters of CAsyncDiagHandler's per-thread rings
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbithr.hpp>
+#include <corelib/ncbidiag.hpp>
+#include <corelib/ncbi_system.hpp>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+USING_NCBI_SCOPE;
+
+
+static const char*  kPrefix   = "async-diag-test";
+static const size_t kRingSize = 8;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CGateDiagHandler --
+//
+//  Counts test messages reaching the real output. While the gate is
+//  closed, the dedicated thread of CAsyncDiagHandler is stuck writing, so
+//  the rings of posting threads fill up.
+
+class CGateDiagHandler : public CDiagHandler
+{
+public:
+    CGateDiagHandler(void) : m_Open(true), m_Messages(0), m_Critical(0) {}
+
+    virtual void Post(const SDiagMessage& mess)
+    {
+        if ( !NStr::StartsWith(CTempString(mess.m_Buffer, mess.m_BufferLen),
+                               kPrefix) ) {
+            return;
+        }
+        CMutexGuard guard(m_Mutex);
+        while ( !m_Open ) {
+            m_Cond.WaitForSignal(m_Mutex);
+        }
+        ++m_Messages;
+        if (mess.m_Severity == eDiag_Critical) {
+            ++m_Critical;
+        }
+    }
+
+    void Close(void)
+    {
+        CMutexGuard guard(m_Mutex);
+        m_Open = false;
+        m_Messages = m_Critical = 0;
+    }
+    void Open(void)
+    {
+        CMutexGuard guard(m_Mutex);
+        m_Open = true;
+        m_Cond.SignalAll();
+    }
+    void GetCounts(Uint8* messages, Uint8* critical)
+    {
+        CMutexGuard guard(m_Mutex);
+        *messages = m_Messages;
+        *critical = m_Critical;
+    }
+
+private:
+    CMutex             m_Mutex;
+    CConditionVariable m_Cond;
+    bool               m_Open;
+    Uint8              m_Messages;
+    Uint8              m_Critical;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CPostThread --
+
+class CPostThread : public CThread
+{
+public:
+    CPostThread(int idx, int count, bool critical)
+        : m_Idx(idx), m_Count(count), m_Critical(critical)
+    {
+    }
+
+protected:
+    virtual void* Main(void)
+    {
+        for (int i = 0;  i < m_Count;  ++i) {
+            ERR_POST(Warning << kPrefix << " thread " << m_Idx
+                     << " message " << i);
+        }
+        if ( m_Critical ) {
+            ERR_POST(Critical << kPrefix << " thread " << m_Idx
+                     << " critical");
+        }
+        return NULL;
+    }
+
+private:
+    int  m_Idx;
+    int  m_Count;
+    bool m_Critical;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Test application
+
+class CTestAsyncDiagApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run (void);
+
+private:
+    // Post "count" messages (and a critical one if "critical") from each
+    // of the threads while the output is stalled.
+    void x_RunPolicy(CAsyncDiagHandler::EOverflowPolicy policy,
+                     bool critical,
+                     Uint8* posted, Uint8* lost,
+                     Uint8* received, Uint8* received_critical);
+
+    int               m_Threads;
+    int               m_Count;
+    CGateDiagHandler* m_Gate;
+};
+
+
+void CTestAsyncDiagApp::Init(void)
+{
+    auto_ptr<CArgDescriptions> args(new CArgDescriptions);
+    args->SetUsageContext(GetArguments().GetProgramBasename(),
+                          "Test CAsyncDiagHandler overflow policies");
+    args->AddDefaultKey("threads", "Threads", "Number of posting threads",
+                        CArgDescriptions::eInteger, "4");
+    args->AddDefaultKey("count", "Count", "Messages posted by each thread",
+                        CArgDescriptions::eInteger, "200");
+    SetupArgDescriptions(args.release());
+
+    // Small rings overflow quickly; keep one of 4 overflowing messages.
+    // (The registry is not consulted without a config file.)
+    SetEnvironment("DIAG_ASYNC_RING_SIZE", NStr::NumericToString(kRingSize));
+    SetEnvironment("DIAG_ASYNC_OVERFLOW_SAMPLE_RATE", "4");
+}
+
+
+void CTestAsyncDiagApp::x_RunPolicy(CAsyncDiagHandler::EOverflowPolicy policy,
+                                    bool critical,
+                                    Uint8* posted, Uint8* lost,
+                                    Uint8* received, Uint8* received_critical)
+{
+    CAsyncDiagHandler handler;
+    handler.SetOverflowPolicy(policy);
+    handler.InstallToDiag();
+    m_Gate->Close();
+
+    vector< CRef<CThread> > threads;
+    for (int i = 0;  i < m_Threads;  ++i) {
+        threads.push_back(CRef<CThread>
+                          (new CPostThread(i, m_Count, critical)));
+        threads.back()->Run();
+    }
+    // Let the rings overflow, then let blocked threads finish.
+    SleepMilliSec(300);
+    m_Gate->Open();
+    NON_CONST_ITERATE(vector< CRef<CThread> >, it, threads) {
+        (*it)->Join();
+    }
+
+    handler.RemoveFromDiag();
+    *posted = handler.GetPostedCount();
+    *lost   = handler.GetLostCount();
+    m_Gate->GetCounts(received, received_critical);
+    NcbiCout << "policy " << int(policy) << ": posted " << *posted
+             << ", lost " << *lost << ", written " << *received << NcbiEndl;
+}
+
+
+int CTestAsyncDiagApp::Run(void)
+{
+    m_Threads = GetArgs()["threads"].AsInteger();
+    m_Count   = GetArgs()["count"].AsInteger();
+    const Uint8 total = Uint8(m_Threads) * m_Count;
+    _ASSERT(size_t(m_Count) > 4 * kRingSize);
+
+    SetDiagPostLevel(eDiag_Info);
+    m_Gate = new CGateDiagHandler;
+    SetDiagHandler(m_Gate);
+
+    Uint8 posted, lost, received, received_critical;
+
+    // Overflowing messages are dropped, critical ones never.
+    x_RunPolicy(CAsyncDiagHandler::eOverflow_Drop, true,
+                &posted, &lost, &received, &received_critical);
+    _ASSERT(posted == total + m_Threads);
+    _ASSERT(lost > 0);
+    _ASSERT(received + lost == posted);
+    _ASSERT(received_critical == Uint8(m_Threads));
+
+    // Each 4th overflowing message waits for free space.
+    x_RunPolicy(CAsyncDiagHandler::eOverflow_Sample, false,
+                &posted, &lost, &received, &received_critical);
+    _ASSERT(posted == total);
+    _ASSERT(lost > 0);
+    _ASSERT(received + lost == posted);
+    _ASSERT(received * 4 >= total);
+
+    // Nothing is lost.
+    x_RunPolicy(CAsyncDiagHandler::eOverflow_Block, false,
+                &posted, &lost, &received, &received_critical);
+    _ASSERT(posted == total);
+    _ASSERT(lost == 0);
+    _ASSERT(received == total);
+
+    NcbiCout << "Test completed successfully!" << NcbiEndl;
+    return 0;
+}
+
+
+///////////////////////////////////
+// MAIN
+//
+
+int main(int argc, const char* argv[])
+{
+    return CTestAsyncDiagApp().AppMain(argc, argv);
+}
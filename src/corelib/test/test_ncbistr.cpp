@@ -3499,6 +3499,145 @@ BOOST_AUTO_TEST_CASE(s_FindWord)
 }
 
 
+//----------------------------------------------------------------------------
+// Vectorized search/compare/convert against simple reference implementations
+// (all lengths and offsets around 16-byte and 8-digit blocks)
+//----------------------------------------------------------------------------
+
+static SIZE_TYPE s_RefFindFirstOf(const string& str, const string& set,
+                                  SIZE_TYPE pos, bool find_not)
+{
+    for (SIZE_TYPE i = pos;  i < str.size();  ++i) {
+        bool found = set.find(str[i]) != NPOS;
+        if (found != find_not) {
+            return i;
+        }
+    }
+    return NPOS;
+}
+
+static int s_Sign(int value)
+{
+    return value < 0 ? -1 : (value > 0 ? 1 : 0);
+}
+
+BOOST_AUTO_TEST_CASE(s_BlockAlgorithms)
+{
+    // Chars to build strings from, including embedded '\0'
+    const string alphabet("abcXYZ ,;\0\n0123456789\xE0", 22);
+    const char* sets[] = { "a", "a\0", ",;", " \t\n", "0123456789",
+                           "XYZ", "abcdefghi", "\xE0", "abcXYZ ,;\n01234" };
+    const size_t sets_count = sizeof(sets) / sizeof(sets[0]);
+
+    for (size_t len = 0;  len <= 70;  ++len) {
+        string str;
+        for (size_t i = 0;  i < len;  ++i) {
+            str += alphabet[(i * 7 + len) % alphabet.size()];
+        }
+        CTempString s(str);
+        for (size_t k = 0;  k < sets_count;  ++k) {
+            string set(sets[k], k == 1 ? 2 : strlen(sets[k]));
+            for (SIZE_TYPE pos = 0;  pos <= len;  ++pos) {
+                BOOST_CHECK_EQUAL(s.find_first_of(set, pos),
+                                  s_RefFindFirstOf(str, set, pos, false));
+                BOOST_CHECK_EQUAL(s.find_first_not_of(set, pos),
+                                  s_RefFindFirstOf(str, set, pos, true));
+                BOOST_CHECK_EQUAL(s.find(set[0], pos), str.find(set[0], pos));
+            }
+        }
+        // Change one char at each position and compare
+        for (size_t i = 0;  i < len;  ++i) {
+            string other(str);
+            other[i] = char(other[i] ^ 0x20);
+            BOOST_CHECK_EQUAL(s_Sign(NStr::CompareCase(str, 0, NPOS, other)),
+                              s_Sign(str.compare(other)));
+            string lower1(str), lower2(other);
+            NStr::ToLower(lower1);
+            NStr::ToLower(lower2);
+            BOOST_CHECK_EQUAL(s_Sign(NStr::CompareNocase(str, 0, NPOS, other)),
+                              s_Sign(lower1.compare(lower2)));
+            BOOST_CHECK_EQUAL(NStr::CompareNocase(str, 0, i,
+                                                  other.substr(0, i)), 0);
+            BOOST_CHECK_EQUAL(NStr::CompareCase(str, 0, i, other), -1);
+        }
+    }
+
+    // Numbers with all lengths of the digits tail after 8-digit blocks
+    string digits;
+    Uint8  value = 0;
+    for (int i = 1;  i <= 19;  ++i) {
+        digits += char('0' + (i * 3) % 10);
+        value = value * 10 + (i * 3) % 10;
+        BOOST_CHECK_EQUAL(NStr::StringToUInt8(digits), value);
+        BOOST_CHECK_EQUAL(NStr::StringToInt8(digits), Int8(value));
+        BOOST_CHECK_EQUAL(NStr::StringToInt8("-" + digits), -Int8(value));
+        BOOST_CHECK_EQUAL(NStr::StringToUInt8("000000000" + digits), value);
+        // Non-digit inside of a block
+        string bad(digits);
+        bad[bad.size() / 2] = 'x';
+        BOOST_CHECK_THROW(NStr::StringToUInt8(bad), CStringException);
+        BOOST_CHECK_THROW(NStr::StringToInt8(bad), CStringException);
+    }
+    BOOST_CHECK_EQUAL(NStr::StringToUInt8("18446744073709551615"), kMax_UI8);
+    BOOST_CHECK_THROW(NStr::StringToUInt8("18446744073709551616"),
+                      CStringException);
+    BOOST_CHECK_THROW(NStr::StringToUInt8("99999999999999999999"),
+                      CStringException);
+    BOOST_CHECK_EQUAL(NStr::StringToInt8("9223372036854775807"), kMax_I8);
+    BOOST_CHECK_EQUAL(NStr::StringToInt8("-9223372036854775808"), kMin_I8);
+    BOOST_CHECK_THROW(NStr::StringToInt8("9223372036854775808"),
+                      CStringException);
+    BOOST_CHECK_THROW(NStr::StringToInt8("-9223372036854775809"),
+                      CStringException);
+
+    // The same blocks with leading/trailing symbols allowed, and in the
+    // narrower conversions built on StringToInt8()/StringToUInt8()
+    digits.erase();
+    value = 0;
+    for (int i = 1;  i <= 19;  ++i) {
+        digits += char('0' + (i * 7) % 10);
+        value = value * 10 + (i * 7) % 10;
+        BOOST_CHECK_EQUAL(NStr::StringToUInt8(" " + digits + " ",
+                                              NStr::fAllowLeadingSpaces |
+                                              NStr::fAllowTrailingSpaces),
+                          value);
+        BOOST_CHECK_EQUAL(NStr::StringToUInt8(digits + "abc",
+                                              NStr::fAllowTrailingSymbols),
+                          value);
+        BOOST_CHECK_THROW(NStr::StringToUInt8(digits + " x",
+                                              NStr::fAllowTrailingSpaces),
+                          CStringException);
+        if (value <= kMax_UInt) {
+            BOOST_CHECK_EQUAL(NStr::StringToUInt(digits), value);
+        } else {
+            BOOST_CHECK_THROW(NStr::StringToUInt(digits), CStringException);
+        }
+        if (value <= Uint8(kMax_Int)) {
+            BOOST_CHECK_EQUAL(NStr::StringToInt("-" + digits), -int(value));
+        } else {
+            BOOST_CHECK_THROW(NStr::StringToInt("-" + digits),
+                              CStringException);
+        }
+    }
+    BOOST_CHECK_EQUAL(NStr::StringToUInt("4294967295"), kMax_UInt);
+    BOOST_CHECK_THROW(NStr::StringToUInt("4294967296"), CStringException);
+    BOOST_CHECK_EQUAL(NStr::StringToInt("2147483647"), kMax_Int);
+    BOOST_CHECK_EQUAL(NStr::StringToInt("-2147483648"), kMin_Int);
+    BOOST_CHECK_THROW(NStr::StringToInt("2147483648"), CStringException);
+    BOOST_CHECK_EQUAL(NStr::StringToInt8("+1234567890123"), 1234567890123LL);
+    BOOST_CHECK_EQUAL(NStr::StringToInt8(CTempString("-12345678\0" "9", 10)),
+                      -12345678);
+    BOOST_CHECK_THROW(NStr::StringToInt8("-"), CStringException);
+    BOOST_CHECK_THROW(NStr::StringToInt8("-12345678x"), CStringException);
+    BOOST_CHECK_EQUAL(NStr::StringToUInt8("18446744073709551615 ",
+                                          NStr::fAllowTrailingSpaces),
+                      kMax_UI8);
+    BOOST_CHECK_THROW(NStr::StringToUInt8("18446744073709551616 ",
+                                          NStr::fAllowTrailingSpaces),
+                      CStringException);
+}
+
+
 //----------------------------------------------------------------------------
 // CVersionInfo:: parse from str
 //----------------------------------------------------------------------------
@@ -4379,6 +4518,240 @@ BOOST_AUTO_TEST_CASE(s_StringToDouble_Speed)
 }
 
 
+//----------------------------------------------------------------------------
+// Search and comparison speed test
+//----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(s_Search_Speed)
+{
+    const int COUNT = 100;
+    string line;
+    for ( int i = 0; i < 10000; ++i ) {
+        line += "chr1\t" + NStr::IntToString(i * 1000) +
+            "\tGeneID:123456;gene=ABCDEFGHIJKLMN;product=some protein\t";
+    }
+    string upper(line);
+    NStr::ToUpper(upper);
+    CStopWatch sw;
+    double time;
+
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        vector<CTempString> tokens;
+        NStr::Split(line, "\t;", tokens);
+        if ( tokens.size() < 50000 ) Abort();
+    }
+    time = sw.Elapsed();
+    LOG_POST("Split() time: " << time);
+
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        if ( CTempString(line).find_first_of("|#") != NPOS ) Abort();
+    }
+    time = sw.Elapsed();
+    LOG_POST("find_first_of() time: " << time);
+
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        if ( NStr::CompareCase(line, 0, NPOS, CTempString(line)) ) Abort();
+    }
+    time = sw.Elapsed();
+    LOG_POST("CompareCase() time: " << time);
+
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        if ( NStr::CompareNocase(line, 0, NPOS, CTempString(upper)) ) Abort();
+    }
+    time = sw.Elapsed();
+    LOG_POST("CompareNocase() time: " << time);
+}
+
+
+//----------------------------------------------------------------------------
+// Throughput of the parsing primitives on tab-delimited feature lines,
+// compared with byte-at-a-time reference loops
+//----------------------------------------------------------------------------
+
+static void s_ReportThroughput(const char* name, size_t bytes,
+                               double time, double ref_time)
+{
+    double mb = double(bytes) / (1024 * 1024);
+    LOG_POST(name << ": " << mb / time << " MB/s, reference "
+             << mb / ref_time << " MB/s, " << ref_time / time << "x");
+}
+
+// Digit by digit, with the same checks as NStr::StringToUInt8()
+static Uint8 s_RefStringToUInt8(const CTempString str)
+{
+    if ( str.empty() ) Abort();
+    Uint8 n = 0;
+    ITERATE(CTempString, it, str) {
+        unsigned int delta = (unsigned char)(*it) - '0';
+        if ( delta >= 10 ) Abort();
+        if ( n >= kMax_UI8 / 10  &&
+             (n > kMax_UI8 / 10  ||  delta > kMax_UI8 % 10) ) Abort();
+        n = n * 10 + delta;
+    }
+    return n;
+}
+
+static int s_RefCompareNocase(const CTempString s1, const CTempString s2)
+{
+    for (size_t i = 0;  i < s1.size();  ++i) {
+        int c1 = tolower((unsigned char) s1[i]);
+        int c2 = tolower((unsigned char) s2[i]);
+        if (c1 != c2) {
+            return c1 - c2;
+        }
+    }
+    return 0;
+}
+
+BOOST_AUTO_TEST_CASE(s_Parse_Throughput)
+{
+    const int COUNT = 20;
+    string line;
+    vector<string> numbers;
+    for ( int i = 0; i < 100000; ++i ) {
+        string start = NStr::UIntToString(i * 1000 + 123456789);
+        string score = NStr::UInt8ToString(Uint8(i) * 1000000007 % 99999999991);
+        line += "chr1\tRefSeq\tgene\t" + start + "\t" + start +
+            "\t.\t+\t.\tID=gene" + NStr::IntToString(i) +
+            ";Dbxref=GeneID:" + score + ";gene=ABCDEFGHIJKLMN\n";
+        numbers.push_back(start);
+        numbers.push_back(score);
+    }
+    size_t number_bytes = 0;
+    ITERATE(vector<string>, it, numbers) {
+        number_bytes += it->size();
+    }
+    string upper(line);
+    NStr::ToUpper(upper);
+    CStopWatch sw;
+    double time, ref_time;
+
+    // Delimiter search
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        vector<CTempString> tokens;
+        NStr::Split(line, "\t;\n", tokens);
+        if ( tokens.size() < 1000000 ) Abort();
+    }
+    time = sw.Elapsed();
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        vector<CTempString> tokens;
+        size_t start = 0;
+        for ( size_t pos = 0; pos < line.size(); ++pos ) {
+            char c = line[pos];
+            if ( c == '\t'  ||  c == ';'  ||  c == '\n' ) {
+                tokens.push_back(CTempString(line, start, pos - start));
+                start = pos + 1;
+            }
+        }
+        tokens.push_back(CTempString(line, start, line.size() - start));
+        if ( tokens.size() < 1000000 ) Abort();
+    }
+    ref_time = sw.Elapsed();
+    s_ReportThroughput("Split()", line.size() * COUNT, time, ref_time);
+
+    // Case-insensitive comparison
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        if ( NStr::CompareNocase(line, 0, NPOS, CTempString(upper)) ) Abort();
+    }
+    time = sw.Elapsed();
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        if ( s_RefCompareNocase(line, upper) ) Abort();
+    }
+    ref_time = sw.Elapsed();
+    s_ReportThroughput("CompareNocase()", line.size() * COUNT,
+                       time, ref_time);
+
+    // Integer parsing: the narrow conversions go through StringToInt8()
+    // and StringToUInt8(), with and without the slow path flags
+    Uint8 sum = 0, ref_sum = 0;
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        ITERATE(vector<string>, it, numbers) {
+            ref_sum += s_RefStringToUInt8(*it);
+        }
+    }
+    ref_time = sw.Elapsed();
+
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        ITERATE(vector<string>, it, numbers) {
+            sum += NStr::StringToUInt8(*it);
+        }
+    }
+    time = sw.Elapsed();
+    if ( sum != ref_sum ) Abort();
+    s_ReportThroughput("StringToUInt8()", number_bytes * COUNT,
+                       time, ref_time);
+
+    sum = 0;
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        ITERATE(vector<string>, it, numbers) {
+            sum += NStr::StringToUInt8(*it, NStr::fAllowTrailingSpaces);
+        }
+    }
+    time = sw.Elapsed();
+    if ( sum != ref_sum ) Abort();
+    s_ReportThroughput("StringToUInt8(fAllowTrailingSpaces)",
+                       number_bytes * COUNT, time, ref_time);
+
+    sum = 0;
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        ITERATE(vector<string>, it, numbers) {
+            sum += NStr::StringToInt8(*it);
+        }
+    }
+    time = sw.Elapsed();
+    if ( sum != ref_sum ) Abort();
+    s_ReportThroughput("StringToInt8()", number_bytes * COUNT,
+                       time, ref_time);
+
+    // Only the numbers which fit into 32 bits
+    size_t int_bytes = 0;
+    for ( size_t k = 0; k < numbers.size(); k += 2 ) {
+        int_bytes += numbers[k].size();
+    }
+    ref_sum = 0;
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        for ( size_t k = 0; k < numbers.size(); k += 2 ) {
+            ref_sum += s_RefStringToUInt8(numbers[k]);
+        }
+    }
+    ref_time = sw.Elapsed();
+    sum = 0;
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        for ( size_t k = 0; k < numbers.size(); k += 2 ) {
+            sum += NStr::StringToInt(numbers[k]);
+        }
+    }
+    time = sw.Elapsed();
+    if ( sum != ref_sum ) Abort();
+    s_ReportThroughput("StringToInt()", int_bytes * COUNT, time, ref_time);
+
+    sum = 0;
+    sw.Restart();
+    for ( int i = 0; i < COUNT; ++i ) {
+        for ( size_t k = 0; k < numbers.size(); k += 2 ) {
+            sum += NStr::StringToUInt(numbers[k]);
+        }
+    }
+    time = sw.Elapsed();
+    if ( sum != ref_sum ) Abort();
+    s_ReportThroughput("StringToUInt()", int_bytes * COUNT, time, ref_time);
+}
+
+
 static const string s_ShellStr[] = {
     "abc",            // normal string, no encoding
     "ab\acd",         // non-printable chars, need BASH encoding
@@ -4446,4 +4819,6 @@ NCBITEST_INIT_TREE()
 {
     NCBITEST_DISABLE(s_StringToInt_Speed);
     NCBITEST_DISABLE(s_StringToDouble_Speed);
+    NCBITEST_DISABLE(s_Search_Speed);
+    NCBITEST_DISABLE(s_Parse_Throughput);
 }
@@ -0,0 +1,169 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Performance of reading parameter defaults from many threads
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/test_mt.hpp>
+#include <corelib/ncbi_param.hpp>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+USING_NCBI_SCOPE;
+
+const char* kStrParam_Default = "StrParam Default";
+
+NCBI_PARAM_DECL(int, ParamPerf, IntParam);
+NCBI_PARAM_DECL(string, ParamPerf, StrParam);
+NCBI_PARAM_DECL(bool, ParamPerf, NoThreadParam);
+
+NCBI_PARAM_DEF(int, ParamPerf, IntParam, 100);
+NCBI_PARAM_DEF(string, ParamPerf, StrParam, kStrParam_Default);
+NCBI_PARAM_DEF_EX(bool, ParamPerf, NoThreadParam, true, eParam_NoThread, 0);
+
+typedef NCBI_PARAM_TYPE(ParamPerf, IntParam) TParam_Int;
+typedef NCBI_PARAM_TYPE(ParamPerf, StrParam) TParam_Str;
+typedef NCBI_PARAM_TYPE(ParamPerf, NoThreadParam) TParam_NoThread;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Test application
+
+class CTestParamPerfApp : public CThreadedApp
+{
+public:
+    virtual bool Thread_Run(int idx);
+protected:
+    virtual bool TestApp_Args(CArgDescriptions& args);
+    virtual bool TestApp_Init(void);
+    virtual bool TestApp_Exit(void);
+private:
+    void x_Report(int idx, const char* name, size_t count, double elapsed);
+
+    size_t m_Iterations;
+};
+
+
+void CTestParamPerfApp::x_Report(int idx, const char* name,
+                                 size_t count, double elapsed)
+{
+    NcbiCout << "Thread " << idx << ": " << name << " "
+             << count << " calls in " << elapsed << " sec ("
+             << (elapsed > 0 ? size_t(count / elapsed) : count)
+             << " calls/sec)" << NcbiEndl;
+}
+
+
+bool CTestParamPerfApp::Thread_Run(int idx)
+{
+    // Warm up and make sure all threads start measuring at the same time.
+    _ASSERT(TParam_Int::GetDefault() == 100);
+    TestApp_GlobalSyncPoint();
+
+    CStopWatch sw(CStopWatch::eStart);
+    size_t sum = 0;
+    for (size_t i = 0; i < m_Iterations; ++i) {
+        sum += TParam_Int::GetDefault();
+    }
+    x_Report(idx, "int GetDefault()", m_Iterations, sw.Elapsed());
+    _ASSERT(sum == 100 * m_Iterations);
+
+    sw.Restart();
+    sum = 0;
+    for (size_t i = 0; i < m_Iterations; ++i) {
+        sum += TParam_Str::GetThreadDefault().size();
+    }
+    x_Report(idx, "string GetThreadDefault()", m_Iterations, sw.Elapsed());
+    _ASSERT(sum == strlen(kStrParam_Default) * m_Iterations);
+
+    sw.Restart();
+    sum = 0;
+    for (size_t i = 0; i < m_Iterations; ++i) {
+        sum += TParam_NoThread::GetThreadDefault() ? 1 : 0;
+    }
+    x_Report(idx, "no-thread bool GetThreadDefault()",
+             m_Iterations, sw.Elapsed());
+    _ASSERT(sum == m_Iterations);
+
+    // Thread default must take precedence over the cached global value.
+    TParam_Int::SetThreadDefault(idx);
+    _ASSERT(TParam_Int::GetThreadDefault() == idx);
+    TParam_Int::ResetThreadDefault();
+    _ASSERT(TParam_Int::GetThreadDefault() == 100);
+    return true;
+}
+
+
+bool CTestParamPerfApp::TestApp_Args(CArgDescriptions& args)
+{
+    args.AddDefaultKey("iterations", "Iterations",
+                       "Number of calls per thread for each test",
+                       CArgDescriptions::eInteger, "1000000");
+    return true;
+}
+
+
+bool CTestParamPerfApp::TestApp_Init(void)
+{
+    m_Iterations = size_t(GetArgs()["iterations"].AsInteger());
+    NcbiCout << NcbiEndl
+             << "Testing parameters performance with "
+             << NStr::IntToString(s_NumThreads)
+             << " threads..."
+             << NcbiEndl;
+    return true;
+}
+
+
+bool CTestParamPerfApp::TestApp_Exit(void)
+{
+    // Changing the global default must be visible to all readers.
+    _ASSERT(TParam_Int::GetDefault() == 100);
+    TParam_Int::SetDefault(200);
+    _ASSERT(TParam_Int::GetDefault() == 200);
+    _ASSERT(TParam_Int::GetThreadDefault() == 200);
+    TParam_Int::ResetDefault();
+    _ASSERT(TParam_Int::GetDefault() == 100);
+
+    NcbiCout << "Test completed successfully!"
+             << NcbiEndl << NcbiEndl;
+    return true;
+}
+
+
+
+///////////////////////////////////
+// MAIN
+//
+
+int main(int argc, const char* argv[])
+{
+    return CTestParamPerfApp().AppMain(argc, argv);
+}
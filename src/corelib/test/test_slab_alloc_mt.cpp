@@ -0,0 +1,247 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Correctness and performance of CSlabAllocator compared to system heap,
+ *   and of CObject allocation (set NCBI_OBJECT_SLAB_ALLOC=1 to make
+ *   CObject use slab allocator).
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/test_mt.hpp>
+#include <corelib/ncbi_slab_alloc.hpp>
+#include <corelib/ncbiobj.hpp>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+USING_NCBI_SCOPE;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Objects of different sizes, similar to small serializable objects
+
+template<size_t Size>
+class CTestObject : public CObject
+{
+public:
+    CTestObject(CObject* next) : m_Next(next)
+    {
+        memset(m_Data, int(Size), sizeof(m_Data));
+    }
+    CRef<CObject> m_Next;
+    char m_Data[Size];
+};
+
+
+static CFastMutex    s_ExchangeMutex;
+static vector<void*> s_Exchange;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Test application
+
+class CTestSlabAllocApp : public CThreadedApp
+{
+public:
+    virtual bool Thread_Run(int idx);
+protected:
+    virtual bool TestApp_Args(CArgDescriptions& args);
+    virtual bool TestApp_Init(void);
+    virtual bool TestApp_Exit(void);
+private:
+    void x_Report(int idx, const char* name, size_t count, double elapsed);
+    void x_TestHeap(int idx, const vector<size_t>& sizes);
+    void x_TestSlab(int idx, const vector<size_t>& sizes);
+    void x_TestObjects(int idx);
+
+    size_t m_Iterations;
+    size_t m_Blocks;
+};
+
+
+void CTestSlabAllocApp::x_Report(int idx, const char* name,
+                                 size_t count, double elapsed)
+{
+    NcbiCout << "Thread " << idx << ": " << name << " "
+             << count << " allocations in " << elapsed << " sec ("
+             << (elapsed > 0 ? size_t(count / elapsed) : count)
+             << " allocations/sec)" << NcbiEndl;
+}
+
+
+void CTestSlabAllocApp::x_TestHeap(int idx, const vector<size_t>& sizes)
+{
+    vector<void*> ptrs(sizes.size());
+    CStopWatch sw(CStopWatch::eStart);
+    for (size_t i = 0; i < m_Iterations; ++i) {
+        for (size_t j = 0; j < sizes.size(); ++j) {
+            ptrs[j] = ::operator new(sizes[j]);
+        }
+        // Free in the order different from allocation
+        for (size_t j = 0; j < sizes.size(); j += 2) {
+            ::operator delete(ptrs[j]);
+        }
+        for (size_t j = 1; j < sizes.size(); j += 2) {
+            ::operator delete(ptrs[j]);
+        }
+    }
+    x_Report(idx, "system heap", m_Iterations * sizes.size(), sw.Elapsed());
+}
+
+
+void CTestSlabAllocApp::x_TestSlab(int idx, const vector<size_t>& sizes)
+{
+    vector<void*> ptrs(sizes.size());
+    CStopWatch sw(CStopWatch::eStart);
+    for (size_t i = 0; i < m_Iterations; ++i) {
+        for (size_t j = 0; j < sizes.size(); ++j) {
+            ptrs[j] = CSlabAllocator::Allocate(sizes[j]);
+        }
+        for (size_t j = 0; j < sizes.size(); j += 2) {
+            CSlabAllocator::Deallocate(ptrs[j]);
+        }
+        for (size_t j = 1; j < sizes.size(); j += 2) {
+            CSlabAllocator::Deallocate(ptrs[j]);
+        }
+    }
+    x_Report(idx, "slab allocator", m_Iterations * sizes.size(),
+             sw.Elapsed());
+
+    // Check that blocks don't overlap and can be freed by other threads
+    for (size_t j = 0; j < sizes.size(); ++j) {
+        ptrs[j] = CSlabAllocator::Allocate(sizes[j]);
+        memset(ptrs[j], int(j), sizes[j]);
+    }
+    for (size_t j = 0; j < sizes.size(); ++j) {
+        const unsigned char* data = (const unsigned char*)ptrs[j];
+        for (size_t k = 0; k < sizes[j]; ++k) {
+            _ASSERT(data[k] == (unsigned char)j);
+        }
+    }
+    vector<void*> others;
+    {{
+        CFastMutexGuard guard(s_ExchangeMutex);
+        others.swap(s_Exchange);
+        s_Exchange = ptrs;
+    }}
+    ITERATE(vector<void*>, it, others) {
+        CSlabAllocator::Deallocate(*it);
+    }
+}
+
+
+void CTestSlabAllocApp::x_TestObjects(int idx)
+{
+    CStopWatch sw(CStopWatch::eStart);
+    for (size_t i = 0; i < m_Iterations; ++i) {
+        // Build and destroy a chain of objects like deserialized tree
+        CRef<CObject> root;
+        for (size_t j = 0; j < m_Blocks; j += 4) {
+            root = new CTestObject<8>(new CTestObject<24>(
+                       new CTestObject<56>(new CTestObject<120>(root))));
+        }
+        root.Reset();
+    }
+    x_Report(idx, CSlabAllocator::IsUsedForObjects()?
+             "CObject with slab allocator": "CObject with system heap",
+             m_Iterations * m_Blocks, sw.Elapsed());
+}
+
+
+bool CTestSlabAllocApp::Thread_Run(int idx)
+{
+    vector<size_t> sizes(m_Blocks);
+    for (size_t j = 0; j < m_Blocks; ++j) {
+        // Mostly small blocks with rare big ones
+        sizes[j] = j % 16 == 15? 3000: 16 + (j * 37) % 300;
+    }
+    TestApp_GlobalSyncPoint();
+
+    x_TestHeap(idx, sizes);
+    x_TestSlab(idx, sizes);
+    x_TestObjects(idx);
+    return true;
+}
+
+
+bool CTestSlabAllocApp::TestApp_Args(CArgDescriptions& args)
+{
+    args.AddDefaultKey("iterations", "Iterations",
+                       "Number of allocation rounds per thread",
+                       CArgDescriptions::eInteger, "10000");
+    args.AddDefaultKey("blocks", "Blocks",
+                       "Number of blocks allocated in each round",
+                       CArgDescriptions::eInteger, "200");
+    return true;
+}
+
+
+bool CTestSlabAllocApp::TestApp_Init(void)
+{
+    m_Iterations = size_t(GetArgs()["iterations"].AsInteger());
+    m_Blocks = size_t(GetArgs()["blocks"].AsInteger());
+    NcbiCout << NcbiEndl
+             << "Testing slab allocator with "
+             << NStr::IntToString(s_NumThreads)
+             << " threads..."
+             << NcbiEndl;
+
+    // Sizes at the boundaries of size classes
+    for (size_t size = 1; size <= CSlabAllocator::GetMaxBlockSize() + 100;
+         ++size) {
+        char* ptr = (char*)CSlabAllocator::Allocate(size);
+        ptr[0] = ptr[size-1] = 'x';
+        CSlabAllocator::Deallocate(ptr);
+    }
+    return true;
+}
+
+
+bool CTestSlabAllocApp::TestApp_Exit(void)
+{
+    ITERATE(vector<void*>, it, s_Exchange) {
+        CSlabAllocator::Deallocate(*it);
+    }
+    s_Exchange.clear();
+    NcbiCout << "Slabs allocated: " << CSlabAllocator::GetSlabsCount()
+             << NcbiEndl
+             << "Test completed successfully!"
+             << NcbiEndl << NcbiEndl;
+    return true;
+}
+
+
+
+///////////////////////////////////
+// MAIN
+//
+
+int main(int argc, const char* argv[])
+{
+    return CTestSlabAllocApp().AppMain(argc, argv);
+}
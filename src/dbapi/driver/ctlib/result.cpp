@@ -32,6 +32,7 @@
 
 #include <ncbi_pch.hpp>
 #include <dbapi/driver/ctlib/interfaces.hpp>
+#include <dbapi/driver/dbapi_result_batch.hpp>
 #include <dbapi/driver/util/numeric_convert.hpp>
 #include <dbapi/error_codes.hpp>
 
@@ -855,6 +856,183 @@ bool CTL_RowResult::SkipItem()
 }
 
 
+size_t CTL_RowResult::FetchBatch(CDB_ResultBatch& batch, size_t max_rows)
+{
+    batch.Reset(GetDefineParams());
+
+    const unsigned int n_cols = (unsigned int) batch.GetNumColumns();
+    while (batch.GetNumRows() < max_rows  &&  Fetch()) {
+        for (unsigned int col = 0;  col < n_cols;  ++col) {
+            GetBatchItemInternal(batch, col);
+            IncCurrentItemNum();
+        }
+        batch.FinishRow();
+    }
+
+    return batch.GetNumRows();
+}
+
+
+// Aux. for CTL_RowResult::FetchBatch(): read fixed-size and short
+// character/binary items straight into the batch column, bypassing
+// CDB_Object; leave everything else to GetItemInternal().
+void CTL_RowResult::GetBatchItemInternal(CDB_ResultBatch& batch,
+                                         unsigned int col)
+{
+    CDB_ResultBatch::CColumn& column = batch.SetColumn(col);
+    CS_COMMAND* cmd     = x_GetSybaseCmd();
+    CS_INT      item_no = col + 1;
+    CS_DATAFMT& fmt     = m_ColFmt[col];
+    CS_INT      outlen  = 0;
+    bool        is_null = false;
+
+    switch (fmt.datatype) {
+    case CS_BIT_TYPE:
+    case CS_TINYINT_TYPE:
+    {
+        CS_TINYINT v = 0;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            column.AppendInt8(fmt.datatype == CS_BIT_TYPE ? (v != 0) : v);
+        }
+        break;
+    }
+
+    case CS_SMALLINT_TYPE:
+    {
+        CS_SMALLINT v = 0;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            column.AppendInt8(v);
+        }
+        break;
+    }
+
+    case CS_INT_TYPE:
+    {
+        CS_INT v = 0;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            column.AppendInt8(v);
+        }
+        break;
+    }
+
+#ifdef CS_BIGINT_TYPE
+    case CS_BIGINT_TYPE:
+#endif
+    case CS_LONG_TYPE:
+    {
+        Int8 v = 0;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            column.AppendInt8(v);
+        }
+        break;
+    }
+
+    case CS_FLOAT_TYPE:
+    {
+        CS_FLOAT v = 0;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            column.AppendDouble(v);
+        }
+        break;
+    }
+
+    case CS_REAL_TYPE:
+    {
+        CS_REAL v = 0;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            column.AppendDouble(v);
+        }
+        break;
+    }
+
+    case CS_DATETIME_TYPE:
+    {
+        CS_DATETIME v;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            TDBTimeI db_time;
+            db_time.days = v.dtdays;
+            db_time.time = v.dttime;
+            column.AppendTime(CTime(CTime::eEmpty).SetTimeDBI(db_time));
+        }
+        break;
+    }
+
+    case CS_DATETIME4_TYPE:
+    {
+        CS_DATETIME4 v;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if ( !is_null ) {
+            TDBTimeU db_time;
+            db_time.days = v.days;
+            db_time.time = v.minutes;
+            column.AppendTime(CTime(CTime::eEmpty).SetTimeDBU(db_time));
+        }
+        break;
+    }
+
+    case CS_DECIMAL_TYPE:
+    case CS_NUMERIC_TYPE:
+    {
+        CS_NUMERIC v;
+        my_ct_get_data(cmd, item_no, &v, (CS_INT) sizeof(v), &outlen, is_null);
+        if (outlen < 3) {
+            /* ctlib on windows returns 2 even for NULL numeric */
+            is_null = true;
+        }
+        if ( !is_null ) {
+            if (column.GetDataType() == eDB_BigInt) {
+                column.AppendInt8(numeric_to_longlong
+                                  ((unsigned int) v.precision, v.array));
+            } else {
+                column.AppendNumeric((unsigned int) v.precision,
+                                     (unsigned int) v.scale, v.array);
+            }
+        }
+        break;
+    }
+
+    case CS_CHAR_TYPE:
+    case CS_BINARY_TYPE:
+    case CS_VARCHAR_TYPE:
+    case CS_VARBINARY_TYPE:
+#ifdef FTDS_IN_USE
+    case CS_UNIQUE_TYPE:
+#endif
+    case CS_LONGCHAR_TYPE:
+    case CS_LONGBINARY_TYPE:
+        if ( !CDB_Object::IsBlobType(column.GetDataType()) ) {
+            char* v = column.ReserveBytes(fmt.maxlength);
+            my_ct_get_data(cmd, item_no, v, fmt.maxlength, &outlen, is_null);
+            if ( !is_null ) {
+                column.CommitBytes(outlen);
+            }
+            break;
+        }
+        // else fall through
+
+    default:
+    {
+        // BLOB and (N)VARCHAR(MAX)-style data, MONEY, etc.
+        CDB_Object& item = column.GetScratch();
+        GetItemInternal(I_Result::eAssignLOB, cmd, item_no, fmt, &item);
+        column.AppendValue(item);
+        return;
+    }
+    }
+
+    if (is_null) {
+        column.AppendNULL();
+    }
+}
+
+
 CTL_RowResult::~CTL_RowResult()
 {
     try {
@@ -1383,6 +1561,14 @@ bool CTL_CursorResultExpl::SkipItem()
 }
 
 
+size_t CTL_CursorResultExpl::FetchBatch(CDB_ResultBatch& batch,
+                                        size_t max_rows)
+{
+    // Items come from the underlying result set, not from m_ColFmt.
+    return impl::CResult::FetchBatch(batch, max_rows);
+}
+
+
 CTL_CursorResultExpl::~CTL_CursorResultExpl()
 {
     try {
@@ -0,0 +1,748 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:  Parallel bulk (BCP) loading pipeline
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <dbapi/driver/dbapi_bulk_loader.hpp>
+#include <dbapi/driver/exception.hpp>
+#include <dbapi/error_codes.hpp>
+
+
+#define NCBI_USE_ERRCODE_X   Dbapi_DrvrBulkLoad
+
+#if defined(NCBI_THREADS)  &&  defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+#  define HAVE_BULK_LOADER_THREADS 1
+#endif
+
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Batches and loaders
+//
+
+struct CDB_BulkLoader::SBatch
+{
+    SBatch(void) : number(0), n_rows(0) { }
+    ~SBatch(void)
+    {
+        ITERATE (vector<CDB_Object*>, it, values) {
+            delete *it;
+        }
+    }
+
+    void Clear(void)
+    {
+        n_rows = 0;
+        text.erase();
+        ends.clear();
+        nulls.clear();
+    }
+
+    CTempString GetField(size_t i) const
+    {
+        size_t start = i > 0 ? ends[i - 1] : 0;
+        return CTempString(text.data() + start, ends[i] - start);
+    }
+
+    Uint8               number;
+    size_t              n_rows;
+    string              text;    // All fields, back to back
+    vector<size_t>      ends;    // End of each field in "text"
+    vector<char>        nulls;
+    vector<CDB_Object*> values;  // Converted fields, reused across batches
+};
+
+
+struct CDB_BulkLoader::SLoader
+{
+    SLoader(void) : pending_rows(0) { }
+
+    AutoPtr<CDB_Connection> conn;
+    AutoPtr<CDB_BCPInCmd>   cmd;
+    // Batches sent since the last commit
+    vector<Uint8>           pending;
+    size_t                  pending_rows;
+};
+
+
+class CDB_BulkLoader::CWorkerThread : public CThread
+{
+public:
+    // A loader thread if "loader" is not NULL, a converter thread otherwise
+    CWorkerThread(CDB_BulkLoader& owner, SLoader* loader)
+        : m_Owner(owner), m_Loader(loader)
+    {
+    }
+
+protected:
+    virtual void* Main(void)
+    {
+        if (m_Loader != NULL) {
+            m_Owner.x_Loader(*m_Loader);
+        } else {
+            m_Owner.x_Converter();
+        }
+        return NULL;
+    }
+
+private:
+    CDB_BulkLoader& m_Owner;
+    SLoader*        m_Loader;
+};
+
+
+static void s_AssignText(CDB_Object& value, const CTempString& text,
+                         const CTimeFormat& time_format)
+{
+    switch (value.GetType()) {
+    case eDB_Int:
+        static_cast<CDB_Int&>(value) = NStr::StringToInt(text);
+        break;
+    case eDB_SmallInt:
+        static_cast<CDB_SmallInt&>(value) = NStr::StringToNumeric<Int2>(text);
+        break;
+    case eDB_TinyInt:
+        static_cast<CDB_TinyInt&>(value) = NStr::StringToNumeric<Uint1>(text);
+        break;
+    case eDB_BigInt:
+        static_cast<CDB_BigInt&>(value) = NStr::StringToInt8(text);
+        break;
+    case eDB_Bit:
+        static_cast<CDB_Bit&>(value)
+            = (text == "1"  ||  (text != "0"  &&  NStr::StringToBool(text)));
+        break;
+    case eDB_Float:
+        static_cast<CDB_Float&>(value) = float(NStr::StringToDouble(text));
+        break;
+    case eDB_Double:
+        static_cast<CDB_Double&>(value) = NStr::StringToDouble(text);
+        break;
+    case eDB_DateTime:
+        static_cast<CDB_DateTime&>(value) = CTime(string(text), time_format);
+        break;
+    case eDB_SmallDateTime:
+        static_cast<CDB_SmallDateTime&>(value)
+            = CTime(string(text), time_format);
+        break;
+    case eDB_Numeric:
+        static_cast<CDB_Numeric&>(value) = string(text);
+        break;
+    case eDB_VarChar:
+        static_cast<CDB_VarChar&>(value).SetValue(text.data(), text.size());
+        break;
+    case eDB_Char:
+        static_cast<CDB_Char&>(value).SetValue(text.data(), text.size());
+        break;
+    case eDB_LongChar:
+        static_cast<CDB_LongChar&>(value).SetValue(text.data(), text.size());
+        break;
+    case eDB_VarBinary:
+        static_cast<CDB_VarBinary&>(value).SetValue(text.data(), text.size());
+        break;
+    case eDB_Binary:
+        static_cast<CDB_Binary&>(value).SetValue(text.data(), text.size());
+        break;
+    case eDB_LongBinary:
+        static_cast<CDB_LongBinary&>(value).SetValue(text.data(),
+                                                      text.size());
+        break;
+    case eDB_Text:
+    case eDB_Image:
+    case eDB_VarCharMax:
+    case eDB_VarBinaryMax:
+    {
+        CDB_Stream& stream = static_cast<CDB_Stream&>(value);
+        stream.Truncate();
+        stream.Append(text.data(), text.size());
+        break;
+    }
+    default:
+        DATABASE_DRIVER_ERROR(string("Unsupported bulk load column type ")
+                              + CDB_Object::GetTypeName(value.GetType(),
+                                                        false),
+                              200041);
+    }
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CDB_BulkLoader::
+//
+
+CDB_BulkLoader::CDB_BulkLoader(I_DriverContext&     context,
+                               const CDBConnParams& conn_params,
+                               const string&        table_name,
+                               unsigned int         n_connections,
+                               unsigned int         n_converters)
+    : m_Context(context),
+      m_TableName(table_name),
+      m_NConnections(n_connections),
+      m_NConverters(n_converters),
+      m_BatchRows(1000),
+      m_CommitRows(0),
+      m_TimeFormat("Y-M-D h:m:s"),
+      m_Started(false),
+      m_Finished(false),
+      m_Current(NULL),
+      m_NextNumber(0),
+      m_SkippedRows(0),
+      m_ConvertersLeft(0),
+      m_InputDone(false),
+      m_Stop(false),
+      m_CommittedRows(0)
+{
+    CHECK_DRIVER_ERROR(n_connections == 0  ||  n_converters == 0,
+                       "At least one connection and one converter needed",
+                       200040);
+
+    // Connect right away, so that conn_params need not outlive the call.
+#ifndef HAVE_BULK_LOADER_THREADS
+    n_connections = 1;
+#endif
+    try {
+        for (unsigned int i = 0;  i < n_connections;  ++i) {
+            m_Loaders.push_back(new SLoader);
+            SLoader& loader = *m_Loaders.back();
+            loader.conn.reset(m_Context.MakeConnection(conn_params));
+            CHECK_DRIVER_ERROR(loader.conn.get() == NULL,
+                               "Cannot connect to "
+                               + conn_params.GetServerName(),
+                               200040);
+        }
+    }
+    catch (...) {
+        ITERATE (TLoaders, it, m_Loaders) {
+            delete *it;
+        }
+        throw;
+    }
+}
+
+
+CDB_BulkLoader::~CDB_BulkLoader(void)
+{
+    try {
+        // Loader threads cancel their own uncommitted rows.
+        x_Stop();
+        if ( !m_Finished ) {
+            NON_CONST_ITERATE (TLoaders, it, m_Loaders) {
+                x_Abort(**it);
+            }
+        }
+    }
+    NCBI_CATCH_ALL_X( 1, NCBI_CURRENT_FUNCTION )
+
+    ITERATE (TLoaders, it, m_Loaders) {
+        delete *it;
+    }
+    ITERATE (TBatches, it, m_AllBatches) {
+        delete *it;
+    }
+    ITERATE (TPrototypes, it, m_Prototypes) {
+        delete *it;
+    }
+}
+
+
+void CDB_BulkLoader::AddColumn(const CDB_Object& prototype)
+{
+    CHECK_DRIVER_ERROR(m_Started, "Columns must be added before any row",
+                       200040);
+    m_Prototypes.push_back(prototype.Clone());
+}
+
+
+void CDB_BulkLoader::SetBatchRows(size_t n)
+{
+    CHECK_DRIVER_ERROR(m_Started  ||  n == 0,
+                       "Batch size must be positive and set before any row",
+                       200040);
+    m_BatchRows = n;
+}
+
+
+void CDB_BulkLoader::SetCommitRows(size_t n)
+{
+    CHECK_DRIVER_ERROR(m_Started, "Commit interval must be set before any row",
+                       200040);
+    m_CommitRows = n;
+}
+
+
+void CDB_BulkLoader::SetTimeFormat(const CTimeFormat& fmt)
+{
+    CHECK_DRIVER_ERROR(m_Started, "Time format must be set before any row",
+                       200040);
+    m_TimeFormat = fmt;
+}
+
+
+void CDB_BulkLoader::SetHints(const string& hints)
+{
+    CHECK_DRIVER_ERROR(m_Started, "Hints must be set before any row", 200040);
+    m_Hints = hints;
+}
+
+
+void CDB_BulkLoader::SetProgressFile(const string& path)
+{
+    CHECK_DRIVER_ERROR(m_Started, "Progress file must be set before any row",
+                       200040);
+    m_ProgressPath = path;
+}
+
+
+void CDB_BulkLoader::AddField(const CTempString& value)
+{
+    if ( !m_Started ) {
+        x_Start();
+    }
+    m_Current->text.append(value.data(), value.size());
+    m_Current->ends.push_back(m_Current->text.size());
+    m_Current->nulls.push_back(0);
+}
+
+
+void CDB_BulkLoader::AddNULL(void)
+{
+    if ( !m_Started ) {
+        x_Start();
+    }
+    m_Current->ends.push_back(m_Current->text.size());
+    m_Current->nulls.push_back(1);
+}
+
+
+void CDB_BulkLoader::FinishRow(void)
+{
+    CHECK_DRIVER_ERROR(m_Current == NULL
+                       ||  (m_Current->ends.size()
+                            != (m_Current->n_rows + 1) * m_Prototypes.size()),
+                       "Wrong number of fields in row "
+                       + NStr::NumericToString(m_NextNumber * m_BatchRows
+                                               + (m_Current == NULL ? 0
+                                                  : m_Current->n_rows)),
+                       200040);
+    if (++m_Current->n_rows == m_BatchRows) {
+        x_Submit();
+    }
+}
+
+
+void CDB_BulkLoader::Finish(void)
+{
+    CHECK_DRIVER_ERROR(m_Finished, "Bulk load already finished", 200040);
+    if ( !m_Started ) {
+        x_Start();
+    }
+    x_CheckError();
+    CHECK_DRIVER_ERROR(m_Current->ends.size()
+                       != m_Current->n_rows * m_Prototypes.size(),
+                       "Incomplete last row", 200040);
+    if (m_Current->n_rows > 0) {
+        x_Submit();
+    }
+
+#ifdef HAVE_BULK_LOADER_THREADS
+    if ( !m_Threads.empty() ) {
+        {{
+            CFastMutexGuard guard(m_Mutex);
+            m_InputDone = true;
+            m_Cond.SignalAll();
+        }}
+        NON_CONST_ITERATE (vector< CRef<CThread> >, it, m_Threads) {
+            (*it)->Join();
+        }
+        m_Threads.clear();
+        x_CheckError();
+        m_Finished = true;
+        return;
+    }
+#endif
+
+    x_Commit(*m_Loaders.front(), true);
+    m_Finished = true;
+}
+
+
+Uint8 CDB_BulkLoader::GetCommittedRows(void) const
+{
+    CFastMutexGuard guard(m_Mutex);
+    return m_CommittedRows;
+}
+
+
+void CDB_BulkLoader::x_Start(void)
+{
+    CHECK_DRIVER_ERROR(m_Prototypes.empty(), "No columns to load", 200040);
+    m_Started = true;
+
+    if ( !m_ProgressPath.empty() ) {
+        x_ReadProgress();
+    }
+
+    NON_CONST_ITERATE (TLoaders, it, m_Loaders) {
+        SLoader& loader = **it;
+        loader.cmd.reset(loader.conn->BCPIn(m_TableName));
+        if ( !m_Hints.empty() ) {
+            loader.cmd->SetHints(m_Hints);
+        }
+    }
+
+    m_AllBatches.push_back(m_Current = new SBatch);
+
+#ifdef HAVE_BULK_LOADER_THREADS
+    m_ConvertersLeft = m_NConverters;
+    for (unsigned int i = 0;  i < m_NConverters;  ++i) {
+        m_Threads.push_back(CRef<CThread>(new CWorkerThread(*this, NULL)));
+    }
+    NON_CONST_ITERATE (TLoaders, it, m_Loaders) {
+        m_Threads.push_back(CRef<CThread>(new CWorkerThread(*this, *it)));
+    }
+    NON_CONST_ITERATE (vector< CRef<CThread> >, it, m_Threads) {
+        (*it)->Run();
+    }
+#endif
+}
+
+
+void CDB_BulkLoader::x_ReadProgress(void)
+{
+    const string kHeader = "# CDB_BulkLoader " + m_TableName + " batch_rows="
+        + NStr::NumericToString(m_BatchRows);
+
+    bool has_header = false;
+    {{
+        CNcbiIfstream in(m_ProgressPath.c_str());
+        string line;
+        while (NcbiGetlineEOL(in, line)) {
+            if ( !has_header ) {
+                CHECK_DRIVER_ERROR(line != kHeader,
+                                   "Progress file " + m_ProgressPath
+                                   + " is for another load: " + line,
+                                   200043);
+                has_header = true;
+            } else if ( !line.empty() ) {
+                Uint8 n = NStr::StringToUInt8(line, NStr::fConvErr_NoThrow);
+                CHECK_DRIVER_ERROR(n == 0  &&  errno != 0,
+                                   "Malformed progress file " + m_ProgressPath
+                                   + ": " + line,
+                                   200043);
+                m_Committed.insert(n);
+            }
+        }
+    }}
+
+    m_Progress.reset(new CNcbiOfstream(m_ProgressPath.c_str(),
+                                       IOS_BASE::out | IOS_BASE::app));
+    if ( !has_header ) {
+        *m_Progress << kHeader << endl;
+    }
+    CHECK_DRIVER_ERROR( !*m_Progress,
+                        "Cannot write progress file " + m_ProgressPath,
+                        200043);
+}
+
+
+void CDB_BulkLoader::x_Submit(void)
+{
+    SBatch& batch = *m_Current;
+    batch.number = m_NextNumber++;
+
+    if (m_Committed.find(batch.number) != m_Committed.end()) {
+        m_SkippedRows += batch.n_rows;
+        batch.Clear();
+        return;
+    }
+
+    x_CheckError();
+
+#ifdef HAVE_BULK_LOADER_THREADS
+    if ( !m_Threads.empty() ) {
+        // Keep a few batches per worker in flight; beyond that, the caller
+        // waits for one to be recycled.
+        const size_t kMaxBatches = 2 * (m_NConverters + m_NConnections);
+
+        {{
+            CFastMutexGuard guard(m_Mutex);
+            m_ToConvert.push_back(m_Current);
+            m_Current = NULL;
+            m_Cond.SignalAll();
+            while ( !m_Stop  &&  m_Free.empty()
+                    &&  m_AllBatches.size() >= kMaxBatches) {
+                m_Cond.WaitForSignal(m_Mutex);
+            }
+            if (m_Free.empty()) {
+                m_AllBatches.push_back(m_Current = new SBatch);
+            } else {
+                m_Current = m_Free.front();
+                m_Free.pop_front();
+            }
+        }}
+        x_CheckError();
+        return;
+    }
+#endif
+
+    x_Convert(batch);
+    x_Load(*m_Loaders.front(), batch);
+    batch.Clear();
+}
+
+
+void CDB_BulkLoader::x_Convert(SBatch& batch)
+{
+    const size_t n_cols   = m_Prototypes.size();
+    const size_t n_fields = batch.n_rows * n_cols;
+
+    for (size_t i = batch.values.size();  i < n_fields;  ++i) {
+        batch.values.push_back(m_Prototypes[i % n_cols]->Clone());
+    }
+
+    for (size_t i = 0;  i < n_fields;  ++i) {
+        CDB_Object& value = *batch.values[i];
+        if (batch.nulls[i]) {
+            value.AssignNULL();
+            continue;
+        }
+        try {
+            s_AssignText(value, batch.GetField(i), m_TimeFormat);
+        }
+        catch (CException& e) {
+            DATABASE_DRIVER_ERROR_EX(e, "Cannot convert \""
+                                     + string(batch.GetField(i))
+                                     + "\" in column "
+                                     + NStr::NumericToString(i % n_cols + 1)
+                                     + " of row "
+                                     + NStr::NumericToString
+                                     (batch.number * m_BatchRows
+                                      + i / n_cols),
+                                     200041);
+        }
+    }
+}
+
+
+void CDB_BulkLoader::x_Load(SLoader& loader, SBatch& batch)
+{
+    CDB_BCPInCmd& cmd    = *loader.cmd;
+    const size_t  n_cols = m_Prototypes.size();
+
+    CDB_Object* const* value = batch.values.empty() ? NULL : &batch.values[0];
+    for (size_t row = 0;  row < batch.n_rows;  ++row) {
+        for (unsigned int col = 0;  col < n_cols;  ++col) {
+            cmd.Bind(col, *value++);
+        }
+        cmd.SendRow();
+    }
+
+    loader.pending.push_back(batch.number);
+    loader.pending_rows += batch.n_rows;
+    if (loader.pending_rows >= max(m_CommitRows, size_t(1))) {
+        x_Commit(loader, false);
+    }
+}
+
+
+void CDB_BulkLoader::x_Commit(SLoader& loader, bool last)
+{
+    // Both report failures by returning false as well as by throwing.
+    bool done = last ? loader.cmd->CompleteBCP() : loader.cmd->CompleteBatch();
+    CHECK_DRIVER_ERROR( !done  &&  loader.pending_rows > 0,
+                        "Cannot commit bulk load into " + m_TableName,
+                        200042 );
+
+    CFastMutexGuard guard(m_Mutex);
+    m_CommittedRows += loader.pending_rows;
+    if (m_Progress.get() != NULL  &&  !loader.pending.empty()) {
+        ITERATE (vector<Uint8>, it, loader.pending) {
+            *m_Progress << *it << '\n';
+        }
+        m_Progress->flush();
+        CHECK_DRIVER_ERROR( !*m_Progress,
+                            "Cannot write progress file " + m_ProgressPath,
+                            200043);
+    }
+    loader.pending.clear();
+    loader.pending_rows = 0;
+}
+
+
+void CDB_BulkLoader::x_Abort(SLoader& loader)
+{
+    loader.pending.clear();
+    loader.pending_rows = 0;
+    if (loader.cmd.get() != NULL) {
+        try {
+            loader.cmd->Cancel();
+        }
+        NCBI_CATCH_ALL_X( 2, "Cannot cancel bulk load into " + m_TableName )
+        loader.cmd.reset();
+    }
+}
+
+
+void CDB_BulkLoader::x_Converter(void)
+{
+#ifdef HAVE_BULK_LOADER_THREADS
+    for (;;) {
+        SBatch* batch = NULL;
+        {{
+            CFastMutexGuard guard(m_Mutex);
+            while ( !m_Stop  &&  m_ToConvert.empty()  &&  !m_InputDone) {
+                m_Cond.WaitForSignal(m_Mutex);
+            }
+            if (m_Stop  ||  m_ToConvert.empty()) {
+                --m_ConvertersLeft;
+                m_Cond.SignalAll();
+                return;
+            }
+            batch = m_ToConvert.front();
+            m_ToConvert.pop_front();
+        }}
+
+        try {
+            x_Convert(*batch);
+        }
+        catch (CDB_Exception& e) {
+            x_SetError(e);
+            continue;
+        }
+        catch (exception& e) {
+            x_SetError(CDB_ClientEx(DIAG_COMPILE_INFO, NULL,
+                                    string("Bulk load conversion failed: ")
+                                    + e.what(),
+                                    eDiag_Error, 200042));
+            continue;
+        }
+
+        CFastMutexGuard guard(m_Mutex);
+        m_ToLoad.push_back(batch);
+        m_Cond.SignalAll();
+    }
+#endif
+}
+
+
+void CDB_BulkLoader::x_Loader(SLoader& loader)
+{
+#ifdef HAVE_BULK_LOADER_THREADS
+    try {
+        for (;;) {
+            SBatch* batch = NULL;
+            {{
+                CFastMutexGuard guard(m_Mutex);
+                while ( !m_Stop  &&  m_ToLoad.empty()
+                        &&  m_ConvertersLeft > 0) {
+                    m_Cond.WaitForSignal(m_Mutex);
+                }
+                if (m_Stop) {
+                    break;
+                }
+                if (m_ToLoad.empty()) {
+                    // All rows sent
+                    guard.Release();
+                    x_Commit(loader, true);
+                    return;
+                }
+                batch = m_ToLoad.front();
+                m_ToLoad.pop_front();
+            }}
+
+            x_Load(loader, *batch);
+
+            CFastMutexGuard guard(m_Mutex);
+            batch->Clear();
+            m_Free.push_back(batch);
+            m_Cond.SignalAll();
+        }
+    }
+    catch (CDB_Exception& e) {
+        x_SetError(e);
+    }
+    catch (exception& e) {
+        x_SetError(CDB_ClientEx(DIAG_COMPILE_INFO, NULL,
+                                string("Bulk load failed: ") + e.what(),
+                                eDiag_Error, 200042));
+    }
+    x_Abort(loader);
+#endif
+}
+
+
+void CDB_BulkLoader::x_SetError(const CDB_Exception& error)
+{
+    CFastMutexGuard guard(m_Mutex);
+    if (m_Error.get() == NULL) {
+        m_Error.reset(error.Clone());
+    }
+    m_Stop = true;
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    m_Cond.SignalAll();
+#endif
+}
+
+
+void CDB_BulkLoader::x_CheckError(void)
+{
+    bool failed;
+    {{
+        CFastMutexGuard guard(m_Mutex);
+        failed = m_Error.get() != NULL;
+    }}
+    if (failed) {
+        // Let the workers wind down first, so that the counters are final
+        // by the time the caller sees the error.
+        x_Stop();
+        m_Error->Throw();
+    }
+}
+
+
+void CDB_BulkLoader::x_Stop(void)
+{
+#ifdef HAVE_BULK_LOADER_THREADS
+    if ( !m_Threads.empty() ) {
+        {{
+            CFastMutexGuard guard(m_Mutex);
+            m_Stop = true;
+            m_Cond.SignalAll();
+        }}
+        NON_CONST_ITERATE (vector< CRef<CThread> >, it, m_Threads) {
+            (*it)->Join();
+        }
+        m_Threads.clear();
+    }
+#endif
+}
+
+
+END_NCBI_SCOPE
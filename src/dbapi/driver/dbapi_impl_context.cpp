@@ -51,6 +51,10 @@ BEGIN_NCBI_SCOPE
 
 #define NCBI_USE_ERRCODE_X  Dbapi_DrvrContext
 
+#if defined(NCBI_THREADS)  &&  defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+#  define HAVE_CONN_POOL_WAIT 1
+#endif
+
 
 NCBI_PARAM_DEF_EX(bool, dbapi, conn_use_encrypt_data, false, eParam_NoThread, NULL);
 
@@ -59,16 +63,111 @@ namespace impl
 {
 
 ///////////////////////////////////////////////////////////////////////////
-//  CDriverContext::
+//  Named connection pools
 //
 
-CDriverContext::CDriverContext(void) :
+SConnPoolStats::SConnPoolStats(void)
+    : in_use(0), idle(0), waiting(0), reused(0), opened(0), waits(0),
+      timeouts(0), overflows(0), discarded(0), evicted(0)
+{
+}
+
+
+struct CDriverContext::SConnPool
+{
+    SConnPool(void) : creating(0) { }
+
+    void SignalWaiter(void)
+    {
+#ifdef HAVE_CONN_POOL_WAIT
+        if (stats.waiting > 0) {
+            cond.SignalSome();
+        }
+#endif
+    }
+
+    TConnPool          idle;      // Least recently used first
+    TConnPool          in_use;
+    // Places set aside for connections being opened
+    unsigned int       creating;
+#ifdef HAVE_CONN_POOL_WAIT
+    // Signalled whenever a connection or a place may have been freed
+    CConditionVariable cond;
+#endif
+    SConnPoolStats     stats;     // in_use and idle are not maintained here
+};
+
+
+struct CDriverContext::SPoolShard
+{
+    typedef map<string, SConnPool*> TPools;
+
+    ~SPoolShard(void)
+    {
+        ITERATE (TPools, it, pools) {
+            delete it->second;
+        }
+    }
+
+    CFastMutex mutex;
+    TPools     pools;
+};
+
+
 #ifdef NCBI_THREADS
-    m_PoolSem(0, 1),
+// Closes connections that have been idle longer than their pool allows.
+class CDriverContext::CIdleConnCloser : public CThread
+{
+public:
+    CIdleConnCloser(CDriverContext& context)
+        : m_Context(context), m_StopSem(0, 1)
+    {
+    }
+
+    void Stop(void)
+    {
+        m_StopSem.Post();
+        Join();
+    }
+
+protected:
+    virtual void* Main(void)
+    {
+        while ( !m_StopSem.TryWait(1) ) {
+            // Do not wait for the context mutex: its holder may be about to
+            // stop this thread.
+            SSystemMutex& mtx = m_Context.x_GetCtxMtx();
+            if ( !mtx.TryLock() ) {
+                continue;
+            }
+            try {
+                m_Context.CloseOldIdleConns(kMax_UInt);
+            }
+            NCBI_CATCH_ALL_X(2, "Failed to close idle pooled connections");
+            mtx.Unlock();
+        }
+        return NULL;
+    }
+
+private:
+    CDriverContext& m_Context;
+    CSemaphore      m_StopSem;
+};
 #endif
+
+
+///////////////////////////////////////////////////////////////////////////
+//  CDriverContext::
+//
+
+CDriverContext::CDriverContext(void) :
     m_LoginTimeout(0),
     m_Timeout(0),
     m_CancelTimeout(0),
+    m_PoolShards(new SPoolShard[kPoolShards]),
+#ifdef NCBI_THREADS
+    m_IdleConnCloserStopped(false),
+#endif
     m_MaxBlobSize(0),
     m_ClientEncoding(eEncoding_ISO8859_1)
 {
@@ -78,7 +177,8 @@ CDriverContext::CDriverContext(void) :
 
 CDriverContext::~CDriverContext(void)
 {
-    return;
+    x_StopIdleConnCloser();
+    delete[] m_PoolShards;
 }
 
 void
@@ -222,6 +322,12 @@ void CDriverContext::PopDefConnMsgHandler(CDB_UserHandler* h)
         con = *it;
         con->PopMsgHandler(h);
     }
+
+    TConnPool pooled;
+    x_GetPooledConns(&pooled, &pooled);
+    ITERATE(TConnPool, it, pooled) {
+        (*it)->PopMsgHandler(h);
+    }
 }
 
 
@@ -270,41 +376,268 @@ void CDriverContext::ResetEnvSybase(void)
 
 void CDriverContext::x_Recycle(CConnection* conn, bool conn_reusable)
 {
-    CMutexGuard mg(x_GetCtxMtx());
+    bool keep = conn_reusable  &&  conn->IsOpeningFinished()
+        &&  conn->IsValid();
+    if (keep  &&  conn->m_PoolIdleTimeParam.GetSign() != eNegative) {
+        CTime now(CTime::eCurrent);
+        conn->m_CleanupTime = now + conn->m_PoolIdleTimeParam;
+    }
+
+    if ( !conn->PoolName().empty() ) {
+        // Named pools do not need the context mutex (unless the connection
+        // is to be deleted).
+        {{
+            SPoolShard& shard = x_GetPoolShard(conn->PoolName());
+            CFastMutexGuard guard(shard.mutex);
+            SConnPool& pool = x_GetPool(shard, conn->PoolName());
+            TConnPool::iterator it
+                = find(pool.in_use.begin(), pool.in_use.end(), conn);
+            if (it != pool.in_use.end()) {
+                pool.in_use.erase(it);
+            }
+            if (keep) {
+                pool.idle.push_back(conn);
+            }
+            pool.SignalWaiter();
+        }}
+        if ( !keep ) {
+            x_DeleteConn(conn);
+        }
+    } else {
+        CMutexGuard mg(x_GetCtxMtx());
+
+        TConnPool::iterator it = find(m_InUse.begin(), m_InUse.end(), conn);
 
-    TConnPool::iterator it = find(m_InUse.begin(), m_InUse.end(), conn);
+        if (it != m_InUse.end()) {
+            m_InUse.erase(it);
+        }
 
-    if (it != m_InUse.end()) {
-        m_InUse.erase(it);
+        if (keep) {
+            m_NotInUse.push_back(conn);
+        } else {
+            delete conn;
+        }
     }
 
-#ifdef NCBI_THREADS
-    bool for_sem = false;
-    if ( !m_PoolSemSubject.empty()  &&  conn->PoolName() == m_PoolSemSubject) {
-        for_sem = true;
-        m_PoolSemSubject.erase();
-        m_PoolSemConn = NULL;
-        m_PoolSem.TryWait(); // probably redundant, but ensures Post will work
-        m_PoolSem.Post();
+#ifndef NCBI_THREADS
+    // Otherwise, it is up to CIdleConnCloser
+    CloseOldIdleConns(1);
+#endif
+}
+
+CDriverContext::SPoolShard&
+CDriverContext::x_GetPoolShard(const string& pool_name) const
+{
+    size_t hash = 0;
+    ITERATE (string, it, pool_name) {
+        hash = hash * 31 + (unsigned char)(*it);
+    }
+    return m_PoolShards[hash % kPoolShards];
+}
+
+CDriverContext::SConnPool&
+CDriverContext::x_GetPool(SPoolShard& shard, const string& pool_name) const
+{
+    SConnPool*& pool = shard.pools[pool_name];
+    if (pool == NULL) {
+        pool = new SConnPool;
+    }
+    return *pool;
+}
+
+void CDriverContext::x_GetPooledConns(TConnPool* idle, TConnPool* in_use)
+    const
+{
+    for (unsigned int i = 0;  i < kPoolShards;  ++i) {
+        SPoolShard& shard = m_PoolShards[i];
+        CFastMutexGuard guard(shard.mutex);
+        ITERATE (SPoolShard::TPools, it, shard.pools) {
+            if (idle != NULL) {
+                idle->insert(idle->end(), it->second->idle.begin(),
+                             it->second->idle.end());
+            }
+            if (in_use != NULL) {
+                in_use->insert(in_use->end(), it->second->in_use.begin(),
+                               it->second->in_use.end());
+            }
+        }
+    }
+}
+
+void CDriverContext::x_TakePooledConns(TConnPool* idle, TConnPool* in_use)
+{
+    for (unsigned int i = 0;  i < kPoolShards;  ++i) {
+        SPoolShard& shard = m_PoolShards[i];
+        CFastMutexGuard guard(shard.mutex);
+        NON_CONST_ITERATE (SPoolShard::TPools, it, shard.pools) {
+            if (idle != NULL) {
+                idle->splice(idle->end(), it->second->idle);
+            }
+            if (in_use != NULL) {
+                in_use->splice(in_use->end(), it->second->in_use);
+            }
+        }
+    }
+}
+
+void CDriverContext::x_DeleteConn(CConnection* conn)
+{
+    CMutexGuard mg(x_GetCtxMtx());
+    delete conn;
+}
+
+CDB_Connection*
+CDriverContext::x_CheckOutPooled(const CDBConnParams& params, EPoolSlot* slot)
+{
+    const string pool_name(params.GetParam("pool_name"));
+    const bool   can_open = params.GetParam("do_not_connect") != "true";
+
+    int    pool_max  = 0;
+    double wait_time = 0.0;
+    string value(params.GetParam("pool_maxsize"));
+    if ( !value.empty()  &&  value != "default") {
+        pool_max = NStr::StringToInt(value);
+    }
+    value = params.GetParam("pool_wait_time");
+    if ( !value.empty()  &&  value != "default") {
+        wait_time = NStr::StringToDouble(value);
     }
+    CDeadline deadline = CDeadline(CTimeout(wait_time));
+
+    SPoolShard& shard = x_GetPoolShard(pool_name);
+    bool waited = false;
+    for (;;) {
+        CConnection* t_con = NULL;
+        {{
+            CFastMutexGuard guard(shard.mutex);
+            SConnPool& pool = x_GetPool(shard, pool_name);
+#ifdef HAVE_CONN_POOL_WAIT
+            if (pool_max > 0  &&  can_open) {
+                while (pool.idle.empty()
+                       &&  pool.in_use.size() + pool.creating
+                           >= size_t(pool_max)
+                       &&  !deadline.IsExpired()) {
+                    if ( !waited ) {
+                        waited = true;
+                        ++pool.stats.waits;
+                    }
+                    ++pool.stats.waiting;
+                    pool.cond.WaitForSignal(shard.mutex, deadline);
+                    --pool.stats.waiting;
+                }
+            }
 #endif
+            if ( !pool.idle.empty() ) {
+                // The most recently used one is the most likely to be fine
+                t_con = pool.idle.back();
+                pool.idle.pop_back();
+                pool.in_use.push_back(t_con);
+                t_con->m_CleanupTime.Clear();
+                ++pool.stats.reused;
+            } else if ( !can_open ) {
+                *slot = ePoolSlot_None;
+                return NULL;
+            } else if (pool_max <= 0
+                       ||  pool.in_use.size() + pool.creating
+                           < size_t(pool_max)) {
+                ++pool.creating;
+                *slot = ePoolSlot_Reserved;
+                return NULL;
+            } else if (params.GetParam("pool_allow_temp_overflow") == "true") {
+                ++pool.stats.overflows;
+                *slot = ePoolSlot_Overflow;
+                return NULL;
+            } else {
+                ++pool.stats.timeouts;
+                *slot = ePoolSlot_None;
+                return NULL;
+            }
+        }}
 
-    if (conn_reusable  &&  conn->IsOpeningFinished()  &&  conn->IsValid()) {
-        if (conn->m_PoolIdleTimeParam.GetSign() != eNegative) {
-            CTime now(CTime::eCurrent);
-            conn->m_CleanupTime = now + conn->m_PoolIdleTimeParam;
+        // Check the connection before handing it out, as
+        // CDBConnectionFactory would do, but without holding any lock.
+        CDB_Connection* conn = NULL;
+        if (t_con->Refresh()) {
+            conn = new CDB_Connection(t_con);
+            try {
+                CRef<IConnValidator> validator = params.GetConnValidator();
+                if (validator.Empty()
+                    ||  validator->Validate(*conn) == IConnValidator::eValidConn)
+                {
+                    conn->SetDatabaseName(params.GetDatabaseName());
+                    return conn;
+                }
+            }
+            catch (CDB_Exception& ex) {
+                _TRACE("Discarding pooled connection: " << ex);
+            }
+        }
+
+        {{
+            CFastMutexGuard guard(shard.mutex);
+            ++x_GetPool(shard, pool_name).stats.discarded;
+        }}
+        t_con->Invalidate();
+        if (conn != NULL) {
+            delete conn;
+        } else {
+            x_Recycle(t_con, false);
         }
-        m_NotInUse.push_back(conn);
+    }
+}
+
+void CDriverContext::x_ReleasePoolSlot(const string& pool_name)
+{
+    SPoolShard& shard = x_GetPoolShard(pool_name);
+    CFastMutexGuard guard(shard.mutex);
+    SConnPool& pool = x_GetPool(shard, pool_name);
+    --pool.creating;
+    pool.SignalWaiter();
+}
+
+void CDriverContext::x_StartIdleConnCloser(void)
+{
 #ifdef NCBI_THREADS
-        if (for_sem) {
-            m_PoolSemConn = conn;
+    CMutexGuard mg(x_GetCtxMtx());
+    if (m_IdleConnCloser.Empty()  &&  !m_IdleConnCloserStopped) {
+        try {
+            m_IdleConnCloser.Reset(new CIdleConnCloser(*this));
+            m_IdleConnCloser->Run();
         }
+        catch (CException& ex) {
+            ERR_POST_X(2, "Cannot start closing idle pooled connections: "
+                       << ex);
+            m_IdleConnCloser.Reset();
+            m_IdleConnCloserStopped = true;
+        }
+    }
 #endif
-    } else {
-        delete conn;
+}
+
+void CDriverContext::x_StopIdleConnCloser(void)
+{
+#ifdef NCBI_THREADS
+    m_IdleConnCloserStopped = true;
+    if (m_IdleConnCloser.NotEmpty()) {
+        m_IdleConnCloser->Stop();
+        m_IdleConnCloser.Reset();
     }
+#endif
+}
 
-    CloseOldIdleConns(1);
+void CDriverContext::GetPoolStats(TPoolStats* stats) const
+{
+    stats->clear();
+    for (unsigned int i = 0;  i < kPoolShards;  ++i) {
+        SPoolShard& shard = m_PoolShards[i];
+        CFastMutexGuard guard(shard.mutex);
+        ITERATE (SPoolShard::TPools, it, shard.pools) {
+            SConnPoolStats& pool_stats = (*stats)[it->first];
+            pool_stats        = it->second->stats;
+            pool_stats.in_use = (unsigned int) it->second->in_use.size();
+            pool_stats.idle   = (unsigned int) it->second->idle.size();
+        }
+    }
 }
 
 void CDriverContext::CloseUnusedConnections(const string&   srv_name,
@@ -325,6 +658,27 @@ void CDriverContext::CloseUnusedConnections(const string&   srv_name,
         --it;
         delete con;
     }
+
+    TConnPool unused;
+    for (unsigned int i = 0;  i < kPoolShards;  ++i) {
+        SPoolShard& shard = m_PoolShards[i];
+        CFastMutexGuard guard(shard.mutex);
+        NON_CONST_ITERATE (SPoolShard::TPools, pool_it, shard.pools) {
+            if ( !pool_name.empty()  &&  pool_name != pool_it->first) {
+                continue;
+            }
+            TConnPool& idle = pool_it->second->idle;
+            ERASE_ITERATE (TConnPool, it, idle) {
+                if (srv_name.empty()  ||  srv_name == (*it)->ServerName()) {
+                    unused.push_back(*it);
+                    idle.erase(it);
+                }
+            }
+        }
+    }
+    ITERATE (TConnPool, it, unused) {
+        delete *it;
+    }
 }
 
 unsigned int CDriverContext::NofConnections(const TSvrRef& svr_ref,
@@ -332,8 +686,12 @@ unsigned int CDriverContext::NofConnections(const TSvrRef& svr_ref,
 {
     CMutexGuard mg(x_GetCtxMtx());
 
+    TConnPool pooled;
+    x_GetPooledConns(&pooled, &pooled);
+
     if ((!svr_ref  ||  !svr_ref->IsValid())  &&  pool_name.empty()) {
-        return static_cast<unsigned int>(m_InUse.size() + m_NotInUse.size());
+        return static_cast<unsigned int>(m_InUse.size() + m_NotInUse.size()
+                                         + pooled.size());
     }
 
     string server;
@@ -346,7 +704,7 @@ unsigned int CDriverContext::NofConnections(const TSvrRef& svr_ref,
             server = svr_ref->GetName();
     }
 
-    const TConnPool* pools[] = {&m_NotInUse, &m_InUse};
+    const TConnPool* pools[] = {&m_NotInUse, &m_InUse, &pooled};
     int n = 0;
     for (size_t i = 0; i < ArraySize(pools); ++i) {
         ITERATE(TConnPool, it, (*pools[i])) {
@@ -377,7 +735,13 @@ unsigned int CDriverContext::NofConnections(const string& srv_name,
 CDB_Connection* CDriverContext::MakeCDBConnection(CConnection* connection)
 {
     connection->m_CleanupTime.Clear();
-    m_InUse.push_back(connection);
+    if (connection->PoolName().empty()) {
+        m_InUse.push_back(connection);
+    } else {
+        SPoolShard& shard = x_GetPoolShard(connection->PoolName());
+        CFastMutexGuard guard(shard.mutex);
+        x_GetPool(shard, connection->PoolName()).in_use.push_back(connection);
+    }
 
     return new CDB_Connection(connection);
 }
@@ -406,68 +770,71 @@ CDriverContext::MakePooledConnection(const CDBConnParams& params)
         CMutexGuard mg(x_GetCtxMtx());
 
         string pool_name(params.GetParam("pool_name"));
-        if (!m_NotInUse.empty()) {
-            if (!pool_name.empty()) {
-                // use a pool name
-                ERASE_ITERATE(TConnPool, it, m_NotInUse) {
-                    CConnection* t_con(*it);
-
-                    // There is no pool name check here. We assume that a connection
-                    // pool contains connections with appropriate server names only.
-                    if (pool_name == t_con->PoolName()) {
-                        it = m_NotInUse.erase(it);
-                        if(t_con->Refresh()) {
-                            /* Future development ...
-                            if (!params.GetDatabaseName().empty()) {
-                                return SetDatabase(MakeCDBConnection(t_con), params);
-                            } else {
-                                return MakeCDBConnection(t_con);
-                            }
-                            */
-                            
-                            return MakeCDBConnection(t_con);
-                        }
-                        else {
-                            delete t_con;
-                        }
+        if (!pool_name.empty()) {
+            // use a pool name
+            SPoolShard& shard = x_GetPoolShard(pool_name);
+            for (;;) {
+                CConnection* t_con = NULL;
+                {{
+                    CFastMutexGuard guard(shard.mutex);
+                    SConnPool& pool = x_GetPool(shard, pool_name);
+                    if (pool.idle.empty()) {
+                        break;
                     }
+                    t_con = pool.idle.back();
+                    pool.idle.pop_back();
+                    ++pool.stats.reused;
+                }}
+
+                // There is no pool name check here. We assume that a connection
+                // pool contains connections with appropriate server names only.
+                if (t_con->Refresh()) {
+                    return MakeCDBConnection(t_con);
                 }
-            }
-            else {
 
-                if ( params.GetServerName().empty() ) {
-                    return NULL;
-                }
-
-                // try to use a server name
-                ERASE_ITERATE(TConnPool, it, m_NotInUse) {
-                    CConnection* t_con(*it);
+                {{
+                    CFastMutexGuard guard(shard.mutex);
+                    ++x_GetPool(shard, pool_name).stats.discarded;
+                }}
+                delete t_con;
+            }
+        }
+        else if (!m_NotInUse.empty()) {
 
-                    if (params.GetServerName() == t_con->ServerName()) {
-                        it = m_NotInUse.erase(it);
-                        if (t_con->Refresh()) {
-                            /* Future development ...
-                            if (!params.GetDatabaseName().empty()) {
-                                return SetDatabase(MakeCDBConnection(t_con), params);
-                            } else {
-                                return MakeCDBConnection(t_con);
-                            }
-                            */
+            if ( params.GetServerName().empty() ) {
+                return NULL;
+            }
 
+            // try to use a server name
+            ERASE_ITERATE(TConnPool, it, m_NotInUse) {
+                CConnection* t_con(*it);
+
+                if (params.GetServerName() == t_con->ServerName()) {
+                    it = m_NotInUse.erase(it);
+                    if (t_con->Refresh()) {
+                        /* Future development ...
+                        if (!params.GetDatabaseName().empty()) {
+                            return SetDatabase(MakeCDBConnection(t_con), params);
+                        } else {
                             return MakeCDBConnection(t_con);
                         }
-                        else {
-                            delete t_con;
-                        }
+                        */
+
+                        return MakeCDBConnection(t_con);
+                    }
+                    else {
+                        delete t_con;
                     }
                 }
             }
         }
 
         // Connection should be created, but we can have limit on number of
-        // connections in the pool.
+        // connections in the pool.  (MakeConnection() has taken care of it
+        // for named pools, waiting for a connection if need be.)
         string pool_max_str(params.GetParam("pool_maxsize"));
-        if (!pool_max_str.empty()  &&  pool_max_str != "default") {
+        if (pool_name.empty()  &&  !pool_max_str.empty()
+            &&  pool_max_str != "default") {
             int pool_max = NStr::StringToInt(pool_max_str);
             if (pool_max != 0) {
                 int total_cnt = 0;
@@ -477,30 +844,6 @@ CDriverContext::MakePooledConnection(const CDBConnParams& params)
                         ++total_cnt;
                 }
                 if (total_cnt >= pool_max) {
-#ifdef NCBI_THREADS
-                    string timeout_str(params.GetParam("pool_wait_time"));
-                    double timeout_val = 0.0;
-                    if ( !timeout_str.empty()  &&  timeout_str != "default") {
-                        timeout_val = NStr::StringToDouble(timeout_str);
-                    }
-                    CTimeout timeout(timeout_val);
-                    m_PoolSemSubject = pool_name;
-                    mg.Release();
-                    if (m_PoolSem.TryWait(timeout)) {
-                        mg.Guard(x_GetCtxMtx());
-                        CConnection* t_con = NULL;
-                        NON_CONST_REVERSE_ITERATE(TConnPool, it, m_NotInUse) {
-                            if (*it == m_PoolSemConn) {
-                                t_con = m_PoolSemConn;
-                                m_PoolSemConn = NULL;
-                                m_NotInUse.erase((++it).base());
-                            }
-                        }
-                        if (t_con != NULL) {
-                            return MakeCDBConnection(t_con);
-                        }
-                    } else
-#endif
                     if (params.GetParam("pool_allow_temp_overflow")
                         == "true") {
                         return MakePooledConnection
@@ -540,12 +883,31 @@ CDriverContext::MakePooledConnection(const CDBConnParams& params)
 
     CConnection* t_con = MakeIConnection(params);
 
+    if ( !t_con->PoolName().empty()  &&  t_con->IsReusable() ) {
+        {{
+            SPoolShard& shard = x_GetPoolShard(t_con->PoolName());
+            CFastMutexGuard guard(shard.mutex);
+            ++x_GetPool(shard, t_con->PoolName()).stats.opened;
+        }}
+        if (t_con->m_PoolIdleTimeParam.GetSign() != eNegative) {
+            x_StartIdleConnCloser();
+        }
+    }
+
     return MakeCDBConnection(t_con);
 }
 
 void
 CDriverContext::CloseAllConn(void)
 {
+    x_StopIdleConnCloser();
+
+    // Connections in use stay in their pools, to be recycled normally
+    TConnPool pooled_idle, pooled_in_use;
+    x_TakePooledConns(&pooled_idle, NULL);
+    x_GetPooledConns(NULL, &pooled_in_use);
+    m_NotInUse.splice(m_NotInUse.end(), pooled_idle);
+
     // close all connections first
     ITERATE(TConnPool, it, m_NotInUse) {
         delete *it;
@@ -555,11 +917,21 @@ CDriverContext::CloseAllConn(void)
     ITERATE(TConnPool, it, m_InUse) {
         (*it)->Close();
     }
+    ITERATE(TConnPool, it, pooled_in_use) {
+        (*it)->Close();
+    }
 }
 
 void
 CDriverContext::DeleteAllConn(void)
 {
+    x_StopIdleConnCloser();
+
+    TConnPool pooled_idle, pooled_in_use;
+    x_TakePooledConns(&pooled_idle, &pooled_in_use);
+    m_NotInUse.splice(m_NotInUse.end(), pooled_idle);
+    m_InUse.splice(m_InUse.end(), pooled_in_use);
+
     // close all connections first
     ITERATE(TConnPool, it, m_NotInUse) {
         delete *it;
@@ -886,8 +1258,20 @@ CDriverContext::SatisfyPoolMinimum(const CDBConnParams& params)
         return true;
 
     string pool_name = params.GetParam("pool_name");
+    const TConnPool* in_use     = &m_InUse;
+    const TConnPool* not_in_use = &m_NotInUse;
+    TConnPool pooled_in_use, pooled_idle;
+    if ( !pool_name.empty() ) {
+        SPoolShard& shard = x_GetPoolShard(pool_name);
+        CFastMutexGuard guard(shard.mutex);
+        SConnPool& pool = x_GetPool(shard, pool_name);
+        pooled_in_use = pool.in_use;
+        pooled_idle   = pool.idle;
+        in_use     = &pooled_in_use;
+        not_in_use = &pooled_idle;
+    }
     int total_cnt = 0;
-    ITERATE(TConnPool, it, m_InUse) {
+    ITERATE(TConnPool, it, *in_use) {
         CConnection* t_con(*it);
         if (t_con->IsReusable()  &&  pool_name == t_con->PoolName()
             &&  t_con->IsValid()  &&  t_con->IsAlive())
@@ -895,7 +1279,7 @@ CDriverContext::SatisfyPoolMinimum(const CDBConnParams& params)
             ++total_cnt;
         }
     }
-    ITERATE(TConnPool, it, m_NotInUse) {
+    ITERATE(TConnPool, it, *not_in_use) {
         CConnection* t_con(*it);
         if (t_con->IsReusable()  &&  pool_name == t_con->PoolName()
             &&  t_con->IsAlive())
@@ -919,8 +1303,6 @@ CDriverContext::SatisfyPoolMinimum(const CDBConnParams& params)
 CDB_Connection* 
 CDriverContext::MakeConnection(const CDBConnParams& params)
 {
-    CMutexGuard mg(x_GetCtxMtx());
-
     CMakeConnActualParams act_params(params);
     SDBConfParams conf_params;
     conf_params.Clear();
@@ -928,18 +1310,112 @@ CDriverContext::MakeConnection(const CDBConnParams& params)
         ReadDBConfParams(params.GetServerName(), &conf_params);
     }
 
+    string server_name = (conf_params.IsServerSet()?   conf_params.server:
+                                                       params.GetServerName());
+    string user_name   = (conf_params.IsUsernameSet()? conf_params.username:
+                                                       params.GetUserName());
+    string db_name     = (conf_params.IsDatabaseSet()? conf_params.database:
+                                                       params.GetDatabaseName());
+    string password    = (conf_params.IsPasswordSet()? conf_params.password:
+                                                       params.GetPassword());
+    if (conf_params.IsSingleServerSet()) {
+        if (conf_params.single_server.empty()) {
+            act_params.SetParam("single_server", "true");
+        }
+        else {
+            act_params.SetParam("single_server",
+                                NStr::BoolToString(NStr::StringToBool(
+                                            conf_params.single_server)));
+        }
+    }
+    else if (params.GetParam("single_server") == "default") {
+        act_params.SetParam("single_server", "true");
+    }
+    if (conf_params.IsPooledSet()) {
+        if (conf_params.is_pooled.empty()) {
+            act_params.SetParam("is_pooled", "false");
+        }
+        else {
+            act_params.SetParam("is_pooled", 
+                                NStr::BoolToString(NStr::StringToBool(
+                                                conf_params.is_pooled)));
+            act_params.SetParam("pool_name", conf_params.pool_name);
+        }
+    }
+    else if (params.GetParam("is_pooled") == "default") {
+        act_params.SetParam("is_pooled", "false");
+    }
+    if (conf_params.IsPoolMinSizeSet())
+        act_params.SetParam("pool_minsize", conf_params.pool_minsize);
+    else if (params.GetParam("pool_minsize") == "default") {
+        act_params.SetParam("pool_minsize", "0");
+    }
+    if (conf_params.IsPoolMaxSizeSet())
+        act_params.SetParam("pool_maxsize", conf_params.pool_maxsize);
+    else if (params.GetParam("pool_maxsize") == "default") {
+        act_params.SetParam("pool_maxsize", "");
+    }
+    if (conf_params.IsPoolIdleTimeSet())
+        act_params.SetParam("pool_idle_time", conf_params.pool_idle_time);
+    else if (params.GetParam("pool_idle_time") == "default") {
+        act_params.SetParam("pool_idle_time", "");
+    }
+    if (conf_params.IsPoolWaitTimeSet())
+        act_params.SetParam("pool_wait_time", conf_params.pool_wait_time);
+    else if (params.GetParam("pool_wait_time") == "default") {
+        act_params.SetParam("pool_wait_time", "0");
+    }
+    if (conf_params.IsPoolAllowTempOverflowSet()) {
+        if (conf_params.pool_allow_temp_overflow.empty()) {
+            act_params.SetParam("pool_allow_temp_overflow", "false");
+        }
+        else {
+            act_params.SetParam
+                ("pool_allow_temp_overflow", 
+                 NStr::BoolToString(
+                     NStr::StringToBool(
+                         conf_params.pool_allow_temp_overflow)));
+        }
+    }
+    else if (params.GetParam("pool_allow_temp_overflow") == "default") {
+        act_params.SetParam("pool_allow_temp_overflow", "false");
+    }
+
+    s_TransformLoginData(server_name, user_name, db_name, password);
+    act_params.SetServerName(server_name);
+    act_params.SetUserName(user_name);
+    act_params.SetDatabaseName(db_name);
+    act_params.SetPassword(password);
+
+    // Connections of named pools are handed out without locking the whole
+    // context; one is opened below only if the pool has room for it.
+    const string pool_name(act_params.GetParam("pool_name"));
+    EPoolSlot    slot = ePoolSlot_None;
+    if (act_params.GetParam("is_pooled") == "true"  &&  !pool_name.empty()) {
+        CDB_Connection* pooled_con = x_CheckOutPooled(act_params, &slot);
+        if (pooled_con != NULL) {
+            return pooled_con;
+        }
+        if (slot == ePoolSlot_Overflow) {
+            act_params.SetParam("is_pooled", "false");
+        } else if (slot == ePoolSlot_None) {
+            if (act_params.GetParam("do_not_connect") == "true") {
+                return NULL;
+            }
+            DATABASE_DRIVER_ERROR("Cannot connect to the server '"
+                                  + act_params.GetServerName() + "' as user '"
+                                  + act_params.GetUserName()
+                                  + "': connection pool " + pool_name
+                                  + " is full", 100011);
+        }
+    }
+
+    CMutexGuard mg(x_GetCtxMtx());
+
     int was_timeout = GetTimeout();
     int was_login_timeout = GetLoginTimeout();
     CDB_Connection* t_con = NULL;
     try {
-        string server_name = (conf_params.IsServerSet()?   conf_params.server:
-                                                           params.GetServerName());
-        string user_name   = (conf_params.IsUsernameSet()? conf_params.username:
-                                                           params.GetUserName());
-        string db_name     = (conf_params.IsDatabaseSet()? conf_params.database:
-                                                           params.GetDatabaseName());
-        string password    = (conf_params.IsPasswordSet()? conf_params.password:
-                                                           params.GetPassword());
         if (conf_params.IsLoginTimeoutSet()) {
             if (conf_params.login_timeout.empty()) {
                 SetLoginTimeout(0);
@@ -991,83 +1467,10 @@ CDriverContext::MakeConnection(const CDBConnParams& params)
                 SetCancelTimeout(NStr::StringToInt(value));
             }
         }
-        if (conf_params.IsSingleServerSet()) {
-            if (conf_params.single_server.empty()) {
-                act_params.SetParam("single_server", "true");
-            }
-            else {
-                act_params.SetParam("single_server",
-                                    NStr::BoolToString(NStr::StringToBool(
-                                                conf_params.single_server)));
-            }
-        }
-        else if (params.GetParam("single_server") == "default") {
-            act_params.SetParam("single_server", "true");
-        }
-        if (conf_params.IsPooledSet()) {
-            if (conf_params.is_pooled.empty()) {
-                act_params.SetParam("is_pooled", "false");
-            }
-            else {
-                act_params.SetParam("is_pooled", 
-                                    NStr::BoolToString(NStr::StringToBool(
-                                                    conf_params.is_pooled)));
-                act_params.SetParam("pool_name", conf_params.pool_name);
-            }
-        }
-        else if (params.GetParam("is_pooled") == "default") {
-            act_params.SetParam("is_pooled", "false");
-        }
-        if (conf_params.IsPoolMinSizeSet())
-            act_params.SetParam("pool_minsize", conf_params.pool_minsize);
-        else if (params.GetParam("pool_minsize") == "default") {
-            act_params.SetParam("pool_minsize", "0");
-        }
-        if (conf_params.IsPoolMaxSizeSet())
-            act_params.SetParam("pool_maxsize", conf_params.pool_maxsize);
-        else if (params.GetParam("pool_maxsize") == "default") {
-            act_params.SetParam("pool_maxsize", "");
-        }
-        if (conf_params.IsPoolIdleTimeSet())
-            act_params.SetParam("pool_idle_time", conf_params.pool_idle_time);
-        else if (params.GetParam("pool_idle_time") == "default") {
-            act_params.SetParam("pool_idle_time", "");
-        }
-        if (conf_params.IsPoolWaitTimeSet())
-            act_params.SetParam("pool_wait_time", conf_params.pool_wait_time);
-        else if (params.GetParam("pool_wait_time") == "default") {
-            act_params.SetParam("pool_wait_time", "0");
-        }
-        if (conf_params.IsPoolAllowTempOverflowSet()) {
-            if (conf_params.pool_allow_temp_overflow.empty()) {
-                act_params.SetParam("pool_allow_temp_overflow", "false");
-            }
-            else {
-                act_params.SetParam
-                    ("pool_allow_temp_overflow", 
-                     NStr::BoolToString(
-                         NStr::StringToBool(
-                             conf_params.pool_allow_temp_overflow)));
-            }
-        }
-        else if (params.GetParam("pool_allow_temp_overflow") == "default") {
-            act_params.SetParam("pool_allow_temp_overflow", "false");
-        }
-
-        s_TransformLoginData(server_name, user_name, db_name, password);
-        act_params.SetServerName(server_name);
-        act_params.SetUserName(user_name);
-        act_params.SetDatabaseName(db_name);
-        act_params.SetPassword(password);
-
         CRef<IDBConnectionFactory> factory = CDbapiConnMgr::Instance().GetConnectionFactory();
         t_con = factory->MakeDBConnection(*this, act_params);
 
-        if((!t_con && act_params.GetParam("do_not_connect") == "true")) {
-            return NULL;
-        }
-
-        if (!t_con) {
+        if (!t_con  &&  act_params.GetParam("do_not_connect") != "true") {
             string err;
             err += "Cannot connect to the server '" + act_params.GetServerName();
             err += "' as user '" + act_params.GetUserName() + "'";
@@ -1083,16 +1486,24 @@ CDriverContext::MakeConnection(const CDBConnParams& params)
         }
 
         // Set database ...
-        t_con->SetDatabaseName(act_params.GetDatabaseName());
+        if (t_con) {
+            t_con->SetDatabaseName(act_params.GetDatabaseName());
+        }
 
     }
     catch (exception&) {
         SetTimeout(was_timeout);
         SetLoginTimeout(was_login_timeout);
+        if (slot == ePoolSlot_Reserved) {
+            x_ReleasePoolSlot(pool_name);
+        }
         throw;
     }
     SetTimeout(was_timeout);
     SetLoginTimeout(was_login_timeout);
+    if (slot == ePoolSlot_Reserved) {
+        x_ReleasePoolSlot(pool_name);
+    }
 
     return t_con;
 }
@@ -1114,6 +1525,30 @@ void CDriverContext::CloseConnsForPool(const string& pool_name)
             delete t_con;
         }
     }
+
+    if (pool_name.empty()) {
+        return;
+    }
+    TConnPool to_delete;
+    {{
+        SPoolShard& shard = x_GetPoolShard(pool_name);
+        CFastMutexGuard guard(shard.mutex);
+        SConnPool& pool = x_GetPool(shard, pool_name);
+        ITERATE(TConnPool, it, pool.in_use) {
+            if ((*it)->IsReusable()) {
+                (*it)->Invalidate();
+            }
+        }
+        ERASE_ITERATE(TConnPool, it, pool.idle) {
+            if ((*it)->IsReusable()) {
+                to_delete.push_back(*it);
+                pool.idle.erase(it);
+            }
+        }
+    }}
+    ITERATE(TConnPool, it, to_delete) {
+        delete *it;
+    }
 }
 
 
@@ -1124,28 +1559,39 @@ void CDriverContext::CloseOldIdleConns(unsigned int max_closings,
         return;
     }
 
-    set<string> at_min;
+    CMutexGuard mg(x_GetCtxMtx());
+
     CTime now(CTime::eCurrent);
-    ERASE_ITERATE (TConnPool, it, m_NotInUse) {
-        const string& pool_name_2 = (*it)->PoolName();
-        if (pool_name_2.empty()
-            ||  ( !pool_name.empty()  &&  pool_name != pool_name_2)
-            ||  at_min.find(pool_name_2) != at_min.end()
-            ||  (*it)->m_CleanupTime.IsEmpty()
-            ||  (*it)->m_CleanupTime > now) {
-            continue;
-        }
-        unsigned int n = NofConnections(TSvrRef(), pool_name_2);
-        if (n > (*it)->m_PoolMinSize) {
-            delete *it;
-            m_NotInUse.erase(it);
-            if (--max_closings == 0) {
-                break;
+    TConnPool to_delete;
+    for (unsigned int i = 0;  i < kPoolShards  &&  max_closings > 0;  ++i) {
+        SPoolShard& shard = m_PoolShards[i];
+        CFastMutexGuard guard(shard.mutex);
+        NON_CONST_ITERATE (SPoolShard::TPools, pool_it, shard.pools) {
+            if ( !pool_name.empty()  &&  pool_name != pool_it->first) {
+                continue;
+            }
+            SConnPool& pool = *pool_it->second;
+            size_t n = pool.idle.size() + pool.in_use.size() + pool.creating;
+            // Oldest first
+            ERASE_ITERATE (TConnPool, it, pool.idle) {
+                if (n <= (*it)->m_PoolMinSize  ||  max_closings == 0) {
+                    break;
+                }
+                if ((*it)->m_CleanupTime.IsEmpty()
+                    ||  (*it)->m_CleanupTime > now) {
+                    continue;
+                }
+                to_delete.push_back(*it);
+                pool.idle.erase(it);
+                ++pool.stats.evicted;
+                --n;
+                --max_closings;
             }
-        } else {
-            at_min.insert(pool_name_2);
         }
     }
+    ITERATE (TConnPool, it, to_delete) {
+        delete *it;
+    }
 }
 
 
@@ -1196,6 +1642,12 @@ void CDriverContext::UpdateConnTimeout(void) const
 
         t_con->SetTimeout(GetTimeout());
     }
+
+    TConnPool pooled;
+    x_GetPooledConns(&pooled, &pooled);
+    ITERATE(TConnPool, it, pooled) {
+        (*it)->SetTimeout(GetTimeout());
+    }
 }
 
 
@@ -1216,6 +1668,12 @@ void CDriverContext::UpdateConnMaxBlobSize(void) const
 
         t_con->SetBlobSize(GetMaxBlobSize());
     }
+
+    TConnPool pooled;
+    x_GetPooledConns(&pooled, &pooled);
+    ITERATE(TConnPool, it, pooled) {
+        (*it)->SetBlobSize(GetMaxBlobSize());
+    }
 }
 
 
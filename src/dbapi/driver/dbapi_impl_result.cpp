@@ -30,6 +30,7 @@
 #include <ncbi_pch.hpp>
 
 #include <dbapi/driver/impl/dbapi_impl_result.hpp>
+#include <dbapi/driver/dbapi_result_batch.hpp>
 #include <dbapi/error_codes.hpp>
 
 
@@ -61,6 +62,25 @@ CResult::GetDefineParams(void) const
     return m_CachedRowInfo;
 }
 
+size_t
+CResult::FetchBatch(CDB_ResultBatch& batch, size_t max_rows)
+{
+    batch.Reset(GetDefineParams());
+
+    const size_t n_cols = batch.GetNumColumns();
+    while (batch.GetNumRows() < max_rows  &&  Fetch()) {
+        for (size_t i = 0;  i < n_cols;  ++i) {
+            CDB_ResultBatch::CColumn& col = batch.SetColumn(i);
+            CDB_Object& item = col.GetScratch();
+            GetItem(&item, I_Result::eAssignLOB);
+            col.AppendValue(item);
+        }
+        batch.FinishRow();
+    }
+
+    return batch.GetNumRows();
+}
+
 
 } // namespace impl
 
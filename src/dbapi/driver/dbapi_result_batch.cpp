@@ -0,0 +1,523 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:  Columnar (batch) retrieval of result sets
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <dbapi/driver/dbapi_result_batch.hpp>
+#include <dbapi/driver/exception.hpp>
+#include <dbapi/driver/util/numeric_convert.hpp>
+#include <dbapi/error_codes.hpp>
+
+
+#define NCBI_USE_ERRCODE_X   Dbapi_DrvrResult
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CDB_ResultBatch::
+//
+
+CDB_ResultBatch::EStorage CDB_ResultBatch::GetStorage(EDB_Type type)
+{
+    switch (type) {
+    case eDB_Int:
+    case eDB_SmallInt:
+    case eDB_TinyInt:
+    case eDB_BigInt:
+    case eDB_Bit:
+        return eStorage_Int;
+    case eDB_Float:
+    case eDB_Double:
+        return eStorage_Double;
+    case eDB_DateTime:
+    case eDB_SmallDateTime:
+        return eStorage_DateTime;
+    default:
+        return eStorage_Bytes;
+    }
+}
+
+
+CDB_ResultBatch::CColumn::CColumn(const string& name, EDB_Type type,
+                                  size_t max_size)
+    : m_Name(name),
+      m_Type(type),
+      m_Storage(CDB_ResultBatch::GetStorage(type)),
+      m_MaxSize(max_size),
+      m_DataSize(0)
+{
+    m_Offsets.push_back(0);
+}
+
+
+CDB_ResultBatch::CColumn::~CColumn(void)
+{
+}
+
+
+void CDB_ResultBatch::CColumn::Clear(void)
+{
+    // clear() keeps the capacity, so refilling does not reallocate.
+    m_Nulls.clear();
+    m_Ints.clear();
+    m_Doubles.clear();
+    m_Times.clear();
+    m_Offsets.resize(1);
+    m_DataSize = 0;
+}
+
+
+void CDB_ResultBatch::CColumn::AppendNULL(void)
+{
+    switch (m_Storage) {
+    case eStorage_Int:       m_Ints.push_back(0);          break;
+    case eStorage_Double:    m_Doubles.push_back(0.0);     break;
+    case eStorage_DateTime:  m_Times.push_back(CTime());   break;
+    case eStorage_Bytes:     m_Offsets.push_back(m_DataSize);  break;
+    }
+    m_Nulls.push_back(1);
+}
+
+
+void CDB_ResultBatch::CColumn::AppendInt8(Int8 value)
+{
+    _ASSERT(m_Storage == eStorage_Int);
+    m_Ints.push_back(value);
+    m_Nulls.push_back(0);
+}
+
+
+void CDB_ResultBatch::CColumn::AppendDouble(double value)
+{
+    _ASSERT(m_Storage == eStorage_Double);
+    m_Doubles.push_back(value);
+    m_Nulls.push_back(0);
+}
+
+
+void CDB_ResultBatch::CColumn::AppendTime(const CTime& value)
+{
+    _ASSERT(m_Storage == eStorage_DateTime);
+    m_Times.push_back(value);
+    m_Nulls.push_back(0);
+}
+
+
+char* CDB_ResultBatch::CColumn::ReserveBytes(size_t max_size)
+{
+    _ASSERT(m_Storage == eStorage_Bytes);
+    size_t need = m_DataSize + max_size;
+    if (need > m_Data.size()) {
+        m_Data.resize(max(need, m_Data.size() * 2));
+    }
+    return m_Data.data() + m_DataSize;
+}
+
+
+void CDB_ResultBatch::CColumn::CommitBytes(size_t size)
+{
+    _ASSERT(m_DataSize + size <= m_Data.size());
+    m_DataSize += size;
+    m_Offsets.push_back(m_DataSize);
+    m_Nulls.push_back(0);
+}
+
+
+void CDB_ResultBatch::CColumn::AppendBytes(const void* data, size_t size)
+{
+    char* buf = ReserveBytes(size);
+    if (size > 0) {
+        memcpy(buf, data, size);
+    }
+    CommitBytes(size);
+}
+
+
+void CDB_ResultBatch::CColumn::AppendValue(const CDB_Object& value)
+{
+    EDB_Type type = value.GetType();
+    CHECK_DRIVER_ERROR(CDB_ResultBatch::GetStorage(type) != m_Storage,
+                       string("Cannot store ") + CDB_Object::GetTypeName(type)
+                       + " in a batch column of type "
+                       + CDB_Object::GetTypeName(m_Type),
+                       200030);
+
+    if (value.IsNULL()) {
+        AppendNULL();
+        return;
+    }
+
+    switch (type) {
+    case eDB_Int:
+        AppendInt8(static_cast<const CDB_Int&>(value).Value());
+        break;
+    case eDB_SmallInt:
+        AppendInt8(static_cast<const CDB_SmallInt&>(value).Value());
+        break;
+    case eDB_TinyInt:
+        AppendInt8(static_cast<const CDB_TinyInt&>(value).Value());
+        break;
+    case eDB_BigInt:
+        AppendInt8(static_cast<const CDB_BigInt&>(value).Value());
+        break;
+    case eDB_Bit:
+        AppendInt8(static_cast<const CDB_Bit&>(value).Value());
+        break;
+    case eDB_Float:
+        AppendDouble(static_cast<const CDB_Float&>(value).Value());
+        break;
+    case eDB_Double:
+        AppendDouble(static_cast<const CDB_Double&>(value).Value());
+        break;
+    case eDB_DateTime:
+        AppendTime(static_cast<const CDB_DateTime&>(value).Value());
+        break;
+    case eDB_SmallDateTime:
+        AppendTime(static_cast<const CDB_SmallDateTime&>(value).Value());
+        break;
+    case eDB_VarChar:
+    case eDB_Char:
+    case eDB_LongChar:
+    {
+        const CDB_String& str = static_cast<const CDB_String&>(value);
+        AppendBytes(str.Data(), str.Size());
+        break;
+    }
+    case eDB_VarBinary:
+    {
+        const CDB_VarBinary& bin = static_cast<const CDB_VarBinary&>(value);
+        AppendBytes(bin.Value(), bin.Size());
+        break;
+    }
+    case eDB_Binary:
+    {
+        const CDB_Binary& bin = static_cast<const CDB_Binary&>(value);
+        AppendBytes(bin.Value(), bin.Size());
+        break;
+    }
+    case eDB_LongBinary:
+    {
+        const CDB_LongBinary& bin = static_cast<const CDB_LongBinary&>(value);
+        AppendBytes(bin.Value(), bin.DataSize());
+        break;
+    }
+    case eDB_Numeric:
+    {
+        const CDB_Numeric& num = static_cast<const CDB_Numeric&>(value);
+        AppendNumeric(num.Precision(), num.Scale(), num.RawData());
+        break;
+    }
+    case eDB_Text:
+    case eDB_Image:
+    case eDB_VarCharMax:
+    case eDB_VarBinaryMax:
+    {
+        // Reading a stream moves its position, hence the const_cast.
+        CDB_Stream& stream
+            = const_cast<CDB_Stream&>(static_cast<const CDB_Stream&>(value));
+        size_t size = stream.Size();
+        stream.MoveTo(0);
+        CommitBytes(stream.Read(ReserveBytes(size), size));
+        break;
+    }
+    default:
+        DATABASE_DRIVER_ERROR(string("Unsupported batch column type ")
+                              + CDB_Object::GetTypeName(type, false),
+                              200031);
+    }
+}
+
+
+void CDB_ResultBatch::CColumn::AppendNumeric(unsigned int precision,
+                                             unsigned int scale,
+                                             const unsigned char* raw)
+{
+    // numeric_to_longlong() returns 0 for zero and for values that do not
+    // fit into Int8; CDB_Numeric::Value() sorts those out (slowly).
+    Int8 value
+        = numeric_to_longlong(precision, const_cast<unsigned char*>(raw));
+    if (value == 0) {
+        CDB_Numeric num(precision, scale, raw);
+        string str = num.Value();
+        AppendBytes(str.data(), str.size());
+        return;
+    }
+
+    // Same layout as CDB_Numeric::Value(): at least one digit before the
+    // decimal point, and exactly "scale" digits after it.
+    char digits[32];
+    char* end = digits + sizeof(digits);
+    char* p   = end;
+    Uint8 mag = value < 0 ? Uint8(-value) : Uint8(value);
+    for ( ;  mag != 0;  mag /= 10) {
+        *--p = char('0' + mag % 10);
+    }
+    while (size_t(end - p) <= scale) {
+        *--p = '0';
+    }
+
+    size_t n_digits = end - p;
+    size_t size     = n_digits + (value < 0 ? 1 : 0) + (scale > 0 ? 1 : 0);
+    char*  buf      = ReserveBytes(size);
+    char*  out      = buf;
+    if (value < 0) {
+        *out++ = '-';
+    }
+    memcpy(out, p, n_digits - scale);
+    out += n_digits - scale;
+    if (scale > 0) {
+        *out++ = '.';
+        memcpy(out, end - scale, scale);
+    }
+    CommitBytes(size);
+}
+
+
+CDB_Object& CDB_ResultBatch::CColumn::GetScratch(void)
+{
+    if (m_Scratch.get() == NULL) {
+        m_Scratch.reset(CDB_Object::Create(m_Type, max(m_MaxSize, size_t(1))));
+    }
+    return *m_Scratch;
+}
+
+
+CDB_ResultBatch::CDB_ResultBatch(void)
+    : m_NumRows(0)
+{
+}
+
+
+CDB_ResultBatch::~CDB_ResultBatch(void)
+{
+}
+
+
+void CDB_ResultBatch::Reset(const CDBParams& params)
+{
+    const unsigned int n_cols = params.GetNum();
+
+    bool same_layout = (m_Columns.size() == n_cols);
+    for (unsigned int i = 0;  same_layout  &&  i < n_cols;  ++i) {
+        const CColumn& col = *m_Columns[i];
+        same_layout = (col.GetDataType() == params.GetDataType(i)
+                       &&  col.GetMaxSize() == params.GetMaxSize(i)
+                       &&  col.GetName() == params.GetName(i));
+    }
+
+    if ( !same_layout ) {
+        m_Columns.clear();
+        m_Columns.reserve(n_cols);
+        for (unsigned int i = 0;  i < n_cols;  ++i) {
+            m_Columns.push_back(CRef<CColumn>
+                                (new CColumn(params.GetName(i),
+                                             params.GetDataType(i),
+                                             params.GetMaxSize(i))));
+        }
+    } else {
+        NON_CONST_ITERATE (TColumns, it, m_Columns) {
+            (*it)->Clear();
+        }
+    }
+
+    m_NumRows = 0;
+}
+
+
+void CDB_ResultBatch::FinishRow(void)
+{
+    ++m_NumRows;
+#ifdef _DEBUG
+    ITERATE (TColumns, it, m_Columns) {
+        _ASSERT((*it)->size() == m_NumRows);
+    }
+#endif
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CDB_BatchFetcher::
+//
+
+class CDB_BatchFetcher::CPrefetchThread : public CThread
+{
+public:
+    CPrefetchThread(CDB_BatchFetcher& fetcher)
+        : m_Fetcher(fetcher)
+    {
+    }
+
+protected:
+    virtual void* Main(void)
+    {
+        m_Fetcher.x_Prefetch();
+        return NULL;
+    }
+
+private:
+    CDB_BatchFetcher& m_Fetcher;
+};
+
+
+CDB_BatchFetcher::CDB_BatchFetcher(CDB_Result& result, size_t batch_rows,
+                                   EPrefetch prefetch)
+    : m_Result(result),
+      m_BatchRows(batch_rows),
+      m_Filled(0),
+      m_Next(0),
+      m_Held(false),
+      m_Done(false),
+      m_Stop(false)
+{
+    CHECK_DRIVER_ERROR(batch_rows == 0, "Batch size must be positive", 200032);
+
+#if defined(NCBI_THREADS)  &&  defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    if (prefetch == ePrefetch) {
+        m_Thread.Reset(new CPrefetchThread(*this));
+        m_Thread->Run();
+    }
+#endif
+}
+
+
+CDB_BatchFetcher::~CDB_BatchFetcher(void)
+{
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    if (m_Thread.NotEmpty()) {
+        try {
+            {{
+                CFastMutexGuard guard(m_Mutex);
+                m_Stop = true;
+                m_Cond.SignalAll();
+            }}
+            // Waits for the batch being fetched, if any, to complete.
+            m_Thread->Join();
+        }
+        NCBI_CATCH_ALL_X( 2, NCBI_CURRENT_FUNCTION )
+    }
+#endif
+}
+
+
+const CDB_ResultBatch* CDB_BatchFetcher::Next(void)
+{
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    if (m_Thread.NotEmpty()) {
+        CFastMutexGuard guard(m_Mutex);
+
+        if (m_Held) {
+            // The caller is done with the previous batch; let the thread
+            // refill it.
+            m_Held = false;
+            m_Cond.SignalAll();
+        }
+        while (m_Filled == 0  &&  !m_Done) {
+            m_Cond.WaitForSignal(m_Mutex);
+        }
+        if (m_Filled == 0) {
+            if (m_Error.get() != NULL) {
+                AutoPtr<CDB_Exception> error(m_Error);
+                error->Throw();
+            }
+            return NULL;
+        }
+
+        --m_Filled;
+        m_Held = true;
+        const CDB_ResultBatch* batch = &m_Batches[m_Next];
+        m_Next ^= 1;
+        return batch;
+    }
+#endif
+
+    if (m_Done  ||  m_Result.FetchBatch(m_Batches[0], m_BatchRows) == 0) {
+        m_Done = true;
+        return NULL;
+    }
+    return &m_Batches[0];
+}
+
+
+void CDB_BatchFetcher::x_Prefetch(void)
+{
+#if defined(NCBI_HAVE_CONDITIONAL_VARIABLE)
+    // Batches are filled and handed out in the same (alternating) order,
+    // so the one to fill next is free whenever fewer than two are taken.
+    size_t index = 0;
+
+    for (;;) {
+        {{
+            CFastMutexGuard guard(m_Mutex);
+            while ( !m_Stop  &&  m_Filled + (m_Held ? 1 : 0) >= 2) {
+                m_Cond.WaitForSignal(m_Mutex);
+            }
+            if (m_Stop) {
+                return;
+            }
+        }}
+
+        size_t n_rows = 0;
+        AutoPtr<CDB_Exception> error;
+        try {
+            n_rows = m_Result.FetchBatch(m_Batches[index], m_BatchRows);
+        }
+        catch (CDB_Exception& e) {
+            error.reset(e.Clone());
+        }
+        catch (CException& e) {
+            error.reset(new CDB_ClientEx(DIAG_COMPILE_INFO, &e,
+                                         "Background batch fetch failed",
+                                         eDiag_Error, 200033));
+        }
+        catch (exception& e) {
+            error.reset(new CDB_ClientEx(DIAG_COMPILE_INFO, NULL,
+                                         string("Background batch fetch"
+                                                " failed: ") + e.what(),
+                                         eDiag_Error, 200033));
+        }
+
+        CFastMutexGuard guard(m_Mutex);
+        if (error.get() != NULL  ||  n_rows == 0) {
+            m_Error = error;
+            m_Done = true;
+        } else {
+            ++m_Filled;
+            index ^= 1;
+        }
+        m_Cond.SignalAll();
+        if (m_Done) {
+            return;
+        }
+    }
+#endif
+}
+
+
+END_NCBI_SCOPE
@@ -0,0 +1,450 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Check CDB_Result::FetchBatch() and CDB_BatchFetcher against a local
+ *   stand-in server speaking just enough TDS 7.3 to serve one fixed table.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <dbapi/driver/dbapi_result_batch.hpp>
+#include <dbapi/driver/exception.hpp>
+#include <interfaces.hpp>
+#include "tds_stand_in_ftds95.hpp"
+#include <common/test_assert.h>  /* This header must go last */
+
+
+USING_NCBI_SCOPE;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Expected contents of the stand-in table "batch_test"
+//
+
+static bool   s_SmallIsNull(Int8 i) { return i % 7  == 0; }
+static Int8   s_Small      (Int8 i) { return i % 20000 - 10000; }
+static Int8   s_Big        (Int8 i) { return i * 1000003 - (Int8(1) << 40); }
+static bool   s_RatioIsNull(Int8 i) { return i % 11 == 0; }
+static double s_Ratio      (Int8 i) { return double(i) / 4; }
+static bool   s_AmountIsNull(Int8 i) { return i % 9 == 0; }
+static bool   s_NameIsNull (Int8 i) { return i % 13 == 0; }
+static string s_Name       (Int8 i) { return "name_" + NStr::NumericToString(i); }
+static bool   s_NoteIsNull (Int8 i) { return i % 17 == 0; }
+static string s_Note       (Int8 i) { return string(i % 50, char('a' + i % 26)); }
+static bool   s_TailIsNull (Int8 i) { return i % 3  == 0; }
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CBatchStandIn::
+//
+
+class CBatchStandIn : public CTdsStandIn
+{
+public:
+    CBatchStandIn(void) : CTdsStandIn("Batch stand-in") { }
+
+protected:
+    virtual void OnBatch(const string& query, CTdsWriter& out);
+
+private:
+    void x_Table(unsigned int rows, CTdsWriter& out);
+};
+
+
+void CBatchStandIn::x_Table(unsigned int rows, CTdsWriter& out)
+{
+    static const unsigned char kCollation[5] = { 0x09, 0x04, 0xD0, 0x00, 0x34 };
+    struct SColumn {
+        const char* name;
+        bool        nullable;
+        unsigned    type;
+        int         size;   // -1 for fixed-size types
+    };
+    static const SColumn kColumns[] = {
+        { "id",     false, 0x38, -1   },  // INT
+        { "small",  true,  0x26, 2    },  // INTN(2)
+        { "big",    false, 0x7F, -1   },  // BIGINT
+        { "flag",   false, 0x32, -1   },  // BIT
+        { "ratio",  true,  0x6D, 8    },  // FLTN(8)
+        { "stamp",  false, 0x3D, -1   },  // DATETIME
+        { "amount", true,  0x6C, 9    },  // NUMERIC(18,2)
+        { "name",   true,  0xA7, 64   },  // VARCHAR(64)
+        { "note",   true,  0xA7, 3000 },  // VARCHAR(3000)
+        { "tail",   true,  0x26, 4    }   // INTN(4)
+    };
+
+    out.PutByte(0x81);
+    out.PutUint2(sizeof(kColumns) / sizeof(kColumns[0]));
+    for (size_t c = 0;  c < sizeof(kColumns) / sizeof(kColumns[0]);  ++c) {
+        const SColumn& col = kColumns[c];
+        out.PutUint4(0);
+        out.PutUint2(col.nullable ? 0x01 : 0x00);
+        out.PutByte(col.type);
+        if (col.type == 0xA7) {
+            out.PutUint2(Uint2(col.size));
+            out.Append((const char*) kCollation, sizeof(kCollation));
+        } else if (col.type == 0x6C) {
+            out.PutByte(col.size);
+            out.PutByte(18);
+            out.PutByte(2);
+        } else if (col.size >= 0) {
+            out.PutByte(col.size);
+        }
+        out.PutByte((unsigned int) strlen(col.name));
+        out.PutUCS2(col.name);
+    }
+
+    for (Int8 i = 0;  i < (Int8) rows;  ++i) {
+        out.PutByte(0xD1);
+        out.PutUint4(Uint4(i));
+        if (s_SmallIsNull(i)) {
+            out.PutByte(0);
+        } else {
+            out.PutByte(2);
+            out.PutUint2(Uint2(s_Small(i)));
+        }
+        out.PutUint8(Uint8(s_Big(i)));
+        out.PutByte(i % 2);
+        if (s_RatioIsNull(i)) {
+            out.PutByte(0);
+        } else {
+            double d = s_Ratio(i);
+            Uint8  u;
+            memcpy(&u, &d, sizeof(u));
+            out.PutByte(8);
+            out.PutUint8(u);
+        }
+        out.PutUint4(Uint4(40000 + i % 1000));
+        out.PutUint4(Uint4(i * 300 % (86400 * 300)));
+        if (s_AmountIsNull(i)) {
+            out.PutByte(0);
+        } else {
+            out.PutByte(9);
+            out.PutByte(i % 5 == 0 ? 0 : 1);
+            out.PutUint8(Uint8(i * 101));
+        }
+        if (s_NameIsNull(i)) {
+            out.PutUint2(0xFFFF);
+        } else {
+            out.PutUint2(Uint2(s_Name(i).size()));
+            out.Append(s_Name(i));
+        }
+        if (s_NoteIsNull(i)) {
+            out.PutUint2(0xFFFF);
+        } else {
+            out.PutUint2(Uint2(s_Note(i).size()));
+            out.Append(s_Note(i));
+        }
+        if (s_TailIsNull(i)) {
+            out.PutByte(0);
+        } else {
+            out.PutByte(4);
+            out.PutUint4(Uint4(-i));
+        }
+    }
+    out.PutDone(0x10, 0xC1, rows);
+}
+
+
+void CBatchStandIn::OnBatch(const string& query, CTdsWriter& out)
+{
+    SIZE_TYPE pos = NStr::FindNoCase(query, "TOP ");
+    if (NStr::FindNoCase(query, "batch_test") != NPOS  &&  pos != NPOS) {
+        x_Table(NStr::StringToUInt(query.substr(pos + 4),
+                                   NStr::fAllowTrailingSymbols), out);
+    } else {
+        out.PutDone(0);
+    }
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTestBatchFetchApp::
+//
+
+class CTestBatchFetchApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run (void);
+
+private:
+    CDB_LangCmd* x_Send(unsigned int rows);
+    CDB_Result*  x_RowResult(CDB_LangCmd& cmd);
+    void x_ReadRowWise(unsigned int rows);
+    void x_CheckBatch (const CDB_ResultBatch& batch, Int8 first_row);
+    void x_TestFetcher(unsigned int rows, size_t batch_rows,
+                       CDB_BatchFetcher::EPrefetch prefetch);
+    void x_TestAbandon(void);
+
+    AutoPtr<CDB_Connection> m_Conn;
+    // Row-wise readings of the types converted by the driver, to compare
+    // the batch readings with
+    vector<CTime>           m_Stamps;
+    vector<string>          m_Amounts;
+};
+
+
+void CTestBatchFetchApp::Init(void)
+{
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Batch fetch from a TDS stand-in server");
+    arg_desc->AddDefaultKey("rows", "N", "Number of rows to fetch",
+                            CArgDescriptions::eInteger, "10007");
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+CDB_LangCmd* CTestBatchFetchApp::x_Send(unsigned int rows)
+{
+    AutoPtr<CDB_LangCmd> cmd
+        (m_Conn->LangCmd("SELECT TOP " + NStr::NumericToString(rows)
+                         + " * FROM batch_test"));
+    cmd->Send();
+    return cmd.release();
+}
+
+
+CDB_Result* CTestBatchFetchApp::x_RowResult(CDB_LangCmd& cmd)
+{
+    while (cmd.HasMoreResults()) {
+        AutoPtr<CDB_Result> res(cmd.Result());
+        if (res.get() != NULL  &&  res->ResultType() == eDB_RowResult) {
+            return res.release();
+        }
+    }
+    return NULL;
+}
+
+
+void CTestBatchFetchApp::x_ReadRowWise(unsigned int rows)
+{
+    AutoPtr<CDB_LangCmd> cmd(x_Send(rows));
+    AutoPtr<CDB_Result>  res(x_RowResult(*cmd));
+    assert(res.get() != NULL);
+    assert(res->NofItems() == 10);
+
+    CDB_Int      id;
+    CDB_SmallInt small;
+    CDB_BigInt   big;
+    CDB_Bit      flag;
+    CDB_Double   ratio;
+    CDB_DateTime stamp;
+    CDB_Numeric  amount;
+    CDB_VarChar  name;
+    CDB_VarChar  note;
+    CDB_Int      tail;
+
+    Int8 i = 0;
+    while (res->Fetch()) {
+        res->GetItem(&id);
+        res->GetItem(&small);
+        res->GetItem(&big);
+        res->GetItem(&flag);
+        res->GetItem(&ratio);
+        res->GetItem(&stamp);
+        res->GetItem(&amount);
+        res->GetItem(&name);
+        res->GetItem(&note);
+        res->GetItem(&tail);
+
+        assert(id.Value() == i);
+        assert(small.IsNULL() == s_SmallIsNull(i));
+        assert(small.IsNULL()  ||  small.Value() == s_Small(i));
+        assert(big.Value() == s_Big(i));
+        assert(flag.Value() == i % 2);
+        assert(ratio.IsNULL() == s_RatioIsNull(i));
+        assert(ratio.IsNULL()  ||  ratio.Value() == s_Ratio(i));
+        assert(amount.IsNULL() == s_AmountIsNull(i));
+        assert(name.IsNULL() == s_NameIsNull(i));
+        assert(name.IsNULL()  ||  name.AsString() == s_Name(i));
+        assert(note.IsNULL() == s_NoteIsNull(i));
+        assert(note.IsNULL()  ||  note.AsString() == s_Note(i));
+        assert(tail.IsNULL() == s_TailIsNull(i));
+        assert(tail.IsNULL()  ||  tail.Value() == -i);
+
+        m_Stamps.push_back(stamp.Value());
+        m_Amounts.push_back(amount.IsNULL() ? kEmptyStr : amount.Value());
+        ++i;
+    }
+    assert(i == (Int8) rows);
+}
+
+
+void CTestBatchFetchApp::x_CheckBatch(const CDB_ResultBatch& batch,
+                                      Int8 first_row)
+{
+    typedef CDB_ResultBatch TBatch;
+
+    assert(batch.GetNumColumns() == 10);
+    const TBatch::CColumn& id     = batch.GetColumn(0);
+    const TBatch::CColumn& small  = batch.GetColumn(1);
+    const TBatch::CColumn& big    = batch.GetColumn(2);
+    const TBatch::CColumn& flag   = batch.GetColumn(3);
+    const TBatch::CColumn& ratio  = batch.GetColumn(4);
+    const TBatch::CColumn& stamp  = batch.GetColumn(5);
+    const TBatch::CColumn& amount = batch.GetColumn(6);
+    const TBatch::CColumn& name   = batch.GetColumn(7);
+    const TBatch::CColumn& note   = batch.GetColumn(8);
+    const TBatch::CColumn& tail   = batch.GetColumn(9);
+
+    assert(id    .GetStorage() == TBatch::eStorage_Int);
+    assert(ratio .GetStorage() == TBatch::eStorage_Double);
+    assert(stamp .GetStorage() == TBatch::eStorage_DateTime);
+    assert(amount.GetStorage() == TBatch::eStorage_Bytes);
+    assert(note  .GetName() == "note");
+
+    for (size_t row = 0;  row < batch.GetNumRows();  ++row) {
+        Int8 i = first_row + Int8(row);
+        assert(id.GetInt8(row) == i);
+        assert(small.IsNULL(row) == s_SmallIsNull(i));
+        assert(small.IsNULL(row)  ||  small.GetInt8(row) == s_Small(i));
+        assert(big.GetInt8(row) == s_Big(i));
+        assert(flag.GetInt8(row) == i % 2);
+        assert(ratio.IsNULL(row) == s_RatioIsNull(i));
+        assert(ratio.IsNULL(row)  ||  ratio.GetDouble(row) == s_Ratio(i));
+        assert(stamp.GetTime(row) == m_Stamps[i]);
+        assert(amount.IsNULL(row) == s_AmountIsNull(i));
+        assert(amount.GetBytes(row) == m_Amounts[i]);
+        assert(name.IsNULL(row) == s_NameIsNull(i));
+        assert(name.IsNULL(row)  ||  name.GetBytes(row) == s_Name(i));
+        assert(note.IsNULL(row) == s_NoteIsNull(i));
+        assert(note.IsNULL(row)  ||  note.GetBytes(row) == s_Note(i));
+        assert(tail.IsNULL(row) == s_TailIsNull(i));
+        assert(tail.IsNULL(row)  ||  tail.GetInt8(row) == -i);
+    }
+}
+
+
+void CTestBatchFetchApp::x_TestFetcher(unsigned int rows, size_t batch_rows,
+                                       CDB_BatchFetcher::EPrefetch prefetch)
+{
+    ERR_POST(Info << "Batches of " << batch_rows << " rows, "
+             << (prefetch == CDB_BatchFetcher::ePrefetch ? "with" : "without")
+             << " prefetching");
+
+    AutoPtr<CDB_LangCmd> cmd(x_Send(rows));
+    AutoPtr<CDB_Result>  res(x_RowResult(*cmd));
+    assert(res.get() != NULL);
+
+    CStopWatch sw(CStopWatch::eStart);
+    Int8 first_row = 0;
+    {{
+        CDB_BatchFetcher fetcher(*res, batch_rows, prefetch);
+        while (const CDB_ResultBatch* batch = fetcher.Next()) {
+            assert(batch->GetNumRows() > 0);
+            assert(batch->GetNumRows() == batch_rows
+                   ||  first_row + batch->GetNumRows() == rows);
+            x_CheckBatch(*batch, first_row);
+            first_row += batch->GetNumRows();
+        }
+        assert(fetcher.Next() == NULL);
+    }}
+    assert(first_row == (Int8) rows);
+    ERR_POST(Info << rows << " rows in " << sw.Elapsed() << " s");
+
+    // The command must be fully processed
+    assert( !res->Fetch() );
+    res.reset();
+    while (cmd->HasMoreResults()) {
+        AutoPtr<CDB_Result> r(cmd->Result());
+    }
+}
+
+
+void CTestBatchFetchApp::x_TestAbandon(void)
+{
+    ERR_POST(Info << "Abandoning a prefetching fetcher");
+    {{
+        AutoPtr<CDB_LangCmd> cmd(x_Send(50000));
+        AutoPtr<CDB_Result>  res(x_RowResult(*cmd));
+        assert(res.get() != NULL);
+        CDB_BatchFetcher fetcher(*res, 100, CDB_BatchFetcher::ePrefetch);
+        const CDB_ResultBatch* batch = fetcher.Next();
+        assert(batch != NULL  &&  batch->GetNumRows() == 100);
+        x_CheckBatch(*batch, 0);
+    }}
+
+    // The connection must still be usable, and FetchBatch() must cope
+    // with a batch last filled from another result.
+    CDB_ResultBatch batch;
+    AutoPtr<CDB_LangCmd> cmd(x_Send(10));
+    AutoPtr<CDB_Result>  res(x_RowResult(*cmd));
+    assert(res->FetchBatch(batch, 4) == 4);
+    x_CheckBatch(batch, 0);
+    assert(res->FetchBatch(batch, 4) == 4);
+    x_CheckBatch(batch, 4);
+    assert(res->FetchBatch(batch, 4) == 2);
+    x_CheckBatch(batch, 8);
+    assert(res->FetchBatch(batch, 4) == 0);
+    assert(batch.GetNumRows() == 0);
+}
+
+
+int CTestBatchFetchApp::Run(void)
+{
+    const unsigned int rows = GetArgs()["rows"].AsInteger();
+
+    CRef<CTdsStandIn> server(new CBatchStandIn);
+    server->Run();
+
+    CTDSContext context(true, 73);
+    int         status = 0;
+    try {
+        m_Conn.reset(context.Connect
+                     ("127.0.0.1:" + NStr::NumericToString(server->GetPort()),
+                      "user", "password", 0));
+
+        x_ReadRowWise(rows);
+        x_TestFetcher(rows, 1000, CDB_BatchFetcher::eNoPrefetch);
+        x_TestFetcher(rows, 777,  CDB_BatchFetcher::ePrefetch);
+        x_TestFetcher(rows, rows + 1, CDB_BatchFetcher::ePrefetch);
+        x_TestAbandon();
+    }
+    catch (CDB_Exception& e) {
+        CDB_UserHandler_Stream handler(&cerr);
+        handler.HandleIt(&e);
+        status = 1;
+    }
+
+    m_Conn.reset();
+    server->Stop();
+
+    if (status == 0) {
+        ERR_POST(Info << "TEST COMPLETED SUCCESSFULLY");
+    }
+    return status;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTestBatchFetchApp().AppMain(argc, argv);
+}
@@ -0,0 +1,538 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Check CDB_BulkLoader against a local stand-in server speaking just
+ *   enough TDS 7.3 to accept bulk loads into one fixed table.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbifile.hpp>
+#include <dbapi/driver/dbapi_bulk_loader.hpp>
+#include <dbapi/driver/dbapi_driver_conn_params.hpp>
+#include <dbapi/driver/exception.hpp>
+#include <interfaces.hpp>
+#include "tds_stand_in_ftds95.hpp"
+#include <common/test_assert.h>  /* This header must go last */
+
+
+USING_NCBI_SCOPE;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Rows loaded into the stand-in table "bcp_test"
+//
+
+static const CTime kStampBase(2024, 1, 1);
+
+static bool   s_QtyIsNull   (Int8 i) { return i % 7  == 0; }
+static Int4   s_Qty         (Int8 i) { return Int4(i % 1000 - 500); }
+static bool   s_RatioIsNull (Int8 i) { return i % 11 == 0; }
+static double s_Ratio       (Int8 i) { return double(i) / 8; }
+static bool   s_StampIsNull (Int8 i) { return i % 13 == 0; }
+static CTime  s_Stamp       (Int8 i)
+{
+    return CTime(kStampBase).AddSecond(int(i % 1000000));
+}
+static bool   s_AmountIsNull(Int8 i) { return i % 3  == 0; }
+static bool   s_AmountIsNeg (Int8 i) { return i % 5  == 1; }
+static bool   s_NameIsNull  (Int8 i) { return i % 17 == 0; }
+static string s_Name        (Int8 i) { return "row_" + NStr::NumericToString(i); }
+
+static string s_DoubleBits(double d)
+{
+    Uint8 u;
+    memcpy(&u, &d, sizeof(u));
+    return NStr::UInt8ToString(u, 0, 16);
+}
+
+
+// How the stand-in records a row (all columns but the first, the id)
+static string s_ExpectedRow(Int8 i)
+{
+    string row;
+    row += s_QtyIsNull(i) ? "N" : NStr::NumericToString(s_Qty(i));
+    row += '|';
+    row += s_RatioIsNull(i) ? "N" : s_DoubleBits(s_Ratio(i));
+    row += '|';
+    if (s_StampIsNull(i)) {
+        row += 'N';
+    } else {
+        CDB_DateTime dt(s_Stamp(i));
+        row += NStr::NumericToString(dt.GetDays()) + ':'
+            + NStr::NumericToString(dt.Get300Secs());
+    }
+    row += '|';
+    if (s_AmountIsNull(i)) {
+        row += 'N';
+    } else {
+        row += (s_AmountIsNeg(i) ? "-" : "") + NStr::NumericToString(i * 7);
+    }
+    row += '|';
+    row += s_NameIsNull(i) ? "N" : s_Name(i);
+    return row;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CBcpStandIn::
+//
+
+class CBcpStandIn : public CTdsStandIn
+{
+public:
+    typedef map<Int8, string> TTable;
+
+    CBcpStandIn(void)
+        : CTdsStandIn("BCP stand-in"), m_FailAfter(0), m_Duplicates(0)
+    {
+    }
+
+    /// Drop the connection instead of committing the n-th bulk batch
+    /// from now on.
+    void FailAfter(unsigned int n)
+    {
+        CFastMutexGuard guard(m_Mutex);
+        m_FailAfter = n;
+    }
+    void GetTable(TTable* table, size_t* duplicates)
+    {
+        CFastMutexGuard guard(m_Mutex);
+        *table = m_Table;
+        *duplicates = m_Duplicates;
+    }
+    void ClearTable(void)
+    {
+        CFastMutexGuard guard(m_Mutex);
+        m_Table.clear();
+        m_Duplicates = 0;
+    }
+
+protected:
+    virtual void OnBatch(const string& query, CTdsWriter& out);
+    virtual bool OnBulk (const string& data,  CTdsWriter& out);
+
+private:
+    void x_Columns(CTdsWriter& out);
+
+    unsigned int m_FailAfter;
+    TTable       m_Table;
+    size_t       m_Duplicates;
+};
+
+
+void CBcpStandIn::x_Columns(CTdsWriter& out)
+{
+    static const unsigned char kCollation[5] = { 0x09, 0x04, 0xD0, 0x00, 0x34 };
+    struct SColumn {
+        const char* name;
+        bool        nullable;
+        unsigned    type;
+        int         size;   // -1 for fixed-size types
+    };
+    static const SColumn kColumns[] = {
+        { "id",     false, 0x7F, -1 },  // BIGINT
+        { "qty",    true,  0x26, 4  },  // INTN(4)
+        { "ratio",  true,  0x6D, 8  },  // FLTN(8)
+        { "stamp",  true,  0x6F, 8  },  // DATETIMN(8)
+        { "amount", true,  0x6C, 9  },  // NUMERIC(12,3)
+        { "name",   true,  0xA7, 40 }   // VARCHAR(40)
+    };
+
+    out.PutByte(0x81);
+    out.PutUint2(sizeof(kColumns) / sizeof(kColumns[0]));
+    for (size_t c = 0;  c < sizeof(kColumns) / sizeof(kColumns[0]);  ++c) {
+        const SColumn& col = kColumns[c];
+        out.PutUint4(0);
+        // Nullable, updateable
+        out.PutUint2(col.nullable ? 0x09 : 0x08);
+        out.PutByte(col.type);
+        if (col.type == 0xA7) {
+            out.PutUint2(Uint2(col.size));
+            out.Append((const char*) kCollation, sizeof(kCollation));
+        } else if (col.type == 0x6C) {
+            out.PutByte(col.size);
+            out.PutByte(12);
+            out.PutByte(3);
+        } else if (col.size >= 0) {
+            out.PutByte(col.size);
+        }
+        out.PutByte((unsigned int) strlen(col.name));
+        out.PutUCS2(col.name);
+    }
+}
+
+
+// Decode the rows of a bulk load message and commit them, unless set to
+// fail; return false to drop the connection.
+bool CBcpStandIn::OnBulk(const string& data, CTdsWriter& out)
+{
+    CTdsReader in(data);
+
+    // The client's COLMETADATA, which must match ours
+    assert(in.Get(1) == 0x81);
+    unsigned int n_cols = (unsigned int) in.Get(2);
+    assert(n_cols == 6);
+    vector<unsigned int> types;
+    for (unsigned int c = 0;  c < n_cols;  ++c) {
+        in.Get(4);   // user type
+        in.Get(2);   // flags
+        types.push_back((unsigned int) in.Get(1));
+        switch (types.back()) {
+        case 0x7F:                       break;
+        case 0x26: case 0x6D: case 0x6F: in.Get(1);  break;
+        case 0x6C:                       in.Get(3);  break;
+        case 0xA7:                       in.Get(7);  break;
+        default:                         assert(false);
+        }
+        in.GetBytes(2 * in.Get(1));
+    }
+
+    vector< pair<Int8, string> > rows;
+    while ( !in.AtEnd() ) {
+        assert(in.Get(1) == 0xD1);
+        Int8   id = Int8(in.Get(8));
+        string row;
+
+        size_t len = (size_t) in.Get(1);
+        row += len == 0 ? "N" : NStr::NumericToString(Int4(in.Get(len)));
+        row += '|';
+
+        len = (size_t) in.Get(1);
+        if (len == 0) {
+            row += 'N';
+        } else {
+            Uint8 bits = in.Get(len);
+            row += NStr::UInt8ToString(bits, 0, 16);
+        }
+        row += '|';
+
+        len = (size_t) in.Get(1);
+        if (len == 0) {
+            row += 'N';
+        } else {
+            Int4 days = Int4(in.Get(4));
+            row += NStr::NumericToString(days) + ':'
+                + NStr::NumericToString(Int4(in.Get(4)));
+        }
+        row += '|';
+
+        len = (size_t) in.Get(1);
+        if (len == 0) {
+            row += 'N';
+        } else {
+            bool positive = in.Get(1) != 0;
+            row += (positive ? "" : "-")
+                + NStr::NumericToString(in.Get(len - 1));
+        }
+        row += '|';
+
+        len = (size_t) in.Get(2);
+        row += len == 0xFFFF ? string("N") : in.GetBytes(len);
+
+        rows.push_back(make_pair(id, row));
+    }
+
+    CFastMutexGuard guard(m_Mutex);
+    if ( !rows.empty()  &&  m_FailAfter > 0  &&  --m_FailAfter == 0) {
+        return false;
+    }
+    for (size_t i = 0;  i < rows.size();  ++i) {
+        if ( !m_Table.insert(rows[i]).second ) {
+            ++m_Duplicates;
+        }
+    }
+    guard.Release();
+
+    out.PutDone(0x10, 0, rows.size());
+    return true;
+}
+
+
+void CBcpStandIn::OnBatch(const string& query, CTdsWriter& out)
+{
+    if (NStr::FindNoCase(query, "FMTONLY ON") != NPOS) {
+        assert(NStr::FindNoCase(query, "bcp_test") != NPOS);
+        x_Columns(out);
+    }
+    out.PutDone(0);
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTestBulkLoaderApp::
+//
+
+class CTestBulkLoaderApp : public CNcbiApplication
+{
+public:
+    virtual void Init(void);
+    virtual int  Run (void);
+
+private:
+    void  x_Setup(CDB_BulkLoader& loader);
+    void  x_Load (CDB_BulkLoader& loader, Int8 rows);
+    void  x_Check(Int8 rows, bool complete);
+    void  x_TestLoad   (Int8 rows, unsigned int n_connections,
+                        unsigned int n_converters);
+    void  x_TestRestart(Int8 rows);
+    void  x_TestBadField(void);
+
+    AutoPtr<I_DriverContext>      m_Context;
+    AutoPtr<CDBDefaultConnParams> m_Params;
+    CRef<CBcpStandIn>             m_Server;
+};
+
+
+void CTestBulkLoaderApp::Init(void)
+{
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Bulk load into a TDS stand-in server");
+    arg_desc->AddDefaultKey("rows", "N", "Number of rows to load",
+                            CArgDescriptions::eInteger, "20011");
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+void CTestBulkLoaderApp::x_Setup(CDB_BulkLoader& loader)
+{
+    loader.AddColumn(CDB_BigInt());
+    loader.AddColumn(CDB_Int());
+    loader.AddColumn(CDB_Double());
+    loader.AddColumn(CDB_DateTime());
+    loader.AddColumn(CDB_Numeric(12, 3));
+    loader.AddColumn(CDB_VarChar());
+}
+
+
+void CTestBulkLoaderApp::x_Load(CDB_BulkLoader& loader, Int8 rows)
+{
+    for (Int8 i = 0;  i < rows;  ++i) {
+        loader.AddField(NStr::NumericToString(i));
+        if (s_QtyIsNull(i)) {
+            loader.AddNULL();
+        } else {
+            loader.AddField(NStr::NumericToString(s_Qty(i)));
+        }
+        if (s_RatioIsNull(i)) {
+            loader.AddNULL();
+        } else {
+            loader.AddField(NStr::DoubleToString(s_Ratio(i), 3,
+                                                 NStr::fDoubleFixed));
+        }
+        if (s_StampIsNull(i)) {
+            loader.AddNULL();
+        } else {
+            loader.AddField(s_Stamp(i).AsString("Y-M-D h:m:s"));
+        }
+        if (s_AmountIsNull(i)) {
+            loader.AddNULL();
+        } else {
+            loader.AddField((s_AmountIsNeg(i) ? "-" : "")
+                            + NStr::NumericToString(i * 7 / 1000) + '.'
+                            + NStr::NumericToString(i * 7 % 1000 + 1000)
+                            .substr(1));
+        }
+        if (s_NameIsNull(i)) {
+            loader.AddNULL();
+        } else {
+            loader.AddField(s_Name(i));
+        }
+        loader.FinishRow();
+    }
+}
+
+
+// Check that the table holds rows [0, rows) at most once each, and all of
+// them if "complete".
+void CTestBulkLoaderApp::x_Check(Int8 rows, bool complete)
+{
+    CBcpStandIn::TTable table;
+    size_t              duplicates = 0;
+    m_Server->GetTable(&table, &duplicates);
+
+    assert(duplicates == 0);
+    assert( !complete  ||  table.size() == size_t(rows));
+    ITERATE (CBcpStandIn::TTable, it, table) {
+        assert(it->first >= 0  &&  it->first < rows);
+        assert(it->second == s_ExpectedRow(it->first));
+    }
+}
+
+
+void CTestBulkLoaderApp::x_TestLoad(Int8 rows, unsigned int n_connections,
+                                    unsigned int n_converters)
+{
+    ERR_POST(Info << "Loading " << rows << " rows over " << n_connections
+             << " connection(s), with " << n_converters << " converter(s)");
+    m_Server->ClearTable();
+
+    CStopWatch sw(CStopWatch::eStart);
+    CDB_BulkLoader loader(*m_Context, *m_Params, "bcp_test",
+                          n_connections, n_converters);
+    x_Setup(loader);
+    loader.SetBatchRows(500);
+    loader.SetCommitRows(1200);
+    x_Load(loader, rows);
+    loader.Finish();
+    ERR_POST(Info << rows << " rows in " << sw.Elapsed() << " s");
+
+    assert(loader.GetCommittedRows() == Uint8(rows));
+    assert(loader.GetSkippedRows() == 0);
+    x_Check(rows, true);
+}
+
+
+void CTestBulkLoaderApp::x_TestRestart(Int8 rows)
+{
+    ERR_POST(Info << "Restarting an interrupted load");
+    m_Server->ClearTable();
+
+    const string progress = CFile::GetTmpName();
+    Uint8 committed = 0;
+    m_Server->FailAfter(7);
+    try {
+        CDB_BulkLoader loader(*m_Context, *m_Params, "bcp_test", 3, 2);
+        x_Setup(loader);
+        loader.SetBatchRows(300);
+        loader.SetProgressFile(progress);
+        try {
+            x_Load(loader, rows);
+            loader.Finish();
+            assert(false);
+        }
+        catch (CDB_Exception&) {
+            committed = loader.GetCommittedRows();
+        }
+    }
+    catch (CDB_Exception&) {
+        assert(false);
+    }
+
+    // Exactly the recorded batches are in the table.
+    CBcpStandIn::TTable table;
+    size_t              duplicates = 0;
+    m_Server->GetTable(&table, &duplicates);
+    assert(table.size() == committed);
+    assert(committed > 0  &&  committed < Uint8(rows));
+    x_Check(rows, false);
+
+    {{
+        CDB_BulkLoader loader(*m_Context, *m_Params, "bcp_test", 3, 2);
+        x_Setup(loader);
+        loader.SetBatchRows(300);
+        loader.SetProgressFile(progress);
+        x_Load(loader, rows);
+        loader.Finish();
+        assert(loader.GetSkippedRows() == committed);
+        assert(loader.GetCommittedRows() + committed == Uint8(rows));
+    }}
+    x_Check(rows, true);
+
+    // A progress file does not fit a load with another batch size.
+    try {
+        CDB_BulkLoader loader(*m_Context, *m_Params, "bcp_test");
+        x_Setup(loader);
+        loader.SetBatchRows(100);
+        loader.SetProgressFile(progress);
+        loader.AddField("0");
+        assert(false);
+    }
+    catch (CDB_Exception& e) {
+        assert(e.GetDBErrCode() == 200043);
+    }
+    CFile(progress).Remove();
+}
+
+
+void CTestBulkLoaderApp::x_TestBadField(void)
+{
+    ERR_POST(Info << "Loading a field that does not convert");
+    m_Server->ClearTable();
+
+    try {
+        CDB_BulkLoader loader(*m_Context, *m_Params, "bcp_test", 2);
+        x_Setup(loader);
+        loader.SetBatchRows(10);
+        x_Load(loader, 95);
+        loader.AddField("not a number");
+        for (int i = 0;  i < 5;  ++i) {
+            loader.AddNULL();
+        }
+        loader.FinishRow();
+        loader.Finish();
+        assert(false);
+    }
+    catch (CDB_Exception& e) {
+        assert(e.GetDBErrCode() == 200041);
+    }
+    x_Check(95, false);
+}
+
+
+int CTestBulkLoaderApp::Run(void)
+{
+    const Int8 rows = GetArgs()["rows"].AsInteger();
+
+    m_Server.Reset(new CBcpStandIn);
+    m_Server->Run();
+
+    m_Context.reset(new CTDSContext(true, 73));
+    m_Params.reset(new CDBDefaultConnParams
+                   ("127.0.0.1:" + NStr::NumericToString(m_Server->GetPort()),
+                    "user", "password"));
+    int status = 0;
+    try {
+        x_TestLoad(rows, 1, 1);
+        x_TestLoad(rows, 4, 2);
+        x_TestRestart(rows);
+        x_TestBadField();
+    }
+    catch (CDB_Exception& e) {
+        CDB_UserHandler_Stream handler(&cerr);
+        handler.HandleIt(&e);
+        status = 1;
+    }
+
+    m_Context.reset();
+    m_Server->Stop();
+
+    if (status == 0) {
+        ERR_POST(Info << "TEST COMPLETED SUCCESSFULLY");
+    }
+    return status;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTestBulkLoaderApp().AppMain(argc, argv);
+}
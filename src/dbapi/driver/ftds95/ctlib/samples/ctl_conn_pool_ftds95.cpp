@@ -0,0 +1,280 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Check named connection pools (reuse, size limit, waiting, overflow,
+ *   idle connection closing) against a local stand-in server speaking
+ *   just enough TDS 7.3 to log in.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <dbapi/driver/dbapi_driver_conn_params.hpp>
+#include <dbapi/driver/exception.hpp>
+#include <interfaces.hpp>
+#include "tds_stand_in_ftds95.hpp"
+#include <common/test_assert.h>  /* This header must go last */
+
+
+USING_NCBI_SCOPE;
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CPoolUser::
+//
+
+// Takes a connection from a pool a few times, holding it for a while.
+class CPoolUser : public CThread
+{
+public:
+    CPoolUser(I_DriverContext& context, const CDBConnParams& params)
+        : m_Context(context), m_Params(params)
+    {
+    }
+
+    static unsigned int GetMaxHolders(void) { return sm_MaxHolders; }
+
+protected:
+    virtual void* Main(void);
+
+private:
+    I_DriverContext&     m_Context;
+    const CDBConnParams& m_Params;
+
+    static CFastMutex    sm_Mutex;
+    static unsigned int  sm_Holders;
+    static unsigned int  sm_MaxHolders;
+};
+
+
+CFastMutex   CPoolUser::sm_Mutex;
+unsigned int CPoolUser::sm_Holders    = 0;
+unsigned int CPoolUser::sm_MaxHolders = 0;
+
+
+void* CPoolUser::Main(void)
+{
+    for (int i = 0;  i < 5;  ++i) {
+        AutoPtr<CDB_Connection> conn(m_Context.MakeConnection(m_Params));
+        assert(conn.get() != NULL);
+        {{
+            CFastMutexGuard guard(sm_Mutex);
+            sm_MaxHolders = max(sm_MaxHolders, ++sm_Holders);
+        }}
+        SleepMilliSec(20);
+        {{
+            CFastMutexGuard guard(sm_Mutex);
+            --sm_Holders;
+        }}
+    }
+    return NULL;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTestConnPoolApp::
+//
+
+class CTestConnPoolApp : public CNcbiApplication
+{
+public:
+    virtual int  Run (void);
+
+private:
+    CDBDefaultConnParams* x_Params(const string& pool_name);
+    impl::SConnPoolStats  x_Stats (const string& pool_name);
+    void  x_TestReuse   (void);
+    void  x_TestWait    (void);
+    void  x_TestFull    (void);
+    void  x_TestIdleTime(void);
+
+    AutoPtr<CTDSContext> m_Context;
+    CRef<CTdsStandIn>    m_Server;
+};
+
+
+CDBDefaultConnParams* CTestConnPoolApp::x_Params(const string& pool_name)
+{
+    return new CDBDefaultConnParams
+        ("127.0.0.1:" + NStr::NumericToString(m_Server->GetPort()),
+         "user", "password", 0, true, pool_name);
+}
+
+
+impl::SConnPoolStats CTestConnPoolApp::x_Stats(const string& pool_name)
+{
+    impl::CDriverContext::TPoolStats stats;
+    m_Context->GetPoolStats(&stats);
+    return stats[pool_name];
+}
+
+
+void CTestConnPoolApp::x_TestReuse(void)
+{
+    ERR_POST(Info << "Reusing a pooled connection");
+    AutoPtr<CDBDefaultConnParams> params(x_Params("reuse"));
+    unsigned int logins = m_Server->GetLogins();
+
+    for (int i = 0;  i < 5;  ++i) {
+        AutoPtr<CDB_Connection> conn(m_Context->MakeConnection(*params));
+        assert(conn.get() != NULL);
+        assert(conn->PoolName() == "reuse");
+        assert(x_Stats("reuse").in_use == 1);
+    }
+    impl::SConnPoolStats stats = x_Stats("reuse");
+    assert(m_Server->GetLogins() == logins + 1);
+    assert(stats.opened == 1  &&  stats.reused == 4);
+    assert(stats.in_use == 0  &&  stats.idle == 1);
+    assert(m_Context->NofConnections(kEmptyStr, "reuse") == 1);
+
+    // Connections only to be reused
+    params->SetParam("do_not_connect", "true");
+    {{
+        AutoPtr<CDB_Connection> conn(m_Context->MakeConnection(*params));
+        assert(conn.get() != NULL);
+        AutoPtr<CDB_Connection> conn2(m_Context->MakeConnection(*params));
+        assert(conn2.get() == NULL);
+    }}
+
+    m_Context->CloseConnsForPool("reuse");
+    stats = x_Stats("reuse");
+    assert(stats.in_use == 0  &&  stats.idle == 0);
+}
+
+
+void CTestConnPoolApp::x_TestWait(void)
+{
+    ERR_POST(Info << "Waiting for a connection from a full pool");
+    AutoPtr<CDBDefaultConnParams> params(x_Params("wait"));
+    params->SetParam("pool_maxsize", "2");
+    params->SetParam("pool_wait_time", "10");
+
+    vector< CRef<CThread> > users;
+    for (int i = 0;  i < 8;  ++i) {
+        users.push_back(CRef<CThread>(new CPoolUser(*m_Context, *params)));
+        users.back()->Run();
+    }
+    NON_CONST_ITERATE (vector< CRef<CThread> >, it, users) {
+        (*it)->Join();
+    }
+
+    impl::SConnPoolStats stats = x_Stats("wait");
+    assert(CPoolUser::GetMaxHolders() <= 2);
+    assert(stats.opened <= 2  &&  stats.opened + stats.reused == 40);
+    assert(stats.waits > 0  &&  stats.timeouts == 0);
+    assert(stats.in_use == 0  &&  stats.idle == stats.opened);
+}
+
+
+void CTestConnPoolApp::x_TestFull(void)
+{
+    ERR_POST(Info << "Asking a full pool for a connection");
+    AutoPtr<CDBDefaultConnParams> params(x_Params("full"));
+    params->SetParam("pool_maxsize", "1");
+
+    AutoPtr<CDB_Connection> conn(m_Context->MakeConnection(*params));
+    assert(conn.get() != NULL);
+    try {
+        AutoPtr<CDB_Connection> conn2(m_Context->MakeConnection(*params));
+        assert(false);
+    }
+    catch (CDB_Exception& e) {
+        assert(e.GetDBErrCode() == 100011);
+    }
+    assert(x_Stats("full").timeouts == 1);
+
+    params->SetParam("pool_allow_temp_overflow", "true");
+    {{
+        AutoPtr<CDB_Connection> conn2(m_Context->MakeConnection(*params));
+        assert(conn2.get() != NULL);
+    }}
+    conn.reset();
+
+    // The overflow connection is not kept.
+    impl::SConnPoolStats stats = x_Stats("full");
+    assert(stats.overflows == 1);
+    assert(stats.in_use == 0  &&  stats.idle == 1);
+}
+
+
+void CTestConnPoolApp::x_TestIdleTime(void)
+{
+    ERR_POST(Info << "Closing idle connections");
+    AutoPtr<CDBDefaultConnParams> params(x_Params("idle"));
+    params->SetParam("pool_idle_time", "0.5");
+    params->SetParam("pool_minsize", "1");
+
+    {{
+        AutoPtr<CDB_Connection> conn (m_Context->MakeConnection(*params));
+        AutoPtr<CDB_Connection> conn2(m_Context->MakeConnection(*params));
+        AutoPtr<CDB_Connection> conn3(m_Context->MakeConnection(*params));
+        assert(x_Stats("idle").opened == 3);
+    }}
+    assert(x_Stats("idle").idle == 3);
+
+    // All but pool_minsize are closed in the background.
+    for (int i = 0;  i < 50  &&  x_Stats("idle").idle > 1;  ++i) {
+        SleepMilliSec(100);
+    }
+    impl::SConnPoolStats stats = x_Stats("idle");
+    assert(stats.idle == 1  &&  stats.evicted == 2);
+}
+
+
+int CTestConnPoolApp::Run(void)
+{
+    m_Server.Reset(new CTdsStandIn("Pool stand-in"));
+    m_Server->Run();
+
+    m_Context.reset(new CTDSContext(true, 73));
+    int status = 0;
+    try {
+        x_TestReuse();
+        x_TestWait();
+        x_TestFull();
+        x_TestIdleTime();
+    }
+    catch (CDB_Exception& e) {
+        CDB_UserHandler_Stream handler(&cerr);
+        handler.HandleIt(&e);
+        status = 1;
+    }
+
+    m_Context.reset();
+    m_Server->Stop();
+
+    if (status == 0) {
+        ERR_POST(Info << "TEST COMPLETED SUCCESSFULLY");
+    }
+    return status;
+}
+
+
+int main(int argc, const char* argv[])
+{
+    return CTestConnPoolApp().AppMain(argc, argv);
+}
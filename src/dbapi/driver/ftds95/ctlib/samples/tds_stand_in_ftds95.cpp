@@ -0,0 +1,283 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Local stand-in server speaking just enough TDS 7.3 for the samples
+ *   to run without a database server.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include "tds_stand_in_ftds95.hpp"
+#include <common/test_assert.h>  /* This header must go last */
+
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTdsWriter::
+//
+
+void CTdsWriter::PutUCS2(const string& s)
+{
+    ITERATE (string, it, s) {
+        PutUint2((unsigned char) *it);
+    }
+}
+
+
+void CTdsWriter::PutDone(Uint2 status, Uint2 cmd, Uint8 count)
+{
+    PutByte(0xFD);
+    PutUint2(status);
+    PutUint2(cmd);
+    PutUint8(count);
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTdsReader::
+//
+
+Uint8 CTdsReader::Get(size_t n)
+{
+    assert(m_Pos + n <= m_Data.size());
+    Uint8 v = 0;
+    for (size_t i = 0;  i < n;  ++i) {
+        v |= Uint8((unsigned char) m_Data[m_Pos + i]) << (8 * i);
+    }
+    m_Pos += n;
+    return v;
+}
+
+
+string CTdsReader::GetBytes(size_t n)
+{
+    assert(m_Pos + n <= m_Data.size());
+    m_Pos += n;
+    return m_Data.substr(m_Pos - n, n);
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTdsStandIn::CSession::
+//
+
+class CTdsStandIn::CSession : public CThread
+{
+public:
+    CSession(CTdsStandIn& server, CSocket* sock)
+        : m_Server(server), m_Socket(sock)
+    {
+    }
+
+protected:
+    virtual void* Main(void);
+
+private:
+    enum EPacket {
+        ePacket_Batch     = 0x01,
+        ePacket_Reply     = 0x04,
+        ePacket_Attention = 0x06,
+        ePacket_Bulk      = 0x07,
+        ePacket_Login7    = 0x10,
+        ePacket_Prelogin  = 0x12
+    };
+
+    bool x_ReadMessage(int* type, string* data);
+    void x_Send(void);
+
+    CTdsStandIn&     m_Server;
+    AutoPtr<CSocket> m_Socket;
+    CTdsWriter       m_Out;
+};
+
+
+bool CTdsStandIn::CSession::x_ReadMessage(int* type, string* data)
+{
+    data->erase();
+    for (;;) {
+        unsigned char hdr[8];
+        if (m_Socket->Read(hdr, sizeof(hdr), 0, eIO_ReadPersist)
+            != eIO_Success) {
+            return false;
+        }
+        size_t len = ((size_t) hdr[2] << 8) | hdr[3];
+        if (len < sizeof(hdr)) {
+            return false;
+        }
+        string buf(len - sizeof(hdr), '\0');
+        if (!buf.empty()
+            &&  m_Socket->Read(&buf[0], buf.size(), 0, eIO_ReadPersist)
+            != eIO_Success) {
+            return false;
+        }
+        // An attention may follow an incomplete message, which it cancels.
+        *type = hdr[0];
+        *data += buf;
+        if (hdr[1] & 0x01) {
+            return true;
+        }
+    }
+}
+
+
+void CTdsStandIn::CSession::x_Send(void)
+{
+    const size_t kMaxData = 4096 - 8;
+    string& out = m_Out.GetData();
+    for (size_t pos = 0;  pos < out.size();  pos += kMaxData) {
+        size_t n   = min(kMaxData, out.size() - pos);
+        bool   eom = pos + n == out.size();
+        unsigned char hdr[8] = {
+            ePacket_Reply, (unsigned char)(eom ? 0x01 : 0x00),
+            (unsigned char)((n + 8) >> 8), (unsigned char)((n + 8) & 0xFF),
+            0, 0, 1, 0
+        };
+        m_Socket->Write(hdr, sizeof(hdr));
+        m_Socket->Write(out.data() + pos, n);
+    }
+    out.erase();
+}
+
+
+void* CTdsStandIn::CSession::Main(void)
+{
+    int    type;
+    string data;
+    while (x_ReadMessage(&type, &data)) {
+        switch (type) {
+        case ePacket_Prelogin:
+            // Encryption (option 1) not supported
+            m_Out.Append("\x01\x00\x06\x00\x01\xFF\x02", 7);
+            break;
+        case ePacket_Login7:
+        {
+            const string& name = m_Server.m_Name;
+            m_Out.PutByte(0xAD);
+            m_Out.PutUint2(Uint2(1 + 4 + 1 + 2 * name.size() + 4));
+            m_Out.PutByte(1);
+            m_Out.PutUint4(0x03000B73);  // TDS 7.3, sent big-endian
+            m_Out.PutByte((unsigned int) name.size());
+            m_Out.PutUCS2(name);
+            m_Out.PutUint4(0x0000000A);
+            // The row count of the final DONE is taken for the SPID
+            m_Out.PutDone(0x10, 0, 55);
+            CFastMutexGuard guard(m_Server.m_Mutex);
+            ++m_Server.m_Logins;
+            break;
+        }
+        case ePacket_Batch:
+        {
+            // Skip ALL_HEADERS, then narrow the UCS-2 query text.
+            string query;
+            size_t skip = data.size() < 4 ? data.size()
+                : (unsigned char) data[0] | ((unsigned char) data[1] << 8);
+            for (size_t i = skip;  i < data.size();  i += 2) {
+                query += data[i];
+            }
+            m_Server.OnBatch(query, m_Out);
+            break;
+        }
+        case ePacket_Bulk:
+            if ( !m_Server.OnBulk(data, m_Out) ) {
+                m_Socket->Close();
+                return NULL;
+            }
+            break;
+        case ePacket_Attention:
+            m_Out.PutDone(0x20);
+            break;
+        default:
+            m_Socket->Close();
+            return NULL;
+        }
+        x_Send();
+    }
+    return NULL;
+}
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTdsStandIn::
+//
+
+CTdsStandIn::CTdsStandIn(const string& name)
+    : m_Name(name), m_Stop(false), m_Logins(0)
+{
+    m_Listener.Listen(0);
+    m_Port = m_Listener.GetPort(eNH_HostByteOrder);
+}
+
+
+unsigned int CTdsStandIn::GetLogins(void)
+{
+    CFastMutexGuard guard(m_Mutex);
+    return m_Logins;
+}
+
+
+void CTdsStandIn::OnBatch(const string& /* query */, CTdsWriter& out)
+{
+    out.PutDone(0);
+}
+
+
+bool CTdsStandIn::OnBulk(const string& /* data */, CTdsWriter& /* out */)
+{
+    return false;
+}
+
+
+void* CTdsStandIn::Main(void)
+{
+    STimeout timeout = { 0, 100000 };
+    while ( !m_Stop ) {
+        CSocket* sock = NULL;
+        if (m_Listener.Accept(sock, &timeout) == eIO_Success) {
+            sock->SetTimeout(eIO_ReadWrite, kInfiniteTimeout);
+            m_Sessions.push_back(CRef<CThread>(new CSession(*this, sock)));
+            m_Sessions.back()->Run();
+        }
+    }
+    return NULL;
+}
+
+
+void CTdsStandIn::Stop(void)
+{
+    m_Stop = true;
+    Join();
+    NON_CONST_ITERATE (vector< CRef<CThread> >, it, m_Sessions) {
+        (*it)->Join();
+    }
+}
+
+
+END_NCBI_SCOPE
@@ -0,0 +1,138 @@
+#ifndef DBAPI_DRIVER_FTDS95_CTLIB_SAMPLES___TDS_STAND_IN_FTDS95__HPP
+#define DBAPI_DRIVER_FTDS95_CTLIB_SAMPLES___TDS_STAND_IN_FTDS95__HPP
+
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   Local stand-in server speaking just enough TDS 7.3 for the samples
+ *   to run without a database server.
+ *
+ */
+
+#include <corelib/ncbithr.hpp>
+#include <connect/ncbi_socket.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTdsWriter::
+//
+
+// Composes the little-endian tokens of a reply.
+class CTdsWriter
+{
+public:
+    void PutByte (unsigned int b) { m_Data += char(b); }
+    void PutUint2(Uint2 v)        { PutByte(v & 0xFF);  PutByte(v >> 8); }
+    void PutUint4(Uint4 v)        { PutUint2(v & 0xFFFF);  PutUint2(v >> 16); }
+    void PutUint8(Uint8 v)
+    {
+        PutUint4(Uint4(v));
+        PutUint4(Uint4(v >> 32));
+    }
+    void PutUCS2 (const string& s);
+    void Append  (const string& s)              { m_Data += s; }
+    void Append  (const char* data, size_t len) { m_Data.append(data, len); }
+    // DONE token
+    void PutDone (Uint2 status, Uint2 cmd = 0, Uint8 count = 0);
+
+    string& GetData(void) { return m_Data; }
+
+private:
+    string m_Data;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTdsReader::
+//
+
+// Reads the little-endian fields of a client message.
+class CTdsReader
+{
+public:
+    CTdsReader(const string& data) : m_Data(data), m_Pos(0) { }
+
+    bool   AtEnd(void) const { return m_Pos >= m_Data.size(); }
+    Uint8  Get(size_t n);
+    string GetBytes(size_t n);
+
+private:
+    const string& m_Data;
+    size_t        m_Pos;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CTdsStandIn::
+//
+
+// Accepts connections on a local port, serving each in a thread of its
+// own.  Prelogin, login, and attention are answered here; SQL batches
+// and bulk loads are left to the overriders of OnBatch() and OnBulk().
+class CTdsStandIn : public CThread
+{
+public:
+    CTdsStandIn(const string& name);
+
+    unsigned short GetPort(void) const { return m_Port; }
+    // Stop accepting connections and wait for the sessions to end, as
+    // their clients disconnect.
+    void Stop(void);
+
+    unsigned int GetLogins(void);
+
+protected:
+    virtual void* Main(void);
+
+    // Reply to a SQL batch, given with the UCS-2 text narrowed; just
+    // DONE by default.
+    virtual void OnBatch(const string& query, CTdsWriter& out);
+    // Handle a bulk load message; return false to drop the connection
+    // (the default) instead of replying.
+    virtual bool OnBulk(const string& data, CTdsWriter& out);
+
+    // Guards the state of the overriders as well.
+    CFastMutex              m_Mutex;
+
+private:
+    class CSession;
+
+    string                  m_Name;
+    CListeningSocket        m_Listener;
+    unsigned short          m_Port;
+    volatile bool           m_Stop;
+    vector< CRef<CThread> > m_Sessions;
+    unsigned int            m_Logins;
+};
+
+
+END_NCBI_SCOPE
+
+
+#endif  /* DBAPI_DRIVER_FTDS95_CTLIB_SAMPLES___TDS_STAND_IN_FTDS95__HPP */
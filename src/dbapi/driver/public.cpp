@@ -679,6 +679,12 @@ bool CDB_Result::SkipItem()
     return GetIResult().SkipItem();
 }
 
+size_t CDB_Result::FetchBatch(CDB_ResultBatch& batch, size_t max_rows)
+{
+    CHECK_RESULT( GetIResultPtr() );
+    return GetIResult().FetchBatch(batch, max_rows);
+}
+
 
 CDB_Result::~CDB_Result()
 {
@@ -2922,9 +2922,16 @@ void CDB_Numeric::x_MakeFromString(unsigned int precision, unsigned int scale,
     }
     buff1[n] = 10;
 
+    // The conversion below stops at a leading zero, which fractional digits
+    // (as in "0.05") can still have here.
+    char* start = buff1;
+    while (*start == 0  &&  start[1] != 10) {
+        ++start;
+    }
+
     char  buff2[kMaxPrecision + 1];
     char* p[2];
-    p[0] = buff1;
+    p[0] = start;
     p[1] = buff2;
 
     // Setup everything now
@@ -0,0 +1,99 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'biblio.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/biblio/CitRetract.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_IN_INFO("", CCitRetract_Base::, EType, false)
+{
+    SET_ENUM_INTERNAL_NAME("CitRetract", "type");
+    SET_ENUM_MODULE("NCBI-Biblio");
+    ADD_ENUM_VALUE("retracted", eType_retracted);
+    ADD_ENUM_VALUE("notice", eType_notice);
+    ADD_ENUM_VALUE("in-error", eType_in_error);
+    ADD_ENUM_VALUE("erratum", eType_erratum);
+}
+END_ENUM_INFO
+
+void CCitRetract_Base::ResetExp(void)
+{
+    m_Exp.erase();
+    m_set_State[0] &= ~0xc;
+}
+
+void CCitRetract_Base::Reset(void)
+{
+    ResetType();
+    ResetExp();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("CitRetract", CCitRetract)
+{
+    SET_CLASS_MODULE("NCBI-Biblio");
+    ADD_NAMED_ENUM_MEMBER("type", m_Type, EType)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("exp", m_Exp)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+}
+END_CLASS_INFO
+
+// constructor
+CCitRetract_Base::CCitRetract_Base(void)
+    : m_Type((EType)(0))
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CCitRetract_Base::~CCitRetract_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,94 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'biblio.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/biblio/NCBI_Biblio_module.hpp>
+#include <objects/biblio/Affil.hpp>
+#include <objects/biblio/ArticleId.hpp>
+#include <objects/biblio/ArticleIdSet.hpp>
+#include <objects/biblio/Auth_list.hpp>
+#include <objects/biblio/Author.hpp>
+#include <objects/biblio/CitRetract.hpp>
+#include <objects/biblio/Cit_art.hpp>
+#include <objects/biblio/Cit_book.hpp>
+#include <objects/biblio/Cit_gen.hpp>
+#include <objects/biblio/Cit_jour.hpp>
+#include <objects/biblio/Cit_let.hpp>
+#include <objects/biblio/Cit_pat.hpp>
+#include <objects/biblio/Cit_proc.hpp>
+#include <objects/biblio/Cit_sub.hpp>
+#include <objects/biblio/Id_pat.hpp>
+#include <objects/biblio/Imprint.hpp>
+#include <objects/biblio/Meeting.hpp>
+#include <objects/biblio/Patent_priority.hpp>
+#include <objects/biblio/PubStatusDate.hpp>
+#include <objects/biblio/PubStatusDateSet.hpp>
+#include <objects/biblio/Title.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Biblio_RegisterModuleClasses(void)
+{
+    ncbi::objects::CAffil::GetTypeInfo();
+    ncbi::objects::CArticleId::GetTypeInfo();
+    ncbi::objects::CArticleIdSet::GetTypeInfo();
+    ncbi::objects::CAuth_list::GetTypeInfo();
+    ncbi::objects::CAuthor::GetTypeInfo();
+    ncbi::objects::CCitRetract::GetTypeInfo();
+    ncbi::objects::CCit_art::GetTypeInfo();
+    ncbi::objects::CCit_book::GetTypeInfo();
+    ncbi::objects::CCit_gen::GetTypeInfo();
+    ncbi::objects::CCit_jour::GetTypeInfo();
+    ncbi::objects::CCit_let::GetTypeInfo();
+    ncbi::objects::CCit_pat::GetTypeInfo();
+    ncbi::objects::CCit_proc::GetTypeInfo();
+    ncbi::objects::CCit_sub::GetTypeInfo();
+    ncbi::objects::CId_pat::GetTypeInfo();
+    ncbi::objects::CImprint::GetTypeInfo();
+    ncbi::objects::CMeeting::GetTypeInfo();
+    ncbi::objects::CPatent_priority::GetTypeInfo();
+    ncbi::objects::CPubStatusDate::GetTypeInfo();
+    ncbi::objects::CPubStatusDateSet::GetTypeInfo();
+    ncbi::objects::CTitle::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,31 @@
+#include <ncbi_pch.hpp>
+#include "Affil_.cpp"
+#include "ArticleId_.cpp"
+#include "ArticleIdSet_.cpp"
+#include "Auth_list_.cpp"
+#include "Author_.cpp"
+#include "CitRetract_.cpp"
+#include "Cit_art_.cpp"
+#include "Cit_book_.cpp"
+#include "Cit_gen_.cpp"
+#include "Cit_jour_.cpp"
+#include "Cit_let_.cpp"
+#include "Cit_pat_.cpp"
+#include "Cit_proc_.cpp"
+#include "Cit_sub_.cpp"
+#include "DOI_.cpp"
+#include "Id_pat_.cpp"
+#include "Imprint_.cpp"
+#include "MedlineUID_.cpp"
+#include "Meeting_.cpp"
+#include "PII_.cpp"
+#include "Patent_priority_.cpp"
+#include "PmPid_.cpp"
+#include "PmcID_.cpp"
+#include "PmcPid_.cpp"
+#include "PubMedId_.cpp"
+#include "PubStatus_.cpp"
+#include "PubStatusDate_.cpp"
+#include "PubStatusDateSet_.cpp"
+#include "Title_.cpp"
+#include "NCBI_Biblio_module.cpp"
@@ -0,0 +1,105 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'general.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/general/Dbtag.hpp>
+#include <objects/general/Object_id.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CDbtag_Base::ResetDb(void)
+{
+    m_Db.erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CDbtag_Base::ResetTag(void)
+{
+    if ( !m_Tag ) {
+        m_Tag.Reset(new TTag());
+        return;
+    }
+    (*m_Tag).Reset();
+}
+
+void CDbtag_Base::SetTag(CDbtag_Base::TTag& value)
+{
+    m_Tag.Reset(&value);
+}
+
+void CDbtag_Base::Reset(void)
+{
+    ResetDb();
+    ResetTag();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("Dbtag", CDbtag)
+{
+    SET_CLASS_MODULE("NCBI-General");
+    ADD_NAMED_STD_MEMBER("db", m_Db)->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_REF_MEMBER("tag", m_Tag, CObject_id);
+    info->RandomOrder();
+}
+END_CLASS_INFO
+
+// constructor
+CDbtag_Base::CDbtag_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetTag();
+    }
+}
+
+// destructor
+CDbtag_Base::~CDbtag_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
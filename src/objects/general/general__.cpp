@@ -0,0 +1,10 @@
+#include <ncbi_pch.hpp>
+#include "Date.cpp"
+#include "Date_std.cpp"
+#include "Dbtag.cpp"
+#include "Int_fuzz.cpp"
+#include "Name_std.cpp"
+#include "Object_id.cpp"
+#include "Person_id.cpp"
+#include "User_field.cpp"
+#include "User_object.cpp"
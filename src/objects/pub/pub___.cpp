@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "Pub_.cpp"
+#include "Pub_equiv_.cpp"
+#include "Pub_set_.cpp"
+#include "NCBI_Pub_module.cpp"
@@ -0,0 +1,88 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seq.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seq/GIBB_mod.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+BEGIN_NAMED_ENUM_INFO("GIBB-mod", EGIBB_mod, false)
+{
+    SET_ENUM_MODULE("NCBI-Sequence");
+    ADD_ENUM_VALUE("dna", eGIBB_mod_dna);
+    ADD_ENUM_VALUE("rna", eGIBB_mod_rna);
+    ADD_ENUM_VALUE("extrachrom", eGIBB_mod_extrachrom);
+    ADD_ENUM_VALUE("plasmid", eGIBB_mod_plasmid);
+    ADD_ENUM_VALUE("mitochondrial", eGIBB_mod_mitochondrial);
+    ADD_ENUM_VALUE("chloroplast", eGIBB_mod_chloroplast);
+    ADD_ENUM_VALUE("kinetoplast", eGIBB_mod_kinetoplast);
+    ADD_ENUM_VALUE("cyanelle", eGIBB_mod_cyanelle);
+    ADD_ENUM_VALUE("synthetic", eGIBB_mod_synthetic);
+    ADD_ENUM_VALUE("recombinant", eGIBB_mod_recombinant);
+    ADD_ENUM_VALUE("partial", eGIBB_mod_partial);
+    ADD_ENUM_VALUE("complete", eGIBB_mod_complete);
+    ADD_ENUM_VALUE("mutagen", eGIBB_mod_mutagen);
+    ADD_ENUM_VALUE("natmut", eGIBB_mod_natmut);
+    ADD_ENUM_VALUE("transposon", eGIBB_mod_transposon);
+    ADD_ENUM_VALUE("insertion-seq", eGIBB_mod_insertion_seq);
+    ADD_ENUM_VALUE("no-left", eGIBB_mod_no_left);
+    ADD_ENUM_VALUE("no-right", eGIBB_mod_no_right);
+    ADD_ENUM_VALUE("macronuclear", eGIBB_mod_macronuclear);
+    ADD_ENUM_VALUE("proviral", eGIBB_mod_proviral);
+    ADD_ENUM_VALUE("est", eGIBB_mod_est);
+    ADD_ENUM_VALUE("sts", eGIBB_mod_sts);
+    ADD_ENUM_VALUE("survey", eGIBB_mod_survey);
+    ADD_ENUM_VALUE("chromoplast", eGIBB_mod_chromoplast);
+    ADD_ENUM_VALUE("genemap", eGIBB_mod_genemap);
+    ADD_ENUM_VALUE("restmap", eGIBB_mod_restmap);
+    ADD_ENUM_VALUE("physmap", eGIBB_mod_physmap);
+    ADD_ENUM_VALUE("other", eGIBB_mod_other);
+}
+END_ENUM_INFO
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,106 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqblock.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seqblock/EMBL_xref.hpp>
+#include <objects/general/Object_id.hpp>
+#include <objects/seqblock/EMBL_dbname.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CEMBL_xref_Base::ResetDbname(void)
+{
+    if ( !m_Dbname ) {
+        m_Dbname.Reset(new TDbname());
+        return;
+    }
+    (*m_Dbname).Reset();
+}
+
+void CEMBL_xref_Base::SetDbname(CEMBL_xref_Base::TDbname& value)
+{
+    m_Dbname.Reset(&value);
+}
+
+void CEMBL_xref_Base::ResetId(void)
+{
+    m_Id.clear();
+    m_set_State[0] &= ~0xc;
+}
+
+void CEMBL_xref_Base::Reset(void)
+{
+    ResetDbname();
+    ResetId();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("EMBL-xref", CEMBL_xref)
+{
+    SET_CLASS_MODULE("EMBL-General");
+    ADD_NAMED_REF_MEMBER("dbname", m_Dbname, CEMBL_dbname);
+    ADD_NAMED_MEMBER("id", m_Id, STL_list, (STL_CRef, (CLASS, (CObject_id))))->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    info->RandomOrder();
+}
+END_CLASS_INFO
+
+// constructor
+CEMBL_xref_Base::CEMBL_xref_Base(void)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+    if ( !IsAllocatedInPool() ) {
+        ResetDbname();
+    }
+}
+
+// destructor
+CEMBL_xref_Base::~CEMBL_xref_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
@@ -0,0 +1,92 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqfeat.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+#include <objects/seqfeat/NCBI_Seqfeat_module.hpp>
+#include <objects/seqfeat/Cdregion.hpp>
+#include <objects/seqfeat/Clone_ref.hpp>
+#include <objects/seqfeat/Clone_seq.hpp>
+#include <objects/seqfeat/Clone_seq_set.hpp>
+#include <objects/seqfeat/Code_break.hpp>
+#include <objects/seqfeat/EvidenceBasis.hpp>
+#include <objects/seqfeat/ExperimentSupport.hpp>
+#include <objects/seqfeat/Feat_id.hpp>
+#include <objects/seqfeat/Gb_qual.hpp>
+#include <objects/seqfeat/Genetic_code.hpp>
+#include <objects/seqfeat/Genetic_code_table.hpp>
+#include <objects/seqfeat/Imp_feat.hpp>
+#include <objects/seqfeat/InferenceSupport.hpp>
+#include <objects/seqfeat/ModelEvidenceItem.hpp>
+#include <objects/seqfeat/ModelEvidenceSupport.hpp>
+#include <objects/seqfeat/Program_id.hpp>
+#include <objects/seqfeat/SeqFeatData.hpp>
+#include <objects/seqfeat/SeqFeatSupport.hpp>
+#include <objects/seqfeat/SeqFeatXref.hpp>
+#include <objects/seqfeat/Seq_feat.hpp>
+
+
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+void NCBI_Seqfeat_RegisterModuleClasses(void)
+{
+    ncbi::objects::CCdregion::GetTypeInfo();
+    ncbi::objects::CClone_ref::GetTypeInfo();
+    ncbi::objects::CClone_seq::GetTypeInfo();
+    ncbi::objects::CClone_seq_set::GetTypeInfo();
+    ncbi::objects::CCode_break::GetTypeInfo();
+    ncbi::objects::CEvidenceBasis::GetTypeInfo();
+    ncbi::objects::CExperimentSupport::GetTypeInfo();
+    ncbi::objects::CFeat_id::GetTypeInfo();
+    ncbi::objects::CGb_qual::GetTypeInfo();
+    ncbi::objects::CGenetic_code::GetTypeInfo();
+    ncbi::objects::CGenetic_code_table::GetTypeInfo();
+    ncbi::objects::CImp_feat::GetTypeInfo();
+    ncbi::objects::CInferenceSupport::GetTypeInfo();
+    ncbi::objects::CModelEvidenceItem::GetTypeInfo();
+    ncbi::objects::CModelEvidenceSupport::GetTypeInfo();
+    ncbi::objects::CProgram_id::GetTypeInfo();
+    ncbi::objects::CSeqFeatData::GetTypeInfo();
+    ncbi::objects::CSeqFeatSupport::GetTypeInfo();
+    ncbi::objects::CSeqFeatXref::GetTypeInfo();
+    ncbi::objects::CSeq_feat::GetTypeInfo();
+}
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
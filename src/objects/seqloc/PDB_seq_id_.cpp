@@ -0,0 +1,116 @@
+/* $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * File Description:
+ *   This code was generated by application DATATOOL
+ *   using the following specifications:
+ *   'seqloc.asn'.
+ *
+ * ATTENTION:
+ *   Don't edit or commit this file into CVS as this file will
+ *   be overridden (by DATATOOL) without warning!
+ * ===========================================================================
+ */
+
+// standard includes
+#include <ncbi_pch.hpp>
+#include <serial/serialimpl.hpp>
+
+// generated includes
+#include <objects/seqloc/PDB_seq_id.hpp>
+#include <objects/general/Date.hpp>
+BEGIN_NCBI_SCOPE
+
+BEGIN_objects_SCOPE // namespace ncbi::objects::
+
+
+// generated classes
+
+void CPDB_seq_id_Base::ResetMol(void)
+{
+    m_Mol.Set().erase();
+    m_set_State[0] &= ~0x3;
+}
+
+void CPDB_seq_id_Base::ResetRel(void)
+{
+    m_Rel.Reset();
+}
+
+void CPDB_seq_id_Base::SetRel(CPDB_seq_id_Base::TRel& value)
+{
+    m_Rel.Reset(&value);
+}
+
+CPDB_seq_id_Base::TRel& CPDB_seq_id_Base::SetRel(void)
+{
+    if ( !m_Rel )
+        m_Rel.Reset(new ncbi::objects::CDate());
+    return (*m_Rel);
+}
+
+void CPDB_seq_id_Base::ResetChain_id(void)
+{
+    m_Chain_id.erase();
+    m_set_State[0] &= ~0xc0;
+}
+
+void CPDB_seq_id_Base::Reset(void)
+{
+    ResetMol();
+    ResetChain();
+    ResetRel();
+    ResetChain_id();
+}
+
+BEGIN_NAMED_BASE_CLASS_INFO("PDB-seq-id", CPDB_seq_id)
+{
+    SET_CLASS_MODULE("NCBI-Seqloc");
+    ADD_NAMED_MEMBER("mol", m_Mol, CLASS, (CPDB_mol_id))->SetSetFlag(MEMBER_PTR(m_set_State[0]));
+    ADD_NAMED_STD_MEMBER("chain", m_Chain)->SetDefault(new TChain(32))->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    ADD_NAMED_REF_MEMBER("rel", m_Rel, CDate)->SetOptional();
+    ADD_NAMED_STD_MEMBER("chain-id", m_Chain_id)->SetSetFlag(MEMBER_PTR(m_set_State[0]))->SetOptional();
+    info->RandomOrder();
+}
+END_CLASS_INFO
+
+// constructor
+CPDB_seq_id_Base::CPDB_seq_id_Base(void)
+    : m_Chain(32)
+{
+    memset(m_set_State,0,sizeof(m_set_State));
+}
+
+// destructor
+CPDB_seq_id_Base::~CPDB_seq_id_Base(void)
+{
+}
+
+
+
+END_objects_SCOPE // namespace ncbi::objects::
+
+END_NCBI_SCOPE
+
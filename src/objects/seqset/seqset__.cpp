@@ -0,0 +1,3 @@
+#include <ncbi_pch.hpp>
+#include "Bioseq_set.cpp"
+#include "Seq_entry.cpp"
@@ -0,0 +1,5 @@
+#include <ncbi_pch.hpp>
+#include "VariantPlacement.cpp"
+#include "Variation.cpp"
+#include "VariationException.cpp"
+#include "VariationMethod.cpp"
@@ -0,0 +1,253 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Object manager workload from many threads: Seq-entries are read and
+ *   added to a scope, then the features of every sequence are iterated.
+ *   Compares CObject allocation by the system heap and by the slab
+ *   allocator (NCBI_OBJECT_SLAB_ALLOC=0/1).
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/test_mt.hpp>
+#include <corelib/ncbi_slab_alloc.hpp>
+#include <serial/serial.hpp>
+#include <serial/objistr.hpp>
+#include <serial/objostr.hpp>
+#include <objects/general/Object_id.hpp>
+#include <objects/seqset/Seq_entry.hpp>
+#include <objects/seqset/Bioseq_set.hpp>
+#include <objects/seq/Bioseq.hpp>
+#include <objects/seq/Seq_inst.hpp>
+#include <objects/seq/Seq_data.hpp>
+#include <objects/seq/IUPACna.hpp>
+#include <objects/seq/Seq_descr.hpp>
+#include <objects/seq/Seqdesc.hpp>
+#include <objects/seq/Seq_annot.hpp>
+#include <objects/seqfeat/Seq_feat.hpp>
+#include <objects/seqfeat/SeqFeatData.hpp>
+#include <objects/seqloc/Seq_id.hpp>
+#include <objects/seqloc/Seq_loc.hpp>
+#include <objects/seqloc/Seq_interval.hpp>
+#include <objmgr/object_manager.hpp>
+#include <objmgr/scope.hpp>
+#include <objmgr/bioseq_handle.hpp>
+#include <objmgr/feat_ci.hpp>
+
+#include <common/test_assert.h>  /* This header must go last */
+
+USING_NCBI_SCOPE;
+USING_SCOPE(objects);
+
+
+// Set of sequences with many small features, like a typical annotated
+// submission.
+static CRef<CSeq_entry> s_MakeEntry(size_t seqs, size_t feats)
+{
+    static const char kBases[] = "ACGT";
+    CRef<CSeq_entry> entry(new CSeq_entry);
+    CBioseq_set& bss = entry->SetSet();
+    bss.SetClass(CBioseq_set::eClass_genbank);
+    for (size_t i = 0; i < seqs; ++i) {
+        CRef<CSeq_id> id(new CSeq_id);
+        id->SetLocal().SetStr("seq" + NStr::NumericToString(i));
+
+        CRef<CSeq_entry> seq_entry(new CSeq_entry);
+        CBioseq& seq = seq_entry->SetSeq();
+        seq.SetId().push_back(id);
+        CRef<CSeqdesc> title(new CSeqdesc);
+        title->SetTitle("Test sequence " + NStr::NumericToString(i));
+        seq.SetDescr().Set().push_back(title);
+
+        string data(feats * 10 + 10, 'A');
+        for (size_t j = 0; j < data.size(); ++j) {
+            data[j] = kBases[(i + j * 7) % 4];
+        }
+        CSeq_inst& inst = seq.SetInst();
+        inst.SetRepr(CSeq_inst::eRepr_raw);
+        inst.SetMol(CSeq_inst::eMol_dna);
+        inst.SetLength(TSeqPos(data.size()));
+        inst.SetSeq_data().SetIupacna().Set(data);
+
+        CRef<CSeq_annot> annot(new CSeq_annot);
+        for (size_t j = 0; j < feats; ++j) {
+            CRef<CSeq_feat> feat(new CSeq_feat);
+            feat->SetData().SetRegion("region " + NStr::NumericToString(j));
+            feat->SetComment("feature " + NStr::NumericToString(j));
+            CSeq_interval& loc = feat->SetLocation().SetInt();
+            loc.SetId(*id);
+            loc.SetFrom(TSeqPos(j * 10));
+            loc.SetTo(TSeqPos(j * 10 + 15));
+            annot->SetData().SetFtable().push_back(feat);
+        }
+        seq.SetAnnot().push_back(annot);
+        bss.SetSeq_set().push_back(seq_entry);
+    }
+    return entry;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  Test application
+
+class CTestObjMgrAllocApp : public CThreadedApp
+{
+public:
+    virtual bool Thread_Run(int idx);
+protected:
+    virtual bool TestApp_Args(CArgDescriptions& args);
+    virtual bool TestApp_Init(void);
+    virtual bool TestApp_Exit(void);
+private:
+    void x_Report(int idx, const char* name, double elapsed);
+
+    size_t m_Iterations;
+    size_t m_Seqs;
+    size_t m_Feats;
+    string m_Data;  // the Seq-entry in ASN.1 binary
+};
+
+
+void CTestObjMgrAllocApp::x_Report(int idx, const char* name,
+                                   double elapsed)
+{
+    NcbiCout << "Thread " << idx << ": " << m_Iterations << " x " << name
+             << " in " << elapsed << " sec" << NcbiEndl;
+}
+
+
+bool CTestObjMgrAllocApp::Thread_Run(int idx)
+{
+    CRef<CObjectManager> om = CObjectManager::GetInstance();
+    double load_time = 0, iterate_time = 0, free_time = 0;
+
+    TestApp_GlobalSyncPoint();
+
+    CStopWatch sw;
+    for (size_t i = 0; i < m_Iterations; ++i) {
+        // Load: read the entry and add it to a new scope
+        sw.Restart();
+        CRef<CScope> scope(new CScope(*om));
+        {{
+            CNcbiIstrstream str(m_Data.data(), m_Data.size());
+            auto_ptr<CObjectIStream> in
+                (CObjectIStream::Open(eSerial_AsnBinary, str));
+            CRef<CSeq_entry> entry(new CSeq_entry);
+            *in >> *entry;
+            scope->AddTopLevelSeqEntry(*entry);
+        }}
+        load_time += sw.Elapsed();
+
+        // Iterate: the first iteration indexes the features
+        sw.Restart();
+        size_t feats = 0;
+        TSeqPos length = 0;
+        CSeq_id id;
+        for (size_t s = 0; s < m_Seqs; ++s) {
+            id.SetLocal().SetStr("seq" + NStr::NumericToString(s));
+            CBioseq_Handle bh = scope->GetBioseqHandle(id);
+            _ASSERT(bh);
+            for (CFeat_CI it(bh); it; ++it) {
+                ++feats;
+                length += it->GetRange().GetLength();
+            }
+        }
+        iterate_time += sw.Elapsed();
+        _ASSERT(feats == m_Seqs * m_Feats);
+        _ASSERT(length == feats * 16);
+
+        // Free: the scope releases the entry and its index
+        sw.Restart();
+        scope.Reset();
+        free_time += sw.Elapsed();
+    }
+    x_Report(idx, "read and add to scope", load_time);
+    x_Report(idx, "feature iteration", iterate_time);
+    x_Report(idx, "scope release", free_time);
+    TestApp_GlobalSyncPoint();
+    return true;
+}
+
+
+bool CTestObjMgrAllocApp::TestApp_Args(CArgDescriptions& args)
+{
+    args.AddDefaultKey("iterations", "Iterations",
+                       "Number of Seq-entries loaded by each thread",
+                       CArgDescriptions::eInteger, "100");
+    args.AddDefaultKey("seqs", "Sequences",
+                       "Number of sequences in the Seq-entry",
+                       CArgDescriptions::eInteger, "20");
+    args.AddDefaultKey("feats", "Features",
+                       "Number of features of each sequence",
+                       CArgDescriptions::eInteger, "50");
+    return true;
+}
+
+
+bool CTestObjMgrAllocApp::TestApp_Init(void)
+{
+    const CArgs& args = GetArgs();
+    m_Iterations = size_t(args["iterations"].AsInteger());
+    m_Seqs = size_t(args["seqs"].AsInteger());
+    m_Feats = size_t(args["feats"].AsInteger());
+    CRef<CSeq_entry> entry = s_MakeEntry(m_Seqs, m_Feats);
+    CNcbiOstrstream str;
+    {{
+        auto_ptr<CObjectOStream> out
+            (CObjectOStream::Open(eSerial_AsnBinary, str));
+        *out << *entry;
+    }}
+    m_Data = CNcbiOstrstreamToString(str);
+
+    NcbiCout << NcbiEndl
+             << "Testing object manager allocation with "
+             << NStr::IntToString(s_NumThreads) << " threads, "
+             << (CSlabAllocator::IsUsedForObjects()?
+                 "slab allocator": "system heap")
+             << "..." << NcbiEndl;
+    return true;
+}
+
+
+bool CTestObjMgrAllocApp::TestApp_Exit(void)
+{
+    NcbiCout << "Test completed successfully!"
+             << NcbiEndl << NcbiEndl;
+    return true;
+}
+
+
+
+///////////////////////////////////
+// MAIN
+//
+
+int main(int argc, const char* argv[])
+{
+    return CTestObjMgrAllocApp().AppMain(argc, argv);
+}
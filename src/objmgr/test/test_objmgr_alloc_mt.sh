@@ -0,0 +1,10 @@
+#! /bin/sh
+# $Id$
+
+# The first argument selects the allocator of CObjects (0 or 1).
+NCBI_OBJECT_SLAB_ALLOC=$1
+export NCBI_OBJECT_SLAB_ALLOC
+shift
+
+$CHECK_EXEC test_objmgr_alloc_mt $@
+exit $?
@@ -0,0 +1,695 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:
+ *   Reading big FASTA files by several threads
+ *
+ * ===========================================================================
+ */
+
+#include <ncbi_pch.hpp>
+
+#include <objtools/readers/fasta_parallel.hpp>
+#include <objtools/readers/fasta_exception.hpp>
+#include <objtools/readers/reader_exception.hpp>
+#include <objtools/error_codes.hpp>
+
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbi_system.hpp>
+#include <corelib/ncbiutil.hpp>
+#include <util/thread_pool.hpp>
+
+#include <objects/seqloc/Seq_id.hpp>
+#include <objects/seqset/Seq_entry.hpp>
+#include <objects/seqset/Bioseq_set.hpp>
+
+#include <string.h>
+
+
+#define NCBI_USE_ERRCODE_X   Objtools_Rd_Fasta
+
+BEGIN_NCBI_SCOPE
+BEGIN_SCOPE(objects)
+
+
+// Default size of chunk parsed by one thread
+static const size_t kDefaultChunkSize = 8 * 1024 * 1024;
+
+// Local IDs of not yet generated IDs, the number is appended
+static const char kPlaceholderID[] = "(parallel-fasta-id-";
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CParallelFastaItem -- result of reading of one sequence
+
+class CParallelFastaItem : public CObject
+{
+public:
+    CParallelFastaItem(void)
+        : m_DefLine(0), m_DefLineMessages(0)
+        { }
+
+    CRef<CSeq_entry>        m_Entry;
+    CMessageListenerLenient m_Messages;
+    // IDs of the sequence as parsed from the defline
+    CBioseq::TId            m_IDs;
+    // IDs that must be replaced by generated ones
+    CBioseq::TId            m_GeneratedIDs;
+    unsigned int            m_DefLine;
+    // Number of messages posted before the end of the defline parsing
+    size_t                  m_DefLineMessages;
+
+    // Exception thrown by the reader (at most one is set). A toolkit
+    // exception is kept as the predecessor of m_Error, which stores a
+    // clone of the exact type; m_Error->GetPredecessor()->Throw()
+    // rethrows it without slicing.
+    AutoPtr<CException>     m_Error;
+    AutoPtr<string>         m_StdError;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CParallelFastaLineReader -- lines of one chunk, numbered from the
+//  beginning of the whole input
+
+class CParallelFastaLineReader : public CMemoryLineReader
+{
+public:
+    CParallelFastaLineReader(const char* start, size_t size,
+                             unsigned int line_base, Int8 offset)
+        : CMemoryLineReader(start, size),
+          m_LineBase(line_base),
+          m_Offset(offset)
+        { }
+
+    CT_POS_TYPE GetPosition(void) const
+    {
+        return NcbiInt8ToStreampos(
+            NcbiStreamposToInt8(CMemoryLineReader::GetPosition()) + m_Offset);
+    }
+    unsigned int GetLineNumber(void) const
+    {
+        return CMemoryLineReader::GetLineNumber() + m_LineBase;
+    }
+
+private:
+    unsigned int m_LineBase;
+    Int8         m_Offset;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CParallelFastaChunkReader -- CFastaReader which leaves the state shared
+//  by all chunks (ID generation, unique IDs check) to CParallelFastaReader
+
+class CParallelFastaChunkReader : public CFastaReader
+{
+public:
+    CParallelFastaChunkReader(ILineReader& reader, TFlags flags,
+                              CReaderBase::TReaderFlags reader_flags)
+        : CFastaReader(reader, flags & ~fUniqueIDs),
+          m_Item(0)
+        {
+            m_iFlags = reader_flags;
+        }
+
+    void SetItem(CParallelFastaItem* item) { m_Item = item; }
+
+protected:
+    virtual void ParseDefLine(const TStr& s,
+                              ILineErrorListener* pMessageListener)
+    {
+        m_Item->m_DefLine = LineNumber();
+        CFastaReader::ParseDefLine(s, pMessageListener);
+        m_Item->m_IDs = GetIDs();
+        m_Item->m_DefLineMessages = m_Item->m_Messages.Count();
+    }
+
+    virtual void GenerateID(void)
+    {
+        // The real ID is assigned in place when the sequence is returned
+        CRef<CSeq_id> id(new CSeq_id(CSeq_id::e_Local, kPlaceholderID +
+            NStr::NumericToString(m_Item->m_GeneratedIDs.size()) + ")"));
+        m_Item->m_GeneratedIDs.push_back(id);
+        SetIDs().push_back(id);
+    }
+
+    virtual CRef<CSeq_entry> x_ReadSegSet(ILineErrorListener*)
+    {
+        NCBI_THROW2(CObjReaderParseException, eBadSegSet,
+                    "CParallelFastaReader: Segmented sets are not supported"
+                    " around line " + NStr::NumericToString(LineNumber()),
+                    LineNumber());
+    }
+
+private:
+    CParallelFastaItem* m_Item;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CParallelFastaChunk -- part of input parsed by one thread
+
+class CParallelFastaChunk : public CThreadPool_Task
+{
+public:
+    CParallelFastaChunk(const CParallelFastaReader& owner)
+        : m_Data(0), m_Size(0), m_Offset(0),
+          m_LineCount(0), m_LineBase(0),
+          m_LineBaseKnown(0, 1), m_Done(0, 1), m_Finished(false),
+          m_Owner(owner)
+        { }
+
+    virtual EStatus Execute(void);
+
+    /// Wait until all sequences of the chunk are parsed
+    void WaitDone(void)
+    {
+        if ( !m_Finished ) {
+            m_Done.Wait();
+            m_Finished = true;
+        }
+    }
+
+    typedef vector< CRef<CParallelFastaItem> > TItems;
+
+    const char*               m_Data;
+    size_t                    m_Size;
+    string                    m_Buffer;  // data read from stream
+    Int8                      m_Offset;
+    CRef<CParallelFastaChunk> m_Prev;
+    unsigned int              m_LineCount;
+    unsigned int              m_LineBase;
+    CSemaphore                m_LineBaseKnown;
+    CSemaphore                m_Done;
+    bool                      m_Finished;
+    TItems                    m_Items;
+
+private:
+    void x_Parse(void);
+
+    const CParallelFastaReader& m_Owner;
+};
+
+
+// Count lines the same way as CMemoryLineReader does: "\r\n", "\n" and
+// "\r" end a line
+static unsigned int s_CountLines(const char* data, size_t size)
+{
+    unsigned int count = 0;
+    const char* end = data + size;
+    for (const char* p = data;  p != end;  ++p) {
+        if (*p == '\n') {
+            ++count;
+        } else if (*p == '\r'  &&  (p + 1 == end  ||  p[1] != '\n')) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+// Skip the rest of a sequence after an exception
+static void s_SkipToDefLine(ILineReader& reader)
+{
+    int depth = 0; // of segmented sets
+    while ( !reader.AtEOF() ) {
+        char c = reader.PeekChar();
+        CTempString line = *++reader;
+        if (c == '>'  &&  depth <= 0  &&  !NStr::StartsWith(line, ">?")) {
+            reader.UngetLine();
+            break;
+        } else if (c == '[') {
+            ++depth;
+        } else if (c == ']') {
+            --depth;
+        }
+    }
+}
+
+
+CThreadPool_Task::EStatus CParallelFastaChunk::Execute(void)
+{
+    // Line numbers in the chunk depend on the sizes of all previous chunks
+    m_LineCount = s_CountLines(m_Data, m_Size);
+    if ( m_Prev ) {
+        m_Prev->m_LineBaseKnown.Wait();
+        m_LineBase = m_Prev->m_LineBase + m_Prev->m_LineCount;
+        m_Prev.Reset();
+    }
+    m_LineBaseKnown.Post();
+
+    if ( !m_Owner.m_Canceled.Get() ) {
+        x_Parse();
+    }
+    m_Done.Post();
+    return eCompleted;
+}
+
+
+void CParallelFastaChunk::x_Parse(void)
+{
+    CRef<CParallelFastaLineReader> line_reader
+        (new CParallelFastaLineReader(m_Data, m_Size, m_LineBase, m_Offset));
+    CParallelFastaChunkReader reader(*line_reader, m_Owner.m_Flags,
+                                     m_Owner.m_ReaderFlags);
+    m_Owner.x_InitChunkReader(reader);
+
+    while ( !line_reader->AtEOF()  &&  !m_Owner.m_Canceled.Get() ) {
+        CRef<CParallelFastaItem> item(new CParallelFastaItem);
+        m_Items.push_back(item);
+        reader.SetItem(item);
+        try {
+            item->m_Entry = reader.ReadOneSeq(&item->m_Messages);
+            continue;
+        }
+        catch (CException& e) {
+            item->m_Error.reset(new CException(DIAG_COMPILE_INFO, &e,
+                                               CException::eUnknown,
+                                               e.GetMsg()));
+        }
+        catch (exception& e) {
+            item->m_StdError.reset(new string(e.what()));
+        }
+        s_SkipToDefLine(*line_reader);
+    }
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//  CParallelFastaReader
+
+CParallelFastaReader::CParallelFastaReader(const string& path,
+                                           TFlags flags,
+                                           unsigned int threads)
+    : m_Flags(flags), m_Stream(0)
+{
+    x_Init(threads);
+    if (CFile(path).GetLength() > 0) {
+        try {
+            m_MemFile.reset(new CMemoryFile(path));
+            m_MemFile->MemMapAdvise(CMemoryFile::eMMA_Sequential);
+            m_DataPos = static_cast<const char*>(m_MemFile->GetPtr());
+            m_DataEnd = m_DataPos + m_MemFile->GetSize();
+            return;
+        }
+        catch (CException&) {
+            // Mapping is not possible, read file as a stream
+            m_MemFile.reset();
+        }
+    }
+    m_OwnStream.reset(new CNcbiIfstream(path.c_str(), IOS_BASE::binary));
+    if ( !*m_OwnStream ) {
+        NCBI_THROW(CFileException, eNotExists,
+                   "CParallelFastaReader: Cannot open file " + path);
+    }
+    m_Stream = m_OwnStream.get();
+}
+
+
+CParallelFastaReader::CParallelFastaReader(CNcbiIstream& in,
+                                           TFlags flags,
+                                           unsigned int threads)
+    : m_Flags(flags), m_Stream(&in)
+{
+    x_Init(threads);
+}
+
+
+void CParallelFastaReader::x_Init(unsigned int threads)
+{
+    m_ReaderFlags = CReaderBase::fNormal;
+    m_ChunkSize = kDefaultChunkSize;
+    m_IDGenerator.Reset(new CSeqIdGenerator);
+    m_MaxIDLength = kMax_UI4;
+    m_GapNmin = 0;
+    m_GapUnknownLength = 0;
+    m_GapTypeSet = false;
+    m_GapType = CSeq_gap::eType_unknown;
+    m_DataPos = m_DataEnd = 0;
+    m_InputOffset = 0;
+    m_InputDone = false;
+    m_NextItem = 0;
+
+    if (threads == 0) {
+        threads = max(GetCpuCount(), 1u);
+    }
+    // Keep all threads busy while the caller takes parsed sequences
+    m_MaxChunks = threads * 2 + 1;
+    m_ThreadPool.reset(new CThreadPool(kMax_UInt, threads, threads));
+}
+
+
+CParallelFastaReader::~CParallelFastaReader(void)
+{
+    // Let queued chunks finish without parsing
+    m_Canceled.Set(1);
+    NON_CONST_ITERATE(TChunks, it, m_Chunks) {
+        (*it)->WaitDone();
+    }
+    m_Chunks.clear();
+    m_LastChunk.Reset();
+    m_ThreadPool.reset();
+}
+
+
+void CParallelFastaReader::SetChunkSize(size_t size)
+{
+    m_ChunkSize = max(size, size_t(1));
+}
+
+
+void CParallelFastaReader::SetIDGenerator(CSeqIdGenerator& gen)
+{
+    m_IDGenerator.Reset(&gen);
+}
+
+
+void CParallelFastaReader::SetMinGaps(TSeqPos gapNmin,
+                                      TSeqPos gap_Unknown_length)
+{
+    m_GapNmin = gapNmin;
+    m_GapUnknownLength = gap_Unknown_length;
+}
+
+
+void CParallelFastaReader::SetGapLinkageEvidences(CSeq_gap::EType type,
+                                                  const set<int>& evidences)
+{
+    m_GapTypeSet = true;
+    m_GapType = type;
+    m_GapLinkageEvidences = evidences;
+}
+
+
+void CParallelFastaReader::IgnoreProblem(ILineError::EProblem problem)
+{
+    m_IgnoredProblems.push_back(problem);
+}
+
+
+void CParallelFastaReader::x_InitChunkReader(CFastaReader& reader) const
+{
+    reader.SetMaxIDLength(m_MaxIDLength);
+    reader.SetMinGaps(m_GapNmin, m_GapUnknownLength);
+    if ( m_GapTypeSet ) {
+        reader.SetGapLinkageEvidences(m_GapType, m_GapLinkageEvidences);
+    }
+    ITERATE(vector<ILineError::EProblem>, it, m_IgnoredProblems) {
+        reader.IgnoreProblem(*it);
+    }
+}
+
+
+// Find the beginning of a defline at 'from' or later;
+// return 'end' if there is none.
+static const char* s_FindChunkEnd(const char* start, const char* end,
+                                  size_t from)
+{
+    if (size_t(end - start) <= from) {
+        return end;
+    }
+    for (const char* p = start + max(from, size_t(1));  p < end;  ++p) {
+        p = static_cast<const char*>(memchr(p, '>', end - p));
+        if ( !p ) {
+            break;
+        }
+        if ((p[-1] == '\n'  ||  p[-1] == '\r')  &&
+            (p + 1 == end  ||  p[1] != '?')) {
+            return p;
+        }
+    }
+    return end;
+}
+
+
+bool CParallelFastaReader::x_NextMemoryChunk(CParallelFastaChunk& chunk)
+{
+    if (m_DataPos == m_DataEnd) {
+        return false;
+    }
+    const char* end = s_FindChunkEnd(m_DataPos, m_DataEnd, m_ChunkSize);
+    chunk.m_Data = m_DataPos;
+    chunk.m_Size = end - m_DataPos;
+    m_DataPos = end;
+    return true;
+}
+
+
+bool CParallelFastaReader::x_NextStreamChunk(CParallelFastaChunk& chunk)
+{
+    string& buffer = chunk.m_Buffer;
+    buffer.swap(m_StreamTail);
+    m_StreamTail.erase();
+
+    size_t search_from = m_ChunkSize;
+    for (;;) {
+        // Read beyond the chunk size, or more if there was no defline
+        while (buffer.size() <= search_from  &&  *m_Stream) {
+            size_t size = buffer.size();
+            size_t add = max(search_from - size, m_ChunkSize / 4 + 1);
+            buffer.resize(size + add);
+            m_Stream->read(&buffer[size], add);
+            buffer.resize(size + size_t(m_Stream->gcount()));
+        }
+        const char* start = buffer.data();
+        const char* end = s_FindChunkEnd(start, start + buffer.size(),
+                                          search_from);
+        if (end != start + buffer.size()  ||  !*m_Stream) {
+            m_StreamTail.assign(end, start + buffer.size() - end);
+            buffer.resize(end - start);
+            break;
+        }
+        search_from = buffer.size();
+    }
+    if ( buffer.empty() ) {
+        return false;
+    }
+    chunk.m_Data = buffer.data();
+    chunk.m_Size = buffer.size();
+    return true;
+}
+
+
+CRef<CParallelFastaChunk> CParallelFastaReader::x_NextChunk(void)
+{
+    CRef<CParallelFastaChunk> chunk(new CParallelFastaChunk(*this));
+    if ( !(m_MemFile ? x_NextMemoryChunk(*chunk)
+                     : x_NextStreamChunk(*chunk)) ) {
+        return CRef<CParallelFastaChunk>();
+    }
+    chunk->m_Offset = m_InputOffset;
+    m_InputOffset += chunk->m_Size;
+    chunk->m_Prev = m_LastChunk;
+    m_LastChunk = chunk;
+    return chunk;
+}
+
+
+void CParallelFastaReader::x_FillPipeline(void)
+{
+    while ( !m_InputDone  &&  m_Chunks.size() < m_MaxChunks ) {
+        CRef<CParallelFastaChunk> chunk = x_NextChunk();
+        if ( !chunk ) {
+            m_InputDone = true;
+            m_LastChunk.Reset();
+            break;
+        }
+        m_Chunks.push_back(chunk);
+        m_ThreadPool->AddTask(chunk);
+    }
+}
+
+
+CParallelFastaItem* CParallelFastaReader::x_NextItem(void)
+{
+    for (;;) {
+        x_FillPipeline();
+        if ( m_Chunks.empty() ) {
+            return 0;
+        }
+        CParallelFastaChunk& chunk = *m_Chunks.front();
+        chunk.WaitDone();
+        if (m_NextItem < chunk.m_Items.size()) {
+            return chunk.m_Items[m_NextItem];
+        }
+        m_Chunks.pop_front();
+        m_NextItem = 0;
+    }
+}
+
+
+bool CParallelFastaReader::AtEOF(void)
+{
+    return x_NextItem() == 0;
+}
+
+
+void CParallelFastaReader::x_PostError(const ILineError& error,
+                                       ILineErrorListener* pMessageListener)
+{
+    // Same as CFastaReader::PostWarning()
+    if ( !pMessageListener  &&  error.Severity() <= eDiag_Warning ) {
+        LOG_POST_X(1, Warning << error.Message());
+    } else if ( !pMessageListener  ||  !pMessageListener->PutError(error) ) {
+        const CObjReaderLineException* line_error =
+            dynamic_cast<const CObjReaderLineException*>(&error);
+        throw CObjReaderParseException(DIAG_COMPILE_INFO, 0,
+            line_error ? CObjReaderParseException::EErrCode(
+                             line_error->GetErrCode())
+                       : CObjReaderParseException::eFormat,
+            error.ErrorMessage(), error.Line(), error.Severity());
+    }
+}
+
+
+CRef<CSeq_entry>
+CParallelFastaReader::x_EmitItem(CParallelFastaItem& item,
+                                 ILineErrorListener* pMessageListener)
+{
+    // Generate IDs in the input order
+    map<string, string> renamed;
+    NON_CONST_ITERATE(CBioseq::TId, it, item.m_GeneratedIDs) {
+        string placeholder = (*it)->AsFastaString();
+        CRef<CSeq_id> id;
+        do {
+            id = m_IDGenerator->GenerateID(true);
+        } while ((m_Flags & CFastaReader::fUniqueIDs)  &&
+                 m_IDTracker.find(CSeq_id_Handle::GetHandle(*id))
+                 != m_IDTracker.end());
+        // The same object is referenced by Bioseq and alignments
+        (*it)->Assign(*id);
+        renamed[placeholder] = (*it)->AsFastaString();
+    }
+
+    for (size_t i = 0;  i <= item.m_Messages.Count();  ++i) {
+        if (i == item.m_DefLineMessages  &&
+            (m_Flags & CFastaReader::fUniqueIDs)) {
+            ITERATE(CBioseq::TId, it, item.m_IDs) {
+                CSeq_id_Handle h = CSeq_id_Handle::GetHandle(**it);
+                if ( !m_IDTracker.insert(h).second ) {
+                    CRef<CSeq_id> best_id =
+                        FindBestChoice(item.m_IDs, CSeq_id::BestRank);
+                    AutoPtr<CObjReaderLineException> error(
+                        CObjReaderLineException::Create(
+                            eDiag_Error, item.m_DefLine,
+                            "CFastaReader: Seq-id " + h.AsString() +
+                            " is a duplicate around line " +
+                            NStr::NumericToString(item.m_DefLine),
+                            ILineError::eProblem_GeneralParsingError,
+                            best_id ? best_id->AsFastaString() : kEmptyStr,
+                            kEmptyStr, kEmptyStr, kEmptyStr,
+                            CObjReaderParseException::eDuplicateID));
+                    x_PostError(*error, pMessageListener);
+                }
+            }
+        }
+        if (i == item.m_Messages.Count()) {
+            break;
+        }
+        const ILineError& error = item.m_Messages.GetError(i);
+        map<string, string>::const_iterator new_id =
+            renamed.find(error.SeqId());
+        if (new_id == renamed.end()) {
+            x_PostError(error, pMessageListener);
+            continue;
+        }
+        const CObjReaderLineException* line_error =
+            dynamic_cast<const CObjReaderLineException*>(&error);
+        AutoPtr<CObjReaderLineException> renamed_error(
+            CObjReaderLineException::Create(
+                error.Severity(), error.Line(), error.ErrorMessage(),
+                error.Problem(), new_id->second, error.FeatureName(),
+                error.QualifierName(), error.QualifierValue(),
+                line_error ? CObjReaderParseException::EErrCode(
+                                 line_error->GetErrCode())
+                           : CObjReaderParseException::eFormat,
+                error.OtherLines()));
+        x_PostError(*renamed_error, pMessageListener);
+    }
+
+    if ( item.m_Error.get() ) {
+        item.m_Error->GetPredecessor()->Throw();
+    }
+    if ( item.m_StdError.get() ) {
+        throw runtime_error(*item.m_StdError);
+    }
+    return item.m_Entry;
+}
+
+
+CRef<CSeq_entry>
+CParallelFastaReader::ReadOneSeq(ILineErrorListener* pMessageListener)
+{
+    CRef<CParallelFastaItem> item(x_NextItem());
+    if ( !item ) {
+        NCBI_THROW2(CObjReaderParseException, eEOF,
+                    "CParallelFastaReader: Unexpected end-of-file", 0);
+    }
+    ++m_NextItem;
+    return x_EmitItem(*item, pMessageListener);
+}
+
+
+CRef<CSeq_entry>
+CParallelFastaReader::ReadSet(int max_seqs,
+                              ILineErrorListener* pMessageListener)
+{
+    // Same as CFastaReader::ReadSet()
+    CRef<CSeq_entry> entry(new CSeq_entry);
+    if (m_Flags & CFastaReader::fOneSeq) {
+        max_seqs = 1;
+    }
+    for (int i = 0;  i < max_seqs  &&  !AtEOF();  ++i) {
+        try {
+            CRef<CSeq_entry> entry2(ReadOneSeq(pMessageListener));
+            if (max_seqs == 1) {
+                return entry2;
+            }
+            if (entry2.NotEmpty())
+              entry->SetSet().SetSeq_set().push_back(entry2);
+        } catch (CObjReaderParseException& e) {
+            if (e.GetErrCode() == CObjReaderParseException::eEOF) {
+                break;
+            } else {
+                throw;
+            }
+        }
+    }
+
+    entry->Parentize();
+
+    if (entry->IsSet()  &&  entry->GetSet().GetSeq_set().size() == 1) {
+        return entry->SetSet().SetSeq_set().front();
+    } else {
+        return entry;
+    }
+}
+
+
+END_SCOPE(objects)
+END_NCBI_SCOPE
@@ -156,7 +156,8 @@ CGff3Reader::CGff3Reader(
     const string& name,
     const string& title ):
 //  ----------------------------------------------------------------------------
-    CGff2Reader( uFlags, name, title )
+    CGff2Reader( uFlags, name, title ),
+    mStreamStarted(false)
 {
     CGff2Record::ResetId();
 }
@@ -174,6 +175,143 @@ bool CGff3Reader::IsInGenbankMode() const
     return (m_iFlags & CGff3Reader::fGenbankMode);
 }
 
+//  ----------------------------------------------------------------------------
+CRef<CSeq_annot>
+CGff3Reader::ReadSeqAnnot(
+    CNcbiIstream& istr,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    //  the last line read from a region may belong to the next one and is
+    //  pushed back into the line reader, so the reader has to live until
+    //  the end of the stream (or until ResetStream()):
+    if (!mpIstrLineReader) {
+        mpIstrLineReader.Reset(new CStreamLineReader(istr));
+    }
+    return ReadSeqAnnot(*mpIstrLineReader, pEC);
+}
+
+//  ----------------------------------------------------------------------------
+CRef<CSeq_annot>
+CGff3Reader::ReadSeqAnnot(
+    ILineReader& lr,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    if (!mStreamStarted) {
+        xReadInit();
+        xProgressInit(lr);
+        mStreamStarted = true;
+    }
+
+    while (mPendingAnnots.empty()) {
+        if (!xReadRegion(lr, pEC)) {
+            ResetStream();
+            return CRef<CSeq_annot>();
+        }
+    }
+    CRef<CSeq_annot> pAnnot = mPendingAnnots.front();
+    mPendingAnnots.pop_front();
+    return pAnnot;
+}
+
+//  ----------------------------------------------------------------------------
+void
+CGff3Reader::ResetStream()
+//  ----------------------------------------------------------------------------
+{
+    xResetRegion();
+    mPendingAnnots.clear();
+    mpIstrLineReader.Reset();
+    mStreamStarted = false;
+}
+
+//  ----------------------------------------------------------------------------
+bool CGff3Reader::xReadRegion(
+    ILineReader& lr,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    TAnnots annots;
+    string regionId;
+    string line;
+    bool lineRead = false;
+    while (xGetLine(lr, line)) {
+        if (IsCanceled()) {
+            AutoPtr<CObjReaderLineException> pErr(
+                CObjReaderLineException::Create(
+                eDiag_Info,
+                0,
+                "Reader stopped by user.",
+                ILineError::eProblem_ProgressInfo));
+            ProcessError(*pErr, pEC);
+            xResetRegion();
+            return false;
+        }
+        xReportProgress(pEC);
+
+        if (line == "###") {
+            // all forward references resolved
+            lineRead = true;
+            if (regionId.empty()) {
+                continue;
+            }
+            break;
+        }
+        if (!regionId.empty()  &&
+                (xIsTrackLine(line)  ||  xIsBrowserLine(line))) {
+            xUngetLine(lr);
+            break;
+        }
+        lineRead = true;
+        try {
+            if ( x_ParseStructuredCommentGff( line, m_CurrentTrackInfo ) ) {
+                continue;
+            }
+            if ( x_ParseBrowserLineGff( line, m_CurrentBrowserInfo ) ) {
+                continue;
+            }
+            if ( x_ParseTrackLineGff( line, m_CurrentTrackInfo ) ) {
+                continue;
+            }
+            string lineId = line.substr(0, line.find_first_of(" \t"));
+            if (!regionId.empty()  &&  lineId != regionId) {
+                xUngetLine(lr);
+                break;
+            }
+            regionId = lineId;
+            x_ParseDataGff(line, annots, pEC);
+        }
+        catch( CObjReaderLineException& err ) {
+            err.SetLineNumber( m_uLineNumber );
+            ProcessError(err, pEC);
+        }
+    }
+
+    // features may refer to their parents only within the region
+    for (TAnnots::iterator it = annots.begin(); it != annots.end(); ++it) {
+        try {
+            xAnnotPostProcess(*it);
+        }
+        catch(CObjReaderLineException& err) {
+            err.SetLineNumber(m_uLineNumber);
+            ProcessError(err, pEC);
+        }
+    }
+    xResetRegion();
+    mPendingAnnots.splice(mPendingAnnots.end(), annots);
+    return lineRead;
+}
+
+//  ----------------------------------------------------------------------------
+void CGff3Reader::xResetRegion()
+//  ----------------------------------------------------------------------------
+{
+    m_MapIdToFeature.clear();
+    mMrnaLocs.clear();
+    mCdsParentMap.clear();
+}
+
 //  ----------------------------------------------------------------------------
 bool CGff3Reader::x_UpdateFeatureCds(
     const CGff2Record& gff,
@@ -126,6 +126,11 @@ ILineError *CObjReaderLineException::Clone(void) const
     return new CObjReaderLineException(*this);
 }
 
+const CException *CObjReaderLineException::x_Clone(void) const
+{
+    return new CObjReaderLineException(*this);
+}
+
 void 
 CObjReaderLineException::Throw(void) const {
     // this triggers a deprecated-call warning, which should disappear
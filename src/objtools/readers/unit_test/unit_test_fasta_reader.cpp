@@ -48,10 +48,12 @@
 #include <corelib/rwstream.hpp>
 #include <corelib/stream_utils.hpp>
 #include <corelib/ncbimisc.hpp>
+#include <corelib/ncbifile.hpp>
 
 #include <objects/seqset/Seq_entry.hpp>
 
 #include <objtools/readers/fasta.hpp>
+#include <objtools/readers/fasta_parallel.hpp>
 #include <objtools/readers/fasta_exception.hpp>
 
 #include <serial/objistr.hpp>
@@ -1485,3 +1487,150 @@ BOOST_AUTO_TEST_CASE(TestModFilter)
         BOOST_CHECK_EQUAL( has_org, ! bUseFilter );
     }
 }
+
+
+namespace {
+    // Everything the reader produced, as text, to compare readers
+    string s_ReadAllAsText(CFastaReader* reader, ILineReader* line_reader,
+                           CParallelFastaReader* parallel_reader)
+    {
+        CNcbiOstrstream out;
+        CMessageListenerLenient listener;
+        for (;;) {
+            bool at_eof = reader ? reader->AtEOF() : parallel_reader->AtEOF();
+            if ( at_eof ) {
+                break;
+            }
+            try {
+                CRef<CSeq_entry> entry = reader
+                    ? reader->ReadOneSeq(&listener)
+                    : parallel_reader->ReadOneSeq(&listener);
+                out << MSerial_AsnText << *entry;
+            }
+            catch (CException& e) {
+                // The type shows whether the exception was sliced
+                out << "exception: " << typeid(e).name() << ' '
+                    << e.GetMsg() << endl;
+                if ( line_reader ) {
+                    // Skip to the next defline like the parallel reader
+                    while ( !line_reader->AtEOF()  &&
+                            line_reader->PeekChar() != '>' ) {
+                        ++*line_reader;
+                    }
+                }
+            }
+        }
+        for (size_t i = 0;  i < listener.Count();  ++i) {
+            const ILineError& err = listener.GetError(i);
+            out << err.Line() << ' ' << err.SeqId() << ' '
+                << err.ProblemStr() << ' ' << err.ErrorMessage() << endl;
+        }
+        return CNcbiOstrstreamToString(out);
+    }
+
+    // Many sequences with some that generate messages or exceptions, and
+    // deflines without IDs, which need generated IDs in the input order
+    string s_MakeParallelInput(void)
+    {
+        CNcbiOstrstream data;
+        for (int i = 0;  i < 300;  ++i) {
+            switch (i % 7) {
+            case 0:
+                data << ">blah" << i << " [topology=linear]\n";
+                break;
+            case 1:
+                data << ">\n";
+                break;
+            case 2:
+                data << ">lcl|dup" << (i % 5) << "\n";
+                break;
+            case 3:
+                data << "; comment\n>gi|" << (1000 + i) << "|gb|U"
+                     << (10000 + i) << ".1| something "
+                     << "ACGTACGTACGTACGTACGTACGTACGTACGTACGTACGT\n";
+                break;
+            default:
+                data << ">seq" << i << " title " << i << "\r\n";
+                break;
+            }
+            for (int j = 0;  j <= i % 11;  ++j) {
+                data << "ACGTNNNNACGTACGTACGTACGT"
+                     << string(size_t(j), 'A') << "\n";
+            }
+            if (i % 41 == 5) {
+                // Bad residues make the validating reader throw
+                data << "ACGT!!ACGT\n";
+            }
+            if (i % 13 == 0) {
+                data << "\n";
+            }
+        }
+        return CNcbiOstrstreamToString(data);
+    }
+
+    const CFastaReader::TFlags kParallelFlags[] = {
+        CFastaReader::fAssumeNuc,
+        CFastaReader::fAssumeNuc | CFastaReader::fUniqueIDs |
+        CFastaReader::fParseGaps | CFastaReader::fAddMods,
+        CFastaReader::fNoParseID | CFastaReader::fNoSplit,
+        CFastaReader::fAllSeqIds | CFastaReader::fRequireID,
+        CFastaReader::fAssumeNuc | CFastaReader::fValidate
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestParallelReader)
+{
+    const string input = s_MakeParallelInput();
+    for (size_t f = 0;  f < ArraySize(kParallelFlags);  ++f) {
+        CRef<ILineReader> line_reader(
+            new CMemoryLineReader(input.data(), input.size()));
+        CFastaReader reader(*line_reader, kParallelFlags[f]);
+        string expected = s_ReadAllAsText(&reader, line_reader, 0);
+
+        ITERATE_BOTH_BOOL_VALUES(bSmallChunks) {
+            CNcbiIstrstream in(input.data(), input.size());
+            CRef<CParallelFastaReader> parallel_reader(
+                new CParallelFastaReader(in, kParallelFlags[f], 3));
+            parallel_reader->SetChunkSize(bSmallChunks ? 100 : 2000);
+            BOOST_CHECK_EQUAL(s_ReadAllAsText(0, 0, parallel_reader),
+                              expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestParallelReaderFile)
+{
+    // The file is memory-mapped instead of being read as a stream
+    const string input = s_MakeParallelInput();
+    const string path = CFile::GetTmpName(CFile::eTmpFileCreate);
+    {{
+        CNcbiOfstream out(path.c_str(), IOS_BASE::binary);
+        out << input;
+        BOOST_REQUIRE(out);
+    }}
+    for (size_t f = 0;  f < ArraySize(kParallelFlags);  ++f) {
+        CRef<ILineReader> line_reader(
+            new CMemoryLineReader(input.data(), input.size()));
+        CFastaReader reader(*line_reader, kParallelFlags[f]);
+        string expected = s_ReadAllAsText(&reader, line_reader, 0);
+
+        ITERATE_BOTH_BOOL_VALUES(bSmallChunks) {
+            CRef<CParallelFastaReader> parallel_reader(
+                new CParallelFastaReader(path, kParallelFlags[f], 3));
+            parallel_reader->SetChunkSize(bSmallChunks ? 100 : 2000);
+            BOOST_CHECK_EQUAL(s_ReadAllAsText(0, 0, parallel_reader),
+                              expected);
+        }
+    }
+
+    // An empty file cannot be mapped, it is read as a stream
+    {{
+        CNcbiOfstream out(path.c_str(), IOS_BASE::binary | IOS_BASE::trunc);
+    }}
+    CParallelFastaReader empty_reader(path, CFastaReader::fAssumeNuc, 3);
+    BOOST_CHECK(empty_reader.AtEOF());
+
+    CFile(path).Remove();
+    BOOST_CHECK_THROW(CParallelFastaReader(path, CFastaReader::fAssumeNuc, 3),
+                      CFileException);
+}
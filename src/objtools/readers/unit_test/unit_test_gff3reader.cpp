@@ -37,7 +37,11 @@
 #include <corelib/ncbi_system.hpp>
 #include <corelib/ncbiapp.hpp>
 #include <corelib/ncbifile.hpp>
+#include <util/line_reader.hpp>
 
+#include <objects/seq/Seq_annot.hpp>
+#include <objects/seq/Annot_id.hpp>
+#include <objects/general/Object_id.hpp>
 #include <objtools/readers/gff3_reader.hpp>
 #include "error_logger.hpp"
 
@@ -325,3 +329,98 @@ BOOST_AUTO_TEST_CASE(RunTests)
         BOOST_CHECK_NO_THROW(sRunTest(sName, testInfo, args["keep-diffs"]));
     }
 }
+
+static string sAnnotsAsText(const CGff2Reader::TAnnotList& annots)
+{
+    CNcbiOstrstream ostr;
+    ITERATE (CGff2Reader::TAnnotList, it, annots) {
+        ostr << MSerial_AsnText << **it;
+    }
+    return CNcbiOstrstreamToString(ostr);
+}
+
+BOOST_AUTO_TEST_CASE(StreamingRegions)
+{
+    const string gene1 =
+        "ctg1\t.\tgene\t1000\t9000\t.\t+\t.\tID=gene1\n"
+        "ctg1\t.\tmRNA\t1050\t9000\t.\t+\t.\tID=mRNA1;Parent=gene1\n"
+        "ctg1\t.\texon\t1050\t1500\t.\t+\t.\tParent=mRNA1\n"
+        "ctg1\t.\texon\t3000\t9000\t.\t+\t.\tParent=mRNA1\n"
+        "ctg1\t.\tCDS\t1201\t1500\t.\t+\t0\tID=cds1;Parent=mRNA1\n"
+        "ctg1\t.\tCDS\t3000\t3902\t.\t+\t0\tID=cds1;Parent=mRNA1\n";
+    const string gene2 =
+        "ctg1\t.\tgene\t12000\t15000\t.\t-\t.\tID=gene2\n"
+        "ctg1\t.\tmRNA\t12000\t15000\t.\t-\t.\tID=mRNA2;Parent=gene2\n"
+        "ctg1\t.\tCDS\t12100\t14000\t.\t-\t0\tID=cds2;Parent=mRNA2\n";
+    const string gene3 =
+        "ctg2\t.\tgene\t100\t900\t.\t+\t.\tID=gene3\n"
+        "ctg2\t.\tmRNA\t100\t900\t.\t+\t.\tID=mRNA3;Parent=gene3\n";
+
+    // A single region is read the same way by both interfaces
+    {{
+        CNcbiIstrstream istr(gene1.data(), gene1.size());
+        CGff3Reader reader(0);
+        CGff2Reader::TAnnotList annots;
+        reader.ReadSeqAnnots(annots, istr);
+
+        CNcbiIstrstream istr2(gene1.data(), gene1.size());
+        CGff3Reader reader2(0);
+        CGff2Reader::TAnnotList streamed;
+        CRef<CSeq_annot> annot;
+        while ((annot = reader2.ReadSeqAnnot(istr2))) {
+            streamed.push_back(annot);
+        }
+        BOOST_REQUIRE_EQUAL(streamed.size(), 1u);
+        BOOST_CHECK_EQUAL(sAnnotsAsText(annots), sAnnotsAsText(streamed));
+    }}
+
+    // Regions are closed by "###" and by a change of seqid
+    const string input =
+        "##gff-version 3\n" + gene1 + "###\n" + gene2 + gene3;
+    CNcbiIstrstream istr(input.data(), input.size());
+    CStreamLineReader lr(istr);
+    CGff3Reader reader(0);
+    vector<size_t> sizes;
+    vector<string> ids;
+    CRef<CSeq_annot> annot;
+    while ((annot = reader.ReadSeqAnnot(lr))) {
+        sizes.push_back(annot->GetData().GetFtable().size());
+        ids.push_back(annot->GetId().front()->GetLocal().GetStr());
+    }
+    BOOST_REQUIRE_EQUAL(sizes.size(), 3u);
+    BOOST_CHECK_EQUAL(ids[0], "ctg1");
+    BOOST_CHECK_EQUAL(ids[1], "ctg1");
+    BOOST_CHECK_EQUAL(ids[2], "ctg2");
+    // gene, mRNA (exons merged) and CDS (pieces merged)
+    BOOST_CHECK_EQUAL(sizes[0], 3u);
+    BOOST_CHECK_EQUAL(sizes[1], 3u);
+    BOOST_CHECK_EQUAL(sizes[2], 2u);
+
+    // Reading from the stream gives the same regions: the first line of
+    // the next region is not lost between calls
+    CNcbiIstrstream istr2(input.data(), input.size());
+    CGff3Reader reader2(0);
+    vector<size_t> sizes2;
+    vector<string> ids2;
+    while ((annot = reader2.ReadSeqAnnot(istr2))) {
+        sizes2.push_back(annot->GetData().GetFtable().size());
+        ids2.push_back(annot->GetId().front()->GetLocal().GetStr());
+    }
+    BOOST_CHECK(sizes2 == sizes);
+    BOOST_CHECK(ids2 == ids);
+
+    // After ResetStream() nothing is left over from an abandoned stream
+    CGff3Reader reader3(0);
+    {{
+        CNcbiIstrstream istr3(input.data(), input.size());
+        BOOST_REQUIRE(reader3.ReadSeqAnnot(istr3));
+        reader3.ResetStream();
+    }}
+    CNcbiIstrstream istr4(gene3.data(), gene3.size());
+    vector<string> ids4;
+    while ((annot = reader3.ReadSeqAnnot(istr4))) {
+        ids4.push_back(annot->GetId().front()->GetLocal().GetStr());
+    }
+    BOOST_REQUIRE_EQUAL(ids4.size(), 1u);
+    BOOST_CHECK_EQUAL(ids4[0], "ctg2");
+}
@@ -322,3 +322,119 @@ BOOST_AUTO_TEST_CASE(RunTests)
         BOOST_CHECK_NO_THROW(sRunTest(sName, testInfo, args["keep-diffs"]));
     }
 }
+
+static string sReadAsText(
+    CVcfReader& reader,
+    const string& input)
+{
+    CNcbiIstrstream istr(input.data(), input.size());
+    CMessageListenerLenient messages;
+    CVcfReader::TAnnots annots;
+    reader.ReadSeqAnnots(annots, istr, &messages);
+
+    CNcbiOstrstream ostr;
+    ITERATE (CVcfReader::TAnnots, it, annots) {
+        ostr << MSerial_AsnText << **it;
+    }
+    for (size_t u = 0; u < messages.Count(); ++u) {
+        ostr << messages.GetError(u).Line() << ": "
+             << messages.GetError(u).Message() << "\n";
+    }
+    return CNcbiOstrstreamToString(ostr);
+}
+
+BOOST_AUTO_TEST_CASE(MultithreadedConversion)
+{
+    string input =
+        "##fileformat=VCFv4.1\n"
+        "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+        "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+        "##FORMAT=<ID=GQ,Number=1,Type=Integer,Description=\"Quality\">\n"
+        "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT"
+        "\tNA3\tNA1\tNA2\n";
+    const char* alts[] = { "G", "GT", "T,C", "", "A" };
+    for (int i = 0;  i < 3000;  ++i) {
+        int pos = 1000 + 7 * i;
+        input += "chr" + NStr::IntToString(1 + i / 1000) + "\t" +
+            NStr::IntToString(pos) + "\trs" + NStr::IntToString(i) +
+            "\tA\t" + alts[i % 5] + "\t" + (i % 3 ? "30" : ".") +
+            "\tPASS\tDP=" + NStr::IntToString(i % 50) +
+            "\tGT:GQ\t0|1:" + NStr::IntToString(i % 99) +
+            "\t1|1:12\t0/0:7\n";
+        if (i == 1500) {
+            // alternative equal to the reference: error message
+            input += "chr2\t5\t.\tC\tC\t.\tPASS\t.\n";
+        }
+        if (i == 2500) {
+            // reference to a database other than PubMed: warning message
+            input += "chr3\t5\t.\tC\tG\t.\tPASS\tPMID=XX:12\n";
+        }
+    }
+
+    CVcfReader sequential(0);
+    string expected = sReadAsText(sequential, input);
+
+    CVcfReader parallel(0);
+    parallel.SetThreadCount(3);
+    BOOST_CHECK(sReadAsText(parallel, input) == expected);
+
+    // Genotype columns are not converted on request
+    CVcfReader skipping(CVcfReader::fSkipGenotypeData);
+    skipping.SetThreadCount(2);
+    string skipped = sReadAsText(skipping, input);
+    BOOST_CHECK(skipped.find("genotype-data") == NPOS);
+    BOOST_CHECK(expected.find("genotype-data") != NPOS);
+}
+
+static string sReadResuming(
+    CVcfReader& reader,
+    const string& input)
+{
+    CNcbiIstrstream istr(input.data(), input.size());
+    CStreamLineReader lr(istr);
+    CNcbiOstrstream ostr;
+    for (;;) {
+        try {
+            CRef<CSeq_annot> annot = reader.ReadSeqAnnot(lr);
+            if (!annot) {
+                break;
+            }
+            ostr << MSerial_AsnText << *annot;
+        }
+        catch (CObjReaderLineException& e) {
+            ostr << "exception: " << e.Line() << ": " << e.Message() << "\n";
+        }
+    }
+    return CNcbiOstrstreamToString(ostr);
+}
+
+BOOST_AUTO_TEST_CASE(MultithreadedErrorInBatch)
+{
+    string input =
+        "##fileformat=VCFv4.1\n"
+        "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+    for (int i = 0;  i < 3000;  ++i) {
+        input += "chr1\t" + NStr::IntToString(1000 + 7 * i) +
+            "\trs" + NStr::IntToString(i) + "\tA\tG\t.\tPASS\t.\n";
+        if (i == 1400  ||  i == 2000) {
+            // without a listener the error is thrown, in the middle of
+            // a batch of the multithreaded reader
+            input += "chr2\t5\t.\tC\tC\t.\tPASS\t.\n";
+        }
+        if (i == 2500) {
+            // lines read ahead of an error are not lost
+            input += "##INFO=<ID=DP,Number=1,Type=Integer,"
+                "Description=\"Depth\">\n";
+        }
+    }
+
+    // Reading continues right after the line which threw
+    CVcfReader sequential(0);
+    string expected = sReadResuming(sequential, input);
+    BOOST_CHECK(expected.find("exception: 1404:") != NPOS);
+    BOOST_CHECK(expected.find("exception: 2005:") != NPOS);
+
+    CVcfReader parallel(0);
+    parallel.SetThreadCount(3);
+    BOOST_CHECK(sReadResuming(parallel, input) == expected);
+}
@@ -36,10 +36,12 @@
 #include <corelib/ncbithr.hpp>
 #include <corelib/ncbiutil.hpp>
 #include <corelib/ncbiexpt.hpp>
+#include <corelib/ncbi_system.hpp>
 #include <corelib/stream_utils.hpp>
 
 #include <util/static_map.hpp>
 #include <util/line_reader.hpp>
+#include <util/thread_pool.hpp>
 
 #include <serial/iterator.hpp>
 #include <serial/objistrasn.hpp>
@@ -89,9 +91,8 @@ class CVcfData
 {
 public:
     typedef map<string,vector<string> > INFOS;
-    typedef map<string, vector<string> > GTDATA;
 
-    CVcfData() { m_pdQual = 0; };
+    CVcfData() { m_pdQual = 0; m_pBatch = 0; };
     ~CVcfData() { delete m_pdQual; };
 
     string m_strLine;
@@ -104,8 +105,9 @@ public:
     string m_strFilter;
     INFOS m_Info;
     vector<string> m_FormatKeys;
-//    vector< vector<string> > m_GenotypeData;
-    GTDATA m_GenotypeData;
+    // Genotype columns point into m_strLine, they are split only when
+    // the genotype data is converted
+    vector<CTempString> m_GenotypeColumns;
     enum SetType_t {
         ST_ALL_SNV,
         ST_ALL_DEL,
@@ -113,6 +115,8 @@ public:
         ST_ALL_MNV,
         ST_MIXED
     } m_SetType;
+    // Batch converting the line in multithreaded mode
+    CVcfDataBatch* m_pBatch;
 };
 
 //  ----------------------------------------------------------------------------
@@ -166,10 +170,79 @@ ESpecNumber SpecNumber(
     }    
 };
 
+// Number of data lines converted by one task in multithreaded mode
+static const size_t kVcfBatchLines = 256;
+
+//  ============================================================================
+class CVcfDataBatch
+//  ============================================================================
+    : public CThreadPool_Task
+{
+public:
+    CVcfDataBatch(
+        CVcfReader& reader) :
+        m_Reader(reader),
+        m_Annot(new CSeq_annot),
+        m_LineNumber(0),
+        m_Done(0, 1)
+    {
+        m_Annot->SetData().SetFtable();
+    };
+
+    virtual EStatus Execute(void);
+
+    CVcfReader& m_Reader;
+    vector<string> m_Lines;
+    vector<unsigned int> m_LineNumbers;
+    // Converted lines and messages accumulated after each of them
+    vector<bool> m_IsData;
+    vector<size_t> m_MessageEnds;
+    CRef<CSeq_annot> m_Annot;
+    CMessageListenerLenient m_Messages;
+    // Number of the line being converted; messages are stamped with it
+    // instead of the line counter of the reading thread
+    unsigned int m_LineNumber;
+    // Conversion stops at the line which threw. A toolkit exception is
+    // kept as the predecessor of m_Error, which stores a clone of the
+    // exact type, so that it is rethrown without slicing
+    AutoPtr<CException> m_Error;
+    AutoPtr<string> m_StdError;
+    CSemaphore m_Done;
+};
+
+//  ----------------------------------------------------------------------------
+CThreadPool_Task::EStatus CVcfDataBatch::Execute(void)
+//  ----------------------------------------------------------------------------
+{
+    for (size_t u = 0; u < m_Lines.size(); ++u) {
+        m_LineNumber = m_LineNumbers[u];
+        try {
+            m_IsData.push_back(m_Reader.xProcessDataLine(
+                m_Lines[u], m_Annot, &m_Messages, this));
+        }
+        catch (CException& e) {
+            m_Error.reset(new CException(DIAG_COMPILE_INFO, &e,
+                                         CException::eUnknown, e.GetMsg()));
+        }
+        catch (exception& e) {
+            m_StdError.reset(new string(e.what()));
+        }
+        m_MessageEnds.push_back(m_Messages.Count());
+        if (m_Error.get()  ||  m_StdError.get()) {
+            break;
+        }
+    }
+    m_Done.Post();
+    return eCompleted;
+}
+
 //  ----------------------------------------------------------------------------
 CVcfReader::CVcfReader(
     int flags ):
-    CReaderBase(flags)
+    CReaderBase(flags),
+    m_ThreadCount(1),
+    m_LastLinePending(false),
+    m_uInputLineNumber(0)
 //  ----------------------------------------------------------------------------
 {
 }
@@ -179,6 +252,16 @@ CVcfReader::CVcfReader(
 CVcfReader::~CVcfReader()
 //  ----------------------------------------------------------------------------
 {
+    xCancelBatches();
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::SetThreadCount(
+    unsigned int threads)
+//  ----------------------------------------------------------------------------
+{
+    m_ThreadCount = threads ? threads : GetCpuCount();
 }
 
 //  ----------------------------------------------------------------------------                
@@ -189,7 +272,7 @@ CVcfReader::ReadSeqAnnot(
 //  ----------------------------------------------------------------------------                
 {
     xProgressInit(lr);
-    if (lr.AtEOF()) {
+    if (lr.AtEOF()  &&  m_PendingLines.empty()) {
         return CRef<CSeq_annot>();
     }
     CRef< CSeq_annot > annot( new CSeq_annot );
@@ -203,8 +286,11 @@ CVcfReader::ReadSeqAnnot(
 
     string line;
     unsigned int dataCount = 0;
+    // drop batches left over by an exception
+    xCancelBatches();
     while (xGetLine(lr, line)) {
         if (IsCanceled()) {
+            xCancelBatches();
             AutoPtr<CObjReaderLineException> pErr(
                 CObjReaderLineException::Create(
                 eDiag_Info,
@@ -219,6 +305,17 @@ CVcfReader::ReadSeqAnnot(
             xUngetLine(lr);
             break;
         }
+        if (m_ThreadCount > 1  &&  xQueueDataLine(line, annot, pEC)) {
+            ++dataCount;
+            continue;
+        }
+        // other lines may change the state used by data lines; the line
+        // is read again if a data line before it throws
+        if (m_CurrentBatch  ||  !m_Batches.empty()) {
+            xUngetLine(lr);
+            xFlushBatches(annot, pEC);
+            continue;
+        }
         if (xParseBrowserLine(line, annot, pEC)) {
             continue;
         }
@@ -244,11 +341,248 @@ CVcfReader::ReadSeqAnnot(
             ILineError::eProblem_GeneralParsingError) );
         ProcessWarning(*pErr, pEC);
     }
+    xFlushBatches(annot, pEC);
     xAssignTrackData(annot);
     xAssignVcfMeta(annot);
     return annot;
 }
 
+//  ----------------------------------------------------------------------------
+bool
+CVcfReader::xQueueDataLine(
+    const string& line,
+    CRef<CSeq_annot> pAnnot,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    if (NStr::StartsWith(line, "#")  ||  NStr::StartsWith(line, "browser")  ||
+            xIsTrackLine(line)) {
+        return false;
+    }
+    if (!m_CurrentBatch) {
+        m_CurrentBatch.Reset(new CVcfDataBatch(*this));
+    }
+    m_CurrentBatch->m_Lines.push_back(line);
+    m_CurrentBatch->m_LineNumbers.push_back(m_uLineNumber);
+    if (m_CurrentBatch->m_Lines.size() < kVcfBatchLines) {
+        return true;
+    }
+
+    // keep memory bounded: only a few batches may wait for merging
+    while (m_Batches.size() > 2 * m_ThreadCount) {
+        xMergeBatch(pAnnot, pEC);
+    }
+    if (!m_ThreadPool.get()) {
+        m_ThreadPool.reset(
+            new CThreadPool(kMax_UInt, m_ThreadCount, m_ThreadCount));
+    }
+    m_ThreadPool->AddTask(m_CurrentBatch);
+    m_Batches.push_back(m_CurrentBatch);
+    m_CurrentBatch.Reset();
+    return true;
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::xMergeBatch(
+    CRef<CSeq_annot> pAnnot,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    CRef<CVcfDataBatch> pBatch = m_Batches.front();
+    m_Batches.pop_front();
+    pBatch->m_Done.Wait();
+
+    // replay messages in the input order, with their own line numbers
+    unsigned int lineNumber = m_uLineNumber;
+    size_t message = 0;
+    size_t u = 0;
+    try {
+        for ( ; u < pBatch->m_MessageEnds.size(); ++u) {
+            for ( ; message < pBatch->m_MessageEnds[u]; ++message) {
+                AutoPtr<ILineError> pClone(
+                    pBatch->m_Messages.GetError(message).Clone());
+                CObjReaderLineException* pErr =
+                    dynamic_cast<CObjReaderLineException*>(pClone.get());
+                if (!pErr) {
+                    continue;
+                }
+                m_uLineNumber = pErr->Line();
+                if (pErr->Severity() <= eDiag_Warning) {
+                    ProcessWarning(*pErr, pEC);
+                }
+                else {
+                    ProcessError(*pErr, pEC);
+                }
+            }
+            if (u < pBatch->m_IsData.size()  &&  !pBatch->m_IsData[u]) {
+                m_uLineNumber = pBatch->m_LineNumbers[u];
+                AutoPtr<CObjReaderLineException> pErr(
+                    CObjReaderLineException::Create(
+                    eDiag_Warning,
+                    0,
+                    "CVcfReader::ReadSeqAnnot: Unrecognized line or record type.",
+                    ILineError::eProblem_GeneralParsingError) );
+                ProcessWarning(*pErr, pEC);
+            }
+        }
+    }
+    catch (...) {
+        // the sequential reader would stop right after this line
+        m_uLineNumber = lineNumber;
+        xKeepUnmergedLines(*pBatch, u + 1);
+        throw;
+    }
+    m_uLineNumber = lineNumber;
+
+    CSeq_annot::TData::TFtable& ftable = pAnnot->SetData().SetFtable();
+    ftable.splice(ftable.end(), pBatch->m_Annot->SetData().SetFtable());
+
+    if (pBatch->m_Error.get()  ||  pBatch->m_StdError.get()) {
+        // conversion stopped at the last line with messages
+        xKeepUnmergedLines(*pBatch, pBatch->m_MessageEnds.size());
+    }
+    if (pBatch->m_Error.get()) {
+        pBatch->m_Error->GetPredecessor()->Throw();
+    }
+    if (pBatch->m_StdError.get()) {
+        throw runtime_error(*pBatch->m_StdError);
+    }
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::xKeepUnmergedLines(
+    CVcfDataBatch& batch,
+    size_t first)
+//  ----------------------------------------------------------------------------
+{
+    // lines of the batch after the failed one, then those of the batches
+    // still waiting to be merged, then the lines which were already pending
+    if (m_PendingLines.empty()  &&  !m_LastLinePending) {
+        m_uInputLineNumber = m_uLineNumber;
+    }
+    deque<TPendingLine> lines;
+    for (size_t u = first; u < batch.m_Lines.size(); ++u) {
+        lines.push_back(
+            TPendingLine(batch.m_Lines[u], batch.m_LineNumbers[u]));
+    }
+    if (m_CurrentBatch) {
+        m_Batches.push_back(m_CurrentBatch);
+        m_CurrentBatch.Reset();
+    }
+    while (!m_Batches.empty()) {
+        CVcfDataBatch& pending = *m_Batches.front();
+        pending.m_Done.Wait();
+        for (size_t u = 0; u < pending.m_Lines.size(); ++u) {
+            lines.push_back(
+                TPendingLine(pending.m_Lines[u], pending.m_LineNumbers[u]));
+        }
+        m_Batches.pop_front();
+    }
+    m_PendingLines.insert(
+        m_PendingLines.begin(), lines.begin(), lines.end());
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::xFlushBatches(
+    CRef<CSeq_annot> pAnnot,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    if (m_CurrentBatch) {
+        // the last lines are converted right here
+        m_CurrentBatch->Execute();
+        m_Batches.push_back(m_CurrentBatch);
+        m_CurrentBatch.Reset();
+    }
+    while (!m_Batches.empty()) {
+        xMergeBatch(pAnnot, pEC);
+    }
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::xCancelBatches()
+//  ----------------------------------------------------------------------------
+{
+    m_CurrentBatch.Reset();
+    while (!m_Batches.empty()) {
+        m_Batches.front()->m_Done.Wait();
+        m_Batches.pop_front();
+    }
+}
+
+//  ----------------------------------------------------------------------------
+bool
+CVcfReader::xGetLine(
+    ILineReader& lr,
+    string& line)
+//  ----------------------------------------------------------------------------
+{
+    if (!m_PendingLines.empty()) {
+        m_LastPendingLine = m_PendingLines.front();
+        m_PendingLines.pop_front();
+        m_LastLinePending = true;
+        line = m_LastPendingLine.first;
+        m_uLineNumber = m_LastPendingLine.second;
+        return true;
+    }
+    if (m_LastLinePending) {
+        m_LastLinePending = false;
+        m_uLineNumber = m_uInputLineNumber;
+    }
+    return CReaderBase::xGetLine(lr, line);
+}
+
+//  ----------------------------------------------------------------------------
+bool
+CVcfReader::xUngetLine(
+    ILineReader& lr)
+//  ----------------------------------------------------------------------------
+{
+    if (m_LastLinePending) {
+        m_PendingLines.push_front(m_LastPendingLine);
+        return true;
+    }
+    return CReaderBase::xUngetLine(lr);
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::xProcessDataError(
+    CObjReaderLineException& err,
+    const CVcfData& data,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    // a batch may be converted by a pool thread, which must not touch the
+    // line counter; its messages are reported when the batch is merged
+    if (!data.m_pBatch) {
+        ProcessError(err, pEC);
+        return;
+    }
+    err.SetLineNumber(data.m_pBatch->m_LineNumber);
+    data.m_pBatch->m_Messages.PutError(err);
+}
+
+//  ----------------------------------------------------------------------------
+void
+CVcfReader::xProcessDataWarning(
+    CObjReaderLineException& err,
+    const CVcfData& data,
+    ILineErrorListener* pEC)
+//  ----------------------------------------------------------------------------
+{
+    if (!data.m_pBatch) {
+        ProcessWarning(err, pEC);
+        return;
+    }
+    err.SetLineNumber(data.m_pBatch->m_LineNumber);
+    data.m_pBatch->m_Messages.PutError(err);
+}
+
 //  ----------------------------------------------------------------------------                
 CRef< CSerialObject >
 CVcfReader::ReadObject(
@@ -506,6 +840,18 @@ CVcfReader::xProcessHeaderLine(
         m_GenotypeHeaders.erase( m_GenotypeHeaders.begin(), pos_format+1 );
         m_Meta->SetUser().AddField("genotype-headers", m_GenotypeHeaders);
     }
+
+    //  Genotype data are reported ordered by sample name (a repeated name
+    //  refers to its last column), so work out that order only once:
+    m_GenotypeOrder.clear();
+    map<string, size_t> sampleColumns;
+    for (size_t u = 0; u < m_GenotypeHeaders.size(); ++u) {
+        sampleColumns[m_GenotypeHeaders[u]] = u;
+    }
+    for (map<string, size_t>::const_iterator cit = sampleColumns.begin();
+            cit != sampleColumns.end(); ++cit) {
+        m_GenotypeOrder.push_back(cit->second);
+    }
     
     //
     //  The header line signals the end of meta information, so migrate the
@@ -531,13 +877,15 @@ bool
 CVcfReader::xProcessDataLine(
     const string& line,
     CRef<CSeq_annot> pAnnot,
-    ILineErrorListener* pEC)
+    ILineErrorListener* pEC,
+    CVcfDataBatch* pBatch)
 //  ----------------------------------------------------------------------------
 {
     if ( NStr::StartsWith( line, "#" ) ) {
         return false;
     }
     CVcfData data;
+    data.m_pBatch = pBatch;
     if (!xParseData(line, data, pEC)) {
         return false;
     }
@@ -817,14 +1165,13 @@ CVcfReader::xParseData(
     ILineErrorListener* pEC)
 //  ----------------------------------------------------------------------------
 {
-    vector<string> columns;
-    NStr::Split( line, "\t", columns, NStr::eMergeDelims );
+    data.m_strLine = line;
+    vector<CTempString> columns;
+    NStr::Split( data.m_strLine, "\t", columns, NStr::fSplit_MergeDelimiters );
     if ( columns.size() < 8 ) {
         return false;
     }
     try {
-        data.m_strLine = line;
-
         data.m_strChrom = columns[0];
         data.m_iPos = NStr::StringToInt( columns[1] );
         NStr::Split( columns[2], ";", data.m_Ids, NStr::eNoMergeDelims );
@@ -852,12 +1199,7 @@ CVcfReader::xParseData(
         }
         if ( columns.size() > 8 ) {
             NStr::Split( columns[8], ":", data.m_FormatKeys, NStr::eMergeDelims );
-
-            for ( size_t u=9; u < columns.size(); ++u ) {
-                vector<string> values;
-                NStr::Split( columns[u], ":", values, NStr::eMergeDelims );
-                data.m_GenotypeData[ m_GenotypeHeaders[u-9] ] = values;
-            }
+            data.m_GenotypeColumns.assign( columns.begin() + 9, columns.end() );
         }
     }
     catch ( ... ) {
@@ -867,7 +1209,7 @@ CVcfReader::xParseData(
             0,
             "Unable to parse given VCF data (syntax error).",
             ILineError::eProblem_GeneralParsingError));
-        ProcessError(*pErr, pEC);
+        xProcessDataError(*pErr, data, pEC);
         return false;
     }
 
@@ -956,7 +1298,7 @@ CVcfReader::xNormalizeData(
                 0,
                 "CVcfReader::xNormalizeData: Invalid alternative.",
                 ILineError::eProblem_GeneralParsingError));
-            ProcessError(*pErr, pEC);
+            xProcessDataError(*pErr, data, pEC);
             return false;
         }
     }
@@ -1201,13 +1543,23 @@ CVcfReader::xProcessFormat(
 
     CSeq_feat::TExt& ext = pFeature->SetExt();
     ext.AddField("format", data.m_FormatKeys);
+    if (m_iFlags & fSkipGenotypeData) {
+        return true;
+    }
 
     CRef<CUser_field> pGenotypeData( new CUser_field );
     pGenotypeData->SetLabel().SetStr("genotype-data");
 
-    for ( CVcfData::GTDATA::const_iterator cit = data.m_GenotypeData.begin();
-            cit != data.m_GenotypeData.end(); ++cit) {
-        pGenotypeData->AddField(cit->first,cit->second);
+    vector<string> values;
+    for (size_t u = 0; u < m_GenotypeOrder.size(); ++u) {
+        size_t column = m_GenotypeOrder[u];
+        if (column >= data.m_GenotypeColumns.size()) {
+            continue;
+        }
+        values.clear();
+        NStr::Split(data.m_GenotypeColumns[column], ":", values,
+            NStr::eMergeDelims);
+        pGenotypeData->AddField(m_GenotypeHeaders[column], values);
     }
     ext.SetData().push_back(pGenotypeData);
     return true;
@@ -1330,7 +1682,7 @@ CVcfReader::xAssignVariantProps(
                         0,
                         "CVcfReader::xAssignVariantProps: Invalid PMID database ID.",
                         ILineError::eProblem_GeneralParsingError) );
-                    ProcessWarning(*pErr, pEC);
+                    xProcessDataWarning(*pErr, data, pEC);
                     continue;
                 }
                 CRef<CDbtag> pDbtag(new CDbtag);
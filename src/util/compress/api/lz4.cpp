@@ -0,0 +1,939 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  LZ4 Compression API
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbi_limits.h>
+#include <util/compress/lz4.hpp>
+#include <util/error_codes.hpp>
+
+#define NCBI_USE_ERRCODE_X   Util_Compress
+
+#if defined(HAVE_LIBLZ4)
+
+#include <lz4.h>
+#include <lz4frame.h>
+
+BEGIN_NCBI_SCOPE
+
+
+// Macro to check flags
+#define F_ISSET(mask) ((GetFlags() & (mask)) == (mask))
+
+// Get compression/decompression context pointers
+#define CCTX ((LZ4F_cctx*)m_CCtx)
+#define DCTX ((LZ4F_dctx*)m_DCtx)
+
+// Convert 'size_t' to 'long' which used in CCompressionFile API
+#define LIMIT_SIZE_PARAM(value) if (value > (size_t)kMax_Int) value = kMax_Int
+
+
+/// Size of magic signature.
+const size_t kMagicSize = 4;
+
+/// Size of data compressed by CLZ4Compressor at once.
+/// The internal output buffer is allocated for the worst case of it.
+const size_t kChunkSize = 64 * 1024;
+
+
+/// Check that the data starts with LZ4 frame or skippable frame.
+static bool s_IsLZ4Frame(const void* buf, size_t len)
+{
+    if (len < kMagicSize) {
+        return false;
+    }
+    unsigned long magic = CCompressionUtil::GetUI4(buf);
+    return magic == 0x184D2204  ||
+           (magic & 0xFFFFFFF0) == 0x184D2A50 /* skippable frame */;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CLZ4Compression
+//
+
+
+CLZ4Compression::CLZ4Compression(ELevel level)
+    : CCompression(level), m_DCtx(0)
+{
+    return;
+}
+
+
+CLZ4Compression::~CLZ4Compression(void)
+{
+    if ( m_DCtx ) {
+        LZ4F_freeDecompressionContext(DCTX);
+    }
+    return;
+}
+
+
+CVersionInfo CLZ4Compression::GetVersion(void) const
+{
+    return CVersionInfo(LZ4_versionString(), "lz4");
+}
+
+
+CCompression::ELevel CLZ4Compression::GetLevel(void) const
+{
+    CCompression::ELevel level = CCompression::GetLevel();
+    // LZ4 do not support a zero compression level -- make conversion
+    if ( level == eLevel_NoCompression) {
+        return eLevel_Lowest;
+    }
+    return level;
+}
+
+
+void CLZ4Compression::GetPreferences(void* prefs) const
+{
+    // LZ4 levels below 3 use the fast compressor, levels 3..12 use
+    // the high compression (HC) one. Map our levels on them.
+    static const int kLevels[] = {
+        0,  // eLevel_NoCompression (never used)
+        0,  // eLevel_Lowest
+        0,  // eLevel_VeryLow
+        0,  // eLevel_Low
+        3,  // eLevel_MediumLow
+        4,  // eLevel_Medium
+        6,  // eLevel_MediumHigh
+        8,  // eLevel_High
+        10, // eLevel_VeryHigh
+        12  // eLevel_Best
+    };
+    LZ4F_preferences_t* p = (LZ4F_preferences_t*)prefs;
+    memset(p, 0, sizeof(*p));
+
+    int level = GetLevel();
+    if (level >= 0  &&  level < (int)(sizeof(kLevels)/sizeof(kLevels[0]))) {
+        p->compressionLevel = kLevels[level];
+    }
+    p->frameInfo.blockMode = F_ISSET(fIndependentBlocks) ?
+        LZ4F_blockIndependent : LZ4F_blockLinked;
+    p->frameInfo.contentChecksumFlag = F_ISSET(fChecksum) ?
+        LZ4F_contentChecksumEnabled : LZ4F_noContentChecksum;
+}
+
+
+void CLZ4Compression::SetLZ4Error(size_t errcode)
+{
+    if ( LZ4F_isError(errcode) ) {
+        // LZ4 error codes are negative numbers converted to size_t
+        SetError((int)errcode, LZ4F_getErrorName(errcode));
+    } else {
+        SetError(0);
+    }
+}
+
+
+size_t CLZ4Compression::EstimateCompressionBufferSize(size_t src_len)
+{
+    LZ4F_preferences_t prefs;
+    GetPreferences(&prefs);
+    return LZ4F_compressFrameBound(src_len, &prefs);
+}
+
+
+bool CLZ4Compression::CompressBuffer(
+                      const void* src_buf, size_t  src_len,
+                      void*       dst_buf, size_t  dst_size,
+                      /* out */            size_t* dst_len)
+{
+    *dst_len = 0;
+
+    // Check parameters
+    if ( !src_len ) {
+        if ( !F_ISSET(fAllowEmptyData) ) {
+            src_buf = NULL;
+        }
+    }
+    if ( !src_buf  ||  !dst_buf  ||  !dst_len ) {
+        SetError(-1, "bad argument");
+        ERR_COMPRESS(107, FormatErrorMessage("CLZ4Compression::CompressBuffer"));
+        return false;
+    }
+    LZ4F_preferences_t prefs;
+    GetPreferences(&prefs);
+    prefs.frameInfo.contentSize = src_len;
+
+    // LZ4 needs the destination buffer for the worst case,
+    // use temporary one if the passed buffer is smaller.
+    size_t bound = LZ4F_compressFrameBound(src_len, &prefs);
+    AutoArray<char> tmp;
+    void* buf = dst_buf;
+    if (dst_size < bound) {
+        tmp.reset(new char[bound]);
+        buf = tmp.get();
+    }
+    size_t n = LZ4F_compressFrame(buf, bound, src_buf, src_len, &prefs);
+    SetLZ4Error(n);
+    if ( LZ4F_isError(n) ) {
+        ERR_COMPRESS(108, FormatErrorMessage("CLZ4Compression::CompressBuffer"));
+        return false;
+    }
+    if ( buf != dst_buf ) {
+        if (n > dst_size) {
+            SetError(-1, "Destination buffer is too small");
+            ERR_COMPRESS(108, FormatErrorMessage("CLZ4Compression::CompressBuffer"));
+            return false;
+        }
+        memcpy(dst_buf, buf, n);
+    }
+    *dst_len = n;
+    return true;
+}
+
+
+bool CLZ4Compression::DecompressBuffer(
+                      const void* src_buf, size_t  src_len,
+                      void*       dst_buf, size_t  dst_size,
+                      /* out */            size_t* dst_len)
+{
+    *dst_len = 0;
+
+    // Check parameters
+    if ( !src_len ) {
+        if ( F_ISSET(fAllowEmptyData) ) {
+            SetError(0);
+            return true;
+        }
+        src_buf = NULL;
+    }
+    if ( !src_buf  ||  !dst_buf  ||  !dst_len ) {
+        SetError(-1, "bad argument");
+        ERR_COMPRESS(109, FormatErrorMessage("CLZ4Compression::DecompressBuffer"));
+        return false;
+    }
+    // Data is not compressed, but transparent read is allowed
+    if ( !s_IsLZ4Frame(src_buf, src_len)  &&  F_ISSET(fAllowTransparentRead) ) {
+        *dst_len = (dst_size < src_len) ? dst_size : src_len;
+        memcpy(dst_buf, src_buf, *dst_len);
+        return (dst_size >= src_len);
+    }
+    if ( !m_DCtx ) {
+        size_t errcode =
+            LZ4F_createDecompressionContext((LZ4F_dctx**)&m_DCtx, LZ4F_VERSION);
+        if ( LZ4F_isError(errcode) ) {
+            m_DCtx = 0;
+            SetLZ4Error(errcode);
+            ERR_COMPRESS(110, FormatErrorMessage("CLZ4Compression::DecompressBuffer"));
+            return false;
+        }
+    } else {
+        LZ4F_resetDecompressionContext(DCTX);
+    }
+
+    // Decompress all frames
+    const char* in  = (const char*)src_buf;
+    char*       out = (char*)dst_buf;
+    size_t      ret = 0;
+
+    while (src_len) {
+        size_t in_size  = src_len;
+        size_t out_size = dst_size - *dst_len;
+        ret = LZ4F_decompress(DCTX, out, &out_size, in, &in_size, NULL);
+        SetLZ4Error(ret);
+        if ( LZ4F_isError(ret) ) {
+            ERR_COMPRESS(110, FormatErrorMessage("CLZ4Compression::DecompressBuffer"));
+            return false;
+        }
+        in       += in_size;
+        src_len  -= in_size;
+        out      += out_size;
+        *dst_len += out_size;
+        if (!in_size  &&  !out_size) {
+            // No progress -- the destination buffer is full
+            break;
+        }
+    }
+    if ( src_len  ||  ret ) {
+        SetError(-1, src_len ? "Destination buffer is too small"
+                             : "Unexpected end of compressed data");
+        ERR_COMPRESS(110, FormatErrorMessage("CLZ4Compression::DecompressBuffer"));
+        return false;
+    }
+    return true;
+}
+
+
+bool CLZ4Compression::CompressFile(const string& src_file,
+                                    const string& dst_file,
+                                    size_t        buf_size)
+{
+    CLZ4CompressionFile cf(GetLevel());
+    cf.SetFlags(cf.GetFlags() | GetFlags());
+
+    // Open output file
+    if ( !cf.Open(dst_file, CCompressionFile::eMode_Write) ) {
+        SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        return false;
+    }
+    // Make compression
+    if ( !CCompression::x_CompressFile(src_file, cf, buf_size) ) {
+        if ( cf.GetErrorCode() ) {
+            SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        }
+        cf.Close();
+        return false;
+    }
+    // Close output file and return result
+    bool status = cf.Close();
+    SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+    return status;
+}
+
+
+bool CLZ4Compression::DecompressFile(const string& src_file,
+                                      const string& dst_file,
+                                      size_t        buf_size)
+{
+    CLZ4CompressionFile cf(GetLevel());
+    cf.SetFlags(cf.GetFlags() | GetFlags());
+
+    // Open output file
+    if ( !cf.Open(src_file, CCompressionFile::eMode_Read) ) {
+        SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        return false;
+    }
+    // Make decompression
+    if ( !CCompression::x_DecompressFile(cf, dst_file, buf_size) ) {
+        if ( cf.GetErrorCode() ) {
+            SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        }
+        cf.Close();
+        return false;
+    }
+    // Close output file and return result
+    bool status = cf.Close();
+    SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+    return status;
+}
+
+
+string CLZ4Compression::FormatErrorMessage(string where) const
+{
+    string str = "[" + where + "]  " + GetErrorDescription();
+    return str + ".";
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CLZ4CompressionFile
+//
+
+
+CLZ4CompressionFile::CLZ4CompressionFile(
+    const string& file_name, EMode mode, ELevel level)
+    : CLZ4Compression(level),
+      m_Mode(eMode_Read), m_File(0), m_Stream(0)
+{
+    if ( !Open(file_name, mode) ) {
+        const string smode = (mode == eMode_Read) ? "reading" : "writing";
+        NCBI_THROW(CCompressionException, eCompressionFile,
+                   "[CLZ4CompressionFile]  Cannot open file '" + file_name +
+                   "' for " + smode + ".");
+    }
+    return;
+}
+
+
+CLZ4CompressionFile::CLZ4CompressionFile(ELevel level)
+    : CLZ4Compression(level),
+      m_Mode(eMode_Read), m_File(0), m_Stream(0)
+{
+    return;
+}
+
+
+CLZ4CompressionFile::~CLZ4CompressionFile(void)
+{
+    try {
+        Close();
+    }
+    COMPRESS_HANDLE_EXCEPTIONS(111, "CLZ4CompressionFile::~CLZ4CompressionFile");
+    return;
+}
+
+
+void CLZ4CompressionFile::GetStreamError(void)
+{
+    int     errcode;
+    string  errdesc;
+    m_Stream->GetError(CCompressionStream::eRead, errcode, errdesc);
+    SetError(errcode, errdesc);
+}
+
+
+bool CLZ4CompressionFile::Open(const string& file_name, EMode mode)
+{
+    m_Mode = mode;
+
+    // Open a file
+    if ( mode == eMode_Read ) {
+        m_File = new CNcbiFstream(file_name.c_str(),
+                                  IOS_BASE::in | IOS_BASE::binary);
+    } else {
+        m_File = new CNcbiFstream(file_name.c_str(),
+                                  IOS_BASE::out | IOS_BASE::binary |
+                                  IOS_BASE::trunc);
+    }
+    if ( !m_File->good() ) {
+        Close();
+        string description = string("Cannot open file '") + file_name + "'";
+        SetError(-1, description.c_str());
+        return false;
+    }
+
+    // Create compression stream for I/O
+    if ( mode == eMode_Read ) {
+        CCompressionStreamProcessor* processor =
+            new CCompressionStreamProcessor(
+                new CLZ4Decompressor(GetFlags()),
+                CCompressionStreamProcessor::eDelete,
+                kCompressionDefaultBufSize, kCompressionDefaultBufSize);
+        m_Stream =
+            new CCompressionIOStream(
+                *m_File, processor, 0, CCompressionStream::fOwnReader);
+    } else {
+        CCompressionStreamProcessor* processor =
+            new CCompressionStreamProcessor(
+                new CLZ4Compressor(GetLevel(), GetFlags()),
+                CCompressionStreamProcessor::eDelete,
+                kCompressionDefaultBufSize, kCompressionDefaultBufSize);
+        m_Stream =
+            new CCompressionIOStream(
+                *m_File, 0, processor, CCompressionStream::fOwnWriter);
+    }
+    if ( !m_Stream->good() ) {
+        Close();
+        SetError(-1, "Cannot create compression stream");
+        return false;
+    }
+    return true;
+}
+
+
+long CLZ4CompressionFile::Read(void* buf, size_t len)
+{
+    LIMIT_SIZE_PARAM(len);
+
+    if ( !m_Stream  ||  m_Mode != eMode_Read ) {
+        NCBI_THROW(CCompressionException, eCompressionFile,
+            "[CLZ4CompressionFile::Read]  File must be opened for reading");
+    }
+    if ( !m_Stream->good() ) {
+        return 0;
+    }
+    m_Stream->read((char*)buf, len);
+    // Check decompression processor status
+    if ( m_Stream->GetStatus(CCompressionStream::eRead)
+         == CCompressionProcessor::eStatus_Error ) {
+        GetStreamError();
+        return -1;
+    }
+    long nread = (long)m_Stream->gcount();
+    if ( nread ) {
+        return nread;
+    }
+    if ( m_Stream->eof() ) {
+        return 0;
+    }
+    GetStreamError();
+    return -1;
+}
+
+
+long CLZ4CompressionFile::Write(const void* buf, size_t len)
+{
+    if ( !m_Stream  ||  m_Mode != eMode_Write ) {
+        NCBI_THROW(CCompressionException, eCompressionFile,
+            "[CLZ4CompressionFile::Write]  File must be opened for writing");
+    }
+    // Redefine standard behaviour for case of writing zero bytes
+    if (len == 0) {
+        return 0;
+    }
+    LIMIT_SIZE_PARAM(len);
+
+    m_Stream->write((char*)buf, len);
+    if ( m_Stream->good() ) {
+        return (long)len;
+    }
+    GetStreamError();
+    return -1;
+}
+
+
+bool CLZ4CompressionFile::Close(void)
+{
+    // Close compression/decompression stream
+    if ( m_Stream ) {
+        m_Stream->Finalize();
+        GetStreamError();
+        delete m_Stream;
+        m_Stream = 0;
+    }
+    // Close file stream
+    if ( m_File ) {
+        m_File->close();
+        delete m_File;
+        m_File = 0;
+    }
+    return true;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CLZ4Compressor
+//
+
+
+CLZ4Compressor::CLZ4Compressor(ELevel level, TLZ4Flags flags)
+    : CLZ4Compression(level), m_CCtx(0), m_BufSize(0), m_BufPos(0),
+      m_BufLen(0), m_Started(false), m_Finished(false)
+{
+    SetFlags(flags);
+}
+
+
+CLZ4Compressor::~CLZ4Compressor()
+{
+    if ( IsBusy() ) {
+        // Abnormal session termination
+        End();
+    }
+    if ( m_CCtx ) {
+        LZ4F_freeCompressionContext(CCTX);
+    }
+}
+
+
+CCompressionProcessor::EStatus CLZ4Compressor::Init(void)
+{
+    if ( IsBusy() ) {
+        // Abnormal previous session termination
+        End();
+    }
+    // Initialize members
+    Reset();
+    SetBusy();
+    m_BufPos   = 0;
+    m_BufLen   = 0;
+    m_Started  = false;
+    m_Finished = false;
+
+    if ( !m_CCtx ) {
+        size_t errcode =
+            LZ4F_createCompressionContext((LZ4F_cctx**)&m_CCtx, LZ4F_VERSION);
+        if ( LZ4F_isError(errcode) ) {
+            m_CCtx = 0;
+            SetLZ4Error(errcode);
+            ERR_COMPRESS(112, FormatErrorMessage("CLZ4Compressor::Init"));
+            return eStatus_Error;
+        }
+    }
+    // Buffer should fit frame header and the worst case of compressed
+    // chunk, including data buffered inside LZ4 and the frame footer.
+    LZ4F_preferences_t prefs;
+    GetPreferences(&prefs);
+    size_t size = LZ4F_compressBound(kChunkSize, &prefs) + LZ4F_HEADER_SIZE_MAX;
+    if (size > m_BufSize) {
+        m_Buf.reset(new char[size]);
+        m_BufSize = size;
+    }
+    return eStatus_Success;
+}
+
+
+bool CLZ4Compressor::FlushBuffer(char* out_buf, size_t out_size,
+                                 size_t* out_avail)
+{
+    size_t n = min(m_BufLen - m_BufPos, out_size - *out_avail);
+    memcpy(out_buf + *out_avail, m_Buf.get() + m_BufPos, n);
+    m_BufPos   += n;
+    *out_avail += n;
+    IncreaseOutputSize((unsigned long)n);
+    if (m_BufPos < m_BufLen) {
+        return false;
+    }
+    m_BufPos = m_BufLen = 0;
+    return true;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Compressor::Process(
+                      const char* in_buf,  size_t  in_len,
+                      char*       out_buf, size_t  out_size,
+                      /* out */            size_t* in_avail,
+                      /* out */            size_t* out_avail)
+{
+    *out_avail = 0;
+    *in_avail  = in_len;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    // Write out previously compressed data first
+    if ( !FlushBuffer(out_buf, out_size, out_avail)  ||  !in_len ) {
+        return eStatus_Success;
+    }
+    if ( !m_Started ) {
+        LZ4F_preferences_t prefs;
+        GetPreferences(&prefs);
+        size_t n = LZ4F_compressBegin(CCTX, m_Buf.get(), m_BufSize, &prefs);
+        SetLZ4Error(n);
+        if ( LZ4F_isError(n) ) {
+            ERR_COMPRESS(113, FormatErrorMessage("CLZ4Compressor::Process"));
+            return eStatus_Error;
+        }
+        m_BufLen  = n;
+        m_Started = true;
+    }
+    size_t chunk = min(in_len, kChunkSize);
+    size_t n = LZ4F_compressUpdate(CCTX, m_Buf.get() + m_BufLen,
+                                   m_BufSize - m_BufLen, in_buf, chunk, NULL);
+    SetLZ4Error(n);
+    if ( LZ4F_isError(n) ) {
+        ERR_COMPRESS(113, FormatErrorMessage("CLZ4Compressor::Process"));
+        return eStatus_Error;
+    }
+    m_BufLen += n;
+    *in_avail = in_len - chunk;
+    IncreaseProcessedSize((unsigned long)chunk);
+    FlushBuffer(out_buf, out_size, out_avail);
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Compressor::Flush(
+                      char* out_buf, size_t  out_size,
+                      /* out */      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    if ( !FlushBuffer(out_buf, out_size, out_avail) ) {
+        return eStatus_Overflow;
+    }
+    if ( !m_Started  ||  m_Finished ) {
+        return eStatus_Success;
+    }
+    // Compress data buffered inside LZ4
+    size_t n = LZ4F_flush(CCTX, m_Buf.get(), m_BufSize, NULL);
+    SetLZ4Error(n);
+    if ( LZ4F_isError(n) ) {
+        ERR_COMPRESS(114, FormatErrorMessage("CLZ4Compressor::Flush"));
+        return eStatus_Error;
+    }
+    m_BufLen = n;
+    return FlushBuffer(out_buf, out_size, out_avail) ?
+        eStatus_Success : eStatus_Overflow;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Compressor::Finish(
+                      char* out_buf, size_t  out_size,
+                      /* out */      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    // Default behavior on empty data -- don't write header/footer
+    if ( !GetProcessedSize()  &&  !F_ISSET(fAllowEmptyData) ) {
+        return eStatus_EndOfData;
+    }
+    if ( !FlushBuffer(out_buf, out_size, out_avail) ) {
+        return eStatus_Overflow;
+    }
+    if ( m_Finished ) {
+        return eStatus_EndOfData;
+    }
+    if ( !m_Started ) {
+        // Empty data, write frame header
+        LZ4F_preferences_t prefs;
+        GetPreferences(&prefs);
+        size_t n = LZ4F_compressBegin(CCTX, m_Buf.get(), m_BufSize, &prefs);
+        SetLZ4Error(n);
+        if ( LZ4F_isError(n) ) {
+            ERR_COMPRESS(115, FormatErrorMessage("CLZ4Compressor::Finish"));
+            return eStatus_Error;
+        }
+        m_BufLen  = n;
+        m_Started = true;
+    }
+    // Write remaining data and frame footer
+    size_t n = LZ4F_compressEnd(CCTX, m_Buf.get() + m_BufLen,
+                                m_BufSize - m_BufLen, NULL);
+    SetLZ4Error(n);
+    if ( LZ4F_isError(n) ) {
+        ERR_COMPRESS(115, FormatErrorMessage("CLZ4Compressor::Finish"));
+        return eStatus_Error;
+    }
+    m_BufLen  += n;
+    m_Finished = true;
+    return FlushBuffer(out_buf, out_size, out_avail) ?
+        eStatus_EndOfData : eStatus_Overflow;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Compressor::End(int /*abandon*/)
+{
+    // Keep context and buffer for the next session,
+    // the next frame will be started from scratch.
+    m_BufPos = m_BufLen = 0;
+    SetBusy(false);
+    return eStatus_Success;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CLZ4Decompressor
+//
+
+
+CLZ4Decompressor::CLZ4Decompressor(TLZ4Flags flags)
+    : CLZ4Compression(eLevel_Default), m_FrameEnd(false)
+{
+    SetFlags(flags);
+}
+
+
+CLZ4Decompressor::~CLZ4Decompressor()
+{
+}
+
+
+CCompressionProcessor::EStatus CLZ4Decompressor::Init(void)
+{
+    // Initialize members
+    Reset();
+    SetBusy();
+    m_Cache.erase();
+    m_FrameEnd = false;
+
+    if ( !m_DCtx ) {
+        size_t errcode =
+            LZ4F_createDecompressionContext((LZ4F_dctx**)&m_DCtx, LZ4F_VERSION);
+        if ( LZ4F_isError(errcode) ) {
+            m_DCtx = 0;
+            SetLZ4Error(errcode);
+            ERR_COMPRESS(116, FormatErrorMessage("CLZ4Decompressor::Init"));
+            return eStatus_Error;
+        }
+    } else {
+        LZ4F_resetDecompressionContext(DCTX);
+    }
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Decompressor::DecompressData(
+                      const char* in_buf,  size_t  in_len,
+                      char*       out_buf, size_t  out_size,
+                      /* out */            size_t* in_avail,
+                      /* out */            size_t* out_avail)
+{
+    size_t in_size = in_len;
+    size_t out_len = out_size;
+
+    // Returns 0 when a frame is completely decoded and fully flushed.
+    // Next frame, if any, is started automatically.
+    size_t errcode = LZ4F_decompress(DCTX, out_buf, &out_len,
+                                     in_buf, &in_size, NULL);
+    SetLZ4Error(errcode);
+    *in_avail  = in_len - in_size;
+    *out_avail = out_len;
+    IncreaseOutputSize((unsigned long)out_len);
+
+    if ( LZ4F_isError(errcode) ) {
+        ERR_COMPRESS(117, FormatErrorMessage("CLZ4Decompressor::Process"));
+        return eStatus_Error;
+    }
+    // Calling without input at the frame end reports
+    // the start of the next frame, ignore it
+    if (in_size  ||  out_len) {
+        m_FrameEnd = (errcode == 0);
+    }
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Decompressor::Process(
+                      const char* in_buf,  size_t  in_len,
+                      char*       out_buf, size_t  out_size,
+                      /* out */            size_t* in_avail,
+                      /* out */            size_t* out_avail)
+{
+    *out_avail = 0;
+    *in_avail  = in_len;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    // By default we consider that data is compressed
+    if ( m_DecompressMode == eMode_Unknown  &&
+        !F_ISSET(fAllowTransparentRead) ) {
+        m_DecompressMode = eMode_Decompress;
+    }
+    if ( m_DecompressMode == eMode_Unknown ) {
+        // Collect magic number to determine decompression mode
+        size_t n = min(in_len, kMagicSize - m_Cache.size());
+        m_Cache.append(in_buf, n);
+        in_buf += n;
+        in_len -= n;
+        *in_avail = in_len;
+        IncreaseProcessedSize((unsigned long)n);
+        if (m_Cache.size() < kMagicSize) {
+            return eStatus_Success;
+        }
+        m_DecompressMode = s_IsLZ4Frame(m_Cache.data(), m_Cache.size()) ?
+            eMode_Decompress : eMode_TransparentRead;
+    }
+
+    if ( m_DecompressMode == eMode_TransparentRead ) {
+        // Cached data goes first
+        size_t n = min(m_Cache.size(), out_size);
+        memcpy(out_buf, m_Cache.data(), n);
+        m_Cache.erase(0, n);
+        size_t k = min(in_len, out_size - n);
+        memcpy(out_buf + n, in_buf, k);
+        *in_avail  = in_len - k;
+        *out_avail = n + k;
+        IncreaseProcessedSize((unsigned long)k);
+        IncreaseOutputSize((unsigned long)(n + k));
+        return eStatus_Success;
+    }
+
+    // Decompress cached data first
+    if ( !m_Cache.empty() ) {
+        size_t cache_avail;
+        EStatus status = DecompressData(m_Cache.data(), m_Cache.size(),
+                                        out_buf, out_size,
+                                        &cache_avail, out_avail);
+        m_Cache.erase(0, m_Cache.size() - cache_avail);
+        if (status != eStatus_Success  ||  !m_Cache.empty()) {
+            return status;
+        }
+        if (*out_avail) {
+            // Continue on the next call
+            return eStatus_Success;
+        }
+    }
+    EStatus status = DecompressData(in_buf, in_len, out_buf, out_size,
+                                    in_avail, out_avail);
+    IncreaseProcessedSize((unsigned long)(in_len - *in_avail));
+    return status;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Decompressor::Flush(
+                      char*   out_buf, size_t  out_size,
+                      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( m_DecompressMode == eMode_Unknown ) {
+        if ( !m_Cache.empty() ) {
+            // Magic number is incomplete yet
+            return eStatus_Success;
+        }
+        return F_ISSET(fAllowEmptyData) ? eStatus_Success : eStatus_Error;
+    }
+    if ( m_DecompressMode == eMode_TransparentRead  ||  !out_size ) {
+        return eStatus_Success;
+    }
+    // Get data buffered inside decompressor
+    size_t in_avail;
+    EStatus status = DecompressData(0, 0, out_buf, out_size,
+                                    &in_avail, out_avail);
+    if (status == eStatus_Success  &&  *out_avail == out_size) {
+        return eStatus_Overflow;
+    }
+    return status;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Decompressor::Finish(
+                      char*   out_buf, size_t  out_size,
+                      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( m_DecompressMode == eMode_Unknown ) {
+        if ( m_Cache.empty() ) {
+            if ( !F_ISSET(fAllowEmptyData) ) {
+                return eStatus_Error;
+            }
+            return eStatus_EndOfData;
+        }
+        // Data is too short to be compressed
+        m_DecompressMode = eMode_TransparentRead;
+    }
+    if ( m_DecompressMode == eMode_TransparentRead ) {
+        size_t n = min(m_Cache.size(), out_size);
+        memcpy(out_buf, m_Cache.data(), n);
+        m_Cache.erase(0, n);
+        *out_avail = n;
+        IncreaseOutputSize((unsigned long)n);
+        return m_Cache.empty() ? eStatus_EndOfData : eStatus_Overflow;
+    }
+    if ( !GetProcessedSize() ) {
+        return F_ISSET(fAllowEmptyData) ? eStatus_EndOfData : eStatus_Error;
+    }
+    EStatus status = Flush(out_buf, out_size, out_avail);
+    if (status != eStatus_Success) {
+        return status;
+    }
+    if ( !m_FrameEnd ) {
+        SetError(-1, "Unexpected end of compressed data");
+        ERR_COMPRESS(118, FormatErrorMessage("CLZ4Decompressor::Finish"));
+        return eStatus_Error;
+    }
+    return eStatus_EndOfData;
+}
+
+
+CCompressionProcessor::EStatus CLZ4Decompressor::End(int /*abandon*/)
+{
+    SetBusy(false);
+    return eStatus_Success;
+}
+
+
+END_NCBI_SCOPE
+
+#endif  /* HAVE_LIBLZ4 */
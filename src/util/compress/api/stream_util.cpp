@@ -41,6 +41,12 @@ const ICompression::TFlags kDefault_LZO      = 0;
 #endif
 const ICompression::TFlags kDefault_Zip      = 0;
 const ICompression::TFlags kDefault_GZipFile = CZipCompression::fGZip;
+#if defined(HAVE_LIBZSTD)
+const ICompression::TFlags kDefault_Zstd     = 0;
+#endif
+#if defined(HAVE_LIBLZ4)
+const ICompression::TFlags kDefault_LZ4      = 0;
+#endif
 
 
 // Type of initialization
@@ -117,6 +123,36 @@ CCompressionStreamProcessor* s_Init(EInitType                type,
         }
         break;
 
+    case CCompressStream::eZstd:
+#if defined(HAVE_LIBZSTD)
+        if (flags == CCompressStream::fDefault) {
+            flags = kDefault_Zstd;
+        } else {
+            flags |= kDefault_Zstd;
+        }
+        if (type == eCompress) {
+            processor = new CZstdStreamCompressor(level, flags);
+        } else {
+            processor = new CZstdStreamDecompressor(flags);
+        }
+#endif
+        break;
+
+    case CCompressStream::eLZ4:
+#if defined(HAVE_LIBLZ4)
+        if (flags == CCompressStream::fDefault) {
+            flags = kDefault_LZ4;
+        } else {
+            flags |= kDefault_LZ4;
+        }
+        if (type == eCompress) {
+            processor = new CLZ4StreamCompressor(level, flags);
+        } else {
+            processor = new CLZ4StreamDecompressor(flags);
+        }
+#endif
+        break;
+
     default:
         NCBI_THROW(CCompressionException, eCompression, 
             "Unknown compression/decompression method");
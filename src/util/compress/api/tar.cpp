@@ -50,8 +50,10 @@
 #endif /*_FORTIFY_SOURCE*/
 #define  _FORTIFY_SOURCE 0
 #include <corelib/ncbi_system.hpp>
+#include <corelib/rwstream.hpp>
 #include <util/compress/tar.hpp>
 #include <util/error_codes.hpp>
+#include <util/thread_pool.hpp>
 
 #if !defined(NCBI_OS_UNIX)  &&  !defined(NCBI_OS_MSWIN)
 #  error "Class CTar can be defined on UNIX and MS-Windows platforms only!"
@@ -59,6 +61,7 @@
 
 #ifdef NCBI_OS_UNIX
 #  include "../../../corelib/ncbi_os_unix_p.hpp"
+#  include <fcntl.h>
 #  include <grp.h>
 #  include <pwd.h>
 #  include <unistd.h>
@@ -1258,6 +1261,369 @@ inline void s_SetStateSafe(CNcbiIos& ios, IOS_BASE::iostate state) throw()
 }
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Parallel processing helpers
+//
+
+// Size of data pieces read and written by background threads
+static const size_t kParallelBufferSize = 1024 * 1024;
+
+
+// Background task of CTar, which can be waited for.
+class CTarTask : public CThreadPool_Task
+{
+public:
+    CTarTask(void)
+        : m_Ready(false), m_Done(0, 1)
+    { }
+
+    virtual EStatus Execute(void)
+    {
+        x_Run();
+        m_Done.Post();
+        return eCompleted;
+    }
+
+    // Check whether the task is complete, do not wait for it.
+    bool IsReady(void)
+    {
+        if (!m_Ready) {
+            m_Ready = m_Done.TryWait();
+        }
+        return m_Ready;
+    }
+
+    void Wait(void)
+    {
+        if (!m_Ready) {
+            m_Done.Wait();
+            m_Ready = true;
+        }
+    }
+
+protected:
+    virtual void x_Run(void) = 0;
+
+private:
+    bool       m_Ready;
+    CSemaphore m_Done;
+};
+
+
+// Copy the data of an archive entry into the destination file.
+class CTarExtractTask : public CTarTask
+{
+public:
+    CTarExtractTask(const CTarEntryInfo& info, const string& path,
+                    const string& archive, Uint8 pos, Uint8 size)
+        : m_Info(info), m_Path(path),
+          m_Archive(archive), m_Pos(pos), m_Size(size)
+    { }
+
+    CTarEntryInfo m_Info;   // Entry being extracted
+    string        m_Path;   // Destination file path
+    CFileIO       m_File;   // Destination file, opened for writing
+    string        m_Error;  // Error message if the extraction failed
+
+protected:
+    virtual void x_Run(void);
+
+private:
+    string        m_Archive;
+    Uint8         m_Pos;
+    Uint8         m_Size;
+};
+
+
+void CTarExtractTask::x_Run(void)
+{
+    try {
+#ifdef HAVE_POSIX_FALLOCATE
+        // Reserve all space at once, so the concurrently written files
+        // do not get fragmented;  it's only a hint, so ignore errors
+        posix_fallocate(m_File.GetFileHandle(), 0, (off_t) m_Size);
+#endif //HAVE_POSIX_FALLOCATE
+        CFileIO archive;
+        archive.Open(m_Archive, CFileIO::eOpen, CFileIO::eRead);
+        archive.SetFilePos(m_Pos);
+
+        size_t pagemask = (size_t) GetVirtualMemoryPageSize() - 1;
+        if (pagemask == (size_t)(-1)) {
+            pagemask = 4096 - 1;
+        }
+        AutoArray<char> bufptr(kParallelBufferSize + pagemask);
+        char* buf = bufptr.get() + ((((size_t) bufptr.get() + pagemask)
+                                     & ~pagemask) - (size_t) bufptr.get());
+        while (m_Size) {
+            size_t n = m_Size < kParallelBufferSize
+                ? (size_t) m_Size : kParallelBufferSize;
+            for (size_t nread = 0;  nread < n;  ) {
+                size_t x_read = archive.Read(buf + nread, n - nread);
+                if (!x_read) {
+                    m_Error = "Unexpected EOF in archive";
+                    return;
+                }
+                nread += x_read;
+            }
+            m_File.Write(buf, n);
+            m_Size -= n;
+        }
+        m_File.Close();
+    }
+    catch (CException& e) {
+        m_Error = e.GetMsg();
+    }
+}
+
+
+// Read a piece of a file, which is going to be added to the archive.
+class CTarReadTask : public CTarTask
+{
+public:
+    CTarReadTask(const string& path, Uint8 pos, size_t size)
+        : m_Path(path), m_Pos(pos), m_Size(size), m_Bad(false)
+    { }
+
+    string m_Path;  // File path
+    Uint8  m_Pos;   // Position of the data in the file
+    size_t m_Size;  // Requested size
+    string m_Data;  // Data read (can be short if the file has been changed)
+    bool   m_Bad;   // True if the file could not be read
+
+protected:
+    virtual void x_Run(void);
+};
+
+
+void CTarReadTask::x_Run(void)
+{
+    try {
+        CFileIO file;
+        file.Open(m_Path, CFileIO::eOpen, CFileIO::eRead);
+        file.SetFilePos(m_Pos);
+        m_Data.resize(m_Size);
+        size_t nread = 0;
+        while (nread < m_Size) {
+            size_t x_read = file.Read(&m_Data[nread], m_Size - nread);
+            if (!x_read) {
+                break;
+            }
+            nread += x_read;
+        }
+        m_Data.resize(nread);
+    }
+    catch (CException&) {
+        m_Data.erase();
+        m_Bad = true;
+    }
+}
+
+
+// State of parallel processing:  the thread pool, files being extracted,
+// and files being read ahead (in the order they get added to the archive).
+class CTarParallel
+{
+public:
+    CTarParallel(unsigned int threads)
+        : m_Pool(kMax_UInt, threads, threads),
+          m_MaxTasks(2 * threads + 1),
+          m_FilePos(0), m_FileSize(0)
+    { }
+    ~CTarParallel();
+
+    typedef deque< CRef<CTarExtractTask> > TExtractTasks;
+    typedef deque< CRef<CTarReadTask> >    TReadTasks;
+
+    // Check if the file is being extracted in the background.
+    bool IsExtracting(const string& path) const;
+
+    // Queue files to be read ahead before any other queued files.
+    void ReadAhead(const list<string>& files);
+
+    // Get data of the file at the position (or NULL if not read ahead),
+    // dropping data of the queued files, which precede this file.
+    CRef<CTarReadTask> GetData(const string& path, Uint8 pos);
+
+    CThreadPool   m_Pool;
+    size_t        m_MaxTasks;  // Maximal number of tasks in each queue
+    TExtractTasks m_Extract;   // Files being extracted
+
+private:
+    // Start reading the queued files until enough tasks are in progress.
+    void x_ReadAhead(void);
+
+    TReadTasks    m_Read;      // Pieces of files being read
+    list<string>  m_Files;     // Files to read next
+    string        m_File;      // File currently being read
+    Uint8         m_FilePos;   // Position of the next piece to read
+    Uint8         m_FileSize;  // Size of the file
+};
+
+
+CTarParallel::~CTarParallel()
+{
+    // Tasks cannot be taken back from the pool, wait for them
+    NON_CONST_ITERATE(TExtractTasks, it, m_Extract) {
+        (*it)->Wait();
+    }
+    NON_CONST_ITERATE(TReadTasks, it, m_Read) {
+        (*it)->Wait();
+    }
+}
+
+
+bool CTarParallel::IsExtracting(const string& path) const
+{
+    ITERATE(TExtractTasks, it, m_Extract) {
+        if ((*it)->m_Path == path) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void CTarParallel::ReadAhead(const list<string>& files)
+{
+    m_Files.insert(m_Files.begin(), files.begin(), files.end());
+    x_ReadAhead();
+}
+
+
+void CTarParallel::x_ReadAhead(void)
+{
+    while (m_Read.size() < m_MaxTasks) {
+        if (m_FilePos >= m_FileSize) {
+            if (m_Files.empty()) {
+                break;
+            }
+            m_File = m_Files.front();
+            m_Files.pop_front();
+            Int8 size = CFile(m_File).GetLength();
+            m_FileSize = size > 0 ? (Uint8) size : 0;
+            m_FilePos  = 0;
+            continue;
+        }
+        Uint8  left = m_FileSize - m_FilePos;
+        size_t size = left < kParallelBufferSize
+            ? (size_t) left : kParallelBufferSize;
+        CRef<CTarReadTask> task(new CTarReadTask(m_File, m_FilePos, size));
+        m_Pool.AddTask(task);
+        m_Read.push_back(task);
+        m_FilePos += size;
+    }
+}
+
+
+CRef<CTarReadTask> CTarParallel::GetData(const string& path, Uint8 pos)
+{
+    bool queued = false;
+    ITERATE(TReadTasks, it, m_Read) {
+        if ((*it)->m_Path == path) {
+            queued = true;
+            break;
+        }
+    }
+    if (!queued  &&  m_File != path) {
+        list<string>::iterator it = find(m_Files.begin(), m_Files.end(), path);
+        if (it == m_Files.end()) {
+            // Not read ahead, do not touch the queue
+            return CRef<CTarReadTask>();
+        }
+        // Files before this one have been skipped
+        m_Files.erase(m_Files.begin(), it);
+        m_FilePos = m_FileSize = 0;
+    }
+    // Drop data of the skipped files
+    while (!m_Read.empty()  &&  m_Read.front()->m_Path != path) {
+        m_Read.front()->Wait();
+        m_Read.pop_front();
+    }
+    x_ReadAhead();
+    if (m_Read.empty()  ||  m_Read.front()->m_Pos != pos) {
+        return CRef<CTarReadTask>();
+    }
+    CRef<CTarReadTask> task = m_Read.front();
+    m_Read.pop_front();
+    x_ReadAhead();
+    task->Wait();
+    if (task->m_Bad) {
+        task.Reset();
+    }
+    return task;
+}
+
+
+// Reader of a file being added to the archive:  takes the data read ahead,
+// and reads the file directly after they run out.
+class CTarFileReader : public IReader
+{
+public:
+    CTarFileReader(CTarParallel* parallel, const string& path,
+                   CRef<CTarReadTask> data)
+        : m_Parallel(parallel), m_Path(path),
+          m_Data(data), m_DataPos(0), m_Pos(0)
+    { }
+
+    virtual ERW_Result Read(void* buf, size_t count, size_t* bytes_read = 0);
+    virtual ERW_Result PendingCount(size_t* count);
+
+private:
+    CTarParallel*      m_Parallel;
+    string             m_Path;
+    CRef<CTarReadTask> m_Data;     // Current piece of data read ahead
+    size_t             m_DataPos;  // Position within the piece
+    Uint8              m_Pos;      // Position in the file
+    CFileIO            m_File;     // File to read directly
+};
+
+
+ERW_Result CTarFileReader::Read(void* buf, size_t count, size_t* bytes_read)
+{
+    size_t read = 0;
+    if (m_Data  &&  m_DataPos == m_Data->m_Data.size()) {
+        m_Data = m_Data->m_Data.size() == m_Data->m_Size
+            ? m_Parallel->GetData(m_Path, m_Pos) : CRef<CTarReadTask>();
+        m_DataPos = 0;
+    }
+    if (m_Data) {
+        read = m_Data->m_Data.size() - m_DataPos;
+        if (read > count) {
+            read = count;
+        }
+        memcpy(buf, m_Data->m_Data.data() + m_DataPos, read);
+        m_DataPos += read;
+    } else {
+        try {
+            if (m_File.GetFileHandle() == kInvalidHandle) {
+                m_File.Open(m_Path, CFileIO::eOpen, CFileIO::eRead);
+                m_File.SetFilePos(m_Pos);
+            }
+            read = m_File.Read(buf, count);
+        }
+        catch (CException&) {
+            if (bytes_read) {
+                *bytes_read = 0;
+            }
+            return eRW_Error;
+        }
+    }
+    m_Pos += read;
+    if (bytes_read) {
+        *bytes_read = read;
+    }
+    return read  ||  !count ? eRW_Success : eRW_Eof;
+}
+
+
+ERW_Result CTarFileReader::PendingCount(size_t* count)
+{
+    *count = m_Data ? m_Data->m_Data.size() - m_DataPos : 0;
+    return eRW_Success;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // CTar
@@ -1276,7 +1642,9 @@ CTar::CTar(const string& filename, size_t blocking_factor)
       m_OpenMode(eNone),
       m_Modified(false),
       m_Bad(false),
-      m_Flags(fDefault)
+      m_Flags(fDefault),
+      m_ThreadCount(1),
+      m_Parallel(0)
 {
     x_Init();
 }
@@ -1295,7 +1663,9 @@ CTar::CTar(CNcbiIos& stream, size_t blocking_factor)
       m_OpenMode(eNone),
       m_Modified(false),
       m_Bad(false),
-      m_Flags(fDefault)
+      m_Flags(fDefault),
+      m_ThreadCount(1),
+      m_Parallel(0)
 {
     x_Init();
 }
@@ -1565,10 +1935,40 @@ void CTar::x_Open(EAction action)
 }
 
 
+auto_ptr<CTar::TEntries> CTar::Append(const string& name)
+{
+    x_Open(eAppend);
+    x_BeginParallel();
+    auto_ptr<TEntries> entries;
+    try {
+        entries = x_Append(name);
+    }
+    catch (...) {
+        x_EndParallel();
+        throw;
+    }
+    x_EndParallel();
+    return entries;
+}
+
+
 auto_ptr<CTar::TEntries> CTar::Extract(void)
 {
     x_Open(eExtract);
-    auto_ptr<TEntries> entries = x_ReadAndProcess(eExtract);
+    // Data can be read independently from a file archive only
+    if (m_FileStream  &&  !(m_Flags & fStreamPipeThrough)) {
+        x_BeginParallel();
+    }
+    auto_ptr<TEntries> entries;
+    try {
+        entries = x_ReadAndProcess(eExtract);
+        x_FlushParallel(true);
+    }
+    catch (...) {
+        x_EndParallel();
+        throw;
+    }
+    x_EndParallel();
 
     // Restore attributes of "postponed" directory entries
     if (m_Flags & fPreserveAll) {
@@ -2987,6 +3387,13 @@ bool CTar::x_ProcessEntry(bool extract, Uint8 size,
             dst->DereferenceLink();
         }
 
+        // Files being extracted in the background must be complete before
+        // they can be replaced, or linked to
+        if (m_Parallel  &&  (type == CTarEntryInfo::eHardLink  ||
+                             m_Parallel->IsExtracting(dst->GetPath()))) {
+            x_FlushParallel(true);
+        }
+
         // Actual type in file system (if exists)
         CDirEntry::EType dst_type = dst->GetType();
 
@@ -3198,6 +3605,14 @@ bool CTar::x_ExtractEntry(Uint8& size,
                                    dst, fTarURead | fTarUWrite);
                 }
 
+                if (m_Parallel  &&  size > m_BufferSize) {
+                    // The data get skipped in the archive (size is kept),
+                    // and the attributes get restored when extracted
+                    ofs.close();
+                    x_ExtractParallel(size, dst);
+                    break;
+                }
+
                 while (size) {
                     // Read from the archive
                     size_t nread = size < m_BufferSize
@@ -3364,6 +3779,75 @@ bool CTar::x_ExtractEntry(Uint8& size,
 }
 
 
+void CTar::x_BeginParallel(void)
+{
+    _ASSERT(!m_Parallel);
+    unsigned int threads = m_ThreadCount ? m_ThreadCount
+        : max(GetCpuCount(), 1U);
+    if (threads > 1) {
+        m_Parallel = new CTarParallel(threads);
+    }
+}
+
+
+void CTar::x_EndParallel(void)
+{
+    delete m_Parallel;  // NB: waits for all tasks
+    m_Parallel = 0;
+}
+
+
+void CTar::x_ExtractParallel(Uint8 size, const CDirEntry* dst)
+{
+    _ASSERT(m_Parallel  &&  !m_FileName.empty());
+    CRef<CTarExtractTask> task(new CTarExtractTask(m_Current, dst->GetPath(),
+                                                   m_FileName, m_StreamPos,
+                                                   size));
+    try {
+        task->m_File.Open(dst->GetPath(), CFileIO::eOpen, CFileIO::eWrite);
+    }
+    catch (CException& e) {
+        TAR_THROW(this, eCreate,
+                  "Cannot create file '" + dst->GetPath() + "': "
+                  + e.GetMsg());
+    }
+    // Limit the number of files being extracted at a time
+    while (m_Parallel->m_Extract.size() >= m_Parallel->m_MaxTasks) {
+        m_Parallel->m_Extract.front()->Wait();
+        x_FlushParallel(false);
+    }
+    m_Parallel->m_Pool.AddTask(task);
+    m_Parallel->m_Extract.push_back(task);
+}
+
+
+void CTar::x_FlushParallel(bool wait)
+{
+    if (!m_Parallel) {
+        return;
+    }
+    CTarParallel::TExtractTasks& tasks = m_Parallel->m_Extract;
+    while (!tasks.empty()) {
+        CRef<CTarExtractTask> task = tasks.front();
+        if (wait) {
+            task->Wait();
+        } else if (!task->IsReady()) {
+            break;
+        }
+        tasks.pop_front();
+        if (!task->m_Error.empty()) {
+            TAR_THROW(this, eWrite,
+                      "Error writing file '" + task->m_Path + "': "
+                      + task->m_Error);
+        }
+        if (m_Flags & fPreserveAll) {
+            CFile file(task->m_Path);
+            x_RestoreAttrs(task->m_Info, m_Flags, &file);
+        }
+    }
+}
+
+
 void CTar::x_RestoreAttrs(const CTarEntryInfo& info,
                           TFlags               what,
                           const CDirEntry*     path,
@@ -3701,6 +4185,16 @@ auto_ptr<CTar::TEntries> CTar::x_Append(const string&   name,
             x_WriteEntryInfo(path);
             entries->push_back(m_Current);
         }
+        if (m_Parallel) {
+            // Start reading the files while they are waiting for their turn
+            list<string> files;
+            ITERATE(CDir::TEntries, e, *dir) {
+                if ((*e)->IsFile(follow_links)) {
+                    files.push_back((*e)->GetPath());
+                }
+            }
+            m_Parallel->ReadAhead(files);
+        }
         // Append/update all files from that directory
         ITERATE(CDir::TEntries, e, *dir) {
             auto_ptr<TEntries> add = x_Append((*e)->GetPath(), toc);
@@ -3890,6 +4384,16 @@ void CTar::x_AppendFile(const string& file)
 {
     _ASSERT(m_Current.GetType() == CTarEntryInfo::eFile);
 
+    if (m_Parallel) {
+        CRef<CTarReadTask> data = m_Parallel->GetData(file, 0);
+        if (data) {
+            CRStream is(new CTarFileReader(m_Parallel, file, data),
+                        0, 0, CRWStreambuf::fOwnReader);
+            x_AppendStream(file, is);
+            return;
+        }
+    }
+
     // FIXME:  Switch to CFileIO eventually to avoid ifstream
     // obscurity w.r.t. errors, an extra layer of buffering etc.
     CNcbiIfstream ifs;
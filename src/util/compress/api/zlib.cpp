@@ -38,7 +38,9 @@
 #include <ncbi_pch.hpp>
 #include <corelib/ncbi_limits.h>
 #include <corelib/ncbifile.hpp>
+#include <corelib/ncbi_system.hpp>
 #include <util/compress/zlib.hpp>
+#include <util/thread_pool.hpp>
 #include <util/error_codes.hpp>
 #include <zlib.h>
 
@@ -1416,6 +1418,454 @@ CCompressionProcessor::EStatus CZipDecompressor::End(int abandon)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZipParallelCompressor
+//
+
+// Default size of input block for parallel compression
+const size_t kParallelBlockSize = 128*1024;
+
+// Maximum size of input data in BGZF block: the compressed block,
+// including header and footer, must not exceed 64KB even for
+// incompressible data.
+const size_t kBGZFMaxInputSize  = 0xff00;
+const size_t kBGZFMaxBlockSize  = 0x10000;
+const size_t kBGZFHeaderSize    = 18;
+const size_t kBGZFFooterSize    = 8;
+
+// Empty BGZF block, which marks the end of BGZF file
+static const unsigned char s_BGZFEOF[28] = {
+    0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00,
+    0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+};
+
+
+// Input block of CZipParallelCompressor and its compressed data.
+// Compressed by a thread pool, or by the writing thread if the pool
+// is not used.
+class CZipParallelBlock : public CThreadPool_Task
+{
+public:
+    CZipParallelBlock(int level, int window_bits, int mem_level,
+                      int strategy, bool bgzf)
+        : m_Last(false), m_CRC32(0), m_ErrCode(Z_OK),
+          m_Level(level), m_WindowBits(window_bits), m_MemLevel(mem_level),
+          m_Strategy(strategy), m_BGZF(bgzf), m_Ready(false), m_Done(0, 1)
+    {}
+
+    virtual EStatus Execute(void)
+    {
+        m_ErrCode = x_Compress(m_Level);
+        if (m_ErrCode == Z_OK  &&  m_BGZF  &&
+            m_Output.size() > kBGZFMaxBlockSize) {
+            // Incompressible data, store it
+            m_ErrCode = x_Compress(0);
+        }
+        m_Done.Post();
+        return eCompleted;
+    }
+
+    // Check whether the block is compressed, do not wait for it.
+    bool IsReady(void)
+    {
+        if ( !m_Ready ) {
+            m_Ready = m_Done.TryWait();
+        }
+        return m_Ready;
+    }
+
+    void Wait(void)
+    {
+        if ( !m_Ready ) {
+            m_Done.Wait();
+            m_Ready = true;
+        }
+    }
+
+    string        m_Input;     // Data to compress
+    string        m_Dict;      // Dictionary, tail of the previous block
+    string        m_Output;    // Compressed data
+    bool          m_Last;      // Last block of gzip member
+    unsigned long m_CRC32;     // CRC32 of m_Input
+    int           m_ErrCode;   // zlib error code
+
+private:
+    int x_Compress(int level);
+
+    int        m_Level;
+    int        m_WindowBits;
+    int        m_MemLevel;
+    int        m_Strategy;
+    bool       m_BGZF;
+    bool       m_Ready;
+    CSemaphore m_Done;
+};
+
+
+int CZipParallelBlock::x_Compress(int level)
+{
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    int errcode = deflateInit2_(&stream, level, Z_DEFLATED, -m_WindowBits,
+                                m_MemLevel, m_Strategy,
+                                ZLIB_VERSION, (int)sizeof(z_stream));
+    if (errcode != Z_OK) {
+        return errcode;
+    }
+    if ( !m_Dict.empty() ) {
+        errcode = deflateSetDictionary(&stream,
+                                       (const Bytef*)m_Dict.data(),
+                                       (uInt)m_Dict.size());
+    }
+    // Each block except the last one ends on a byte boundary,
+    // so compressed blocks can be simply concatenated.
+    int    flush  = (m_Last  ||  m_BGZF) ? Z_FINISH : Z_SYNC_FLUSH;
+    size_t header = m_BGZF ? kBGZFHeaderSize : 0;
+    m_Output.resize(header +
+                    deflateBound(&stream, (uLong)m_Input.size()) + 16);
+    stream.next_in   = (Bytef*)const_cast<char*>(m_Input.data());
+    stream.avail_in  = (uInt)m_Input.size();
+    stream.next_out  = (Bytef*)&m_Output[header];
+    stream.avail_out = (uInt)(m_Output.size() - header);
+
+    while (errcode == Z_OK) {
+        errcode = deflate(&stream, flush);
+        if (errcode == Z_STREAM_END) {
+            errcode = Z_OK;
+            break;
+        }
+        if (errcode == Z_BUF_ERROR) {
+            errcode = Z_OK;
+        }
+        if (errcode != Z_OK) {
+            break;
+        }
+        if (flush == Z_SYNC_FLUSH  &&  !stream.avail_in  &&
+            stream.avail_out) {
+            break;
+        }
+        // Output buffer is too small, should not happen usually
+        size_t used = m_Output.size() - stream.avail_out;
+        m_Output.resize(m_Output.size() * 2);
+        stream.next_out  = (Bytef*)&m_Output[used];
+        stream.avail_out = (uInt)(m_Output.size() - used);
+    }
+    size_t out_len = m_Output.size() - stream.avail_out;
+    deflateEnd(&stream);
+    if (errcode != Z_OK) {
+        return errcode;
+    }
+    m_CRC32 = crc32(0L, (const Bytef*)m_Input.data(), (uInt)m_Input.size());
+
+    if ( m_BGZF ) {
+        // gzip member with BGZF extra field, which keeps the member size
+        size_t size = out_len + kBGZFFooterSize;
+        m_Output.resize(size);
+        unsigned char* buf = (unsigned char*)&m_Output[0];
+        memset(buf, 0, kBGZFHeaderSize);
+        buf[0]  = gz_magic[0];
+        buf[1]  = gz_magic[1];
+        buf[2]  = Z_DEFLATED;
+        buf[3]  = EXTRA_FIELD;
+        buf[9]  = 0xff;             // OS unknown
+        buf[10] = 6;                // XLEN
+        buf[12] = 'B';
+        buf[13] = 'C';
+        buf[14] = 2;                // SLEN
+        buf[16] = (unsigned char)((size - 1) & 0xff);
+        buf[17] = (unsigned char)((size - 1) >> 8);
+        s_WriteGZipFooter(buf + out_len, kBGZFFooterSize,
+                          (unsigned long)m_Input.size(), m_CRC32);
+    } else {
+        m_Output.resize(out_len);
+    }
+    return Z_OK;
+}
+
+
+CZipParallelCompressor::CZipParallelCompressor(ELevel level,
+                                               EFormat format,
+                                               unsigned int threads,
+                                               size_t block_size,
+                                               int mem_level, int strategy,
+                                               TZipFlags flags)
+    : CZipCompression(level, kZlibDefaultWbits, mem_level, strategy),
+      m_Format(format),
+      m_ThreadCount(threads ? threads : max(GetCpuCount(), 1U)),
+      m_BlockSize(block_size ? block_size : kParallelBlockSize),
+      m_OutputPos(0), m_CRC32(0), m_NeedWriteHeader(true), m_Finished(false)
+{
+    SetFlags(flags);
+    if (m_Format == eFormat_BGZF  &&  m_BlockSize > kBGZFMaxInputSize) {
+        m_BlockSize = kBGZFMaxInputSize;
+    }
+    LIMIT_SIZE_PARAM(m_BlockSize);
+    // Keep all threads busy while the writing thread collects the output
+    m_MaxBlocks = m_ThreadCount * 2;
+}
+
+
+CZipParallelCompressor::~CZipParallelCompressor()
+{
+    x_CancelBlocks();
+}
+
+
+void CZipParallelCompressor::SetFileInfo(const SFileInfo& info)
+{
+    m_FileInfo = info;
+}
+
+
+bool CZipParallelCompressor::x_SubmitBlock(bool last)
+{
+    if ( !m_Block ) {
+        m_Block.Reset(new CZipParallelBlock(GetLevel(), m_WindowBits,
+                                            m_MemLevel, m_Strategy,
+                                            m_Format == eFormat_BGZF));
+    }
+    CRef<CZipParallelBlock> block = m_Block;
+    m_Block.Reset();
+    block->m_Last = last;
+
+    if (m_Format == eFormat_GZip) {
+        // Prime the block with the tail of previous data, so the
+        // compression ratio doesn't suffer from splitting to blocks.
+        size_t window = size_t(1) << m_WindowBits;
+        block->m_Dict = m_Window;
+        if (block->m_Input.size() >= window) {
+            m_Window.assign(block->m_Input, block->m_Input.size() - window,
+                            window);
+        } else {
+            m_Window += block->m_Input;
+            if (m_Window.size() > window) {
+                m_Window.erase(0, m_Window.size() - window);
+            }
+        }
+    }
+    // Limit the memory used by queued blocks
+    while (m_Blocks.size() >= m_MaxBlocks) {
+        m_Blocks.front()->Wait();
+        if ( !x_CollectBlocks(false) ) {
+            return false;
+        }
+    }
+    if (m_ThreadCount > 1) {
+        if ( !m_ThreadPool.get() ) {
+            m_ThreadPool.reset(new CThreadPool(kMax_UInt, m_ThreadCount,
+                                               m_ThreadCount));
+        }
+        m_ThreadPool->AddTask(block);
+    } else {
+        block->Execute();
+    }
+    m_Blocks.push_back(block);
+    return true;
+}
+
+
+bool CZipParallelCompressor::x_CollectBlocks(bool wait)
+{
+    while ( !m_Blocks.empty() ) {
+        CZipParallelBlock& block = *m_Blocks.front();
+        if ( wait ) {
+            block.Wait();
+        } else if ( !block.IsReady() ) {
+            break;
+        }
+        if (block.m_ErrCode != Z_OK) {
+            SetError(block.m_ErrCode, zError(block.m_ErrCode));
+            ERR_COMPRESS(87, FormatErrorMessage
+                         ("CZipParallelCompressor::x_CollectBlocks",
+                          GetProcessedSize()));
+            return false;
+        }
+        m_CRC32 = crc32_combine(m_CRC32, block.m_CRC32,
+                                (z_off_t)block.m_Input.size());
+        m_Output.append(block.m_Output);
+        m_Blocks.pop_front();
+    }
+    return true;
+}
+
+
+void CZipParallelCompressor::x_WriteOutput(char* out_buf, size_t out_size,
+                                           size_t* out_avail)
+{
+    size_t n = min(out_size - *out_avail, m_Output.size() - m_OutputPos);
+    memcpy(out_buf + *out_avail, m_Output.data() + m_OutputPos, n);
+    *out_avail  += n;
+    m_OutputPos += n;
+    IncreaseOutputSize((unsigned long)n);
+    if (m_OutputPos == m_Output.size()) {
+        m_Output.erase();
+        m_OutputPos = 0;
+    }
+}
+
+
+void CZipParallelCompressor::x_CancelBlocks(void)
+{
+    // Blocks cannot be taken back from the pool, wait for them
+    NON_CONST_ITERATE(TBlocks, it, m_Blocks) {
+        (*it)->Wait();
+    }
+    m_Blocks.clear();
+    m_Block.Reset();
+}
+
+
+CCompressionProcessor::EStatus CZipParallelCompressor::Init(void)
+{
+    if ( IsBusy() ) {
+        // Abnormal previous session termination
+        End();
+    }
+    // Initialize members
+    Reset();
+    SetBusy();
+
+    x_CancelBlocks();
+    m_Window.erase();
+    m_Output.erase();
+    m_OutputPos = 0;
+    m_CRC32 = 0;
+    m_NeedWriteHeader = true;
+    m_Finished = false;
+    SetError(Z_OK, zError(Z_OK));
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CZipParallelCompressor::Process(
+                      const char* in_buf,  size_t  in_len,
+                      char*       out_buf, size_t  out_size,
+                      /* out */            size_t* in_avail,
+                      /* out */            size_t* out_avail)
+{
+    *in_avail  = in_len;
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    // Write gzip file header
+    if ( m_NeedWriteHeader ) {
+        if (m_Format == eFormat_GZip) {
+            char header[kMaxHeaderSize];
+            size_t header_len = s_WriteGZipHeader(header, kMaxHeaderSize,
+                                                  &m_FileInfo);
+            m_Output.append(header, header_len);
+        }
+        m_NeedWriteHeader = false;
+    }
+    if ( !x_CollectBlocks(false) ) {
+        return eStatus_Error;
+    }
+    x_WriteOutput(out_buf, out_size, out_avail);
+    if ( !m_Output.empty() ) {
+        // Don't take new data until all compressed data is written
+        return eStatus_Overflow;
+    }
+    if ( !m_Block ) {
+        m_Block.Reset(new CZipParallelBlock(GetLevel(), m_WindowBits,
+                                            m_MemLevel, m_Strategy,
+                                            m_Format == eFormat_BGZF));
+        m_Block->m_Input.reserve(m_BlockSize);
+    }
+    size_t n = min(in_len, m_BlockSize - m_Block->m_Input.size());
+    m_Block->m_Input.append(in_buf, n);
+    *in_avail -= n;
+    IncreaseProcessedSize((unsigned long)n);
+
+    if (m_Block->m_Input.size() == m_BlockSize) {
+        if ( !x_SubmitBlock(false) ) {
+            return eStatus_Error;
+        }
+        x_WriteOutput(out_buf, out_size, out_avail);
+    }
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CZipParallelCompressor::Flush(
+                      char* out_buf, size_t  out_size,
+                      /* out */      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    // Compress all buffered data, the current block is ended earlier
+    if ( !m_Finished  &&  m_Block  &&  !m_Block->m_Input.empty() ) {
+        if ( !x_SubmitBlock(false) ) {
+            return eStatus_Error;
+        }
+    }
+    if ( !x_CollectBlocks(true) ) {
+        return eStatus_Error;
+    }
+    x_WriteOutput(out_buf, out_size, out_avail);
+    return m_Output.empty() ? eStatus_Success : eStatus_Overflow;
+}
+
+
+CCompressionProcessor::EStatus CZipParallelCompressor::Finish(
+                      char* out_buf, size_t  out_size,
+                      /* out */      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    if ( !m_Finished ) {
+        // Default behavior on empty data -- don't write header/footer
+        if ( !GetProcessedSize()  &&  !F_ISSET(fAllowEmptyData) ) {
+            return eStatus_EndOfData;
+        }
+        if ( m_NeedWriteHeader  &&  m_Format == eFormat_GZip ) {
+            char header[kMaxHeaderSize];
+            size_t header_len = s_WriteGZipHeader(header, kMaxHeaderSize,
+                                                  &m_FileInfo);
+            m_Output.append(header, header_len);
+        }
+        m_NeedWriteHeader = false;
+
+        if (m_Format == eFormat_GZip  ||
+            (m_Block  &&  !m_Block->m_Input.empty())) {
+            if ( !x_SubmitBlock(true) ) {
+                return eStatus_Error;
+            }
+        }
+        if ( !x_CollectBlocks(true) ) {
+            return eStatus_Error;
+        }
+        if (m_Format == eFormat_GZip) {
+            char footer[8];
+            s_WriteGZipFooter(footer, sizeof(footer), GetProcessedSize(),
+                              m_CRC32);
+            m_Output.append(footer, sizeof(footer));
+        } else {
+            m_Output.append((const char*)s_BGZFEOF, sizeof(s_BGZFEOF));
+        }
+        m_Finished = true;
+    }
+    x_WriteOutput(out_buf, out_size, out_avail);
+    return m_Output.empty() ? eStatus_EndOfData : eStatus_Overflow;
+}
+
+
+CCompressionProcessor::EStatus CZipParallelCompressor::End(int /*abandon*/)
+{
+    x_CancelBlocks();
+    SetBusy(false);
+    return eStatus_Success;
+}
+
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // Global functions
@@ -0,0 +1,827 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  Random access to gzip and BGZF files
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <util/compress/zlib_index.hpp>
+#include <util/compress/zlib.hpp>
+#include <util/error_codes.hpp>
+#include <zlib.h>
+
+
+#define NCBI_USE_ERRCODE_X   Util_Compress
+
+BEGIN_NCBI_SCOPE
+
+
+// Get decompression stream pointer
+#define STREAM ((z_stream*)m_ZStream)
+
+// Size of deflate window
+const size_t kWindowSize = 32*1024;
+
+// Window bits for inflateInit2() to decode gzip member with its header
+const int kGZipWindowBits = 15 + 16;
+
+// Signature of the saved index
+const char kIndexSignature[] = "NCBIGZI1";
+const size_t kIndexSignatureLen = sizeof(kIndexSignature) - 1;
+
+
+// Check whether the data starts with gzip header with BGZF extra field
+static bool s_IsBGZFHeader(const unsigned char* buf, size_t len)
+{
+    return len >= 18  &&
+        buf[0] == 0x1f  &&  buf[1] == 0x8b  &&  buf[2] == Z_DEFLATED  &&
+        (buf[3] & 0x04) != 0  &&  buf[12] == 'B'  &&  buf[13] == 'C';
+}
+
+
+static void s_StoreUI8(CNcbiOstream& os, Uint8 value)
+{
+    unsigned char buf[8];
+    CCompressionUtil::StoreUI4(buf,     (unsigned long)(value & 0xFFFFFFFF));
+    CCompressionUtil::StoreUI4(buf + 4, (unsigned long)(value >> 32));
+    os.write((const char*)buf, sizeof(buf));
+}
+
+
+static Uint4 s_GetUI4(CNcbiIstream& is)
+{
+    unsigned char buf[4];
+    if ( !is.read((char*)buf, sizeof(buf)) ) {
+        NCBI_THROW(CCompressionException, eCompressionFile,
+                   "CZipIndex::Load: Unexpected end of index data");
+    }
+    return CCompressionUtil::GetUI4(buf);
+}
+
+
+static Uint8 s_GetUI8(CNcbiIstream& is)
+{
+    Uint8 low = s_GetUI4(is);
+    return low | (Uint8(s_GetUI4(is)) << 32);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZipIndex
+//
+
+const CZipIndex::TPosition CZipIndex::kDefaultSpan;
+
+
+CRef<CZipIndex> CZipIndex::Build(CNcbiIstream& is, TPosition span)
+{
+    CRef<CZipIndex> index(new CZipIndex());
+
+    size_t in_size = kCompressionDefaultBufSize;
+    AutoArray<unsigned char> in_buf(in_size);
+    AutoArray<unsigned char> window(kWindowSize);
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    int ret = inflateInit2(&strm, kGZipWindowBits); /* NCBI_FAKE_WARNING */
+    if (ret != Z_OK) {
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndex::Build: inflateInit2() failed: " +
+                   string(zError(ret)));
+    }
+    TPosition in_total   = 0;  // Offset in compressed data
+    TPosition out_total  = 0;  // Offset in uncompressed data
+    TPosition member_out = 0;  // Uncompressed data of the current member
+    TPosition last       = 0;  // Offset of the last access point
+    bool      member_start = true;
+    bool      first = true;
+
+    try {
+        for (;;) {
+            if (strm.avail_in == 0) {
+                is.read((char*)in_buf.get(), in_size);
+                size_t nread = (size_t)is.gcount();
+                if ( !nread ) {
+                    if ( !member_start ) {
+                        throw string("unexpected end of compressed data");
+                    }
+                    break;
+                }
+                strm.next_in  = in_buf.get();
+                strm.avail_in = (unsigned int)nread;
+                if ( first ) {
+                    index->m_IsBGZF = s_IsBGZFHeader(in_buf.get(), nread);
+                }
+            }
+            if ( member_start ) {
+                if (*strm.next_in != 0x1f) {
+                    // Trailing garbage (zero padding usually), ignore it
+                    // as gzip utility does
+                    if ( first ) {
+                        throw string("data is not in gzip format");
+                    }
+                    break;
+                }
+                // Start of gzip member doesn't need a window
+                if (first  ||  index->m_IsBGZF  ||  out_total - last >= span) {
+                    SPoint point;
+                    point.raw_pos  = in_total;
+                    point.data_pos = out_total;
+                    point.bits     = 0;
+                    point.member   = true;
+                    index->m_Points.push_back(point);
+                    last = out_total;
+                }
+                if ( !first ) {
+                    ret = inflateReset2(&strm, kGZipWindowBits);
+                    if (ret != Z_OK) {
+                        throw "inflateReset2() failed: " + string(zError(ret));
+                    }
+                }
+                first = false;
+                member_start = false;
+                member_out = 0;
+                strm.next_out  = window.get();
+                strm.avail_out = (unsigned int)kWindowSize;
+            }
+            // Decompress block by block, uncompressed data goes into
+            // the circular window buffer
+            do {
+                if (strm.avail_out == 0) {
+                    strm.next_out  = window.get();
+                    strm.avail_out = (unsigned int)kWindowSize;
+                }
+                unsigned int avail_in  = strm.avail_in;
+                unsigned int avail_out = strm.avail_out;
+                ret = inflate(&strm, Z_BLOCK);
+                in_total   += avail_in  - strm.avail_in;
+                out_total  += avail_out - strm.avail_out;
+                member_out += avail_out - strm.avail_out;
+                if (ret == Z_BUF_ERROR) {
+                    break;
+                }
+                if (ret != Z_OK  &&  ret != Z_STREAM_END) {
+                    throw "inflate() failed: " + string(zError(ret));
+                }
+                if (ret == Z_STREAM_END) {
+                    member_start = true;
+                    break;
+                }
+                // At the end of deflate block, except the last one
+                if ((strm.data_type & 128) != 0  &&
+                    (strm.data_type & 64)  == 0  &&
+                    !index->m_IsBGZF  &&  member_out != 0  &&
+                    out_total - last >= span) {
+                    SPoint point;
+                    point.raw_pos  = in_total;
+                    point.data_pos = out_total;
+                    point.bits     = strm.data_type & 7;
+                    point.member   = false;
+                    size_t have = (size_t)min(member_out, TPosition(kWindowSize));
+                    size_t end  = kWindowSize - strm.avail_out;
+                    const char* win = (const char*)window.get();
+                    if (have <= end) {
+                        point.window.assign(win + end - have, have);
+                    } else {
+                        point.window.assign(win + kWindowSize - (have - end),
+                                            have - end);
+                        point.window.append(win, end);
+                    }
+                    index->m_Points.push_back(point);
+                    last = out_total;
+                }
+            } while (strm.avail_in != 0);
+        }
+    }
+    catch (string& e) {
+        inflateEnd(&strm);
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndex::Build: " + e);
+    }
+    inflateEnd(&strm);
+    index->m_DataSize = out_total;
+    return index;
+}
+
+
+void CZipIndex::Save(CNcbiOstream& os) const
+{
+    os.write(kIndexSignature, kIndexSignatureLen);
+    unsigned char buf[4];
+    CCompressionUtil::StoreUI4(buf, m_IsBGZF ? 1 : 0);
+    os.write((const char*)buf, sizeof(buf));
+    s_StoreUI8(os, m_DataSize);
+    CCompressionUtil::StoreUI4(buf, (unsigned long)m_Points.size());
+    os.write((const char*)buf, sizeof(buf));
+
+    CZipCompression zip;
+    string compressed;
+    ITERATE(TPoints, it, m_Points) {
+        s_StoreUI8(os, it->raw_pos);
+        s_StoreUI8(os, it->data_pos);
+        buf[0] = (unsigned char)it->bits;
+        buf[1] = it->member ? 1 : 0;
+        os.write((const char*)buf, 2);
+        CCompressionUtil::StoreUI4(buf, (unsigned long)it->window.size());
+        os.write((const char*)buf, sizeof(buf));
+        size_t len = 0;
+        if ( !it->window.empty() ) {
+            compressed.resize(
+                (size_t)zip.EstimateCompressionBufferSize(it->window.size()));
+            if ( !zip.CompressBuffer(it->window.data(), it->window.size(),
+                                     &compressed[0], compressed.size(),
+                                     &len) ) {
+                NCBI_THROW(CCompressionException, eCompression,
+                           "CZipIndex::Save: Cannot compress window: " +
+                           zip.GetErrorDescription());
+            }
+        }
+        CCompressionUtil::StoreUI4(buf, (unsigned long)len);
+        os.write((const char*)buf, sizeof(buf));
+        os.write(compressed.data(), len);
+    }
+    if ( !os ) {
+        NCBI_THROW(CCompressionException, eCompressionFile,
+                   "CZipIndex::Save: Cannot write index");
+    }
+}
+
+
+CRef<CZipIndex> CZipIndex::Load(CNcbiIstream& is)
+{
+    char signature[kIndexSignatureLen];
+    if ( !is.read(signature, kIndexSignatureLen)  ||
+         memcmp(signature, kIndexSignature, kIndexSignatureLen) != 0 ) {
+        NCBI_THROW(CCompressionException, eCompressionFile,
+                   "CZipIndex::Load: Data is not a gzip index");
+    }
+    CRef<CZipIndex> index(new CZipIndex());
+    index->m_IsBGZF   = (s_GetUI4(is) & 1) != 0;
+    index->m_DataSize = s_GetUI8(is);
+    size_t count = s_GetUI4(is);
+
+    CZipCompression zip;
+    string compressed;
+    index->m_Points.resize(count);
+    NON_CONST_ITERATE(TPoints, it, index->m_Points) {
+        it->raw_pos  = s_GetUI8(is);
+        it->data_pos = s_GetUI8(is);
+        char flags[2];
+        if ( !is.read(flags, 2) ) {
+            NCBI_THROW(CCompressionException, eCompressionFile,
+                       "CZipIndex::Load: Unexpected end of index data");
+        }
+        it->bits   = flags[0] & 7;
+        it->member = flags[1] != 0;
+        size_t window_len = s_GetUI4(is);
+        size_t len = s_GetUI4(is);
+        if (window_len > kWindowSize) {
+            NCBI_THROW(CCompressionException, eCompressionFile,
+                       "CZipIndex::Load: Bad window size");
+        }
+        compressed.resize(len);
+        if (len  &&  !is.read(&compressed[0], len)) {
+            NCBI_THROW(CCompressionException, eCompressionFile,
+                       "CZipIndex::Load: Unexpected end of index data");
+        }
+        it->window.resize(window_len);
+        size_t out_len = 0;
+        if (window_len  &&
+            (!zip.DecompressBuffer(compressed.data(), len,
+                                   &it->window[0], window_len, &out_len)  ||
+             out_len != window_len)) {
+            NCBI_THROW(CCompressionException, eCompressionFile,
+                       "CZipIndex::Load: Cannot decompress window");
+        }
+    }
+    return index;
+}
+
+
+struct SPointDataLess
+{
+    bool operator()(CZipIndex::TPosition pos,
+                    const CZipIndex::SPoint& point) const
+    {
+        return pos < point.data_pos;
+    }
+};
+
+
+struct SPointRawLess
+{
+    bool operator()(const CZipIndex::SPoint& point,
+                    CZipIndex::TPosition pos) const
+    {
+        return point.raw_pos < pos;
+    }
+};
+
+
+const CZipIndex::SPoint& CZipIndex::FindPoint(TPosition data_pos) const
+{
+    _ASSERT( !m_Points.empty() );
+    TPoints::const_iterator it = upper_bound(m_Points.begin(), m_Points.end(),
+                                             data_pos, SPointDataLess());
+    if (it != m_Points.begin()) {
+        --it;
+    }
+    return *it;
+}
+
+
+const CZipIndex::SPoint* CZipIndex::FindMember(TPosition raw_pos) const
+{
+    TPoints::const_iterator it = lower_bound(m_Points.begin(), m_Points.end(),
+                                             raw_pos, SPointRawLess());
+    if (it == m_Points.end()  ||  it->raw_pos != raw_pos  ||  !it->member) {
+        return 0;
+    }
+    return &*it;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZipIndexedReader
+//
+
+const CZipIndexedReader::TPosition CZipIndexedReader::kUnknownPos;
+
+
+CZipIndexedReader::CZipIndexedReader(CNcbiIstream& is, const CZipIndex* index)
+    : m_Stream(is), m_Index(index), m_IsBGZF(false),
+      m_ZStream(new z_stream), m_Initialized(false), m_Raw(false),
+      m_MemberEnd(false), m_EOF(false),
+      m_InBuf(kCompressionDefaultBufSize), m_InBufPos(0), m_InBufLen(0),
+      m_DataPos(0), m_MemberRawPos(0), m_MemberOffset(0)
+{
+    memset(STREAM, 0, sizeof(z_stream));
+    if ( index ) {
+        m_IsBGZF = index->IsBGZF();
+    } else {
+        // Check the header of the first member
+        unsigned char header[18];
+        m_Stream.read((char*)header, sizeof(header));
+        m_IsBGZF = s_IsBGZFHeader(header, (size_t)m_Stream.gcount());
+        m_Stream.clear();
+        m_Stream.seekg(0);
+    }
+}
+
+
+CZipIndexedReader::~CZipIndexedReader(void)
+{
+    x_End();
+    delete STREAM;
+}
+
+
+void CZipIndexedReader::x_End(void)
+{
+    if ( m_Initialized ) {
+        inflateEnd(STREAM);
+        m_Initialized = false;
+    }
+}
+
+
+bool CZipIndexedReader::x_FillInput(void)
+{
+    if (STREAM->avail_in != 0) {
+        return true;
+    }
+    m_InBufPos += m_InBufLen;
+    m_Stream.read((char*)m_InBuf.get(), kCompressionDefaultBufSize);
+    m_InBufLen = (size_t)m_Stream.gcount();
+    STREAM->next_in  = m_InBuf.get();
+    STREAM->avail_in = (unsigned int)m_InBufLen;
+    return m_InBufLen != 0;
+}
+
+
+void CZipIndexedReader::x_Start(TPosition raw_pos, int bits,
+                                const string* window, TPosition skip)
+{
+    x_End();
+    m_EOF = false;
+    m_MemberEnd = false;
+
+    TPosition pos = raw_pos - (bits ? 1 : 0);
+    m_Stream.clear();
+    if ( !m_Stream.seekg(NcbiInt8ToStreampos(pos)) ) {
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndexedReader: Cannot seek in compressed data");
+    }
+    memset(STREAM, 0, sizeof(z_stream));
+    m_InBufPos = pos;
+    m_InBufLen = 0;
+
+    int ret;
+    if ( window ) {
+        // Inside of gzip member
+        ret = inflateInit2(STREAM, -MAX_WBITS); /* NCBI_FAKE_WARNING */
+        m_Raw = true;
+        m_MemberRawPos = kUnknownPos;
+    } else {
+        ret = inflateInit2(STREAM, kGZipWindowBits); /* NCBI_FAKE_WARNING */
+        m_Raw = false;
+        m_MemberRawPos = raw_pos;
+    }
+    if (ret != Z_OK) {
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndexedReader: inflateInit2() failed: " +
+                   string(zError(ret)));
+    }
+    m_Initialized = true;
+    m_MemberOffset = 0;
+
+    if ( bits ) {
+        // Part of the block starts in the previous byte
+        if ( !x_FillInput() ) {
+            NCBI_THROW(CCompressionException, eCompression,
+                       "CZipIndexedReader: Unexpected end of compressed data");
+        }
+        int value = *STREAM->next_in++;
+        --STREAM->avail_in;
+        ret = inflatePrime(STREAM, bits, value >> (8 - bits));
+    }
+    if (window  &&  ret == Z_OK  &&  !window->empty()) {
+        ret = inflateSetDictionary(STREAM, (const Bytef*)window->data(),
+                                   (uInt)window->size());
+    }
+    if (ret != Z_OK) {
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndexedReader: Cannot start decompression: " +
+                   string(zError(ret)));
+    }
+    x_Skip(skip);
+}
+
+
+void CZipIndexedReader::x_Skip(TPosition count)
+{
+    char buf[4096];
+    while (count) {
+        size_t n = 0;
+        ERW_Result result =
+            x_Inflate(buf, (size_t)min(count, TPosition(sizeof(buf))), &n);
+        if ( !n ) {
+            NCBI_THROW(CCompressionException, eCompression,
+                       result == eRW_Eof ?
+                       "CZipIndexedReader: Position is beyond end of data" :
+                       "CZipIndexedReader: Cannot decompress data");
+        }
+        count -= n;
+    }
+}
+
+
+ERW_Result CZipIndexedReader::x_NextMember(void)
+{
+    if ( m_Raw ) {
+        // Skip gzip footer, it's not processed by raw inflate
+        for (size_t skip = 8;  skip; ) {
+            if ( !x_FillInput() ) {
+                ERR_COMPRESS(88, "CZipIndexedReader: "
+                                 "Unexpected end of compressed data");
+                return eRW_Error;
+            }
+            size_t n = min(skip, (size_t)STREAM->avail_in);
+            STREAM->next_in  += n;
+            STREAM->avail_in -= (unsigned int)n;
+            skip -= n;
+        }
+    }
+    // Trailing garbage (zero padding usually) is ignored, as gzip does
+    if ( !x_FillInput()  ||  *STREAM->next_in != 0x1f ) {
+        m_EOF = true;
+        return eRW_Eof;
+    }
+    int ret = m_Raw ? inflateReset2(STREAM, kGZipWindowBits)
+                    : inflateReset(STREAM);
+    if (ret != Z_OK) {
+        ERR_COMPRESS(89, "CZipIndexedReader: inflateReset() failed: "
+                         << zError(ret));
+        return eRW_Error;
+    }
+    m_Raw = false;
+    m_MemberEnd = false;
+    m_MemberRawPos = m_InBufPos + (STREAM->next_in - m_InBuf.get());
+    m_MemberOffset = 0;
+    return eRW_Success;
+}
+
+
+ERW_Result CZipIndexedReader::x_Inflate(void* buf, size_t count,
+                                        size_t* bytes_read)
+{
+    *bytes_read = 0;
+    if (count > kMax_UInt) {
+        count = kMax_UInt;
+    }
+    if ( !m_Initialized  &&  !m_EOF ) {
+        x_Start(0, 0, 0, 0);
+    }
+    while ( !*bytes_read ) {
+        if ( m_EOF ) {
+            return eRW_Eof;
+        }
+        if ( m_MemberEnd ) {
+            ERW_Result result = x_NextMember();
+            if (result != eRW_Success) {
+                return result;
+            }
+        }
+        bool have_input = x_FillInput();
+        STREAM->next_out  = (Bytef*)buf;
+        STREAM->avail_out = (unsigned int)count;
+        int ret = inflate(STREAM, Z_NO_FLUSH);
+        size_t n = count - STREAM->avail_out;
+        *bytes_read = n;
+        if (m_DataPos != kUnknownPos) {
+            m_DataPos += n;
+        }
+        m_MemberOffset += n;
+
+        if (ret == Z_STREAM_END) {
+            // Next member is started by the next call only, so data
+            // of one call is always from the same member
+            m_MemberEnd = true;
+        } else if (ret == Z_BUF_ERROR) {
+            if ( !n  &&  !have_input ) {
+                ERR_COMPRESS(88, "CZipIndexedReader: "
+                                 "Unexpected end of compressed data");
+                return eRW_Error;
+            }
+        } else if (ret != Z_OK) {
+            ERR_COMPRESS(90, "CZipIndexedReader: inflate() failed: "
+                             << zError(ret));
+            return eRW_Error;
+        }
+    }
+    return eRW_Success;
+}
+
+
+ERW_Result CZipIndexedReader::Read(void* buf, size_t count, size_t* bytes_read)
+{
+    size_t n = 0;
+    ERW_Result result = count ? x_Inflate(buf, count, &n) : eRW_Success;
+    if ( bytes_read ) {
+        *bytes_read = n;
+    }
+    return n ? eRW_Success : result;
+}
+
+
+ERW_Result CZipIndexedReader::PendingCount(size_t* /*count*/)
+{
+    return eRW_NotImplemented;
+}
+
+
+void CZipIndexedReader::Seek(TPosition data_pos)
+{
+    if ( !m_Index ) {
+        // Without index it is possible to rewind or to skip forward only
+        if (data_pos == 0) {
+            m_DataPos = 0;
+            x_Start(0, 0, 0, 0);
+        } else if (m_DataPos != kUnknownPos  &&  m_DataPos <= data_pos) {
+            x_Skip(data_pos - m_DataPos);
+        } else {
+            NCBI_THROW(CCompressionException, eCompression,
+                       "CZipIndexedReader::Seek: Index is required "
+                       "for seeking backward");
+        }
+        return;
+    }
+    if (data_pos > m_Index->GetDataSize()) {
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndexedReader::Seek: Position is beyond end of data");
+    }
+    const CZipIndex::SPoint& point = m_Index->FindPoint(data_pos);
+    if (m_Initialized  &&  !m_EOF  &&  m_DataPos != kUnknownPos  &&
+        m_DataPos <= data_pos  &&  point.data_pos <= m_DataPos) {
+        // No access point between the current position and the target one
+        x_Skip(data_pos - m_DataPos);
+        return;
+    }
+    m_DataPos = point.data_pos;
+    x_Start(point.raw_pos, point.bits, point.member ? 0 : &point.window,
+            data_pos - point.data_pos);
+}
+
+
+Uint8 CZipIndexedReader::GetVirtualOffset(void) const
+{
+    if ( !m_IsBGZF ) {
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndexedReader: Virtual offsets need BGZF data");
+    }
+    if ( !m_Initialized  &&  !m_EOF ) {
+        // Nothing is read yet
+        return 0;
+    }
+    _ASSERT(m_MemberRawPos != kUnknownPos);
+    return (m_MemberRawPos << 16) | m_MemberOffset;
+}
+
+
+void CZipIndexedReader::SeekVirtualOffset(Uint8 offset)
+{
+    if ( !m_IsBGZF ) {
+        NCBI_THROW(CCompressionException, eCompression,
+                   "CZipIndexedReader: Virtual offsets need BGZF data");
+    }
+    TPosition raw_pos = offset >> 16;
+    const CZipIndex::SPoint* point =
+        m_Index ? m_Index->FindMember(raw_pos) : 0;
+    m_DataPos = point ? point->data_pos : kUnknownPos;
+    x_Start(raw_pos, 0, 0, offset & 0xFFFF);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZipIndexedStreambuf
+//
+
+class CZipIndexedStreambuf : public CNcbiStreambuf
+{
+public:
+    CZipIndexedStreambuf(CZipIndexedReader& reader)
+        : m_Reader(reader), m_Buf(kCompressionDefaultBufSize)
+    {
+        setg(m_Buf.get(), m_Buf.get(), m_Buf.get());
+    }
+
+    Uint8 GetVirtualOffset(void)
+    {
+        // Buffer never contains data of several members
+        return m_Reader.GetVirtualOffset() - (egptr() - gptr());
+    }
+
+    void SeekVirtualOffset(Uint8 offset)
+    {
+        setg(m_Buf.get(), m_Buf.get(), m_Buf.get());
+        m_Reader.SeekVirtualOffset(offset);
+    }
+
+protected:
+    virtual CT_INT_TYPE underflow(void);
+    virtual CT_POS_TYPE seekoff(CT_OFF_TYPE off, IOS_BASE::seekdir whence,
+                                IOS_BASE::openmode which =
+                                IOS_BASE::in | IOS_BASE::out);
+    virtual CT_POS_TYPE seekpos(CT_POS_TYPE pos,
+                                IOS_BASE::openmode which =
+                                IOS_BASE::in | IOS_BASE::out);
+
+private:
+    CZipIndexedReader&   m_Reader;
+    AutoArray<CT_CHAR_TYPE> m_Buf;
+};
+
+
+CT_INT_TYPE CZipIndexedStreambuf::underflow(void)
+{
+    if (gptr() < egptr()) {
+        return CT_TO_INT_TYPE(*gptr());
+    }
+    size_t n = 0;
+    m_Reader.Read(m_Buf.get(), kCompressionDefaultBufSize, &n);
+    if ( !n ) {
+        return CT_EOF;
+    }
+    setg(m_Buf.get(), m_Buf.get(), m_Buf.get() + n);
+    return CT_TO_INT_TYPE(*gptr());
+}
+
+
+CT_POS_TYPE CZipIndexedStreambuf::seekoff(CT_OFF_TYPE off,
+                                          IOS_BASE::seekdir whence,
+                                          IOS_BASE::openmode which)
+{
+    const CT_POS_TYPE kFailed = (CT_POS_TYPE)((CT_OFF_TYPE)(-1L));
+    if ( !(which & IOS_BASE::in) ) {
+        return kFailed;
+    }
+    // Position is unknown after SeekVirtualOffset() without index
+    CZipIndexedReader::TPosition pos = m_Reader.GetPosition();
+    bool  known = (pos != CZipIndexedReader::kUnknownPos);
+    Int8  cur   = known ? Int8(pos) - (egptr() - gptr()) : -1;
+    Int8  target;
+    switch (whence) {
+    case IOS_BASE::beg:
+        target = off;
+        break;
+    case IOS_BASE::cur:
+        if ( !known ) {
+            return kFailed;
+        }
+        target = cur + off;
+        break;
+    case IOS_BASE::end:
+        if ( !m_Reader.GetIndex() ) {
+            return kFailed;
+        }
+        target = Int8(m_Reader.GetIndex()->GetDataSize()) + off;
+        break;
+    default:
+        return kFailed;
+    }
+    if ( known ) {
+        Int8 buf_start = Int8(pos) - (egptr() - eback());
+        if (target >= buf_start  &&  target <= Int8(pos)) {
+            // Inside of the buffer
+            setg(eback(), eback() + (size_t)(target - buf_start), egptr());
+            return NcbiInt8ToStreampos(target);
+        }
+    }
+    if (target < 0) {
+        return kFailed;
+    }
+    try {
+        setg(m_Buf.get(), m_Buf.get(), m_Buf.get());
+        m_Reader.Seek(CZipIndexedReader::TPosition(target));
+    }
+    catch (CException& e) {
+        ERR_COMPRESS(91, e.GetMsg());
+        return kFailed;
+    }
+    return NcbiInt8ToStreampos(target);
+}
+
+
+CT_POS_TYPE CZipIndexedStreambuf::seekpos(CT_POS_TYPE pos,
+                                          IOS_BASE::openmode which)
+{
+    return seekoff(NcbiStreamposToInt8(pos), IOS_BASE::beg, which);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZipIndexedIStream
+//
+
+CZipIndexedIStream::CZipIndexedIStream(CNcbiIstream& is,
+                                       const CZipIndex* index)
+    : CNcbiIstream(0),
+      m_Reader(is, index),
+      m_Sb(new CZipIndexedStreambuf(m_Reader))
+{
+    init(m_Sb.get());
+}
+
+
+CZipIndexedIStream::~CZipIndexedIStream(void)
+{
+}
+
+
+Uint8 CZipIndexedIStream::GetVirtualOffset(void)
+{
+    return m_Sb->GetVirtualOffset();
+}
+
+
+void CZipIndexedIStream::SeekVirtualOffset(Uint8 offset)
+{
+    clear();
+    m_Sb->SeekVirtualOffset(offset);
+}
+
+
+END_NCBI_SCOPE
@@ -0,0 +1,838 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  Zstandard Compression API
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbi_limits.h>
+#include <util/compress/zstd.hpp>
+#include <util/error_codes.hpp>
+
+#define NCBI_USE_ERRCODE_X   Util_Compress
+
+#if defined(HAVE_LIBZSTD)
+
+#include <zstd.h>
+
+BEGIN_NCBI_SCOPE
+
+
+// Macro to check flags
+#define F_ISSET(mask) ((GetFlags() & (mask)) == (mask))
+
+// Get compression/decompression context pointers
+#define CCTX ((ZSTD_CCtx*)m_CCtx)
+#define DCTX ((ZSTD_DCtx*)m_DCtx)
+
+// Convert 'size_t' to 'long' which used in CCompressionFile API
+#define LIMIT_SIZE_PARAM(value) if (value > (size_t)kMax_Int) value = kMax_Int
+
+
+/// Size of magic signature.
+const size_t kMagicSize = 4;
+
+
+/// Check that the data starts with zstd frame or skippable frame.
+static bool s_IsZstdFrame(const void* buf, size_t len)
+{
+    if (len < kMagicSize) {
+        return false;
+    }
+    unsigned long magic = CCompressionUtil::GetUI4(buf);
+    return magic == ZSTD_MAGICNUMBER  ||
+           (magic & 0xFFFFFFF0) == 0x184D2A50 /* skippable frame */;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZstdCompression
+//
+
+
+CZstdCompression::CZstdCompression(ELevel level)
+    : CCompression(level), m_CCtx(0), m_DCtx(0)
+{
+    return;
+}
+
+
+CZstdCompression::~CZstdCompression(void)
+{
+    if ( m_CCtx ) {
+        ZSTD_freeCCtx(CCTX);
+    }
+    if ( m_DCtx ) {
+        ZSTD_freeDCtx(DCTX);
+    }
+    return;
+}
+
+
+CVersionInfo CZstdCompression::GetVersion(void) const
+{
+    return CVersionInfo(ZSTD_versionString(), "zstd");
+}
+
+
+CCompression::ELevel CZstdCompression::GetLevel(void) const
+{
+    CCompression::ELevel level = CCompression::GetLevel();
+    // zstd do not support a zero compression level -- make conversion
+    if ( level == eLevel_NoCompression) {
+        return eLevel_Lowest;
+    }
+    return level;
+}
+
+
+int CZstdCompression::GetZstdLevel(void) const
+{
+    // zstd has levels 1..19 for regular use (and slow "ultra" levels
+    // up to 22), 3 is the default one. Map our levels on regular ones.
+    static const int kLevels[] = {
+        1,  // eLevel_NoCompression (never used)
+        1,  // eLevel_Lowest
+        2,  // eLevel_VeryLow
+        3,  // eLevel_Low
+        4,  // eLevel_MediumLow
+        6,  // eLevel_Medium
+        9,  // eLevel_MediumHigh
+        12, // eLevel_High
+        16, // eLevel_VeryHigh
+        19  // eLevel_Best
+    };
+    int level = GetLevel();
+    if (level < 0  ||  level >= (int)(sizeof(kLevels)/sizeof(kLevels[0]))) {
+        return 3;
+    }
+    return kLevels[level];
+}
+
+
+size_t CZstdCompression::SetCompressionParameters(void)
+{
+    if ( !m_CCtx ) {
+        m_CCtx = ZSTD_createCCtx();
+        if ( !m_CCtx ) {
+            SetError(-1, "Cannot create compression context");
+            return (size_t)(-1);
+        }
+    }
+    size_t errcode = ZSTD_CCtx_reset(CCTX, ZSTD_reset_session_and_parameters);
+    if ( !ZSTD_isError(errcode) ) {
+        errcode = ZSTD_CCtx_setParameter(CCTX, ZSTD_c_compressionLevel,
+                                         GetZstdLevel());
+    }
+    if ( !ZSTD_isError(errcode) ) {
+        errcode = ZSTD_CCtx_setParameter(CCTX, ZSTD_c_checksumFlag,
+                                         F_ISSET(fChecksum) ? 1 : 0);
+    }
+    SetZstdError(errcode);
+    return errcode;
+}
+
+
+void CZstdCompression::SetZstdError(size_t errcode)
+{
+    if ( ZSTD_isError(errcode) ) {
+        // zstd error codes are negative numbers converted to size_t
+        SetError((int)errcode, ZSTD_getErrorName(errcode));
+    } else {
+        SetError(0);
+    }
+}
+
+
+size_t CZstdCompression::EstimateCompressionBufferSize(size_t src_len)
+{
+    return ZSTD_compressBound(src_len);
+}
+
+
+bool CZstdCompression::CompressBuffer(
+                       const void* src_buf, size_t  src_len,
+                       void*       dst_buf, size_t  dst_size,
+                       /* out */            size_t* dst_len)
+{
+    *dst_len = 0;
+
+    // Check parameters
+    if ( !src_len ) {
+        if ( !F_ISSET(fAllowEmptyData) ) {
+            src_buf = NULL;
+        }
+    }
+    if ( !src_buf  ||  !dst_buf  ||  !dst_len ) {
+        SetError(-1, "bad argument");
+        ERR_COMPRESS(95, FormatErrorMessage("CZstdCompression::CompressBuffer"));
+        return false;
+    }
+    if ( ZSTD_isError(SetCompressionParameters()) ) {
+        ERR_COMPRESS(96, FormatErrorMessage("CZstdCompression::CompressBuffer"));
+        return false;
+    }
+    size_t n = ZSTD_compress2(CCTX, dst_buf, dst_size, src_buf, src_len);
+    SetZstdError(n);
+    if ( ZSTD_isError(n) ) {
+        ERR_COMPRESS(96, FormatErrorMessage("CZstdCompression::CompressBuffer"));
+        return false;
+    }
+    *dst_len = n;
+    return true;
+}
+
+
+bool CZstdCompression::DecompressBuffer(
+                       const void* src_buf, size_t  src_len,
+                       void*       dst_buf, size_t  dst_size,
+                       /* out */            size_t* dst_len)
+{
+    *dst_len = 0;
+
+    // Check parameters
+    if ( !src_len ) {
+        if ( F_ISSET(fAllowEmptyData) ) {
+            SetError(0);
+            return true;
+        }
+        src_buf = NULL;
+    }
+    if ( !src_buf  ||  !dst_buf  ||  !dst_len ) {
+        SetError(-1, "bad argument");
+        ERR_COMPRESS(97, FormatErrorMessage("CZstdCompression::DecompressBuffer"));
+        return false;
+    }
+    // Data is not compressed, but transparent read is allowed
+    if ( !s_IsZstdFrame(src_buf, src_len)  &&  F_ISSET(fAllowTransparentRead) ) {
+        *dst_len = (dst_size < src_len) ? dst_size : src_len;
+        memcpy(dst_buf, src_buf, *dst_len);
+        return (dst_size >= src_len);
+    }
+    if ( !m_DCtx ) {
+        m_DCtx = ZSTD_createDCtx();
+        if ( !m_DCtx ) {
+            SetError(-1, "Cannot create decompression context");
+            ERR_COMPRESS(98, FormatErrorMessage("CZstdCompression::DecompressBuffer"));
+            return false;
+        }
+    }
+    // Decompress all frames
+    size_t n = ZSTD_decompressDCtx(DCTX, dst_buf, dst_size, src_buf, src_len);
+    SetZstdError(n);
+    if ( ZSTD_isError(n) ) {
+        ERR_COMPRESS(98, FormatErrorMessage("CZstdCompression::DecompressBuffer"));
+        return false;
+    }
+    *dst_len = n;
+    return true;
+}
+
+
+bool CZstdCompression::CompressFile(const string& src_file,
+                                    const string& dst_file,
+                                    size_t        buf_size)
+{
+    CZstdCompressionFile cf(GetLevel());
+    cf.SetFlags(cf.GetFlags() | GetFlags());
+
+    // Open output file
+    if ( !cf.Open(dst_file, CCompressionFile::eMode_Write) ) {
+        SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        return false;
+    }
+    // Make compression
+    if ( !CCompression::x_CompressFile(src_file, cf, buf_size) ) {
+        if ( cf.GetErrorCode() ) {
+            SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        }
+        cf.Close();
+        return false;
+    }
+    // Close output file and return result
+    bool status = cf.Close();
+    SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+    return status;
+}
+
+
+bool CZstdCompression::DecompressFile(const string& src_file,
+                                      const string& dst_file,
+                                      size_t        buf_size)
+{
+    CZstdCompressionFile cf(GetLevel());
+    cf.SetFlags(cf.GetFlags() | GetFlags());
+
+    // Open output file
+    if ( !cf.Open(src_file, CCompressionFile::eMode_Read) ) {
+        SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        return false;
+    }
+    // Make decompression
+    if ( !CCompression::x_DecompressFile(cf, dst_file, buf_size) ) {
+        if ( cf.GetErrorCode() ) {
+            SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+        }
+        cf.Close();
+        return false;
+    }
+    // Close output file and return result
+    bool status = cf.Close();
+    SetError(cf.GetErrorCode(), cf.GetErrorDescription());
+    return status;
+}
+
+
+string CZstdCompression::FormatErrorMessage(string where) const
+{
+    string str = "[" + where + "]  " + GetErrorDescription();
+    return str + ".";
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZstdCompressionFile
+//
+
+
+CZstdCompressionFile::CZstdCompressionFile(
+    const string& file_name, EMode mode, ELevel level)
+    : CZstdCompression(level),
+      m_Mode(eMode_Read), m_File(0), m_Stream(0)
+{
+    if ( !Open(file_name, mode) ) {
+        const string smode = (mode == eMode_Read) ? "reading" : "writing";
+        NCBI_THROW(CCompressionException, eCompressionFile,
+                   "[CZstdCompressionFile]  Cannot open file '" + file_name +
+                   "' for " + smode + ".");
+    }
+    return;
+}
+
+
+CZstdCompressionFile::CZstdCompressionFile(ELevel level)
+    : CZstdCompression(level),
+      m_Mode(eMode_Read), m_File(0), m_Stream(0)
+{
+    return;
+}
+
+
+CZstdCompressionFile::~CZstdCompressionFile(void)
+{
+    try {
+        Close();
+    }
+    COMPRESS_HANDLE_EXCEPTIONS(99, "CZstdCompressionFile::~CZstdCompressionFile");
+    return;
+}
+
+
+void CZstdCompressionFile::GetStreamError(void)
+{
+    int     errcode;
+    string  errdesc;
+    m_Stream->GetError(CCompressionStream::eRead, errcode, errdesc);
+    SetError(errcode, errdesc);
+}
+
+
+bool CZstdCompressionFile::Open(const string& file_name, EMode mode)
+{
+    m_Mode = mode;
+
+    // Open a file
+    if ( mode == eMode_Read ) {
+        m_File = new CNcbiFstream(file_name.c_str(),
+                                  IOS_BASE::in | IOS_BASE::binary);
+    } else {
+        m_File = new CNcbiFstream(file_name.c_str(),
+                                  IOS_BASE::out | IOS_BASE::binary |
+                                  IOS_BASE::trunc);
+    }
+    if ( !m_File->good() ) {
+        Close();
+        string description = string("Cannot open file '") + file_name + "'";
+        SetError(-1, description.c_str());
+        return false;
+    }
+
+    // Create compression stream for I/O
+    if ( mode == eMode_Read ) {
+        CCompressionStreamProcessor* processor =
+            new CCompressionStreamProcessor(
+                new CZstdDecompressor(GetFlags()),
+                CCompressionStreamProcessor::eDelete,
+                kCompressionDefaultBufSize, kCompressionDefaultBufSize);
+        m_Stream =
+            new CCompressionIOStream(
+                *m_File, processor, 0, CCompressionStream::fOwnReader);
+    } else {
+        CCompressionStreamProcessor* processor =
+            new CCompressionStreamProcessor(
+                new CZstdCompressor(GetLevel(), GetFlags()),
+                CCompressionStreamProcessor::eDelete,
+                kCompressionDefaultBufSize, kCompressionDefaultBufSize);
+        m_Stream =
+            new CCompressionIOStream(
+                *m_File, 0, processor, CCompressionStream::fOwnWriter);
+    }
+    if ( !m_Stream->good() ) {
+        Close();
+        SetError(-1, "Cannot create compression stream");
+        return false;
+    }
+    return true;
+}
+
+
+long CZstdCompressionFile::Read(void* buf, size_t len)
+{
+    LIMIT_SIZE_PARAM(len);
+
+    if ( !m_Stream  ||  m_Mode != eMode_Read ) {
+        NCBI_THROW(CCompressionException, eCompressionFile,
+            "[CZstdCompressionFile::Read]  File must be opened for reading");
+    }
+    if ( !m_Stream->good() ) {
+        return 0;
+    }
+    m_Stream->read((char*)buf, len);
+    // Check decompression processor status
+    if ( m_Stream->GetStatus(CCompressionStream::eRead)
+         == CCompressionProcessor::eStatus_Error ) {
+        GetStreamError();
+        return -1;
+    }
+    long nread = (long)m_Stream->gcount();
+    if ( nread ) {
+        return nread;
+    }
+    if ( m_Stream->eof() ) {
+        return 0;
+    }
+    GetStreamError();
+    return -1;
+}
+
+
+long CZstdCompressionFile::Write(const void* buf, size_t len)
+{
+    if ( !m_Stream  ||  m_Mode != eMode_Write ) {
+        NCBI_THROW(CCompressionException, eCompressionFile,
+            "[CZstdCompressionFile::Write]  File must be opened for writing");
+    }
+    // Redefine standard behaviour for case of writing zero bytes
+    if (len == 0) {
+        return 0;
+    }
+    LIMIT_SIZE_PARAM(len);
+
+    m_Stream->write((char*)buf, len);
+    if ( m_Stream->good() ) {
+        return (long)len;
+    }
+    GetStreamError();
+    return -1;
+}
+
+
+bool CZstdCompressionFile::Close(void)
+{
+    // Close compression/decompression stream
+    if ( m_Stream ) {
+        m_Stream->Finalize();
+        GetStreamError();
+        delete m_Stream;
+        m_Stream = 0;
+    }
+    // Close file stream
+    if ( m_File ) {
+        m_File->close();
+        delete m_File;
+        m_File = 0;
+    }
+    return true;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZstdCompressor
+//
+
+
+CZstdCompressor::CZstdCompressor(ELevel level, TZstdFlags flags)
+    : CZstdCompression(level)
+{
+    SetFlags(flags);
+}
+
+
+CZstdCompressor::~CZstdCompressor()
+{
+    if ( IsBusy() ) {
+        // Abnormal session termination
+        End();
+    }
+}
+
+
+CCompressionProcessor::EStatus CZstdCompressor::Init(void)
+{
+    if ( IsBusy() ) {
+        // Abnormal previous session termination
+        End();
+    }
+    // Initialize members
+    Reset();
+    SetBusy();
+    // Start new frame with current parameters
+    if ( ZSTD_isError(SetCompressionParameters()) ) {
+        ERR_COMPRESS(100, FormatErrorMessage("CZstdCompressor::Init"));
+        return eStatus_Error;
+    }
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CZstdCompressor::Process(
+                      const char* in_buf,  size_t  in_len,
+                      char*       out_buf, size_t  out_size,
+                      /* out */            size_t* in_avail,
+                      /* out */            size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    ZSTD_inBuffer  in  = { in_buf,  in_len,   0 };
+    ZSTD_outBuffer out = { out_buf, out_size, 0 };
+
+    size_t errcode = ZSTD_compressStream2(CCTX, &out, &in, ZSTD_e_continue);
+    SetZstdError(errcode);
+    *in_avail  = in_len - in.pos;
+    *out_avail = out.pos;
+    IncreaseProcessedSize((unsigned long)in.pos);
+    IncreaseOutputSize((unsigned long)out.pos);
+
+    if ( !ZSTD_isError(errcode) ) {
+        return eStatus_Success;
+    }
+    ERR_COMPRESS(101, FormatErrorMessage("CZstdCompressor::Process"));
+    return eStatus_Error;
+}
+
+
+CCompressionProcessor::EStatus CZstdCompressor::Flush(
+                      char* out_buf, size_t  out_size,
+                      /* out */      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    ZSTD_inBuffer  in  = { 0, 0, 0 };
+    ZSTD_outBuffer out = { out_buf, out_size, 0 };
+
+    // Returns the number of bytes still to be flushed
+    size_t errcode = ZSTD_compressStream2(CCTX, &out, &in, ZSTD_e_flush);
+    SetZstdError(errcode);
+    *out_avail = out.pos;
+    IncreaseOutputSize((unsigned long)out.pos);
+
+    if ( ZSTD_isError(errcode) ) {
+        ERR_COMPRESS(102, FormatErrorMessage("CZstdCompressor::Flush"));
+        return eStatus_Error;
+    }
+    return errcode ? eStatus_Overflow : eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CZstdCompressor::Finish(
+                      char* out_buf, size_t  out_size,
+                      /* out */      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    // Default behavior on empty data -- don't write header/footer
+    if ( !GetProcessedSize()  &&  !F_ISSET(fAllowEmptyData) ) {
+        return eStatus_EndOfData;
+    }
+    ZSTD_inBuffer  in  = { 0, 0, 0 };
+    ZSTD_outBuffer out = { out_buf, out_size, 0 };
+
+    // Returns the number of bytes still to be flushed
+    size_t errcode = ZSTD_compressStream2(CCTX, &out, &in, ZSTD_e_end);
+    SetZstdError(errcode);
+    *out_avail = out.pos;
+    IncreaseOutputSize((unsigned long)out.pos);
+
+    if ( ZSTD_isError(errcode) ) {
+        ERR_COMPRESS(103, FormatErrorMessage("CZstdCompressor::Finish"));
+        return eStatus_Error;
+    }
+    return errcode ? eStatus_Overflow : eStatus_EndOfData;
+}
+
+
+CCompressionProcessor::EStatus CZstdCompressor::End(int /*abandon*/)
+{
+    // Keep context for the next session, but drop unfinished frame
+    if ( m_CCtx ) {
+        ZSTD_CCtx_reset(CCTX, ZSTD_reset_session_only);
+    }
+    SetBusy(false);
+    return eStatus_Success;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// CZstdDecompressor
+//
+
+
+CZstdDecompressor::CZstdDecompressor(TZstdFlags flags)
+    : CZstdCompression(eLevel_Default), m_FrameEnd(false)
+{
+    SetFlags(flags);
+}
+
+
+CZstdDecompressor::~CZstdDecompressor()
+{
+}
+
+
+CCompressionProcessor::EStatus CZstdDecompressor::Init(void)
+{
+    // Initialize members
+    Reset();
+    SetBusy();
+    m_Cache.erase();
+    m_FrameEnd = false;
+
+    if ( !m_DCtx ) {
+        m_DCtx = ZSTD_createDCtx();
+        if ( !m_DCtx ) {
+            SetError(-1, "Cannot create decompression context");
+            ERR_COMPRESS(104, FormatErrorMessage("CZstdDecompressor::Init"));
+            return eStatus_Error;
+        }
+    }
+    size_t errcode = ZSTD_DCtx_reset(DCTX, ZSTD_reset_session_only);
+    SetZstdError(errcode);
+    if ( ZSTD_isError(errcode) ) {
+        ERR_COMPRESS(104, FormatErrorMessage("CZstdDecompressor::Init"));
+        return eStatus_Error;
+    }
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CZstdDecompressor::DecompressData(
+                      const char* in_buf,  size_t  in_len,
+                      char*       out_buf, size_t  out_size,
+                      /* out */            size_t* in_avail,
+                      /* out */            size_t* out_avail)
+{
+    ZSTD_inBuffer  in  = { in_buf,  in_len,   0 };
+    ZSTD_outBuffer out = { out_buf, out_size, 0 };
+
+    // Returns 0 when a frame is completely decoded and fully flushed.
+    // Next frame, if any, is started automatically.
+    size_t errcode = ZSTD_decompressStream(DCTX, &out, &in);
+    SetZstdError(errcode);
+    *in_avail  = in_len - in.pos;
+    *out_avail = out.pos;
+    IncreaseOutputSize((unsigned long)out.pos);
+
+    if ( ZSTD_isError(errcode) ) {
+        ERR_COMPRESS(105, FormatErrorMessage("CZstdDecompressor::Process"));
+        return eStatus_Error;
+    }
+    // Calling without input and output space at the frame end
+    // reports the start of the next frame, ignore it
+    if (in.pos  ||  out.pos) {
+        m_FrameEnd = (errcode == 0);
+    }
+    return eStatus_Success;
+}
+
+
+CCompressionProcessor::EStatus CZstdDecompressor::Process(
+                      const char* in_buf,  size_t  in_len,
+                      char*       out_buf, size_t  out_size,
+                      /* out */            size_t* in_avail,
+                      /* out */            size_t* out_avail)
+{
+    *out_avail = 0;
+    *in_avail  = in_len;
+    if ( !out_size ) {
+        return eStatus_Overflow;
+    }
+    // By default we consider that data is compressed
+    if ( m_DecompressMode == eMode_Unknown  &&
+        !F_ISSET(fAllowTransparentRead) ) {
+        m_DecompressMode = eMode_Decompress;
+    }
+    if ( m_DecompressMode == eMode_Unknown ) {
+        // Collect magic number to determine decompression mode
+        size_t n = min(in_len, kMagicSize - m_Cache.size());
+        m_Cache.append(in_buf, n);
+        in_buf += n;
+        in_len -= n;
+        *in_avail = in_len;
+        IncreaseProcessedSize((unsigned long)n);
+        if (m_Cache.size() < kMagicSize) {
+            return eStatus_Success;
+        }
+        m_DecompressMode = s_IsZstdFrame(m_Cache.data(), m_Cache.size()) ?
+            eMode_Decompress : eMode_TransparentRead;
+    }
+
+    if ( m_DecompressMode == eMode_TransparentRead ) {
+        // Cached data goes first
+        size_t n = min(m_Cache.size(), out_size);
+        memcpy(out_buf, m_Cache.data(), n);
+        m_Cache.erase(0, n);
+        size_t k = min(in_len, out_size - n);
+        memcpy(out_buf + n, in_buf, k);
+        *in_avail  = in_len - k;
+        *out_avail = n + k;
+        IncreaseProcessedSize((unsigned long)k);
+        IncreaseOutputSize((unsigned long)(n + k));
+        return eStatus_Success;
+    }
+
+    // Decompress cached data first
+    if ( !m_Cache.empty() ) {
+        size_t cache_avail;
+        EStatus status = DecompressData(m_Cache.data(), m_Cache.size(),
+                                        out_buf, out_size,
+                                        &cache_avail, out_avail);
+        m_Cache.erase(0, m_Cache.size() - cache_avail);
+        if (status != eStatus_Success  ||  !m_Cache.empty()) {
+            return status;
+        }
+        if (*out_avail) {
+            // Continue on the next call
+            return eStatus_Success;
+        }
+    }
+    EStatus status = DecompressData(in_buf, in_len, out_buf, out_size,
+                                    in_avail, out_avail);
+    IncreaseProcessedSize((unsigned long)(in_len - *in_avail));
+    return status;
+}
+
+
+CCompressionProcessor::EStatus CZstdDecompressor::Flush(
+                      char*   out_buf, size_t  out_size,
+                      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( m_DecompressMode == eMode_Unknown ) {
+        if ( !m_Cache.empty() ) {
+            // Magic number is incomplete yet
+            return eStatus_Success;
+        }
+        return F_ISSET(fAllowEmptyData) ? eStatus_Success : eStatus_Error;
+    }
+    if ( m_DecompressMode == eMode_TransparentRead  ||  !out_size ) {
+        return eStatus_Success;
+    }
+    // Get data buffered inside decompressor
+    size_t in_avail;
+    EStatus status = DecompressData(0, 0, out_buf, out_size,
+                                    &in_avail, out_avail);
+    if (status == eStatus_Success  &&  *out_avail == out_size) {
+        return eStatus_Overflow;
+    }
+    return status;
+}
+
+
+CCompressionProcessor::EStatus CZstdDecompressor::Finish(
+                      char*   out_buf, size_t  out_size,
+                      size_t* out_avail)
+{
+    *out_avail = 0;
+    if ( m_DecompressMode == eMode_Unknown ) {
+        if ( m_Cache.empty() ) {
+            if ( !F_ISSET(fAllowEmptyData) ) {
+                return eStatus_Error;
+            }
+            return eStatus_EndOfData;
+        }
+        // Data is too short to be compressed
+        m_DecompressMode = eMode_TransparentRead;
+    }
+    if ( m_DecompressMode == eMode_TransparentRead ) {
+        size_t n = min(m_Cache.size(), out_size);
+        memcpy(out_buf, m_Cache.data(), n);
+        m_Cache.erase(0, n);
+        *out_avail = n;
+        IncreaseOutputSize((unsigned long)n);
+        return m_Cache.empty() ? eStatus_EndOfData : eStatus_Overflow;
+    }
+    if ( !GetProcessedSize() ) {
+        return F_ISSET(fAllowEmptyData) ? eStatus_EndOfData : eStatus_Error;
+    }
+    EStatus status = Flush(out_buf, out_size, out_avail);
+    if (status != eStatus_Success) {
+        return status;
+    }
+    if ( !m_FrameEnd ) {
+        SetError(-1, "Unexpected end of compressed data");
+        ERR_COMPRESS(106, FormatErrorMessage("CZstdDecompressor::Finish"));
+        return eStatus_Error;
+    }
+    return eStatus_EndOfData;
+}
+
+
+CCompressionProcessor::EStatus CZstdDecompressor::End(int /*abandon*/)
+{
+    SetBusy(false);
+    return eStatus_Success;
+}
+
+
+END_NCBI_SCOPE
+
+#endif  /* HAVE_LIBZSTD */
@@ -35,6 +35,7 @@
 #include <corelib/ncbi_limits.hpp>
 #include <corelib/ncbifile.hpp>
 #include <util/compress/stream_util.hpp>
+#include <util/compress/zlib_index.hpp>
 
 #include <common/test_assert.h>  // This header must go last
 
@@ -141,6 +142,8 @@ public:
     // Additional tests
     void TestEmptyInputData(CCompressStream::EMethod);
     void TestTransparentCopy(const char* src_buf, size_t src_len);
+    void TestParallelZip(const char* src_buf, size_t src_len);
+    void TestIndexedZip(const char* src_buf, size_t src_len);
 };
 
 
@@ -157,7 +160,8 @@ void CTest::Init(void)
     arg_desc->AddDefaultPositional
         ("lib", "Compression library to test", CArgDescriptions::eString, "all");
     arg_desc->SetConstraint
-        ("lib", &(*new CArgAllow_Strings, "all", "z", "bz2", "lzo"));
+        ("lib", &(*new CArgAllow_Strings,
+                   "all", "z", "bz2", "lzo", "zstd", "lz4"));
     SetupArgDescriptions(arg_desc.release());
 }
 
@@ -196,6 +200,16 @@ int CTest::Run(void)
         if (test == "all"  ||  test == "lzo") {
             TestEmptyInputData(CCompressStream::eLZO);
         }
+    #endif
+    #if defined(HAVE_LIBZSTD)
+        if (test == "all"  ||  test == "zstd") {
+            TestEmptyInputData(CCompressStream::eZstd);
+        }
+    #endif
+    #if defined(HAVE_LIBLZ4)
+        if (test == "all"  ||  test == "lz4") {
+            TestEmptyInputData(CCompressStream::eLZ4);
+        }
     #endif
         if (test== "all"  ||  test == "z") {
             TestEmptyInputData(CCompressStream::eZip);
@@ -226,6 +240,22 @@ int CTest::Run(void)
                             CLZOStreamCompressor, CLZOStreamDecompressor>
                 ::Run(src_buf, len);
         }
+    #endif
+    #if defined(HAVE_LIBZSTD)
+        if (test == "all"  ||  test == "zstd") {
+            _TRACE("-------------- Zstd ----------------\n");
+            CTestCompressor<CZstdCompression, CZstdCompressionFile,
+                            CZstdStreamCompressor, CZstdStreamDecompressor>
+                ::Run(src_buf, len);
+        }
+    #endif
+    #if defined(HAVE_LIBLZ4)
+        if (test == "all"  ||  test == "lz4") {
+            _TRACE("-------------- LZ4 -----------------\n");
+            CTestCompressor<CLZ4Compression, CLZ4CompressionFile,
+                            CLZ4StreamCompressor, CLZ4StreamDecompressor>
+                ::Run(src_buf, len);
+        }
     #endif
         if (test== "all"  ||  test == "z") {
             _TRACE("-------------- Zlib ----------------\n");
@@ -237,6 +267,12 @@ int CTest::Run(void)
         // Test for transparent copy (de)compressor
         TestTransparentCopy(src_buf, len);
 
+        // Test for multithreaded gzip compressor
+        if (test== "all"  ||  test == "z") {
+            TestParallelZip(src_buf, len);
+            TestIndexedZip(src_buf, len);
+        }
+
         // Restore saved character
         src_buf[len] = saved;
     }
@@ -277,6 +313,14 @@ static const SEmptyInputDataTest s_EmptyInputDataTests[] =
     { CCompressStream::eLZO,   CLZOCompression::fAllowEmptyData,   true,   0, 15 },
     { CCompressStream::eLZO,   CLZOCompression::fAllowEmptyData |
                                CLZOCompression::fStreamFormat,     true,  15, 15 },
+#endif
+#ifdef HAVE_LIBZSTD
+    { CCompressStream::eZstd,  0 /* default flags */,              false,  0,  0 },
+    { CCompressStream::eZstd,  CZstdCompression::fAllowEmptyData,  true,   9,  9 },
+#endif
+#ifdef HAVE_LIBLZ4
+    { CCompressStream::eLZ4,   0 /* default flags */,              false,  0,  0 },
+    { CCompressStream::eLZ4,   CLZ4Compression::fAllowEmptyData,   true,  11, 11 },
 #endif
     { CCompressStream::eZip,   0 /* default flags */,              false,  0,  0 },
     { CCompressStream::eZip,   CZipCompression::fGZip,             false,  0,  0 },
@@ -321,6 +365,22 @@ void CTest::TestEmptyInputData(CCompressStream::EMethod method)
             stream_compressor.reset(new CLZOStreamCompressor(test.flags));
             stream_decompressor.reset(new CLZOStreamDecompressor(test.flags));
         } else 
+#endif
+#if defined(HAVE_LIBZSTD)
+        if (method == CCompressStream::eZstd) {
+            compression.reset(new CZstdCompression());
+            compression->SetFlags(test.flags);
+            stream_compressor.reset(new CZstdStreamCompressor(test.flags));
+            stream_decompressor.reset(new CZstdStreamDecompressor(test.flags));
+        } else 
+#endif
+#if defined(HAVE_LIBLZ4)
+        if (method == CCompressStream::eLZ4) {
+            compression.reset(new CLZ4Compression());
+            compression->SetFlags(test.flags);
+            stream_compressor.reset(new CLZ4StreamCompressor(test.flags));
+            stream_decompressor.reset(new CLZ4StreamDecompressor(test.flags));
+        } else 
 #endif
         if (method == CCompressStream::eZip) {
             compression.reset(new CZipCompression());
@@ -472,6 +532,228 @@ void CTest::TestTransparentCopy(const char* src_buf, size_t src_len)
 }
 
 
+//------------------------------------------------------------------------
+// Tests for multithreaded gzip/BGZF compressor
+//------------------------------------------------------------------------
+
+void CTest::TestParallelZip(const char* src_buf, size_t src_len)
+{
+    // Use small blocks to get several blocks for any data size
+    const size_t kBlockSize = 4*1024;
+
+    // Data repeated with a shift, so the blocks have something to gain
+    // from dictionary of the previous block
+    string src;
+    for (size_t i = 0;  i < 8;  ++i) {
+        src.append(src_buf + i, src_len - min(i, src_len));
+    }
+
+    static const CZipParallelCompressor::EFormat kFormats[] = {
+        CZipParallelCompressor::eFormat_GZip,
+        CZipParallelCompressor::eFormat_BGZF
+    };
+    static const unsigned int kThreads[] = { 1, 4 };
+
+    for (size_t f = 0;  f < ArraySize(kFormats);  ++f) {
+        string result[ArraySize(kThreads)];
+        for (size_t t = 0;  t < ArraySize(kThreads);  ++t) {
+            CNcbiOstrstream os_str;
+            {{
+                CCompressionOStream os(os_str,
+                    new CZipParallelStreamCompressor(
+                        CZipCompression::eLevel_Default, kFormats[f],
+                        kThreads[t], kBlockSize,
+                        kCompressionDefaultBufSize,
+                        kCompressionDefaultBufSize),
+                    CCompressionStream::fOwnProcessor);
+                // Write by pieces of different size, with a flush
+                size_t pos = 0;
+                for (size_t n = 1;  pos < src.size();  n = n * 3 + 1) {
+                    n = min(n, src.size() - pos);
+                    os.write(src.data() + pos, n);
+                    pos += n;
+                    if (pos > src.size() / 2  &&  pos - n <= src.size() / 2) {
+                        os.flush();
+                    }
+                }
+                os.Finalize();
+                assert(os.good());
+                assert(os.GetProcessedSize() == src.size());
+            }}
+            result[t] = CNcbiOstrstreamToString(os_str);
+            if ( src.empty() ) {
+                assert(result[t].empty());
+                continue;
+            }
+            // Standard gzip decompressor should be able to read it
+            CNcbiIstrstream is_str(result[t].data(), result[t].size());
+            CCompressionIStream is(is_str,
+                new CZipStreamDecompressor(CZipCompression::fGZip),
+                CCompressionStream::fOwnProcessor);
+            string dst;
+            char buf[1000];
+            while (is.read(buf, sizeof(buf))  ||  is.gcount()) {
+                dst.append(buf, (size_t)is.gcount());
+            }
+            assert(dst == src);
+
+            if (kFormats[f] == CZipParallelCompressor::eFormat_BGZF) {
+                // Walk through BGZF blocks using sizes in the headers
+                size_t pos = 0, count = 0;
+                while (pos < result[t].size()) {
+                    const unsigned char* p =
+                        (const unsigned char*)result[t].data() + pos;
+                    assert(p[0] == 0x1f  &&  p[1] == 0x8b  &&  p[3] == 4);
+                    assert(p[12] == 'B'  &&  p[13] == 'C');
+                    pos += (size_t(p[16]) | (size_t(p[17]) << 8)) + 1;
+                    ++count;
+                }
+                assert(pos == result[t].size());
+                // Data blocks, one more block because of the flush,
+                // and EOF block
+                size_t min_count = (src.size() + kBlockSize - 1) / kBlockSize;
+                assert(count >= min_count + 1  &&  count <= min_count + 2);
+            }
+        }
+        // Output doesn't depend on number of threads
+        assert(result[0] == result[1]);
+    }
+    OK;
+}
+
+
+// Read 'count' bytes from the current position of 'is'
+static string s_ReadIndexed(CNcbiIstream& is, size_t count)
+{
+    string dst(count, '\0');
+    is.read(&dst[0], count);
+    dst.resize((size_t)is.gcount());
+    return dst;
+}
+
+
+void CTest::TestIndexedZip(const char* src_buf, size_t src_len)
+{
+    // Small span to get many access points inside of gzip members
+    const CZipIndex::TPosition kSpan = 16*1024;
+
+    string src;
+    for (size_t i = 0;  i < 8;  ++i) {
+        src.append(src_buf + i, src_len - min(i, src_len));
+    }
+    if ( src.empty() ) {
+        return;
+    }
+    // Single gzip file
+    string gz_single;
+    {{
+        CNcbiOstrstream os_str;
+        {{
+            CCompressionOStream os(os_str,
+                new CZipStreamCompressor(CZipCompression::fGZip),
+                CCompressionStream::fOwnProcessor);
+            os.write(src.data(), src.size());
+        }}
+        gz_single = CNcbiOstrstreamToString(os_str);
+    }}
+    // Concatenated gzip files, with zero padding at the end
+    string gz_multi = gz_single + gz_single + string(16, '\0');
+    string src_multi = src + src;
+    // BGZF
+    string bgzf;
+    {{
+        CNcbiOstrstream os_str;
+        {{
+            CCompressionOStream os(os_str,
+                new CZipParallelStreamCompressor(
+                    CZipParallelCompressor::eFormat_BGZF, 2),
+                CCompressionStream::fOwnProcessor);
+            os.write(src.data(), src.size());
+        }}
+        bgzf = CNcbiOstrstreamToString(os_str);
+    }}
+
+    const string* kData[]   = { &gz_single, &gz_multi, &bgzf };
+    const string* kSource[] = { &src,       &src_multi, &src };
+
+    for (size_t d = 0;  d < ArraySize(kData);  ++d) {
+        const string& data = *kData[d];
+        const string& expected = *kSource[d];
+        bool is_bgzf = (kData[d] == &bgzf);
+
+        CNcbiIstrstream idx_str(data.data(), data.size());
+        CRef<CZipIndex> index = CZipIndex::Build(idx_str, kSpan);
+        assert(index->IsBGZF() == is_bgzf);
+        assert(index->GetDataSize() == expected.size());
+        assert(!index->GetPoints().empty());
+
+        // Save/Load
+        CNcbiOstrstream saved_str;
+        index->Save(saved_str);
+        string saved = CNcbiOstrstreamToString(saved_str);
+        CNcbiIstrstream load_str(saved.data(), saved.size());
+        CRef<CZipIndex> loaded = CZipIndex::Load(load_str);
+        assert(loaded->IsBGZF() == index->IsBGZF());
+        assert(loaded->GetDataSize() == index->GetDataSize());
+        assert(loaded->GetPoints().size() == index->GetPoints().size());
+        for (size_t i = 0;  i < index->GetPoints().size();  ++i) {
+            const CZipIndex::SPoint& p1 = index->GetPoints()[i];
+            const CZipIndex::SPoint& p2 = loaded->GetPoints()[i];
+            assert(p1.raw_pos == p2.raw_pos  &&  p1.data_pos == p2.data_pos);
+            assert(p1.bits == p2.bits  &&  p1.member == p2.member);
+            assert(p1.window == p2.window);
+        }
+
+        // Sequential read without index
+        {{
+            CNcbiIstrstream is_str(data.data(), data.size());
+            CZipIndexedIStream is(is_str);
+            assert(s_ReadIndexed(is, expected.size() + 1) == expected);
+        }}
+
+        // Random access using the loaded index
+        CNcbiIstrstream is_str(data.data(), data.size());
+        CZipIndexedIStream is(is_str, loaded);
+        size_t size = expected.size();
+        for (size_t i = 0;  i < 50;  ++i) {
+            size_t pos = (size_t)(rand() % (size + 1));
+            size_t len = (size_t)(rand() % 1000);
+            is.clear();
+            is.seekg(NcbiInt8ToStreampos(pos));
+            assert(is.good());
+            assert(NcbiStreamposToInt8(is.tellg()) == Int8(pos));
+            string dst = s_ReadIndexed(is, len);
+            assert(dst == expected.substr(pos, len));
+        }
+        // Seek relative to the end
+        is.clear();
+        is.seekg(-10, IOS_BASE::end);
+        assert(s_ReadIndexed(is, 100) ==
+               expected.substr(size - min(size, (size_t)10)));
+
+        if ( is_bgzf ) {
+            // Virtual offsets, with and without index
+            for (int with_index = 0;  with_index < 2;  ++with_index) {
+                CNcbiIstrstream vo_str(data.data(), data.size());
+                CZipIndexedIStream vo_is(vo_str, with_index ? &*index : 0);
+                for (size_t i = 0;  i < 20;  ++i) {
+                    size_t pos = (size_t)(rand() % size);
+                    vo_is.clear();
+                    vo_is.seekg(0);
+                    s_ReadIndexed(vo_is, pos);
+                    Uint8 offset = vo_is.GetVirtualOffset();
+                    string dst = s_ReadIndexed(vo_is, 500);
+                    assert(dst == expected.substr(pos, 500));
+                    vo_is.SeekVirtualOffset(offset);
+                    assert(s_ReadIndexed(vo_is, 500) == dst);
+                }
+            }
+        }
+    }
+    OK;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // MAIN
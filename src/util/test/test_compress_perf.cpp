@@ -0,0 +1,310 @@
+/*  $Id$
+ * ===========================================================================
+ *
+ *                            PUBLIC DOMAIN NOTICE
+ *               National Center for Biotechnology Information
+ *
+ *  This software/database is a "United States Government Work" under the
+ *  terms of the United States Copyright Act.  It was written as part of
+ *  the author's official duties as a United States Government employee and
+ *  thus cannot be copyrighted.  This software/database is freely available
+ *  to the public for use. The National Library of Medicine and the U.S.
+ *  Government have not placed any restriction on its use or reproduction.
+ *
+ *  Although all reasonable efforts have been taken to ensure the accuracy
+ *  and reliability of the software and data, the NLM and the U.S.
+ *  Government do not and cannot warrant the performance or results that
+ *  may be obtained by using this software or data. The NLM and the U.S.
+ *  Government disclaim all warranties, express or implied, including
+ *  warranties of performance, merchantability or fitness for any particular
+ *  purpose.
+ *
+ *  Please cite the author in any work or product based on this material.
+ *
+ * ===========================================================================
+ *
+ * Author:  agent
+ *
+ * File Description:  Performance comparison of the compression libraries
+ *
+ * Compress and decompress data with all available compression libraries
+ * at the lowest, default and best levels, and print compression ratio
+ * and speed for each of them. Any files can be used as test data,
+ * for example the FASTA and ASN.1 files bundled with the toolkit tests:
+ *
+ *   test_compress_perf $NCBI/src/algo/cobalt/unit_test/data/large.fa \
+ *       $NCBI/src/algo/align/util/unit_test/data/157696450.asn
+ *
+ * Without arguments, generated FASTA-like and ASN.1-like data is used.
+ *
+ */
+
+#include <ncbi_pch.hpp>
+#include <corelib/ncbiapp.hpp>
+#include <corelib/ncbiargs.hpp>
+#include <corelib/ncbifile.hpp>
+#include <corelib/ncbitime.hpp>
+#include <util/compress/stream_util.hpp>
+
+#include <common/test_assert.h>  // This header must go last
+
+
+USING_NCBI_SCOPE;
+
+
+/// Size of generated test data.
+const size_t kGeneratedDataSize = 4*1024*1024;
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Test application
+//
+
+class CTest : public CNcbiApplication
+{
+public:
+    void Init(void);
+    int  Run(void);
+
+private:
+    // Create compression object by library name, NULL if not available.
+    CCompression* x_CreateCompression(const string& lib,
+                                      CCompression::ELevel level);
+    // Test all libraries on the data.
+    void x_TestData(const string& name, const string& data);
+    // Test one library, print results.
+    void x_TestLibrary(const string& lib, CCompression::ELevel level,
+                       const string& data);
+
+    int m_Iterations;
+};
+
+
+void CTest::Init(void)
+{
+    SetDiagPostLevel(eDiag_Error);
+
+    auto_ptr<CArgDescriptions> arg_desc(new CArgDescriptions);
+    arg_desc->SetUsageContext(GetArguments().GetProgramBasename(),
+                              "Compression libraries performance test");
+    arg_desc->AddDefaultKey
+        ("lib", "name", "Compression library to test",
+         CArgDescriptions::eString, "all");
+    arg_desc->SetConstraint
+        ("lib", &(*new CArgAllow_Strings,
+                   "all", "z", "bz2", "lzo", "zstd", "lz4"));
+    arg_desc->AddDefaultKey
+        ("iterations", "count", "Number of compress/decompress runs",
+         CArgDescriptions::eInteger, "3");
+    arg_desc->SetConstraint("iterations", new CArgAllow_Integers(1, kMax_Int));
+    arg_desc->AddExtra
+        (0, kMax_UInt, "Files with test data", CArgDescriptions::eInputFile,
+         CArgDescriptions::fBinary);
+    SetupArgDescriptions(arg_desc.release());
+}
+
+
+CCompression* CTest::x_CreateCompression(const string& lib,
+                                         CCompression::ELevel level)
+{
+    if (lib == "z") {
+        return new CZipCompression(level);
+    }
+    if (lib == "bz2") {
+        return new CBZip2Compression(level);
+    }
+#if defined(HAVE_LIBLZO)
+    if (lib == "lzo") {
+        return new CLZOCompression(level);
+    }
+#endif
+#if defined(HAVE_LIBZSTD)
+    if (lib == "zstd") {
+        return new CZstdCompression(level);
+    }
+#endif
+#if defined(HAVE_LIBLZ4)
+    if (lib == "lz4") {
+        return new CLZ4Compression(level);
+    }
+#endif
+    return NULL;
+}
+
+
+void CTest::x_TestLibrary(const string& lib, CCompression::ELevel level,
+                          const string& data)
+{
+    AutoPtr<CCompression> c(x_CreateCompression(lib, level));
+    if ( !c.get() ) {
+        return;
+    }
+    // Enough for any library in the worst case
+    size_t buf_size = data.size() + data.size() / 8 + 64*1024;
+    AutoArray<char> dst_buf(buf_size);
+    AutoArray<char> cmp_buf(data.size() + 1);
+    size_t dst_len = 0, cmp_len = 0;
+
+    double compress_time = 0, decompress_time = 0;
+    for (int i = 0;  i < m_Iterations;  i++) {
+        CStopWatch sw(CStopWatch::eStart);
+        bool res = c->CompressBuffer(data.data(), data.size(),
+                                     dst_buf.get(), buf_size, &dst_len);
+        compress_time += sw.Elapsed();
+        assert(res);
+
+        sw.Restart();
+        res = c->DecompressBuffer(dst_buf.get(), dst_len,
+                                  cmp_buf.get(), data.size() + 1, &cmp_len);
+        decompress_time += sw.Elapsed();
+        assert(res);
+        assert(cmp_len == data.size());
+        assert(memcmp(data.data(), cmp_buf.get(), cmp_len) == 0);
+    }
+    double mb = (double)data.size() * m_Iterations / (1024*1024);
+    CVersionInfo version = c->GetVersion();
+    string ver = NStr::IntToString(version.GetMajor()) + "." +
+                 NStr::IntToString(version.GetMinor()) + "." +
+                 NStr::IntToString(version.GetPatchLevel());
+
+    NcbiCout << setw(6)  << version.GetName()
+             << setw(10) << ver
+             << setw(9)  << (level == CCompression::eLevel_Default ?
+                             string("default") :
+                             NStr::IntToString((int)c->GetLevel()))
+             << setw(12) << dst_len
+             << setw(9)  << setprecision(3)
+                         << (double)data.size() / (dst_len ? dst_len : 1)
+             << setw(12) << setprecision(4) << mb / compress_time
+             << setw(12) << setprecision(4) << mb / decompress_time
+             << NcbiEndl;
+}
+
+
+void CTest::x_TestData(const string& name, const string& data)
+{
+    NcbiCout << NcbiEndl
+             << name << ": " << data.size() << " bytes" << NcbiEndl
+             << "   lib   version    level        size    ratio"
+                "  compr MB/s decomp MB/s" << NcbiEndl;
+
+    static const char* kLibs[] = { "z", "bz2", "lzo", "zstd", "lz4" };
+    static const CCompression::ELevel kLevels[] = {
+        CCompression::eLevel_Lowest,
+        CCompression::eLevel_Default,
+        CCompression::eLevel_Best
+    };
+    string test = GetArgs()["lib"].AsString();
+
+    for (size_t i = 0;  i < ArraySize(kLibs);  i++) {
+        if (test != "all"  &&  test != kLibs[i]) {
+            continue;
+        }
+        for (size_t j = 0;  j < ArraySize(kLevels);  j++) {
+            x_TestLibrary(kLibs[i], kLevels[j], data);
+        }
+    }
+}
+
+
+/// Generate FASTA-like data: nucleotide sequence with some repeats.
+static string s_GenerateFasta(size_t size)
+{
+    static const char kBases[] = "ACGT";
+    string data;
+    data.reserve(size + 100);
+    int n = 0;
+    while (data.size() < size) {
+        data += ">gi|" + NStr::IntToString(1000000 + n) +
+                "|gb|AC" + NStr::IntToString(n) + ".1| generated sequence\n";
+        n++;
+        size_t len = 1000 + rand() % 10000;
+        string seq;
+        for (size_t i = 0;  i < len;  i++) {
+            // Copy already generated piece sometimes to get repeats
+            if (i > 100  &&  rand() % 500 == 0) {
+                size_t from = rand() % (i - 50);
+                seq.append(seq, from, 50);
+                i += 49;
+                continue;
+            }
+            seq += kBases[rand() % 4];
+        }
+        for (size_t i = 0;  i < seq.size();  i += 70) {
+            data.append(seq, i, 70);
+            data += '\n';
+        }
+    }
+    return data;
+}
+
+
+/// Generate ASN.1 text-like data.
+static string s_GenerateAsn(size_t size)
+{
+    string data;
+    data.reserve(size + 1000);
+    int n = 0;
+    while (data.size() < size) {
+        data += "Seq-entry ::= seq {\n"
+                "  id {\n"
+                "    gi " + NStr::IntToString(100000 + rand() % 900000) + ",\n"
+                "    genbank {\n"
+                "      accession \"AC" + NStr::IntToString(n++) + "\",\n"
+                "      version " + NStr::IntToString(1 + rand() % 3) + "\n"
+                "    }\n"
+                "  },\n"
+                "  descr {\n"
+                "    title \"Generated sequence " +
+                        NStr::IntToString(rand()) + "\",\n"
+                "    molinfo {\n"
+                "      biomol genomic\n"
+                "    }\n"
+                "  },\n"
+                "  inst {\n"
+                "    repr raw,\n"
+                "    mol dna,\n"
+                "    length " + NStr::IntToString(rand() % 100000) + "\n"
+                "  }\n"
+                "}\n";
+    }
+    return data;
+}
+
+
+int CTest::Run(void)
+{
+    const CArgs& args = GetArgs();
+    m_Iterations = args["iterations"].AsInteger();
+
+#if defined(HAVE_LIBLZO)
+    CLZOCompression::Initialize();
+#endif
+    if (args.GetNExtra() == 0) {
+        srand(1);
+        x_TestData("generated FASTA", s_GenerateFasta(kGeneratedDataSize));
+        x_TestData("generated ASN.1", s_GenerateAsn(kGeneratedDataSize));
+        return 0;
+    }
+    for (size_t i = 1;  i <= args.GetNExtra();  i++) {
+        CNcbiIstream& is = args[i].AsInputFile();
+        CNcbiOstrstream os;
+        NcbiStreamCopy(os, is);
+        x_TestData(args[i].AsString(), CNcbiOstrstreamToString(os));
+    }
+    return 0;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// MAIN
+//
+
+int main(int argc, const char* argv[])
+{
+    // Execute main application function
+    return CTest().AppMain(argc, argv);
+}
@@ -17,6 +17,14 @@
     _VERIFY((unsigned int)CZipCompression::fAllowTransparentRead == 
             (unsigned int)CLZOCompression::fAllowTransparentRead);
 #endif
+#if defined(HAVE_LIBZSTD)
+    _VERIFY((unsigned int)CZipCompression::fAllowTransparentRead == 
+            (unsigned int)CZstdCompression::fAllowTransparentRead);
+#endif
+#if defined(HAVE_LIBLZ4)
+    _VERIFY((unsigned int)CZipCompression::fAllowTransparentRead == 
+            (unsigned int)CLZ4Compression::fAllowTransparentRead);
+#endif
 
     //------------------------------------------------------------------------
     // Version info
@@ -665,6 +673,16 @@
             // method to decompress data compressed using streams/manipulators.
             c.SetFlags(c.GetFlags() | CLZOCompression::fStreamFormat);
         } else 
+#endif
+#if defined(HAVE_LIBZSTD)
+        if (test_name == "zstd") {
+            os_str << MCompress_Zstd << src_buf;
+        } else 
+#endif
+#if defined(HAVE_LIBLZ4)
+        if (test_name == "lz4") {
+            os_str << MCompress_LZ4 << src_buf;
+        } else 
 #endif
         if (test_name == "zlib") {
             os_str << MCompress_Zip << src_buf;
@@ -693,6 +711,16 @@
         if (test_name == "lzo") {
             is_cmp >> MDecompress_LZO >> str_cmp;
         } else 
+#endif
+#if defined(HAVE_LIBZSTD)
+        if (test_name == "zstd") {
+            is_cmp >> MDecompress_Zstd >> str_cmp;
+        } else 
+#endif
+#if defined(HAVE_LIBLZ4)
+        if (test_name == "lz4") {
+            is_cmp >> MDecompress_LZ4 >> str_cmp;
+        } else 
 #endif
         if (test_name == "zlib") {
             is_cmp >> MDecompress_Zip >> str_cmp;
@@ -740,6 +768,16 @@
             if (test_name == "lzo") {
                 os_str << MCompress_LZO << is_str;
             } else 
+    #endif
+    #if defined(HAVE_LIBZSTD)
+            if (test_name == "zstd") {
+                os_str << MCompress_Zstd << is_str;
+            } else 
+    #endif
+    #if defined(HAVE_LIBLZ4)
+            if (test_name == "lz4") {
+                os_str << MCompress_LZ4 << is_str;
+            } else 
     #endif
             if (test_name == "zlib") {
                 os_str << MCompress_Zip << is_str;
@@ -768,6 +806,16 @@
             if (test_name == "lzo") {
                 os_cmp << MDecompress_LZO << is_cmp;
             } else 
+    #endif
+    #if defined(HAVE_LIBZSTD)
+            if (test_name == "zstd") {
+                os_cmp << MDecompress_Zstd << is_cmp;
+            } else 
+    #endif
+    #if defined(HAVE_LIBLZ4)
+            if (test_name == "lz4") {
+                os_cmp << MDecompress_LZ4 << is_cmp;
+            } else 
     #endif
             if (test_name == "zlib") {
                 os_cmp << MDecompress_Zip << is_cmp;
@@ -794,6 +842,16 @@
             if (test_name == "lzo") {
                 is_str >> MCompress_LZO >> os_str;
             } else 
+    #endif
+    #if defined(HAVE_LIBZSTD)
+            if (test_name == "zstd") {
+                is_str >> MCompress_Zstd >> os_str;
+            } else 
+    #endif
+    #if defined(HAVE_LIBLZ4)
+            if (test_name == "lz4") {
+                is_str >> MCompress_LZ4 >> os_str;
+            } else 
     #endif
             if (test_name == "zlib") {
                 is_str >> MCompress_Zip >> os_str;
@@ -822,6 +880,16 @@
             if (test_name == "lzo") {
                 is_cmp >> MDecompress_LZO >> os_cmp;
             } else 
+    #endif
+    #if defined(HAVE_LIBZSTD)
+            if (test_name == "zstd") {
+                is_cmp >> MDecompress_Zstd >> os_cmp;
+            } else 
+    #endif
+    #if defined(HAVE_LIBLZ4)
+            if (test_name == "lz4") {
+                is_cmp >> MDecompress_LZ4 >> os_cmp;
+            } else 
     #endif
             if (test_name == "zlib") {
                 is_cmp >> MDecompress_Zip >> os_cmp;
@@ -874,6 +942,16 @@
         if (test_name == "lzo") {
             os << MCompress_LZO << is_str;
         } else 
+#endif
+#if defined(HAVE_LIBZSTD)
+        if (test_name == "zstd") {
+            os << MCompress_Zstd << is_str;
+        } else 
+#endif
+#if defined(HAVE_LIBLZ4)
+        if (test_name == "lz4") {
+            os << MCompress_LZ4 << is_str;
+        } else 
 #endif
         if (test_name == "zlib") {
             os << MCompress_GZipFile << is_str;
@@ -896,6 +974,16 @@
         if (test_name == "lzo") {
             is >> MDecompress_LZO >> os_cmp;
         } else 
+#endif
+#if defined(HAVE_LIBZSTD)
+        if (test_name == "zstd") {
+            is >> MDecompress_Zstd >> os_cmp;
+        } else 
+#endif
+#if defined(HAVE_LIBLZ4)
+        if (test_name == "lz4") {
+            is >> MDecompress_LZ4 >> os_cmp;
+        } else 
 #endif
         if (test_name == "zlib") {
             is >> MDecompress_GZipFile >> os_cmp;
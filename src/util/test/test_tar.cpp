@@ -195,6 +195,10 @@ void CTarTest::Init(void)
                          "Archive block size in 512-byte units\n"
                          "(10K blocks in use by default)",
                          CArgDescriptions::eInteger, "20");
+    args->AddDefaultKey ("j", "threads",
+                         "Number of threads to extract/add files with\n"
+                         "(0 to use all CPUs)",
+                         CArgDescriptions::eInteger, "1");
     args->AddOptionalKey("X", "exclude",
                          "Exclude pattern", CArgDescriptions::eString,
                          CArgDescriptions::fAllowMultiple);
@@ -627,6 +631,7 @@ int CTarTest::Run(void)
         }
     } else {
         tar->SetFlags(m_Flags);
+        tar->SetThreadCount((unsigned int) args["j"].AsInteger());
         if (args["C"].HasValue()) {
             tar->SetBaseDir(args["C"].AsString());
         }
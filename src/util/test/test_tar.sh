@@ -165,6 +165,20 @@ dd if=$test_base.tar bs=4567 | $test_tar -C $test_base.2 -v -x -f -
 rm -f $test_base.1/.testfifo $test_base.2/.testfifo
 diff -r $test_base.1 $test_base.2 2>/dev/null                                            ||  exit 1
 
+echo
+echo "`date` *** Checking parallel extraction and creation"
+echo
+
+mkdir $test_base.3                                                                       ||  exit 1
+$test_tar -C $test_base.3 -x -j 4 -f $test_base.tar                                      ||  exit 1
+rm -f $test_base.3/.testfifo
+diff -r $test_base.1 $test_base.3 2>/dev/null                                            ||  exit 1
+$test_tar -C $test_base.3 -c -j 4 -f $test_base.3.tar .                                 ||  exit 1
+mkdir $test_base.4                                                                       ||  exit 1
+$test_tar -C $test_base.4 -x      -f $test_base.3.tar                                    ||  exit 1
+diff -r $test_base.1 $test_base.4 2>/dev/null                                            ||  exit 1
+rm -rf $test_base.3 $test_base.4 $test_base.3.tar
+
 echo
 echo "`date` *** Checking piping out and compatibility with the native tar utility"
 echo
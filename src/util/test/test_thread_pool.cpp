@@ -72,6 +72,7 @@ enum ECheckCancelType {
 static CRandom                           s_RNG;
 static CAtomicCounter                    s_SerialNum;
 static CThreadPool*                      s_Pool;
+static CThreadPool::EQueueType           s_QueueType = CThreadPool::eQueue_Shared;
 static CStopWatch                        s_Timer;
 
 static vector<EActionType>               s_Actions;
@@ -86,6 +87,7 @@ class CThreadPoolTester : public CThreadedApp
 {
 protected:
     virtual bool TestApp_Init(void);
+    virtual bool TestApp_Args(CArgDescriptions& args);
     virtual bool TestApp_Exit(void);
     virtual bool Thread_Run(int idx);
 private:
@@ -176,6 +178,11 @@ bool CThreadPoolTester::TestApp_Init(void)
             MSG_POST("Randomization seed value: " << pid);
     }}
 
+    if (GetArgs()["work_stealing"]) {
+        s_QueueType = CThreadPool::eQueue_WorkStealing;
+        MSG_POST("Using work-stealing queue of tasks");
+    }
+
     // One-off test for using exclusive task to wait for termination of
     // previously run regular tasks
 
@@ -184,7 +191,8 @@ bool CThreadPoolTester::TestApp_Init(void)
         GetMinMaxThreads(&min_threads, &max_threads);
         MSG_POST("Terminator task test. Round: " << j <<
                  ", min/max threads: " << min_threads << "/" << max_threads);
-        CThreadPool tp(100, max_threads, min_threads);
+        CThreadPool tp(100, max_threads, min_threads,
+                       CThread::fRunDefault, s_QueueType);
         _ASSERT(s_TaskCounter.Get() == 0);
         for (unsigned i = 0;  i < 98;  i++) {
             tp.AddTask(new CSentinelThreadPool_Task(i));
@@ -202,7 +210,8 @@ bool CThreadPoolTester::TestApp_Init(void)
     MSG_POST("One-off exclusive task test, with min/max threads: "
              << min_threads << "/" << max_threads);
 
-    CThreadPool tp(100, max_threads, min_threads);
+    CThreadPool tp(100, max_threads, min_threads, CThread::fRunDefault,
+                   s_QueueType);
 
     _ASSERT(s_TaskCounter.Get() == 0);
     for (unsigned i = 0;  i < 50;  i++) {
@@ -230,7 +239,8 @@ bool CThreadPoolTester::TestApp_Init(void)
 
 
     //
-    s_Pool = new CThreadPool(kQueueSize, kMaxThreads);
+    s_Pool = new CThreadPool(kQueueSize, kMaxThreads, 2,
+                             CThread::fRunDefault, s_QueueType);
 
     if (s_NumThreads > kQueueSize) {
         s_NumThreads = kQueueSize;
@@ -282,6 +292,14 @@ bool CThreadPoolTester::TestApp_Init(void)
 }
 
 
+bool CThreadPoolTester::TestApp_Args(CArgDescriptions& args)
+{
+    args.AddFlag("work_stealing",
+                 "Test pool with work-stealing queue of tasks");
+    return true;
+}
+
+
 bool CThreadPoolTester::TestApp_Exit(void)
 {
     MSG_POST("Destroying pool");
@@ -34,6 +34,8 @@
 #include <util/thread_pool_ctrl.hpp>
 #include <util/sync_queue.hpp>
 #include <util/error_codes.hpp>
+#include <corelib/ncbi_system.hpp>
+#include <deque>
 
 #define NCBI_USE_ERRCODE_X  Util_Thread
 
@@ -54,6 +56,93 @@ struct SThreadPool_TaskCompare {
 };
 
 
+/// Task storage for the pool created with CThreadPool::eQueue_WorkStealing.
+///
+/// Tasks are kept in several shards, each with its own small lock. Every
+/// pool thread has its home shard and takes tasks from it first, stealing
+/// from the other shards only when its own one has nothing of the same
+/// priority band. Threads of the pool add tasks into their home shard,
+/// other threads spread tasks between shards in round-robin fashion.
+/// Interface mimics the subset of CSyncQueue used by the pool.
+class CThreadPool_StealingQueue
+{
+public:
+    typedef CRef<CThreadPool_Task>  TTaskRef;
+    typedef vector<TTaskRef>        TTaskList;
+
+    /// Number of priority bands in each shard
+    enum { kBandsCount = 4 };
+
+    /// Constructor
+    /// @param max_size
+    ///   Maximum number of tasks that can be stored in all shards together
+    /// @param shards_count
+    ///   Number of shards to create
+    CThreadPool_StealingQueue(unsigned int max_size,
+                              unsigned int shards_count);
+
+    /// Get number of shards in the queue
+    unsigned int GetShardsCount(void) const;
+
+    /// Get number of tasks stored in the queue
+    size_t GetSize(void) const;
+
+    /// Add task to the given shard waiting for the room if necessary.
+    /// Throws CSyncQueueException (eNoRoom) if there is no room in the
+    /// queue and it didn't appear within the given timeout.
+    void Push(const TTaskRef& task, unsigned int shard,
+              const CTimeSpan* timeout);
+
+    /// Get task with the best priority band looking into the given shard
+    /// first. Returns NULL if the queue is empty.
+    TTaskRef Pop(unsigned int home_shard);
+
+    /// Delete the task from the queue if it's there
+    void Erase(const CThreadPool_Task* task);
+
+    /// Remove all tasks from the queue and put them into the list
+    void TakeAll(TTaskList* tasks);
+
+private:
+    /// Prohibit copying and assigning
+    CThreadPool_StealingQueue(const CThreadPool_StealingQueue&);
+    CThreadPool_StealingQueue& operator= (const CThreadPool_StealingQueue&);
+
+    /// One shard of the queue
+    struct SShard {
+        /// Lock guarding all bands of the shard
+        CFastMutex       lock;
+        /// Tasks in the order of adding, one deque per priority band
+        deque<TTaskRef>  bands[kBandsCount];
+        /// Number of tasks in each band. Allows to skip empty bands
+        /// without acquiring the lock.
+        CAtomicCounter   counts[kBandsCount];
+    };
+
+    /// Get band number for the task
+    static unsigned int x_GetBand(const CThreadPool_Task* task);
+
+    /// Release place in the queue taken by one task and wake up one thread
+    /// waiting for the room if there's any
+    void x_ReleaseRoom(size_t count);
+
+    /// Shards of the queue
+    AutoArray<SShard>  m_Shards;
+    /// Number of shards
+    unsigned int       m_ShardsCount;
+    /// Maximum number of tasks in the queue
+    size_t             m_MaxSize;
+    /// Number of tasks stored in all shards
+    CAtomicCounter     m_Size;
+    /// Number of places in the queue taken by tasks stored or being stored
+    CAtomicCounter     m_Reserved;
+    /// Number of threads waiting for the room in the queue
+    CAtomicCounter     m_RoomWaiters;
+    /// Semaphore for waiting for the room in the queue
+    CSemaphore         m_RoomTrigger;
+};
+
+
 /// Real implementation of all ThreadPool functions
 class CThreadPool_Impl : public CObject
 {
@@ -90,7 +179,9 @@ public:
                      unsigned int      queue_size,
                      unsigned int      max_threads,
                      unsigned int      min_threads,
-                     CThread::TRunMode threads_mode = CThread::fRunDefault);
+                     CThread::TRunMode threads_mode = CThread::fRunDefault,
+                     CThreadPool::EQueueType queue_type
+                                               = CThreadPool::eQueue_Shared);
 
     /// Constructor with explicitly given controller
     /// @param pool_intf
@@ -100,7 +191,9 @@ public:
     CThreadPool_Impl(CThreadPool*        pool_intf,
                      unsigned int        queue_size,
                      CThreadPool_Controller* controller,
-                     CThread::TRunMode   threads_mode = CThread::fRunDefault);
+                     CThread::TRunMode   threads_mode = CThread::fRunDefault,
+                     CThreadPool::EQueueType queue_type
+                                               = CThreadPool::eQueue_Shared);
 
     /// Get pointer to ThreadPool interface object
     CThreadPool* GetPoolInterface(void) const;
@@ -178,7 +271,13 @@ public:
 
     /// Get next task from queue if there is one
     /// If the queue is empty then return NULL.
-    CRef<CThreadPool_Task> TryGetNextTask(void);
+    /// @param queue_index
+    ///   Index of the thread's home shard when pool uses work-stealing
+    ///   queue, ignored otherwise.
+    CRef<CThreadPool_Task> TryGetNextTask(unsigned int queue_index);
+
+    /// Get index of the home shard for the next started thread
+    unsigned int GetNextQueueIndex(void);
 
     /// Callback from thread when it is starting to execute task
     void TaskStarting(void);
@@ -276,9 +375,18 @@ private:
     ///   ThreadPool interface object attached to this implementation
     /// @param controller
     ///   Controller for the pool
+    /// @param max_threads
+    ///   Maximum number of threads expected in the pool (to choose number
+    ///   of shards in work-stealing queue)
     void x_Init(CThreadPool*            pool_intf,
                 CThreadPool_Controller* controller,
-                CThread::TRunMode       threads_mode);
+                CThread::TRunMode       threads_mode,
+                CThreadPool::EQueueType queue_type,
+                unsigned int            queue_size,
+                unsigned int            max_threads);
+
+    /// Get index of the shard where the new task should be added
+    unsigned int x_GetPushQueueIndex(void);
 
     /// Destructor. Will be called from CRef
     ~CThreadPool_Impl(void);
@@ -338,6 +446,13 @@ private:
     CTimeSpan                        m_DestroyTimeout;
     /// Queue for storing tasks
     TQueue                           m_Queue;
+    /// Sharded queue for storing tasks, used instead of m_Queue
+    /// when the pool is created with eQueue_WorkStealing
+    auto_ptr<CThreadPool_StealingQueue> m_StealingQueue;
+    /// Counter for distributing threads between shards
+    CAtomicCounter                   m_NextThreadQueue;
+    /// Counter for distributing tasks between shards
+    CAtomicCounter                   m_NextPushQueue;
     /// Mutex for guarding all changes in the pool, its threads and controller
     CMutex                           m_MainPoolMutex;
     /// Semaphore for waiting for available threads to process task when
@@ -428,6 +543,12 @@ public:
     /// @sa CThreadPool_Thread::GetPool()
     CThreadPool* GetPool(void) const;
 
+    /// Get pool implementation owning this thread
+    CThreadPool_Impl* GetPoolImpl(void) const;
+
+    /// Get index of this thread's home shard in work-stealing queue
+    unsigned int GetQueueIndex(void) const;
+
     /// Request this thread to finish its operation.
     /// It renders the thread unusable and eventually ready for destruction
     /// (as soon as its current task is finished and there are no CRefs to
@@ -497,6 +618,8 @@ private:
     CSemaphore                   m_IdleTrigger;
     /// General-use mutex for very (very!) trivial ops
     mutable CFastMutex           m_FastMutex;
+    /// Index of home shard in work-stealing queue
+    unsigned int                 m_QueueIndex;
 };
 
 
@@ -731,6 +854,9 @@ CThreadPool_Impl::GetThreadsCount(void) const
 inline unsigned int
 CThreadPool_Impl::GetQueuedTasksCount(void) const
 {
+    if (m_StealingQueue.get()) {
+        return (unsigned int)m_StealingQueue->GetSize();
+    }
     return (unsigned int)m_Queue.GetSize();
 }
 
@@ -829,9 +955,13 @@ CThreadPool_Impl::ThreadStopped(CThreadPool_ThreadImpl* thread)
 }
 
 inline CRef<CThreadPool_Task>
-CThreadPool_Impl::TryGetNextTask(void)
+CThreadPool_Impl::TryGetNextTask(unsigned int queue_index)
 {
     if ( !m_Suspended ) {
+        if (m_StealingQueue.get()) {
+            return m_StealingQueue->Pop(queue_index);
+        }
+
         TQueue::TAccessGuard guard(m_Queue);
 
         if (m_Queue.GetSize() != 0) {
@@ -842,6 +972,34 @@ CThreadPool_Impl::TryGetNextTask(void)
     return CRef<CThreadPool_Task>();
 }
 
+inline unsigned int
+CThreadPool_Impl::GetNextQueueIndex(void)
+{
+    if ( !m_StealingQueue.get() ) {
+        return 0;
+    }
+    return (unsigned int)(m_NextThreadQueue.Add(1)
+                          % m_StealingQueue->GetShardsCount());
+}
+
+inline unsigned int
+CThreadPool_Impl::x_GetPushQueueIndex(void)
+{
+    // Tasks added by the pool's own threads go to the home shard of the
+    // thread, so that they are most probably executed by the same thread.
+    CThreadPool_Thread* thread
+        = dynamic_cast<CThreadPool_Thread*>(CThread::GetCurrentThread());
+    if (thread) {
+        CThreadPool_ThreadImpl* thr_impl
+            = CThreadPool_ThreadImpl::s_GetImplPointer(thread);
+        if (thr_impl->GetPoolImpl() == this) {
+            return thr_impl->GetQueueIndex();
+        }
+    }
+    return (unsigned int)(m_NextPushQueue.Add(1)
+                          % m_StealingQueue->GetShardsCount());
+}
+
 
 inline CThreadPool_Impl::SExclusiveTaskInfo
 CThreadPool_Impl::TryGetExclusiveTask(void)
@@ -1207,7 +1365,8 @@ CThreadPool_ThreadImpl::CThreadPool_ThreadImpl
     m_Finishing(false),
     m_CancelRequested(false),
     m_IsIdle(true),
-    m_IdleTrigger(0, kMax_Int)
+    m_IdleTrigger(0, kMax_Int),
+    m_QueueIndex(pool->GetNextQueueIndex())
 {}
 
 inline
@@ -1220,6 +1379,18 @@ CThreadPool_ThreadImpl::GetPool(void) const
     return m_Pool->GetPoolInterface();
 }
 
+inline CThreadPool_Impl*
+CThreadPool_ThreadImpl::GetPoolImpl(void) const
+{
+    return m_Pool.GetNCPointer();
+}
+
+inline unsigned int
+CThreadPool_ThreadImpl::GetQueueIndex(void) const
+{
+    return m_QueueIndex;
+}
+
 inline bool
 CThreadPool_ThreadImpl::IsFinishing(void) const
 {
@@ -1307,7 +1478,7 @@ CThreadPool_ThreadImpl::Main(void)
         m_CancelRequested = false;
 
         {{
-            CRef<CThreadPool_Task> task = m_Pool->TryGetNextTask();
+            CRef<CThreadPool_Task> task = m_Pool->TryGetNextTask(m_QueueIndex);
             CFastMutexGuard fast_guard(m_FastMutex);
             m_CurrentTask = task;
         }}
@@ -1379,6 +1550,178 @@ CThreadPool_ThreadImpl::OnExit(void)
 
 
 
+/// Period of rechecking for the room in the work-stealing queue when
+/// waiting for it (guards against wake-ups lost in races between
+/// concurrent pushes)
+static const unsigned int kStealingQueueWaitSliceMs = 100;
+
+inline
+CThreadPool_StealingQueue::CThreadPool_StealingQueue(unsigned int max_size,
+                                                     unsigned int shards_count)
+    : m_Shards(shards_count),
+      m_ShardsCount(shards_count),
+      m_MaxSize(max_size),
+      m_RoomTrigger(0, kMax_Int)
+{
+    _ASSERT(shards_count > 0);
+    for (unsigned int i = 0; i < m_ShardsCount; ++i) {
+        for (unsigned int band = 0; band < kBandsCount; ++band) {
+            m_Shards[i].counts[band].Set(0);
+        }
+    }
+    m_Size.Set(0);
+    m_Reserved.Set(0);
+    m_RoomWaiters.Set(0);
+}
+
+inline unsigned int
+CThreadPool_StealingQueue::GetShardsCount(void) const
+{
+    return m_ShardsCount;
+}
+
+inline size_t
+CThreadPool_StealingQueue::GetSize(void) const
+{
+    return (size_t)m_Size.Get();
+}
+
+inline unsigned int
+CThreadPool_StealingQueue::x_GetBand(const CThreadPool_Task* task)
+{
+    return min(task->GetPriority(), (unsigned int)(kBandsCount - 1));
+}
+
+inline void
+CThreadPool_StealingQueue::x_ReleaseRoom(size_t count)
+{
+    m_Reserved.Add(-(int)count);
+    for (TNCBIAtomicValue waiters = m_RoomWaiters.Get();
+         count > 0  &&  waiters > 0;  --count, --waiters)
+    {
+        m_RoomTrigger.Post();
+    }
+}
+
+void
+CThreadPool_StealingQueue::Push(const TTaskRef&  task,
+                                unsigned int     shard,
+                                const CTimeSpan* timeout)
+{
+    if ((size_t)m_Reserved.Add(1) > m_MaxSize) {
+        m_Reserved.Add(-1);
+
+        CStopWatch timer(CStopWatch::eStart);
+        m_RoomWaiters.Add(1);
+        // Room is checked again after registering as waiter, so that
+        // any release of room after that will post the semaphore.
+        while ((size_t)m_Reserved.Add(1) > m_MaxSize) {
+            m_Reserved.Add(-1);
+
+            unsigned int wait_ms = kStealingQueueWaitSliceMs;
+            if (timeout) {
+                double left = timeout->GetAsDouble() - timer.Elapsed();
+                if (left <= 0) {
+                    m_RoomWaiters.Add(-1);
+                    ThrowSyncQueueNoRoom();
+                }
+                wait_ms = min(wait_ms, (unsigned int)(left * 1000) + 1);
+            }
+            m_RoomTrigger.TryWait(wait_ms / 1000,
+                                  (wait_ms % 1000) * 1000000);
+        }
+        m_RoomWaiters.Add(-1);
+    }
+
+    SShard& sh = m_Shards[shard % m_ShardsCount];
+    unsigned int band = x_GetBand(task);
+    {{
+        CFastMutexGuard guard(sh.lock);
+        sh.bands[band].push_back(task);
+        sh.counts[band].Add(1);
+    }}
+    m_Size.Add(1);
+}
+
+CThreadPool_StealingQueue::TTaskRef
+CThreadPool_StealingQueue::Pop(unsigned int home_shard)
+{
+    home_shard %= m_ShardsCount;
+    for (unsigned int band = 0; band < kBandsCount; ++band) {
+        for (unsigned int i = 0; i < m_ShardsCount; ++i) {
+            SShard& sh = m_Shards[(home_shard + i) % m_ShardsCount];
+            if (sh.counts[band].Get() == 0) {
+                continue;
+            }
+
+            TTaskRef task;
+            {{
+                CFastMutexGuard guard(sh.lock);
+                deque<TTaskRef>& tasks = sh.bands[band];
+                if (tasks.empty()) {
+                    continue;
+                }
+                task.Swap(tasks.front());
+                tasks.pop_front();
+                sh.counts[band].Add(-1);
+            }}
+            m_Size.Add(-1);
+            x_ReleaseRoom(1);
+            return task;
+        }
+    }
+
+    return TTaskRef();
+}
+
+void
+CThreadPool_StealingQueue::Erase(const CThreadPool_Task* task)
+{
+    for (unsigned int i = 0; i < m_ShardsCount; ++i) {
+        SShard& sh = m_Shards[i];
+        CFastMutexGuard guard(sh.lock);
+        for (unsigned int band = 0; band < kBandsCount; ++band) {
+            deque<TTaskRef>& tasks = sh.bands[band];
+            NON_CONST_ITERATE(deque<TTaskRef>, it, tasks) {
+                if (*it == task) {
+                    tasks.erase(it);
+                    sh.counts[band].Add(-1);
+                    guard.Release();
+                    m_Size.Add(-1);
+                    x_ReleaseRoom(1);
+                    return;
+                }
+            }
+        }
+    }
+}
+
+void
+CThreadPool_StealingQueue::TakeAll(TTaskList* tasks)
+{
+    for (unsigned int i = 0; i < m_ShardsCount; ++i) {
+        SShard& sh = m_Shards[i];
+        size_t count = 0;
+        {{
+            CFastMutexGuard guard(sh.lock);
+            for (unsigned int band = 0; band < kBandsCount; ++band) {
+                deque<TTaskRef>& band_tasks = sh.bands[band];
+                count += band_tasks.size();
+                tasks->insert(tasks->end(),
+                              band_tasks.begin(), band_tasks.end());
+                band_tasks.clear();
+                sh.counts[band].Set(0);
+            }
+        }}
+        if (count != 0) {
+            m_Size.Add(-(int)count);
+            x_ReleaseRoom(count);
+        }
+    }
+}
+
+
+
 inline CThreadPool_Impl*
 CThreadPool_Impl::s_GetImplPointer(CThreadPool* pool)
 {
@@ -1406,33 +1749,51 @@ CThreadPool_Impl::CThreadPool_Impl(CThreadPool*      pool_intf,
                                    unsigned int      queue_size,
                                    unsigned int      max_threads,
                                    unsigned int      min_threads,
-                                   CThread::TRunMode threads_mode)
+                                   CThread::TRunMode threads_mode,
+                                   CThreadPool::EQueueType queue_type)
     : m_Queue(x_GetQueueSize(queue_size)),
       m_RoomWait(0, kMax_Int),
       m_AbortWait(0, kMax_Int)
 {
     x_Init(pool_intf,
            new CThreadPool_Controller_PID(max_threads, min_threads),
-           threads_mode);
+           threads_mode, queue_type, queue_size, max_threads);
 }
 
 inline
 CThreadPool_Impl::CThreadPool_Impl(CThreadPool*            pool_intf,
                                    unsigned int            queue_size,
                                    CThreadPool_Controller* controller,
-                                   CThread::TRunMode       threads_mode)
+                                   CThread::TRunMode       threads_mode,
+                                   CThreadPool::EQueueType queue_type)
     : m_Queue(x_GetQueueSize(queue_size)),
       m_RoomWait(0, kMax_Int),
       m_AbortWait(0, kMax_Int)
 {
-    x_Init(pool_intf, controller, threads_mode);
+    x_Init(pool_intf, controller, threads_mode, queue_type, queue_size,
+           controller->GetMaxThreads());
 }
 
 void
 CThreadPool_Impl::x_Init(CThreadPool*             pool_intf,
                          CThreadPool_Controller*  controller,
-                         CThread::TRunMode        threads_mode)
-{
+                         CThread::TRunMode        threads_mode,
+                         CThreadPool::EQueueType  queue_type,
+                         unsigned int             queue_size,
+                         unsigned int             max_threads)
+{
+    if (queue_type == CThreadPool::eQueue_WorkStealing) {
+        // Number of shards more than number of CPUs or threads gives no
+        // gain in contention but makes stealing more expensive.
+        unsigned int shards = min(max(max_threads, 1U),
+                                  max(GetCpuCount(), 1U));
+        m_StealingQueue.reset(new CThreadPool_StealingQueue(
+                                    (unsigned int)m_Queue.GetMaxSize(),
+                                    shards));
+    }
+    m_NextThreadQueue.Set(0);
+    m_NextPushQueue.Set(0);
+
     m_Interface = pool_intf;
     m_SelfRef = this;
     m_DestroyTimeout = CTimeSpan(10, 0);
@@ -1539,7 +1900,7 @@ CThreadPool_Impl::SetThreadIdle(CThreadPool_ThreadImpl* thread, bool is_idle)
 {
     CThreadPool_Guard guard(this);
 
-    if (is_idle  &&  !m_Suspended  &&  m_Queue.GetSize() != 0) {
+    if (is_idle  &&  !m_Suspended  &&  GetQueuedTasksCount() != 0) {
         thread->WakeUp();
         return false;
     }
@@ -1691,7 +2052,12 @@ CThreadPool_Impl::AddTask(CThreadPool_Task* task, const CTimeSpan* timeout)
     try {
         // Pushing to queue must be out of mutex to be able to wait
         // for available space.
-        m_Queue.Push(Ref(task), timeout);
+        if (m_StealingQueue.get()) {
+            m_StealingQueue->Push(Ref(task), x_GetPushQueueIndex(), timeout);
+        }
+        else {
+            m_Queue.Push(Ref(task), timeout);
+        }
     }
     catch (...) {
         task->x_SetStatus(CThreadPool_Task::eIdle);
@@ -1711,7 +2077,7 @@ CThreadPool_Impl::AddTask(CThreadPool_Task* task, const CTimeSpan* timeout)
     if (m_Aborted  ||  (m_Suspended
                         &&  (m_SuspendFlags & check_flags)  == check_flags))
     {
-        if (m_Queue.GetSize() != 0) {
+        if (GetQueuedTasksCount() != 0) {
             x_CancelQueuedTasks();
         }
         return;
@@ -1741,6 +2107,11 @@ CThreadPool_Impl::AddTask(CThreadPool_Task* task, const CTimeSpan* timeout)
 inline void
 CThreadPool_Impl::x_RemoveTaskFromQueue(const CThreadPool_Task* task)
 {
+    if (m_StealingQueue.get()) {
+        m_StealingQueue->Erase(task);
+        return;
+    }
+
     TQueue::TAccessGuard q_guard(m_Queue);
 
     TQueue::TAccessGuard::TIterator it = q_guard.Begin();
@@ -1848,6 +2219,15 @@ CThreadPool_Impl::x_CancelExecutingTasks(void)
 void
 CThreadPool_Impl::x_CancelQueuedTasks(void)
 {
+    if (m_StealingQueue.get()) {
+        CThreadPool_StealingQueue::TTaskList tasks;
+        m_StealingQueue->TakeAll(&tasks);
+        NON_CONST_ITERATE(CThreadPool_StealingQueue::TTaskList, it, tasks) {
+            it->GetNCPointer()->x_RequestToCancel();
+        }
+        return;
+    }
+
     TQueue::TAccessGuard q_guard(m_Queue);
 
     for (TQueue::TAccessGuard::TIterator it = q_guard.Begin();
@@ -2160,18 +2540,21 @@ CThreadPool_Thread::OnExit(void)
 CThreadPool::CThreadPool(unsigned int      queue_size,
                          unsigned int      max_threads,
                          unsigned int      min_threads,
-                         CThread::TRunMode threads_mode)
+                         CThread::TRunMode threads_mode,
+                         EQueueType        queue_type)
 {
     m_Impl = new CThreadPool_Impl(this, queue_size, max_threads, min_threads,
-                                  threads_mode);
+                                  threads_mode, queue_type);
     m_Impl->SetInterfaceStarted();
 }
 
 CThreadPool::CThreadPool(unsigned int            queue_size,
                          CThreadPool_Controller* controller,
-                         CThread::TRunMode       threads_mode)
+                         CThread::TRunMode       threads_mode,
+                         EQueueType              queue_type)
 {
-    m_Impl = new CThreadPool_Impl(this, queue_size, controller, threads_mode);
+    m_Impl = new CThreadPool_Impl(this, queue_size, controller, threads_mode,
+                                  queue_type);
     m_Impl->SetInterfaceStarted();
 }
 